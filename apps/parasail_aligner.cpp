@@ -41,10 +41,10 @@
 #include <cctype>
 #include <cfloat>
 #include <climits>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <set>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -60,9 +60,24 @@
 
 #include "parasail.h"
 #include "parasail/io.h"
+#include "parasail/memory.h"
 
 #include "sais.h"
 
+#include "parasail_results.h"
+
+#if HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+/* tasks and atomic reads and writes need OpenMP 3.1 */
+#if defined(_OPENMP) && _OPENMP >= 201107
+#define USE_OMP_TASKS 1
+#endif
+
 #if HAVE_VARIADIC_MACROS
 #define eprintf(STREAM, ...) fprintf(STREAM, __VA_ARGS__); fflush(STREAM)
 #else
@@ -74,22 +89,135 @@
 extern "C" size_t getMemorySize(void);
 
 using ::std::bad_alloc;
+using ::std::inplace_merge;
 using ::std::istringstream;
 using ::std::make_pair;
+using ::std::max;
 using ::std::pair;
-using ::std::set;
 using ::std::size_t;
+using ::std::sort;
 using ::std::stack;
 using ::std::string;
 using ::std::toupper;
 using ::std::transform;
+using ::std::unique;
 using ::std::vector;
 
 typedef pair<int,int> Pair;
 
-typedef set<Pair> PairSet;
 typedef vector<Pair> PairVec;
 
+/* A candidate pair packed into one integer, the first sequence in the
+ * high half, so that sorted keys are pairs in the same sorted order. */
+typedef unsigned long long PairKey;
+typedef vector<PairKey> KeyVec;
+
+/* number of LCP intervals handed to the threads at once */
+#define INTERVAL_BLOCK 16384
+
+/* number of generated keys a thread may append before it merges them
+ * into its sorted run, in addition to the size of the run itself */
+#define KEY_SLACK 1048576
+
+/* number of pairs taken from the pair stream and aligned at once */
+#define PAIR_SLICE 1048576
+
+/* A maximal exact match between the two sequences of a pair, kept from
+ * the LCP intervals for the chaining mode.  The positions are offsets
+ * into the packed text until the anchors are sorted, and offsets into
+ * their own sequences after that. */
+struct anchor {
+    int first;
+    int second;
+    long pos_first;
+    long pos_second;
+    int len;
+
+    anchor(int first, int second, long pos_first, long pos_second, int len)
+        : first(first), second(second),
+          pos_first(pos_first), pos_second(pos_second), len(len) {}
+
+    bool operator<(const anchor &that) const {
+        if (first != that.first) return first < that.first;
+        if (second != that.second) return second < that.second;
+        if (pos_first != that.pos_first) return pos_first < that.pos_first;
+        return pos_second < that.pos_second;
+    }
+};
+
+typedef vector<anchor> AnchorVec;
+
+/* The anchors of the pairs of one slice of the pair stream, and the
+ * index of the first anchor of every pair followed by the count.  A
+ * slice drops its anchors once its pairs are aligned. */
+struct anchor_slice {
+    AnchorVec anchors;
+    vector<long> offsets;
+};
+
+/* how many earlier anchors a chain link may skip back over */
+#define CHAIN_LOOKBACK 64
+
+/* The banded functions take the band size as an extra argument, so they
+ * are not in the library's function table.  The fields mirror
+ * parasail_function_info_t for calc_batches. */
+struct banded_info {
+    const char *name;
+    parasail_banded_function_t *pointer;
+    const char *type;
+    bool is_table;
+    bool is_rowcol;
+    bool is_trace;
+    bool is_stats;
+    parasail_banded_encoded_function_t *encoded;
+};
+
+#define BANDED_INFO(NAME, ENCODED, TRACE, STATS) \
+    {#NAME, NAME, "banded", false, false, TRACE, STATS, ENCODED}
+#define BANDED_INFOS(PREFIX, TRACE, STATS) \
+    BANDED_INFO(PREFIX##_8, PREFIX##_encoded_8, TRACE, STATS), \
+    BANDED_INFO(PREFIX##_16, PREFIX##_encoded_16, TRACE, STATS), \
+    BANDED_INFO(PREFIX##_32, PREFIX##_encoded_32, TRACE, STATS), \
+    BANDED_INFO(PREFIX##_sat, PREFIX##_encoded_sat, TRACE, STATS)
+
+static const banded_info banded_functions[] = {
+    /* the original scalar name now selects the vectorized kernels */
+    {"parasail_nw_banded", parasail_nw_banded_sat, "banded", false, false, false, false, parasail_nw_banded_encoded_sat},
+    BANDED_INFOS(parasail_nw_banded, false, false),
+    BANDED_INFOS(parasail_sg_banded, false, false),
+    BANDED_INFOS(parasail_sw_banded, false, false),
+    BANDED_INFOS(parasail_nw_stats_banded, false, true),
+    BANDED_INFOS(parasail_sg_stats_banded, false, true),
+    BANDED_INFOS(parasail_sw_stats_banded, false, true),
+    BANDED_INFOS(parasail_nw_trace_banded, true, false),
+    BANDED_INFOS(parasail_sg_trace_banded, true, false),
+    BANDED_INFOS(parasail_sw_trace_banded, true, false),
+    BANDED_INFOS(parasail_nw_banded_adaptive, false, false),
+    BANDED_INFOS(parasail_sg_banded_adaptive, false, false),
+    BANDED_INFOS(parasail_sw_banded_adaptive, false, false),
+    BANDED_INFOS(parasail_nw_stats_banded_adaptive, false, true),
+    BANDED_INFOS(parasail_sg_stats_banded_adaptive, false, true),
+    BANDED_INFOS(parasail_sw_stats_banded_adaptive, false, true),
+    BANDED_INFOS(parasail_nw_trace_banded_adaptive, true, false),
+    BANDED_INFOS(parasail_sg_trace_banded_adaptive, true, false),
+    BANDED_INFOS(parasail_sw_trace_banded_adaptive, true, false),
+    {NULL, NULL, NULL, false, false, false, false, NULL}
+};
+
+/* like parasail_lookup_function_info, the "parasail_" prefix is optional */
+static const banded_info * lookup_banded_info(const char *funcname)
+{
+    const char *prefix = "parasail_";
+    size_t prefix_len = strlen(prefix);
+    for (const banded_info *f=banded_functions; NULL != f->name; ++f) {
+        if (0 == strcmp(funcname, f->name)
+                || 0 == strcmp(funcname, f->name + prefix_len)) {
+            return f;
+        }
+    }
+    return NULL;
+}
+
 struct quad {
     int lcp;
     int lb;
@@ -108,9 +236,11 @@ struct quad {
 
 inline static void pair_check(
         unsigned long &count_generated,
-        PairSet &pairs,
+        KeyVec &keys,
+        AnchorVec *anchors,
         const int &i,
         const int &j,
+        const int &lcp,
         const int * const restrict SA,
         const unsigned char * const restrict BWT,
         const int * const restrict SID,
@@ -119,7 +249,8 @@ inline static void pair_check(
 
 inline static void process(
         unsigned long &count_generated,
-        PairSet &pairs,
+        KeyVec &keys,
+        AnchorVec *anchors,
         const quad &q,
         const int * const restrict SA,
         const unsigned char * const restrict BWT,
@@ -128,6 +259,244 @@ inline static void process(
         const char &sentinal,
         const int &cutoff);
 
+static void process_block(
+        unsigned long &count_generated,
+        vector<KeyVec> &runs,
+        vector<AnchorVec> *anchors,
+        vector<quad> &block,
+        const int * const restrict SA,
+        const unsigned char * const restrict BWT,
+        const int * const restrict SID,
+        const vector<int> &DB,
+        const char &sentinal,
+        const int &cutoff);
+
+/* Hands out the unique candidate pairs in sorted order, a slice at a
+ * time.  The sorted runs of keys from the threads are merged, or the
+ * pairs are enumerated when there is no filter, only as the slices are
+ * taken, so that alignment starts before all pairs exist and only one
+ * slice of pairs and results is held at once. */
+struct pair_stream {
+    const vector<KeyVec> *runs;
+    vector<size_t> cursor;
+    const PairVec *list;
+    long sid;
+    long sid_crossover;
+    long i;
+    long j;
+    size_t offset; /* index of the first pair of the last slice */
+    size_t taken;
+
+    /* merge of sorted, unique runs of keys */
+    pair_stream(const vector<KeyVec> &runs)
+        : runs(&runs), cursor(runs.size(), 0), list(NULL),
+          sid(0), sid_crossover(-1), i(0), j(0), offset(0), taken(0) {}
+
+    /* pairs that were already collected */
+    pair_stream(const PairVec &list)
+        : runs(NULL), cursor(), list(&list),
+          sid(0), sid_crossover(-1), i(0), j(0), offset(0), taken(0) {}
+
+    /* all against all, or all queries against the database */
+    pair_stream(long sid, long sid_crossover)
+        : runs(NULL), cursor(), list(NULL),
+          sid(sid), sid_crossover(sid_crossover),
+          i(sid_crossover < 0 ? 0 : sid_crossover),
+          j(sid_crossover < 0 ? 1 : 0), offset(0), taken(0) {}
+
+    bool next(PairVec &slice, size_t max) {
+        slice.clear();
+        if (runs) {
+            const size_t n_runs = runs->size();
+            while (slice.size() < max) {
+                size_t best = n_runs;
+                for (size_t r=0; r<n_runs; ++r) {
+                    if (cursor[r] < (*runs)[r].size() && (best == n_runs
+                                || (*runs)[r][cursor[r]] < (*runs)[best][cursor[best]])) {
+                        best = r;
+                    }
+                }
+                if (best == n_runs) break;
+                PairKey key = (*runs)[best][cursor[best]];
+                /* each run is unique, so skip the key once in every run */
+                for (size_t r=0; r<n_runs; ++r) {
+                    if (cursor[r] < (*runs)[r].size()
+                            && (*runs)[r][cursor[r]] == key) {
+                        ++cursor[r];
+                    }
+                }
+                slice.push_back(make_pair(int(key >> 32), int(key & 0xFFFFFFFFULL)));
+            }
+        }
+        else if (list) {
+            size_t stop = taken + max;
+            if (stop > list->size()) stop = list->size();
+            slice.assign(list->begin() + taken, list->begin() + stop);
+        }
+        else {
+            const bool all = sid_crossover < 0;
+            while (slice.size() < max && i < sid) {
+                if (j >= (all ? sid : sid_crossover)) {
+                    ++i;
+                    j = all ? i+1 : 0;
+                    continue;
+                }
+                slice.push_back(make_pair(int(i), int(j)));
+                ++j;
+            }
+        }
+        offset = taken;
+        taken += slice.size();
+        return !slice.empty();
+    }
+};
+
+static parasail_result_t* chain_align(
+        const anchor * const restrict anchors,
+        long count,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        parasail_banded_function_t *nw_function,
+        int flag);
+
+/* Aligns one pair of the current slice with the function that was
+ * chosen, adding the cells it visits to work.  The batch loop is the
+ * same for every kind of function and only calls align. */
+struct pair_aligner {
+    const unsigned char *T;
+    const vector<long> &BEG;
+    const vector<long> &END;
+    const int open;
+    const int gap;
+    const parasail_matrix_t *matrix;
+    const long band;    /* passed to order_by_cost, 0 if unbanded */
+
+    pair_aligner(const unsigned char *T_,
+            const vector<long> &BEG_, const vector<long> &END_,
+            int open_, int gap_, const parasail_matrix_t *matrix_,
+            long band_)
+        : T(T_), BEG(BEG_), END(END_), open(open_), gap(gap_),
+          matrix(matrix_), band(band_) {}
+
+    virtual ~pair_aligner() {}
+
+    virtual parasail_result_t* align(long long index, int i, int j,
+            unsigned long long &work) const = 0;
+
+private:
+    pair_aligner(const pair_aligner&);
+    pair_aligner& operator=(const pair_aligner&);
+};
+
+struct function_aligner : public pair_aligner {
+    parasail_function_t *function;
+
+    function_aligner(const unsigned char *T_,
+            const vector<long> &BEG_, const vector<long> &END_,
+            int open_, int gap_, const parasail_matrix_t *matrix_,
+            parasail_function_t *function_)
+        : pair_aligner(T_, BEG_, END_, open_, gap_, matrix_, 0),
+          function(function_) {}
+
+    parasail_result_t* align(long long index, int i, int j,
+            unsigned long long &work) const {
+        long i_len = END[i]-BEG[i];
+        long j_len = END[j]-BEG[j];
+        (void)index;
+        work = (unsigned long long)i_len * j_len;
+        return function(
+                (const char*)&T[BEG[i]], i_len,
+                (const char*)&T[BEG[j]], j_len,
+                open, gap, matrix);
+    }
+};
+
+/* Banded pairs are chained from the anchors of the slice when chaining,
+ * aligned from their encoded sequences when those were made, and by the
+ * banded function otherwise. */
+struct banded_aligner : public pair_aligner {
+    parasail_banded_function_t *function;
+    parasail_banded_encoded_function_t *encoded_function;
+    const vector<parasail_encoded_t*> &encoded;
+    const vector<anchor_slice> *anchor_slices;
+    const pair_stream &stream;
+    parasail_banded_function_t *chain_function;
+    int chain_flag;
+
+    banded_aligner(const unsigned char *T_,
+            const vector<long> &BEG_, const vector<long> &END_,
+            int open_, int gap_, const parasail_matrix_t *matrix_,
+            long band_,
+            parasail_banded_function_t *function_,
+            parasail_banded_encoded_function_t *encoded_function_,
+            const vector<parasail_encoded_t*> &encoded_,
+            const vector<anchor_slice> *anchor_slices_,
+            const pair_stream &stream_,
+            parasail_banded_function_t *chain_function_,
+            int chain_flag_)
+        : pair_aligner(T_, BEG_, END_, open_, gap_, matrix_, band_),
+          function(function_), encoded_function(encoded_function_),
+          encoded(encoded_), anchor_slices(anchor_slices_),
+          stream(stream_), chain_function(chain_function_),
+          chain_flag(chain_flag_) {}
+
+    parasail_result_t* align(long long index, int i, int j,
+            unsigned long long &work) const {
+        long i_len = END[i]-BEG[i];
+        long j_len = END[j]-BEG[j];
+        work = (unsigned long long)i_len * j_len;
+        if (NULL != anchor_slices) {
+            const anchor_slice &slice =
+                (*anchor_slices)[stream.offset / PAIR_SLICE];
+            long a_beg = slice.offsets[index];
+            long a_end = slice.offsets[index+1];
+            return chain_align(
+                    &slice.anchors[a_beg], a_end-a_beg,
+                    (const char*)&T[BEG[i]], i_len,
+                    (const char*)&T[BEG[j]], j_len,
+                    open, gap, (int)band, matrix,
+                    chain_function, chain_flag);
+        }
+        if (!encoded.empty()) {
+            return encoded_function(encoded[i], encoded[j],
+                    open, gap, (int)band);
+        }
+        return function(
+                (const char*)&T[BEG[i]], i_len,
+                (const char*)&T[BEG[j]], j_len,
+                open, gap, (int)band, matrix);
+    }
+};
+
+/* The profile of the first sequence was made before the batch. */
+struct profile_aligner : public pair_aligner {
+    parasail_pfunction_t *function;
+    const vector<parasail_profile_t*> &profiles;
+
+    profile_aligner(const unsigned char *T_,
+            const vector<long> &BEG_, const vector<long> &END_,
+            int open_, int gap_, const parasail_matrix_t *matrix_,
+            parasail_pfunction_t *function_,
+            const vector<parasail_profile_t*> &profiles_)
+        : pair_aligner(T_, BEG_, END_, open_, gap_, matrix_, 0),
+          function(function_), profiles(profiles_) {}
+
+    parasail_result_t* align(long long index, int i, int j,
+            unsigned long long &work) const {
+        long j_len = END[j]-BEG[j];
+        parasail_profile_t *profile = profiles[i];
+        (void)index;
+        if (NULL == profile) {
+            eprintf(stderr, "BAD PROFILE %d\n", i);
+            exit(EXIT_FAILURE);
+        }
+        work = (unsigned long long)profile->s1Len * j_len;
+        return function(profile, (const char*)&T[BEG[j]], j_len, open, gap);
+    }
+};
+
 inline static void print_array(
         const char * filename_,
         const int * const restrict array,
@@ -139,6 +508,275 @@ inline static int self_score(
         int len,
         const parasail_matrix_t *matrix);
 
+/* A stream that one thread formats output records into before they are
+ * copied out, in memory where open_memstream is available and in a
+ * temporary file otherwise. */
+struct record_stream {
+    FILE *file;
+    char *data;
+    size_t size;
+
+    record_stream() : file(NULL), data(NULL), size(0) {
+#ifdef HAVE_OPEN_MEMSTREAM
+        file = open_memstream(&data, &size);
+#else
+        file = tmpfile();
+#endif
+        if (NULL == file) {
+            eprintf(stderr, "could not create record stream\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    ~record_stream() {
+        fclose(file);
+        free(data);
+    }
+
+    /* moves the text written since the last call into text */
+    void take(string &text) {
+        long length = ftell(file);
+        fflush(file);
+        text.clear();
+        if (length > 0) {
+#ifdef HAVE_OPEN_MEMSTREAM
+            text.assign(data, length);
+#else
+            text.resize(length);
+            rewind(file);
+            if (fread(&text[0], 1, length, file) != (size_t)length) {
+                eprintf(stderr, "could not read record stream\n");
+                exit(EXIT_FAILURE);
+            }
+#endif
+        }
+        rewind(file);
+    }
+
+private:
+    record_stream(const record_stream&);
+    record_stream& operator=(const record_stream&);
+};
+
+enum {
+    COMPRESS_NONE,
+    COMPRESS_GZIP,
+    COMPRESS_ZSTD
+};
+
+/* uncompressed text per block, BGZF allows at most 64KB */
+#define GZIP_BLOCK 65280
+#define ZSTD_BLOCK 1048576
+
+/* Output that is compressed in independent blocks, gzip members in the
+ * BGZF layout read by bgzip and htslib, or zstd frames.  The output
+ * functions write text to file as usual; drain() cuts what they wrote
+ * into blocks and compresses each in an OpenMP task, so threads that
+ * are done aligning a batch compress the output of the previous one.
+ * Blocks are written to the real file in order as they complete. */
+struct compressed_output {
+    struct block {
+        string text;
+        string data;
+        int done;
+    };
+
+    FILE *file;
+    int codec;
+    record_stream stream;
+    string pending;
+    vector<block*> blocks;
+    size_t written;
+
+    compressed_output(FILE *file_, int codec_)
+        : file(file_), codec(codec_), stream(), pending(),
+          blocks(), written(0) {
+    }
+
+    ~compressed_output() {
+        for (size_t b=written; b<blocks.size(); ++b) {
+            delete blocks[b];
+        }
+    }
+
+    /* compresses the full blocks written to the stream so far */
+    void drain() {
+        string text;
+        size_t size = codec == COMPRESS_GZIP ? GZIP_BLOCK : ZSTD_BLOCK;
+        size_t offset = 0;
+        stream.take(text);
+        pending += text;
+        while (pending.size() - offset >= size) {
+            spawn(pending.substr(offset, size));
+            offset += size;
+        }
+        pending.erase(0, offset);
+        write(false);
+    }
+
+    /* compresses the rest and writes all blocks, outside of any
+     * parallel region so that all tasks have completed, and returns
+     * the real file */
+    FILE* finish() {
+        drain();
+        if (!pending.empty()) {
+            spawn(pending);
+            pending.clear();
+        }
+        write(true);
+        if (COMPRESS_GZIP == codec) {
+            /* the empty block that marks the end of a BGZF file */
+            static const unsigned char eof[28] = {
+                0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+                0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00,
+                0x1b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x00, 0x00, 0x00, 0x00};
+            fwrite(eof, 1, sizeof(eof), file);
+        }
+        fflush(file);
+        return file;
+    }
+
+private:
+    void spawn(const string &text) {
+        block *next = new block;
+        int codec_ = codec;
+        next->text = text;
+        next->done = 0;
+        blocks.push_back(next);
+#ifdef USE_OMP_TASKS
+#pragma omp task firstprivate(next, codec_)
+#endif
+        {
+            compress(next, codec_);
+            /* an atomic write only flushes done itself, so the block
+             * data is flushed first for the thread that reads done */
+#ifdef USE_OMP_TASKS
+#pragma omp flush
+#pragma omp atomic write
+#endif
+            next->done = 1;
+        }
+    }
+
+    void write(bool all) {
+        while (written < blocks.size()) {
+            block *next = blocks[written];
+            int done = 0;
+#ifdef USE_OMP_TASKS
+#pragma omp atomic read
+#endif
+            done = next->done;
+#ifdef USE_OMP_TASKS
+#pragma omp flush
+#endif
+            if (!done && !all) {
+                break;
+            }
+            fwrite(next->data.data(), 1, next->data.size(), file);
+            delete next;
+            blocks[written++] = NULL;
+        }
+        if (written == blocks.size()) {
+            blocks.clear();
+            written = 0;
+        }
+    }
+
+    static void compress(block *next, int codec) {
+        if (COMPRESS_GZIP == codec) {
+            compress_gzip(next);
+        }
+        else {
+            compress_zstd(next);
+        }
+        string().swap(next->text);
+    }
+
+    static void compress_gzip(block *next) {
+#if HAVE_ZLIB
+        /* fixed header with the BC extra field that holds the block
+         * size, then raw deflate, the CRC32, and the input size */
+        static const unsigned char header[16] = {
+            0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00};
+        const size_t limit = 65536 - 26;
+        const string &text = next->text;
+        unsigned char *buffer = new unsigned char[limit + 26];
+        unsigned long crc = 0;
+        size_t size = 0;
+        int level = Z_DEFAULT_COMPRESSION;
+        int status = Z_OK;
+
+        do {
+            z_stream zs;
+            zs.zalloc = Z_NULL;
+            zs.zfree = Z_NULL;
+            zs.opaque = Z_NULL;
+            zs.next_in = (Bytef*)text.data();
+            zs.avail_in = (uInt)text.size();
+            zs.next_out = buffer + 18;
+            zs.avail_out = (uInt)limit;
+            if (Z_OK != deflateInit2(&zs, level, Z_DEFLATED, -15, 8,
+                        Z_DEFAULT_STRATEGY)) {
+                eprintf(stderr, "deflateInit2 failed\n");
+                exit(EXIT_FAILURE);
+            }
+            status = deflate(&zs, Z_FINISH);
+            size = limit - zs.avail_out;
+            deflateEnd(&zs);
+            /* text that does not compress is stored instead */
+            if (Z_STREAM_END != status) {
+                if (Z_NO_COMPRESSION == level) {
+                    eprintf(stderr, "deflate failed\n");
+                    exit(EXIT_FAILURE);
+                }
+                level = Z_NO_COMPRESSION;
+            }
+        } while (Z_STREAM_END != status);
+
+        crc = crc32(0L, Z_NULL, 0);
+        crc = crc32(crc, (const Bytef*)text.data(), (uInt)text.size());
+        memcpy(buffer, header, sizeof(header));
+        put_le(buffer + 16, size + 25, 2);
+        put_le(buffer + 18 + size, crc, 4);
+        put_le(buffer + 22 + size, text.size(), 4);
+        next->data.assign((const char*)buffer, size + 26);
+        delete [] buffer;
+#else
+        (void)next;
+#endif
+    }
+
+    static void compress_zstd(block *next) {
+#ifdef HAVE_ZSTD
+        const string &text = next->text;
+        size_t bound = ZSTD_compressBound(text.size());
+        size_t size = 0;
+        next->data.resize(bound);
+        size = ZSTD_compress(&next->data[0], bound,
+                text.data(), text.size(), 0);
+        if (ZSTD_isError(size)) {
+            eprintf(stderr, "ZSTD_compress failed: %s\n",
+                    ZSTD_getErrorName(size));
+            exit(EXIT_FAILURE);
+        }
+        next->data.resize(size);
+#else
+        (void)next;
+#endif
+    }
+
+    static void put_le(unsigned char *out, unsigned long value, int bytes) {
+        for (int b=0; b<bytes; ++b) {
+            out[b] = (unsigned char)(value >> (8*b));
+        }
+    }
+
+    compressed_output(const compressed_output&);
+    compressed_output& operator=(const compressed_output&);
+};
+
 inline static void output_edges(
         FILE *fop,
         bool has_query,
@@ -194,6 +832,18 @@ inline static void output_basic(
         long long start,
         long long stop);
 
+inline static void output_binary(
+        FILE *fop,
+        bool is_stats,
+        bool has_query,
+        long sid_crossover,
+        const vector<long> &BEG,
+        const vector<long> &END,
+        const PairVec &vpairs,
+        const vector<parasail_result_t*> &results,
+        long long start,
+        long long stop);
+
 inline static void output_emboss(
         FILE *fop,
         bool has_query,
@@ -222,9 +872,12 @@ inline static void output_ssw(
         bool case_sensitive,
         const char *alphabet_aliases);
 
+inline static void output_sam_header(
+        FILE *fop,
+        parasail_sequences_t *sequences);
+
 inline static void output_sam(
         FILE *fop,
-        bool use_sam_header,
         bool has_query,
         long sid_crossover,
         const parasail_matrix_t *matrix,
@@ -271,7 +924,40 @@ inline static void output(
         bool use_emboss_format,
         bool use_ssw_format,
         bool use_sam_format,
-        bool use_sam_header,
+        bool use_binary_format,
+        FILE *fop,
+        bool has_query,
+        long sid_crossover,
+        unsigned char *T,
+        int AOL,
+        int SIM,
+        int OS,
+        const parasail_matrix_t *matrix,
+        const vector<long> &BEG,
+        const vector<long> &END,
+        const PairVec &vpairs,
+        parasail_sequences_t *queries,
+        parasail_sequences_t *sequences,
+        const vector<parasail_result_t*> &results,
+        long long start,
+        long long stop,
+        bool case_sensitive,
+        const char *alphabet_aliases);
+
+inline static void output_batch(
+        bool graph_output,
+        vector<vector<pair<int,float> > > &graph,
+        unsigned long &edge_count,
+        vector<string> &records,
+        compressed_output *compressed,
+        bool is_stats,
+        bool is_table,
+        bool is_trace,
+        bool edge_output,
+        bool use_emboss_format,
+        bool use_ssw_format,
+        bool use_sam_format,
+        bool use_binary_format,
         FILE *fop,
         bool has_query,
         long sid_crossover,
@@ -306,7 +992,7 @@ static void print_help(const char *progname, int status) {
             "[-d] "
             "[-M match] "
             "[-X mismatch] "
-            "[-k band size (for nw_banded)] "
+            "[-k band size (for *_banded)] "
             "[-l AOL] "
             "[-s SIM] "
             "[-i OS] "
@@ -315,11 +1001,13 @@ static void print_help(const char *progname, int status) {
             "-f file "
             "[-q query_file] "
             "[-g output_file] "
-            "[-O output_format {EMBOSS,SAM,SAMH,SSW}] "
+            "[-O output_format {BIN,EMBOSS,SAM,SAMH,SSW}] "
             "[-b batch_size] "
             "[-r memory_budget] "
             "[-C] "
+            "[-S] "
             "[-A alphabet_aliases] "
+            "[-z compression {none,gzip,zstd}] "
             "\n\n",
             progname);
     eprintf(stderr, "Defaults:\n"
@@ -341,14 +1029,18 @@ THREAD_DOC
             "              -V: verbose memory output, report memory use\n"
             "            file: no default, must be in FASTA format\n"
             "      query_file: no default, must be in FASTA format\n"
-            "     output_file: parasail.csv\n"
-            "   output_format: no deafult, must be one of {EMBOSS,SAM,SAMH,SSW}\n"
+            "     output_file: parasail.csv, or parasail.bin for BIN\n"
+            "   output_format: no deafult, must be one of {BIN,EMBOSS,SAM,SAMH,SSW},\n"
+            "                  BIN is binary records for functions without traceback\n"
             "      batch_size: 0 (calculate based on memory budget),\n"
             "                  how many alignments before writing output\n"
             "   memory_budget: 2GB or half available from system query (%.3f GB)\n"
             "              -C: if present, use case sensitive alignments, matrices, etc.\n"
+            "              -S: if present, chain the suffix array seeds of each pair and\n"
+            "                  only align around them, requires a *_banded funcname\n"
             "alphabet_aliases: traceback will treat these pairs of characters as matches,\n"
-            "                  for example, 'TU' for one pair, or multiple pairs as 'XYab'\n",
+            "                  for example, 'TU' for one pair, or multiple pairs as 'XYab'\n"
+            "     compression: none, or gzip for output_file *.gz or *.bgz and zstd for *.zst\n",
         getMemorySize()/2.0*GB
             );
     exit(status);
@@ -402,6 +1094,80 @@ static int stdin_has_data() {
 }
 #endif
 
+/* Estimated cost of aligning a pair, the number of cells its kernel
+ * visits.  The banded kernels visit band+1+|i_len-j_len|/2 cells on
+ * either side of the diagonal, the same count calc_batches assumes for
+ * their memory. */
+static inline unsigned long long pair_cost(long i_len, long j_len, long band)
+{
+    unsigned long long cells = (unsigned long long)i_len * (unsigned long long)j_len;
+    if (band > 0) {
+        unsigned long long banded = (unsigned long long)(i_len + j_len)
+            * (unsigned long long)(band + 1 + labs(i_len - j_len)/2);
+        if (banded < cells) {
+            cells = banded;
+        }
+    }
+    return cells;
+}
+
+static inline unsigned long long pair_cost(
+        const PairVec &vpairs,
+        const vector<long> &BEG,
+        const vector<long> &END,
+        size_t index,
+        long band)
+{
+    int i = vpairs[index].first;
+    int j = vpairs[index].second;
+    return pair_cost(END[i]-BEG[i], END[j]-BEG[j], band);
+}
+
+/* Longest processing time first.  The indices of a batch are ordered by
+ * decreasing cost and handed to the threads one at a time, so the large
+ * pairs are started first and the small ones fill in the end of the
+ * batch instead of one thread finishing a large pair alone.  Ties keep
+ * their index order. */
+static void order_by_cost(
+        vector<long long> &order,
+        long long start,
+        long long stop,
+        const PairVec &vpairs,
+        const vector<long> &BEG,
+        const vector<long> &END,
+        long band = 0)
+{
+    vector<pair<unsigned long long,long long> > costs;
+    costs.reserve(stop-start);
+    for (long long index=start; index<stop; ++index) {
+        /* complemented so that an ascending sort is longest first */
+        costs.push_back(make_pair(
+                    ~pair_cost(vpairs, BEG, END, index, band), index));
+    }
+    sort(costs.begin(), costs.end());
+    order.resize(costs.size());
+    for (size_t k=0; k<costs.size(); ++k) {
+        order[k] = costs[k].second;
+    }
+}
+
+static inline int thread_num()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+static inline bool has_suffix(const char *name, const char *suffix)
+{
+    size_t name_len = strlen(name);
+    size_t suffix_len = strlen(suffix);
+    return name_len >= suffix_len
+        && 0 == strcmp(name + name_len - suffix_len, suffix);
+}
+
 template <class info>
 vector<long long> calc_batches(
         long long batch_size,
@@ -411,7 +1177,8 @@ vector<long long> calc_batches(
         const PairVec &vpairs,
         const vector<long> &BEG,
         const vector<long> &END,
-        size_t &memory_estimate)
+        size_t &memory_estimate,
+        long band = 0)
 {
     vector<long long> batches;
     batches.push_back(0);
@@ -469,6 +1236,11 @@ vector<long long> calc_batches(
         else /* if (function_info->is_trace) */ {
             result_size += sizeof(parasail_result_extra_trace_t);
         }
+        /* linear-memory traces keep four DP rows while aligning and
+         * only the path afterwards; banded traces keep about band+1
+         * cells for each anti-diagonal */
+        bool is_linear = (0 == strcmp(function_info->type, "linear"));
+        bool is_banded = (0 == strcmp(function_info->type, "banded"));
         int i = vpairs[0].first;
         int j = vpairs[0].second;
         long i_beg = BEG[i];
@@ -484,6 +1256,13 @@ vector<long long> calc_batches(
         else if (function_info->is_rowcol) {
             current_size = sizeof(int) * multiplier * (i_len + j_len);
         }
+        else if (is_linear) {
+            current_size = sizeof(int) * 4 * (i_len + j_len);
+        }
+        else if (is_banded) {
+            current_size = sizeof(int) * (i_len + j_len)
+                * (band + 1 + labs(i_len - j_len)/2);
+        }
         else /* if (function_info->is_trace) */ {
             current_size = sizeof(int8_t) * multiplier * i_len * j_len;
         }
@@ -504,6 +1283,13 @@ vector<long long> calc_batches(
             else if (function_info->is_rowcol) {
                 local_size = sizeof(int) * multiplier * (i_len + j_len);
             }
+            else if (is_linear) {
+                local_size = sizeof(int) * 4 * (i_len + j_len);
+            }
+            else if (is_banded) {
+                local_size = sizeof(int) * (i_len + j_len)
+                    * (band + 1 + labs(i_len - j_len)/2);
+            }
             else /* if (function_info->is_trace) */ {
                 local_size = sizeof(int8_t) * multiplier * i_len * j_len;
             }
@@ -542,15 +1328,44 @@ vector<long long> calc_batches(
         /* the score, and perhaps stats */
         size_t results_per_batch = memory_budget / result_size;
         size_t how_many_batches = vpairs.size() / results_per_batch;
-        for (size_t i=0; i<how_many_batches; ++i) {
-            batches.push_back((i+1)*results_per_batch);
-        }
-        batches.push_back(vpairs.size());
-        if (results_per_batch > vpairs.size()) {
-            memory_estimate = result_size*vpairs.size();
+        if (how_many_batches > 0) {
+            /* Every result is the same size, so memory only limits the
+             * number of pairs in a batch.  Each batch is cut at an equal
+             * share of the cost that remains among as few batches as
+             * the remaining pairs need, or earlier when it is full, so
+             * that no batch is left with most of the work. */
+            double total_cost = 0;
+            double prefix_cost = 0;
+            double target_cost = 0;
+            size_t current_count = 0;
+            size_t largest_count = 0;
+            for (size_t index=0; index<vpairs.size(); ++index) {
+                total_cost += pair_cost(vpairs, BEG, END, index, band);
+            }
+            for (size_t index=0; index<vpairs.size(); ++index) {
+                if (current_count == results_per_batch
+                        || (current_count > 0 && prefix_cost >= target_cost)) {
+                    batches.push_back(index);
+                    largest_count = max(largest_count, current_count);
+                    current_count = 0;
+                }
+                if (0 == current_count) {
+                    size_t remaining = vpairs.size() - index;
+                    size_t batch_count = (remaining + results_per_batch - 1)
+                        / results_per_batch;
+                    target_cost = prefix_cost
+                        + (total_cost - prefix_cost) / batch_count;
+                }
+                prefix_cost += pair_cost(vpairs, BEG, END, index, band);
+                ++current_count;
+            }
+            largest_count = max(largest_count, current_count);
+            batches.push_back(vpairs.size());
+            memory_estimate = result_size*largest_count;
         }
         else {
-            memory_estimate = result_size*results_per_batch;
+            batches.push_back(vpairs.size());
+            memory_estimate = result_size*vpairs.size();
         }
         if (verbose_memory) {
             for (size_t batch=0; batch<batches.size()-1; ++batch) {
@@ -600,11 +1415,21 @@ int main(int argc, char **argv) {
     bool use_sam_format = false;
     bool use_sam_header = false;
     bool use_ssw_format = false;
-    PairSet pairs;
+    bool use_binary_format = false;
+    const char *compression = NULL;
+    int codec = COMPRESS_NONE;
+    compressed_output *compressed = NULL;
+    parasail_results_header_t results_header;
+    vector<KeyVec> runs;
     PairVec vpairs;
+    bool use_chaining = false;
+    vector<anchor_slice> anchor_slices;
+    PairVec chain_pairs;
+    parasail_banded_function_t *chain_function = NULL;
+    int chain_flag = 0;
     unsigned long count_possible = 0;
     unsigned long count_generated = 0;
-    unsigned long work = 0;
+    unsigned long long work = 0;
     int c = 0;
     const char *funcname = "sw_stats_striped_16";
     const parasail_function_info_t *function_info = NULL;
@@ -612,7 +1437,10 @@ int main(int argc, char **argv) {
     parasail_function_t *function = NULL;
     parasail_pfunction_t *pfunction = NULL;
     parasail_pcreator_t *pcreator = NULL;
-    int is_banded = 0;
+    const banded_info *banded_function_info = NULL;
+    parasail_banded_function_t *banded_function = NULL;
+    parasail_banded_encoded_function_t *banded_encoded = NULL;
+    vector<parasail_encoded_t*> encoded;
     int is_trace = 0;
     int kbandsize = 3;
     const char *matrixname = NULL;
@@ -658,7 +1486,7 @@ int main(int argc, char **argv) {
     }
 
     /* Check arguments. */
-    while ((c = getopt(argc, argv, "a:A:b:c:Cde:Ef:g:Ghi:k:l:m:M:o:O:pq:r:s:t:vVxX:")) != -1) {
+    while ((c = getopt(argc, argv, "a:A:b:c:Cde:Ef:g:Ghi:k:l:m:M:o:O:pq:r:s:St:vVxX:z:")) != -1) {
         switch (c) {
             case 'a':
                 funcname = optarg;
@@ -766,6 +1594,9 @@ int main(int argc, char **argv) {
                     print_help(progname, EXIT_FAILURE);
                 }
                 break;
+            case 'S':
+                use_chaining = true;
+                break;
             case 't':
                 num_threads = atoi(optarg);
 #ifdef _OPENMP
@@ -788,6 +1619,9 @@ int main(int argc, char **argv) {
                     print_help(progname, EXIT_FAILURE);
                 }
                 break;
+            case 'z':
+                compression = optarg;
+                break;
             case '?':
                 if (optopt == 'a'
                         || optopt == 'A'
@@ -805,6 +1639,7 @@ int main(int argc, char **argv) {
                         || optopt == 's'
                         || optopt == 't'
                         || optopt == 'X'
+                        || optopt == 'z'
                         ) {
                     eprintf(stderr,
                             "Option -%c requires an argument.\n",
@@ -837,23 +1672,35 @@ int main(int argc, char **argv) {
             }
             pfunction = pfunction_info->pointer;
             pcreator = pfunction_info->creator;
-            if (NULL == strstr(funcname, "sat")) {
+            if (NULL != strstr(funcname, "auto")) {
+                /* each pair may pick any of the widths */
+                profile_bits = 56; /* 8+16+32 */
+            }
+            else if (NULL == strstr(funcname, "sat")) {
                 profile_bits = atoi(pfunction_info->width);
             }
             else {
-                profile_bits = 56; /* 8+16+32 */
+                /* 16 and 32 bits are built only for queries that
+                 * saturate, so budget for the 8-bit profile */
+                profile_bits = 8;
             }
         }
         else {
             function_info = parasail_lookup_function_info(funcname);
-            if (NULL == function_info && NULL != strstr(funcname, "nw_banded")) {
-                is_banded = 1;
+            if (NULL == function_info) {
+                banded_function_info = lookup_banded_info(funcname);
             }
-            if (NULL == function_info && 0 == is_banded) {
+            if (NULL == function_info && NULL == banded_function_info) {
                 eprintf(stderr, "Specified function not found.\n");
                 exit(EXIT_FAILURE);
             }
-            function = function_info->pointer;
+            if (NULL != function_info) {
+                function = function_info->pointer;
+            }
+            else {
+                banded_function = banded_function_info->pointer;
+                banded_encoded = banded_function_info->encoded;
+            }
         }
     }
     else {
@@ -889,6 +1736,37 @@ int main(int argc, char **argv) {
     is_stats = (NULL != strstr(funcname, "stats"));
     is_table = (NULL != strstr(funcname, "table"));
 
+    if (use_chaining) {
+        string name;
+        if (NULL == banded_function_info || is_trace) {
+            eprintf(stderr, "Chaining requires a banded function without traceback.\n");
+            exit(EXIT_FAILURE);
+        }
+        if (!use_filter) {
+            eprintf(stderr, "Chaining requires the suffix array filter, don't use -x.\n");
+            exit(EXIT_FAILURE);
+        }
+        /* the gaps between anchors are always aligned end to end with
+         * the nw counterpart of the selected banded function */
+        name = banded_function_info->name;
+        if (0 == name.compare(0, 11, "parasail_nw")) {
+            chain_flag = PARASAIL_FLAG_NW;
+        }
+        else if (0 == name.compare(0, 11, "parasail_sg")) {
+            chain_flag = PARASAIL_FLAG_SG
+                | PARASAIL_FLAG_SG_S1_BEG | PARASAIL_FLAG_SG_S1_END
+                | PARASAIL_FLAG_SG_S2_BEG | PARASAIL_FLAG_SG_S2_END;
+        }
+        else {
+            chain_flag = PARASAIL_FLAG_SW;
+        }
+        if (banded_function_info->is_stats) {
+            chain_flag |= PARASAIL_FLAG_STATS;
+        }
+        name.replace(9, 2, "nw");
+        chain_function = lookup_banded_info(name.c_str())->pointer;
+    }
+
     if (edge_output && graph_output) {
         eprintf(stderr, "Can only request one of edge or graph output.\n");
         exit(EXIT_FAILURE);
@@ -921,6 +1799,9 @@ int main(int argc, char **argv) {
             use_ssw_format = true;
             trace_warning = true;
         }
+        else if (NULL != strstr(output_format, "BIN")) {
+            use_binary_format = true;
+        }
         else {
             eprintf(stderr, "Unknown output format '%s'.\n", output_format);
             exit(EXIT_FAILURE);
@@ -929,12 +1810,61 @@ int main(int argc, char **argv) {
             eprintf(stderr, "The selected output format '%s' requires an alignment function that returns a traceback.\n", output_format);
             exit(EXIT_FAILURE);
         }
+        if (use_binary_format && is_trace) {
+            eprintf(stderr, "The binary output format requires an alignment function that does not return a traceback.\n");
+            exit(EXIT_FAILURE);
+        }
+        if (use_binary_format && (edge_output || graph_output || pairs_only)) {
+            eprintf(stderr, "The binary output format cannot be combined with edge, graph, or pairs output.\n");
+            exit(EXIT_FAILURE);
+        }
     }
     else if (is_trace) {
         eprintf(stderr, "Please select trace output format.\n");
         exit(EXIT_FAILURE);
     }
 
+    /* compress as requested, otherwise by output file extension */
+    if (NULL != compression) {
+        if (0 == strcmp(compression, "none")) {
+            codec = COMPRESS_NONE;
+        }
+        else if (0 == strcmp(compression, "gzip")) {
+            codec = COMPRESS_GZIP;
+        }
+        else if (0 == strcmp(compression, "zstd")) {
+            codec = COMPRESS_ZSTD;
+        }
+        else {
+            eprintf(stderr, "Unknown compression '%s'.\n", compression);
+            exit(EXIT_FAILURE);
+        }
+    }
+    else if (oname_from_user) {
+        if (has_suffix(oname, ".gz") || has_suffix(oname, ".bgz")) {
+            codec = COMPRESS_GZIP;
+        }
+        else if (has_suffix(oname, ".zst")) {
+            codec = COMPRESS_ZSTD;
+        }
+    }
+#if !HAVE_ZLIB
+    if (COMPRESS_GZIP == codec) {
+        eprintf(stderr, "gzip output requires zlib, which was not found when parasail was built.\n");
+        exit(EXIT_FAILURE);
+    }
+#endif
+#ifndef HAVE_ZSTD
+    if (COMPRESS_ZSTD == codec) {
+        eprintf(stderr, "zstd output requires libzstd, which was not found when parasail was built.\n");
+        exit(EXIT_FAILURE);
+    }
+#endif
+    if (COMPRESS_NONE != codec && use_binary_format) {
+        eprintf(stderr, "The binary output format cannot be compressed.\n");
+        exit(EXIT_FAILURE);
+    }
+
     /* select the substitution matrix */
     if (NULL == matrixname && use_dna) {
         matrixname = "ACGT";
@@ -974,6 +1904,9 @@ int main(int argc, char **argv) {
     if (is_trace && !oname_from_user) {
         oname = "stdout";
     }
+    else if (use_binary_format && !oname_from_user) {
+        oname = "parasail.bin";
+    }
 
     /* print the parameters for reference */
     if (verbose) {
@@ -986,6 +1919,7 @@ int main(int argc, char **argv) {
                 "%20s: %s\n"
                 "%20s: %s\n"
                 "%20s: %s\n"
+                "%20s: %s\n"
                 "%20s: %d\n"
                 "%20s: %d\n"
                 "%20s: %s\n"
@@ -995,6 +1929,7 @@ int main(int argc, char **argv) {
                 "%20s: %s\n"
                 "%20s: %s\n"
                 "%20s: %s\n"
+                "%20s: %s\n"
                 "%20s: %lld\n"
                 "%20s: %.4f GB\n",
                 "parasail version", major, minor, patch,
@@ -1003,6 +1938,7 @@ int main(int argc, char **argv) {
                 "case sensitive", case_sensitive ? "yes" : "no",
                 "alphabet aliases", alphabet_aliases ? alphabet_aliases : "<no aliases>",
                 "use filter", use_filter ? "yes" : "no",
+                "use chaining", use_chaining ? "yes" : "no",
                 "gap_extend", gap_extend,
                 "gap_open", gap_open,
                 "matrix", matrixname,
@@ -1012,6 +1948,8 @@ int main(int argc, char **argv) {
                 "file", fname,
                 "query", (NULL == qname) ? "<no query>" : qname,
                 "output", oname,
+                "compression", COMPRESS_GZIP == codec ? "gzip"
+                    : COMPRESS_ZSTD == codec ? "zstd" : "none",
                 "batch_size", batch_size,
                 "memory_budget", memory_budget*GB
                     );
@@ -1029,7 +1967,7 @@ int main(int argc, char **argv) {
 
     /* Best to know early whether we can open the output file. */
     if (oname_from_user || !is_trace) {
-        if ((fop = fopen(oname, "w")) == NULL) {
+        if ((fop = fopen(oname, use_binary_format ? "wb" : "w")) == NULL) {
             eprintf(stderr, "%s: Cannot open output file `%s': ",
                     progname, oname);
             perror("fopen");
@@ -1040,6 +1978,28 @@ int main(int argc, char **argv) {
         fop = stdout;
     }
 
+    /* output functions write to the stream, compressed into fop */
+    if (COMPRESS_NONE != codec) {
+        compressed = new compressed_output(fop, codec);
+        fop = compressed->stream.file;
+    }
+
+    /* The record count is not known until the end.  It stays 0 if the
+     * output cannot be rewound to patch it, e.g. a pipe. */
+    if (use_binary_format) {
+        memset(&results_header, 0, sizeof(results_header));
+        memcpy(results_header.magic, PARASAIL_RESULTS_MAGIC,
+                sizeof(results_header.magic));
+        results_header.version = PARASAIL_RESULTS_VERSION;
+        results_header.header_size = sizeof(parasail_results_header_t);
+        results_header.record_size = sizeof(parasail_results_record_t);
+        results_header.columns = is_stats ?
+            PARASAIL_RESULTS_COLUMNS_STATS : PARASAIL_RESULTS_COLUMNS_BASIC;
+        results_header.byte_order = PARASAIL_RESULTS_BYTE_ORDER;
+        results_header.has_query = has_query;
+        fwrite(&results_header, sizeof(results_header), 1, fop);
+    }
+
     start = parasail_time();
     if (!has_query) {
         size_t count = 0;
@@ -1257,6 +2217,22 @@ int main(int argc, char **argv) {
         eprintf(stdout, "%20s: %ld\n", "number of db seqs", sid_crossover);
     }
 
+#ifdef _OPENMP
+    if (-1 == num_threads) {
+        num_threads = omp_get_max_threads();
+    }
+    else if (num_threads >= 1) {
+        omp_set_num_threads(num_threads);
+    }
+    else {
+        eprintf(stderr, "invalid number of threads chosen (%d)\n", num_threads);
+        exit(EXIT_FAILURE);
+    }
+    if (verbose) {
+        eprintf(stdout, "%20s: %d\n", "omp num threads", num_threads);
+    }
+#endif
+
     /* use the enhanced SA filter */
     if (use_filter) {
         size_t memsize_local = 0;
@@ -1352,13 +2328,22 @@ int main(int argc, char **argv) {
             exit(EXIT_FAILURE);
         }
 
-        /* DFS of enhanced SA, from Abouelhoda et al */
+        /* DFS of enhanced SA, from Abouelhoda et al.  The intervals are
+         * collected into blocks and their pairs are generated by the
+         * threads, each into its own sorted run of keys. */
         start = parasail_time();
         count_generated = 0;
         LCP[n] = 0; /* doesn't really exist, but for the root */
+#ifdef _OPENMP
+        runs.resize(num_threads);
+#else
+        runs.resize(1);
+#endif
+        vector<AnchorVec> thread_anchors(use_chaining ? runs.size() : 0);
         {
             stack<quad> the_stack;
             quad last_interval;
+            vector<quad> block;
             the_stack.push(quad());
             for (i = bup_start; i <= bup_stop; ++i) {
                 int lb = i - 1;
@@ -1366,7 +2351,12 @@ int main(int argc, char **argv) {
                     the_stack.top().rb = i - 1;
                     last_interval = the_stack.top();
                     the_stack.pop();
-                    process(count_generated, pairs, last_interval, SA, BWT, SID, DB, sentinal, cutoff);
+                    if (last_interval.lcp >= cutoff) {
+                        block.push_back(last_interval);
+                        if (block.size() >= INTERVAL_BLOCK) {
+                            process_block(count_generated, runs, use_chaining ? &thread_anchors : NULL, block, SA, BWT, SID, DB, sentinal, cutoff);
+                        }
+                    }
                     lb = last_interval.lb;
                     if (LCP[i] <= the_stack.top().lcp) {
                         last_interval.children.clear();
@@ -1386,7 +2376,13 @@ int main(int argc, char **argv) {
                 }
             }
             the_stack.top().rb = bup_stop - 1;
-            process(count_generated, pairs, the_stack.top(), SA, BWT, SID, DB, sentinal, cutoff);
+            if (the_stack.top().lcp >= cutoff) {
+                block.push_back(the_stack.top());
+            }
+            process_block(count_generated, runs, use_chaining ? &thread_anchors : NULL, block, SA, BWT, SID, DB, sentinal, cutoff);
+        }
+        for (size_t r=0; r<runs.size(); ++r) {
+            bytes_used += runs[r].size()*sizeof(PairKey);
         }
         finish = parasail_time();
         if (!has_query) {
@@ -1408,346 +2404,484 @@ int main(int argc, char **argv) {
         bytes_used -= (size_t)n * sizeof(int); /* SID */
         bytes_used -= memsize_local; /* SA,LCP,BWT */
 
-        if (verbose) {
-            eprintf(stdout, "%20s: %zu\n", "unique pairs", pairs.size());
-        }
-    }
-    else {
-        /* don't use enhanced SA filter -- generate all pairs */
-        start = parasail_time();
-        if (!has_query) {
-            /* no query file, so all against all comparison */
-            for (int i=0; i<sid; ++i) {
-                for (int j=i+1; j<sid; ++j) {
-                    vpairs.push_back(make_pair(i,j));
+        /* Group the anchors by pair, in the same order as the keys, and
+         * by the slice of the pair stream that aligns them. */
+        if (use_chaining) {
+            AnchorVec anchors;
+            size_t count_anchors = 0;
+            size_t count_pairs = 0;
+            start = parasail_time();
+            for (size_t r=0; r<thread_anchors.size(); ++r) {
+                count_anchors += thread_anchors[r].size();
+            }
+            anchors.reserve(count_anchors);
+            for (size_t r=0; r<thread_anchors.size(); ++r) {
+                anchors.insert(anchors.end(),
+                        thread_anchors[r].begin(), thread_anchors[r].end());
+                AnchorVec().swap(thread_anchors[r]);
+            }
+            sort(anchors.begin(), anchors.end());
+            for (size_t index=0; index<anchors.size(); ++index) {
+                if (0 == index
+                        || anchors[index].first != anchors[index-1].first
+                        || anchors[index].second != anchors[index-1].second) {
+                    ++count_pairs;
                 }
             }
-        }
-        else {
-            /* query given, so only compare query against database */
-            for (int i=sid_crossover; i<sid; ++i) {
-                for (int j=0; j<sid_crossover; ++j) {
-                    vpairs.push_back(make_pair(i,j));
+            anchor_slices.resize((count_pairs + PAIR_SLICE - 1) / PAIR_SLICE);
+            chain_pairs.reserve(count_pairs);
+            for (size_t index=0; index<anchors.size(); ++index) {
+                anchor a = anchors[index];
+                if (0 == index
+                        || a.first != anchors[index-1].first
+                        || a.second != anchors[index-1].second) {
+                    anchor_slice &slice = anchor_slices[chain_pairs.size() / PAIR_SLICE];
+                    slice.offsets.push_back(slice.anchors.size());
+                    chain_pairs.push_back(make_pair(a.first, a.second));
                 }
+                /* sequence offsets, after sorting so the order is unchanged */
+                a.pos_first -= BEG[a.first];
+                a.pos_second -= BEG[a.second];
+                anchor_slices.back().anchors.push_back(a);
+            }
+            AnchorVec().swap(anchors);
+            /* the anchors hold the same pairs as the keys */
+            for (size_t r=0; r<runs.size(); ++r) {
+                bytes_used -= runs[r].size()*sizeof(PairKey);
+            }
+            vector<KeyVec>().swap(runs);
+            for (size_t index=0; index<anchor_slices.size(); ++index) {
+                anchor_slice &slice = anchor_slices[index];
+                slice.offsets.push_back(slice.anchors.size());
+                bytes_used += slice.anchors.size()*sizeof(anchor);
+                bytes_used += slice.offsets.size()*sizeof(long);
+            }
+            bytes_used += chain_pairs.size()*sizeof(Pair);
+            finish = parasail_time();
+            if (verbose) {
+                eprintf(stdout, "%20s: %.4f seconds\n", "anchor sort time", finish-start);
+                eprintf(stdout, "%20s: %zu\n", "anchors", count_anchors);
             }
-        }
-        finish = parasail_time();
-        if (verbose) {
-            eprintf(stdout, "%20s: %.4f seconds\n", "enumerate time", finish-start);
-            eprintf(stdout, "%20s: %zu\n", "unique pairs", vpairs.size());
         }
     }
+    /* Without the enhanced SA filter all pairs are generated as they are
+     * taken from the stream.  With no query file that is all against
+     * all, otherwise the queries only against the database. */
+    pair_stream stream = use_chaining ? pair_stream(chain_pairs)
+        : use_filter ? pair_stream(runs)
+        : pair_stream(sid, has_query ? sid_crossover : -1);
 
     if (!is_trace && pairs_only) {
+        unsigned long count_unique = 0;
         /* Done with input text. */
         free(T);
-        if (vpairs.empty() && !pairs.empty()) {
-            for (PairSet::iterator it=pairs.begin(); it!=pairs.end(); ++it) {
-                int i = it->first;
-                int j = it->second;
-                eprintf(fop, "%d,%d\n", i, j);
-            }
-        }
-        else if (!vpairs.empty() && pairs.empty()) {
+        while (stream.next(vpairs, PAIR_SLICE)) {
             for (PairVec::iterator it=vpairs.begin(); it!=vpairs.end(); ++it) {
                 int i = it->first;
                 int j = it->second;
                 eprintf(fop, "%d,%d\n", i, j);
             }
+            count_unique += vpairs.size();
         }
-        else {
-            eprintf(stderr, "pairs and vpairs were empty\n");
+        if (0 == count_unique) {
+            eprintf(stderr, "no pairs were generated\n");
             exit(EXIT_FAILURE);
         }
+        if (verbose) {
+            eprintf(stdout, "%20s: %lu\n", "unique pairs", count_unique);
+        }
+        if (NULL != compressed) {
+            fop = compressed->finish();
+            delete compressed;
+        }
         fclose(fop);
         return 0;
     }
 
-#ifdef _OPENMP
-    if (-1 == num_threads) {
-        num_threads = omp_get_max_threads();
-    }
-    else if (num_threads >= 1) {
-        omp_set_num_threads(num_threads);
-    }
-    else {
-        eprintf(stderr, "invalid number of threads chosen (%d)\n", num_threads);
-        exit(EXIT_FAILURE);
-    }
-    if (verbose) {
-        eprintf(stdout, "%20s: %d\n", "omp num threads", num_threads);
-    }
-#endif
-
-    /* OpenMP can't iterate over an STL set. Convert to STL vector. */
-    start = parasail_time();
-    if (vpairs.empty()) {
-        if (pairs.empty()) {
-            if (use_filter) {
-                eprintf(stderr, "no alignment work, either the filter removed all alignemnts or the input file(s) were empty\n");
-                exit(EXIT_FAILURE);
-            }
-            else {
-                eprintf(stderr, "no alignment work, perhaps the input file(s) were empty\n");
-                exit(EXIT_FAILURE);
-            }
-        }
-        vpairs.assign(pairs.begin(), pairs.end());
-        /* set::clear() might not deallocate memory.
-         * Use swap with temporary instead */
-        PairSet().swap(pairs);
-        /* don't increment bytes_used since memory use should remain same */
-    }
-    if (!pairs.empty()) {
-        eprintf(stderr, "failed to free pair memory, continuing\n");
-    }
-    /* finally tally the pair memory */
-    bytes_used += vpairs.size()*sizeof(Pair);
-    /* pre-allocate result pointers */
-    vector<parasail_result_t*> results(vpairs.size(),
-            static_cast<parasail_result_t*>(NULL));
-    bytes_used += vpairs.size()*sizeof(parasail_result_t*);
-    finish = parasail_time();
-    if (verbose) {
-        eprintf(stdout, "%20s: %.4f seconds\n", "openmp prep time", finish-start);
-    }
-    if (verbose_memory) {
-        eprintf(stdout, "%20s: %.4f GB\n", "openmp prep memory", bytes_used*GB);
-    }
-
-    /* create profiles, if necessary */
+    /* Profiles are created for the pairs of each slice.  The pairs are
+     * sorted by their first sequence, so only the profile of the last
+     * one can be needed again by the next slice. */
     vector<parasail_profile_t*> profiles;
     if (pfunction) {
-        start = parasail_time();
-        set<int> profile_indices_set;
-        for (size_t index=0; index<vpairs.size(); ++index) {
-            profile_indices_set.insert(vpairs[index].first);
-        }
-        vector<int> profile_indices(
-                profile_indices_set.begin(),
-                profile_indices_set.end());
         profiles.assign(sid, static_cast<parasail_profile_t*>(NULL));
         bytes_used += sizeof(parasail_profile_t*) * sid;
-        finish = parasail_time();
-        if (verbose) {
-            eprintf(stdout, "%20s: %.4f seconds\n", "profile init", finish-start);
-        }
+    }
+    /* Map every sequence once for the banded functions rather than once
+     * per pair it is part of.  The chained pieces are subsequences, so
+     * they still map their own residues. */
+    if (banded_encoded && !use_chaining && matrix->size <= 256) {
         start = parasail_time();
+        encoded.assign(sid, static_cast<parasail_encoded_t*>(NULL));
 #pragma omp parallel for schedule(guided)
-        for (long long index=0; index<(long long)profile_indices.size(); ++index)
+        for (long long index=0; index<(long long)sid; ++index)
         {
-            int i = profile_indices[index];
-            long i_beg = BEG[i];
-            long i_end = END[i];
-            long i_len = i_end-i_beg;
-            size_t local_mem = matrix->size * i_len * profile_bits;
-            profiles[i] = pcreator((const char*)&T[i_beg], i_len, matrix);
-#pragma omp atomic
-            bytes_used += local_mem;
+            encoded[index] = parasail_encode((const char*)&T[BEG[index]],
+                    END[index]-BEG[index], matrix);
         }
+        bytes_used += sid*(sizeof(parasail_encoded_t)+sizeof(parasail_encoded_t*));
+        bytes_used += n;
         finish = parasail_time();
         if (verbose) {
-            eprintf(stdout, "%20s: %.4f seconds\n", "profile creation", finish-start);
+            eprintf(stdout, "%20s: %.4f seconds\n", "encode time", finish-start);
         }
-        if (verbose_memory) {
-            eprintf(stdout, "%20s: %.4f GB\n", "profile creation memory", bytes_used*GB);
+    }
+
+    vector<parasail_result_t*> results;
+    vector<vector<pair<int,float> > > graph;
+    unsigned long edge_count = 0;
+    unsigned long count_unique = 0;
+    double profile_time = 0;
+    /* The pairs of a batch are aligned longest first.  Each thread's
+     * time in the alignment functions is kept against the time spent in
+     * the parallel loops, the rest being the wait at the batch ends. */
+    vector<long long> order;
+    vector<double> thread_busy;
+    double align_time = 0;
+#ifdef _OPENMP
+    thread_busy.assign(omp_get_max_threads(), 0);
+#else
+    thread_busy.assign(1, 0);
+#endif
+    /* The batches are pipelined.  While the threads align one batch,
+     * one of them writes and frees the batch before it, and that time
+     * counts as busy as well.  The pairs and results of a slice are
+     * double buffered so that the last batch of a slice is written
+     * while the next slice aligns. */
+    PairVec prev_pairs;
+    vector<parasail_result_t*> prev_results;
+    const PairVec *pending_pairs = &vpairs;
+    const vector<parasail_result_t*> *pending_results = &results;
+    long long pending_start = 0;
+    long long pending_stop = 0;
+    /* The trace formats are the slow part of writing.  Their records are
+     * formatted by the thread that aligned the pair, into a stream of
+     * its own, and kept with the results until the batch is written. */
+    bool format_records = is_trace
+        && (use_emboss_format || use_ssw_format || use_sam_format);
+    vector<record_stream*> record_streams;
+    vector<string> records;
+    vector<string> prev_records;
+    vector<string> *pending_records = &records;
+    /* Formatted records count against the memory budget until they are
+     * written.  So do the results of the last batch of a slice, which
+     * the next slice writes while its own estimate is counted. */
+    size_t pending_record_bytes = 0;
+    size_t pending_result_bytes = 0;
+    if (format_records) {
+        for (size_t t=0; t<thread_busy.size(); ++t) {
+            record_streams.push_back(new record_stream);
         }
     }
+    if (graph_output) {
+        graph.resize(sid);
+    }
+    /* the call that aligns one pair, for the kind of function chosen */
+    pair_aligner *aligner = NULL;
+    if (function) {
+        aligner = new function_aligner(T, BEG, END, gap_open, gap_extend,
+                matrix, function);
+    }
+    else if (banded_function) {
+        aligner = new banded_aligner(T, BEG, END, gap_open, gap_extend,
+                matrix, kbandsize, banded_function, banded_encoded, encoded,
+                use_chaining ? &anchor_slices : NULL, stream,
+                chain_function, chain_flag);
+    }
+    else if (pfunction) {
+        aligner = new profile_aligner(T, BEG, END, gap_open, gap_extend,
+                matrix, pfunction, profiles);
+    }
+    else {
+        /* shouldn't get here */
+        eprintf(stderr, "alignment function was not properly set (shouldn't happen)\n");
+        exit(EXIT_FAILURE);
+    }
 
-    if (bytes_used > memory_budget) {
-        eprintf(stderr, "memory budget exceeded prior to alignment phase\n");
-        return 0;
+    /* The SAM header is written once, ahead of the records of every
+     * slice. */
+    if (is_trace && use_sam_format && use_sam_header && has_query) {
+        output_sam_header(fop, sequences);
     }
 
-    /* align pairs */
+    /* align pairs, one slice of the stream at a time */
     start = parasail_time();
-    if (function) {
-        size_t memory_estimate;
+    while (stream.next(vpairs, PAIR_SLICE)) {
+        size_t bytes_slice = bytes_used - pending_record_bytes
+            - pending_result_bytes;
         long long vpairs_size = (long long)vpairs.size();
-        vector<long long> batches = calc_batches(
-                batch_size,
-                verbose && verbose_memory,
-                memory_budget-bytes_used, function_info,
-                vpairs, BEG, END,
-                memory_estimate);
-        bytes_used += memory_estimate;
-        vector<vector<pair<int,float> > > graph;
-        unsigned long edge_count = 0;
-        if (graph_output) {
-            graph.resize(sid);
-        }
-        for (size_t batch=0; batch<batches.size()-1; ++batch) {
-            long long start = batches[batch];
-            long long stop = batches[batch+1];
-            if (stop > vpairs_size) stop = vpairs_size;
+        count_unique += vpairs.size();
+        bytes_used += vpairs.size()*sizeof(Pair);
+        /* pre-allocate result pointers */
+        results.assign(vpairs.size(), static_cast<parasail_result_t*>(NULL));
+        bytes_used += vpairs.size()*sizeof(parasail_result_t*);
+        if (format_records) {
+            records.assign(vpairs.size(), string());
+            bytes_used += vpairs.size()*sizeof(string);
+        }
+
+        /* create profiles, if necessary */
+        if (pfunction) {
+            double profile_start = parasail_time();
+            vector<int> profile_indices;
+            for (size_t index=0; index<vpairs.size(); ++index) {
+                int i = vpairs[index].first;
+                if (NULL == profiles[i] && (profile_indices.empty()
+                            || profile_indices.back() != i)) {
+                    profile_indices.push_back(i);
+                }
+            }
 #pragma omp parallel for schedule(guided)
-            for (long long index=start; index<stop; ++index)
+            for (long long index=0; index<(long long)profile_indices.size(); ++index)
             {
-                int i = vpairs[index].first;
-                int j = vpairs[index].second;
+                int i = profile_indices[index];
                 long i_beg = BEG[i];
                 long i_end = END[i];
                 long i_len = i_end-i_beg;
-                long j_beg = BEG[j];
-                long j_end = END[j];
-                long j_len = j_end-j_beg;
-                unsigned long local_work = i_len * j_len;
-                parasail_result_t *result = function(
-                        (const char*)&T[i_beg], i_len,
-                        (const char*)&T[j_beg], j_len,
-                        gap_open, gap_extend, matrix);
+                size_t local_mem = matrix->size * i_len * profile_bits;
+                profiles[i] = pcreator((const char*)&T[i_beg], i_len, matrix);
 #pragma omp atomic
-                work += local_work;
-                results[index] = result;
-            }
-            if (graph_output) {
-                output_graph(NULL, 0, T, AOL, SIM, OS, matrix, BEG,
-                        END, vpairs, results, graph, edge_count, start,
-                        stop);
+                bytes_used += local_mem;
             }
-            else {
-                output(is_stats, is_table, is_trace, edge_output,
-                        use_emboss_format, use_ssw_format,
-                        use_sam_format, use_sam_header, fop, has_query,
-                        sid_crossover, T, AOL, SIM, OS, matrix,
-                        BEG, END, vpairs, queries, sequences, results,
-                        start, stop, case_sensitive, alphabet_aliases);
+            profile_time += parasail_time() - profile_start;
+        }
+
+        if (bytes_used > memory_budget) {
+            eprintf(stderr, "memory budget exceeded prior to alignment phase\n");
+            if (pending_stop > pending_start) {
+                output_batch(graph_output, graph, edge_count,
+                        *pending_records, compressed, is_stats, is_table,
+                        is_trace, edge_output, use_emboss_format, use_ssw_format,
+                        use_sam_format, use_binary_format,
+                        fop, has_query, sid_crossover, T, AOL, SIM, OS, matrix,
+                        BEG, END, *pending_pairs, queries, sequences,
+                        *pending_results, pending_start, pending_stop,
+                        case_sensitive, alphabet_aliases);
             }
-            for (long long index=start; index<stop; ++index) {
-                parasail_result_t *result = results[index];
-                parasail_result_free(result);
+            if (NULL != compressed) {
+                compressed->finish();
+                delete compressed;
             }
+            delete aligner;
+            return 0;
         }
-        if (graph_output) {
-            output_graph(fop, 0, T, AOL, SIM, OS, matrix, BEG,
-                    END, vpairs, results, graph, edge_count, 0,
-                    vpairs_size);
+
+        size_t memory_estimate = 0;
+        vector<long long> batches;
+        if (function) {
+            batches = calc_batches(
+                    batch_size,
+                    verbose && verbose_memory,
+                    (memory_budget-bytes_used)/2, function_info,
+                    vpairs, BEG, END,
+                    memory_estimate);
+        }
+        else if (banded_function) {
+            batches = calc_batches(
+                    batch_size,
+                    verbose && verbose_memory,
+                    (memory_budget-bytes_used)/2, banded_function_info,
+                    vpairs, BEG, END,
+                    memory_estimate, kbandsize);
         }
-    }
-    else if (is_banded) {
-        size_t memory_estimate;
-        long long vpairs_size = (long long)vpairs.size();
-        vector<long long> batches = calc_batches(
-                batch_size,
-                verbose && verbose_memory,
-                memory_budget-bytes_used, function_info,
-                vpairs, BEG, END,
-                memory_estimate);
-        bytes_used += memory_estimate;
-        for (size_t batch=0; batch<batches.size()-1; ++batch) {
-            long long start = batches[batch];
-            long long stop = batches[batch+1];
-            if (stop > vpairs_size) stop = vpairs_size;
-#pragma omp parallel for schedule(guided)
-            for (long long index=start; index<stop; ++index)
-            {
-                int i = vpairs[index].first;
-                int j = vpairs[index].second;
-                long i_beg = BEG[i];
-                long i_end = END[i];
-                long i_len = i_end-i_beg;
-                long j_beg = BEG[j];
-                long j_end = END[j];
-                long j_len = j_end-j_beg;
-                unsigned long local_work = i_len * j_len;
-                parasail_result_t *result = parasail_nw_banded(
-                        (const char*)&T[i_beg], i_len,
-                        (const char*)&T[j_beg], j_len,
-                        gap_open, gap_extend, kbandsize, matrix);
-#pragma omp atomic
-                work += local_work;
-                results[index] = result;
-            }
-            output(is_stats, is_table, is_trace, edge_output,
-                    use_emboss_format, use_ssw_format, use_sam_format,
-                    use_sam_header, fop, has_query, sid_crossover, T, AOL,
-                    SIM, OS, matrix, BEG, END, vpairs, queries, sequences,
-                    results, start, stop, case_sensitive, alphabet_aliases);
-            for (long long index=start; index<stop; ++index) {
-                parasail_result_t *result = results[index];
-                parasail_result_free(result);
-            }
+        else {
+            batches = calc_batches(
+                    batch_size,
+                    verbose && verbose_memory,
+                    (memory_budget-bytes_used)/2, pfunction_info,
+                    vpairs, BEG, END,
+                    memory_estimate);
         }
-    }
-    else if (pfunction) {
-        size_t memory_estimate;
-        long long vpairs_size = (long long)vpairs.size();
-        vector<long long> batches = calc_batches(
-                batch_size,
-                verbose && verbose_memory,
-                memory_budget-bytes_used, pfunction_info,
-                vpairs, BEG, END,
-                memory_estimate);
         bytes_used += memory_estimate;
-        vector<vector<pair<int,float> > > graph;
-        unsigned long edge_count = 0;
-        if (graph_output) {
-            graph.resize(sid);
-        }
         for (size_t batch=0; batch<batches.size()-1; ++batch) {
             long long start = batches[batch];
             long long stop = batches[batch+1];
             if (stop > vpairs_size) stop = vpairs_size;
-#pragma omp parallel for schedule(guided)
-            for (long long index=start; index<stop; ++index)
+            order_by_cost(order, start, stop, vpairs, BEG, END, aligner->band);
+            double batch_start = parasail_time();
+            size_t record_bytes = 0;
+#pragma omp parallel
             {
-                int i = vpairs[index].first;
-                int j = vpairs[index].second;
-                long j_beg = BEG[j];
-                long j_end = END[j];
-                long j_len = j_end-j_beg;
-                parasail_profile_t *profile = profiles[i];
-                if (NULL == profile) {
-                    eprintf(stderr, "BAD PROFILE %d\n", i);
-                    exit(EXIT_FAILURE);
+                double busy = 0;
+#pragma omp single nowait
+                if (pending_stop > pending_start) {
+                    double write_start = parasail_time();
+                    output_batch(graph_output, graph, edge_count,
+                            *pending_records, compressed, is_stats,
+                            is_table, is_trace, edge_output,
+                            use_emboss_format, use_ssw_format,
+                            use_sam_format,
+                            use_binary_format, fop, has_query,
+                            sid_crossover, T, AOL, SIM, OS,
+                            matrix, BEG, END, *pending_pairs, queries,
+                            sequences, *pending_results, pending_start,
+                            pending_stop, case_sensitive,
+                            alphabet_aliases);
+                    bytes_used -= pending_record_bytes + pending_result_bytes;
+                    pending_record_bytes = 0;
+                    pending_result_bytes = 0;
+                    busy += parasail_time() - write_start;
                 }
-                unsigned long local_work = profile->s1Len * j_len;
-                parasail_result_t *result = pfunction(
-                        profile, (const char*)&T[j_beg], j_len,
-                        gap_open, gap_extend);
+#pragma omp for schedule(dynamic,1)
+                for (long long k=0; k<(long long)order.size(); ++k)
+                {
+                    long long index = order[k];
+                    double busy_start = parasail_time();
+                    unsigned long long local_work = 0;
+                    parasail_result_t *result = aligner->align(index,
+                            vpairs[index].first, vpairs[index].second,
+                            local_work);
 #pragma omp atomic
-                work += local_work;
-                results[index] = result;
-            }
-            if (graph_output) {
-                output_graph(NULL, 0, T, AOL, SIM, OS, matrix, BEG,
-                        END, vpairs, results, graph, edge_count, start,
-                        stop);
+                    work += local_work;
+                    results[index] = result;
+                    if (format_records) {
+                        record_stream *stream = record_streams[thread_num()];
+                        output(is_stats, is_table, is_trace, edge_output,
+                                use_emboss_format, use_ssw_format,
+                                use_sam_format,
+                                use_binary_format, stream->file,
+                                has_query, sid_crossover,
+                                T, AOL, SIM, OS, matrix, BEG, END,
+                                vpairs, queries, sequences, results,
+                                index, index+1, case_sensitive,
+                                alphabet_aliases);
+                        stream->take(records[index]);
+#pragma omp atomic
+                        record_bytes += records[index].size();
+                    }
+                    busy += parasail_time() - busy_start;
+                }
+                thread_busy[thread_num()] += busy;
             }
-            else {
-                output(is_stats, is_table, is_trace, edge_output,
-                        use_emboss_format, use_ssw_format,
-                        use_sam_format, use_sam_header, fop, has_query,
-                        sid_crossover, T, AOL, SIM, OS, matrix,
-                        BEG, END, vpairs, queries, sequences, results,
+            align_time += parasail_time() - batch_start;
+            pending_pairs = &vpairs;
+            pending_results = &results;
+            pending_records = &records;
+            pending_start = start;
+            pending_stop = stop;
+            pending_record_bytes = record_bytes;
+            bytes_used += record_bytes;
+            /* records that do not fit are written now rather than
+             * while the next batch aligns */
+            if (format_records && bytes_used > memory_budget) {
+                output_batch(graph_output, graph, edge_count,
+                        records, compressed, is_stats, is_table,
+                        is_trace, edge_output, use_emboss_format,
+                        use_ssw_format, use_sam_format,
+                        use_binary_format, fop, has_query,
+                        sid_crossover, T, AOL, SIM, OS, matrix, BEG,
+                        END, vpairs, queries, sequences, results,
                         start, stop, case_sensitive, alphabet_aliases);
+                bytes_used -= pending_record_bytes + pending_result_bytes;
+                pending_record_bytes = 0;
+                pending_result_bytes = 0;
+                pending_start = pending_stop;
             }
-            for (long long index=start; index<stop; ++index) {
-                parasail_result_t *result = results[index];
-                parasail_result_free(result);
+        }
+
+        /* keep only the profile the next slice might continue with */
+        if (pfunction) {
+            int keep = vpairs.back().first;
+            for (size_t index=0; index<vpairs.size(); ++index) {
+                int i = vpairs[index].first;
+                if (i != keep && NULL != profiles[i]) {
+                    parasail_profile_free(profiles[i]);
+                    profiles[i] = NULL;
+                }
             }
         }
-        if (graph_output) {
-            output_graph(fop, 0, T, AOL, SIM, OS, matrix, BEG,
-                    END, vpairs, results, graph, edge_count, 0,
-                    vpairs_size);
+        /* the next slice is taken into the other buffers */
+        vpairs.swap(prev_pairs);
+        results.swap(prev_results);
+        records.swap(prev_records);
+        pending_pairs = &prev_pairs;
+        pending_results = &prev_results;
+        pending_records = &prev_records;
+        /* the results of the last batch stay until the writer frees them */
+        if (pending_stop > pending_start) {
+            pending_result_bytes = memory_estimate;
+        }
+        bytes_used = bytes_slice + pending_record_bytes + pending_result_bytes;
+        /* the results of the slice no longer need its anchors */
+        if (use_chaining) {
+            anchor_slice &slice = anchor_slices[stream.offset / PAIR_SLICE];
+            bytes_used -= slice.anchors.size()*sizeof(anchor);
+            bytes_used -= slice.offsets.size()*sizeof(long);
+            AnchorVec().swap(slice.anchors);
+            vector<long>().swap(slice.offsets);
         }
     }
-    else {
-        /* shouldn't get here */
-        eprintf(stderr, "alignment function was not properly set (shouldn't happen)\n");
-        exit(EXIT_FAILURE);
+    if (pending_stop > pending_start) {
+        output_batch(graph_output, graph, edge_count, *pending_records,
+                compressed, is_stats, is_table, is_trace, edge_output,
+                use_emboss_format, use_ssw_format, use_sam_format,
+                use_binary_format, fop, has_query,
+                sid_crossover, T, AOL, SIM, OS, matrix, BEG, END,
+                *pending_pairs, queries, sequences, *pending_results,
+                pending_start, pending_stop, case_sensitive,
+                alphabet_aliases);
+        bytes_used -= pending_record_bytes + pending_result_bytes;
+        pending_record_bytes = 0;
+        pending_result_bytes = 0;
+    }
+    for (size_t t=0; t<record_streams.size(); ++t) {
+        delete record_streams[t];
+    }
+    delete aligner;
+    if (0 == count_unique) {
+        if (use_filter) {
+            eprintf(stderr, "no alignment work, either the filter removed all alignemnts or the input file(s) were empty\n");
+            exit(EXIT_FAILURE);
+        }
+        else {
+            eprintf(stderr, "no alignment work, perhaps the input file(s) were empty\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (graph_output) {
+        output_graph(fop, 0, T, AOL, SIM, OS, matrix, BEG,
+                END, vpairs, results, graph, edge_count, 0, 0);
     }
     finish = parasail_time();
     if (verbose) {
-        eprintf(stdout, "%20s: %lu cells\n", "work", work);
+        eprintf(stdout, "%20s: %lu\n", "unique pairs", count_unique);
+        if (pfunction) {
+            eprintf(stdout, "%20s: %.4f seconds\n", "profile creation", profile_time);
+        }
+        eprintf(stdout, "%20s: %llu cells\n", "work", work);
         eprintf(stdout, "%20s: %.4f seconds\n", "alignment time", finish-start);
         eprintf(stdout, "%20s: %.4f \n", "gcups", double(work)/(finish-start)/1000000000);
+        if (align_time > 0) {
+            double idle = 0;
+            for (size_t t=0; t<thread_busy.size(); ++t) {
+                char label[64];
+                sprintf(label, "thread %lu busy", (unsigned long)t);
+                eprintf(stdout, "%20s: %.4f seconds, %.1f%% idle\n", label,
+                        thread_busy[t],
+                        100*(1 - thread_busy[t]/align_time));
+                idle += align_time - thread_busy[t];
+            }
+            eprintf(stdout, "%20s: %.1f%%\n", "thread idle",
+                    100*idle/(align_time*thread_busy.size()));
+        }
+        if (NULL != strstr(funcname, "_sat")) {
+            parasail_sat_stats_t sat_stats;
+            parasail_sat_stats_get(&sat_stats);
+            eprintf(stdout, "%20s: %llu\n", "8-bit runs", sat_stats.bits8);
+            eprintf(stdout, "%20s: %llu\n", "16-bit runs", sat_stats.bits16);
+            eprintf(stdout, "%20s: %llu\n", "32-bit runs", sat_stats.bits32);
+        }
     }
     if (verbose_memory) {
         eprintf(stdout, "%20s: %.4f GB\n", "post-result memory", bytes_used*GB);
     }
 
+    if (!encoded.empty()) {
+        for (size_t index=0; index<encoded.size(); ++index) {
+            parasail_encoded_free(encoded[index]);
+        }
+        encoded.clear();
+    }
+
     if (pfunction) {
         start = parasail_time();
 #pragma omp parallel for schedule(guided)
@@ -1765,6 +2899,20 @@ int main(int argc, char **argv) {
     }
 
     /* close output file */
+    if (NULL != compressed) {
+        fop = compressed->finish();
+        delete compressed;
+    }
+    if (use_binary_format) {
+        parasail_results_off_t offset = parasail_results_ftell(fop);
+        if (offset >= (parasail_results_off_t)sizeof(results_header)
+                && 0 == parasail_results_fseek(fop,
+                    offsetof(parasail_results_header_t, count), SEEK_SET)) {
+            results_header.count = (offset - sizeof(results_header))
+                / sizeof(parasail_results_record_t);
+            fwrite(&results_header.count, sizeof(results_header.count), 1, fop);
+        }
+    }
     if (oname_from_user || !is_trace) {
         fclose(fop);
     }
@@ -1792,9 +2940,11 @@ int main(int argc, char **argv) {
 
 inline static void pair_check(
         unsigned long &count_generated,
-        PairSet &pairs,
+        KeyVec &keys,
+        AnchorVec *anchors,
         const int &i,
         const int &j,
+        const int &lcp,
         const int * const restrict SA,
         const unsigned char * const restrict BWT,
         const int * const restrict SID,
@@ -1808,10 +2958,16 @@ inline static void pair_check(
             if (sidi != sidj) {
                 ++count_generated;
                 if (sidi < sidj) {
-                    pairs.insert(make_pair(sidi,sidj));
+                    keys.push_back(((PairKey)sidi << 32) | (PairKey)sidj);
+                    if (anchors) {
+                        anchors->push_back(anchor(sidi, sidj, SA[i], SA[j], lcp));
+                    }
                 }
                 else {
-                    pairs.insert(make_pair(sidj,sidi));
+                    keys.push_back(((PairKey)sidj << 32) | (PairKey)sidi);
+                    if (anchors) {
+                        anchors->push_back(anchor(sidj, sidi, SA[j], SA[i], lcp));
+                    }
                 }
             }
         }
@@ -1819,10 +2975,16 @@ inline static void pair_check(
             if (sidi != sidj && DB[sidi] != DB[sidj]) {
                 ++count_generated;
                 if (sidi > sidj) {
-                    pairs.insert(make_pair(sidi,sidj));
+                    keys.push_back(((PairKey)sidi << 32) | (PairKey)sidj);
+                    if (anchors) {
+                        anchors->push_back(anchor(sidi, sidj, SA[i], SA[j], lcp));
+                    }
                 }
                 else {
-                    pairs.insert(make_pair(sidj,sidi));
+                    keys.push_back(((PairKey)sidj << 32) | (PairKey)sidi);
+                    if (anchors) {
+                        anchors->push_back(anchor(sidj, sidi, SA[j], SA[i], lcp));
+                    }
                 }
             }
         }
@@ -1841,7 +3003,8 @@ inline static void pair_check(
  */
 inline static void process(
         unsigned long &count_generated,
-        PairSet &pairs,
+        KeyVec &keys,
+        AnchorVec *anchors,
         const quad &q,
         const int * const restrict SA,
         const unsigned char * const restrict BWT,
@@ -1867,17 +3030,284 @@ inline static void process(
                 }
             }
             for (/*nope*/; j<=q.rb; ++j) {
-                pair_check(count_generated, pairs, i, j, SA, BWT, SID, DB, sentinal);
+                pair_check(count_generated, keys, anchors, i, j, q.lcp, SA, BWT, SID, DB, sentinal);
             }
         }
     }
     else {
         for (int i=q.lb; i<=q.rb; ++i) {
             for (int j=i+1; j<=q.rb; ++j) {
-                pair_check(count_generated, pairs, i, j, SA, BWT, SID, DB, sentinal);
+                pair_check(count_generated, keys, anchors, i, j, q.lcp, SA, BWT, SID, DB, sentinal);
+            }
+        }
+    }
+}
+
+/* sorts the keys appended after the sorted ones into the run and drops
+ * the duplicates */
+inline static void compact_keys(KeyVec &keys, size_t &sorted)
+{
+    sort(keys.begin()+sorted, keys.end());
+    inplace_merge(keys.begin(), keys.begin()+sorted, keys.end());
+    keys.erase(unique(keys.begin(), keys.end()), keys.end());
+    sorted = keys.size();
+}
+
+/* Generates the pairs of a block of intervals in parallel.  Each thread
+ * appends to its own run of keys and anchors, and the run is compacted
+ * whenever it grows too far past its unique pairs, so that it stays
+ * bounded by the distinct pairs rather than by the generated ones. */
+static void process_block(
+        unsigned long &count_generated,
+        vector<KeyVec> &runs,
+        vector<AnchorVec> *anchors,
+        vector<quad> &block,
+        const int * const restrict SA,
+        const unsigned char * const restrict BWT,
+        const int * const restrict SID,
+        const vector<int> &DB,
+        const char &sentinal,
+        const int &cutoff)
+{
+    unsigned long generated = 0;
+    const long long block_size = (long long)block.size();
+
+#pragma omp parallel num_threads(runs.size()) reduction(+:generated)
+    {
+#ifdef _OPENMP
+        const int tid = omp_get_thread_num();
+#else
+        const int tid = 0;
+#endif
+        KeyVec &keys = runs[tid];
+        AnchorVec *local = anchors ? &(*anchors)[tid] : NULL;
+        size_t sorted = keys.size();
+#pragma omp for schedule(dynamic)
+        for (long long index=0; index<block_size; ++index)
+        {
+            process(generated, keys, local, block[index], SA, BWT, SID, DB, sentinal, cutoff);
+            if (keys.size() - sorted > sorted + KEY_SLACK) {
+                compact_keys(keys, sorted);
             }
         }
+        compact_keys(keys, sorted);
     }
+
+    count_generated += generated;
+    block.clear();
+}
+
+/* score and statistics of one piece of a chained alignment */
+struct chain_piece {
+    int score;
+    int matches;
+    int similar;
+    int length;
+    int flag;
+};
+
+#define CHAIN_FLAG_MASK (PARASAIL_FLAG_SATURATED \
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_BITS_16 \
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_BITS_64 \
+        | PARASAIL_FLAG_LANES_1 | PARASAIL_FLAG_LANES_2 \
+        | PARASAIL_FLAG_LANES_4 | PARASAIL_FLAG_LANES_8 \
+        | PARASAIL_FLAG_LANES_16 | PARASAIL_FLAG_LANES_32 \
+        | PARASAIL_FLAG_LANES_64)
+
+inline static void chain_add(chain_piece &total, const chain_piece &piece)
+{
+    total.score += piece.score;
+    total.matches += piece.matches;
+    total.similar += piece.similar;
+    total.length += piece.length;
+    total.flag |= piece.flag;
+}
+
+/* Align the residues between two anchors end to end.  The score is
+ * that of the residues alone.  The alignment length of a stats result
+ * does not count leading gaps, so the statistics of a gap that follows
+ * an anchor come from aligning it together with the last anchored
+ * residue, which is taken back out only when that alignment pairs the
+ * residue with its anchored partner; otherwise the statistics of the
+ * residues alone are kept. */
+inline static chain_piece chain_gap(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        parasail_banded_function_t *nw_function,
+        bool after_anchor)
+{
+    chain_piece piece = {0, 0, 0, 0, 0};
+    parasail_result_t *result = NULL;
+    parasail_result_t *led = NULL;
+    int value = 0;
+    if (0 == s1Len && 0 == s2Len) {
+        return piece;
+    }
+    if (0 == s1Len || 0 == s2Len) {
+        piece.score = -open - (s1Len + s2Len - 1) * gap;
+        piece.length = s1Len + s2Len;
+        return piece;
+    }
+    result = nw_function(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    piece.score = result->score;
+    piece.flag = result->flag & CHAIN_FLAG_MASK;
+    if (!parasail_result_is_stats(result)) {
+        parasail_result_free(result);
+        return piece;
+    }
+    piece.matches = parasail_result_get_matches(result);
+    piece.similar = parasail_result_get_similar(result);
+    piece.length = parasail_result_get_length(result);
+    if (after_anchor) {
+        value = matrix->matrix[
+            matrix->mapper[(unsigned char)s1[-1]]*matrix->size
+            + matrix->mapper[(unsigned char)s2[-1]]];
+        led = nw_function(s1 - 1, s1Len + 1, s2 - 1, s2Len + 1,
+                open, gap, k, matrix);
+        piece.flag |= led->flag & CHAIN_FLAG_MASK;
+        if (!parasail_result_is_saturated(led)
+                && led->score == result->score + value) {
+            piece.matches = parasail_result_get_matches(led) - 1;
+            piece.similar = parasail_result_get_similar(led) - (value > 0);
+            piece.length = parasail_result_get_length(led) - 1;
+        }
+        parasail_result_free(led);
+    }
+    parasail_result_free(result);
+    return piece;
+}
+
+/* Chain the anchors of one pair and align only around the chain.  The
+ * chain is the colinear, non-overlapping subset of the anchors with the
+ * most anchored residues less the diagonal shift between neighbours.
+ * The anchors are taken as is and the residues between them are
+ * aligned end to end with the banded nw function, so the cost grows
+ * with the differences between the sequences rather than their
+ * product.  A global chain is extended to both ends of both sequences;
+ * semi-global and local chains are extended along their diagonal to
+ * the nearer end, and a local chain only when that adds to the score. */
+static parasail_result_t* chain_align(
+        const anchor * const restrict anchors,
+        long count,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        parasail_banded_function_t *nw_function,
+        int flag)
+{
+    vector<long> score(count, 0);
+    vector<long> prev(count, -1);
+    vector<long> chain;
+    chain_piece total = {0, 0, 0, 0, 0};
+    chain_piece piece = {0, 0, 0, 0, 0};
+    long best = 0;
+    long end1 = 0;
+    long end2 = 0;
+    long m = 0;
+    parasail_result_t *result = NULL;
+
+    /* chaining DP over the anchors, sorted by position in s1 */
+    for (long a=0; a<count; ++a) {
+        long lo = a > CHAIN_LOOKBACK ? a - CHAIN_LOOKBACK : 0;
+        score[a] = anchors[a].len;
+        for (long b=a-1; b>=lo; --b) {
+            long shift = 0;
+            long candidate = 0;
+            if (anchors[b].pos_first + anchors[b].len > anchors[a].pos_first
+                    || anchors[b].pos_second + anchors[b].len > anchors[a].pos_second) {
+                continue;
+            }
+            shift = labs((anchors[a].pos_first - anchors[b].pos_first)
+                    - (anchors[a].pos_second - anchors[b].pos_second));
+            candidate = score[b] + anchors[a].len - shift;
+            if (candidate > score[a]) {
+                score[a] = candidate;
+                prev[a] = b;
+            }
+        }
+        if (score[a] > score[best]) {
+            best = a;
+        }
+    }
+    for (long a=best; a>=0; a=prev[a]) {
+        chain.push_back(a);
+    }
+
+    /* leading residues */
+    {
+        const anchor &a = anchors[chain.back()];
+        if (flag & PARASAIL_FLAG_NW) {
+            chain_add(total, chain_gap(s1, a.pos_first, s2, a.pos_second,
+                        open, gap, k, matrix, nw_function, false));
+        }
+        else {
+            m = a.pos_first < a.pos_second ? a.pos_first : a.pos_second;
+            piece = chain_gap(s1 + a.pos_first - m, m, s2 + a.pos_second - m, m,
+                    open, gap, k, matrix, nw_function, false);
+            if (!(flag & PARASAIL_FLAG_SW) || piece.score > 0) {
+                chain_add(total, piece);
+            }
+        }
+    }
+
+    /* the anchors and the residues between them, in chain order */
+    for (long c=(long)chain.size()-1; c>=0; --c) {
+        const anchor &a = anchors[chain[c]];
+        if (c != (long)chain.size()-1) {
+            chain_add(total, chain_gap(
+                        s1 + end1, a.pos_first - end1,
+                        s2 + end2, a.pos_second - end2,
+                        open, gap, k, matrix, nw_function, true));
+        }
+        for (int l=0; l<a.len; ++l) {
+            int value = matrix->matrix[
+                matrix->mapper[(unsigned char)s1[a.pos_first+l]]*matrix->size
+                + matrix->mapper[(unsigned char)s2[a.pos_second+l]]];
+            total.score += value;
+            total.similar += value > 0;
+        }
+        total.matches += a.len;
+        total.length += a.len;
+        end1 = a.pos_first + a.len;
+        end2 = a.pos_second + a.len;
+    }
+
+    /* trailing residues */
+    if (flag & PARASAIL_FLAG_NW) {
+        chain_add(total, chain_gap(s1 + end1, s1Len - end1, s2 + end2, s2Len - end2,
+                    open, gap, k, matrix, nw_function, true));
+        end1 = s1Len;
+        end2 = s2Len;
+    }
+    else {
+        m = s1Len - end1 < s2Len - end2 ? s1Len - end1 : s2Len - end2;
+        piece = chain_gap(s1 + end1, m, s2 + end2, m,
+                open, gap, k, matrix, nw_function, true);
+        if (!(flag & PARASAIL_FLAG_SW) || piece.score > 0) {
+            chain_add(total, piece);
+            end1 += m;
+            end2 += m;
+        }
+    }
+
+    if (flag & PARASAIL_FLAG_STATS) {
+        result = parasail_result_new_stats();
+        result->stats->matches = total.matches;
+        result->stats->similar = total.similar;
+        result->stats->length = total.length;
+    }
+    else {
+        result = parasail_result_new();
+    }
+    result->score = total.score;
+    result->end_query = end1 - 1;
+    result->end_ref = end2 - 1;
+    result->flag = flag | PARASAIL_FLAG_BANDED | total.flag;
+
+    return result;
 }
 
 inline static void print_array(
@@ -2185,6 +3615,72 @@ inline static void output_basic(
     }
 }
 
+/* The records of a batch are written with a single fwrite. */
+inline static void output_binary(
+        FILE *fop,
+        bool is_stats,
+        bool has_query,
+        long sid_crossover,
+        const vector<long> &BEG,
+        const vector<long> &END,
+        const PairVec &vpairs,
+        const vector<parasail_result_t*> &results,
+        long long start,
+        long long stop)
+{
+    vector<parasail_results_record_t> records;
+
+    records.reserve(stop-start);
+    for (long long index=start; index<stop; ++index) {
+        parasail_result_t *result = results[index];
+        parasail_results_record_t record;
+        int i = vpairs[index].first;
+        int j = vpairs[index].second;
+        long i_beg = BEG[i];
+        long i_end = END[i];
+        long i_len = i_end-i_beg;
+        long j_beg = BEG[j];
+        long j_end = END[j];
+        long j_len = j_end-j_beg;
+
+        if (has_query) {
+            i = i - sid_crossover;
+        }
+
+        if (parasail_result_is_saturated(result)) {
+            if (has_query) {
+                fprintf(stderr, "query %d and ref %d saturated\n", i, j);
+            } else {
+                fprintf(stderr, "seq %d and seq %d saturated\n", i, j);
+            }
+            continue;
+        }
+
+        record.i = i;
+        record.j = j;
+        record.i_len = i_len;
+        record.j_len = j_len;
+        record.score = parasail_result_get_score(result);
+        record.end_query = parasail_result_get_end_query(result);
+        record.end_ref = parasail_result_get_end_ref(result);
+        if (is_stats) {
+            record.matches = parasail_result_get_matches(result);
+            record.similar = parasail_result_get_similar(result);
+            record.length = parasail_result_get_length(result);
+        }
+        else {
+            record.matches = 0;
+            record.similar = 0;
+            record.length = 0;
+        }
+        records.push_back(record);
+    }
+    if (!records.empty()) {
+        fwrite(&records[0], sizeof(parasail_results_record_t),
+                records.size(), fop);
+    }
+}
+
 inline static void output_emboss(
         FILE *fop,
         bool has_query,
@@ -2372,9 +3868,20 @@ inline static void output_ssw(
     }
 }
 
+inline static void output_sam_header(
+        FILE *fop,
+        parasail_sequences_t *sequences)
+{
+    fprintf(fop, "@HD\tVN:1.4\tSO:queryname\n");
+    for (size_t index=0; index<sequences->l; ++index) {
+        parasail_sequence_t ref_seq = sequences->seqs[index];
+        fprintf(fop, "@SQ\tSN:%s\tLN:%d\n",
+                ref_seq.name.s, (int32_t)ref_seq.seq.l);
+    }
+}
+
 inline static void output_sam(
         FILE *fop,
-        bool use_sam_header,
         bool has_query,
         long sid_crossover,
         const parasail_matrix_t *matrix,
@@ -2387,14 +3894,6 @@ inline static void output_sam(
         bool case_sensitive,
         const char *alphabet_aliases)
 {
-    if (use_sam_header && has_query && 0 == start) {
-        fprintf(fop, "@HD\tVN:1.4\tSO:queryname\n");
-        for (size_t index=0; index<sequences->l; ++index) {
-            parasail_sequence_t ref_seq = sequences->seqs[index];
-            fprintf(fop, "@SQ\tSN:%s\tLN:%d\n",
-                    ref_seq.name.s, (int32_t)ref_seq.seq.l);
-        }
-    }
     for (long long index=start; index<stop; ++index) {
         parasail_result_t *result = results[index];
         int i = vpairs[index].first;
@@ -2589,7 +4088,7 @@ inline static void output(
         bool use_emboss_format,
         bool use_ssw_format,
         bool use_sam_format,
-        bool use_sam_header,
+        bool use_binary_format,
         FILE *fop,
         bool has_query,
         long sid_crossover,
@@ -2609,7 +4108,10 @@ inline static void output(
         bool case_sensitive,
         const char *alphabet_aliases)
 {
-    if (is_stats) {
+    if (use_binary_format) {
+        output_binary(fop, is_stats, has_query, sid_crossover, BEG, END, vpairs, results, start, stop);
+    }
+    else if (is_stats) {
         if (edge_output) {
             output_edges(fop, has_query, sid_crossover, T, AOL, SIM, OS, matrix, BEG, END, vpairs, results, start, stop);
         }
@@ -2625,7 +4127,7 @@ inline static void output(
             output_ssw(fop, has_query, sid_crossover, matrix, vpairs, queries, sequences, results, start, stop, case_sensitive, alphabet_aliases);
         }
         else if (use_sam_format) {
-            output_sam(fop, use_sam_header, has_query, sid_crossover, matrix, vpairs, queries, sequences, results, start, stop, case_sensitive, alphabet_aliases);
+            output_sam(fop, has_query, sid_crossover, matrix, vpairs, queries, sequences, results, start, stop, case_sensitive, alphabet_aliases);
         }
         else {
             output_trace(fop, has_query, sid_crossover, T, matrix, BEG, END, vpairs, results, start, stop, case_sensitive, alphabet_aliases);
@@ -2639,6 +4141,77 @@ inline static void output(
     }
 }
 
+/* Writes a batch of results, to the graph or to the output file, and
+ * frees them.  The batches are pipelined, so this runs on one thread
+ * while the others align the next batch.  Records that were formatted
+ * already are written in large blocks.  Compressed output is handed to
+ * tasks that the aligning threads take once they are done. */
+inline static void output_batch(
+        bool graph_output,
+        vector<vector<pair<int,float> > > &graph,
+        unsigned long &edge_count,
+        vector<string> &records,
+        compressed_output *compressed,
+        bool is_stats,
+        bool is_table,
+        bool is_trace,
+        bool edge_output,
+        bool use_emboss_format,
+        bool use_ssw_format,
+        bool use_sam_format,
+        bool use_binary_format,
+        FILE *fop,
+        bool has_query,
+        long sid_crossover,
+        unsigned char *T,
+        int AOL,
+        int SIM,
+        int OS,
+        const parasail_matrix_t *matrix,
+        const vector<long> &BEG,
+        const vector<long> &END,
+        const PairVec &vpairs,
+        parasail_sequences_t *queries,
+        parasail_sequences_t *sequences,
+        const vector<parasail_result_t*> &results,
+        long long start,
+        long long stop,
+        bool case_sensitive,
+        const char *alphabet_aliases)
+{
+    if (graph_output) {
+        output_graph(NULL, 0, T, AOL, SIM, OS, matrix, BEG, END, vpairs,
+                results, graph, edge_count, start, stop);
+    }
+    else if (!records.empty()) {
+        const size_t block_size = 1048576;
+        string block;
+        block.reserve(2*block_size);
+        for (long long index=start; index<stop; ++index) {
+            block += records[index];
+            string().swap(records[index]);
+            if (block.size() >= block_size || index+1 == stop) {
+                fwrite(block.data(), 1, block.size(), fop);
+                block.clear();
+            }
+        }
+    }
+    else {
+        output(is_stats, is_table, is_trace, edge_output,
+                use_emboss_format, use_ssw_format, use_sam_format,
+                use_binary_format, fop, has_query,
+                sid_crossover, T, AOL, SIM, OS, matrix, BEG, END, vpairs,
+                queries, sequences, results,
+                start, stop, case_sensitive, alphabet_aliases);
+    }
+    for (long long index=start; index<stop; ++index) {
+        parasail_result_free(results[index]);
+    }
+    if (NULL != compressed) {
+        compressed->drain();
+    }
+}
+
 inline static size_t parse_bytes(const char *value)
 {
     size_t multiplier = 0;
@@ -0,0 +1,208 @@
+/**
+ * @file parasail_results
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Reads a binary results file written by parasail_aligner -O BIN and
+ * prints it as the same comma-separated values the aligner would have
+ * written, or prints its header.
+ */
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail_results.h"
+
+/* records are read this many at a time */
+#define RECORD_BLOCK 65536
+
+static void print_help(const char *progname, int status) {
+    fprintf(stderr, "\nusage: %s "
+            "[-H] "
+            "file "
+            "\n\n",
+            progname);
+    fprintf(stderr, "Defaults:\n"
+            "              -H: if present, print the header instead of the records\n"
+            "            file: no default, written by parasail_aligner -O BIN\n"
+            "\n");
+    exit(status);
+}
+
+static uint32_t swap32(uint32_t value)
+{
+    return ((value & 0x000000FFU) << 24)
+        |  ((value & 0x0000FF00U) << 8)
+        |  ((value & 0x00FF0000U) >> 8)
+        |  ((value & 0xFF000000U) >> 24);
+}
+
+static uint64_t swap64(uint64_t value)
+{
+    return ((uint64_t)swap32((uint32_t)value) << 32)
+        | swap32((uint32_t)(value >> 32));
+}
+
+static void swap_header(parasail_results_header_t *header)
+{
+    header->version = swap32(header->version);
+    header->header_size = swap32(header->header_size);
+    header->record_size = swap32(header->record_size);
+    header->columns = swap32(header->columns);
+    header->byte_order = swap32(header->byte_order);
+    header->has_query = swap32(header->has_query);
+    header->count = swap64(header->count);
+}
+
+int main(int argc, char **argv) {
+    FILE *fip = NULL;
+    const char *fname = NULL;
+    const char *progname = "parasail_results";
+    int print_header = 0;
+    int swap = 0;
+    int a = 0;
+    parasail_results_header_t header;
+    char *block = NULL;
+    unsigned long long count = 0;
+    size_t skip = 0;
+    size_t size = 0;
+
+    /* Check arguments. */
+    for (a=1; a<argc; ++a) {
+        if (0 == strcmp(argv[a], "-H")) {
+            print_header = 1;
+        }
+        else if (NULL == fname) {
+            fname = argv[a];
+        }
+        else {
+            fprintf(stderr, "Too many arguments.\n");
+            print_help(progname, EXIT_FAILURE);
+        }
+    }
+    if (NULL == fname) {
+        fprintf(stderr, "Missing input file.\n");
+        print_help(progname, EXIT_FAILURE);
+    }
+
+    /* open file */
+    fip = fopen(fname, "rb");
+    if (NULL == fip) {
+        fprintf(stderr, "%s: Cannot open input file `%s': ", progname, fname);
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+
+    /* check the header */
+    if (1 != fread(&header, sizeof(header), 1, fip)
+            || 0 != memcmp(header.magic, PARASAIL_RESULTS_MAGIC,
+                sizeof(header.magic))) {
+        fprintf(stderr, "%s is not a parasail results file\n", fname);
+        exit(EXIT_FAILURE);
+    }
+    if (PARASAIL_RESULTS_BYTE_ORDER != header.byte_order) {
+        swap = 1;
+        swap_header(&header);
+        if (PARASAIL_RESULTS_BYTE_ORDER != header.byte_order) {
+            fprintf(stderr, "%s has an unknown byte order\n", fname);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (header.version > PARASAIL_RESULTS_VERSION
+            || header.header_size < sizeof(header)
+            || header.record_size < sizeof(parasail_results_record_t)
+            || (PARASAIL_RESULTS_COLUMNS_BASIC != header.columns
+                && PARASAIL_RESULTS_COLUMNS_STATS != header.columns)) {
+        fprintf(stderr, "%s has an unsupported version %u\n",
+                fname, header.version);
+        exit(EXIT_FAILURE);
+    }
+
+    if (print_header) {
+        /* a file that was not closed cleanly still has a count of 0, so
+         * count its records from its size */
+        if (0 == header.count
+                && 0 == parasail_results_fseek(fip, 0, SEEK_END)) {
+            parasail_results_off_t offset = parasail_results_ftell(fip);
+            if (offset > (parasail_results_off_t)header.header_size) {
+                header.count = (uint64_t)(offset - header.header_size)
+                    / header.record_size;
+            }
+        }
+        fprintf(stdout,
+                "%20s: %u\n"
+                "%20s: %s\n"
+                "%20s: %u\n"
+                "%20s: %u\n"
+                "%20s: %u\n"
+                "%20s: %s\n"
+                "%20s: %llu\n",
+                "version", header.version,
+                "byte order", swap ? "swapped" : "native",
+                "header size", header.header_size,
+                "record size", header.record_size,
+                "columns", header.columns,
+                "query", header.has_query ? "yes" : "no",
+                "count", (unsigned long long)header.count);
+        fclose(fip);
+        return EXIT_SUCCESS;
+    }
+
+    /* skip what a later version may have added to the header */
+    for (skip=header.header_size-sizeof(header); skip>0; --skip) {
+        if (EOF == fgetc(fip)) {
+            fprintf(stderr, "%s is truncated\n", fname);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    block = (char*)malloc((size_t)header.record_size * RECORD_BLOCK);
+    if (NULL == block) {
+        fprintf(stderr, "%s: out of memory\n", progname);
+        exit(EXIT_FAILURE);
+    }
+    while ((size = fread(block, header.record_size, RECORD_BLOCK, fip)) > 0) {
+        size_t r = 0;
+        for (r=0; r<size; ++r) {
+            parasail_results_record_t record;
+            memcpy(&record, block + r*header.record_size, sizeof(record));
+            if (swap) {
+                uint32_t *value = (uint32_t*)&record;
+                size_t v = 0;
+                for (v=0; v<sizeof(record)/sizeof(uint32_t); ++v) {
+                    value[v] = swap32(value[v]);
+                }
+            }
+            if (PARASAIL_RESULTS_COLUMNS_STATS == header.columns) {
+                fprintf(stdout, "%d,%d,%d,%d,%d,%d,%d,%d,%d,%d\n",
+                        record.i, record.j, record.i_len, record.j_len,
+                        record.score, record.end_query, record.end_ref,
+                        record.matches, record.similar, record.length);
+            }
+            else {
+                fprintf(stdout, "%d,%d,%d,%d,%d,%d,%d\n",
+                        record.i, record.j, record.i_len, record.j_len,
+                        record.score, record.end_query, record.end_ref);
+            }
+        }
+        count += size;
+    }
+    free(block);
+
+    if (ferror(fip)) {
+        perror("fread");
+        exit(EXIT_FAILURE);
+    }
+    if (0 != header.count && count != header.count) {
+        fprintf(stderr, "%s has %llu records, header says %llu\n",
+                fname, count, (unsigned long long)header.count);
+        exit(EXIT_FAILURE);
+    }
+    fclose(fip);
+
+    return EXIT_SUCCESS;
+}
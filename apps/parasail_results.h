@@ -0,0 +1,80 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Binary results file written by parasail_aligner with -O BIN and read
+ * by parasail_results.  A fixed 64-byte header is followed by one
+ * fixed-width record per alignment, so the records of a file can be
+ * mapped into memory and indexed directly.  Values are stored in the
+ * byte order of the writing machine; byte_order tells a reader whether
+ * it has to swap them.
+ */
+#ifndef _PARASAIL_RESULTS_H_
+#define _PARASAIL_RESULTS_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#if !defined(_MSC_VER)
+#include <sys/types.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PARASAIL_RESULTS_MAGIC "PARASAIL"
+#define PARASAIL_RESULTS_VERSION 1
+#define PARASAIL_RESULTS_BYTE_ORDER 0x01020304U
+
+/* A results file can outgrow what a long addresses on Windows and on
+ * 32-bit targets, so offsets into it are 64 bits wide.  Elsewhere this
+ * relies on _FILE_OFFSET_BITS=64. */
+#if defined(_MSC_VER)
+typedef __int64 parasail_results_off_t;
+#define parasail_results_ftell _ftelli64
+#define parasail_results_fseek _fseeki64
+#else
+typedef off_t parasail_results_off_t;
+#define parasail_results_ftell ftello
+#define parasail_results_fseek fseeko
+#endif
+
+/* columns of a record, in the order of the CSV output */
+#define PARASAIL_RESULTS_COLUMNS_BASIC 7
+#define PARASAIL_RESULTS_COLUMNS_STATS 10
+
+typedef struct parasail_results_header {
+    char magic[8];          /* PARASAIL_RESULTS_MAGIC, not terminated */
+    uint32_t version;       /* PARASAIL_RESULTS_VERSION */
+    uint32_t header_size;   /* bytes before the first record */
+    uint32_t record_size;   /* bytes per record */
+    uint32_t columns;       /* record columns that are valid */
+    uint32_t byte_order;    /* PARASAIL_RESULTS_BYTE_ORDER as written */
+    uint32_t has_query;     /* i is a query index, otherwise a database index */
+    uint64_t count;         /* number of records, 0 if not known */
+    char reserved[24];
+} parasail_results_header_t;
+
+/* Matches, similar, and length are 0 unless the file has the stats
+ * columns.  Saturated results are not written. */
+typedef struct parasail_results_record {
+    int32_t i;
+    int32_t j;
+    int32_t i_len;
+    int32_t j_len;
+    int32_t score;
+    int32_t end_query;
+    int32_t end_ref;
+    int32_t matches;
+    int32_t similar;
+    int32_t length;
+} parasail_results_record_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PARASAIL_RESULTS_H_ */
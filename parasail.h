@@ -40,6 +40,11 @@ extern "C" {
 #define PARASAIL_DIAG_F 32
 #define PARASAIL_DEL_F  64
 
+/* layouts of parasail_result_extra_trace_t.trace_table */
+#define PARASAIL_TRACE_FORMAT_TABLE 0 /* one trace byte per DP cell */
+#define PARASAIL_TRACE_FORMAT_PATH  1 /* alignment path, a parasail_cigar_t */
+#define PARASAIL_TRACE_FORMAT_PACKED 2 /* striped, 4 bits per DP cell */
+
 /*                                            3         2         1          */
 /*                                           10987654321098765432109876543210*/
 #define PARASAIL_FLAG_NW          (1 << 0) /*00000000000000000000000000000001*/
@@ -127,6 +132,7 @@ typedef struct parasail_result_extra_trace {
     void * restrict trace_table;    /* DP table of traceback */
     void * restrict trace_ins_table;/* DP table of insertions traceback */
     void * restrict trace_del_table;/* DP table of deletions traceback */
+    int format;                     /* PARASAIL_TRACE_FORMAT_* of trace_table */
 } parasail_result_extra_trace_t;
 
 typedef struct parasail_result {
@@ -142,6 +148,8 @@ typedef struct parasail_result {
         parasail_result_extra_rowcols_t *rowcols;
         parasail_result_extra_trace_t *trace;
     };
+    int begin_query;/* begin position of query sequence, or -1 */
+    int begin_ref;  /* begin position of reference sequence, or -1 */
 } parasail_result_t;
 
 typedef struct parasail_matrix {
@@ -170,10 +178,23 @@ typedef struct parasail_profile {
     struct parasail_profile_data profile64;
     void (*free)(void * profile);
     int stop;
+    struct parasail_profile_lazy *lazy; /* widths built on first use */
+    int trace_format; /* PARASAIL_TRACE_FORMAT_TABLE, or _PACKED for the
+                         striped and scan trace functions to write 4 bits
+                         per DP cell */
 } parasail_profile_t;
 
 extern void parasail_profile_free(parasail_profile_t *profile);
 
+/** Build one width (8, 16, 32, or 64) of a profile if it was deferred.
+ * Profiles from parasail_profile_create_sat, the stats variant, and
+ * parasail_ssw_init build their wider widths only when first needed.
+ * Safe to call from several threads sharing the profile.  The
+ * dispatching profile functions and the _sat functions call it
+ * themselves; call it before passing such a profile directly to an
+ * ISA-specific profile function of a wider width. */
+extern void parasail_profile_materialize(const parasail_profile_t *profile, int bits);
+
 typedef parasail_result_t* parasail_function_t(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -278,6 +299,453 @@ extern parasail_result_t* parasail_nw_banded(
         const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
+/* Banded vectorized alignment.  Anti-diagonals are computed LANES cells
+ * at a time, but only within a band of diagonals d = i - j; the band is
+ * [min(0,s1Len-s2Len)-k, max(0,s1Len-s2Len)+k], so it always holds
+ * both corners.  The *_adaptive functions instead keep k+1 cells of
+ * every anti-diagonal and move that window after each anti-diagonal
+ * toward its best cell.  The trace variants store their path as a
+ * parasail_cigar_t (PARASAIL_TRACE_FORMAT_PATH). */
+typedef parasail_result_t* parasail_banded_function_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_banded_function_t parasail_nw_banded_8;
+extern parasail_banded_function_t parasail_nw_banded_16;
+extern parasail_banded_function_t parasail_nw_banded_32;
+extern parasail_banded_function_t parasail_nw_banded_sat;
+extern parasail_banded_function_t parasail_sg_banded_8;
+extern parasail_banded_function_t parasail_sg_banded_16;
+extern parasail_banded_function_t parasail_sg_banded_32;
+extern parasail_banded_function_t parasail_sg_banded_sat;
+extern parasail_banded_function_t parasail_sw_banded_8;
+extern parasail_banded_function_t parasail_sw_banded_16;
+extern parasail_banded_function_t parasail_sw_banded_32;
+extern parasail_banded_function_t parasail_sw_banded_sat;
+extern parasail_banded_function_t parasail_nw_stats_banded_8;
+extern parasail_banded_function_t parasail_nw_stats_banded_16;
+extern parasail_banded_function_t parasail_nw_stats_banded_32;
+extern parasail_banded_function_t parasail_nw_stats_banded_sat;
+extern parasail_banded_function_t parasail_sg_stats_banded_8;
+extern parasail_banded_function_t parasail_sg_stats_banded_16;
+extern parasail_banded_function_t parasail_sg_stats_banded_32;
+extern parasail_banded_function_t parasail_sg_stats_banded_sat;
+extern parasail_banded_function_t parasail_sw_stats_banded_8;
+extern parasail_banded_function_t parasail_sw_stats_banded_16;
+extern parasail_banded_function_t parasail_sw_stats_banded_32;
+extern parasail_banded_function_t parasail_sw_stats_banded_sat;
+extern parasail_banded_function_t parasail_nw_trace_banded_8;
+extern parasail_banded_function_t parasail_nw_trace_banded_16;
+extern parasail_banded_function_t parasail_nw_trace_banded_32;
+extern parasail_banded_function_t parasail_nw_trace_banded_sat;
+extern parasail_banded_function_t parasail_sg_trace_banded_8;
+extern parasail_banded_function_t parasail_sg_trace_banded_16;
+extern parasail_banded_function_t parasail_sg_trace_banded_32;
+extern parasail_banded_function_t parasail_sg_trace_banded_sat;
+extern parasail_banded_function_t parasail_sw_trace_banded_8;
+extern parasail_banded_function_t parasail_sw_trace_banded_16;
+extern parasail_banded_function_t parasail_sw_trace_banded_32;
+extern parasail_banded_function_t parasail_sw_trace_banded_sat;
+extern parasail_banded_function_t parasail_nw_banded_adaptive_8;
+extern parasail_banded_function_t parasail_nw_banded_adaptive_16;
+extern parasail_banded_function_t parasail_nw_banded_adaptive_32;
+extern parasail_banded_function_t parasail_nw_banded_adaptive_sat;
+extern parasail_banded_function_t parasail_sg_banded_adaptive_8;
+extern parasail_banded_function_t parasail_sg_banded_adaptive_16;
+extern parasail_banded_function_t parasail_sg_banded_adaptive_32;
+extern parasail_banded_function_t parasail_sg_banded_adaptive_sat;
+extern parasail_banded_function_t parasail_sw_banded_adaptive_8;
+extern parasail_banded_function_t parasail_sw_banded_adaptive_16;
+extern parasail_banded_function_t parasail_sw_banded_adaptive_32;
+extern parasail_banded_function_t parasail_sw_banded_adaptive_sat;
+extern parasail_banded_function_t parasail_nw_stats_banded_adaptive_8;
+extern parasail_banded_function_t parasail_nw_stats_banded_adaptive_16;
+extern parasail_banded_function_t parasail_nw_stats_banded_adaptive_32;
+extern parasail_banded_function_t parasail_nw_stats_banded_adaptive_sat;
+extern parasail_banded_function_t parasail_sg_stats_banded_adaptive_8;
+extern parasail_banded_function_t parasail_sg_stats_banded_adaptive_16;
+extern parasail_banded_function_t parasail_sg_stats_banded_adaptive_32;
+extern parasail_banded_function_t parasail_sg_stats_banded_adaptive_sat;
+extern parasail_banded_function_t parasail_sw_stats_banded_adaptive_8;
+extern parasail_banded_function_t parasail_sw_stats_banded_adaptive_16;
+extern parasail_banded_function_t parasail_sw_stats_banded_adaptive_32;
+extern parasail_banded_function_t parasail_sw_stats_banded_adaptive_sat;
+extern parasail_banded_function_t parasail_nw_trace_banded_adaptive_8;
+extern parasail_banded_function_t parasail_nw_trace_banded_adaptive_16;
+extern parasail_banded_function_t parasail_nw_trace_banded_adaptive_32;
+extern parasail_banded_function_t parasail_nw_trace_banded_adaptive_sat;
+extern parasail_banded_function_t parasail_sg_trace_banded_adaptive_8;
+extern parasail_banded_function_t parasail_sg_trace_banded_adaptive_16;
+extern parasail_banded_function_t parasail_sg_trace_banded_adaptive_32;
+extern parasail_banded_function_t parasail_sg_trace_banded_adaptive_sat;
+extern parasail_banded_function_t parasail_sw_trace_banded_adaptive_8;
+extern parasail_banded_function_t parasail_sw_trace_banded_adaptive_16;
+extern parasail_banded_function_t parasail_sw_trace_banded_adaptive_32;
+extern parasail_banded_function_t parasail_sw_trace_banded_adaptive_sat;
+
+/* A sequence mapped once through the mapper of a substitution matrix,
+ * so that it can be aligned many times without mapping its residues
+ * again.  The matrix indices are packed 2 bits each when the matrix has
+ * at most 4 residues, 4 bits each when it has at most 16, and one byte
+ * each otherwise; index[i] holds residues i*(8/bits) and up, starting
+ * from the low bits. */
+typedef struct parasail_encoded {
+    const parasail_matrix_t *matrix;
+    int length;
+    int bits;
+    unsigned char *index;
+} parasail_encoded_t;
+
+/** Encode a sequence; returns NULL if the matrix has over 256 residues. */
+extern parasail_encoded_t* parasail_encode(
+        const char * const restrict s, const int length,
+        const parasail_matrix_t* matrix);
+
+/** Deallocate encoded sequence. */
+extern void parasail_encoded_free(parasail_encoded_t *encoded);
+
+/** Unpack the matrix indices of an encoded sequence, one per int. */
+extern void parasail_encoded_decode(
+        const parasail_encoded_t * const restrict encoded,
+        int * const restrict index);
+
+/* The banded functions on encoded sequences.  Both sequences must be
+ * encoded with the same matrix, which is also used to score them;
+ * otherwise NULL is returned. */
+typedef parasail_result_t* parasail_banded_encoded_function_t(
+        const parasail_encoded_t * const restrict s1,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap, const int k);
+
+extern parasail_banded_encoded_function_t parasail_nw_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_nw_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_nw_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_nw_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sg_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sg_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sg_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sg_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sw_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sw_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sw_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sw_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_nw_stats_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_nw_stats_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_nw_stats_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_nw_stats_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sg_stats_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sg_stats_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sg_stats_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sg_stats_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sw_stats_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sw_stats_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sw_stats_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sw_stats_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_nw_trace_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_nw_trace_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_nw_trace_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_nw_trace_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sg_trace_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sg_trace_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sg_trace_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sg_trace_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sw_trace_banded_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sw_trace_banded_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sw_trace_banded_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sw_trace_banded_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_nw_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_nw_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_nw_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_nw_banded_adaptive_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sg_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sg_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sg_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sg_banded_adaptive_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sw_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sw_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sw_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sw_banded_adaptive_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_nw_stats_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_nw_stats_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_nw_stats_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_nw_stats_banded_adaptive_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sg_stats_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sg_stats_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sg_stats_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sg_stats_banded_adaptive_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sw_stats_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sw_stats_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sw_stats_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sw_stats_banded_adaptive_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_nw_trace_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_nw_trace_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_nw_trace_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_nw_trace_banded_adaptive_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sg_trace_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sg_trace_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sg_trace_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sg_trace_banded_adaptive_encoded_sat;
+extern parasail_banded_encoded_function_t parasail_sw_trace_banded_adaptive_encoded_8;
+extern parasail_banded_encoded_function_t parasail_sw_trace_banded_adaptive_encoded_16;
+extern parasail_banded_encoded_function_t parasail_sw_trace_banded_adaptive_encoded_32;
+extern parasail_banded_encoded_function_t parasail_sw_trace_banded_adaptive_encoded_sat;
+
+/* Striped alignment for small alphabets such as DNA without a query
+ * profile.  The substitution scores are looked up from the query
+ * residues with a vector byte shuffle of the matrix row of each
+ * database residue, so the setup cost does not grow with the matrix.
+ * Matrices with more than 16 residues or scores outside of [-128,127]
+ * use the striped functions of the same width instead. */
+extern parasail_function_t parasail_nw_striped_dna_8;
+extern parasail_function_t parasail_nw_striped_dna_16;
+extern parasail_function_t parasail_nw_striped_dna_32;
+extern parasail_function_t parasail_nw_striped_dna_sat;
+extern parasail_function_t parasail_sg_striped_dna_8;
+extern parasail_function_t parasail_sg_striped_dna_16;
+extern parasail_function_t parasail_sg_striped_dna_32;
+extern parasail_function_t parasail_sg_striped_dna_sat;
+extern parasail_function_t parasail_sw_striped_dna_8;
+extern parasail_function_t parasail_sw_striped_dna_16;
+extern parasail_function_t parasail_sw_striped_dna_32;
+extern parasail_function_t parasail_sw_striped_dna_sat;
+
+/* Striped alignment that switches to the prefix scan column update for
+ * the stretches of the database sequence where the Lazy_F correction
+ * loop of the striped update runs long, and back to striped columns
+ * when it does not.  The results are exact for open >= gap and do not
+ * depend on where the kernel switched.  Without SSE4.1, AVX2 or
+ * AVX-512BW these call the scan functions of the same width. */
+extern parasail_function_t parasail_nw_hybrid_8;
+extern parasail_function_t parasail_nw_hybrid_16;
+extern parasail_function_t parasail_nw_hybrid_32;
+extern parasail_function_t parasail_nw_hybrid_sat;
+extern parasail_function_t parasail_sg_hybrid_8;
+extern parasail_function_t parasail_sg_hybrid_16;
+extern parasail_function_t parasail_sg_hybrid_32;
+extern parasail_function_t parasail_sg_hybrid_sat;
+extern parasail_function_t parasail_sw_hybrid_8;
+extern parasail_function_t parasail_sw_hybrid_16;
+extern parasail_function_t parasail_sw_hybrid_32;
+extern parasail_function_t parasail_sw_hybrid_sat;
+
+/* Bit-parallel alignment for unit-cost scoring.  With open == gap and
+ * only two scores in use, global alignment reduces to edit distance
+ * (match == 2*mismatch + 2*gap) or to the longest common subsequence
+ * (mismatch <= -2*gap), and semi-global alignment to edit distance
+ * when match is 0 and mismatch is -gap; these are computed 64 cells
+ * per machine word.  Any other scoring calls the scan saturation
+ * checking function of the same class, so these are the functions to
+ * call to have unit-cost scoring picked up automatically; the scan,
+ * striped and diag functions always run their own kernels. */
+extern parasail_function_t parasail_nw_bitpar;
+extern parasail_function_t parasail_sg_bitpar;
+
+/* Anti-diagonal global and semi-global alignment that stores the
+ * differences between adjacent scores instead of the scores.  The
+ * differences stay within the range of the matrix and gap penalties
+ * however long the sequences are, so all 8-bit lanes are used and the
+ * result never saturates.  Penalties with max + 4*open >= 256 report
+ * saturation; the _sat functions then use the 16- and 32-bit scan
+ * functions. */
+extern parasail_function_t parasail_nw_diag_diff_8;
+extern parasail_function_t parasail_nw_diag_diff_sat;
+extern parasail_function_t parasail_sg_diag_diff_8;
+extern parasail_function_t parasail_sg_diag_diff_sat;
+
+/* Width selection from a bound on the scores.  The _auto functions
+ * bound the best score by min(s1Len,s2Len)*matrix->max and, for the
+ * global and semi-global classes, the lowest cell by the all-gap
+ * path, then run the narrowest of the 8-, 16-, and 32-bit functions
+ * whose limits cannot be reached, moving up one width at a time if it
+ * still saturates.  The nw striped and the nw and sg diag functions
+ * start at 16 bits, since their 8-bit kernels always saturate.  Pairs
+ * whose bound does not fit in 32 bits run the 32-bit function.  The
+ * profile versions expect a profile from parasail_profile_create_sat. */
+extern parasail_function_t parasail_nw_scan_auto;
+extern parasail_function_t parasail_nw_striped_auto;
+extern parasail_function_t parasail_nw_diag_auto;
+extern parasail_function_t parasail_sg_scan_auto;
+extern parasail_function_t parasail_sg_striped_auto;
+extern parasail_function_t parasail_sg_diag_auto;
+extern parasail_function_t parasail_sw_scan_auto;
+extern parasail_function_t parasail_sw_striped_auto;
+extern parasail_function_t parasail_sw_diag_auto;
+extern parasail_function_t parasail_sg_qb_scan_auto;
+extern parasail_function_t parasail_sg_qb_striped_auto;
+extern parasail_function_t parasail_sg_qb_diag_auto;
+extern parasail_function_t parasail_sg_qe_scan_auto;
+extern parasail_function_t parasail_sg_qe_striped_auto;
+extern parasail_function_t parasail_sg_qe_diag_auto;
+extern parasail_function_t parasail_sg_qx_scan_auto;
+extern parasail_function_t parasail_sg_qx_striped_auto;
+extern parasail_function_t parasail_sg_qx_diag_auto;
+extern parasail_function_t parasail_sg_db_scan_auto;
+extern parasail_function_t parasail_sg_db_striped_auto;
+extern parasail_function_t parasail_sg_db_diag_auto;
+extern parasail_function_t parasail_sg_de_scan_auto;
+extern parasail_function_t parasail_sg_de_striped_auto;
+extern parasail_function_t parasail_sg_de_diag_auto;
+extern parasail_function_t parasail_sg_dx_scan_auto;
+extern parasail_function_t parasail_sg_dx_striped_auto;
+extern parasail_function_t parasail_sg_dx_diag_auto;
+extern parasail_function_t parasail_sg_qb_de_scan_auto;
+extern parasail_function_t parasail_sg_qb_de_striped_auto;
+extern parasail_function_t parasail_sg_qb_de_diag_auto;
+extern parasail_function_t parasail_sg_qe_db_scan_auto;
+extern parasail_function_t parasail_sg_qe_db_striped_auto;
+extern parasail_function_t parasail_sg_qe_db_diag_auto;
+extern parasail_pfunction_t parasail_nw_scan_profile_auto;
+extern parasail_pfunction_t parasail_nw_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_striped_profile_auto;
+extern parasail_pfunction_t parasail_sw_scan_profile_auto;
+extern parasail_pfunction_t parasail_sw_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_qb_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_qb_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_qe_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_qe_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_qx_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_qx_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_db_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_db_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_de_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_de_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_dx_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_dx_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_qb_de_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_qb_de_striped_profile_auto;
+extern parasail_pfunction_t parasail_sg_qe_db_scan_profile_auto;
+extern parasail_pfunction_t parasail_sg_qe_db_striped_profile_auto;
+
+/* Inter-sequence (one database sequence per vector lane) local
+ * alignment of one query against many database sequences.  Each result
+ * holds the score and the end positions, chosen as parasail_sw chooses
+ * them; a saturated result has end positions of 0.  results[i]
+ * receives the result for s2s[i] and must be freed by the caller with
+ * parasail_result_free(). */
+typedef void parasail_batch_function_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_result_t ** const restrict results);
+
+extern parasail_batch_function_t parasail_sw_batch_32;
+extern parasail_batch_function_t parasail_sw_batch_16;
+extern parasail_batch_function_t parasail_sw_batch_8;
+extern parasail_batch_function_t parasail_sw_batch_sat;
+extern parasail_batch_function_t parasail_sw_batch_sse2_128_32;
+extern parasail_batch_function_t parasail_sw_batch_sse2_128_16;
+extern parasail_batch_function_t parasail_sw_batch_sse2_128_8;
+extern parasail_batch_function_t parasail_sw_batch_sse41_128_32;
+extern parasail_batch_function_t parasail_sw_batch_sse41_128_16;
+extern parasail_batch_function_t parasail_sw_batch_sse41_128_8;
+extern parasail_batch_function_t parasail_sw_batch_avx2_256_32;
+extern parasail_batch_function_t parasail_sw_batch_avx2_256_16;
+extern parasail_batch_function_t parasail_sw_batch_avx2_256_8;
+extern parasail_batch_function_t parasail_sw_batch_avx512_512_32;
+extern parasail_batch_function_t parasail_sw_batch_avx512_512_16;
+extern parasail_batch_function_t parasail_sw_batch_avx512_512_8;
+extern parasail_batch_function_t parasail_sw_batch_altivec_128_32;
+extern parasail_batch_function_t parasail_sw_batch_altivec_128_16;
+extern parasail_batch_function_t parasail_sw_batch_altivec_128_8;
+extern parasail_batch_function_t parasail_sw_batch_neon_128_32;
+extern parasail_batch_function_t parasail_sw_batch_neon_128_16;
+extern parasail_batch_function_t parasail_sw_batch_neon_128_8;
+
+/* Aligned scratch memory owned by one thread and reused across calls.
+ * The *_ws functions carve their DP columns (and, for the non-profile
+ * functions, the query profile) out of the workspace and write into a
+ * caller-provided result, so that no memory is allocated per call. */
+typedef struct parasail_workspace {
+    void *memory;   /* aligned scratch memory */
+    size_t size;    /* size of memory in bytes */
+} parasail_workspace_t;
+
+typedef parasail_result_t* parasail_ws_function_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+typedef parasail_result_t* parasail_ws_pfunction_t(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+/** Allocate a workspace with at least size bytes; size may be 0. */
+extern parasail_workspace_t* parasail_workspace_create(size_t size);
+
+/** Grow a workspace to at least size bytes; contents are not kept. */
+extern void parasail_workspace_grow(parasail_workspace_t *workspace, size_t size);
+
+/** Deallocate workspace. */
+extern void parasail_workspace_free(parasail_workspace_t *workspace);
+
+/* Number of times each kernel width was run by the *_sat functions.  The
+ * sw striped *_sat functions resume the wider kernel from the column
+ * where the narrower one saturated, so there a wider run is partial. */
+typedef struct parasail_sat_stats {
+    unsigned long long bits8;
+    unsigned long long bits16;
+    unsigned long long bits32;
+} parasail_sat_stats_t;
+
+/** Read the *_sat width counters. */
+extern void parasail_sat_stats_get(parasail_sat_stats_t *stats);
+
+/** Zero the *_sat width counters. */
+extern void parasail_sat_stats_reset(void);
+
+/* Seed extension.  s1 and s2 both start at the seed, so the alignment is
+ * anchored at (0,0) and scored like nw, but it may end anywhere; the
+ * result holds the best score and where it ends, or score 0 and end
+ * -1,-1 when no extension beats the empty one.  The database sequence s2
+ * is consumed one column at a time and the extension stops early
+ * (x-drop) when the best score of a column falls more than xdrop below
+ * the best score so far, or (z-drop) when it falls more than zdrop plus
+ * gap times the diagonal offset from the best cell.  Cells more than
+ * xdrop below the best score are also cut from the following columns.
+ * A negative xdrop or zdrop disables that test. */
+#define PARASAIL_EXTEND_END   0 /* every column of s2 was computed */
+#define PARASAIL_EXTEND_XDROP 1 /* stopped by the x-drop test */
+#define PARASAIL_EXTEND_ZDROP 2 /* stopped by the z-drop test */
+
+typedef struct parasail_extension {
+    int query_end_score;    /* best score ending at the last s1 residue */
+    int query_end_ref;      /* s2 position of query_end_score, or -1 */
+    int ref_end_score;      /* best score ending at the last s2 residue */
+    int ref_end_query;      /* s1 position of ref_end_score, or -1 */
+    int ref_scanned;        /* number of s2 columns computed */
+    int stop;               /* PARASAIL_EXTEND_END, _XDROP or _ZDROP */
+} parasail_extension_t;
+
+/* extension may be NULL when only the result is wanted */
+typedef parasail_result_t* parasail_extend_function_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+typedef parasail_result_t* parasail_extend_pfunction_t(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+/** Serial seed extension, the reference for the vectorized functions. */
+extern parasail_extend_function_t parasail_extend;
+
 typedef struct parasail_traceback_{
     char *query;
     char *comp;
@@ -427,6 +895,37 @@ extern parasail_cigar_t* parasail_result_get_cigar_extra(
         int case_sensitive,
         const char *alphabet_aliases);
 
+/** Allocate and return the cigar of an nw, sg or sw result that has no
+ * traceback, e.g. from a score-only or stats function.  The begin is
+ * found first if the result does not have it yet (see
+ * parasail_result_find_begin), then a banded trace is run only over the
+ * window between the begin and end locations, its band derived from the
+ * score.  Results of trace functions take the usual cigar.  The
+ * penalties and matrix must be those of the alignment.  Returns NULL if
+ * the begin cannot be found, e.g. for saturated results. */
+extern parasail_cigar_t* parasail_result_get_cigar_window(
+        parasail_result_t *result,
+        const char *seqA,
+        int lena,
+        const char *seqB,
+        int lenb,
+        int open,
+        int gap,
+        const parasail_matrix_t *matrix);
+
+/* allocate and return the windowed cigar for the given alignment */
+extern parasail_cigar_t* parasail_result_get_cigar_window_extra(
+        parasail_result_t *result,
+        const char *seqA,
+        int lena,
+        const char *seqB,
+        int lenb,
+        int open,
+        int gap,
+        const parasail_matrix_t *matrix,
+        int case_sensitive,
+        const char *alphabet_aliases);
+
 /* free the cigar structure */
 extern void parasail_cigar_free(parasail_cigar_t *cigar);
 
@@ -478,6 +977,23 @@ extern int parasail_result_is_trace(const parasail_result_t * const restrict res
 extern int parasail_result_get_score(const parasail_result_t * const restrict result);
 extern int parasail_result_get_end_query(const parasail_result_t * const restrict result);
 extern int parasail_result_get_end_ref(const parasail_result_t * const restrict result);
+extern int parasail_result_get_begin_query(const parasail_result_t * const restrict result);
+extern int parasail_result_get_begin_ref(const parasail_result_t * const restrict result);
+
+/** Fill begin_query and begin_ref of any nw, sg or sw result that has
+ * its end location, score-only and stats results included, without
+ * trace tables.  The prefixes of s1 and s2 up to the end location are
+ * reversed and extended from it; the begin is where that extension
+ * first reaches the score.  The penalties and matrix must be those of
+ * the alignment.  Returns 1 when the begin was found and 0 otherwise,
+ * e.g. for saturated results or a local score of 0, in which case both
+ * are set to -1. */
+extern int parasail_result_find_begin(
+        parasail_result_t * const restrict result,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix);
 
 extern int parasail_result_get_matches(const parasail_result_t * const restrict result);
 extern int parasail_result_get_similar(const parasail_result_t * const restrict result);
@@ -1526,6 +2042,79 @@ extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_nw_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_flags_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_nw_scan_sse2_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1616,6 +2205,36 @@ extern parasail_result_t* parasail_nw_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1766,6 +2385,36 @@ extern parasail_result_t* parasail_nw_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1916,6 +2565,36 @@ extern parasail_result_t* parasail_nw_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2066,6 +2745,36 @@ extern parasail_result_t* parasail_nw_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2216,6 +2925,36 @@ extern parasail_result_t* parasail_nw_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2366,6 +3105,36 @@ extern parasail_result_t* parasail_nw_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2516,6 +3285,36 @@ extern parasail_result_t* parasail_nw_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2666,6 +3465,36 @@ extern parasail_result_t* parasail_nw_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2816,6 +3645,36 @@ extern parasail_result_t* parasail_nw_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2966,6 +3825,36 @@ extern parasail_result_t* parasail_nw_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3116,6 +4005,36 @@ extern parasail_result_t* parasail_nw_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3266,6 +4185,36 @@ extern parasail_result_t* parasail_nw_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3416,6 +4365,36 @@ extern parasail_result_t* parasail_nw_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3566,6 +4545,36 @@ extern parasail_result_t* parasail_nw_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3716,6 +4725,36 @@ extern parasail_result_t* parasail_nw_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3866,6 +4905,36 @@ extern parasail_result_t* parasail_nw_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4016,6 +5085,36 @@ extern parasail_result_t* parasail_nw_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4166,6 +5265,36 @@ extern parasail_result_t* parasail_nw_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4316,6 +5445,36 @@ extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4466,6 +5625,36 @@ extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4616,6 +5805,36 @@ extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4766,6 +5985,36 @@ extern parasail_result_t* parasail_sg_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4916,6 +6165,36 @@ extern parasail_result_t* parasail_sg_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5066,6 +6345,36 @@ extern parasail_result_t* parasail_sg_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5216,6 +6525,36 @@ extern parasail_result_t* parasail_sg_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5366,6 +6705,36 @@ extern parasail_result_t* parasail_sg_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5516,6 +6885,36 @@ extern parasail_result_t* parasail_sg_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5666,6 +7065,36 @@ extern parasail_result_t* parasail_sg_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5816,6 +7245,36 @@ extern parasail_result_t* parasail_sg_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5966,6 +7425,36 @@ extern parasail_result_t* parasail_sg_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6116,6 +7605,36 @@ extern parasail_result_t* parasail_sg_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6266,6 +7785,36 @@ extern parasail_result_t* parasail_sg_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6416,6 +7965,36 @@ extern parasail_result_t* parasail_sg_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6566,6 +8145,36 @@ extern parasail_result_t* parasail_sg_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6716,6 +8325,36 @@ extern parasail_result_t* parasail_sg_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6866,6 +8505,36 @@ extern parasail_result_t* parasail_sg_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7016,6 +8685,36 @@ extern parasail_result_t* parasail_sg_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7166,6 +8865,36 @@ extern parasail_result_t* parasail_sg_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7316,6 +9045,36 @@ extern parasail_result_t* parasail_sg_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7466,6 +9225,36 @@ extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7616,6 +9405,36 @@ extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7766,6 +9585,36 @@ extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7916,6 +9765,36 @@ extern parasail_result_t* parasail_sw_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8066,6 +9945,36 @@ extern parasail_result_t* parasail_sw_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8216,6 +10125,36 @@ extern parasail_result_t* parasail_sw_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8366,6 +10305,36 @@ extern parasail_result_t* parasail_sw_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8516,6 +10485,36 @@ extern parasail_result_t* parasail_sw_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8666,6 +10665,36 @@ extern parasail_result_t* parasail_sw_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8816,6 +10845,36 @@ extern parasail_result_t* parasail_sw_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8966,6 +11025,36 @@ extern parasail_result_t* parasail_sw_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9116,6 +11205,36 @@ extern parasail_result_t* parasail_sw_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9266,6 +11385,36 @@ extern parasail_result_t* parasail_sw_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9416,6 +11565,36 @@ extern parasail_result_t* parasail_sw_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9566,6 +11745,36 @@ extern parasail_result_t* parasail_sw_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9716,6 +11925,36 @@ extern parasail_result_t* parasail_sw_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9866,6 +12105,36 @@ extern parasail_result_t* parasail_sw_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10016,6 +12285,36 @@ extern parasail_result_t* parasail_sw_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10166,6 +12465,36 @@ extern parasail_result_t* parasail_sw_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10316,6 +12645,36 @@ extern parasail_result_t* parasail_sw_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10466,6 +12825,36 @@ extern parasail_result_t* parasail_sw_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10616,6 +13005,36 @@ extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10766,6 +13185,36 @@ extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10916,6 +13365,36 @@ extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -11066,6 +13545,36 @@ extern parasail_result_t* parasail_sg_qb_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -11216,6 +13725,36 @@ extern parasail_result_t* parasail_sg_qb_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -11366,6 +13905,36 @@ extern parasail_result_t* parasail_sg_qb_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -11516,6 +14085,36 @@ extern parasail_result_t* parasail_sg_qb_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -11666,6 +14265,36 @@ extern parasail_result_t* parasail_sg_qb_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -11816,6 +14445,36 @@ extern parasail_result_t* parasail_sg_qb_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -11966,6 +14625,36 @@ extern parasail_result_t* parasail_sg_qb_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -12116,6 +14805,36 @@ extern parasail_result_t* parasail_sg_qb_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -12266,6 +14985,36 @@ extern parasail_result_t* parasail_sg_qb_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -12416,6 +15165,36 @@ extern parasail_result_t* parasail_sg_qb_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -12566,6 +15345,36 @@ extern parasail_result_t* parasail_sg_qb_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -12716,6 +15525,36 @@ extern parasail_result_t* parasail_sg_qb_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -12866,6 +15705,36 @@ extern parasail_result_t* parasail_sg_qb_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -13016,6 +15885,36 @@ extern parasail_result_t* parasail_sg_qb_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -13166,6 +16065,36 @@ extern parasail_result_t* parasail_sg_qb_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -13316,6 +16245,36 @@ extern parasail_result_t* parasail_sg_qb_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -13466,6 +16425,36 @@ extern parasail_result_t* parasail_sg_qb_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -13616,6 +16605,36 @@ extern parasail_result_t* parasail_sg_qb_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -13766,6 +16785,36 @@ extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -13916,6 +16965,36 @@ extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -14066,6 +17145,36 @@ extern parasail_result_t* parasail_sg_qb_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -14216,6 +17325,36 @@ extern parasail_result_t* parasail_sg_qe_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -14366,6 +17505,36 @@ extern parasail_result_t* parasail_sg_qe_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -14516,6 +17685,36 @@ extern parasail_result_t* parasail_sg_qe_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -14666,6 +17865,36 @@ extern parasail_result_t* parasail_sg_qe_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -14816,6 +18045,36 @@ extern parasail_result_t* parasail_sg_qe_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -14966,6 +18225,36 @@ extern parasail_result_t* parasail_sg_qe_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -15116,6 +18405,36 @@ extern parasail_result_t* parasail_sg_qe_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -15266,6 +18585,36 @@ extern parasail_result_t* parasail_sg_qe_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -15416,6 +18765,36 @@ extern parasail_result_t* parasail_sg_qe_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -15566,6 +18945,36 @@ extern parasail_result_t* parasail_sg_qe_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -15716,6 +19125,36 @@ extern parasail_result_t* parasail_sg_qe_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -15866,6 +19305,36 @@ extern parasail_result_t* parasail_sg_qe_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -16016,6 +19485,36 @@ extern parasail_result_t* parasail_sg_qe_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -16166,6 +19665,36 @@ extern parasail_result_t* parasail_sg_qe_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -16316,6 +19845,36 @@ extern parasail_result_t* parasail_sg_qe_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -16466,6 +20025,36 @@ extern parasail_result_t* parasail_sg_qe_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -16616,6 +20205,36 @@ extern parasail_result_t* parasail_sg_qe_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -16766,6 +20385,36 @@ extern parasail_result_t* parasail_sg_qe_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -16916,6 +20565,36 @@ extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -17066,6 +20745,36 @@ extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -17216,6 +20925,36 @@ extern parasail_result_t* parasail_sg_qe_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -17366,6 +21105,36 @@ extern parasail_result_t* parasail_sg_qx_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -17516,6 +21285,36 @@ extern parasail_result_t* parasail_sg_qx_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -17666,6 +21465,36 @@ extern parasail_result_t* parasail_sg_qx_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -17816,6 +21645,36 @@ extern parasail_result_t* parasail_sg_qx_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -17966,6 +21825,36 @@ extern parasail_result_t* parasail_sg_qx_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -18116,6 +22005,36 @@ extern parasail_result_t* parasail_sg_qx_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -18266,6 +22185,36 @@ extern parasail_result_t* parasail_sg_qx_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -18416,6 +22365,36 @@ extern parasail_result_t* parasail_sg_qx_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -18566,6 +22545,36 @@ extern parasail_result_t* parasail_sg_qx_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -18716,6 +22725,36 @@ extern parasail_result_t* parasail_sg_qx_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -18866,6 +22905,36 @@ extern parasail_result_t* parasail_sg_qx_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -19016,6 +23085,36 @@ extern parasail_result_t* parasail_sg_qx_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -19166,6 +23265,36 @@ extern parasail_result_t* parasail_sg_qx_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -19316,6 +23445,36 @@ extern parasail_result_t* parasail_sg_qx_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -19466,6 +23625,36 @@ extern parasail_result_t* parasail_sg_qx_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -19616,6 +23805,36 @@ extern parasail_result_t* parasail_sg_qx_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -19766,6 +23985,36 @@ extern parasail_result_t* parasail_sg_qx_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -19916,6 +24165,36 @@ extern parasail_result_t* parasail_sg_qx_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -20066,6 +24345,36 @@ extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -20216,6 +24525,36 @@ extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -20366,6 +24705,36 @@ extern parasail_result_t* parasail_sg_qx_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qx_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -20516,6 +24885,36 @@ extern parasail_result_t* parasail_sg_db_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -20666,6 +25065,36 @@ extern parasail_result_t* parasail_sg_db_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -20816,6 +25245,36 @@ extern parasail_result_t* parasail_sg_db_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -20966,6 +25425,36 @@ extern parasail_result_t* parasail_sg_db_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -21116,6 +25605,36 @@ extern parasail_result_t* parasail_sg_db_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -21266,6 +25785,36 @@ extern parasail_result_t* parasail_sg_db_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -21416,6 +25965,36 @@ extern parasail_result_t* parasail_sg_db_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -21566,6 +26145,36 @@ extern parasail_result_t* parasail_sg_db_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -21716,6 +26325,36 @@ extern parasail_result_t* parasail_sg_db_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -21866,6 +26505,36 @@ extern parasail_result_t* parasail_sg_db_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -22016,6 +26685,36 @@ extern parasail_result_t* parasail_sg_db_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -22166,6 +26865,36 @@ extern parasail_result_t* parasail_sg_db_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -22316,6 +27045,36 @@ extern parasail_result_t* parasail_sg_db_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -22466,6 +27225,36 @@ extern parasail_result_t* parasail_sg_db_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -22616,6 +27405,36 @@ extern parasail_result_t* parasail_sg_db_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -22766,6 +27585,36 @@ extern parasail_result_t* parasail_sg_db_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -22916,6 +27765,36 @@ extern parasail_result_t* parasail_sg_db_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -23066,6 +27945,36 @@ extern parasail_result_t* parasail_sg_db_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -23216,6 +28125,36 @@ extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -23366,6 +28305,36 @@ extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -23516,6 +28485,36 @@ extern parasail_result_t* parasail_sg_db_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_db_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_db_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -23666,6 +28665,36 @@ extern parasail_result_t* parasail_sg_de_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -23816,6 +28845,36 @@ extern parasail_result_t* parasail_sg_de_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -23966,6 +29025,36 @@ extern parasail_result_t* parasail_sg_de_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -24116,6 +29205,36 @@ extern parasail_result_t* parasail_sg_de_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -24266,6 +29385,36 @@ extern parasail_result_t* parasail_sg_de_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -24416,6 +29565,36 @@ extern parasail_result_t* parasail_sg_de_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -24566,6 +29745,36 @@ extern parasail_result_t* parasail_sg_de_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -24716,6 +29925,36 @@ extern parasail_result_t* parasail_sg_de_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -24866,6 +30105,36 @@ extern parasail_result_t* parasail_sg_de_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -25016,6 +30285,36 @@ extern parasail_result_t* parasail_sg_de_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -25166,6 +30465,36 @@ extern parasail_result_t* parasail_sg_de_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -25316,6 +30645,36 @@ extern parasail_result_t* parasail_sg_de_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -25466,6 +30825,36 @@ extern parasail_result_t* parasail_sg_de_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -25616,6 +31005,36 @@ extern parasail_result_t* parasail_sg_de_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -25766,6 +31185,36 @@ extern parasail_result_t* parasail_sg_de_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -25916,6 +31365,36 @@ extern parasail_result_t* parasail_sg_de_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -26066,6 +31545,36 @@ extern parasail_result_t* parasail_sg_de_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -26216,6 +31725,36 @@ extern parasail_result_t* parasail_sg_de_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -26366,6 +31905,36 @@ extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -26516,6 +32085,36 @@ extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -26666,6 +32265,36 @@ extern parasail_result_t* parasail_sg_de_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_de_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_de_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -26816,6 +32445,36 @@ extern parasail_result_t* parasail_sg_dx_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -26966,6 +32625,36 @@ extern parasail_result_t* parasail_sg_dx_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -27116,6 +32805,36 @@ extern parasail_result_t* parasail_sg_dx_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -27266,6 +32985,36 @@ extern parasail_result_t* parasail_sg_dx_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -27416,6 +33165,36 @@ extern parasail_result_t* parasail_sg_dx_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -27566,6 +33345,36 @@ extern parasail_result_t* parasail_sg_dx_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -27716,6 +33525,36 @@ extern parasail_result_t* parasail_sg_dx_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -27866,6 +33705,36 @@ extern parasail_result_t* parasail_sg_dx_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -28016,6 +33885,36 @@ extern parasail_result_t* parasail_sg_dx_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -28166,6 +34065,36 @@ extern parasail_result_t* parasail_sg_dx_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -28316,6 +34245,36 @@ extern parasail_result_t* parasail_sg_dx_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -28466,6 +34425,36 @@ extern parasail_result_t* parasail_sg_dx_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -28616,6 +34605,36 @@ extern parasail_result_t* parasail_sg_dx_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -28766,6 +34785,36 @@ extern parasail_result_t* parasail_sg_dx_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -28916,6 +34965,36 @@ extern parasail_result_t* parasail_sg_dx_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -29066,6 +35145,36 @@ extern parasail_result_t* parasail_sg_dx_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -29216,6 +35325,36 @@ extern parasail_result_t* parasail_sg_dx_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -29366,6 +35505,36 @@ extern parasail_result_t* parasail_sg_dx_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -29516,6 +35685,36 @@ extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -29666,6 +35865,36 @@ extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -29816,6 +36045,36 @@ extern parasail_result_t* parasail_sg_dx_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_dx_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -29966,6 +36225,36 @@ extern parasail_result_t* parasail_sg_qb_de_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -30116,6 +36405,36 @@ extern parasail_result_t* parasail_sg_qb_de_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -30266,6 +36585,36 @@ extern parasail_result_t* parasail_sg_qb_de_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -30416,6 +36765,36 @@ extern parasail_result_t* parasail_sg_qb_de_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -30566,6 +36945,36 @@ extern parasail_result_t* parasail_sg_qb_de_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -30716,6 +37125,36 @@ extern parasail_result_t* parasail_sg_qb_de_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -30866,6 +37305,36 @@ extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -31016,6 +37485,36 @@ extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -31166,6 +37665,36 @@ extern parasail_result_t* parasail_sg_qb_de_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -31316,6 +37845,36 @@ extern parasail_result_t* parasail_sg_qb_de_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -31466,6 +38025,36 @@ extern parasail_result_t* parasail_sg_qb_de_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -31616,6 +38205,36 @@ extern parasail_result_t* parasail_sg_qb_de_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -31766,6 +38385,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -31916,6 +38565,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -32066,6 +38745,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -32216,6 +38925,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -32366,6 +39105,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -32516,6 +39285,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -32666,6 +39465,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -32816,6 +39645,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -32966,6 +39825,36 @@ extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -33116,6 +40005,36 @@ extern parasail_result_t* parasail_sg_qe_db_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -33266,6 +40185,36 @@ extern parasail_result_t* parasail_sg_qe_db_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -33416,6 +40365,36 @@ extern parasail_result_t* parasail_sg_qe_db_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -33566,6 +40545,36 @@ extern parasail_result_t* parasail_sg_qe_db_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -33716,6 +40725,36 @@ extern parasail_result_t* parasail_sg_qe_db_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -33866,6 +40905,36 @@ extern parasail_result_t* parasail_sg_qe_db_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -34016,6 +41085,36 @@ extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -34166,6 +41265,36 @@ extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -34316,6 +41445,36 @@ extern parasail_result_t* parasail_sg_qe_db_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -34466,6 +41625,36 @@ extern parasail_result_t* parasail_sg_qe_db_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -34616,6 +41805,36 @@ extern parasail_result_t* parasail_sg_qe_db_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -34766,6 +41985,36 @@ extern parasail_result_t* parasail_sg_qe_db_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -34916,6 +42165,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -35066,6 +42345,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -35216,6 +42525,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -35366,6 +42705,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -35516,6 +42885,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -35666,6 +43065,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -35816,6 +43245,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -35966,6 +43425,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -36116,6 +43605,36 @@ extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -36281,6 +43800,41 @@ extern parasail_result_t* parasail_sg_flags_scan_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -36456,6 +44010,41 @@ extern parasail_result_t* parasail_sg_flags_striped_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -36631,6 +44220,41 @@ extern parasail_result_t* parasail_sg_flags_diag_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -36806,6 +44430,41 @@ extern parasail_result_t* parasail_sg_flags_table_scan_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -36981,6 +44640,41 @@ extern parasail_result_t* parasail_sg_flags_table_striped_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -37156,6 +44850,41 @@ extern parasail_result_t* parasail_sg_flags_table_diag_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -37331,6 +45060,41 @@ extern parasail_result_t* parasail_sg_flags_rowcol_scan_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -37506,6 +45270,41 @@ extern parasail_result_t* parasail_sg_flags_rowcol_striped_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -37681,6 +45480,41 @@ extern parasail_result_t* parasail_sg_flags_rowcol_diag_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -37856,6 +45690,41 @@ extern parasail_result_t* parasail_sg_flags_trace_scan_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_trace_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -38031,6 +45900,41 @@ extern parasail_result_t* parasail_sg_flags_trace_striped_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_trace_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -38206,6 +46110,41 @@ extern parasail_result_t* parasail_sg_flags_trace_diag_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_trace_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -38381,6 +46320,41 @@ extern parasail_result_t* parasail_sg_flags_stats_scan_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -38556,6 +46530,41 @@ extern parasail_result_t* parasail_sg_flags_stats_striped_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -38731,6 +46740,41 @@ extern parasail_result_t* parasail_sg_flags_stats_diag_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -38906,6 +46950,41 @@ extern parasail_result_t* parasail_sg_flags_stats_table_scan_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -39081,6 +47160,41 @@ extern parasail_result_t* parasail_sg_flags_stats_table_striped_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -39256,6 +47370,41 @@ extern parasail_result_t* parasail_sg_flags_stats_table_diag_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_table_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -39431,6 +47580,41 @@ extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -39606,6 +47790,41 @@ extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -39781,6 +48000,41 @@ extern parasail_result_t* parasail_sg_flags_stats_rowcol_diag_avx2_256_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_diag_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_diag_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_diag_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_diag_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_diag_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -39926,6 +48180,31 @@ extern parasail_result_t* parasail_nw_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -40051,6 +48330,31 @@ extern parasail_result_t* parasail_nw_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -40176,6 +48480,31 @@ extern parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -40301,6 +48630,31 @@ extern parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -40426,6 +48780,31 @@ extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -40551,6 +48930,31 @@ extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -40676,6 +49080,31 @@ extern parasail_result_t* parasail_nw_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -40801,6 +49230,31 @@ extern parasail_result_t* parasail_nw_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -40926,6 +49380,31 @@ extern parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -41051,6 +49530,31 @@ extern parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -41176,6 +49680,31 @@ extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -41301,6 +49830,31 @@ extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -41426,6 +49980,31 @@ extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -41551,6 +50130,31 @@ extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -41676,6 +50280,31 @@ extern parasail_result_t* parasail_sg_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -41801,6 +50430,31 @@ extern parasail_result_t* parasail_sg_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -41926,6 +50580,31 @@ extern parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -42051,6 +50730,31 @@ extern parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -42176,6 +50880,31 @@ extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -42301,6 +51030,31 @@ extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -42426,6 +51180,31 @@ extern parasail_result_t* parasail_sg_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -42551,6 +51330,31 @@ extern parasail_result_t* parasail_sg_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -42676,6 +51480,31 @@ extern parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -42801,6 +51630,31 @@ extern parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -42926,6 +51780,31 @@ extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -43051,6 +51930,31 @@ extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -43176,6 +52080,31 @@ extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -43301,6 +52230,31 @@ extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -43426,6 +52380,31 @@ extern parasail_result_t* parasail_sw_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -43551,6 +52530,31 @@ extern parasail_result_t* parasail_sw_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -43676,6 +52680,31 @@ extern parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -43801,6 +52830,31 @@ extern parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -43926,6 +52980,31 @@ extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -44051,6 +53130,31 @@ extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -44176,6 +53280,31 @@ extern parasail_result_t* parasail_sw_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -44301,6 +53430,31 @@ extern parasail_result_t* parasail_sw_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -44426,6 +53580,31 @@ extern parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -44551,6 +53730,31 @@ extern parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -44676,6 +53880,31 @@ extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -44801,6 +54030,31 @@ extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -44926,6 +54180,31 @@ extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -45051,6 +54330,31 @@ extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -45176,6 +54480,31 @@ extern parasail_result_t* parasail_sg_qb_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -45301,6 +54630,31 @@ extern parasail_result_t* parasail_sg_qb_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -45426,6 +54780,31 @@ extern parasail_result_t* parasail_sg_qb_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -45551,6 +54930,31 @@ extern parasail_result_t* parasail_sg_qb_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -45676,6 +55080,31 @@ extern parasail_result_t* parasail_sg_qb_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -45801,6 +55230,31 @@ extern parasail_result_t* parasail_sg_qb_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -45926,6 +55380,31 @@ extern parasail_result_t* parasail_sg_qb_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -46051,6 +55530,31 @@ extern parasail_result_t* parasail_sg_qb_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -46176,6 +55680,31 @@ extern parasail_result_t* parasail_sg_qb_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -46301,6 +55830,31 @@ extern parasail_result_t* parasail_sg_qb_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -46426,6 +55980,31 @@ extern parasail_result_t* parasail_sg_qb_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -46551,6 +56130,31 @@ extern parasail_result_t* parasail_sg_qb_stats_table_striped_profile_avx2_256_sa
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -46676,6 +56280,31 @@ extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -46801,6 +56430,31 @@ extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_profile_avx2_256_s
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -46926,6 +56580,31 @@ extern parasail_result_t* parasail_sg_qe_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -47051,6 +56730,31 @@ extern parasail_result_t* parasail_sg_qe_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -47176,6 +56880,31 @@ extern parasail_result_t* parasail_sg_qe_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -47301,6 +57030,31 @@ extern parasail_result_t* parasail_sg_qe_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -47426,6 +57180,31 @@ extern parasail_result_t* parasail_sg_qe_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -47551,6 +57330,31 @@ extern parasail_result_t* parasail_sg_qe_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -47676,6 +57480,31 @@ extern parasail_result_t* parasail_sg_qe_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -47801,6 +57630,31 @@ extern parasail_result_t* parasail_sg_qe_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -47926,6 +57780,31 @@ extern parasail_result_t* parasail_sg_qe_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -48051,6 +57930,31 @@ extern parasail_result_t* parasail_sg_qe_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -48176,6 +58080,31 @@ extern parasail_result_t* parasail_sg_qe_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -48301,6 +58230,31 @@ extern parasail_result_t* parasail_sg_qe_stats_table_striped_profile_avx2_256_sa
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -48426,6 +58380,31 @@ extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -48551,6 +58530,31 @@ extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_profile_avx2_256_s
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -48676,6 +58680,31 @@ extern parasail_result_t* parasail_sg_qx_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -48801,6 +58830,31 @@ extern parasail_result_t* parasail_sg_qx_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -48926,6 +58980,31 @@ extern parasail_result_t* parasail_sg_qx_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -49051,6 +59130,31 @@ extern parasail_result_t* parasail_sg_qx_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -49176,6 +59280,31 @@ extern parasail_result_t* parasail_sg_qx_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -49301,6 +59430,31 @@ extern parasail_result_t* parasail_sg_qx_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -49426,6 +59580,31 @@ extern parasail_result_t* parasail_sg_qx_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -49551,6 +59730,31 @@ extern parasail_result_t* parasail_sg_qx_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -49676,6 +59880,31 @@ extern parasail_result_t* parasail_sg_qx_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -49801,6 +60030,31 @@ extern parasail_result_t* parasail_sg_qx_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -49926,6 +60180,31 @@ extern parasail_result_t* parasail_sg_qx_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -50051,6 +60330,31 @@ extern parasail_result_t* parasail_sg_qx_stats_table_striped_profile_avx2_256_sa
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -50176,6 +60480,31 @@ extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -50301,6 +60630,31 @@ extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_profile_avx2_256_s
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qx_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -50426,6 +60780,31 @@ extern parasail_result_t* parasail_sg_db_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -50551,6 +60930,31 @@ extern parasail_result_t* parasail_sg_db_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -50676,6 +61080,31 @@ extern parasail_result_t* parasail_sg_db_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -50801,6 +61230,31 @@ extern parasail_result_t* parasail_sg_db_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -50926,6 +61380,31 @@ extern parasail_result_t* parasail_sg_db_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -51051,6 +61530,31 @@ extern parasail_result_t* parasail_sg_db_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -51176,6 +61680,31 @@ extern parasail_result_t* parasail_sg_db_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -51301,6 +61830,31 @@ extern parasail_result_t* parasail_sg_db_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -51426,6 +61980,31 @@ extern parasail_result_t* parasail_sg_db_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -51551,6 +62130,31 @@ extern parasail_result_t* parasail_sg_db_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -51676,6 +62280,31 @@ extern parasail_result_t* parasail_sg_db_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -51801,6 +62430,31 @@ extern parasail_result_t* parasail_sg_db_stats_table_striped_profile_avx2_256_sa
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -51926,6 +62580,31 @@ extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -52051,6 +62730,31 @@ extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_profile_avx2_256_s
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_db_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -52176,6 +62880,31 @@ extern parasail_result_t* parasail_sg_de_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -52301,6 +63030,31 @@ extern parasail_result_t* parasail_sg_de_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -52426,6 +63180,31 @@ extern parasail_result_t* parasail_sg_de_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -52551,6 +63330,31 @@ extern parasail_result_t* parasail_sg_de_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -52676,6 +63480,31 @@ extern parasail_result_t* parasail_sg_de_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -52801,6 +63630,31 @@ extern parasail_result_t* parasail_sg_de_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -52926,6 +63780,31 @@ extern parasail_result_t* parasail_sg_de_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -53051,6 +63930,31 @@ extern parasail_result_t* parasail_sg_de_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -53176,6 +64080,31 @@ extern parasail_result_t* parasail_sg_de_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -53301,6 +64230,31 @@ extern parasail_result_t* parasail_sg_de_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -53426,6 +64380,31 @@ extern parasail_result_t* parasail_sg_de_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -53551,6 +64530,31 @@ extern parasail_result_t* parasail_sg_de_stats_table_striped_profile_avx2_256_sa
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -53676,6 +64680,31 @@ extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -53801,6 +64830,31 @@ extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_profile_avx2_256_s
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_de_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -53926,6 +64980,31 @@ extern parasail_result_t* parasail_sg_dx_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -54051,6 +65130,31 @@ extern parasail_result_t* parasail_sg_dx_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -54176,6 +65280,31 @@ extern parasail_result_t* parasail_sg_dx_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -54301,6 +65430,31 @@ extern parasail_result_t* parasail_sg_dx_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -54426,6 +65580,31 @@ extern parasail_result_t* parasail_sg_dx_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -54551,6 +65730,31 @@ extern parasail_result_t* parasail_sg_dx_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -54676,6 +65880,31 @@ extern parasail_result_t* parasail_sg_dx_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -54801,6 +66030,31 @@ extern parasail_result_t* parasail_sg_dx_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -54926,6 +66180,31 @@ extern parasail_result_t* parasail_sg_dx_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -55051,6 +66330,31 @@ extern parasail_result_t* parasail_sg_dx_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -55176,6 +66480,31 @@ extern parasail_result_t* parasail_sg_dx_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -55301,6 +66630,31 @@ extern parasail_result_t* parasail_sg_dx_stats_table_striped_profile_avx2_256_sa
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -55426,6 +66780,31 @@ extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -55551,6 +66930,31 @@ extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_profile_avx2_256_s
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_dx_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -55676,6 +67080,31 @@ extern parasail_result_t* parasail_sg_qb_de_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -55801,6 +67230,31 @@ extern parasail_result_t* parasail_sg_qb_de_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -55926,6 +67380,31 @@ extern parasail_result_t* parasail_sg_qb_de_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -56051,6 +67530,31 @@ extern parasail_result_t* parasail_sg_qb_de_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -56176,6 +67680,31 @@ extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -56301,6 +67830,31 @@ extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -56426,6 +67980,31 @@ extern parasail_result_t* parasail_sg_qb_de_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -56551,6 +68130,31 @@ extern parasail_result_t* parasail_sg_qb_de_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -56676,6 +68280,31 @@ extern parasail_result_t* parasail_sg_qb_de_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -56801,6 +68430,31 @@ extern parasail_result_t* parasail_sg_qb_de_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -56926,6 +68580,31 @@ extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_profile_avx2_256_sa
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -57051,6 +68730,31 @@ extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_profile_avx2_256
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -57176,6 +68880,31 @@ extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_profile_avx2_256_s
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -57301,6 +69030,31 @@ extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_profile_avx2_25
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qb_de_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -57426,6 +69180,31 @@ extern parasail_result_t* parasail_sg_qe_db_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -57551,6 +69330,31 @@ extern parasail_result_t* parasail_sg_qe_db_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -57676,6 +69480,31 @@ extern parasail_result_t* parasail_sg_qe_db_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -57801,6 +69630,31 @@ extern parasail_result_t* parasail_sg_qe_db_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -57926,6 +69780,31 @@ extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -58051,6 +69930,31 @@ extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -58176,6 +70080,31 @@ extern parasail_result_t* parasail_sg_qe_db_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -58301,6 +70230,31 @@ extern parasail_result_t* parasail_sg_qe_db_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -58426,6 +70380,31 @@ extern parasail_result_t* parasail_sg_qe_db_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -58551,6 +70530,31 @@ extern parasail_result_t* parasail_sg_qe_db_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -58676,6 +70680,31 @@ extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_profile_avx2_256_sa
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -58801,6 +70830,31 @@ extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_profile_avx2_256
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -58926,6 +70980,31 @@ extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_profile_avx2_256_s
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -59051,6 +71130,31 @@ extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_profile_avx2_25
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_qe_db_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -59191,6 +71295,36 @@ extern parasail_result_t* parasail_sg_flags_scan_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -59341,6 +71475,36 @@ extern parasail_result_t* parasail_sg_flags_striped_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -59491,6 +71655,36 @@ extern parasail_result_t* parasail_sg_flags_table_scan_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -59641,6 +71835,36 @@ extern parasail_result_t* parasail_sg_flags_table_striped_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -59791,6 +72015,36 @@ extern parasail_result_t* parasail_sg_flags_rowcol_scan_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -59941,6 +72195,36 @@ extern parasail_result_t* parasail_sg_flags_rowcol_striped_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -60091,6 +72375,36 @@ extern parasail_result_t* parasail_sg_flags_trace_scan_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_trace_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -60241,6 +72555,36 @@ extern parasail_result_t* parasail_sg_flags_trace_striped_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_trace_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_trace_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -60391,6 +72735,36 @@ extern parasail_result_t* parasail_sg_flags_stats_scan_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -60541,6 +72915,36 @@ extern parasail_result_t* parasail_sg_flags_stats_striped_profile_avx2_256_sat(
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -60691,6 +73095,36 @@ extern parasail_result_t* parasail_sg_flags_stats_table_scan_profile_avx2_256_sa
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -60841,6 +73275,36 @@ extern parasail_result_t* parasail_sg_flags_stats_table_striped_profile_avx2_256
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_table_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -60991,6 +73455,36 @@ extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_profile_avx2_256_s
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -61141,6 +73635,36 @@ extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_profile_avx2_25
         const int open, const int gap,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
+extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end);
+
 extern parasail_result_t* parasail_sg_flags_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -73212,6 +85736,26 @@ extern parasail_profile_t* parasail_profile_create_avx_256_sat(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t* matrix);
 
+extern parasail_profile_t* parasail_profile_create_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
 extern parasail_profile_t* parasail_profile_create_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t* matrix);
@@ -73312,6 +85856,26 @@ extern parasail_profile_t* parasail_profile_create_stats_avx_256_sat(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t* matrix);
 
+extern parasail_profile_t* parasail_profile_create_stats_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
 extern parasail_profile_t* parasail_profile_create_stats_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t* matrix);
@@ -74905,6 +87469,2249 @@ extern parasail_result_t* parasail_sg_flags_stats_rowcol_diag_sat(
         const parasail_matrix_t* matrix,
         int s1_beg, int s1_end, int s2_beg, int s2_end);
 
+extern parasail_result_t* parasail_nw_striped_ws_sse2_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse2_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse2_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse2_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse41_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx2_256_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_neon_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_ws_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse2_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse2_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse2_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse2_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse41_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx2_256_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_neon_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_ws_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse2_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse2_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse2_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse2_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse41_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx2_256_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_altivec_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_altivec_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_neon_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_neon_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_ws_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse2_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse2_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse2_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse2_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse41_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx2_256_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_altivec_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_altivec_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_neon_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_neon_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_ws_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_extend_scan_sse2_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse2_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse2_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse2_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse41_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx2_256_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_neon_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse2_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse2_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse2_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse2_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse41_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx2_256_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx512_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx512_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx512_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_neon_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse2_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse2_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse2_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse2_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse41_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx2_256_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_altivec_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_altivec_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_neon_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_neon_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse2_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse2_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse2_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse2_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse41_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx2_256_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx512_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx512_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx512_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx512_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_avx512_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_altivec_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_altivec_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_neon_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_neon_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_extend_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension);
+
+extern parasail_result_t* parasail_nw_diag_diff_sse2_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_diff_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_sse2_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_avx512_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_avx512_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_diff_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 /* END GENERATED NAMES */
 
 #ifdef __cplusplus
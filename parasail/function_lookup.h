@@ -17,6 +17,7 @@ extern "C" {
 static const parasail_function_info_t functions[] = {
 {parasail_nw,                         "parasail_nw",                         "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_nw_scan,                    "parasail_nw_scan",                    "nw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_nw_bitpar,                  "parasail_nw_bitpar",                  "nw",  "bitpar", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_nw_scan_sse2_128_64,        "parasail_nw_scan_sse2_128_64",        "nw",    "scan", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_nw_scan_sse2_128_32,        "parasail_nw_scan_sse2_128_32",        "nw",    "scan", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -33,6 +34,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_sse2_128_16,        "parasail_nw_diag_sse2_128_16",        "nw",    "diag", "sse2",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_nw_diag_sse2_128_8,         "parasail_nw_diag_sse2_128_8",         "nw",    "diag", "sse2",  "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_nw_diag_sse2_128_sat,       "parasail_nw_diag_sse2_128_sat",       "nw",    "diag", "sse2",  "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_sse2_128_8,    "parasail_nw_diag_diff_sse2_128_8",    "nw",    "diag", "sse2",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_sse2_128_sat,  "parasail_nw_diag_diff_sse2_128_sat",  "nw",    "diag", "sse2",  "128", "sat", 16, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_SSE41
 {parasail_nw_scan_sse41_128_64,       "parasail_nw_scan_sse41_128_64",       "nw",    "scan", "sse41", "128", "64",  2, 0, 0, 0, 0, 0},
@@ -50,6 +53,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_sse41_128_16,       "parasail_nw_diag_sse41_128_16",       "nw",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_nw_diag_sse41_128_8,        "parasail_nw_diag_sse41_128_8",        "nw",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_nw_diag_sse41_128_sat,      "parasail_nw_diag_sse41_128_sat",      "nw",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_sse41_128_8,   "parasail_nw_diag_diff_sse41_128_8",   "nw",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_sse41_128_sat, "parasail_nw_diag_diff_sse41_128_sat", "nw",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_nw_scan_avx2_256_64,        "parasail_nw_scan_avx2_256_64",        "nw",    "scan", "avx2",  "256", "64",  4, 0, 0, 0, 0, 0},
@@ -67,6 +72,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_avx2_256_16,        "parasail_nw_diag_avx2_256_16",        "nw",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {parasail_nw_diag_avx2_256_8,         "parasail_nw_diag_avx2_256_8",         "nw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_nw_diag_avx2_256_sat,       "parasail_nw_diag_avx2_256_sat",       "nw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_avx2_256_8,    "parasail_nw_diag_diff_avx2_256_8",    "nw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_avx2_256_sat,  "parasail_nw_diag_diff_avx2_256_sat",  "nw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_nw_scan_avx512_512_64,      "parasail_nw_scan_avx512_512_64",      "nw",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512_512_32,      "parasail_nw_scan_avx512_512_32",      "nw",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512_512_16,      "parasail_nw_scan_avx512_512_16",      "nw",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512_512_8,       "parasail_nw_scan_avx512_512_8",       "nw",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512_512_sat,     "parasail_nw_scan_avx512_512_sat",     "nw",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_64,   "parasail_nw_striped_avx512_512_64",   "nw", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_32,   "parasail_nw_striped_avx512_512_32",   "nw", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_16,   "parasail_nw_striped_avx512_512_16",   "nw", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_8,    "parasail_nw_striped_avx512_512_8",    "nw", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_sat,  "parasail_nw_striped_avx512_512_sat",  "nw", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_64,      "parasail_nw_diag_avx512_512_64",      "nw",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_32,      "parasail_nw_diag_avx512_512_32",      "nw",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_16,      "parasail_nw_diag_avx512_512_16",      "nw",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_8,       "parasail_nw_diag_avx512_512_8",       "nw",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_sat,     "parasail_nw_diag_avx512_512_sat",     "nw",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_avx512_512_8,  "parasail_nw_diag_diff_avx512_512_8",  "nw",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_avx512_512_sat, "parasail_nw_diag_diff_avx512_512_sat", "nw",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_nw_scan_altivec_128_64,     "parasail_nw_scan_altivec_128_64",     "nw",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
@@ -84,6 +110,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_altivec_128_16,     "parasail_nw_diag_altivec_128_16",     "nw",    "diag", "altivec", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_nw_diag_altivec_128_8,      "parasail_nw_diag_altivec_128_8",      "nw",    "diag", "altivec", "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_nw_diag_altivec_128_sat,    "parasail_nw_diag_altivec_128_sat",    "nw",    "diag", "altivec", "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_altivec_128_8, "parasail_nw_diag_diff_altivec_128_8", "nw",    "diag", "altivec", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_altivec_128_sat, "parasail_nw_diag_diff_altivec_128_sat", "nw",    "diag", "altivec", "128", "sat", 16, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_NEON
 {parasail_nw_scan_neon_128_64,        "parasail_nw_scan_neon_128_64",        "nw",    "scan", "neon",  "128", "64",  2, 0, 0, 0, 0, 0},
@@ -101,24 +129,40 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_neon_128_16,        "parasail_nw_diag_neon_128_16",        "nw",    "diag", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_nw_diag_neon_128_8,         "parasail_nw_diag_neon_128_8",         "nw",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_nw_diag_neon_128_sat,       "parasail_nw_diag_neon_128_sat",       "nw",    "diag", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_neon_128_8,    "parasail_nw_diag_diff_neon_128_8",    "nw",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_neon_128_sat,  "parasail_nw_diag_diff_neon_128_sat",  "nw",    "diag", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
 #endif
 {parasail_nw_scan_64,                 "parasail_nw_scan_64",                 "nw",    "scan", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_nw_scan_32,                 "parasail_nw_scan_32",                 "nw",    "scan", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_nw_scan_16,                 "parasail_nw_scan_16",                 "nw",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_nw_scan_8,                  "parasail_nw_scan_8",                  "nw",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_nw_scan_sat,                "parasail_nw_scan_sat",                "nw",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_nw_scan_auto,               "parasail_nw_scan_auto",               "nw",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_64,              "parasail_nw_striped_64",              "nw", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_32,              "parasail_nw_striped_32",              "nw", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_16,              "parasail_nw_striped_16",              "nw", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_8,               "parasail_nw_striped_8",               "nw", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_sat,             "parasail_nw_striped_sat",             "nw", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_nw_striped_auto,            "parasail_nw_striped_auto",            "nw", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
+{parasail_nw_striped_dna_32,          "parasail_nw_striped_dna_32",          "nw", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_nw_striped_dna_16,          "parasail_nw_striped_dna_16",          "nw", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_nw_striped_dna_8,           "parasail_nw_striped_dna_8",           "nw", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_nw_striped_dna_sat,         "parasail_nw_striped_dna_sat",         "nw", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_nw_hybrid_32,               "parasail_nw_hybrid_32",               "nw",  "hybrid", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_nw_hybrid_16,               "parasail_nw_hybrid_16",               "nw",  "hybrid", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_nw_hybrid_8,                "parasail_nw_hybrid_8",                "nw",  "hybrid", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_nw_hybrid_sat,              "parasail_nw_hybrid_sat",              "nw",  "hybrid", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
 {parasail_nw_diag_64,                 "parasail_nw_diag_64",                 "nw",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_nw_diag_32,                 "parasail_nw_diag_32",                 "nw",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_nw_diag_16,                 "parasail_nw_diag_16",                 "nw",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_nw_diag_8,                  "parasail_nw_diag_8",                  "nw",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_nw_diag_sat,                "parasail_nw_diag_sat",                "nw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_nw_diag_auto,               "parasail_nw_diag_auto",               "nw",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_8,             "parasail_nw_diag_diff_8",             "nw",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_nw_diag_diff_sat,           "parasail_nw_diag_diff_sat",           "nw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
 {parasail_sg,                         "parasail_sg",                         "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_scan,                    "parasail_sg_scan",                    "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_bitpar,                  "parasail_sg_bitpar",                  "sg",  "bitpar", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_scan_sse2_128_64,        "parasail_sg_scan_sse2_128_64",        "sg",    "scan", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_scan_sse2_128_32,        "parasail_sg_scan_sse2_128_32",        "sg",    "scan", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -135,6 +179,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_sse2_128_16,        "parasail_sg_diag_sse2_128_16",        "sg",    "diag", "sse2",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sg_diag_sse2_128_8,         "parasail_sg_diag_sse2_128_8",         "sg",    "diag", "sse2",  "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_sg_diag_sse2_128_sat,       "parasail_sg_diag_sse2_128_sat",       "sg",    "diag", "sse2",  "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_sse2_128_8,    "parasail_sg_diag_diff_sse2_128_8",    "sg",    "diag", "sse2",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_sse2_128_sat,  "parasail_sg_diag_diff_sse2_128_sat",  "sg",    "diag", "sse2",  "128", "sat", 16, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_SSE41
 {parasail_sg_scan_sse41_128_64,       "parasail_sg_scan_sse41_128_64",       "sg",    "scan", "sse41", "128", "64",  2, 0, 0, 0, 0, 0},
@@ -152,6 +198,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_sse41_128_16,       "parasail_sg_diag_sse41_128_16",       "sg",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sg_diag_sse41_128_8,        "parasail_sg_diag_sse41_128_8",        "sg",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_sg_diag_sse41_128_sat,      "parasail_sg_diag_sse41_128_sat",      "sg",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_sse41_128_8,   "parasail_sg_diag_diff_sse41_128_8",   "sg",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_sse41_128_sat, "parasail_sg_diag_diff_sse41_128_sat", "sg",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sg_scan_avx2_256_64,        "parasail_sg_scan_avx2_256_64",        "sg",    "scan", "avx2",  "256", "64",  4, 0, 0, 0, 0, 0},
@@ -169,6 +217,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_avx2_256_16,        "parasail_sg_diag_avx2_256_16",        "sg",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {parasail_sg_diag_avx2_256_8,         "parasail_sg_diag_avx2_256_8",         "sg",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_diag_avx2_256_sat,       "parasail_sg_diag_avx2_256_sat",       "sg",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_avx2_256_8,    "parasail_sg_diag_diff_avx2_256_8",    "sg",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_avx2_256_sat,  "parasail_sg_diag_diff_avx2_256_sat",  "sg",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_sg_scan_avx512_512_64,      "parasail_sg_scan_avx512_512_64",      "sg",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512_512_32,      "parasail_sg_scan_avx512_512_32",      "sg",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512_512_16,      "parasail_sg_scan_avx512_512_16",      "sg",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512_512_8,       "parasail_sg_scan_avx512_512_8",       "sg",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512_512_sat,     "parasail_sg_scan_avx512_512_sat",     "sg",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_64,   "parasail_sg_striped_avx512_512_64",   "sg", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_32,   "parasail_sg_striped_avx512_512_32",   "sg", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_16,   "parasail_sg_striped_avx512_512_16",   "sg", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_8,    "parasail_sg_striped_avx512_512_8",    "sg", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_sat,  "parasail_sg_striped_avx512_512_sat",  "sg", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_64,      "parasail_sg_diag_avx512_512_64",      "sg",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_32,      "parasail_sg_diag_avx512_512_32",      "sg",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_16,      "parasail_sg_diag_avx512_512_16",      "sg",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_8,       "parasail_sg_diag_avx512_512_8",       "sg",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_sat,     "parasail_sg_diag_avx512_512_sat",     "sg",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_avx512_512_8,  "parasail_sg_diag_diff_avx512_512_8",  "sg",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_avx512_512_sat, "parasail_sg_diag_diff_avx512_512_sat", "sg",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_sg_scan_altivec_128_64,     "parasail_sg_scan_altivec_128_64",     "sg",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
@@ -186,6 +255,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_altivec_128_16,     "parasail_sg_diag_altivec_128_16",     "sg",    "diag", "altivec", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sg_diag_altivec_128_8,      "parasail_sg_diag_altivec_128_8",      "sg",    "diag", "altivec", "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_sg_diag_altivec_128_sat,    "parasail_sg_diag_altivec_128_sat",    "sg",    "diag", "altivec", "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_altivec_128_8, "parasail_sg_diag_diff_altivec_128_8", "sg",    "diag", "altivec", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_altivec_128_sat, "parasail_sg_diag_diff_altivec_128_sat", "sg",    "diag", "altivec", "128", "sat", 16, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_NEON
 {parasail_sg_scan_neon_128_64,        "parasail_sg_scan_neon_128_64",        "sg",    "scan", "neon",  "128", "64",  2, 0, 0, 0, 0, 0},
@@ -203,22 +274,37 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_neon_128_16,        "parasail_sg_diag_neon_128_16",        "sg",    "diag", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sg_diag_neon_128_8,         "parasail_sg_diag_neon_128_8",         "sg",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_sg_diag_neon_128_sat,       "parasail_sg_diag_neon_128_sat",       "sg",    "diag", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_neon_128_8,    "parasail_sg_diag_diff_neon_128_8",    "sg",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_neon_128_sat,  "parasail_sg_diag_diff_neon_128_sat",  "sg",    "diag", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
 #endif
 {parasail_sg_scan_64,                 "parasail_sg_scan_64",                 "sg",    "scan", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_scan_32,                 "parasail_sg_scan_32",                 "sg",    "scan", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_scan_16,                 "parasail_sg_scan_16",                 "sg",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_scan_8,                  "parasail_sg_scan_8",                  "sg",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_scan_sat,                "parasail_sg_scan_sat",                "sg",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_scan_auto,               "parasail_sg_scan_auto",               "sg",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_64,              "parasail_sg_striped_64",              "sg", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_32,              "parasail_sg_striped_32",              "sg", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_16,              "parasail_sg_striped_16",              "sg", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_8,               "parasail_sg_striped_8",               "sg", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_sat,             "parasail_sg_striped_sat",             "sg", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_striped_auto,            "parasail_sg_striped_auto",            "sg", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
+{parasail_sg_striped_dna_32,          "parasail_sg_striped_dna_32",          "sg", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_sg_striped_dna_16,          "parasail_sg_striped_dna_16",          "sg", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_sg_striped_dna_8,           "parasail_sg_striped_dna_8",           "sg", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_sg_striped_dna_sat,         "parasail_sg_striped_dna_sat",         "sg", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_hybrid_32,               "parasail_sg_hybrid_32",               "sg",  "hybrid", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_sg_hybrid_16,               "parasail_sg_hybrid_16",               "sg",  "hybrid", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_sg_hybrid_8,                "parasail_sg_hybrid_8",                "sg",  "hybrid", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_sg_hybrid_sat,              "parasail_sg_hybrid_sat",              "sg",  "hybrid", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
 {parasail_sg_diag_64,                 "parasail_sg_diag_64",                 "sg",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_diag_32,                 "parasail_sg_diag_32",                 "sg",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_diag_16,                 "parasail_sg_diag_16",                 "sg",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_diag_8,                  "parasail_sg_diag_8",                  "sg",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_diag_sat,                "parasail_sg_diag_sat",                "sg",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_diag_auto,               "parasail_sg_diag_auto",               "sg",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_8,             "parasail_sg_diag_diff_8",             "sg",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_sg_diag_diff_sat,           "parasail_sg_diag_diff_sat",           "sg",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
 {parasail_sw,                         "parasail_sw",                         "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sw_scan,                    "parasail_sw_scan",                    "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -274,6 +360,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_diag_avx2_256_8,         "parasail_sw_diag_avx2_256_8",         "sw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sw_diag_avx2_256_sat,       "parasail_sw_diag_avx2_256_sat",       "sw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_scan_avx512_512_64,      "parasail_sw_scan_avx512_512_64",      "sw",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512_512_32,      "parasail_sw_scan_avx512_512_32",      "sw",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512_512_16,      "parasail_sw_scan_avx512_512_16",      "sw",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512_512_8,       "parasail_sw_scan_avx512_512_8",       "sw",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512_512_sat,     "parasail_sw_scan_avx512_512_sat",     "sw",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_64,   "parasail_sw_striped_avx512_512_64",   "sw", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_32,   "parasail_sw_striped_avx512_512_32",   "sw", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_16,   "parasail_sw_striped_avx512_512_16",   "sw", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_8,    "parasail_sw_striped_avx512_512_8",    "sw", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_sat,  "parasail_sw_striped_avx512_512_sat",  "sw", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_64,      "parasail_sw_diag_avx512_512_64",      "sw",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_32,      "parasail_sw_diag_avx512_512_32",      "sw",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_16,      "parasail_sw_diag_avx512_512_16",      "sw",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_8,       "parasail_sw_diag_avx512_512_8",       "sw",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_sat,     "parasail_sw_diag_avx512_512_sat",     "sw",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_scan_altivec_128_64,     "parasail_sw_scan_altivec_128_64",     "sw",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sw_scan_altivec_128_32,     "parasail_sw_scan_altivec_128_32",     "sw",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -313,16 +416,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_scan_16,                 "parasail_sw_scan_16",                 "sw",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sw_scan_8,                  "parasail_sw_scan_8",                  "sw",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sw_scan_sat,                "parasail_sw_scan_sat",                "sw",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sw_scan_auto,               "parasail_sw_scan_auto",               "sw",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_64,              "parasail_sw_striped_64",              "sw", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_32,              "parasail_sw_striped_32",              "sw", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_16,              "parasail_sw_striped_16",              "sw", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_8,               "parasail_sw_striped_8",               "sw", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_sat,             "parasail_sw_striped_sat",             "sw", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sw_striped_auto,            "parasail_sw_striped_auto",            "sw", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
+{parasail_sw_striped_dna_32,          "parasail_sw_striped_dna_32",          "sw", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_sw_striped_dna_16,          "parasail_sw_striped_dna_16",          "sw", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_sw_striped_dna_8,           "parasail_sw_striped_dna_8",           "sw", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_sw_striped_dna_sat,         "parasail_sw_striped_dna_sat",         "sw", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sw_hybrid_32,               "parasail_sw_hybrid_32",               "sw",  "hybrid", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_sw_hybrid_16,               "parasail_sw_hybrid_16",               "sw",  "hybrid", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_sw_hybrid_8,                "parasail_sw_hybrid_8",                "sw",  "hybrid", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_sw_hybrid_sat,              "parasail_sw_hybrid_sat",              "sw",  "hybrid", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
 {parasail_sw_diag_64,                 "parasail_sw_diag_64",                 "sw",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sw_diag_32,                 "parasail_sw_diag_32",                 "sw",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sw_diag_16,                 "parasail_sw_diag_16",                 "sw",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sw_diag_8,                  "parasail_sw_diag_8",                  "sw",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sw_diag_sat,                "parasail_sw_diag_sat",                "sw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sw_diag_auto,               "parasail_sw_diag_auto",               "sw",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb,                      "parasail_sg_qb",                      "sg_qb",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_qb_scan,                 "parasail_sg_qb_scan",                 "sg_qb",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -376,6 +490,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_diag_avx2_256_8,      "parasail_sg_qb_diag_avx2_256_8",      "sg_qb",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qb_diag_avx2_256_sat,    "parasail_sg_qb_diag_avx2_256_sat",    "sg_qb",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_scan_avx512_512_64,   "parasail_sg_qb_scan_avx512_512_64",   "sg_qb",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_avx512_512_32,   "parasail_sg_qb_scan_avx512_512_32",   "sg_qb",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_avx512_512_16,   "parasail_sg_qb_scan_avx512_512_16",   "sg_qb",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_avx512_512_8,    "parasail_sg_qb_scan_avx512_512_8",    "sg_qb",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_avx512_512_sat,  "parasail_sg_qb_scan_avx512_512_sat",  "sg_qb",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_64, "parasail_sg_qb_striped_avx512_512_64", "sg_qb", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_32, "parasail_sg_qb_striped_avx512_512_32", "sg_qb", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_16, "parasail_sg_qb_striped_avx512_512_16", "sg_qb", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_8, "parasail_sg_qb_striped_avx512_512_8", "sg_qb", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_sat, "parasail_sg_qb_striped_avx512_512_sat", "sg_qb", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_64,   "parasail_sg_qb_diag_avx512_512_64",   "sg_qb",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_32,   "parasail_sg_qb_diag_avx512_512_32",   "sg_qb",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_16,   "parasail_sg_qb_diag_avx512_512_16",   "sg_qb",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_8,    "parasail_sg_qb_diag_avx512_512_8",    "sg_qb",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_sat,  "parasail_sg_qb_diag_avx512_512_sat",  "sg_qb",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_scan_altivec_128_64,  "parasail_sg_qb_scan_altivec_128_64",  "sg_qb",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qb_scan_altivec_128_32,  "parasail_sg_qb_scan_altivec_128_32",  "sg_qb",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -415,16 +546,19 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_scan_16,              "parasail_sg_qb_scan_16",              "sg_qb",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_scan_8,               "parasail_sg_qb_scan_8",               "sg_qb",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_scan_sat,             "parasail_sg_qb_scan_sat",             "sg_qb",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_auto,            "parasail_sg_qb_scan_auto",            "sg_qb",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_64,           "parasail_sg_qb_striped_64",           "sg_qb", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_32,           "parasail_sg_qb_striped_32",           "sg_qb", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_16,           "parasail_sg_qb_striped_16",           "sg_qb", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_8,            "parasail_sg_qb_striped_8",            "sg_qb", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_sat,          "parasail_sg_qb_striped_sat",          "sg_qb", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_auto,         "parasail_sg_qb_striped_auto",         "sg_qb", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_diag_64,              "parasail_sg_qb_diag_64",              "sg_qb",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_diag_32,              "parasail_sg_qb_diag_32",              "sg_qb",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_diag_16,              "parasail_sg_qb_diag_16",              "sg_qb",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_diag_8,               "parasail_sg_qb_diag_8",               "sg_qb",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_diag_sat,             "parasail_sg_qb_diag_sat",             "sg_qb",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_auto,            "parasail_sg_qb_diag_auto",            "sg_qb",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe,                      "parasail_sg_qe",                      "sg_qe",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_qe_scan,                 "parasail_sg_qe_scan",                 "sg_qe",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -478,6 +612,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_diag_avx2_256_8,      "parasail_sg_qe_diag_avx2_256_8",      "sg_qe",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qe_diag_avx2_256_sat,    "parasail_sg_qe_diag_avx2_256_sat",    "sg_qe",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_scan_avx512_512_64,   "parasail_sg_qe_scan_avx512_512_64",   "sg_qe",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_avx512_512_32,   "parasail_sg_qe_scan_avx512_512_32",   "sg_qe",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_avx512_512_16,   "parasail_sg_qe_scan_avx512_512_16",   "sg_qe",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_avx512_512_8,    "parasail_sg_qe_scan_avx512_512_8",    "sg_qe",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_avx512_512_sat,  "parasail_sg_qe_scan_avx512_512_sat",  "sg_qe",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_64, "parasail_sg_qe_striped_avx512_512_64", "sg_qe", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_32, "parasail_sg_qe_striped_avx512_512_32", "sg_qe", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_16, "parasail_sg_qe_striped_avx512_512_16", "sg_qe", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_8, "parasail_sg_qe_striped_avx512_512_8", "sg_qe", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_sat, "parasail_sg_qe_striped_avx512_512_sat", "sg_qe", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_64,   "parasail_sg_qe_diag_avx512_512_64",   "sg_qe",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_32,   "parasail_sg_qe_diag_avx512_512_32",   "sg_qe",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_16,   "parasail_sg_qe_diag_avx512_512_16",   "sg_qe",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_8,    "parasail_sg_qe_diag_avx512_512_8",    "sg_qe",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_sat,  "parasail_sg_qe_diag_avx512_512_sat",  "sg_qe",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_scan_altivec_128_64,  "parasail_sg_qe_scan_altivec_128_64",  "sg_qe",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qe_scan_altivec_128_32,  "parasail_sg_qe_scan_altivec_128_32",  "sg_qe",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -517,16 +668,19 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_scan_16,              "parasail_sg_qe_scan_16",              "sg_qe",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_scan_8,               "parasail_sg_qe_scan_8",               "sg_qe",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_scan_sat,             "parasail_sg_qe_scan_sat",             "sg_qe",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_auto,            "parasail_sg_qe_scan_auto",            "sg_qe",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_64,           "parasail_sg_qe_striped_64",           "sg_qe", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_32,           "parasail_sg_qe_striped_32",           "sg_qe", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_16,           "parasail_sg_qe_striped_16",           "sg_qe", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_8,            "parasail_sg_qe_striped_8",            "sg_qe", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_sat,          "parasail_sg_qe_striped_sat",          "sg_qe", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_auto,         "parasail_sg_qe_striped_auto",         "sg_qe", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_diag_64,              "parasail_sg_qe_diag_64",              "sg_qe",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_diag_32,              "parasail_sg_qe_diag_32",              "sg_qe",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_diag_16,              "parasail_sg_qe_diag_16",              "sg_qe",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_diag_8,               "parasail_sg_qe_diag_8",               "sg_qe",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_diag_sat,             "parasail_sg_qe_diag_sat",             "sg_qe",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_auto,            "parasail_sg_qe_diag_auto",            "sg_qe",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx,                      "parasail_sg_qx",                      "sg_qx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_qx_scan,                 "parasail_sg_qx_scan",                 "sg_qx",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -580,6 +734,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_diag_avx2_256_8,      "parasail_sg_qx_diag_avx2_256_8",      "sg_qx",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qx_diag_avx2_256_sat,    "parasail_sg_qx_diag_avx2_256_sat",    "sg_qx",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_scan_avx512_512_64,   "parasail_sg_qx_scan_avx512_512_64",   "sg_qx",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_avx512_512_32,   "parasail_sg_qx_scan_avx512_512_32",   "sg_qx",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_avx512_512_16,   "parasail_sg_qx_scan_avx512_512_16",   "sg_qx",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_avx512_512_8,    "parasail_sg_qx_scan_avx512_512_8",    "sg_qx",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_avx512_512_sat,  "parasail_sg_qx_scan_avx512_512_sat",  "sg_qx",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_64, "parasail_sg_qx_striped_avx512_512_64", "sg_qx", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_32, "parasail_sg_qx_striped_avx512_512_32", "sg_qx", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_16, "parasail_sg_qx_striped_avx512_512_16", "sg_qx", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_8, "parasail_sg_qx_striped_avx512_512_8", "sg_qx", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_sat, "parasail_sg_qx_striped_avx512_512_sat", "sg_qx", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_64,   "parasail_sg_qx_diag_avx512_512_64",   "sg_qx",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_32,   "parasail_sg_qx_diag_avx512_512_32",   "sg_qx",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_16,   "parasail_sg_qx_diag_avx512_512_16",   "sg_qx",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_8,    "parasail_sg_qx_diag_avx512_512_8",    "sg_qx",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_sat,  "parasail_sg_qx_diag_avx512_512_sat",  "sg_qx",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_scan_altivec_128_64,  "parasail_sg_qx_scan_altivec_128_64",  "sg_qx",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qx_scan_altivec_128_32,  "parasail_sg_qx_scan_altivec_128_32",  "sg_qx",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -619,16 +790,19 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_scan_16,              "parasail_sg_qx_scan_16",              "sg_qx",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_scan_8,               "parasail_sg_qx_scan_8",               "sg_qx",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_scan_sat,             "parasail_sg_qx_scan_sat",             "sg_qx",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_auto,            "parasail_sg_qx_scan_auto",            "sg_qx",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_64,           "parasail_sg_qx_striped_64",           "sg_qx", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_32,           "parasail_sg_qx_striped_32",           "sg_qx", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_16,           "parasail_sg_qx_striped_16",           "sg_qx", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_8,            "parasail_sg_qx_striped_8",            "sg_qx", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_sat,          "parasail_sg_qx_striped_sat",          "sg_qx", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_auto,         "parasail_sg_qx_striped_auto",         "sg_qx", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_diag_64,              "parasail_sg_qx_diag_64",              "sg_qx",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_diag_32,              "parasail_sg_qx_diag_32",              "sg_qx",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_diag_16,              "parasail_sg_qx_diag_16",              "sg_qx",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_diag_8,               "parasail_sg_qx_diag_8",               "sg_qx",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_diag_sat,             "parasail_sg_qx_diag_sat",             "sg_qx",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_auto,            "parasail_sg_qx_diag_auto",            "sg_qx",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db,                      "parasail_sg_db",                      "sg_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_db_scan,                 "parasail_sg_db_scan",                 "sg_db",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -682,6 +856,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_diag_avx2_256_8,      "parasail_sg_db_diag_avx2_256_8",      "sg_db",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_db_diag_avx2_256_sat,    "parasail_sg_db_diag_avx2_256_sat",    "sg_db",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_scan_avx512_512_64,   "parasail_sg_db_scan_avx512_512_64",   "sg_db",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_avx512_512_32,   "parasail_sg_db_scan_avx512_512_32",   "sg_db",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_avx512_512_16,   "parasail_sg_db_scan_avx512_512_16",   "sg_db",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_avx512_512_8,    "parasail_sg_db_scan_avx512_512_8",    "sg_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_avx512_512_sat,  "parasail_sg_db_scan_avx512_512_sat",  "sg_db",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_64, "parasail_sg_db_striped_avx512_512_64", "sg_db", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_32, "parasail_sg_db_striped_avx512_512_32", "sg_db", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_16, "parasail_sg_db_striped_avx512_512_16", "sg_db", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_8, "parasail_sg_db_striped_avx512_512_8", "sg_db", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_sat, "parasail_sg_db_striped_avx512_512_sat", "sg_db", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_64,   "parasail_sg_db_diag_avx512_512_64",   "sg_db",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_32,   "parasail_sg_db_diag_avx512_512_32",   "sg_db",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_16,   "parasail_sg_db_diag_avx512_512_16",   "sg_db",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_8,    "parasail_sg_db_diag_avx512_512_8",    "sg_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_sat,  "parasail_sg_db_diag_avx512_512_sat",  "sg_db",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_scan_altivec_128_64,  "parasail_sg_db_scan_altivec_128_64",  "sg_db",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_db_scan_altivec_128_32,  "parasail_sg_db_scan_altivec_128_32",  "sg_db",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -721,16 +912,19 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_scan_16,              "parasail_sg_db_scan_16",              "sg_db",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_scan_8,               "parasail_sg_db_scan_8",               "sg_db",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_scan_sat,             "parasail_sg_db_scan_sat",             "sg_db",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_auto,            "parasail_sg_db_scan_auto",            "sg_db",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_64,           "parasail_sg_db_striped_64",           "sg_db", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_32,           "parasail_sg_db_striped_32",           "sg_db", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_16,           "parasail_sg_db_striped_16",           "sg_db", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_8,            "parasail_sg_db_striped_8",            "sg_db", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_sat,          "parasail_sg_db_striped_sat",          "sg_db", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_auto,         "parasail_sg_db_striped_auto",         "sg_db", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_diag_64,              "parasail_sg_db_diag_64",              "sg_db",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_diag_32,              "parasail_sg_db_diag_32",              "sg_db",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_diag_16,              "parasail_sg_db_diag_16",              "sg_db",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_diag_8,               "parasail_sg_db_diag_8",               "sg_db",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_diag_sat,             "parasail_sg_db_diag_sat",             "sg_db",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_auto,            "parasail_sg_db_diag_auto",            "sg_db",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de,                      "parasail_sg_de",                      "sg_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_de_scan,                 "parasail_sg_de_scan",                 "sg_de",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -784,6 +978,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_diag_avx2_256_8,      "parasail_sg_de_diag_avx2_256_8",      "sg_de",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_de_diag_avx2_256_sat,    "parasail_sg_de_diag_avx2_256_sat",    "sg_de",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_scan_avx512_512_64,   "parasail_sg_de_scan_avx512_512_64",   "sg_de",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_avx512_512_32,   "parasail_sg_de_scan_avx512_512_32",   "sg_de",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_avx512_512_16,   "parasail_sg_de_scan_avx512_512_16",   "sg_de",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_avx512_512_8,    "parasail_sg_de_scan_avx512_512_8",    "sg_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_avx512_512_sat,  "parasail_sg_de_scan_avx512_512_sat",  "sg_de",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_64, "parasail_sg_de_striped_avx512_512_64", "sg_de", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_32, "parasail_sg_de_striped_avx512_512_32", "sg_de", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_16, "parasail_sg_de_striped_avx512_512_16", "sg_de", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_8, "parasail_sg_de_striped_avx512_512_8", "sg_de", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_sat, "parasail_sg_de_striped_avx512_512_sat", "sg_de", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_64,   "parasail_sg_de_diag_avx512_512_64",   "sg_de",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_32,   "parasail_sg_de_diag_avx512_512_32",   "sg_de",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_16,   "parasail_sg_de_diag_avx512_512_16",   "sg_de",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_8,    "parasail_sg_de_diag_avx512_512_8",    "sg_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_sat,  "parasail_sg_de_diag_avx512_512_sat",  "sg_de",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_scan_altivec_128_64,  "parasail_sg_de_scan_altivec_128_64",  "sg_de",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_de_scan_altivec_128_32,  "parasail_sg_de_scan_altivec_128_32",  "sg_de",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -823,16 +1034,19 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_scan_16,              "parasail_sg_de_scan_16",              "sg_de",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_scan_8,               "parasail_sg_de_scan_8",               "sg_de",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_scan_sat,             "parasail_sg_de_scan_sat",             "sg_de",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_auto,            "parasail_sg_de_scan_auto",            "sg_de",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_64,           "parasail_sg_de_striped_64",           "sg_de", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_32,           "parasail_sg_de_striped_32",           "sg_de", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_16,           "parasail_sg_de_striped_16",           "sg_de", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_8,            "parasail_sg_de_striped_8",            "sg_de", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_sat,          "parasail_sg_de_striped_sat",          "sg_de", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_auto,         "parasail_sg_de_striped_auto",         "sg_de", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_diag_64,              "parasail_sg_de_diag_64",              "sg_de",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_diag_32,              "parasail_sg_de_diag_32",              "sg_de",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_diag_16,              "parasail_sg_de_diag_16",              "sg_de",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_diag_8,               "parasail_sg_de_diag_8",               "sg_de",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_diag_sat,             "parasail_sg_de_diag_sat",             "sg_de",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_auto,            "parasail_sg_de_diag_auto",            "sg_de",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx,                      "parasail_sg_dx",                      "sg_dx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_dx_scan,                 "parasail_sg_dx_scan",                 "sg_dx",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -886,6 +1100,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_diag_avx2_256_8,      "parasail_sg_dx_diag_avx2_256_8",      "sg_dx",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_dx_diag_avx2_256_sat,    "parasail_sg_dx_diag_avx2_256_sat",    "sg_dx",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_scan_avx512_512_64,   "parasail_sg_dx_scan_avx512_512_64",   "sg_dx",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_avx512_512_32,   "parasail_sg_dx_scan_avx512_512_32",   "sg_dx",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_avx512_512_16,   "parasail_sg_dx_scan_avx512_512_16",   "sg_dx",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_avx512_512_8,    "parasail_sg_dx_scan_avx512_512_8",    "sg_dx",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_avx512_512_sat,  "parasail_sg_dx_scan_avx512_512_sat",  "sg_dx",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_64, "parasail_sg_dx_striped_avx512_512_64", "sg_dx", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_32, "parasail_sg_dx_striped_avx512_512_32", "sg_dx", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_16, "parasail_sg_dx_striped_avx512_512_16", "sg_dx", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_8, "parasail_sg_dx_striped_avx512_512_8", "sg_dx", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_sat, "parasail_sg_dx_striped_avx512_512_sat", "sg_dx", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_64,   "parasail_sg_dx_diag_avx512_512_64",   "sg_dx",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_32,   "parasail_sg_dx_diag_avx512_512_32",   "sg_dx",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_16,   "parasail_sg_dx_diag_avx512_512_16",   "sg_dx",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_8,    "parasail_sg_dx_diag_avx512_512_8",    "sg_dx",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_sat,  "parasail_sg_dx_diag_avx512_512_sat",  "sg_dx",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_scan_altivec_128_64,  "parasail_sg_dx_scan_altivec_128_64",  "sg_dx",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_dx_scan_altivec_128_32,  "parasail_sg_dx_scan_altivec_128_32",  "sg_dx",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -925,16 +1156,19 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_scan_16,              "parasail_sg_dx_scan_16",              "sg_dx",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_scan_8,               "parasail_sg_dx_scan_8",               "sg_dx",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_scan_sat,             "parasail_sg_dx_scan_sat",             "sg_dx",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_auto,            "parasail_sg_dx_scan_auto",            "sg_dx",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_64,           "parasail_sg_dx_striped_64",           "sg_dx", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_32,           "parasail_sg_dx_striped_32",           "sg_dx", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_16,           "parasail_sg_dx_striped_16",           "sg_dx", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_8,            "parasail_sg_dx_striped_8",            "sg_dx", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_sat,          "parasail_sg_dx_striped_sat",          "sg_dx", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_auto,         "parasail_sg_dx_striped_auto",         "sg_dx", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_diag_64,              "parasail_sg_dx_diag_64",              "sg_dx",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_diag_32,              "parasail_sg_dx_diag_32",              "sg_dx",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_diag_16,              "parasail_sg_dx_diag_16",              "sg_dx",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_diag_8,               "parasail_sg_dx_diag_8",               "sg_dx",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_diag_sat,             "parasail_sg_dx_diag_sat",             "sg_dx",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_auto,            "parasail_sg_dx_diag_auto",            "sg_dx",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de,                   "parasail_sg_qb_de",                   "sg_qb_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_qb_de_scan,              "parasail_sg_qb_de_scan",              "sg_qb_de",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -988,6 +1222,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_diag_avx2_256_8,   "parasail_sg_qb_de_diag_avx2_256_8",   "sg_qb_de",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_diag_avx2_256_sat, "parasail_sg_qb_de_diag_avx2_256_sat", "sg_qb_de",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_scan_avx512_512_64, "parasail_sg_qb_de_scan_avx512_512_64", "sg_qb_de",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_avx512_512_32, "parasail_sg_qb_de_scan_avx512_512_32", "sg_qb_de",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_avx512_512_16, "parasail_sg_qb_de_scan_avx512_512_16", "sg_qb_de",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_avx512_512_8, "parasail_sg_qb_de_scan_avx512_512_8", "sg_qb_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_avx512_512_sat, "parasail_sg_qb_de_scan_avx512_512_sat", "sg_qb_de",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_64, "parasail_sg_qb_de_striped_avx512_512_64", "sg_qb_de", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_32, "parasail_sg_qb_de_striped_avx512_512_32", "sg_qb_de", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_16, "parasail_sg_qb_de_striped_avx512_512_16", "sg_qb_de", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_8, "parasail_sg_qb_de_striped_avx512_512_8", "sg_qb_de", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_sat, "parasail_sg_qb_de_striped_avx512_512_sat", "sg_qb_de", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_64, "parasail_sg_qb_de_diag_avx512_512_64", "sg_qb_de",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_32, "parasail_sg_qb_de_diag_avx512_512_32", "sg_qb_de",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_16, "parasail_sg_qb_de_diag_avx512_512_16", "sg_qb_de",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_8, "parasail_sg_qb_de_diag_avx512_512_8", "sg_qb_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_sat, "parasail_sg_qb_de_diag_avx512_512_sat", "sg_qb_de",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_scan_altivec_128_64, "parasail_sg_qb_de_scan_altivec_128_64", "sg_qb_de",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_scan_altivec_128_32, "parasail_sg_qb_de_scan_altivec_128_32", "sg_qb_de",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -1027,16 +1278,19 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_scan_16,           "parasail_sg_qb_de_scan_16",           "sg_qb_de",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_scan_8,            "parasail_sg_qb_de_scan_8",            "sg_qb_de",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_scan_sat,          "parasail_sg_qb_de_scan_sat",          "sg_qb_de",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_auto,         "parasail_sg_qb_de_scan_auto",         "sg_qb_de",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_64,        "parasail_sg_qb_de_striped_64",        "sg_qb_de", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_32,        "parasail_sg_qb_de_striped_32",        "sg_qb_de", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_16,        "parasail_sg_qb_de_striped_16",        "sg_qb_de", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_8,         "parasail_sg_qb_de_striped_8",         "sg_qb_de", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_sat,       "parasail_sg_qb_de_striped_sat",       "sg_qb_de", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_auto,      "parasail_sg_qb_de_striped_auto",      "sg_qb_de", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_diag_64,           "parasail_sg_qb_de_diag_64",           "sg_qb_de",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_diag_32,           "parasail_sg_qb_de_diag_32",           "sg_qb_de",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_diag_16,           "parasail_sg_qb_de_diag_16",           "sg_qb_de",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_diag_8,            "parasail_sg_qb_de_diag_8",            "sg_qb_de",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_diag_sat,          "parasail_sg_qb_de_diag_sat",          "sg_qb_de",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_auto,         "parasail_sg_qb_de_diag_auto",         "sg_qb_de",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db,                   "parasail_sg_qe_db",                   "sg_qe_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_qe_db_scan,              "parasail_sg_qe_db_scan",              "sg_qe_db",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -1090,6 +1344,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_diag_avx2_256_8,   "parasail_sg_qe_db_diag_avx2_256_8",   "sg_qe_db",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_diag_avx2_256_sat, "parasail_sg_qe_db_diag_avx2_256_sat", "sg_qe_db",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_scan_avx512_512_64, "parasail_sg_qe_db_scan_avx512_512_64", "sg_qe_db",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_avx512_512_32, "parasail_sg_qe_db_scan_avx512_512_32", "sg_qe_db",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_avx512_512_16, "parasail_sg_qe_db_scan_avx512_512_16", "sg_qe_db",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_avx512_512_8, "parasail_sg_qe_db_scan_avx512_512_8", "sg_qe_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_avx512_512_sat, "parasail_sg_qe_db_scan_avx512_512_sat", "sg_qe_db",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_64, "parasail_sg_qe_db_striped_avx512_512_64", "sg_qe_db", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_32, "parasail_sg_qe_db_striped_avx512_512_32", "sg_qe_db", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_16, "parasail_sg_qe_db_striped_avx512_512_16", "sg_qe_db", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_8, "parasail_sg_qe_db_striped_avx512_512_8", "sg_qe_db", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_sat, "parasail_sg_qe_db_striped_avx512_512_sat", "sg_qe_db", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_64, "parasail_sg_qe_db_diag_avx512_512_64", "sg_qe_db",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_32, "parasail_sg_qe_db_diag_avx512_512_32", "sg_qe_db",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_16, "parasail_sg_qe_db_diag_avx512_512_16", "sg_qe_db",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_8, "parasail_sg_qe_db_diag_avx512_512_8", "sg_qe_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_sat, "parasail_sg_qe_db_diag_avx512_512_sat", "sg_qe_db",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_scan_altivec_128_64, "parasail_sg_qe_db_scan_altivec_128_64", "sg_qe_db",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_scan_altivec_128_32, "parasail_sg_qe_db_scan_altivec_128_32", "sg_qe_db",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -1129,16 +1400,19 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_scan_16,           "parasail_sg_qe_db_scan_16",           "sg_qe_db",    "scan", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_scan_8,            "parasail_sg_qe_db_scan_8",            "sg_qe_db",    "scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_scan_sat,          "parasail_sg_qe_db_scan_sat",          "sg_qe_db",    "scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_auto,         "parasail_sg_qe_db_scan_auto",         "sg_qe_db",    "scan", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_64,        "parasail_sg_qe_db_striped_64",        "sg_qe_db", "striped", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_32,        "parasail_sg_qe_db_striped_32",        "sg_qe_db", "striped", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_16,        "parasail_sg_qe_db_striped_16",        "sg_qe_db", "striped", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_8,         "parasail_sg_qe_db_striped_8",         "sg_qe_db", "striped", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_sat,       "parasail_sg_qe_db_striped_sat",       "sg_qe_db", "striped", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_auto,      "parasail_sg_qe_db_striped_auto",      "sg_qe_db", "striped", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_diag_64,           "parasail_sg_qe_db_diag_64",           "sg_qe_db",    "diag", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_diag_32,           "parasail_sg_qe_db_diag_32",           "sg_qe_db",    "diag", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_diag_16,           "parasail_sg_qe_db_diag_16",           "sg_qe_db",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_diag_8,            "parasail_sg_qe_db_diag_8",            "sg_qe_db",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_diag_sat,          "parasail_sg_qe_db_diag_sat",          "sg_qe_db",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_auto,         "parasail_sg_qe_db_diag_auto",         "sg_qe_db",    "diag", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_nw_stats,                   "parasail_nw_stats",                   "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
 {parasail_nw_stats_scan,              "parasail_nw_stats_scan",              "nw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
 #if HAVE_SSE2
@@ -1192,6 +1466,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_stats_diag_avx2_256_8,   "parasail_nw_stats_diag_avx2_256_8",   "nw_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_nw_stats_diag_avx2_256_sat, "parasail_nw_stats_diag_avx2_256_sat", "nw_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_scan_avx512_512_64, "parasail_nw_stats_scan_avx512_512_64", "nw_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512_512_32, "parasail_nw_stats_scan_avx512_512_32", "nw_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512_512_16, "parasail_nw_stats_scan_avx512_512_16", "nw_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512_512_8, "parasail_nw_stats_scan_avx512_512_8", "nw_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512_512_sat, "parasail_nw_stats_scan_avx512_512_sat", "nw_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_64, "parasail_nw_stats_striped_avx512_512_64", "nw_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_32, "parasail_nw_stats_striped_avx512_512_32", "nw_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_16, "parasail_nw_stats_striped_avx512_512_16", "nw_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_8, "parasail_nw_stats_striped_avx512_512_8", "nw_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_sat, "parasail_nw_stats_striped_avx512_512_sat", "nw_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_64, "parasail_nw_stats_diag_avx512_512_64", "nw_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_32, "parasail_nw_stats_diag_avx512_512_32", "nw_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_16, "parasail_nw_stats_diag_avx512_512_16", "nw_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_8, "parasail_nw_stats_diag_avx512_512_8", "nw_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_sat, "parasail_nw_stats_diag_avx512_512_sat", "nw_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_scan_altivec_128_64, "parasail_nw_stats_scan_altivec_128_64", "nw_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_nw_stats_scan_altivec_128_32, "parasail_nw_stats_scan_altivec_128_32", "nw_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -1294,6 +1585,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_stats_diag_avx2_256_8,   "parasail_sg_stats_diag_avx2_256_8",   "sg_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_stats_diag_avx2_256_sat, "parasail_sg_stats_diag_avx2_256_sat", "sg_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_scan_avx512_512_64, "parasail_sg_stats_scan_avx512_512_64", "sg_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512_512_32, "parasail_sg_stats_scan_avx512_512_32", "sg_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512_512_16, "parasail_sg_stats_scan_avx512_512_16", "sg_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512_512_8, "parasail_sg_stats_scan_avx512_512_8", "sg_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512_512_sat, "parasail_sg_stats_scan_avx512_512_sat", "sg_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_64, "parasail_sg_stats_striped_avx512_512_64", "sg_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_32, "parasail_sg_stats_striped_avx512_512_32", "sg_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_16, "parasail_sg_stats_striped_avx512_512_16", "sg_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_8, "parasail_sg_stats_striped_avx512_512_8", "sg_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_sat, "parasail_sg_stats_striped_avx512_512_sat", "sg_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_64, "parasail_sg_stats_diag_avx512_512_64", "sg_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_32, "parasail_sg_stats_diag_avx512_512_32", "sg_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_16, "parasail_sg_stats_diag_avx512_512_16", "sg_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_8, "parasail_sg_stats_diag_avx512_512_8", "sg_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_sat, "parasail_sg_stats_diag_avx512_512_sat", "sg_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_scan_altivec_128_64, "parasail_sg_stats_scan_altivec_128_64", "sg_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_stats_scan_altivec_128_32, "parasail_sg_stats_scan_altivec_128_32", "sg_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -1396,6 +1704,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_stats_diag_avx2_256_8,   "parasail_sw_stats_diag_avx2_256_8",   "sw_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sw_stats_diag_avx2_256_sat, "parasail_sw_stats_diag_avx2_256_sat", "sw_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_scan_avx512_512_64, "parasail_sw_stats_scan_avx512_512_64", "sw_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512_512_32, "parasail_sw_stats_scan_avx512_512_32", "sw_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512_512_16, "parasail_sw_stats_scan_avx512_512_16", "sw_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512_512_8, "parasail_sw_stats_scan_avx512_512_8", "sw_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512_512_sat, "parasail_sw_stats_scan_avx512_512_sat", "sw_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_64, "parasail_sw_stats_striped_avx512_512_64", "sw_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_32, "parasail_sw_stats_striped_avx512_512_32", "sw_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_16, "parasail_sw_stats_striped_avx512_512_16", "sw_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_8, "parasail_sw_stats_striped_avx512_512_8", "sw_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_sat, "parasail_sw_stats_striped_avx512_512_sat", "sw_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_64, "parasail_sw_stats_diag_avx512_512_64", "sw_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_32, "parasail_sw_stats_diag_avx512_512_32", "sw_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_16, "parasail_sw_stats_diag_avx512_512_16", "sw_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_8, "parasail_sw_stats_diag_avx512_512_8", "sw_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_sat, "parasail_sw_stats_diag_avx512_512_sat", "sw_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_scan_altivec_128_64, "parasail_sw_stats_scan_altivec_128_64", "sw_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sw_stats_scan_altivec_128_32, "parasail_sw_stats_scan_altivec_128_32", "sw_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -1498,6 +1823,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_stats_diag_avx2_256_8, "parasail_sg_qb_stats_diag_avx2_256_8", "sg_qb_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qb_stats_diag_avx2_256_sat, "parasail_sg_qb_stats_diag_avx2_256_sat", "sg_qb_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_stats_scan_avx512_512_64, "parasail_sg_qb_stats_scan_avx512_512_64", "sg_qb_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_avx512_512_32, "parasail_sg_qb_stats_scan_avx512_512_32", "sg_qb_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_avx512_512_16, "parasail_sg_qb_stats_scan_avx512_512_16", "sg_qb_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_avx512_512_8, "parasail_sg_qb_stats_scan_avx512_512_8", "sg_qb_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_avx512_512_sat, "parasail_sg_qb_stats_scan_avx512_512_sat", "sg_qb_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_64, "parasail_sg_qb_stats_striped_avx512_512_64", "sg_qb_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_32, "parasail_sg_qb_stats_striped_avx512_512_32", "sg_qb_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_16, "parasail_sg_qb_stats_striped_avx512_512_16", "sg_qb_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_8, "parasail_sg_qb_stats_striped_avx512_512_8", "sg_qb_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_sat, "parasail_sg_qb_stats_striped_avx512_512_sat", "sg_qb_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_64, "parasail_sg_qb_stats_diag_avx512_512_64", "sg_qb_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_32, "parasail_sg_qb_stats_diag_avx512_512_32", "sg_qb_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_16, "parasail_sg_qb_stats_diag_avx512_512_16", "sg_qb_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_8, "parasail_sg_qb_stats_diag_avx512_512_8", "sg_qb_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_sat, "parasail_sg_qb_stats_diag_avx512_512_sat", "sg_qb_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_stats_scan_altivec_128_64, "parasail_sg_qb_stats_scan_altivec_128_64", "sg_qb_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qb_stats_scan_altivec_128_32, "parasail_sg_qb_stats_scan_altivec_128_32", "sg_qb_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -1600,6 +1942,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_stats_diag_avx2_256_8, "parasail_sg_qe_stats_diag_avx2_256_8", "sg_qe_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qe_stats_diag_avx2_256_sat, "parasail_sg_qe_stats_diag_avx2_256_sat", "sg_qe_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_stats_scan_avx512_512_64, "parasail_sg_qe_stats_scan_avx512_512_64", "sg_qe_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_avx512_512_32, "parasail_sg_qe_stats_scan_avx512_512_32", "sg_qe_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_avx512_512_16, "parasail_sg_qe_stats_scan_avx512_512_16", "sg_qe_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_avx512_512_8, "parasail_sg_qe_stats_scan_avx512_512_8", "sg_qe_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_avx512_512_sat, "parasail_sg_qe_stats_scan_avx512_512_sat", "sg_qe_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_64, "parasail_sg_qe_stats_striped_avx512_512_64", "sg_qe_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_32, "parasail_sg_qe_stats_striped_avx512_512_32", "sg_qe_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_16, "parasail_sg_qe_stats_striped_avx512_512_16", "sg_qe_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_8, "parasail_sg_qe_stats_striped_avx512_512_8", "sg_qe_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_sat, "parasail_sg_qe_stats_striped_avx512_512_sat", "sg_qe_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_64, "parasail_sg_qe_stats_diag_avx512_512_64", "sg_qe_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_32, "parasail_sg_qe_stats_diag_avx512_512_32", "sg_qe_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_16, "parasail_sg_qe_stats_diag_avx512_512_16", "sg_qe_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_8, "parasail_sg_qe_stats_diag_avx512_512_8", "sg_qe_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_sat, "parasail_sg_qe_stats_diag_avx512_512_sat", "sg_qe_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_stats_scan_altivec_128_64, "parasail_sg_qe_stats_scan_altivec_128_64", "sg_qe_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qe_stats_scan_altivec_128_32, "parasail_sg_qe_stats_scan_altivec_128_32", "sg_qe_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -1702,6 +2061,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_stats_diag_avx2_256_8, "parasail_sg_qx_stats_diag_avx2_256_8", "sg_qx_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qx_stats_diag_avx2_256_sat, "parasail_sg_qx_stats_diag_avx2_256_sat", "sg_qx_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_stats_scan_avx512_512_64, "parasail_sg_qx_stats_scan_avx512_512_64", "sg_qx_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_avx512_512_32, "parasail_sg_qx_stats_scan_avx512_512_32", "sg_qx_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_avx512_512_16, "parasail_sg_qx_stats_scan_avx512_512_16", "sg_qx_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_avx512_512_8, "parasail_sg_qx_stats_scan_avx512_512_8", "sg_qx_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_avx512_512_sat, "parasail_sg_qx_stats_scan_avx512_512_sat", "sg_qx_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_64, "parasail_sg_qx_stats_striped_avx512_512_64", "sg_qx_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_32, "parasail_sg_qx_stats_striped_avx512_512_32", "sg_qx_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_16, "parasail_sg_qx_stats_striped_avx512_512_16", "sg_qx_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_8, "parasail_sg_qx_stats_striped_avx512_512_8", "sg_qx_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_sat, "parasail_sg_qx_stats_striped_avx512_512_sat", "sg_qx_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_64, "parasail_sg_qx_stats_diag_avx512_512_64", "sg_qx_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_32, "parasail_sg_qx_stats_diag_avx512_512_32", "sg_qx_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_16, "parasail_sg_qx_stats_diag_avx512_512_16", "sg_qx_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_8, "parasail_sg_qx_stats_diag_avx512_512_8", "sg_qx_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_sat, "parasail_sg_qx_stats_diag_avx512_512_sat", "sg_qx_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_stats_scan_altivec_128_64, "parasail_sg_qx_stats_scan_altivec_128_64", "sg_qx_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qx_stats_scan_altivec_128_32, "parasail_sg_qx_stats_scan_altivec_128_32", "sg_qx_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -1804,6 +2180,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_stats_diag_avx2_256_8, "parasail_sg_db_stats_diag_avx2_256_8", "sg_db_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_db_stats_diag_avx2_256_sat, "parasail_sg_db_stats_diag_avx2_256_sat", "sg_db_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_stats_scan_avx512_512_64, "parasail_sg_db_stats_scan_avx512_512_64", "sg_db_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_avx512_512_32, "parasail_sg_db_stats_scan_avx512_512_32", "sg_db_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_avx512_512_16, "parasail_sg_db_stats_scan_avx512_512_16", "sg_db_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_avx512_512_8, "parasail_sg_db_stats_scan_avx512_512_8", "sg_db_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_avx512_512_sat, "parasail_sg_db_stats_scan_avx512_512_sat", "sg_db_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_64, "parasail_sg_db_stats_striped_avx512_512_64", "sg_db_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_32, "parasail_sg_db_stats_striped_avx512_512_32", "sg_db_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_16, "parasail_sg_db_stats_striped_avx512_512_16", "sg_db_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_8, "parasail_sg_db_stats_striped_avx512_512_8", "sg_db_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_sat, "parasail_sg_db_stats_striped_avx512_512_sat", "sg_db_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_64, "parasail_sg_db_stats_diag_avx512_512_64", "sg_db_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_32, "parasail_sg_db_stats_diag_avx512_512_32", "sg_db_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_16, "parasail_sg_db_stats_diag_avx512_512_16", "sg_db_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_8, "parasail_sg_db_stats_diag_avx512_512_8", "sg_db_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_sat, "parasail_sg_db_stats_diag_avx512_512_sat", "sg_db_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_stats_scan_altivec_128_64, "parasail_sg_db_stats_scan_altivec_128_64", "sg_db_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_db_stats_scan_altivec_128_32, "parasail_sg_db_stats_scan_altivec_128_32", "sg_db_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -1906,6 +2299,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_stats_diag_avx2_256_8, "parasail_sg_de_stats_diag_avx2_256_8", "sg_de_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_de_stats_diag_avx2_256_sat, "parasail_sg_de_stats_diag_avx2_256_sat", "sg_de_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_stats_scan_avx512_512_64, "parasail_sg_de_stats_scan_avx512_512_64", "sg_de_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_avx512_512_32, "parasail_sg_de_stats_scan_avx512_512_32", "sg_de_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_avx512_512_16, "parasail_sg_de_stats_scan_avx512_512_16", "sg_de_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_avx512_512_8, "parasail_sg_de_stats_scan_avx512_512_8", "sg_de_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_avx512_512_sat, "parasail_sg_de_stats_scan_avx512_512_sat", "sg_de_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_64, "parasail_sg_de_stats_striped_avx512_512_64", "sg_de_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_32, "parasail_sg_de_stats_striped_avx512_512_32", "sg_de_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_16, "parasail_sg_de_stats_striped_avx512_512_16", "sg_de_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_8, "parasail_sg_de_stats_striped_avx512_512_8", "sg_de_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_sat, "parasail_sg_de_stats_striped_avx512_512_sat", "sg_de_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_64, "parasail_sg_de_stats_diag_avx512_512_64", "sg_de_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_32, "parasail_sg_de_stats_diag_avx512_512_32", "sg_de_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_16, "parasail_sg_de_stats_diag_avx512_512_16", "sg_de_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_8, "parasail_sg_de_stats_diag_avx512_512_8", "sg_de_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_sat, "parasail_sg_de_stats_diag_avx512_512_sat", "sg_de_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_stats_scan_altivec_128_64, "parasail_sg_de_stats_scan_altivec_128_64", "sg_de_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_de_stats_scan_altivec_128_32, "parasail_sg_de_stats_scan_altivec_128_32", "sg_de_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -2008,6 +2418,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_stats_diag_avx2_256_8, "parasail_sg_dx_stats_diag_avx2_256_8", "sg_dx_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_dx_stats_diag_avx2_256_sat, "parasail_sg_dx_stats_diag_avx2_256_sat", "sg_dx_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_stats_scan_avx512_512_64, "parasail_sg_dx_stats_scan_avx512_512_64", "sg_dx_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_avx512_512_32, "parasail_sg_dx_stats_scan_avx512_512_32", "sg_dx_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_avx512_512_16, "parasail_sg_dx_stats_scan_avx512_512_16", "sg_dx_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_avx512_512_8, "parasail_sg_dx_stats_scan_avx512_512_8", "sg_dx_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_avx512_512_sat, "parasail_sg_dx_stats_scan_avx512_512_sat", "sg_dx_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_64, "parasail_sg_dx_stats_striped_avx512_512_64", "sg_dx_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_32, "parasail_sg_dx_stats_striped_avx512_512_32", "sg_dx_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_16, "parasail_sg_dx_stats_striped_avx512_512_16", "sg_dx_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_8, "parasail_sg_dx_stats_striped_avx512_512_8", "sg_dx_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_sat, "parasail_sg_dx_stats_striped_avx512_512_sat", "sg_dx_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_64, "parasail_sg_dx_stats_diag_avx512_512_64", "sg_dx_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_32, "parasail_sg_dx_stats_diag_avx512_512_32", "sg_dx_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_16, "parasail_sg_dx_stats_diag_avx512_512_16", "sg_dx_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_8, "parasail_sg_dx_stats_diag_avx512_512_8", "sg_dx_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_sat, "parasail_sg_dx_stats_diag_avx512_512_sat", "sg_dx_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_stats_scan_altivec_128_64, "parasail_sg_dx_stats_scan_altivec_128_64", "sg_dx_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_dx_stats_scan_altivec_128_32, "parasail_sg_dx_stats_scan_altivec_128_32", "sg_dx_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -2110,6 +2537,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_stats_diag_avx2_256_8, "parasail_sg_qb_de_stats_diag_avx2_256_8", "sg_qb_de_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qb_de_stats_diag_avx2_256_sat, "parasail_sg_qb_de_stats_diag_avx2_256_sat", "sg_qb_de_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_stats_scan_avx512_512_64, "parasail_sg_qb_de_stats_scan_avx512_512_64", "sg_qb_de_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_avx512_512_32, "parasail_sg_qb_de_stats_scan_avx512_512_32", "sg_qb_de_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_avx512_512_16, "parasail_sg_qb_de_stats_scan_avx512_512_16", "sg_qb_de_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_avx512_512_8, "parasail_sg_qb_de_stats_scan_avx512_512_8", "sg_qb_de_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_avx512_512_sat, "parasail_sg_qb_de_stats_scan_avx512_512_sat", "sg_qb_de_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_64, "parasail_sg_qb_de_stats_striped_avx512_512_64", "sg_qb_de_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_32, "parasail_sg_qb_de_stats_striped_avx512_512_32", "sg_qb_de_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_16, "parasail_sg_qb_de_stats_striped_avx512_512_16", "sg_qb_de_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_8, "parasail_sg_qb_de_stats_striped_avx512_512_8", "sg_qb_de_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_sat, "parasail_sg_qb_de_stats_striped_avx512_512_sat", "sg_qb_de_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_64, "parasail_sg_qb_de_stats_diag_avx512_512_64", "sg_qb_de_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_32, "parasail_sg_qb_de_stats_diag_avx512_512_32", "sg_qb_de_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_16, "parasail_sg_qb_de_stats_diag_avx512_512_16", "sg_qb_de_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_8, "parasail_sg_qb_de_stats_diag_avx512_512_8", "sg_qb_de_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_sat, "parasail_sg_qb_de_stats_diag_avx512_512_sat", "sg_qb_de_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_stats_scan_altivec_128_64, "parasail_sg_qb_de_stats_scan_altivec_128_64", "sg_qb_de_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qb_de_stats_scan_altivec_128_32, "parasail_sg_qb_de_stats_scan_altivec_128_32", "sg_qb_de_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -2212,6 +2656,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_stats_diag_avx2_256_8, "parasail_sg_qe_db_stats_diag_avx2_256_8", "sg_qe_db_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qe_db_stats_diag_avx2_256_sat, "parasail_sg_qe_db_stats_diag_avx2_256_sat", "sg_qe_db_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_stats_scan_avx512_512_64, "parasail_sg_qe_db_stats_scan_avx512_512_64", "sg_qe_db_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_avx512_512_32, "parasail_sg_qe_db_stats_scan_avx512_512_32", "sg_qe_db_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_avx512_512_16, "parasail_sg_qe_db_stats_scan_avx512_512_16", "sg_qe_db_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_avx512_512_8, "parasail_sg_qe_db_stats_scan_avx512_512_8", "sg_qe_db_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_avx512_512_sat, "parasail_sg_qe_db_stats_scan_avx512_512_sat", "sg_qe_db_stats",    "scan", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_64, "parasail_sg_qe_db_stats_striped_avx512_512_64", "sg_qe_db_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_32, "parasail_sg_qe_db_stats_striped_avx512_512_32", "sg_qe_db_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_16, "parasail_sg_qe_db_stats_striped_avx512_512_16", "sg_qe_db_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_8, "parasail_sg_qe_db_stats_striped_avx512_512_8", "sg_qe_db_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_sat, "parasail_sg_qe_db_stats_striped_avx512_512_sat", "sg_qe_db_stats", "striped", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_64, "parasail_sg_qe_db_stats_diag_avx512_512_64", "sg_qe_db_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_32, "parasail_sg_qe_db_stats_diag_avx512_512_32", "sg_qe_db_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_16, "parasail_sg_qe_db_stats_diag_avx512_512_16", "sg_qe_db_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_8, "parasail_sg_qe_db_stats_diag_avx512_512_8", "sg_qe_db_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_sat, "parasail_sg_qe_db_stats_diag_avx512_512_sat", "sg_qe_db_stats",    "diag", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_stats_scan_altivec_128_64, "parasail_sg_qe_db_stats_scan_altivec_128_64", "sg_qe_db_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qe_db_stats_scan_altivec_128_32, "parasail_sg_qe_db_stats_scan_altivec_128_32", "sg_qe_db_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -2314,6 +2775,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_table_diag_avx2_256_8,   "parasail_nw_table_diag_avx2_256_8",   "nw",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_avx2_256_sat, "parasail_nw_table_diag_avx2_256_sat", "nw",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_table_scan_avx512_512_64, "parasail_nw_table_scan_avx512_512_64", "nw",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512_512_32, "parasail_nw_table_scan_avx512_512_32", "nw",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512_512_16, "parasail_nw_table_scan_avx512_512_16", "nw",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512_512_8, "parasail_nw_table_scan_avx512_512_8", "nw",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512_512_sat, "parasail_nw_table_scan_avx512_512_sat", "nw",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_64, "parasail_nw_table_striped_avx512_512_64", "nw", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_32, "parasail_nw_table_striped_avx512_512_32", "nw", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_16, "parasail_nw_table_striped_avx512_512_16", "nw", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_8, "parasail_nw_table_striped_avx512_512_8", "nw", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_sat, "parasail_nw_table_striped_avx512_512_sat", "nw", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_64, "parasail_nw_table_diag_avx512_512_64", "nw",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_32, "parasail_nw_table_diag_avx512_512_32", "nw",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_16, "parasail_nw_table_diag_avx512_512_16", "nw",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_8, "parasail_nw_table_diag_avx512_512_8", "nw",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_sat, "parasail_nw_table_diag_avx512_512_sat", "nw",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_table_scan_altivec_128_64, "parasail_nw_table_scan_altivec_128_64", "nw",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_nw_table_scan_altivec_128_32, "parasail_nw_table_scan_altivec_128_32", "nw",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2416,6 +2894,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_table_diag_avx2_256_8,   "parasail_sg_table_diag_avx2_256_8",   "sg",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_avx2_256_sat, "parasail_sg_table_diag_avx2_256_sat", "sg",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_table_scan_avx512_512_64, "parasail_sg_table_scan_avx512_512_64", "sg",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512_512_32, "parasail_sg_table_scan_avx512_512_32", "sg",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512_512_16, "parasail_sg_table_scan_avx512_512_16", "sg",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512_512_8, "parasail_sg_table_scan_avx512_512_8", "sg",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512_512_sat, "parasail_sg_table_scan_avx512_512_sat", "sg",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_64, "parasail_sg_table_striped_avx512_512_64", "sg", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_32, "parasail_sg_table_striped_avx512_512_32", "sg", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_16, "parasail_sg_table_striped_avx512_512_16", "sg", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_8, "parasail_sg_table_striped_avx512_512_8", "sg", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_sat, "parasail_sg_table_striped_avx512_512_sat", "sg", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_64, "parasail_sg_table_diag_avx512_512_64", "sg",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_32, "parasail_sg_table_diag_avx512_512_32", "sg",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_16, "parasail_sg_table_diag_avx512_512_16", "sg",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_8, "parasail_sg_table_diag_avx512_512_8", "sg",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_sat, "parasail_sg_table_diag_avx512_512_sat", "sg",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_table_scan_altivec_128_64, "parasail_sg_table_scan_altivec_128_64", "sg",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_table_scan_altivec_128_32, "parasail_sg_table_scan_altivec_128_32", "sg",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2520,6 +3015,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_table_diag_avx2_256_8,   "parasail_sw_table_diag_avx2_256_8",   "sw",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_avx2_256_sat, "parasail_sw_table_diag_avx2_256_sat", "sw",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_table_scan_avx512_512_64, "parasail_sw_table_scan_avx512_512_64", "sw",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512_512_32, "parasail_sw_table_scan_avx512_512_32", "sw",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512_512_16, "parasail_sw_table_scan_avx512_512_16", "sw",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512_512_8, "parasail_sw_table_scan_avx512_512_8", "sw",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512_512_sat, "parasail_sw_table_scan_avx512_512_sat", "sw",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_64, "parasail_sw_table_striped_avx512_512_64", "sw", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_32, "parasail_sw_table_striped_avx512_512_32", "sw", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_16, "parasail_sw_table_striped_avx512_512_16", "sw", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_8, "parasail_sw_table_striped_avx512_512_8", "sw", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_sat, "parasail_sw_table_striped_avx512_512_sat", "sw", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_64, "parasail_sw_table_diag_avx512_512_64", "sw",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_32, "parasail_sw_table_diag_avx512_512_32", "sw",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_16, "parasail_sw_table_diag_avx512_512_16", "sw",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_8, "parasail_sw_table_diag_avx512_512_8", "sw",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_sat, "parasail_sw_table_diag_avx512_512_sat", "sw",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_table_scan_altivec_128_64, "parasail_sw_table_scan_altivec_128_64", "sw",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sw_table_scan_altivec_128_32, "parasail_sw_table_scan_altivec_128_32", "sw",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2622,6 +3134,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_table_diag_avx2_256_8, "parasail_sg_qb_table_diag_avx2_256_8", "sg_qb",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qb_table_diag_avx2_256_sat, "parasail_sg_qb_table_diag_avx2_256_sat", "sg_qb",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_table_scan_avx512_512_64, "parasail_sg_qb_table_scan_avx512_512_64", "sg_qb",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_avx512_512_32, "parasail_sg_qb_table_scan_avx512_512_32", "sg_qb",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_avx512_512_16, "parasail_sg_qb_table_scan_avx512_512_16", "sg_qb",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_avx512_512_8, "parasail_sg_qb_table_scan_avx512_512_8", "sg_qb",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_avx512_512_sat, "parasail_sg_qb_table_scan_avx512_512_sat", "sg_qb",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_64, "parasail_sg_qb_table_striped_avx512_512_64", "sg_qb", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_32, "parasail_sg_qb_table_striped_avx512_512_32", "sg_qb", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_16, "parasail_sg_qb_table_striped_avx512_512_16", "sg_qb", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_8, "parasail_sg_qb_table_striped_avx512_512_8", "sg_qb", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_sat, "parasail_sg_qb_table_striped_avx512_512_sat", "sg_qb", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_64, "parasail_sg_qb_table_diag_avx512_512_64", "sg_qb",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_32, "parasail_sg_qb_table_diag_avx512_512_32", "sg_qb",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_16, "parasail_sg_qb_table_diag_avx512_512_16", "sg_qb",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_8, "parasail_sg_qb_table_diag_avx512_512_8", "sg_qb",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_sat, "parasail_sg_qb_table_diag_avx512_512_sat", "sg_qb",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_table_scan_altivec_128_64, "parasail_sg_qb_table_scan_altivec_128_64", "sg_qb",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qb_table_scan_altivec_128_32, "parasail_sg_qb_table_scan_altivec_128_32", "sg_qb",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2724,6 +3253,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_table_diag_avx2_256_8, "parasail_sg_qe_table_diag_avx2_256_8", "sg_qe",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qe_table_diag_avx2_256_sat, "parasail_sg_qe_table_diag_avx2_256_sat", "sg_qe",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_table_scan_avx512_512_64, "parasail_sg_qe_table_scan_avx512_512_64", "sg_qe",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_avx512_512_32, "parasail_sg_qe_table_scan_avx512_512_32", "sg_qe",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_avx512_512_16, "parasail_sg_qe_table_scan_avx512_512_16", "sg_qe",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_avx512_512_8, "parasail_sg_qe_table_scan_avx512_512_8", "sg_qe",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_avx512_512_sat, "parasail_sg_qe_table_scan_avx512_512_sat", "sg_qe",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_64, "parasail_sg_qe_table_striped_avx512_512_64", "sg_qe", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_32, "parasail_sg_qe_table_striped_avx512_512_32", "sg_qe", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_16, "parasail_sg_qe_table_striped_avx512_512_16", "sg_qe", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_8, "parasail_sg_qe_table_striped_avx512_512_8", "sg_qe", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_sat, "parasail_sg_qe_table_striped_avx512_512_sat", "sg_qe", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_64, "parasail_sg_qe_table_diag_avx512_512_64", "sg_qe",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_32, "parasail_sg_qe_table_diag_avx512_512_32", "sg_qe",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_16, "parasail_sg_qe_table_diag_avx512_512_16", "sg_qe",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_8, "parasail_sg_qe_table_diag_avx512_512_8", "sg_qe",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_sat, "parasail_sg_qe_table_diag_avx512_512_sat", "sg_qe",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_table_scan_altivec_128_64, "parasail_sg_qe_table_scan_altivec_128_64", "sg_qe",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qe_table_scan_altivec_128_32, "parasail_sg_qe_table_scan_altivec_128_32", "sg_qe",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2826,6 +3372,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_table_diag_avx2_256_8, "parasail_sg_qx_table_diag_avx2_256_8", "sg_qx",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qx_table_diag_avx2_256_sat, "parasail_sg_qx_table_diag_avx2_256_sat", "sg_qx",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_table_scan_avx512_512_64, "parasail_sg_qx_table_scan_avx512_512_64", "sg_qx",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_avx512_512_32, "parasail_sg_qx_table_scan_avx512_512_32", "sg_qx",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_avx512_512_16, "parasail_sg_qx_table_scan_avx512_512_16", "sg_qx",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_avx512_512_8, "parasail_sg_qx_table_scan_avx512_512_8", "sg_qx",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_avx512_512_sat, "parasail_sg_qx_table_scan_avx512_512_sat", "sg_qx",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_64, "parasail_sg_qx_table_striped_avx512_512_64", "sg_qx", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_32, "parasail_sg_qx_table_striped_avx512_512_32", "sg_qx", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_16, "parasail_sg_qx_table_striped_avx512_512_16", "sg_qx", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_8, "parasail_sg_qx_table_striped_avx512_512_8", "sg_qx", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_sat, "parasail_sg_qx_table_striped_avx512_512_sat", "sg_qx", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_64, "parasail_sg_qx_table_diag_avx512_512_64", "sg_qx",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_32, "parasail_sg_qx_table_diag_avx512_512_32", "sg_qx",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_16, "parasail_sg_qx_table_diag_avx512_512_16", "sg_qx",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_8, "parasail_sg_qx_table_diag_avx512_512_8", "sg_qx",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_sat, "parasail_sg_qx_table_diag_avx512_512_sat", "sg_qx",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_table_scan_altivec_128_64, "parasail_sg_qx_table_scan_altivec_128_64", "sg_qx",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qx_table_scan_altivec_128_32, "parasail_sg_qx_table_scan_altivec_128_32", "sg_qx",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2928,6 +3491,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_table_diag_avx2_256_8, "parasail_sg_db_table_diag_avx2_256_8", "sg_db",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_db_table_diag_avx2_256_sat, "parasail_sg_db_table_diag_avx2_256_sat", "sg_db",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_table_scan_avx512_512_64, "parasail_sg_db_table_scan_avx512_512_64", "sg_db",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_avx512_512_32, "parasail_sg_db_table_scan_avx512_512_32", "sg_db",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_avx512_512_16, "parasail_sg_db_table_scan_avx512_512_16", "sg_db",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_avx512_512_8, "parasail_sg_db_table_scan_avx512_512_8", "sg_db",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_avx512_512_sat, "parasail_sg_db_table_scan_avx512_512_sat", "sg_db",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_64, "parasail_sg_db_table_striped_avx512_512_64", "sg_db", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_32, "parasail_sg_db_table_striped_avx512_512_32", "sg_db", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_16, "parasail_sg_db_table_striped_avx512_512_16", "sg_db", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_8, "parasail_sg_db_table_striped_avx512_512_8", "sg_db", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_sat, "parasail_sg_db_table_striped_avx512_512_sat", "sg_db", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_64, "parasail_sg_db_table_diag_avx512_512_64", "sg_db",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_32, "parasail_sg_db_table_diag_avx512_512_32", "sg_db",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_16, "parasail_sg_db_table_diag_avx512_512_16", "sg_db",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_8, "parasail_sg_db_table_diag_avx512_512_8", "sg_db",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_sat, "parasail_sg_db_table_diag_avx512_512_sat", "sg_db",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_table_scan_altivec_128_64, "parasail_sg_db_table_scan_altivec_128_64", "sg_db",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_db_table_scan_altivec_128_32, "parasail_sg_db_table_scan_altivec_128_32", "sg_db",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -3030,6 +3610,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_table_diag_avx2_256_8, "parasail_sg_de_table_diag_avx2_256_8", "sg_de",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_de_table_diag_avx2_256_sat, "parasail_sg_de_table_diag_avx2_256_sat", "sg_de",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_table_scan_avx512_512_64, "parasail_sg_de_table_scan_avx512_512_64", "sg_de",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_avx512_512_32, "parasail_sg_de_table_scan_avx512_512_32", "sg_de",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_avx512_512_16, "parasail_sg_de_table_scan_avx512_512_16", "sg_de",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_avx512_512_8, "parasail_sg_de_table_scan_avx512_512_8", "sg_de",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_avx512_512_sat, "parasail_sg_de_table_scan_avx512_512_sat", "sg_de",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_64, "parasail_sg_de_table_striped_avx512_512_64", "sg_de", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_32, "parasail_sg_de_table_striped_avx512_512_32", "sg_de", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_16, "parasail_sg_de_table_striped_avx512_512_16", "sg_de", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_8, "parasail_sg_de_table_striped_avx512_512_8", "sg_de", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_sat, "parasail_sg_de_table_striped_avx512_512_sat", "sg_de", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_64, "parasail_sg_de_table_diag_avx512_512_64", "sg_de",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_32, "parasail_sg_de_table_diag_avx512_512_32", "sg_de",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_16, "parasail_sg_de_table_diag_avx512_512_16", "sg_de",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_8, "parasail_sg_de_table_diag_avx512_512_8", "sg_de",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_sat, "parasail_sg_de_table_diag_avx512_512_sat", "sg_de",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_table_scan_altivec_128_64, "parasail_sg_de_table_scan_altivec_128_64", "sg_de",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_de_table_scan_altivec_128_32, "parasail_sg_de_table_scan_altivec_128_32", "sg_de",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -3132,6 +3729,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_table_diag_avx2_256_8, "parasail_sg_dx_table_diag_avx2_256_8", "sg_dx",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_dx_table_diag_avx2_256_sat, "parasail_sg_dx_table_diag_avx2_256_sat", "sg_dx",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_table_scan_avx512_512_64, "parasail_sg_dx_table_scan_avx512_512_64", "sg_dx",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_avx512_512_32, "parasail_sg_dx_table_scan_avx512_512_32", "sg_dx",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_avx512_512_16, "parasail_sg_dx_table_scan_avx512_512_16", "sg_dx",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_avx512_512_8, "parasail_sg_dx_table_scan_avx512_512_8", "sg_dx",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_avx512_512_sat, "parasail_sg_dx_table_scan_avx512_512_sat", "sg_dx",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_64, "parasail_sg_dx_table_striped_avx512_512_64", "sg_dx", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_32, "parasail_sg_dx_table_striped_avx512_512_32", "sg_dx", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_16, "parasail_sg_dx_table_striped_avx512_512_16", "sg_dx", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_8, "parasail_sg_dx_table_striped_avx512_512_8", "sg_dx", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_sat, "parasail_sg_dx_table_striped_avx512_512_sat", "sg_dx", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_64, "parasail_sg_dx_table_diag_avx512_512_64", "sg_dx",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_32, "parasail_sg_dx_table_diag_avx512_512_32", "sg_dx",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_16, "parasail_sg_dx_table_diag_avx512_512_16", "sg_dx",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_8, "parasail_sg_dx_table_diag_avx512_512_8", "sg_dx",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_sat, "parasail_sg_dx_table_diag_avx512_512_sat", "sg_dx",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_table_scan_altivec_128_64, "parasail_sg_dx_table_scan_altivec_128_64", "sg_dx",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_dx_table_scan_altivec_128_32, "parasail_sg_dx_table_scan_altivec_128_32", "sg_dx",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -3234,6 +3848,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_table_diag_avx2_256_8, "parasail_sg_qb_de_table_diag_avx2_256_8", "sg_qb_de",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qb_de_table_diag_avx2_256_sat, "parasail_sg_qb_de_table_diag_avx2_256_sat", "sg_qb_de",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_table_scan_avx512_512_64, "parasail_sg_qb_de_table_scan_avx512_512_64", "sg_qb_de",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_avx512_512_32, "parasail_sg_qb_de_table_scan_avx512_512_32", "sg_qb_de",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_avx512_512_16, "parasail_sg_qb_de_table_scan_avx512_512_16", "sg_qb_de",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_avx512_512_8, "parasail_sg_qb_de_table_scan_avx512_512_8", "sg_qb_de",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_avx512_512_sat, "parasail_sg_qb_de_table_scan_avx512_512_sat", "sg_qb_de",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_64, "parasail_sg_qb_de_table_striped_avx512_512_64", "sg_qb_de", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_32, "parasail_sg_qb_de_table_striped_avx512_512_32", "sg_qb_de", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_16, "parasail_sg_qb_de_table_striped_avx512_512_16", "sg_qb_de", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_8, "parasail_sg_qb_de_table_striped_avx512_512_8", "sg_qb_de", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_sat, "parasail_sg_qb_de_table_striped_avx512_512_sat", "sg_qb_de", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_64, "parasail_sg_qb_de_table_diag_avx512_512_64", "sg_qb_de",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_32, "parasail_sg_qb_de_table_diag_avx512_512_32", "sg_qb_de",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_16, "parasail_sg_qb_de_table_diag_avx512_512_16", "sg_qb_de",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_8, "parasail_sg_qb_de_table_diag_avx512_512_8", "sg_qb_de",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_sat, "parasail_sg_qb_de_table_diag_avx512_512_sat", "sg_qb_de",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_table_scan_altivec_128_64, "parasail_sg_qb_de_table_scan_altivec_128_64", "sg_qb_de",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qb_de_table_scan_altivec_128_32, "parasail_sg_qb_de_table_scan_altivec_128_32", "sg_qb_de",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -3336,6 +3967,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_table_diag_avx2_256_8, "parasail_sg_qe_db_table_diag_avx2_256_8", "sg_qe_db",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qe_db_table_diag_avx2_256_sat, "parasail_sg_qe_db_table_diag_avx2_256_sat", "sg_qe_db",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_table_scan_avx512_512_64, "parasail_sg_qe_db_table_scan_avx512_512_64", "sg_qe_db",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_avx512_512_32, "parasail_sg_qe_db_table_scan_avx512_512_32", "sg_qe_db",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_avx512_512_16, "parasail_sg_qe_db_table_scan_avx512_512_16", "sg_qe_db",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_avx512_512_8, "parasail_sg_qe_db_table_scan_avx512_512_8", "sg_qe_db",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_avx512_512_sat, "parasail_sg_qe_db_table_scan_avx512_512_sat", "sg_qe_db",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_64, "parasail_sg_qe_db_table_striped_avx512_512_64", "sg_qe_db", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_32, "parasail_sg_qe_db_table_striped_avx512_512_32", "sg_qe_db", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_16, "parasail_sg_qe_db_table_striped_avx512_512_16", "sg_qe_db", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_8, "parasail_sg_qe_db_table_striped_avx512_512_8", "sg_qe_db", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_sat, "parasail_sg_qe_db_table_striped_avx512_512_sat", "sg_qe_db", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_64, "parasail_sg_qe_db_table_diag_avx512_512_64", "sg_qe_db",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_32, "parasail_sg_qe_db_table_diag_avx512_512_32", "sg_qe_db",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_16, "parasail_sg_qe_db_table_diag_avx512_512_16", "sg_qe_db",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_8, "parasail_sg_qe_db_table_diag_avx512_512_8", "sg_qe_db",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_sat, "parasail_sg_qe_db_table_diag_avx512_512_sat", "sg_qe_db",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_table_scan_altivec_128_64, "parasail_sg_qe_db_table_scan_altivec_128_64", "sg_qe_db",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qe_db_table_scan_altivec_128_32, "parasail_sg_qe_db_table_scan_altivec_128_32", "sg_qe_db",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -3438,6 +4086,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_stats_table_diag_avx2_256_8, "parasail_nw_stats_table_diag_avx2_256_8", "nw_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_nw_stats_table_diag_avx2_256_sat, "parasail_nw_stats_table_diag_avx2_256_sat", "nw_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_table_scan_avx512_512_64, "parasail_nw_stats_table_scan_avx512_512_64", "nw_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512_512_32, "parasail_nw_stats_table_scan_avx512_512_32", "nw_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512_512_16, "parasail_nw_stats_table_scan_avx512_512_16", "nw_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512_512_8, "parasail_nw_stats_table_scan_avx512_512_8", "nw_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512_512_sat, "parasail_nw_stats_table_scan_avx512_512_sat", "nw_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_64, "parasail_nw_stats_table_striped_avx512_512_64", "nw_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_32, "parasail_nw_stats_table_striped_avx512_512_32", "nw_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_16, "parasail_nw_stats_table_striped_avx512_512_16", "nw_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_8, "parasail_nw_stats_table_striped_avx512_512_8", "nw_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_sat, "parasail_nw_stats_table_striped_avx512_512_sat", "nw_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_64, "parasail_nw_stats_table_diag_avx512_512_64", "nw_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_32, "parasail_nw_stats_table_diag_avx512_512_32", "nw_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_16, "parasail_nw_stats_table_diag_avx512_512_16", "nw_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_8, "parasail_nw_stats_table_diag_avx512_512_8", "nw_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_sat, "parasail_nw_stats_table_diag_avx512_512_sat", "nw_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_table_scan_altivec_128_64, "parasail_nw_stats_table_scan_altivec_128_64", "nw_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_nw_stats_table_scan_altivec_128_32, "parasail_nw_stats_table_scan_altivec_128_32", "nw_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -3540,6 +4205,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_stats_table_diag_avx2_256_8, "parasail_sg_stats_table_diag_avx2_256_8", "sg_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_stats_table_diag_avx2_256_sat, "parasail_sg_stats_table_diag_avx2_256_sat", "sg_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_table_scan_avx512_512_64, "parasail_sg_stats_table_scan_avx512_512_64", "sg_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512_512_32, "parasail_sg_stats_table_scan_avx512_512_32", "sg_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512_512_16, "parasail_sg_stats_table_scan_avx512_512_16", "sg_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512_512_8, "parasail_sg_stats_table_scan_avx512_512_8", "sg_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512_512_sat, "parasail_sg_stats_table_scan_avx512_512_sat", "sg_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_64, "parasail_sg_stats_table_striped_avx512_512_64", "sg_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_32, "parasail_sg_stats_table_striped_avx512_512_32", "sg_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_16, "parasail_sg_stats_table_striped_avx512_512_16", "sg_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_8, "parasail_sg_stats_table_striped_avx512_512_8", "sg_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_sat, "parasail_sg_stats_table_striped_avx512_512_sat", "sg_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_64, "parasail_sg_stats_table_diag_avx512_512_64", "sg_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_32, "parasail_sg_stats_table_diag_avx512_512_32", "sg_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_16, "parasail_sg_stats_table_diag_avx512_512_16", "sg_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_8, "parasail_sg_stats_table_diag_avx512_512_8", "sg_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_sat, "parasail_sg_stats_table_diag_avx512_512_sat", "sg_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_table_scan_altivec_128_64, "parasail_sg_stats_table_scan_altivec_128_64", "sg_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_stats_table_scan_altivec_128_32, "parasail_sg_stats_table_scan_altivec_128_32", "sg_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -3642,6 +4324,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_stats_table_diag_avx2_256_8, "parasail_sw_stats_table_diag_avx2_256_8", "sw_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sw_stats_table_diag_avx2_256_sat, "parasail_sw_stats_table_diag_avx2_256_sat", "sw_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_table_scan_avx512_512_64, "parasail_sw_stats_table_scan_avx512_512_64", "sw_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512_512_32, "parasail_sw_stats_table_scan_avx512_512_32", "sw_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512_512_16, "parasail_sw_stats_table_scan_avx512_512_16", "sw_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512_512_8, "parasail_sw_stats_table_scan_avx512_512_8", "sw_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512_512_sat, "parasail_sw_stats_table_scan_avx512_512_sat", "sw_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_64, "parasail_sw_stats_table_striped_avx512_512_64", "sw_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_32, "parasail_sw_stats_table_striped_avx512_512_32", "sw_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_16, "parasail_sw_stats_table_striped_avx512_512_16", "sw_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_8, "parasail_sw_stats_table_striped_avx512_512_8", "sw_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_sat, "parasail_sw_stats_table_striped_avx512_512_sat", "sw_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_64, "parasail_sw_stats_table_diag_avx512_512_64", "sw_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_32, "parasail_sw_stats_table_diag_avx512_512_32", "sw_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_16, "parasail_sw_stats_table_diag_avx512_512_16", "sw_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_8, "parasail_sw_stats_table_diag_avx512_512_8", "sw_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_sat, "parasail_sw_stats_table_diag_avx512_512_sat", "sw_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_table_scan_altivec_128_64, "parasail_sw_stats_table_scan_altivec_128_64", "sw_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sw_stats_table_scan_altivec_128_32, "parasail_sw_stats_table_scan_altivec_128_32", "sw_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -3744,6 +4443,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_stats_table_diag_avx2_256_8, "parasail_sg_qb_stats_table_diag_avx2_256_8", "sg_qb_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qb_stats_table_diag_avx2_256_sat, "parasail_sg_qb_stats_table_diag_avx2_256_sat", "sg_qb_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_stats_table_scan_avx512_512_64, "parasail_sg_qb_stats_table_scan_avx512_512_64", "sg_qb_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_avx512_512_32, "parasail_sg_qb_stats_table_scan_avx512_512_32", "sg_qb_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_avx512_512_16, "parasail_sg_qb_stats_table_scan_avx512_512_16", "sg_qb_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_avx512_512_8, "parasail_sg_qb_stats_table_scan_avx512_512_8", "sg_qb_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_avx512_512_sat, "parasail_sg_qb_stats_table_scan_avx512_512_sat", "sg_qb_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_64, "parasail_sg_qb_stats_table_striped_avx512_512_64", "sg_qb_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_32, "parasail_sg_qb_stats_table_striped_avx512_512_32", "sg_qb_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_16, "parasail_sg_qb_stats_table_striped_avx512_512_16", "sg_qb_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_8, "parasail_sg_qb_stats_table_striped_avx512_512_8", "sg_qb_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_sat, "parasail_sg_qb_stats_table_striped_avx512_512_sat", "sg_qb_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_64, "parasail_sg_qb_stats_table_diag_avx512_512_64", "sg_qb_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_32, "parasail_sg_qb_stats_table_diag_avx512_512_32", "sg_qb_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_16, "parasail_sg_qb_stats_table_diag_avx512_512_16", "sg_qb_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_8, "parasail_sg_qb_stats_table_diag_avx512_512_8", "sg_qb_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_sat, "parasail_sg_qb_stats_table_diag_avx512_512_sat", "sg_qb_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_stats_table_scan_altivec_128_64, "parasail_sg_qb_stats_table_scan_altivec_128_64", "sg_qb_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qb_stats_table_scan_altivec_128_32, "parasail_sg_qb_stats_table_scan_altivec_128_32", "sg_qb_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -3846,6 +4562,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_stats_table_diag_avx2_256_8, "parasail_sg_qe_stats_table_diag_avx2_256_8", "sg_qe_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qe_stats_table_diag_avx2_256_sat, "parasail_sg_qe_stats_table_diag_avx2_256_sat", "sg_qe_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_stats_table_scan_avx512_512_64, "parasail_sg_qe_stats_table_scan_avx512_512_64", "sg_qe_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_avx512_512_32, "parasail_sg_qe_stats_table_scan_avx512_512_32", "sg_qe_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_avx512_512_16, "parasail_sg_qe_stats_table_scan_avx512_512_16", "sg_qe_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_avx512_512_8, "parasail_sg_qe_stats_table_scan_avx512_512_8", "sg_qe_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_avx512_512_sat, "parasail_sg_qe_stats_table_scan_avx512_512_sat", "sg_qe_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_64, "parasail_sg_qe_stats_table_striped_avx512_512_64", "sg_qe_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_32, "parasail_sg_qe_stats_table_striped_avx512_512_32", "sg_qe_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_16, "parasail_sg_qe_stats_table_striped_avx512_512_16", "sg_qe_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_8, "parasail_sg_qe_stats_table_striped_avx512_512_8", "sg_qe_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_sat, "parasail_sg_qe_stats_table_striped_avx512_512_sat", "sg_qe_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_64, "parasail_sg_qe_stats_table_diag_avx512_512_64", "sg_qe_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_32, "parasail_sg_qe_stats_table_diag_avx512_512_32", "sg_qe_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_16, "parasail_sg_qe_stats_table_diag_avx512_512_16", "sg_qe_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_8, "parasail_sg_qe_stats_table_diag_avx512_512_8", "sg_qe_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_sat, "parasail_sg_qe_stats_table_diag_avx512_512_sat", "sg_qe_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_stats_table_scan_altivec_128_64, "parasail_sg_qe_stats_table_scan_altivec_128_64", "sg_qe_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qe_stats_table_scan_altivec_128_32, "parasail_sg_qe_stats_table_scan_altivec_128_32", "sg_qe_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -3948,6 +4681,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_stats_table_diag_avx2_256_8, "parasail_sg_qx_stats_table_diag_avx2_256_8", "sg_qx_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qx_stats_table_diag_avx2_256_sat, "parasail_sg_qx_stats_table_diag_avx2_256_sat", "sg_qx_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_stats_table_scan_avx512_512_64, "parasail_sg_qx_stats_table_scan_avx512_512_64", "sg_qx_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_avx512_512_32, "parasail_sg_qx_stats_table_scan_avx512_512_32", "sg_qx_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_avx512_512_16, "parasail_sg_qx_stats_table_scan_avx512_512_16", "sg_qx_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_avx512_512_8, "parasail_sg_qx_stats_table_scan_avx512_512_8", "sg_qx_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_avx512_512_sat, "parasail_sg_qx_stats_table_scan_avx512_512_sat", "sg_qx_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_64, "parasail_sg_qx_stats_table_striped_avx512_512_64", "sg_qx_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_32, "parasail_sg_qx_stats_table_striped_avx512_512_32", "sg_qx_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_16, "parasail_sg_qx_stats_table_striped_avx512_512_16", "sg_qx_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_8, "parasail_sg_qx_stats_table_striped_avx512_512_8", "sg_qx_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_sat, "parasail_sg_qx_stats_table_striped_avx512_512_sat", "sg_qx_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_64, "parasail_sg_qx_stats_table_diag_avx512_512_64", "sg_qx_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_32, "parasail_sg_qx_stats_table_diag_avx512_512_32", "sg_qx_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_16, "parasail_sg_qx_stats_table_diag_avx512_512_16", "sg_qx_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_8, "parasail_sg_qx_stats_table_diag_avx512_512_8", "sg_qx_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_sat, "parasail_sg_qx_stats_table_diag_avx512_512_sat", "sg_qx_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_stats_table_scan_altivec_128_64, "parasail_sg_qx_stats_table_scan_altivec_128_64", "sg_qx_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qx_stats_table_scan_altivec_128_32, "parasail_sg_qx_stats_table_scan_altivec_128_32", "sg_qx_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -4050,6 +4800,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_stats_table_diag_avx2_256_8, "parasail_sg_db_stats_table_diag_avx2_256_8", "sg_db_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_db_stats_table_diag_avx2_256_sat, "parasail_sg_db_stats_table_diag_avx2_256_sat", "sg_db_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_stats_table_scan_avx512_512_64, "parasail_sg_db_stats_table_scan_avx512_512_64", "sg_db_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_avx512_512_32, "parasail_sg_db_stats_table_scan_avx512_512_32", "sg_db_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_avx512_512_16, "parasail_sg_db_stats_table_scan_avx512_512_16", "sg_db_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_avx512_512_8, "parasail_sg_db_stats_table_scan_avx512_512_8", "sg_db_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_avx512_512_sat, "parasail_sg_db_stats_table_scan_avx512_512_sat", "sg_db_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_64, "parasail_sg_db_stats_table_striped_avx512_512_64", "sg_db_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_32, "parasail_sg_db_stats_table_striped_avx512_512_32", "sg_db_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_16, "parasail_sg_db_stats_table_striped_avx512_512_16", "sg_db_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_8, "parasail_sg_db_stats_table_striped_avx512_512_8", "sg_db_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_sat, "parasail_sg_db_stats_table_striped_avx512_512_sat", "sg_db_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_64, "parasail_sg_db_stats_table_diag_avx512_512_64", "sg_db_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_32, "parasail_sg_db_stats_table_diag_avx512_512_32", "sg_db_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_16, "parasail_sg_db_stats_table_diag_avx512_512_16", "sg_db_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_8, "parasail_sg_db_stats_table_diag_avx512_512_8", "sg_db_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_sat, "parasail_sg_db_stats_table_diag_avx512_512_sat", "sg_db_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_stats_table_scan_altivec_128_64, "parasail_sg_db_stats_table_scan_altivec_128_64", "sg_db_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_db_stats_table_scan_altivec_128_32, "parasail_sg_db_stats_table_scan_altivec_128_32", "sg_db_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -4152,6 +4919,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_stats_table_diag_avx2_256_8, "parasail_sg_de_stats_table_diag_avx2_256_8", "sg_de_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_de_stats_table_diag_avx2_256_sat, "parasail_sg_de_stats_table_diag_avx2_256_sat", "sg_de_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_stats_table_scan_avx512_512_64, "parasail_sg_de_stats_table_scan_avx512_512_64", "sg_de_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_avx512_512_32, "parasail_sg_de_stats_table_scan_avx512_512_32", "sg_de_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_avx512_512_16, "parasail_sg_de_stats_table_scan_avx512_512_16", "sg_de_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_avx512_512_8, "parasail_sg_de_stats_table_scan_avx512_512_8", "sg_de_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_avx512_512_sat, "parasail_sg_de_stats_table_scan_avx512_512_sat", "sg_de_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_64, "parasail_sg_de_stats_table_striped_avx512_512_64", "sg_de_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_32, "parasail_sg_de_stats_table_striped_avx512_512_32", "sg_de_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_16, "parasail_sg_de_stats_table_striped_avx512_512_16", "sg_de_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_8, "parasail_sg_de_stats_table_striped_avx512_512_8", "sg_de_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_sat, "parasail_sg_de_stats_table_striped_avx512_512_sat", "sg_de_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_64, "parasail_sg_de_stats_table_diag_avx512_512_64", "sg_de_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_32, "parasail_sg_de_stats_table_diag_avx512_512_32", "sg_de_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_16, "parasail_sg_de_stats_table_diag_avx512_512_16", "sg_de_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_8, "parasail_sg_de_stats_table_diag_avx512_512_8", "sg_de_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_sat, "parasail_sg_de_stats_table_diag_avx512_512_sat", "sg_de_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_stats_table_scan_altivec_128_64, "parasail_sg_de_stats_table_scan_altivec_128_64", "sg_de_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_de_stats_table_scan_altivec_128_32, "parasail_sg_de_stats_table_scan_altivec_128_32", "sg_de_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -4254,6 +5038,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_stats_table_diag_avx2_256_8, "parasail_sg_dx_stats_table_diag_avx2_256_8", "sg_dx_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_dx_stats_table_diag_avx2_256_sat, "parasail_sg_dx_stats_table_diag_avx2_256_sat", "sg_dx_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_stats_table_scan_avx512_512_64, "parasail_sg_dx_stats_table_scan_avx512_512_64", "sg_dx_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_avx512_512_32, "parasail_sg_dx_stats_table_scan_avx512_512_32", "sg_dx_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_avx512_512_16, "parasail_sg_dx_stats_table_scan_avx512_512_16", "sg_dx_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_avx512_512_8, "parasail_sg_dx_stats_table_scan_avx512_512_8", "sg_dx_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_avx512_512_sat, "parasail_sg_dx_stats_table_scan_avx512_512_sat", "sg_dx_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_64, "parasail_sg_dx_stats_table_striped_avx512_512_64", "sg_dx_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_32, "parasail_sg_dx_stats_table_striped_avx512_512_32", "sg_dx_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_16, "parasail_sg_dx_stats_table_striped_avx512_512_16", "sg_dx_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_8, "parasail_sg_dx_stats_table_striped_avx512_512_8", "sg_dx_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_sat, "parasail_sg_dx_stats_table_striped_avx512_512_sat", "sg_dx_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_64, "parasail_sg_dx_stats_table_diag_avx512_512_64", "sg_dx_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_32, "parasail_sg_dx_stats_table_diag_avx512_512_32", "sg_dx_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_16, "parasail_sg_dx_stats_table_diag_avx512_512_16", "sg_dx_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_8, "parasail_sg_dx_stats_table_diag_avx512_512_8", "sg_dx_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_sat, "parasail_sg_dx_stats_table_diag_avx512_512_sat", "sg_dx_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_stats_table_scan_altivec_128_64, "parasail_sg_dx_stats_table_scan_altivec_128_64", "sg_dx_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_dx_stats_table_scan_altivec_128_32, "parasail_sg_dx_stats_table_scan_altivec_128_32", "sg_dx_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -4356,6 +5157,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_stats_table_diag_avx2_256_8, "parasail_sg_qb_de_stats_table_diag_avx2_256_8", "sg_qb_de_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qb_de_stats_table_diag_avx2_256_sat, "parasail_sg_qb_de_stats_table_diag_avx2_256_sat", "sg_qb_de_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_stats_table_scan_avx512_512_64, "parasail_sg_qb_de_stats_table_scan_avx512_512_64", "sg_qb_de_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_avx512_512_32, "parasail_sg_qb_de_stats_table_scan_avx512_512_32", "sg_qb_de_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_avx512_512_16, "parasail_sg_qb_de_stats_table_scan_avx512_512_16", "sg_qb_de_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_avx512_512_8, "parasail_sg_qb_de_stats_table_scan_avx512_512_8", "sg_qb_de_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_avx512_512_sat, "parasail_sg_qb_de_stats_table_scan_avx512_512_sat", "sg_qb_de_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_64, "parasail_sg_qb_de_stats_table_striped_avx512_512_64", "sg_qb_de_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_32, "parasail_sg_qb_de_stats_table_striped_avx512_512_32", "sg_qb_de_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_16, "parasail_sg_qb_de_stats_table_striped_avx512_512_16", "sg_qb_de_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_8, "parasail_sg_qb_de_stats_table_striped_avx512_512_8", "sg_qb_de_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_sat, "parasail_sg_qb_de_stats_table_striped_avx512_512_sat", "sg_qb_de_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_64, "parasail_sg_qb_de_stats_table_diag_avx512_512_64", "sg_qb_de_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_32, "parasail_sg_qb_de_stats_table_diag_avx512_512_32", "sg_qb_de_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_16, "parasail_sg_qb_de_stats_table_diag_avx512_512_16", "sg_qb_de_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_8, "parasail_sg_qb_de_stats_table_diag_avx512_512_8", "sg_qb_de_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_sat, "parasail_sg_qb_de_stats_table_diag_avx512_512_sat", "sg_qb_de_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_stats_table_scan_altivec_128_64, "parasail_sg_qb_de_stats_table_scan_altivec_128_64", "sg_qb_de_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qb_de_stats_table_scan_altivec_128_32, "parasail_sg_qb_de_stats_table_scan_altivec_128_32", "sg_qb_de_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -4458,6 +5276,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_stats_table_diag_avx2_256_8, "parasail_sg_qe_db_stats_table_diag_avx2_256_8", "sg_qe_db_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qe_db_stats_table_diag_avx2_256_sat, "parasail_sg_qe_db_stats_table_diag_avx2_256_sat", "sg_qe_db_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_stats_table_scan_avx512_512_64, "parasail_sg_qe_db_stats_table_scan_avx512_512_64", "sg_qe_db_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_avx512_512_32, "parasail_sg_qe_db_stats_table_scan_avx512_512_32", "sg_qe_db_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_avx512_512_16, "parasail_sg_qe_db_stats_table_scan_avx512_512_16", "sg_qe_db_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_avx512_512_8, "parasail_sg_qe_db_stats_table_scan_avx512_512_8", "sg_qe_db_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_avx512_512_sat, "parasail_sg_qe_db_stats_table_scan_avx512_512_sat", "sg_qe_db_stats",    "scan", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_64, "parasail_sg_qe_db_stats_table_striped_avx512_512_64", "sg_qe_db_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_32, "parasail_sg_qe_db_stats_table_striped_avx512_512_32", "sg_qe_db_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_16, "parasail_sg_qe_db_stats_table_striped_avx512_512_16", "sg_qe_db_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_8, "parasail_sg_qe_db_stats_table_striped_avx512_512_8", "sg_qe_db_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_sat, "parasail_sg_qe_db_stats_table_striped_avx512_512_sat", "sg_qe_db_stats", "striped", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_64, "parasail_sg_qe_db_stats_table_diag_avx512_512_64", "sg_qe_db_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_32, "parasail_sg_qe_db_stats_table_diag_avx512_512_32", "sg_qe_db_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_16, "parasail_sg_qe_db_stats_table_diag_avx512_512_16", "sg_qe_db_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_8, "parasail_sg_qe_db_stats_table_diag_avx512_512_8", "sg_qe_db_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_sat, "parasail_sg_qe_db_stats_table_diag_avx512_512_sat", "sg_qe_db_stats",    "diag", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_stats_table_scan_altivec_128_64, "parasail_sg_qe_db_stats_table_scan_altivec_128_64", "sg_qe_db_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qe_db_stats_table_scan_altivec_128_32, "parasail_sg_qe_db_stats_table_scan_altivec_128_32", "sg_qe_db_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -4560,6 +5395,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_rowcol_diag_avx2_256_8,  "parasail_nw_rowcol_diag_avx2_256_8",  "nw",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_diag_avx2_256_sat, "parasail_nw_rowcol_diag_avx2_256_sat", "nw",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_rowcol_scan_avx512_512_64, "parasail_nw_rowcol_scan_avx512_512_64", "nw",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512_512_32, "parasail_nw_rowcol_scan_avx512_512_32", "nw",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512_512_16, "parasail_nw_rowcol_scan_avx512_512_16", "nw",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512_512_8, "parasail_nw_rowcol_scan_avx512_512_8", "nw",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512_512_sat, "parasail_nw_rowcol_scan_avx512_512_sat", "nw",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_64, "parasail_nw_rowcol_striped_avx512_512_64", "nw", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_32, "parasail_nw_rowcol_striped_avx512_512_32", "nw", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_16, "parasail_nw_rowcol_striped_avx512_512_16", "nw", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_8, "parasail_nw_rowcol_striped_avx512_512_8", "nw", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_sat, "parasail_nw_rowcol_striped_avx512_512_sat", "nw", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_64, "parasail_nw_rowcol_diag_avx512_512_64", "nw",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_32, "parasail_nw_rowcol_diag_avx512_512_32", "nw",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_16, "parasail_nw_rowcol_diag_avx512_512_16", "nw",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_8, "parasail_nw_rowcol_diag_avx512_512_8", "nw",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_sat, "parasail_nw_rowcol_diag_avx512_512_sat", "nw",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_rowcol_scan_altivec_128_64, "parasail_nw_rowcol_scan_altivec_128_64", "nw",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_scan_altivec_128_32, "parasail_nw_rowcol_scan_altivec_128_32", "nw",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -4662,6 +5514,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_rowcol_diag_avx2_256_8,  "parasail_sg_rowcol_diag_avx2_256_8",  "sg",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_diag_avx2_256_sat, "parasail_sg_rowcol_diag_avx2_256_sat", "sg",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_rowcol_scan_avx512_512_64, "parasail_sg_rowcol_scan_avx512_512_64", "sg",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512_512_32, "parasail_sg_rowcol_scan_avx512_512_32", "sg",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512_512_16, "parasail_sg_rowcol_scan_avx512_512_16", "sg",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512_512_8, "parasail_sg_rowcol_scan_avx512_512_8", "sg",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512_512_sat, "parasail_sg_rowcol_scan_avx512_512_sat", "sg",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_64, "parasail_sg_rowcol_striped_avx512_512_64", "sg", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_32, "parasail_sg_rowcol_striped_avx512_512_32", "sg", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_16, "parasail_sg_rowcol_striped_avx512_512_16", "sg", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_8, "parasail_sg_rowcol_striped_avx512_512_8", "sg", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_sat, "parasail_sg_rowcol_striped_avx512_512_sat", "sg", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_64, "parasail_sg_rowcol_diag_avx512_512_64", "sg",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_32, "parasail_sg_rowcol_diag_avx512_512_32", "sg",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_16, "parasail_sg_rowcol_diag_avx512_512_16", "sg",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_8, "parasail_sg_rowcol_diag_avx512_512_8", "sg",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_sat, "parasail_sg_rowcol_diag_avx512_512_sat", "sg",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_rowcol_scan_altivec_128_64, "parasail_sg_rowcol_scan_altivec_128_64", "sg",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_scan_altivec_128_32, "parasail_sg_rowcol_scan_altivec_128_32", "sg",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -4766,6 +5635,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_rowcol_diag_avx2_256_8,  "parasail_sw_rowcol_diag_avx2_256_8",  "sw",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_diag_avx2_256_sat, "parasail_sw_rowcol_diag_avx2_256_sat", "sw",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_rowcol_scan_avx512_512_64, "parasail_sw_rowcol_scan_avx512_512_64", "sw",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512_512_32, "parasail_sw_rowcol_scan_avx512_512_32", "sw",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512_512_16, "parasail_sw_rowcol_scan_avx512_512_16", "sw",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512_512_8, "parasail_sw_rowcol_scan_avx512_512_8", "sw",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512_512_sat, "parasail_sw_rowcol_scan_avx512_512_sat", "sw",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_64, "parasail_sw_rowcol_striped_avx512_512_64", "sw", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_32, "parasail_sw_rowcol_striped_avx512_512_32", "sw", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_16, "parasail_sw_rowcol_striped_avx512_512_16", "sw", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_8, "parasail_sw_rowcol_striped_avx512_512_8", "sw", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_sat, "parasail_sw_rowcol_striped_avx512_512_sat", "sw", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_64, "parasail_sw_rowcol_diag_avx512_512_64", "sw",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_32, "parasail_sw_rowcol_diag_avx512_512_32", "sw",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_16, "parasail_sw_rowcol_diag_avx512_512_16", "sw",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_8, "parasail_sw_rowcol_diag_avx512_512_8", "sw",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_sat, "parasail_sw_rowcol_diag_avx512_512_sat", "sw",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_rowcol_scan_altivec_128_64, "parasail_sw_rowcol_scan_altivec_128_64", "sw",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_scan_altivec_128_32, "parasail_sw_rowcol_scan_altivec_128_32", "sw",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -4868,6 +5754,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_rowcol_diag_avx2_256_8, "parasail_sg_qb_rowcol_diag_avx2_256_8", "sg_qb",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qb_rowcol_diag_avx2_256_sat, "parasail_sg_qb_rowcol_diag_avx2_256_sat", "sg_qb",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_rowcol_scan_avx512_512_64, "parasail_sg_qb_rowcol_scan_avx512_512_64", "sg_qb",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_avx512_512_32, "parasail_sg_qb_rowcol_scan_avx512_512_32", "sg_qb",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_avx512_512_16, "parasail_sg_qb_rowcol_scan_avx512_512_16", "sg_qb",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_avx512_512_8, "parasail_sg_qb_rowcol_scan_avx512_512_8", "sg_qb",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_avx512_512_sat, "parasail_sg_qb_rowcol_scan_avx512_512_sat", "sg_qb",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_64, "parasail_sg_qb_rowcol_striped_avx512_512_64", "sg_qb", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_32, "parasail_sg_qb_rowcol_striped_avx512_512_32", "sg_qb", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_16, "parasail_sg_qb_rowcol_striped_avx512_512_16", "sg_qb", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_8, "parasail_sg_qb_rowcol_striped_avx512_512_8", "sg_qb", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_sat, "parasail_sg_qb_rowcol_striped_avx512_512_sat", "sg_qb", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_64, "parasail_sg_qb_rowcol_diag_avx512_512_64", "sg_qb",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_32, "parasail_sg_qb_rowcol_diag_avx512_512_32", "sg_qb",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_16, "parasail_sg_qb_rowcol_diag_avx512_512_16", "sg_qb",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_8, "parasail_sg_qb_rowcol_diag_avx512_512_8", "sg_qb",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_sat, "parasail_sg_qb_rowcol_diag_avx512_512_sat", "sg_qb",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_rowcol_scan_altivec_128_64, "parasail_sg_qb_rowcol_scan_altivec_128_64", "sg_qb",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qb_rowcol_scan_altivec_128_32, "parasail_sg_qb_rowcol_scan_altivec_128_32", "sg_qb",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -4970,6 +5873,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_rowcol_diag_avx2_256_8, "parasail_sg_qe_rowcol_diag_avx2_256_8", "sg_qe",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qe_rowcol_diag_avx2_256_sat, "parasail_sg_qe_rowcol_diag_avx2_256_sat", "sg_qe",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_rowcol_scan_avx512_512_64, "parasail_sg_qe_rowcol_scan_avx512_512_64", "sg_qe",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_avx512_512_32, "parasail_sg_qe_rowcol_scan_avx512_512_32", "sg_qe",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_avx512_512_16, "parasail_sg_qe_rowcol_scan_avx512_512_16", "sg_qe",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_avx512_512_8, "parasail_sg_qe_rowcol_scan_avx512_512_8", "sg_qe",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_avx512_512_sat, "parasail_sg_qe_rowcol_scan_avx512_512_sat", "sg_qe",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_64, "parasail_sg_qe_rowcol_striped_avx512_512_64", "sg_qe", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_32, "parasail_sg_qe_rowcol_striped_avx512_512_32", "sg_qe", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_16, "parasail_sg_qe_rowcol_striped_avx512_512_16", "sg_qe", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_8, "parasail_sg_qe_rowcol_striped_avx512_512_8", "sg_qe", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_sat, "parasail_sg_qe_rowcol_striped_avx512_512_sat", "sg_qe", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_64, "parasail_sg_qe_rowcol_diag_avx512_512_64", "sg_qe",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_32, "parasail_sg_qe_rowcol_diag_avx512_512_32", "sg_qe",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_16, "parasail_sg_qe_rowcol_diag_avx512_512_16", "sg_qe",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_8, "parasail_sg_qe_rowcol_diag_avx512_512_8", "sg_qe",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_sat, "parasail_sg_qe_rowcol_diag_avx512_512_sat", "sg_qe",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_rowcol_scan_altivec_128_64, "parasail_sg_qe_rowcol_scan_altivec_128_64", "sg_qe",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qe_rowcol_scan_altivec_128_32, "parasail_sg_qe_rowcol_scan_altivec_128_32", "sg_qe",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -5072,6 +5992,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_rowcol_diag_avx2_256_8, "parasail_sg_qx_rowcol_diag_avx2_256_8", "sg_qx",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qx_rowcol_diag_avx2_256_sat, "parasail_sg_qx_rowcol_diag_avx2_256_sat", "sg_qx",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_rowcol_scan_avx512_512_64, "parasail_sg_qx_rowcol_scan_avx512_512_64", "sg_qx",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_avx512_512_32, "parasail_sg_qx_rowcol_scan_avx512_512_32", "sg_qx",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_avx512_512_16, "parasail_sg_qx_rowcol_scan_avx512_512_16", "sg_qx",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_avx512_512_8, "parasail_sg_qx_rowcol_scan_avx512_512_8", "sg_qx",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_avx512_512_sat, "parasail_sg_qx_rowcol_scan_avx512_512_sat", "sg_qx",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_64, "parasail_sg_qx_rowcol_striped_avx512_512_64", "sg_qx", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_32, "parasail_sg_qx_rowcol_striped_avx512_512_32", "sg_qx", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_16, "parasail_sg_qx_rowcol_striped_avx512_512_16", "sg_qx", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_8, "parasail_sg_qx_rowcol_striped_avx512_512_8", "sg_qx", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_sat, "parasail_sg_qx_rowcol_striped_avx512_512_sat", "sg_qx", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_64, "parasail_sg_qx_rowcol_diag_avx512_512_64", "sg_qx",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_32, "parasail_sg_qx_rowcol_diag_avx512_512_32", "sg_qx",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_16, "parasail_sg_qx_rowcol_diag_avx512_512_16", "sg_qx",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_8, "parasail_sg_qx_rowcol_diag_avx512_512_8", "sg_qx",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_sat, "parasail_sg_qx_rowcol_diag_avx512_512_sat", "sg_qx",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_rowcol_scan_altivec_128_64, "parasail_sg_qx_rowcol_scan_altivec_128_64", "sg_qx",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qx_rowcol_scan_altivec_128_32, "parasail_sg_qx_rowcol_scan_altivec_128_32", "sg_qx",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -5174,6 +6111,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_rowcol_diag_avx2_256_8, "parasail_sg_db_rowcol_diag_avx2_256_8", "sg_db",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_db_rowcol_diag_avx2_256_sat, "parasail_sg_db_rowcol_diag_avx2_256_sat", "sg_db",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_rowcol_scan_avx512_512_64, "parasail_sg_db_rowcol_scan_avx512_512_64", "sg_db",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_avx512_512_32, "parasail_sg_db_rowcol_scan_avx512_512_32", "sg_db",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_avx512_512_16, "parasail_sg_db_rowcol_scan_avx512_512_16", "sg_db",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_avx512_512_8, "parasail_sg_db_rowcol_scan_avx512_512_8", "sg_db",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_avx512_512_sat, "parasail_sg_db_rowcol_scan_avx512_512_sat", "sg_db",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_64, "parasail_sg_db_rowcol_striped_avx512_512_64", "sg_db", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_32, "parasail_sg_db_rowcol_striped_avx512_512_32", "sg_db", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_16, "parasail_sg_db_rowcol_striped_avx512_512_16", "sg_db", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_8, "parasail_sg_db_rowcol_striped_avx512_512_8", "sg_db", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_sat, "parasail_sg_db_rowcol_striped_avx512_512_sat", "sg_db", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_64, "parasail_sg_db_rowcol_diag_avx512_512_64", "sg_db",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_32, "parasail_sg_db_rowcol_diag_avx512_512_32", "sg_db",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_16, "parasail_sg_db_rowcol_diag_avx512_512_16", "sg_db",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_8, "parasail_sg_db_rowcol_diag_avx512_512_8", "sg_db",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_sat, "parasail_sg_db_rowcol_diag_avx512_512_sat", "sg_db",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_rowcol_scan_altivec_128_64, "parasail_sg_db_rowcol_scan_altivec_128_64", "sg_db",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_db_rowcol_scan_altivec_128_32, "parasail_sg_db_rowcol_scan_altivec_128_32", "sg_db",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -5276,6 +6230,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_rowcol_diag_avx2_256_8, "parasail_sg_de_rowcol_diag_avx2_256_8", "sg_de",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_de_rowcol_diag_avx2_256_sat, "parasail_sg_de_rowcol_diag_avx2_256_sat", "sg_de",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_rowcol_scan_avx512_512_64, "parasail_sg_de_rowcol_scan_avx512_512_64", "sg_de",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_avx512_512_32, "parasail_sg_de_rowcol_scan_avx512_512_32", "sg_de",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_avx512_512_16, "parasail_sg_de_rowcol_scan_avx512_512_16", "sg_de",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_avx512_512_8, "parasail_sg_de_rowcol_scan_avx512_512_8", "sg_de",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_avx512_512_sat, "parasail_sg_de_rowcol_scan_avx512_512_sat", "sg_de",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_64, "parasail_sg_de_rowcol_striped_avx512_512_64", "sg_de", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_32, "parasail_sg_de_rowcol_striped_avx512_512_32", "sg_de", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_16, "parasail_sg_de_rowcol_striped_avx512_512_16", "sg_de", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_8, "parasail_sg_de_rowcol_striped_avx512_512_8", "sg_de", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_sat, "parasail_sg_de_rowcol_striped_avx512_512_sat", "sg_de", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_64, "parasail_sg_de_rowcol_diag_avx512_512_64", "sg_de",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_32, "parasail_sg_de_rowcol_diag_avx512_512_32", "sg_de",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_16, "parasail_sg_de_rowcol_diag_avx512_512_16", "sg_de",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_8, "parasail_sg_de_rowcol_diag_avx512_512_8", "sg_de",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_sat, "parasail_sg_de_rowcol_diag_avx512_512_sat", "sg_de",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_rowcol_scan_altivec_128_64, "parasail_sg_de_rowcol_scan_altivec_128_64", "sg_de",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_de_rowcol_scan_altivec_128_32, "parasail_sg_de_rowcol_scan_altivec_128_32", "sg_de",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -5378,6 +6349,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_rowcol_diag_avx2_256_8, "parasail_sg_dx_rowcol_diag_avx2_256_8", "sg_dx",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_dx_rowcol_diag_avx2_256_sat, "parasail_sg_dx_rowcol_diag_avx2_256_sat", "sg_dx",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_rowcol_scan_avx512_512_64, "parasail_sg_dx_rowcol_scan_avx512_512_64", "sg_dx",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_avx512_512_32, "parasail_sg_dx_rowcol_scan_avx512_512_32", "sg_dx",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_avx512_512_16, "parasail_sg_dx_rowcol_scan_avx512_512_16", "sg_dx",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_avx512_512_8, "parasail_sg_dx_rowcol_scan_avx512_512_8", "sg_dx",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_avx512_512_sat, "parasail_sg_dx_rowcol_scan_avx512_512_sat", "sg_dx",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_64, "parasail_sg_dx_rowcol_striped_avx512_512_64", "sg_dx", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_32, "parasail_sg_dx_rowcol_striped_avx512_512_32", "sg_dx", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_16, "parasail_sg_dx_rowcol_striped_avx512_512_16", "sg_dx", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_8, "parasail_sg_dx_rowcol_striped_avx512_512_8", "sg_dx", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_sat, "parasail_sg_dx_rowcol_striped_avx512_512_sat", "sg_dx", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_64, "parasail_sg_dx_rowcol_diag_avx512_512_64", "sg_dx",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_32, "parasail_sg_dx_rowcol_diag_avx512_512_32", "sg_dx",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_16, "parasail_sg_dx_rowcol_diag_avx512_512_16", "sg_dx",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_8, "parasail_sg_dx_rowcol_diag_avx512_512_8", "sg_dx",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_sat, "parasail_sg_dx_rowcol_diag_avx512_512_sat", "sg_dx",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_rowcol_scan_altivec_128_64, "parasail_sg_dx_rowcol_scan_altivec_128_64", "sg_dx",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_dx_rowcol_scan_altivec_128_32, "parasail_sg_dx_rowcol_scan_altivec_128_32", "sg_dx",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -5480,6 +6468,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_rowcol_diag_avx2_256_8, "parasail_sg_qb_de_rowcol_diag_avx2_256_8", "sg_qb_de",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qb_de_rowcol_diag_avx2_256_sat, "parasail_sg_qb_de_rowcol_diag_avx2_256_sat", "sg_qb_de",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_rowcol_scan_avx512_512_64, "parasail_sg_qb_de_rowcol_scan_avx512_512_64", "sg_qb_de",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_avx512_512_32, "parasail_sg_qb_de_rowcol_scan_avx512_512_32", "sg_qb_de",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_avx512_512_16, "parasail_sg_qb_de_rowcol_scan_avx512_512_16", "sg_qb_de",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_avx512_512_8, "parasail_sg_qb_de_rowcol_scan_avx512_512_8", "sg_qb_de",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_avx512_512_sat, "parasail_sg_qb_de_rowcol_scan_avx512_512_sat", "sg_qb_de",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_64, "parasail_sg_qb_de_rowcol_striped_avx512_512_64", "sg_qb_de", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_32, "parasail_sg_qb_de_rowcol_striped_avx512_512_32", "sg_qb_de", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_16, "parasail_sg_qb_de_rowcol_striped_avx512_512_16", "sg_qb_de", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_8, "parasail_sg_qb_de_rowcol_striped_avx512_512_8", "sg_qb_de", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_sat, "parasail_sg_qb_de_rowcol_striped_avx512_512_sat", "sg_qb_de", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_64, "parasail_sg_qb_de_rowcol_diag_avx512_512_64", "sg_qb_de",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_32, "parasail_sg_qb_de_rowcol_diag_avx512_512_32", "sg_qb_de",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_16, "parasail_sg_qb_de_rowcol_diag_avx512_512_16", "sg_qb_de",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_8, "parasail_sg_qb_de_rowcol_diag_avx512_512_8", "sg_qb_de",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_sat, "parasail_sg_qb_de_rowcol_diag_avx512_512_sat", "sg_qb_de",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_rowcol_scan_altivec_128_64, "parasail_sg_qb_de_rowcol_scan_altivec_128_64", "sg_qb_de",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qb_de_rowcol_scan_altivec_128_32, "parasail_sg_qb_de_rowcol_scan_altivec_128_32", "sg_qb_de",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -5582,6 +6587,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_rowcol_diag_avx2_256_8, "parasail_sg_qe_db_rowcol_diag_avx2_256_8", "sg_qe_db",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qe_db_rowcol_diag_avx2_256_sat, "parasail_sg_qe_db_rowcol_diag_avx2_256_sat", "sg_qe_db",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_rowcol_scan_avx512_512_64, "parasail_sg_qe_db_rowcol_scan_avx512_512_64", "sg_qe_db",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_avx512_512_32, "parasail_sg_qe_db_rowcol_scan_avx512_512_32", "sg_qe_db",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_avx512_512_16, "parasail_sg_qe_db_rowcol_scan_avx512_512_16", "sg_qe_db",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_avx512_512_8, "parasail_sg_qe_db_rowcol_scan_avx512_512_8", "sg_qe_db",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_avx512_512_sat, "parasail_sg_qe_db_rowcol_scan_avx512_512_sat", "sg_qe_db",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_64, "parasail_sg_qe_db_rowcol_striped_avx512_512_64", "sg_qe_db", "striped", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_32, "parasail_sg_qe_db_rowcol_striped_avx512_512_32", "sg_qe_db", "striped", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_16, "parasail_sg_qe_db_rowcol_striped_avx512_512_16", "sg_qe_db", "striped", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_8, "parasail_sg_qe_db_rowcol_striped_avx512_512_8", "sg_qe_db", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_sat, "parasail_sg_qe_db_rowcol_striped_avx512_512_sat", "sg_qe_db", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_64, "parasail_sg_qe_db_rowcol_diag_avx512_512_64", "sg_qe_db",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_32, "parasail_sg_qe_db_rowcol_diag_avx512_512_32", "sg_qe_db",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_16, "parasail_sg_qe_db_rowcol_diag_avx512_512_16", "sg_qe_db",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_8, "parasail_sg_qe_db_rowcol_diag_avx512_512_8", "sg_qe_db",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_sat, "parasail_sg_qe_db_rowcol_diag_avx512_512_sat", "sg_qe_db",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_rowcol_scan_altivec_128_64, "parasail_sg_qe_db_rowcol_scan_altivec_128_64", "sg_qe_db",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qe_db_rowcol_scan_altivec_128_32, "parasail_sg_qe_db_rowcol_scan_altivec_128_32", "sg_qe_db",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -5684,6 +6706,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_stats_rowcol_diag_avx2_256_8, "parasail_nw_stats_rowcol_diag_avx2_256_8", "nw_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_nw_stats_rowcol_diag_avx2_256_sat, "parasail_nw_stats_rowcol_diag_avx2_256_sat", "nw_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_rowcol_scan_avx512_512_64, "parasail_nw_stats_rowcol_scan_avx512_512_64", "nw_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512_512_32, "parasail_nw_stats_rowcol_scan_avx512_512_32", "nw_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512_512_16, "parasail_nw_stats_rowcol_scan_avx512_512_16", "nw_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512_512_8, "parasail_nw_stats_rowcol_scan_avx512_512_8", "nw_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512_512_sat, "parasail_nw_stats_rowcol_scan_avx512_512_sat", "nw_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_64, "parasail_nw_stats_rowcol_striped_avx512_512_64", "nw_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_32, "parasail_nw_stats_rowcol_striped_avx512_512_32", "nw_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_16, "parasail_nw_stats_rowcol_striped_avx512_512_16", "nw_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_8, "parasail_nw_stats_rowcol_striped_avx512_512_8", "nw_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_sat, "parasail_nw_stats_rowcol_striped_avx512_512_sat", "nw_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_64, "parasail_nw_stats_rowcol_diag_avx512_512_64", "nw_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_32, "parasail_nw_stats_rowcol_diag_avx512_512_32", "nw_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_16, "parasail_nw_stats_rowcol_diag_avx512_512_16", "nw_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_8, "parasail_nw_stats_rowcol_diag_avx512_512_8", "nw_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_sat, "parasail_nw_stats_rowcol_diag_avx512_512_sat", "nw_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_rowcol_scan_altivec_128_64, "parasail_nw_stats_rowcol_scan_altivec_128_64", "nw_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_nw_stats_rowcol_scan_altivec_128_32, "parasail_nw_stats_rowcol_scan_altivec_128_32", "nw_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -5786,6 +6825,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_stats_rowcol_diag_avx2_256_8, "parasail_sg_stats_rowcol_diag_avx2_256_8", "sg_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_stats_rowcol_diag_avx2_256_sat, "parasail_sg_stats_rowcol_diag_avx2_256_sat", "sg_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_rowcol_scan_avx512_512_64, "parasail_sg_stats_rowcol_scan_avx512_512_64", "sg_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512_512_32, "parasail_sg_stats_rowcol_scan_avx512_512_32", "sg_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512_512_16, "parasail_sg_stats_rowcol_scan_avx512_512_16", "sg_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512_512_8, "parasail_sg_stats_rowcol_scan_avx512_512_8", "sg_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512_512_sat, "parasail_sg_stats_rowcol_scan_avx512_512_sat", "sg_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_64, "parasail_sg_stats_rowcol_striped_avx512_512_64", "sg_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_32, "parasail_sg_stats_rowcol_striped_avx512_512_32", "sg_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_16, "parasail_sg_stats_rowcol_striped_avx512_512_16", "sg_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_8, "parasail_sg_stats_rowcol_striped_avx512_512_8", "sg_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_sat, "parasail_sg_stats_rowcol_striped_avx512_512_sat", "sg_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_64, "parasail_sg_stats_rowcol_diag_avx512_512_64", "sg_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_32, "parasail_sg_stats_rowcol_diag_avx512_512_32", "sg_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_16, "parasail_sg_stats_rowcol_diag_avx512_512_16", "sg_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_8, "parasail_sg_stats_rowcol_diag_avx512_512_8", "sg_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_sat, "parasail_sg_stats_rowcol_diag_avx512_512_sat", "sg_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_rowcol_scan_altivec_128_64, "parasail_sg_stats_rowcol_scan_altivec_128_64", "sg_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_stats_rowcol_scan_altivec_128_32, "parasail_sg_stats_rowcol_scan_altivec_128_32", "sg_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -5888,6 +6944,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_stats_rowcol_diag_avx2_256_8, "parasail_sw_stats_rowcol_diag_avx2_256_8", "sw_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sw_stats_rowcol_diag_avx2_256_sat, "parasail_sw_stats_rowcol_diag_avx2_256_sat", "sw_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_rowcol_scan_avx512_512_64, "parasail_sw_stats_rowcol_scan_avx512_512_64", "sw_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512_512_32, "parasail_sw_stats_rowcol_scan_avx512_512_32", "sw_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512_512_16, "parasail_sw_stats_rowcol_scan_avx512_512_16", "sw_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512_512_8, "parasail_sw_stats_rowcol_scan_avx512_512_8", "sw_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512_512_sat, "parasail_sw_stats_rowcol_scan_avx512_512_sat", "sw_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_64, "parasail_sw_stats_rowcol_striped_avx512_512_64", "sw_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_32, "parasail_sw_stats_rowcol_striped_avx512_512_32", "sw_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_16, "parasail_sw_stats_rowcol_striped_avx512_512_16", "sw_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_8, "parasail_sw_stats_rowcol_striped_avx512_512_8", "sw_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_sat, "parasail_sw_stats_rowcol_striped_avx512_512_sat", "sw_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_64, "parasail_sw_stats_rowcol_diag_avx512_512_64", "sw_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_32, "parasail_sw_stats_rowcol_diag_avx512_512_32", "sw_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_16, "parasail_sw_stats_rowcol_diag_avx512_512_16", "sw_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_8, "parasail_sw_stats_rowcol_diag_avx512_512_8", "sw_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_sat, "parasail_sw_stats_rowcol_diag_avx512_512_sat", "sw_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_rowcol_scan_altivec_128_64, "parasail_sw_stats_rowcol_scan_altivec_128_64", "sw_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sw_stats_rowcol_scan_altivec_128_32, "parasail_sw_stats_rowcol_scan_altivec_128_32", "sw_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -5990,6 +7063,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_stats_rowcol_diag_avx2_256_8, "parasail_sg_qb_stats_rowcol_diag_avx2_256_8", "sg_qb_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qb_stats_rowcol_diag_avx2_256_sat, "parasail_sg_qb_stats_rowcol_diag_avx2_256_sat", "sg_qb_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_64, "parasail_sg_qb_stats_rowcol_scan_avx512_512_64", "sg_qb_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_32, "parasail_sg_qb_stats_rowcol_scan_avx512_512_32", "sg_qb_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_16, "parasail_sg_qb_stats_rowcol_scan_avx512_512_16", "sg_qb_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_8, "parasail_sg_qb_stats_rowcol_scan_avx512_512_8", "sg_qb_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_sat, "parasail_sg_qb_stats_rowcol_scan_avx512_512_sat", "sg_qb_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_64, "parasail_sg_qb_stats_rowcol_striped_avx512_512_64", "sg_qb_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_32, "parasail_sg_qb_stats_rowcol_striped_avx512_512_32", "sg_qb_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_16, "parasail_sg_qb_stats_rowcol_striped_avx512_512_16", "sg_qb_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_8, "parasail_sg_qb_stats_rowcol_striped_avx512_512_8", "sg_qb_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_sat, "parasail_sg_qb_stats_rowcol_striped_avx512_512_sat", "sg_qb_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_64, "parasail_sg_qb_stats_rowcol_diag_avx512_512_64", "sg_qb_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_32, "parasail_sg_qb_stats_rowcol_diag_avx512_512_32", "sg_qb_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_16, "parasail_sg_qb_stats_rowcol_diag_avx512_512_16", "sg_qb_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_8, "parasail_sg_qb_stats_rowcol_diag_avx512_512_8", "sg_qb_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_sat, "parasail_sg_qb_stats_rowcol_diag_avx512_512_sat", "sg_qb_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_stats_rowcol_scan_altivec_128_64, "parasail_sg_qb_stats_rowcol_scan_altivec_128_64", "sg_qb_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qb_stats_rowcol_scan_altivec_128_32, "parasail_sg_qb_stats_rowcol_scan_altivec_128_32", "sg_qb_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -6092,6 +7182,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_stats_rowcol_diag_avx2_256_8, "parasail_sg_qe_stats_rowcol_diag_avx2_256_8", "sg_qe_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qe_stats_rowcol_diag_avx2_256_sat, "parasail_sg_qe_stats_rowcol_diag_avx2_256_sat", "sg_qe_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_64, "parasail_sg_qe_stats_rowcol_scan_avx512_512_64", "sg_qe_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_32, "parasail_sg_qe_stats_rowcol_scan_avx512_512_32", "sg_qe_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_16, "parasail_sg_qe_stats_rowcol_scan_avx512_512_16", "sg_qe_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_8, "parasail_sg_qe_stats_rowcol_scan_avx512_512_8", "sg_qe_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_sat, "parasail_sg_qe_stats_rowcol_scan_avx512_512_sat", "sg_qe_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_64, "parasail_sg_qe_stats_rowcol_striped_avx512_512_64", "sg_qe_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_32, "parasail_sg_qe_stats_rowcol_striped_avx512_512_32", "sg_qe_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_16, "parasail_sg_qe_stats_rowcol_striped_avx512_512_16", "sg_qe_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_8, "parasail_sg_qe_stats_rowcol_striped_avx512_512_8", "sg_qe_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_sat, "parasail_sg_qe_stats_rowcol_striped_avx512_512_sat", "sg_qe_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_64, "parasail_sg_qe_stats_rowcol_diag_avx512_512_64", "sg_qe_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_32, "parasail_sg_qe_stats_rowcol_diag_avx512_512_32", "sg_qe_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_16, "parasail_sg_qe_stats_rowcol_diag_avx512_512_16", "sg_qe_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_8, "parasail_sg_qe_stats_rowcol_diag_avx512_512_8", "sg_qe_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_sat, "parasail_sg_qe_stats_rowcol_diag_avx512_512_sat", "sg_qe_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_stats_rowcol_scan_altivec_128_64, "parasail_sg_qe_stats_rowcol_scan_altivec_128_64", "sg_qe_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qe_stats_rowcol_scan_altivec_128_32, "parasail_sg_qe_stats_rowcol_scan_altivec_128_32", "sg_qe_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -6194,6 +7301,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_stats_rowcol_diag_avx2_256_8, "parasail_sg_qx_stats_rowcol_diag_avx2_256_8", "sg_qx_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qx_stats_rowcol_diag_avx2_256_sat, "parasail_sg_qx_stats_rowcol_diag_avx2_256_sat", "sg_qx_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_64, "parasail_sg_qx_stats_rowcol_scan_avx512_512_64", "sg_qx_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_32, "parasail_sg_qx_stats_rowcol_scan_avx512_512_32", "sg_qx_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_16, "parasail_sg_qx_stats_rowcol_scan_avx512_512_16", "sg_qx_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_8, "parasail_sg_qx_stats_rowcol_scan_avx512_512_8", "sg_qx_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_sat, "parasail_sg_qx_stats_rowcol_scan_avx512_512_sat", "sg_qx_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_64, "parasail_sg_qx_stats_rowcol_striped_avx512_512_64", "sg_qx_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_32, "parasail_sg_qx_stats_rowcol_striped_avx512_512_32", "sg_qx_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_16, "parasail_sg_qx_stats_rowcol_striped_avx512_512_16", "sg_qx_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_8, "parasail_sg_qx_stats_rowcol_striped_avx512_512_8", "sg_qx_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_sat, "parasail_sg_qx_stats_rowcol_striped_avx512_512_sat", "sg_qx_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_64, "parasail_sg_qx_stats_rowcol_diag_avx512_512_64", "sg_qx_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_32, "parasail_sg_qx_stats_rowcol_diag_avx512_512_32", "sg_qx_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_16, "parasail_sg_qx_stats_rowcol_diag_avx512_512_16", "sg_qx_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_8, "parasail_sg_qx_stats_rowcol_diag_avx512_512_8", "sg_qx_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_sat, "parasail_sg_qx_stats_rowcol_diag_avx512_512_sat", "sg_qx_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_stats_rowcol_scan_altivec_128_64, "parasail_sg_qx_stats_rowcol_scan_altivec_128_64", "sg_qx_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qx_stats_rowcol_scan_altivec_128_32, "parasail_sg_qx_stats_rowcol_scan_altivec_128_32", "sg_qx_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -6296,6 +7420,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_stats_rowcol_diag_avx2_256_8, "parasail_sg_db_stats_rowcol_diag_avx2_256_8", "sg_db_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_db_stats_rowcol_diag_avx2_256_sat, "parasail_sg_db_stats_rowcol_diag_avx2_256_sat", "sg_db_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_stats_rowcol_scan_avx512_512_64, "parasail_sg_db_stats_rowcol_scan_avx512_512_64", "sg_db_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_avx512_512_32, "parasail_sg_db_stats_rowcol_scan_avx512_512_32", "sg_db_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_avx512_512_16, "parasail_sg_db_stats_rowcol_scan_avx512_512_16", "sg_db_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_avx512_512_8, "parasail_sg_db_stats_rowcol_scan_avx512_512_8", "sg_db_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_avx512_512_sat, "parasail_sg_db_stats_rowcol_scan_avx512_512_sat", "sg_db_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_64, "parasail_sg_db_stats_rowcol_striped_avx512_512_64", "sg_db_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_32, "parasail_sg_db_stats_rowcol_striped_avx512_512_32", "sg_db_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_16, "parasail_sg_db_stats_rowcol_striped_avx512_512_16", "sg_db_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_8, "parasail_sg_db_stats_rowcol_striped_avx512_512_8", "sg_db_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_sat, "parasail_sg_db_stats_rowcol_striped_avx512_512_sat", "sg_db_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_64, "parasail_sg_db_stats_rowcol_diag_avx512_512_64", "sg_db_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_32, "parasail_sg_db_stats_rowcol_diag_avx512_512_32", "sg_db_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_16, "parasail_sg_db_stats_rowcol_diag_avx512_512_16", "sg_db_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_8, "parasail_sg_db_stats_rowcol_diag_avx512_512_8", "sg_db_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_sat, "parasail_sg_db_stats_rowcol_diag_avx512_512_sat", "sg_db_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_stats_rowcol_scan_altivec_128_64, "parasail_sg_db_stats_rowcol_scan_altivec_128_64", "sg_db_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_db_stats_rowcol_scan_altivec_128_32, "parasail_sg_db_stats_rowcol_scan_altivec_128_32", "sg_db_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -6398,6 +7539,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_stats_rowcol_diag_avx2_256_8, "parasail_sg_de_stats_rowcol_diag_avx2_256_8", "sg_de_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_de_stats_rowcol_diag_avx2_256_sat, "parasail_sg_de_stats_rowcol_diag_avx2_256_sat", "sg_de_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_stats_rowcol_scan_avx512_512_64, "parasail_sg_de_stats_rowcol_scan_avx512_512_64", "sg_de_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_avx512_512_32, "parasail_sg_de_stats_rowcol_scan_avx512_512_32", "sg_de_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_avx512_512_16, "parasail_sg_de_stats_rowcol_scan_avx512_512_16", "sg_de_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_avx512_512_8, "parasail_sg_de_stats_rowcol_scan_avx512_512_8", "sg_de_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_avx512_512_sat, "parasail_sg_de_stats_rowcol_scan_avx512_512_sat", "sg_de_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_64, "parasail_sg_de_stats_rowcol_striped_avx512_512_64", "sg_de_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_32, "parasail_sg_de_stats_rowcol_striped_avx512_512_32", "sg_de_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_16, "parasail_sg_de_stats_rowcol_striped_avx512_512_16", "sg_de_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_8, "parasail_sg_de_stats_rowcol_striped_avx512_512_8", "sg_de_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_sat, "parasail_sg_de_stats_rowcol_striped_avx512_512_sat", "sg_de_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_64, "parasail_sg_de_stats_rowcol_diag_avx512_512_64", "sg_de_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_32, "parasail_sg_de_stats_rowcol_diag_avx512_512_32", "sg_de_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_16, "parasail_sg_de_stats_rowcol_diag_avx512_512_16", "sg_de_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_8, "parasail_sg_de_stats_rowcol_diag_avx512_512_8", "sg_de_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_sat, "parasail_sg_de_stats_rowcol_diag_avx512_512_sat", "sg_de_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_stats_rowcol_scan_altivec_128_64, "parasail_sg_de_stats_rowcol_scan_altivec_128_64", "sg_de_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_de_stats_rowcol_scan_altivec_128_32, "parasail_sg_de_stats_rowcol_scan_altivec_128_32", "sg_de_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -6500,6 +7658,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_stats_rowcol_diag_avx2_256_8, "parasail_sg_dx_stats_rowcol_diag_avx2_256_8", "sg_dx_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_dx_stats_rowcol_diag_avx2_256_sat, "parasail_sg_dx_stats_rowcol_diag_avx2_256_sat", "sg_dx_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_64, "parasail_sg_dx_stats_rowcol_scan_avx512_512_64", "sg_dx_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_32, "parasail_sg_dx_stats_rowcol_scan_avx512_512_32", "sg_dx_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_16, "parasail_sg_dx_stats_rowcol_scan_avx512_512_16", "sg_dx_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_8, "parasail_sg_dx_stats_rowcol_scan_avx512_512_8", "sg_dx_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_sat, "parasail_sg_dx_stats_rowcol_scan_avx512_512_sat", "sg_dx_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_64, "parasail_sg_dx_stats_rowcol_striped_avx512_512_64", "sg_dx_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_32, "parasail_sg_dx_stats_rowcol_striped_avx512_512_32", "sg_dx_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_16, "parasail_sg_dx_stats_rowcol_striped_avx512_512_16", "sg_dx_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_8, "parasail_sg_dx_stats_rowcol_striped_avx512_512_8", "sg_dx_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_sat, "parasail_sg_dx_stats_rowcol_striped_avx512_512_sat", "sg_dx_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_64, "parasail_sg_dx_stats_rowcol_diag_avx512_512_64", "sg_dx_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_32, "parasail_sg_dx_stats_rowcol_diag_avx512_512_32", "sg_dx_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_16, "parasail_sg_dx_stats_rowcol_diag_avx512_512_16", "sg_dx_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_8, "parasail_sg_dx_stats_rowcol_diag_avx512_512_8", "sg_dx_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_sat, "parasail_sg_dx_stats_rowcol_diag_avx512_512_sat", "sg_dx_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_stats_rowcol_scan_altivec_128_64, "parasail_sg_dx_stats_rowcol_scan_altivec_128_64", "sg_dx_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_dx_stats_rowcol_scan_altivec_128_32, "parasail_sg_dx_stats_rowcol_scan_altivec_128_32", "sg_dx_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -6602,6 +7777,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_stats_rowcol_diag_avx2_256_8, "parasail_sg_qb_de_stats_rowcol_diag_avx2_256_8", "sg_qb_de_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qb_de_stats_rowcol_diag_avx2_256_sat, "parasail_sg_qb_de_stats_rowcol_diag_avx2_256_sat", "sg_qb_de_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_64, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_64", "sg_qb_de_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_32, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_32", "sg_qb_de_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_16, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_16", "sg_qb_de_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_8, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_8", "sg_qb_de_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_sat, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_sat", "sg_qb_de_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_64, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_64", "sg_qb_de_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_32, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_32", "sg_qb_de_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_16, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_16", "sg_qb_de_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_8, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_8", "sg_qb_de_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_sat, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_sat", "sg_qb_de_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_64, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_64", "sg_qb_de_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_32, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_32", "sg_qb_de_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_16, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_16", "sg_qb_de_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_8, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_8", "sg_qb_de_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_sat, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_sat", "sg_qb_de_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_stats_rowcol_scan_altivec_128_64, "parasail_sg_qb_de_stats_rowcol_scan_altivec_128_64", "sg_qb_de_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qb_de_stats_rowcol_scan_altivec_128_32, "parasail_sg_qb_de_stats_rowcol_scan_altivec_128_32", "sg_qb_de_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -6704,6 +7896,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_stats_rowcol_diag_avx2_256_8, "parasail_sg_qe_db_stats_rowcol_diag_avx2_256_8", "sg_qe_db_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qe_db_stats_rowcol_diag_avx2_256_sat, "parasail_sg_qe_db_stats_rowcol_diag_avx2_256_sat", "sg_qe_db_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_64, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_64", "sg_qe_db_stats",    "scan", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_32, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_32", "sg_qe_db_stats",    "scan", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_16, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_16", "sg_qe_db_stats",    "scan", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_8, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_8", "sg_qe_db_stats",    "scan", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_sat, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_sat", "sg_qe_db_stats",    "scan", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_64, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_64", "sg_qe_db_stats", "striped", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_32, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_32", "sg_qe_db_stats", "striped", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_16, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_16", "sg_qe_db_stats", "striped", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_8, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_8", "sg_qe_db_stats", "striped", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_sat, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_sat", "sg_qe_db_stats", "striped", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_64, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_64", "sg_qe_db_stats",    "diag", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_32, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_32", "sg_qe_db_stats",    "diag", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_16, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_16", "sg_qe_db_stats",    "diag", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_8, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_8", "sg_qe_db_stats",    "diag", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_sat, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_sat", "sg_qe_db_stats",    "diag", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_stats_rowcol_scan_altivec_128_64, "parasail_sg_qe_db_stats_rowcol_scan_altivec_128_64", "sg_qe_db_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qe_db_stats_rowcol_scan_altivec_128_32, "parasail_sg_qe_db_stats_rowcol_scan_altivec_128_32", "sg_qe_db_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -6755,6 +7964,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_stats_rowcol_diag_sat, "parasail_sg_qe_db_stats_rowcol_diag_sat", "sg_qe_db_stats",    "diag", "disp",   "NA", "sat", -1, 0, 1, 0, 1, 0},
 {parasail_nw_trace,                   "parasail_nw_trace",                   "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_nw_trace_scan,              "parasail_nw_trace_scan",              "nw",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_nw_trace_linear,            "parasail_nw_trace_linear",            "nw",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_nw_trace_scan_sse2_128_64,  "parasail_nw_trace_scan_sse2_128_64",  "nw",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_nw_trace_scan_sse2_128_32,  "parasail_nw_trace_scan_sse2_128_32",  "nw",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -6806,6 +8016,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_trace_diag_avx2_256_8,   "parasail_nw_trace_diag_avx2_256_8",   "nw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_nw_trace_diag_avx2_256_sat, "parasail_nw_trace_diag_avx2_256_sat", "nw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_trace_scan_avx512_512_64, "parasail_nw_trace_scan_avx512_512_64", "nw",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512_512_32, "parasail_nw_trace_scan_avx512_512_32", "nw",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512_512_16, "parasail_nw_trace_scan_avx512_512_16", "nw",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512_512_8, "parasail_nw_trace_scan_avx512_512_8", "nw",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512_512_sat, "parasail_nw_trace_scan_avx512_512_sat", "nw",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_64, "parasail_nw_trace_striped_avx512_512_64", "nw", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_32, "parasail_nw_trace_striped_avx512_512_32", "nw", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_16, "parasail_nw_trace_striped_avx512_512_16", "nw", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_8, "parasail_nw_trace_striped_avx512_512_8", "nw", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_sat, "parasail_nw_trace_striped_avx512_512_sat", "nw", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_64, "parasail_nw_trace_diag_avx512_512_64", "nw",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_32, "parasail_nw_trace_diag_avx512_512_32", "nw",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_16, "parasail_nw_trace_diag_avx512_512_16", "nw",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_8, "parasail_nw_trace_diag_avx512_512_8", "nw",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_sat, "parasail_nw_trace_diag_avx512_512_sat", "nw",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_trace_scan_altivec_128_64, "parasail_nw_trace_scan_altivec_128_64", "nw",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_nw_trace_scan_altivec_128_32, "parasail_nw_trace_scan_altivec_128_32", "nw",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -6857,6 +8084,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_trace_diag_sat,          "parasail_nw_trace_diag_sat",          "nw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_trace,                   "parasail_sg_trace",                   "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_trace_scan,              "parasail_sg_trace_scan",              "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_trace_linear,            "parasail_sg_trace_linear",            "sg",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_trace_scan_sse2_128_64,  "parasail_sg_trace_scan_sse2_128_64",  "sg",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_trace_scan_sse2_128_32,  "parasail_sg_trace_scan_sse2_128_32",  "sg",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -6908,6 +8136,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_trace_diag_avx2_256_8,   "parasail_sg_trace_diag_avx2_256_8",   "sg",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_trace_diag_avx2_256_sat, "parasail_sg_trace_diag_avx2_256_sat", "sg",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_trace_scan_avx512_512_64, "parasail_sg_trace_scan_avx512_512_64", "sg",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512_512_32, "parasail_sg_trace_scan_avx512_512_32", "sg",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512_512_16, "parasail_sg_trace_scan_avx512_512_16", "sg",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512_512_8, "parasail_sg_trace_scan_avx512_512_8", "sg",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512_512_sat, "parasail_sg_trace_scan_avx512_512_sat", "sg",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_64, "parasail_sg_trace_striped_avx512_512_64", "sg", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_32, "parasail_sg_trace_striped_avx512_512_32", "sg", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_16, "parasail_sg_trace_striped_avx512_512_16", "sg", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_8, "parasail_sg_trace_striped_avx512_512_8", "sg", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_sat, "parasail_sg_trace_striped_avx512_512_sat", "sg", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_64, "parasail_sg_trace_diag_avx512_512_64", "sg",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_32, "parasail_sg_trace_diag_avx512_512_32", "sg",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_16, "parasail_sg_trace_diag_avx512_512_16", "sg",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_8, "parasail_sg_trace_diag_avx512_512_8", "sg",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_sat, "parasail_sg_trace_diag_avx512_512_sat", "sg",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_trace_scan_altivec_128_64, "parasail_sg_trace_scan_altivec_128_64", "sg",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_trace_scan_altivec_128_32, "parasail_sg_trace_scan_altivec_128_32", "sg",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -6959,6 +8204,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_trace_diag_sat,          "parasail_sg_trace_diag_sat",          "sg",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sw_trace,                   "parasail_sw_trace",                   "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sw_trace_scan,              "parasail_sw_trace_scan",              "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sw_trace_linear,            "parasail_sw_trace_linear",            "sw",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sw_trace_scan_sse2_128_64,  "parasail_sw_trace_scan_sse2_128_64",  "sw",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sw_trace_scan_sse2_128_32,  "parasail_sw_trace_scan_sse2_128_32",  "sw",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7010,6 +8256,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_trace_diag_avx2_256_8,   "parasail_sw_trace_diag_avx2_256_8",   "sw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sw_trace_diag_avx2_256_sat, "parasail_sw_trace_diag_avx2_256_sat", "sw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_trace_scan_avx512_512_64, "parasail_sw_trace_scan_avx512_512_64", "sw",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512_512_32, "parasail_sw_trace_scan_avx512_512_32", "sw",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512_512_16, "parasail_sw_trace_scan_avx512_512_16", "sw",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512_512_8, "parasail_sw_trace_scan_avx512_512_8", "sw",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512_512_sat, "parasail_sw_trace_scan_avx512_512_sat", "sw",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_64, "parasail_sw_trace_striped_avx512_512_64", "sw", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_32, "parasail_sw_trace_striped_avx512_512_32", "sw", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_16, "parasail_sw_trace_striped_avx512_512_16", "sw", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_8, "parasail_sw_trace_striped_avx512_512_8", "sw", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_sat, "parasail_sw_trace_striped_avx512_512_sat", "sw", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_64, "parasail_sw_trace_diag_avx512_512_64", "sw",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_32, "parasail_sw_trace_diag_avx512_512_32", "sw",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_16, "parasail_sw_trace_diag_avx512_512_16", "sw",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_8, "parasail_sw_trace_diag_avx512_512_8", "sw",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_sat, "parasail_sw_trace_diag_avx512_512_sat", "sw",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_trace_scan_altivec_128_64, "parasail_sw_trace_scan_altivec_128_64", "sw",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sw_trace_scan_altivec_128_32, "parasail_sw_trace_scan_altivec_128_32", "sw",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7061,6 +8324,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_trace_diag_sat,          "parasail_sw_trace_diag_sat",          "sw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_qb_trace,                "parasail_sg_qb_trace",                "sg_qb",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_qb_trace_scan,           "parasail_sg_qb_trace_scan",           "sg_qb",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_linear,         "parasail_sg_qb_trace_linear",         "sg_qb",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qb_trace_scan_sse2_128_64, "parasail_sg_qb_trace_scan_sse2_128_64", "sg_qb",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qb_trace_scan_sse2_128_32, "parasail_sg_qb_trace_scan_sse2_128_32", "sg_qb",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7112,6 +8376,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_trace_diag_avx2_256_8, "parasail_sg_qb_trace_diag_avx2_256_8", "sg_qb",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qb_trace_diag_avx2_256_sat, "parasail_sg_qb_trace_diag_avx2_256_sat", "sg_qb",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_trace_scan_avx512_512_64, "parasail_sg_qb_trace_scan_avx512_512_64", "sg_qb",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_avx512_512_32, "parasail_sg_qb_trace_scan_avx512_512_32", "sg_qb",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_avx512_512_16, "parasail_sg_qb_trace_scan_avx512_512_16", "sg_qb",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_avx512_512_8, "parasail_sg_qb_trace_scan_avx512_512_8", "sg_qb",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_avx512_512_sat, "parasail_sg_qb_trace_scan_avx512_512_sat", "sg_qb",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_64, "parasail_sg_qb_trace_striped_avx512_512_64", "sg_qb", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_32, "parasail_sg_qb_trace_striped_avx512_512_32", "sg_qb", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_16, "parasail_sg_qb_trace_striped_avx512_512_16", "sg_qb", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_8, "parasail_sg_qb_trace_striped_avx512_512_8", "sg_qb", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_sat, "parasail_sg_qb_trace_striped_avx512_512_sat", "sg_qb", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_64, "parasail_sg_qb_trace_diag_avx512_512_64", "sg_qb",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_32, "parasail_sg_qb_trace_diag_avx512_512_32", "sg_qb",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_16, "parasail_sg_qb_trace_diag_avx512_512_16", "sg_qb",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_8, "parasail_sg_qb_trace_diag_avx512_512_8", "sg_qb",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_sat, "parasail_sg_qb_trace_diag_avx512_512_sat", "sg_qb",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_trace_scan_altivec_128_64, "parasail_sg_qb_trace_scan_altivec_128_64", "sg_qb",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qb_trace_scan_altivec_128_32, "parasail_sg_qb_trace_scan_altivec_128_32", "sg_qb",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7163,6 +8444,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_trace_diag_sat,       "parasail_sg_qb_trace_diag_sat",       "sg_qb",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_qe_trace,                "parasail_sg_qe_trace",                "sg_qe",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_qe_trace_scan,           "parasail_sg_qe_trace_scan",           "sg_qe",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_linear,         "parasail_sg_qe_trace_linear",         "sg_qe",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qe_trace_scan_sse2_128_64, "parasail_sg_qe_trace_scan_sse2_128_64", "sg_qe",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qe_trace_scan_sse2_128_32, "parasail_sg_qe_trace_scan_sse2_128_32", "sg_qe",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7214,6 +8496,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_trace_diag_avx2_256_8, "parasail_sg_qe_trace_diag_avx2_256_8", "sg_qe",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qe_trace_diag_avx2_256_sat, "parasail_sg_qe_trace_diag_avx2_256_sat", "sg_qe",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_trace_scan_avx512_512_64, "parasail_sg_qe_trace_scan_avx512_512_64", "sg_qe",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_avx512_512_32, "parasail_sg_qe_trace_scan_avx512_512_32", "sg_qe",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_avx512_512_16, "parasail_sg_qe_trace_scan_avx512_512_16", "sg_qe",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_avx512_512_8, "parasail_sg_qe_trace_scan_avx512_512_8", "sg_qe",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_avx512_512_sat, "parasail_sg_qe_trace_scan_avx512_512_sat", "sg_qe",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_64, "parasail_sg_qe_trace_striped_avx512_512_64", "sg_qe", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_32, "parasail_sg_qe_trace_striped_avx512_512_32", "sg_qe", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_16, "parasail_sg_qe_trace_striped_avx512_512_16", "sg_qe", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_8, "parasail_sg_qe_trace_striped_avx512_512_8", "sg_qe", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_sat, "parasail_sg_qe_trace_striped_avx512_512_sat", "sg_qe", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_64, "parasail_sg_qe_trace_diag_avx512_512_64", "sg_qe",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_32, "parasail_sg_qe_trace_diag_avx512_512_32", "sg_qe",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_16, "parasail_sg_qe_trace_diag_avx512_512_16", "sg_qe",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_8, "parasail_sg_qe_trace_diag_avx512_512_8", "sg_qe",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_sat, "parasail_sg_qe_trace_diag_avx512_512_sat", "sg_qe",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_trace_scan_altivec_128_64, "parasail_sg_qe_trace_scan_altivec_128_64", "sg_qe",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qe_trace_scan_altivec_128_32, "parasail_sg_qe_trace_scan_altivec_128_32", "sg_qe",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7265,6 +8564,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_trace_diag_sat,       "parasail_sg_qe_trace_diag_sat",       "sg_qe",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_qx_trace,                "parasail_sg_qx_trace",                "sg_qx",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_qx_trace_scan,           "parasail_sg_qx_trace_scan",           "sg_qx",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_linear,         "parasail_sg_qx_trace_linear",         "sg_qx",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qx_trace_scan_sse2_128_64, "parasail_sg_qx_trace_scan_sse2_128_64", "sg_qx",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qx_trace_scan_sse2_128_32, "parasail_sg_qx_trace_scan_sse2_128_32", "sg_qx",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7316,6 +8616,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_trace_diag_avx2_256_8, "parasail_sg_qx_trace_diag_avx2_256_8", "sg_qx",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qx_trace_diag_avx2_256_sat, "parasail_sg_qx_trace_diag_avx2_256_sat", "sg_qx",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_trace_scan_avx512_512_64, "parasail_sg_qx_trace_scan_avx512_512_64", "sg_qx",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_avx512_512_32, "parasail_sg_qx_trace_scan_avx512_512_32", "sg_qx",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_avx512_512_16, "parasail_sg_qx_trace_scan_avx512_512_16", "sg_qx",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_avx512_512_8, "parasail_sg_qx_trace_scan_avx512_512_8", "sg_qx",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_avx512_512_sat, "parasail_sg_qx_trace_scan_avx512_512_sat", "sg_qx",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_64, "parasail_sg_qx_trace_striped_avx512_512_64", "sg_qx", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_32, "parasail_sg_qx_trace_striped_avx512_512_32", "sg_qx", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_16, "parasail_sg_qx_trace_striped_avx512_512_16", "sg_qx", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_8, "parasail_sg_qx_trace_striped_avx512_512_8", "sg_qx", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_sat, "parasail_sg_qx_trace_striped_avx512_512_sat", "sg_qx", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_64, "parasail_sg_qx_trace_diag_avx512_512_64", "sg_qx",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_32, "parasail_sg_qx_trace_diag_avx512_512_32", "sg_qx",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_16, "parasail_sg_qx_trace_diag_avx512_512_16", "sg_qx",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_8, "parasail_sg_qx_trace_diag_avx512_512_8", "sg_qx",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_sat, "parasail_sg_qx_trace_diag_avx512_512_sat", "sg_qx",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_trace_scan_altivec_128_64, "parasail_sg_qx_trace_scan_altivec_128_64", "sg_qx",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qx_trace_scan_altivec_128_32, "parasail_sg_qx_trace_scan_altivec_128_32", "sg_qx",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7367,6 +8684,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qx_trace_diag_sat,       "parasail_sg_qx_trace_diag_sat",       "sg_qx",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_db_trace,                "parasail_sg_db_trace",                "sg_db",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_db_trace_scan,           "parasail_sg_db_trace_scan",           "sg_db",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_linear,         "parasail_sg_db_trace_linear",         "sg_db",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_db_trace_scan_sse2_128_64, "parasail_sg_db_trace_scan_sse2_128_64", "sg_db",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_db_trace_scan_sse2_128_32, "parasail_sg_db_trace_scan_sse2_128_32", "sg_db",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7418,6 +8736,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_trace_diag_avx2_256_8, "parasail_sg_db_trace_diag_avx2_256_8", "sg_db",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_db_trace_diag_avx2_256_sat, "parasail_sg_db_trace_diag_avx2_256_sat", "sg_db",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_trace_scan_avx512_512_64, "parasail_sg_db_trace_scan_avx512_512_64", "sg_db",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_avx512_512_32, "parasail_sg_db_trace_scan_avx512_512_32", "sg_db",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_avx512_512_16, "parasail_sg_db_trace_scan_avx512_512_16", "sg_db",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_avx512_512_8, "parasail_sg_db_trace_scan_avx512_512_8", "sg_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_avx512_512_sat, "parasail_sg_db_trace_scan_avx512_512_sat", "sg_db",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_64, "parasail_sg_db_trace_striped_avx512_512_64", "sg_db", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_32, "parasail_sg_db_trace_striped_avx512_512_32", "sg_db", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_16, "parasail_sg_db_trace_striped_avx512_512_16", "sg_db", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_8, "parasail_sg_db_trace_striped_avx512_512_8", "sg_db", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_sat, "parasail_sg_db_trace_striped_avx512_512_sat", "sg_db", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_64, "parasail_sg_db_trace_diag_avx512_512_64", "sg_db",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_32, "parasail_sg_db_trace_diag_avx512_512_32", "sg_db",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_16, "parasail_sg_db_trace_diag_avx512_512_16", "sg_db",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_8, "parasail_sg_db_trace_diag_avx512_512_8", "sg_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_sat, "parasail_sg_db_trace_diag_avx512_512_sat", "sg_db",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_trace_scan_altivec_128_64, "parasail_sg_db_trace_scan_altivec_128_64", "sg_db",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_db_trace_scan_altivec_128_32, "parasail_sg_db_trace_scan_altivec_128_32", "sg_db",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7469,6 +8804,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_db_trace_diag_sat,       "parasail_sg_db_trace_diag_sat",       "sg_db",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_de_trace,                "parasail_sg_de_trace",                "sg_de",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_de_trace_scan,           "parasail_sg_de_trace_scan",           "sg_de",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_linear,         "parasail_sg_de_trace_linear",         "sg_de",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_de_trace_scan_sse2_128_64, "parasail_sg_de_trace_scan_sse2_128_64", "sg_de",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_de_trace_scan_sse2_128_32, "parasail_sg_de_trace_scan_sse2_128_32", "sg_de",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7520,6 +8856,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_trace_diag_avx2_256_8, "parasail_sg_de_trace_diag_avx2_256_8", "sg_de",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_de_trace_diag_avx2_256_sat, "parasail_sg_de_trace_diag_avx2_256_sat", "sg_de",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_trace_scan_avx512_512_64, "parasail_sg_de_trace_scan_avx512_512_64", "sg_de",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_avx512_512_32, "parasail_sg_de_trace_scan_avx512_512_32", "sg_de",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_avx512_512_16, "parasail_sg_de_trace_scan_avx512_512_16", "sg_de",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_avx512_512_8, "parasail_sg_de_trace_scan_avx512_512_8", "sg_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_avx512_512_sat, "parasail_sg_de_trace_scan_avx512_512_sat", "sg_de",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_64, "parasail_sg_de_trace_striped_avx512_512_64", "sg_de", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_32, "parasail_sg_de_trace_striped_avx512_512_32", "sg_de", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_16, "parasail_sg_de_trace_striped_avx512_512_16", "sg_de", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_8, "parasail_sg_de_trace_striped_avx512_512_8", "sg_de", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_sat, "parasail_sg_de_trace_striped_avx512_512_sat", "sg_de", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_64, "parasail_sg_de_trace_diag_avx512_512_64", "sg_de",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_32, "parasail_sg_de_trace_diag_avx512_512_32", "sg_de",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_16, "parasail_sg_de_trace_diag_avx512_512_16", "sg_de",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_8, "parasail_sg_de_trace_diag_avx512_512_8", "sg_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_sat, "parasail_sg_de_trace_diag_avx512_512_sat", "sg_de",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_trace_scan_altivec_128_64, "parasail_sg_de_trace_scan_altivec_128_64", "sg_de",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_de_trace_scan_altivec_128_32, "parasail_sg_de_trace_scan_altivec_128_32", "sg_de",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7571,6 +8924,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_de_trace_diag_sat,       "parasail_sg_de_trace_diag_sat",       "sg_de",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_dx_trace,                "parasail_sg_dx_trace",                "sg_dx",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_dx_trace_scan,           "parasail_sg_dx_trace_scan",           "sg_dx",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_linear,         "parasail_sg_dx_trace_linear",         "sg_dx",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_dx_trace_scan_sse2_128_64, "parasail_sg_dx_trace_scan_sse2_128_64", "sg_dx",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_dx_trace_scan_sse2_128_32, "parasail_sg_dx_trace_scan_sse2_128_32", "sg_dx",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7622,6 +8976,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_trace_diag_avx2_256_8, "parasail_sg_dx_trace_diag_avx2_256_8", "sg_dx",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_dx_trace_diag_avx2_256_sat, "parasail_sg_dx_trace_diag_avx2_256_sat", "sg_dx",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_trace_scan_avx512_512_64, "parasail_sg_dx_trace_scan_avx512_512_64", "sg_dx",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_avx512_512_32, "parasail_sg_dx_trace_scan_avx512_512_32", "sg_dx",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_avx512_512_16, "parasail_sg_dx_trace_scan_avx512_512_16", "sg_dx",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_avx512_512_8, "parasail_sg_dx_trace_scan_avx512_512_8", "sg_dx",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_avx512_512_sat, "parasail_sg_dx_trace_scan_avx512_512_sat", "sg_dx",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_64, "parasail_sg_dx_trace_striped_avx512_512_64", "sg_dx", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_32, "parasail_sg_dx_trace_striped_avx512_512_32", "sg_dx", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_16, "parasail_sg_dx_trace_striped_avx512_512_16", "sg_dx", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_8, "parasail_sg_dx_trace_striped_avx512_512_8", "sg_dx", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_sat, "parasail_sg_dx_trace_striped_avx512_512_sat", "sg_dx", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_64, "parasail_sg_dx_trace_diag_avx512_512_64", "sg_dx",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_32, "parasail_sg_dx_trace_diag_avx512_512_32", "sg_dx",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_16, "parasail_sg_dx_trace_diag_avx512_512_16", "sg_dx",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_8, "parasail_sg_dx_trace_diag_avx512_512_8", "sg_dx",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_sat, "parasail_sg_dx_trace_diag_avx512_512_sat", "sg_dx",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_trace_scan_altivec_128_64, "parasail_sg_dx_trace_scan_altivec_128_64", "sg_dx",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_dx_trace_scan_altivec_128_32, "parasail_sg_dx_trace_scan_altivec_128_32", "sg_dx",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7673,6 +9044,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_dx_trace_diag_sat,       "parasail_sg_dx_trace_diag_sat",       "sg_dx",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_qb_de_trace,             "parasail_sg_qb_de_trace",             "sg_qb_de",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_qb_de_trace_scan,        "parasail_sg_qb_de_trace_scan",        "sg_qb_de",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_linear,      "parasail_sg_qb_de_trace_linear",      "sg_qb_de",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qb_de_trace_scan_sse2_128_64, "parasail_sg_qb_de_trace_scan_sse2_128_64", "sg_qb_de",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qb_de_trace_scan_sse2_128_32, "parasail_sg_qb_de_trace_scan_sse2_128_32", "sg_qb_de",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7724,6 +9096,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_trace_diag_avx2_256_8, "parasail_sg_qb_de_trace_diag_avx2_256_8", "sg_qb_de",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qb_de_trace_diag_avx2_256_sat, "parasail_sg_qb_de_trace_diag_avx2_256_sat", "sg_qb_de",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_trace_scan_avx512_512_64, "parasail_sg_qb_de_trace_scan_avx512_512_64", "sg_qb_de",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_avx512_512_32, "parasail_sg_qb_de_trace_scan_avx512_512_32", "sg_qb_de",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_avx512_512_16, "parasail_sg_qb_de_trace_scan_avx512_512_16", "sg_qb_de",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_avx512_512_8, "parasail_sg_qb_de_trace_scan_avx512_512_8", "sg_qb_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_avx512_512_sat, "parasail_sg_qb_de_trace_scan_avx512_512_sat", "sg_qb_de",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_64, "parasail_sg_qb_de_trace_striped_avx512_512_64", "sg_qb_de", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_32, "parasail_sg_qb_de_trace_striped_avx512_512_32", "sg_qb_de", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_16, "parasail_sg_qb_de_trace_striped_avx512_512_16", "sg_qb_de", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_8, "parasail_sg_qb_de_trace_striped_avx512_512_8", "sg_qb_de", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_sat, "parasail_sg_qb_de_trace_striped_avx512_512_sat", "sg_qb_de", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_64, "parasail_sg_qb_de_trace_diag_avx512_512_64", "sg_qb_de",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_32, "parasail_sg_qb_de_trace_diag_avx512_512_32", "sg_qb_de",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_16, "parasail_sg_qb_de_trace_diag_avx512_512_16", "sg_qb_de",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_8, "parasail_sg_qb_de_trace_diag_avx512_512_8", "sg_qb_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_sat, "parasail_sg_qb_de_trace_diag_avx512_512_sat", "sg_qb_de",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_trace_scan_altivec_128_64, "parasail_sg_qb_de_trace_scan_altivec_128_64", "sg_qb_de",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qb_de_trace_scan_altivec_128_32, "parasail_sg_qb_de_trace_scan_altivec_128_32", "sg_qb_de",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7775,6 +9164,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qb_de_trace_diag_sat,    "parasail_sg_qb_de_trace_diag_sat",    "sg_qb_de",    "diag", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
 {parasail_sg_qe_db_trace,             "parasail_sg_qe_db_trace",             "sg_qe_db",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
 {parasail_sg_qe_db_trace_scan,        "parasail_sg_qe_db_trace_scan",        "sg_qe_db",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_linear,      "parasail_sg_qe_db_trace_linear",      "sg_qe_db",  "linear", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qe_db_trace_scan_sse2_128_64, "parasail_sg_qe_db_trace_scan_sse2_128_64", "sg_qe_db",    "scan", "sse2",  "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qe_db_trace_scan_sse2_128_32, "parasail_sg_qe_db_trace_scan_sse2_128_32", "sg_qe_db",    "scan", "sse2",  "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7826,6 +9216,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_qe_db_trace_diag_avx2_256_8, "parasail_sg_qe_db_trace_diag_avx2_256_8", "sg_qe_db",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qe_db_trace_diag_avx2_256_sat, "parasail_sg_qe_db_trace_diag_avx2_256_sat", "sg_qe_db",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_trace_scan_avx512_512_64, "parasail_sg_qe_db_trace_scan_avx512_512_64", "sg_qe_db",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_avx512_512_32, "parasail_sg_qe_db_trace_scan_avx512_512_32", "sg_qe_db",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_avx512_512_16, "parasail_sg_qe_db_trace_scan_avx512_512_16", "sg_qe_db",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_avx512_512_8, "parasail_sg_qe_db_trace_scan_avx512_512_8", "sg_qe_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_avx512_512_sat, "parasail_sg_qe_db_trace_scan_avx512_512_sat", "sg_qe_db",    "scan", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_64, "parasail_sg_qe_db_trace_striped_avx512_512_64", "sg_qe_db", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_32, "parasail_sg_qe_db_trace_striped_avx512_512_32", "sg_qe_db", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_16, "parasail_sg_qe_db_trace_striped_avx512_512_16", "sg_qe_db", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_8, "parasail_sg_qe_db_trace_striped_avx512_512_8", "sg_qe_db", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_sat, "parasail_sg_qe_db_trace_striped_avx512_512_sat", "sg_qe_db", "striped", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_64, "parasail_sg_qe_db_trace_diag_avx512_512_64", "sg_qe_db",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_32, "parasail_sg_qe_db_trace_diag_avx512_512_32", "sg_qe_db",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_16, "parasail_sg_qe_db_trace_diag_avx512_512_16", "sg_qe_db",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_8, "parasail_sg_qe_db_trace_diag_avx512_512_8", "sg_qe_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_sat, "parasail_sg_qe_db_trace_diag_avx512_512_sat", "sg_qe_db",    "diag", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_trace_scan_altivec_128_64, "parasail_sg_qe_db_trace_scan_altivec_128_64", "sg_qe_db",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qe_db_trace_scan_altivec_128_32, "parasail_sg_qe_db_trace_scan_altivec_128_32", "sg_qe_db",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -7915,6 +9322,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_nw_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_nw_scan_profile_avx512_512_64", "nw", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_nw_scan_profile_avx512_512_32", "nw", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_nw_scan_profile_avx512_512_16", "nw", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_nw_scan_profile_avx512_512_8", "nw", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_nw_scan_profile_avx512_512_sat", "nw", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_nw_striped_profile_avx512_512_64", "nw", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_nw_striped_profile_avx512_512_32", "nw", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_nw_striped_profile_avx512_512_16", "nw", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_nw_striped_profile_avx512_512_8", "nw", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_nw_striped_profile_avx512_512_sat", "nw", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_nw_scan_profile_altivec_128_64", "nw", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_nw_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_nw_scan_profile_altivec_128_32", "nw", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -7944,11 +9363,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_scan_profile_16,         parasail_profile_create_16,          "parasail_nw_scan_profile_16",         "nw", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_nw_scan_profile_8,          parasail_profile_create_8,           "parasail_nw_scan_profile_8",          "nw", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_nw_scan_profile_sat,        parasail_profile_create_sat,         "parasail_nw_scan_profile_sat",        "nw", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_auto,       parasail_profile_create_sat,         "parasail_nw_scan_profile_auto",       "nw", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_profile_64,      parasail_profile_create_64,          "parasail_nw_striped_profile_64",      "nw", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_profile_32,      parasail_profile_create_32,          "parasail_nw_striped_profile_32",      "nw", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_profile_16,      parasail_profile_create_16,          "parasail_nw_striped_profile_16",      "nw", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_profile_8,       parasail_profile_create_8,           "parasail_nw_striped_profile_8",       "nw", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_nw_striped_profile_sat,     parasail_profile_create_sat,         "parasail_nw_striped_profile_sat",     "nw", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_auto,    parasail_profile_create_sat,         "parasail_nw_striped_profile_auto",    "nw", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_scan_profile_sse2_128_64", "sg", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_scan_profile_sse2_128_32", "sg", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -7985,6 +9406,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_scan_profile_avx512_512_64", "sg", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_scan_profile_avx512_512_32", "sg", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_scan_profile_avx512_512_16", "sg", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_scan_profile_avx512_512_8", "sg", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_scan_profile_avx512_512_sat", "sg", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_striped_profile_avx512_512_64", "sg", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_striped_profile_avx512_512_32", "sg", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_striped_profile_avx512_512_16", "sg", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_striped_profile_avx512_512_8", "sg", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_striped_profile_avx512_512_sat", "sg", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_scan_profile_altivec_128_64", "sg", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_scan_profile_altivec_128_32", "sg", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8014,11 +9447,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_scan_profile_16,         parasail_profile_create_16,          "parasail_sg_scan_profile_16",         "sg", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_scan_profile_8,          parasail_profile_create_8,           "parasail_sg_scan_profile_8",          "sg", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_scan_profile_sat,        parasail_profile_create_sat,         "parasail_sg_scan_profile_sat",        "sg", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_auto,       parasail_profile_create_sat,         "parasail_sg_scan_profile_auto",       "sg", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_profile_64,      parasail_profile_create_64,          "parasail_sg_striped_profile_64",      "sg", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_profile_32,      parasail_profile_create_32,          "parasail_sg_striped_profile_32",      "sg", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_profile_16,      parasail_profile_create_16,          "parasail_sg_striped_profile_16",      "sg", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_profile_8,       parasail_profile_create_8,           "parasail_sg_striped_profile_8",       "sg", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_striped_profile_sat,     parasail_profile_create_sat,         "parasail_sg_striped_profile_sat",     "sg", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_auto,    parasail_profile_create_sat,         "parasail_sg_striped_profile_auto",    "sg", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sw_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_scan_profile_sse2_128_64", "sw", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sw_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_scan_profile_sse2_128_32", "sw", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8055,6 +9490,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sw_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sw_scan_profile_avx512_512_64", "sw", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sw_scan_profile_avx512_512_32", "sw", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sw_scan_profile_avx512_512_16", "sw", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sw_scan_profile_avx512_512_8", "sw", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sw_scan_profile_avx512_512_sat", "sw", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sw_striped_profile_avx512_512_64", "sw", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sw_striped_profile_avx512_512_32", "sw", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sw_striped_profile_avx512_512_16", "sw", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sw_striped_profile_avx512_512_8", "sw", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sw_striped_profile_avx512_512_sat", "sw", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sw_scan_profile_altivec_128_64", "sw", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sw_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sw_scan_profile_altivec_128_32", "sw", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8084,11 +9531,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_scan_profile_16,         parasail_profile_create_16,          "parasail_sw_scan_profile_16",         "sw", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sw_scan_profile_8,          parasail_profile_create_8,           "parasail_sw_scan_profile_8",          "sw", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sw_scan_profile_sat,        parasail_profile_create_sat,         "parasail_sw_scan_profile_sat",        "sw", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_auto,       parasail_profile_create_sat,         "parasail_sw_scan_profile_auto",       "sw", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_profile_64,      parasail_profile_create_64,          "parasail_sw_striped_profile_64",      "sw", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_profile_32,      parasail_profile_create_32,          "parasail_sw_striped_profile_32",      "sw", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_profile_16,      parasail_profile_create_16,          "parasail_sw_striped_profile_16",      "sw", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_profile_8,       parasail_profile_create_8,           "parasail_sw_striped_profile_8",       "sw", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sw_striped_profile_sat,     parasail_profile_create_sat,         "parasail_sw_striped_profile_sat",     "sw", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_auto,    parasail_profile_create_sat,         "parasail_sw_striped_profile_auto",    "sw", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qb_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_qb_scan_profile_sse2_128_64", "sg_qb", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qb_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_qb_scan_profile_sse2_128_32", "sg_qb", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8125,6 +9574,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qb_striped_profile_avx2_256_8", "sg_qb", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qb_striped_profile_avx2_256_sat", "sg_qb", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_scan_profile_avx512_512_64", "sg_qb", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_scan_profile_avx512_512_32", "sg_qb", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_scan_profile_avx512_512_16", "sg_qb", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_scan_profile_avx512_512_8", "sg_qb", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_scan_profile_avx512_512_sat", "sg_qb", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_striped_profile_avx512_512_64", "sg_qb", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_striped_profile_avx512_512_32", "sg_qb", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_striped_profile_avx512_512_16", "sg_qb", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_striped_profile_avx512_512_8", "sg_qb", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_striped_profile_avx512_512_sat", "sg_qb", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qb_scan_profile_altivec_128_64", "sg_qb", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qb_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qb_scan_profile_altivec_128_32", "sg_qb", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8154,11 +9615,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_scan_profile_16,      parasail_profile_create_16,          "parasail_sg_qb_scan_profile_16",      "sg_qb", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_scan_profile_8,       parasail_profile_create_8,           "parasail_sg_qb_scan_profile_8",       "sg_qb", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_scan_profile_sat,     parasail_profile_create_sat,         "parasail_sg_qb_scan_profile_sat",     "sg_qb", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_profile_auto,    parasail_profile_create_sat,         "parasail_sg_qb_scan_profile_auto",    "sg_qb", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_profile_64,   parasail_profile_create_64,          "parasail_sg_qb_striped_profile_64",   "sg_qb", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_profile_32,   parasail_profile_create_32,          "parasail_sg_qb_striped_profile_32",   "sg_qb", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_profile_16,   parasail_profile_create_16,          "parasail_sg_qb_striped_profile_16",   "sg_qb", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_profile_8,    parasail_profile_create_8,           "parasail_sg_qb_striped_profile_8",    "sg_qb", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_striped_profile_sat,  parasail_profile_create_sat,         "parasail_sg_qb_striped_profile_sat",  "sg_qb", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_profile_auto, parasail_profile_create_sat,         "parasail_sg_qb_striped_profile_auto", "sg_qb", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qe_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_qe_scan_profile_sse2_128_64", "sg_qe", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qe_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_qe_scan_profile_sse2_128_32", "sg_qe", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8195,6 +9658,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qe_striped_profile_avx2_256_8", "sg_qe", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qe_striped_profile_avx2_256_sat", "sg_qe", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_scan_profile_avx512_512_64", "sg_qe", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_scan_profile_avx512_512_32", "sg_qe", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_scan_profile_avx512_512_16", "sg_qe", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_scan_profile_avx512_512_8", "sg_qe", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_scan_profile_avx512_512_sat", "sg_qe", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_striped_profile_avx512_512_64", "sg_qe", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_striped_profile_avx512_512_32", "sg_qe", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_striped_profile_avx512_512_16", "sg_qe", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_striped_profile_avx512_512_8", "sg_qe", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_striped_profile_avx512_512_sat", "sg_qe", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qe_scan_profile_altivec_128_64", "sg_qe", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qe_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qe_scan_profile_altivec_128_32", "sg_qe", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8224,11 +9699,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_scan_profile_16,      parasail_profile_create_16,          "parasail_sg_qe_scan_profile_16",      "sg_qe", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_scan_profile_8,       parasail_profile_create_8,           "parasail_sg_qe_scan_profile_8",       "sg_qe", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_scan_profile_sat,     parasail_profile_create_sat,         "parasail_sg_qe_scan_profile_sat",     "sg_qe", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_profile_auto,    parasail_profile_create_sat,         "parasail_sg_qe_scan_profile_auto",    "sg_qe", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_profile_64,   parasail_profile_create_64,          "parasail_sg_qe_striped_profile_64",   "sg_qe", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_profile_32,   parasail_profile_create_32,          "parasail_sg_qe_striped_profile_32",   "sg_qe", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_profile_16,   parasail_profile_create_16,          "parasail_sg_qe_striped_profile_16",   "sg_qe", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_profile_8,    parasail_profile_create_8,           "parasail_sg_qe_striped_profile_8",    "sg_qe", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_striped_profile_sat,  parasail_profile_create_sat,         "parasail_sg_qe_striped_profile_sat",  "sg_qe", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_profile_auto, parasail_profile_create_sat,         "parasail_sg_qe_striped_profile_auto", "sg_qe", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qx_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_qx_scan_profile_sse2_128_64", "sg_qx", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qx_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_qx_scan_profile_sse2_128_32", "sg_qx", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8265,6 +9742,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qx_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qx_striped_profile_avx2_256_8", "sg_qx", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qx_striped_profile_avx2_256_sat", "sg_qx", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qx_scan_profile_avx512_512_64", "sg_qx", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qx_scan_profile_avx512_512_32", "sg_qx", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qx_scan_profile_avx512_512_16", "sg_qx", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qx_scan_profile_avx512_512_8", "sg_qx", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qx_scan_profile_avx512_512_sat", "sg_qx", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qx_striped_profile_avx512_512_64", "sg_qx", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qx_striped_profile_avx512_512_32", "sg_qx", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qx_striped_profile_avx512_512_16", "sg_qx", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qx_striped_profile_avx512_512_8", "sg_qx", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qx_striped_profile_avx512_512_sat", "sg_qx", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qx_scan_profile_altivec_128_64", "sg_qx", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qx_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qx_scan_profile_altivec_128_32", "sg_qx", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8294,11 +9783,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qx_scan_profile_16,      parasail_profile_create_16,          "parasail_sg_qx_scan_profile_16",      "sg_qx", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_scan_profile_8,       parasail_profile_create_8,           "parasail_sg_qx_scan_profile_8",       "sg_qx", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_scan_profile_sat,     parasail_profile_create_sat,         "parasail_sg_qx_scan_profile_sat",     "sg_qx", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_profile_auto,    parasail_profile_create_sat,         "parasail_sg_qx_scan_profile_auto",    "sg_qx", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_profile_64,   parasail_profile_create_64,          "parasail_sg_qx_striped_profile_64",   "sg_qx", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_profile_32,   parasail_profile_create_32,          "parasail_sg_qx_striped_profile_32",   "sg_qx", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_profile_16,   parasail_profile_create_16,          "parasail_sg_qx_striped_profile_16",   "sg_qx", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_profile_8,    parasail_profile_create_8,           "parasail_sg_qx_striped_profile_8",    "sg_qx", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qx_striped_profile_sat,  parasail_profile_create_sat,         "parasail_sg_qx_striped_profile_sat",  "sg_qx", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_profile_auto, parasail_profile_create_sat,         "parasail_sg_qx_striped_profile_auto", "sg_qx", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_db_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_db_scan_profile_sse2_128_64", "sg_db", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_db_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_db_scan_profile_sse2_128_32", "sg_db", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8335,6 +9826,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_db_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_db_striped_profile_avx2_256_8", "sg_db", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_db_striped_profile_avx2_256_sat", "sg_db", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_db_scan_profile_avx512_512_64", "sg_db", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_db_scan_profile_avx512_512_32", "sg_db", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_db_scan_profile_avx512_512_16", "sg_db", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_db_scan_profile_avx512_512_8", "sg_db", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_db_scan_profile_avx512_512_sat", "sg_db", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_db_striped_profile_avx512_512_64", "sg_db", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_db_striped_profile_avx512_512_32", "sg_db", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_db_striped_profile_avx512_512_16", "sg_db", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_db_striped_profile_avx512_512_8", "sg_db", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_db_striped_profile_avx512_512_sat", "sg_db", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_db_scan_profile_altivec_128_64", "sg_db", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_db_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_db_scan_profile_altivec_128_32", "sg_db", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8364,11 +9867,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_db_scan_profile_16,      parasail_profile_create_16,          "parasail_sg_db_scan_profile_16",      "sg_db", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_scan_profile_8,       parasail_profile_create_8,           "parasail_sg_db_scan_profile_8",       "sg_db", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_scan_profile_sat,     parasail_profile_create_sat,         "parasail_sg_db_scan_profile_sat",     "sg_db", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_profile_auto,    parasail_profile_create_sat,         "parasail_sg_db_scan_profile_auto",    "sg_db", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_profile_64,   parasail_profile_create_64,          "parasail_sg_db_striped_profile_64",   "sg_db", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_profile_32,   parasail_profile_create_32,          "parasail_sg_db_striped_profile_32",   "sg_db", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_profile_16,   parasail_profile_create_16,          "parasail_sg_db_striped_profile_16",   "sg_db", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_profile_8,    parasail_profile_create_8,           "parasail_sg_db_striped_profile_8",    "sg_db", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_db_striped_profile_sat,  parasail_profile_create_sat,         "parasail_sg_db_striped_profile_sat",  "sg_db", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_profile_auto, parasail_profile_create_sat,         "parasail_sg_db_striped_profile_auto", "sg_db", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_de_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_de_scan_profile_sse2_128_64", "sg_de", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_de_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_de_scan_profile_sse2_128_32", "sg_de", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8405,6 +9910,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_de_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_de_striped_profile_avx2_256_8", "sg_de", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_de_striped_profile_avx2_256_sat", "sg_de", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_de_scan_profile_avx512_512_64", "sg_de", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_de_scan_profile_avx512_512_32", "sg_de", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_de_scan_profile_avx512_512_16", "sg_de", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_de_scan_profile_avx512_512_8", "sg_de", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_de_scan_profile_avx512_512_sat", "sg_de", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_de_striped_profile_avx512_512_64", "sg_de", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_de_striped_profile_avx512_512_32", "sg_de", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_de_striped_profile_avx512_512_16", "sg_de", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_de_striped_profile_avx512_512_8", "sg_de", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_de_striped_profile_avx512_512_sat", "sg_de", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_de_scan_profile_altivec_128_64", "sg_de", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_de_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_de_scan_profile_altivec_128_32", "sg_de", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8434,11 +9951,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_de_scan_profile_16,      parasail_profile_create_16,          "parasail_sg_de_scan_profile_16",      "sg_de", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_scan_profile_8,       parasail_profile_create_8,           "parasail_sg_de_scan_profile_8",       "sg_de", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_scan_profile_sat,     parasail_profile_create_sat,         "parasail_sg_de_scan_profile_sat",     "sg_de", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_profile_auto,    parasail_profile_create_sat,         "parasail_sg_de_scan_profile_auto",    "sg_de", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_profile_64,   parasail_profile_create_64,          "parasail_sg_de_striped_profile_64",   "sg_de", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_profile_32,   parasail_profile_create_32,          "parasail_sg_de_striped_profile_32",   "sg_de", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_profile_16,   parasail_profile_create_16,          "parasail_sg_de_striped_profile_16",   "sg_de", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_profile_8,    parasail_profile_create_8,           "parasail_sg_de_striped_profile_8",    "sg_de", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_de_striped_profile_sat,  parasail_profile_create_sat,         "parasail_sg_de_striped_profile_sat",  "sg_de", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_profile_auto, parasail_profile_create_sat,         "parasail_sg_de_striped_profile_auto", "sg_de", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_dx_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_dx_scan_profile_sse2_128_64", "sg_dx", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_dx_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_dx_scan_profile_sse2_128_32", "sg_dx", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8475,6 +9994,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_dx_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_dx_striped_profile_avx2_256_8", "sg_dx", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_dx_striped_profile_avx2_256_sat", "sg_dx", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_dx_scan_profile_avx512_512_64", "sg_dx", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_dx_scan_profile_avx512_512_32", "sg_dx", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_dx_scan_profile_avx512_512_16", "sg_dx", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_dx_scan_profile_avx512_512_8", "sg_dx", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_dx_scan_profile_avx512_512_sat", "sg_dx", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_dx_striped_profile_avx512_512_64", "sg_dx", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_dx_striped_profile_avx512_512_32", "sg_dx", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_dx_striped_profile_avx512_512_16", "sg_dx", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_dx_striped_profile_avx512_512_8", "sg_dx", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_dx_striped_profile_avx512_512_sat", "sg_dx", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_dx_scan_profile_altivec_128_64", "sg_dx", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_dx_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_dx_scan_profile_altivec_128_32", "sg_dx", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8504,11 +10035,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_dx_scan_profile_16,      parasail_profile_create_16,          "parasail_sg_dx_scan_profile_16",      "sg_dx", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_scan_profile_8,       parasail_profile_create_8,           "parasail_sg_dx_scan_profile_8",       "sg_dx", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_scan_profile_sat,     parasail_profile_create_sat,         "parasail_sg_dx_scan_profile_sat",     "sg_dx", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_profile_auto,    parasail_profile_create_sat,         "parasail_sg_dx_scan_profile_auto",    "sg_dx", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_profile_64,   parasail_profile_create_64,          "parasail_sg_dx_striped_profile_64",   "sg_dx", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_profile_32,   parasail_profile_create_32,          "parasail_sg_dx_striped_profile_32",   "sg_dx", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_profile_16,   parasail_profile_create_16,          "parasail_sg_dx_striped_profile_16",   "sg_dx", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_profile_8,    parasail_profile_create_8,           "parasail_sg_dx_striped_profile_8",    "sg_dx", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_dx_striped_profile_sat,  parasail_profile_create_sat,         "parasail_sg_dx_striped_profile_sat",  "sg_dx", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_profile_auto, parasail_profile_create_sat,         "parasail_sg_dx_striped_profile_auto", "sg_dx", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qb_de_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_qb_de_scan_profile_sse2_128_64", "sg_qb_de", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_qb_de_scan_profile_sse2_128_32", "sg_qb_de", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8545,6 +10078,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_de_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qb_de_striped_profile_avx2_256_8", "sg_qb_de", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qb_de_striped_profile_avx2_256_sat", "sg_qb_de", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_de_scan_profile_avx512_512_64", "sg_qb_de", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_de_scan_profile_avx512_512_32", "sg_qb_de", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_de_scan_profile_avx512_512_16", "sg_qb_de", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_de_scan_profile_avx512_512_8", "sg_qb_de", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_de_scan_profile_avx512_512_sat", "sg_qb_de", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_de_striped_profile_avx512_512_64", "sg_qb_de", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_de_striped_profile_avx512_512_32", "sg_qb_de", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_de_striped_profile_avx512_512_16", "sg_qb_de", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_de_striped_profile_avx512_512_8", "sg_qb_de", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_de_striped_profile_avx512_512_sat", "sg_qb_de", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qb_de_scan_profile_altivec_128_64", "sg_qb_de", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qb_de_scan_profile_altivec_128_32", "sg_qb_de", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8574,11 +10119,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_de_scan_profile_16,   parasail_profile_create_16,          "parasail_sg_qb_de_scan_profile_16",   "sg_qb_de", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_scan_profile_8,    parasail_profile_create_8,           "parasail_sg_qb_de_scan_profile_8",    "sg_qb_de", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_scan_profile_sat,  parasail_profile_create_sat,         "parasail_sg_qb_de_scan_profile_sat",  "sg_qb_de", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_profile_auto, parasail_profile_create_sat,         "parasail_sg_qb_de_scan_profile_auto", "sg_qb_de", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_profile_64, parasail_profile_create_64,          "parasail_sg_qb_de_striped_profile_64", "sg_qb_de", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_profile_32, parasail_profile_create_32,          "parasail_sg_qb_de_striped_profile_32", "sg_qb_de", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_profile_16, parasail_profile_create_16,          "parasail_sg_qb_de_striped_profile_16", "sg_qb_de", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_profile_8, parasail_profile_create_8,           "parasail_sg_qb_de_striped_profile_8", "sg_qb_de", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qb_de_striped_profile_sat, parasail_profile_create_sat,         "parasail_sg_qb_de_striped_profile_sat", "sg_qb_de", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_profile_auto, parasail_profile_create_sat,         "parasail_sg_qb_de_striped_profile_auto", "sg_qb_de", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_sg_qe_db_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_qe_db_scan_profile_sse2_128_64", "sg_qe_db", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_qe_db_scan_profile_sse2_128_32", "sg_qe_db", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8615,6 +10162,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_db_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qe_db_striped_profile_avx2_256_8", "sg_qe_db", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qe_db_striped_profile_avx2_256_sat", "sg_qe_db", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_db_scan_profile_avx512_512_64", "sg_qe_db", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_db_scan_profile_avx512_512_32", "sg_qe_db", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_db_scan_profile_avx512_512_16", "sg_qe_db", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_db_scan_profile_avx512_512_8", "sg_qe_db", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_db_scan_profile_avx512_512_sat", "sg_qe_db", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_db_striped_profile_avx512_512_64", "sg_qe_db", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_db_striped_profile_avx512_512_32", "sg_qe_db", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_db_striped_profile_avx512_512_16", "sg_qe_db", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_db_striped_profile_avx512_512_8", "sg_qe_db", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_db_striped_profile_avx512_512_sat", "sg_qe_db", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qe_db_scan_profile_altivec_128_64", "sg_qe_db", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qe_db_scan_profile_altivec_128_32", "sg_qe_db", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -8644,11 +10203,13 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_db_scan_profile_16,   parasail_profile_create_16,          "parasail_sg_qe_db_scan_profile_16",   "sg_qe_db", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_scan_profile_8,    parasail_profile_create_8,           "parasail_sg_qe_db_scan_profile_8",    "sg_qe_db", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_scan_profile_sat,  parasail_profile_create_sat,         "parasail_sg_qe_db_scan_profile_sat",  "sg_qe_db", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_profile_auto, parasail_profile_create_sat,         "parasail_sg_qe_db_scan_profile_auto", "sg_qe_db", "scan_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_profile_64, parasail_profile_create_64,          "parasail_sg_qe_db_striped_profile_64", "sg_qe_db", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_profile_32, parasail_profile_create_32,          "parasail_sg_qe_db_striped_profile_32", "sg_qe_db", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_profile_16, parasail_profile_create_16,          "parasail_sg_qe_db_striped_profile_16", "sg_qe_db", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_profile_8, parasail_profile_create_8,           "parasail_sg_qe_db_striped_profile_8", "sg_qe_db", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_qe_db_striped_profile_sat, parasail_profile_create_sat,         "parasail_sg_qe_db_striped_profile_sat", "sg_qe_db", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_profile_auto, parasail_profile_create_sat,         "parasail_sg_qe_db_striped_profile_auto", "sg_qe_db", "striped_profile", "disp",   "NA", "auto", -1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
 {parasail_nw_stats_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_scan_profile_sse2_128_64", "nw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_nw_stats_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_scan_profile_sse2_128_32", "nw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 1, 0},
@@ -8685,6 +10246,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_nw_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_nw_stats_scan_profile_avx512_512_64", "nw_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_nw_stats_scan_profile_avx512_512_32", "nw_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_nw_stats_scan_profile_avx512_512_16", "nw_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_nw_stats_scan_profile_avx512_512_8", "nw_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_nw_stats_scan_profile_avx512_512_sat", "nw_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_nw_stats_striped_profile_avx512_512_64", "nw_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_nw_stats_striped_profile_avx512_512_32", "nw_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_nw_stats_striped_profile_avx512_512_16", "nw_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_nw_stats_striped_profile_avx512_512_8", "nw_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_nw_stats_striped_profile_avx512_512_sat", "nw_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_nw_stats_scan_profile_altivec_128_64", "nw_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_nw_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_nw_stats_scan_profile_altivec_128_32", "nw_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -8755,6 +10328,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_stats_scan_profile_avx512_512_64", "sg_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_stats_scan_profile_avx512_512_32", "sg_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_stats_scan_profile_avx512_512_16", "sg_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_stats_scan_profile_avx512_512_8", "sg_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_stats_scan_profile_avx512_512_sat", "sg_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_stats_striped_profile_avx512_512_64", "sg_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_stats_striped_profile_avx512_512_32", "sg_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_stats_striped_profile_avx512_512_16", "sg_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_stats_striped_profile_avx512_512_8", "sg_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_stats_striped_profile_avx512_512_sat", "sg_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_stats_scan_profile_altivec_128_64", "sg_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_stats_scan_profile_altivec_128_32", "sg_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -8825,6 +10410,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sw_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sw_stats_scan_profile_avx512_512_64", "sw_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sw_stats_scan_profile_avx512_512_32", "sw_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sw_stats_scan_profile_avx512_512_16", "sw_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sw_stats_scan_profile_avx512_512_8", "sw_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sw_stats_scan_profile_avx512_512_sat", "sw_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sw_stats_striped_profile_avx512_512_64", "sw_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sw_stats_striped_profile_avx512_512_32", "sw_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sw_stats_striped_profile_avx512_512_16", "sw_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sw_stats_striped_profile_avx512_512_8", "sw_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sw_stats_striped_profile_avx512_512_sat", "sw_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sw_stats_scan_profile_altivec_128_64", "sw_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sw_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sw_stats_scan_profile_altivec_128_32", "sw_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -8895,6 +10492,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qb_stats_striped_profile_avx2_256_8", "sg_qb_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qb_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qb_stats_striped_profile_avx2_256_sat", "sg_qb_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_stats_scan_profile_avx512_512_64", "sg_qb_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_stats_scan_profile_avx512_512_32", "sg_qb_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_stats_scan_profile_avx512_512_16", "sg_qb_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_stats_scan_profile_avx512_512_8", "sg_qb_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_stats_scan_profile_avx512_512_sat", "sg_qb_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_stats_striped_profile_avx512_512_64", "sg_qb_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_stats_striped_profile_avx512_512_32", "sg_qb_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_stats_striped_profile_avx512_512_16", "sg_qb_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_stats_striped_profile_avx512_512_8", "sg_qb_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_stats_striped_profile_avx512_512_sat", "sg_qb_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qb_stats_scan_profile_altivec_128_64", "sg_qb_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qb_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qb_stats_scan_profile_altivec_128_32", "sg_qb_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -8965,6 +10574,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qe_stats_striped_profile_avx2_256_8", "sg_qe_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qe_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qe_stats_striped_profile_avx2_256_sat", "sg_qe_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_stats_scan_profile_avx512_512_64", "sg_qe_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_stats_scan_profile_avx512_512_32", "sg_qe_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_stats_scan_profile_avx512_512_16", "sg_qe_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_stats_scan_profile_avx512_512_8", "sg_qe_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_stats_scan_profile_avx512_512_sat", "sg_qe_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_stats_striped_profile_avx512_512_64", "sg_qe_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_stats_striped_profile_avx512_512_32", "sg_qe_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_stats_striped_profile_avx512_512_16", "sg_qe_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_stats_striped_profile_avx512_512_8", "sg_qe_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_stats_striped_profile_avx512_512_sat", "sg_qe_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qe_stats_scan_profile_altivec_128_64", "sg_qe_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qe_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qe_stats_scan_profile_altivec_128_32", "sg_qe_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -9035,6 +10656,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qx_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qx_stats_striped_profile_avx2_256_8", "sg_qx_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qx_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qx_stats_striped_profile_avx2_256_sat", "sg_qx_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qx_stats_scan_profile_avx512_512_64", "sg_qx_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qx_stats_scan_profile_avx512_512_32", "sg_qx_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qx_stats_scan_profile_avx512_512_16", "sg_qx_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qx_stats_scan_profile_avx512_512_8", "sg_qx_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qx_stats_scan_profile_avx512_512_sat", "sg_qx_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qx_stats_striped_profile_avx512_512_64", "sg_qx_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qx_stats_striped_profile_avx512_512_32", "sg_qx_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qx_stats_striped_profile_avx512_512_16", "sg_qx_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qx_stats_striped_profile_avx512_512_8", "sg_qx_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qx_stats_striped_profile_avx512_512_sat", "sg_qx_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qx_stats_scan_profile_altivec_128_64", "sg_qx_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qx_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qx_stats_scan_profile_altivec_128_32", "sg_qx_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -9105,6 +10738,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_db_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_db_stats_striped_profile_avx2_256_8", "sg_db_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_db_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_db_stats_striped_profile_avx2_256_sat", "sg_db_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_db_stats_scan_profile_avx512_512_64", "sg_db_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_db_stats_scan_profile_avx512_512_32", "sg_db_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_db_stats_scan_profile_avx512_512_16", "sg_db_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_db_stats_scan_profile_avx512_512_8", "sg_db_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_db_stats_scan_profile_avx512_512_sat", "sg_db_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_db_stats_striped_profile_avx512_512_64", "sg_db_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_db_stats_striped_profile_avx512_512_32", "sg_db_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_db_stats_striped_profile_avx512_512_16", "sg_db_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_db_stats_striped_profile_avx512_512_8", "sg_db_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_db_stats_striped_profile_avx512_512_sat", "sg_db_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_db_stats_scan_profile_altivec_128_64", "sg_db_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_db_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_db_stats_scan_profile_altivec_128_32", "sg_db_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -9175,6 +10820,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_de_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_de_stats_striped_profile_avx2_256_8", "sg_de_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_de_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_de_stats_striped_profile_avx2_256_sat", "sg_de_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_de_stats_scan_profile_avx512_512_64", "sg_de_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_de_stats_scan_profile_avx512_512_32", "sg_de_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_de_stats_scan_profile_avx512_512_16", "sg_de_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_de_stats_scan_profile_avx512_512_8", "sg_de_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_de_stats_scan_profile_avx512_512_sat", "sg_de_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_de_stats_striped_profile_avx512_512_64", "sg_de_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_de_stats_striped_profile_avx512_512_32", "sg_de_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_de_stats_striped_profile_avx512_512_16", "sg_de_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_de_stats_striped_profile_avx512_512_8", "sg_de_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_de_stats_striped_profile_avx512_512_sat", "sg_de_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_de_stats_scan_profile_altivec_128_64", "sg_de_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_de_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_de_stats_scan_profile_altivec_128_32", "sg_de_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -9245,6 +10902,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_dx_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_dx_stats_striped_profile_avx2_256_8", "sg_dx_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_dx_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_dx_stats_striped_profile_avx2_256_sat", "sg_dx_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_dx_stats_scan_profile_avx512_512_64", "sg_dx_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_dx_stats_scan_profile_avx512_512_32", "sg_dx_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_dx_stats_scan_profile_avx512_512_16", "sg_dx_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_dx_stats_scan_profile_avx512_512_8", "sg_dx_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_dx_stats_scan_profile_avx512_512_sat", "sg_dx_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_dx_stats_striped_profile_avx512_512_64", "sg_dx_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_dx_stats_striped_profile_avx512_512_32", "sg_dx_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_dx_stats_striped_profile_avx512_512_16", "sg_dx_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_dx_stats_striped_profile_avx512_512_8", "sg_dx_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_dx_stats_striped_profile_avx512_512_sat", "sg_dx_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_dx_stats_scan_profile_altivec_128_64", "sg_dx_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_dx_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_dx_stats_scan_profile_altivec_128_32", "sg_dx_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -9315,6 +10984,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_de_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qb_de_stats_striped_profile_avx2_256_8", "sg_qb_de_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qb_de_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qb_de_stats_striped_profile_avx2_256_sat", "sg_qb_de_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_de_stats_scan_profile_avx512_512_64", "sg_qb_de_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_de_stats_scan_profile_avx512_512_32", "sg_qb_de_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_de_stats_scan_profile_avx512_512_16", "sg_qb_de_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_de_stats_scan_profile_avx512_512_8", "sg_qb_de_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_de_stats_scan_profile_avx512_512_sat", "sg_qb_de_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_de_stats_striped_profile_avx512_512_64", "sg_qb_de_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_de_stats_striped_profile_avx512_512_32", "sg_qb_de_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_de_stats_striped_profile_avx512_512_16", "sg_qb_de_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_de_stats_striped_profile_avx512_512_8", "sg_qb_de_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_de_stats_striped_profile_avx512_512_sat", "sg_qb_de_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qb_de_stats_scan_profile_altivec_128_64", "sg_qb_de_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qb_de_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qb_de_stats_scan_profile_altivec_128_32", "sg_qb_de_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -9385,6 +11066,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_db_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qe_db_stats_striped_profile_avx2_256_8", "sg_qe_db_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_qe_db_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qe_db_stats_striped_profile_avx2_256_sat", "sg_qe_db_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_stats_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_db_stats_scan_profile_avx512_512_64", "sg_qe_db_stats", "scan_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_db_stats_scan_profile_avx512_512_32", "sg_qe_db_stats", "scan_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_db_stats_scan_profile_avx512_512_16", "sg_qe_db_stats", "scan_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_db_stats_scan_profile_avx512_512_8", "sg_qe_db_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_db_stats_scan_profile_avx512_512_sat", "sg_qe_db_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_db_stats_striped_profile_avx512_512_64", "sg_qe_db_stats", "striped_profile", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_db_stats_striped_profile_avx512_512_32", "sg_qe_db_stats", "striped_profile", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_db_stats_striped_profile_avx512_512_16", "sg_qe_db_stats", "striped_profile", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_db_stats_striped_profile_avx512_512_8", "sg_qe_db_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_db_stats_striped_profile_avx512_512_sat", "sg_qe_db_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qe_db_stats_scan_profile_altivec_128_64", "sg_qe_db_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_qe_db_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qe_db_stats_scan_profile_altivec_128_32", "sg_qe_db_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -9455,6 +11148,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_table_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_nw_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_table_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_nw_table_scan_profile_avx512_512_64", "nw", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_nw_table_scan_profile_avx512_512_32", "nw", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_nw_table_scan_profile_avx512_512_16", "nw", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_nw_table_scan_profile_avx512_512_8", "nw", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_nw_table_scan_profile_avx512_512_sat", "nw", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_nw_table_striped_profile_avx512_512_64", "nw", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_nw_table_striped_profile_avx512_512_32", "nw", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_nw_table_striped_profile_avx512_512_16", "nw", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_nw_table_striped_profile_avx512_512_8", "nw", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_nw_table_striped_profile_avx512_512_sat", "nw", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_nw_table_scan_profile_altivec_128_64", "nw", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_nw_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_nw_table_scan_profile_altivec_128_32", "nw", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -9525,6 +11230,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_table_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_table_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_table_scan_profile_avx512_512_64", "sg", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_table_scan_profile_avx512_512_32", "sg", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_table_scan_profile_avx512_512_16", "sg", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_table_scan_profile_avx512_512_8", "sg", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_table_scan_profile_avx512_512_sat", "sg", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_table_striped_profile_avx512_512_64", "sg", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_table_striped_profile_avx512_512_32", "sg", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_table_striped_profile_avx512_512_16", "sg", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_table_striped_profile_avx512_512_8", "sg", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_table_striped_profile_avx512_512_sat", "sg", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_table_scan_profile_altivec_128_64", "sg", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_table_scan_profile_altivec_128_32", "sg", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -9595,6 +11312,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_table_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sw_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_table_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sw_table_scan_profile_avx512_512_64", "sw", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sw_table_scan_profile_avx512_512_32", "sw", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sw_table_scan_profile_avx512_512_16", "sw", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sw_table_scan_profile_avx512_512_8", "sw", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sw_table_scan_profile_avx512_512_sat", "sw", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sw_table_striped_profile_avx512_512_64", "sw", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sw_table_striped_profile_avx512_512_32", "sw", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sw_table_striped_profile_avx512_512_16", "sw", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sw_table_striped_profile_avx512_512_8", "sw", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sw_table_striped_profile_avx512_512_sat", "sw", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sw_table_scan_profile_altivec_128_64", "sw", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sw_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sw_table_scan_profile_altivec_128_32", "sw", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -9665,6 +11394,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qb_table_striped_profile_avx2_256_8", "sg_qb", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qb_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qb_table_striped_profile_avx2_256_sat", "sg_qb", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_table_scan_profile_avx512_512_64", "sg_qb", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_table_scan_profile_avx512_512_32", "sg_qb", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_table_scan_profile_avx512_512_16", "sg_qb", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_table_scan_profile_avx512_512_8", "sg_qb", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_table_scan_profile_avx512_512_sat", "sg_qb", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_table_striped_profile_avx512_512_64", "sg_qb", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_table_striped_profile_avx512_512_32", "sg_qb", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_table_striped_profile_avx512_512_16", "sg_qb", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_table_striped_profile_avx512_512_8", "sg_qb", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_table_striped_profile_avx512_512_sat", "sg_qb", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qb_table_scan_profile_altivec_128_64", "sg_qb", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qb_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qb_table_scan_profile_altivec_128_32", "sg_qb", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -9735,6 +11476,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qe_table_striped_profile_avx2_256_8", "sg_qe", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qe_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qe_table_striped_profile_avx2_256_sat", "sg_qe", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_table_scan_profile_avx512_512_64", "sg_qe", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_table_scan_profile_avx512_512_32", "sg_qe", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_table_scan_profile_avx512_512_16", "sg_qe", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_table_scan_profile_avx512_512_8", "sg_qe", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_table_scan_profile_avx512_512_sat", "sg_qe", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_table_striped_profile_avx512_512_64", "sg_qe", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_table_striped_profile_avx512_512_32", "sg_qe", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_table_striped_profile_avx512_512_16", "sg_qe", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_table_striped_profile_avx512_512_8", "sg_qe", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_table_striped_profile_avx512_512_sat", "sg_qe", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qe_table_scan_profile_altivec_128_64", "sg_qe", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qe_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qe_table_scan_profile_altivec_128_32", "sg_qe", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -9805,6 +11558,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qx_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qx_table_striped_profile_avx2_256_8", "sg_qx", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qx_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qx_table_striped_profile_avx2_256_sat", "sg_qx", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qx_table_scan_profile_avx512_512_64", "sg_qx", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qx_table_scan_profile_avx512_512_32", "sg_qx", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qx_table_scan_profile_avx512_512_16", "sg_qx", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qx_table_scan_profile_avx512_512_8", "sg_qx", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qx_table_scan_profile_avx512_512_sat", "sg_qx", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qx_table_striped_profile_avx512_512_64", "sg_qx", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qx_table_striped_profile_avx512_512_32", "sg_qx", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qx_table_striped_profile_avx512_512_16", "sg_qx", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qx_table_striped_profile_avx512_512_8", "sg_qx", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qx_table_striped_profile_avx512_512_sat", "sg_qx", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qx_table_scan_profile_altivec_128_64", "sg_qx", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qx_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qx_table_scan_profile_altivec_128_32", "sg_qx", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -9875,6 +11640,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_db_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_db_table_striped_profile_avx2_256_8", "sg_db", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_db_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_db_table_striped_profile_avx2_256_sat", "sg_db", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_db_table_scan_profile_avx512_512_64", "sg_db", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_db_table_scan_profile_avx512_512_32", "sg_db", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_db_table_scan_profile_avx512_512_16", "sg_db", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_db_table_scan_profile_avx512_512_8", "sg_db", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_db_table_scan_profile_avx512_512_sat", "sg_db", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_db_table_striped_profile_avx512_512_64", "sg_db", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_db_table_striped_profile_avx512_512_32", "sg_db", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_db_table_striped_profile_avx512_512_16", "sg_db", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_db_table_striped_profile_avx512_512_8", "sg_db", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_db_table_striped_profile_avx512_512_sat", "sg_db", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_db_table_scan_profile_altivec_128_64", "sg_db", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_db_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_db_table_scan_profile_altivec_128_32", "sg_db", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -9945,6 +11722,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_de_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_de_table_striped_profile_avx2_256_8", "sg_de", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_de_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_de_table_striped_profile_avx2_256_sat", "sg_de", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_de_table_scan_profile_avx512_512_64", "sg_de", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_de_table_scan_profile_avx512_512_32", "sg_de", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_de_table_scan_profile_avx512_512_16", "sg_de", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_de_table_scan_profile_avx512_512_8", "sg_de", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_de_table_scan_profile_avx512_512_sat", "sg_de", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_de_table_striped_profile_avx512_512_64", "sg_de", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_de_table_striped_profile_avx512_512_32", "sg_de", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_de_table_striped_profile_avx512_512_16", "sg_de", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_de_table_striped_profile_avx512_512_8", "sg_de", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_de_table_striped_profile_avx512_512_sat", "sg_de", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_de_table_scan_profile_altivec_128_64", "sg_de", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_de_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_de_table_scan_profile_altivec_128_32", "sg_de", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -10015,6 +11804,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_dx_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_dx_table_striped_profile_avx2_256_8", "sg_dx", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_dx_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_dx_table_striped_profile_avx2_256_sat", "sg_dx", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_dx_table_scan_profile_avx512_512_64", "sg_dx", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_dx_table_scan_profile_avx512_512_32", "sg_dx", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_dx_table_scan_profile_avx512_512_16", "sg_dx", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_dx_table_scan_profile_avx512_512_8", "sg_dx", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_dx_table_scan_profile_avx512_512_sat", "sg_dx", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_dx_table_striped_profile_avx512_512_64", "sg_dx", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_dx_table_striped_profile_avx512_512_32", "sg_dx", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_dx_table_striped_profile_avx512_512_16", "sg_dx", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_dx_table_striped_profile_avx512_512_8", "sg_dx", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_dx_table_striped_profile_avx512_512_sat", "sg_dx", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_dx_table_scan_profile_altivec_128_64", "sg_dx", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_dx_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_dx_table_scan_profile_altivec_128_32", "sg_dx", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -10085,6 +11886,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_de_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qb_de_table_striped_profile_avx2_256_8", "sg_qb_de", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qb_de_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qb_de_table_striped_profile_avx2_256_sat", "sg_qb_de", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_de_table_scan_profile_avx512_512_64", "sg_qb_de", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_de_table_scan_profile_avx512_512_32", "sg_qb_de", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_de_table_scan_profile_avx512_512_16", "sg_qb_de", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_de_table_scan_profile_avx512_512_8", "sg_qb_de", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_de_table_scan_profile_avx512_512_sat", "sg_qb_de", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_de_table_striped_profile_avx512_512_64", "sg_qb_de", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_de_table_striped_profile_avx512_512_32", "sg_qb_de", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_de_table_striped_profile_avx512_512_16", "sg_qb_de", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_de_table_striped_profile_avx512_512_8", "sg_qb_de", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_de_table_striped_profile_avx512_512_sat", "sg_qb_de", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qb_de_table_scan_profile_altivec_128_64", "sg_qb_de", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qb_de_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qb_de_table_scan_profile_altivec_128_32", "sg_qb_de", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -10155,6 +11968,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_db_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qe_db_table_striped_profile_avx2_256_8", "sg_qe_db", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_qe_db_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qe_db_table_striped_profile_avx2_256_sat", "sg_qe_db", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_table_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_db_table_scan_profile_avx512_512_64", "sg_qe_db", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_db_table_scan_profile_avx512_512_32", "sg_qe_db", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_db_table_scan_profile_avx512_512_16", "sg_qe_db", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_db_table_scan_profile_avx512_512_8", "sg_qe_db", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_db_table_scan_profile_avx512_512_sat", "sg_qe_db", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_db_table_striped_profile_avx512_512_64", "sg_qe_db", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_db_table_striped_profile_avx512_512_32", "sg_qe_db", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_db_table_striped_profile_avx512_512_16", "sg_qe_db", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_db_table_striped_profile_avx512_512_8", "sg_qe_db", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_db_table_striped_profile_avx512_512_sat", "sg_qe_db", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qe_db_table_scan_profile_altivec_128_64", "sg_qe_db", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_qe_db_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qe_db_table_scan_profile_altivec_128_32", "sg_qe_db", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -10225,6 +12050,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_table_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_nw_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_table_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_nw_stats_table_scan_profile_avx512_512_64", "nw_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_nw_stats_table_scan_profile_avx512_512_32", "nw_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_nw_stats_table_scan_profile_avx512_512_16", "nw_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_nw_stats_table_scan_profile_avx512_512_8", "nw_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_nw_stats_table_scan_profile_avx512_512_sat", "nw_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_nw_stats_table_striped_profile_avx512_512_64", "nw_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_nw_stats_table_striped_profile_avx512_512_32", "nw_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_nw_stats_table_striped_profile_avx512_512_16", "nw_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_nw_stats_table_striped_profile_avx512_512_8", "nw_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_nw_stats_table_striped_profile_avx512_512_sat", "nw_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_nw_stats_table_scan_profile_altivec_128_64", "nw_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_nw_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_nw_stats_table_scan_profile_altivec_128_32", "nw_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10295,6 +12132,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_table_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_table_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_stats_table_scan_profile_avx512_512_64", "sg_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_stats_table_scan_profile_avx512_512_32", "sg_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_stats_table_scan_profile_avx512_512_16", "sg_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_stats_table_scan_profile_avx512_512_8", "sg_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_stats_table_scan_profile_avx512_512_sat", "sg_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_stats_table_striped_profile_avx512_512_64", "sg_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_stats_table_striped_profile_avx512_512_32", "sg_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_stats_table_striped_profile_avx512_512_16", "sg_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_stats_table_striped_profile_avx512_512_8", "sg_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_stats_table_striped_profile_avx512_512_sat", "sg_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_stats_table_scan_profile_altivec_128_64", "sg_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_stats_table_scan_profile_altivec_128_32", "sg_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10365,6 +12214,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_table_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sw_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_table_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sw_stats_table_scan_profile_avx512_512_64", "sw_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sw_stats_table_scan_profile_avx512_512_32", "sw_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sw_stats_table_scan_profile_avx512_512_16", "sw_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sw_stats_table_scan_profile_avx512_512_8", "sw_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sw_stats_table_scan_profile_avx512_512_sat", "sw_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sw_stats_table_striped_profile_avx512_512_64", "sw_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sw_stats_table_striped_profile_avx512_512_32", "sw_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sw_stats_table_striped_profile_avx512_512_16", "sw_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sw_stats_table_striped_profile_avx512_512_8", "sw_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sw_stats_table_striped_profile_avx512_512_sat", "sw_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sw_stats_table_scan_profile_altivec_128_64", "sw_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sw_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sw_stats_table_scan_profile_altivec_128_32", "sw_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10435,6 +12296,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qb_stats_table_striped_profile_avx2_256_8", "sg_qb_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qb_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qb_stats_table_striped_profile_avx2_256_sat", "sg_qb_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_stats_table_scan_profile_avx512_512_64", "sg_qb_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_stats_table_scan_profile_avx512_512_32", "sg_qb_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_stats_table_scan_profile_avx512_512_16", "sg_qb_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_stats_table_scan_profile_avx512_512_8", "sg_qb_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_stats_table_scan_profile_avx512_512_sat", "sg_qb_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_stats_table_striped_profile_avx512_512_64", "sg_qb_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_stats_table_striped_profile_avx512_512_32", "sg_qb_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_stats_table_striped_profile_avx512_512_16", "sg_qb_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_stats_table_striped_profile_avx512_512_8", "sg_qb_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_stats_table_striped_profile_avx512_512_sat", "sg_qb_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qb_stats_table_scan_profile_altivec_128_64", "sg_qb_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qb_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qb_stats_table_scan_profile_altivec_128_32", "sg_qb_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10505,6 +12378,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qe_stats_table_striped_profile_avx2_256_8", "sg_qe_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qe_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qe_stats_table_striped_profile_avx2_256_sat", "sg_qe_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_stats_table_scan_profile_avx512_512_64", "sg_qe_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_stats_table_scan_profile_avx512_512_32", "sg_qe_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_stats_table_scan_profile_avx512_512_16", "sg_qe_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_stats_table_scan_profile_avx512_512_8", "sg_qe_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_stats_table_scan_profile_avx512_512_sat", "sg_qe_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_stats_table_striped_profile_avx512_512_64", "sg_qe_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_stats_table_striped_profile_avx512_512_32", "sg_qe_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_stats_table_striped_profile_avx512_512_16", "sg_qe_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_stats_table_striped_profile_avx512_512_8", "sg_qe_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_stats_table_striped_profile_avx512_512_sat", "sg_qe_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qe_stats_table_scan_profile_altivec_128_64", "sg_qe_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qe_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qe_stats_table_scan_profile_altivec_128_32", "sg_qe_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10575,6 +12460,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qx_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qx_stats_table_striped_profile_avx2_256_8", "sg_qx_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qx_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qx_stats_table_striped_profile_avx2_256_sat", "sg_qx_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qx_stats_table_scan_profile_avx512_512_64", "sg_qx_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qx_stats_table_scan_profile_avx512_512_32", "sg_qx_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qx_stats_table_scan_profile_avx512_512_16", "sg_qx_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qx_stats_table_scan_profile_avx512_512_8", "sg_qx_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qx_stats_table_scan_profile_avx512_512_sat", "sg_qx_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qx_stats_table_striped_profile_avx512_512_64", "sg_qx_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qx_stats_table_striped_profile_avx512_512_32", "sg_qx_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qx_stats_table_striped_profile_avx512_512_16", "sg_qx_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qx_stats_table_striped_profile_avx512_512_8", "sg_qx_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qx_stats_table_striped_profile_avx512_512_sat", "sg_qx_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qx_stats_table_scan_profile_altivec_128_64", "sg_qx_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qx_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qx_stats_table_scan_profile_altivec_128_32", "sg_qx_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10645,6 +12542,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_db_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_db_stats_table_striped_profile_avx2_256_8", "sg_db_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_db_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_db_stats_table_striped_profile_avx2_256_sat", "sg_db_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_db_stats_table_scan_profile_avx512_512_64", "sg_db_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_db_stats_table_scan_profile_avx512_512_32", "sg_db_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_db_stats_table_scan_profile_avx512_512_16", "sg_db_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_db_stats_table_scan_profile_avx512_512_8", "sg_db_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_db_stats_table_scan_profile_avx512_512_sat", "sg_db_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_db_stats_table_striped_profile_avx512_512_64", "sg_db_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_db_stats_table_striped_profile_avx512_512_32", "sg_db_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_db_stats_table_striped_profile_avx512_512_16", "sg_db_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_db_stats_table_striped_profile_avx512_512_8", "sg_db_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_db_stats_table_striped_profile_avx512_512_sat", "sg_db_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_db_stats_table_scan_profile_altivec_128_64", "sg_db_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_db_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_db_stats_table_scan_profile_altivec_128_32", "sg_db_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10715,6 +12624,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_de_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_de_stats_table_striped_profile_avx2_256_8", "sg_de_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_de_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_de_stats_table_striped_profile_avx2_256_sat", "sg_de_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_de_stats_table_scan_profile_avx512_512_64", "sg_de_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_de_stats_table_scan_profile_avx512_512_32", "sg_de_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_de_stats_table_scan_profile_avx512_512_16", "sg_de_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_de_stats_table_scan_profile_avx512_512_8", "sg_de_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_de_stats_table_scan_profile_avx512_512_sat", "sg_de_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_de_stats_table_striped_profile_avx512_512_64", "sg_de_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_de_stats_table_striped_profile_avx512_512_32", "sg_de_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_de_stats_table_striped_profile_avx512_512_16", "sg_de_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_de_stats_table_striped_profile_avx512_512_8", "sg_de_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_de_stats_table_striped_profile_avx512_512_sat", "sg_de_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_de_stats_table_scan_profile_altivec_128_64", "sg_de_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_de_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_de_stats_table_scan_profile_altivec_128_32", "sg_de_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10785,6 +12706,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_dx_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_dx_stats_table_striped_profile_avx2_256_8", "sg_dx_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_dx_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_dx_stats_table_striped_profile_avx2_256_sat", "sg_dx_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_dx_stats_table_scan_profile_avx512_512_64", "sg_dx_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_dx_stats_table_scan_profile_avx512_512_32", "sg_dx_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_dx_stats_table_scan_profile_avx512_512_16", "sg_dx_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_dx_stats_table_scan_profile_avx512_512_8", "sg_dx_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_dx_stats_table_scan_profile_avx512_512_sat", "sg_dx_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_dx_stats_table_striped_profile_avx512_512_64", "sg_dx_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_dx_stats_table_striped_profile_avx512_512_32", "sg_dx_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_dx_stats_table_striped_profile_avx512_512_16", "sg_dx_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_dx_stats_table_striped_profile_avx512_512_8", "sg_dx_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_dx_stats_table_striped_profile_avx512_512_sat", "sg_dx_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_dx_stats_table_scan_profile_altivec_128_64", "sg_dx_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_dx_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_dx_stats_table_scan_profile_altivec_128_32", "sg_dx_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10855,6 +12788,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_de_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qb_de_stats_table_striped_profile_avx2_256_8", "sg_qb_de_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qb_de_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qb_de_stats_table_striped_profile_avx2_256_sat", "sg_qb_de_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_de_stats_table_scan_profile_avx512_512_64", "sg_qb_de_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_de_stats_table_scan_profile_avx512_512_32", "sg_qb_de_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_de_stats_table_scan_profile_avx512_512_16", "sg_qb_de_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_de_stats_table_scan_profile_avx512_512_8", "sg_qb_de_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_de_stats_table_scan_profile_avx512_512_sat", "sg_qb_de_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_de_stats_table_striped_profile_avx512_512_64", "sg_qb_de_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_de_stats_table_striped_profile_avx512_512_32", "sg_qb_de_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_de_stats_table_striped_profile_avx512_512_16", "sg_qb_de_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_de_stats_table_striped_profile_avx512_512_8", "sg_qb_de_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_de_stats_table_striped_profile_avx512_512_sat", "sg_qb_de_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qb_de_stats_table_scan_profile_altivec_128_64", "sg_qb_de_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qb_de_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qb_de_stats_table_scan_profile_altivec_128_32", "sg_qb_de_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10925,6 +12870,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_db_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qe_db_stats_table_striped_profile_avx2_256_8", "sg_qe_db_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_qe_db_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qe_db_stats_table_striped_profile_avx2_256_sat", "sg_qe_db_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_stats_table_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_db_stats_table_scan_profile_avx512_512_64", "sg_qe_db_stats", "scan_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_db_stats_table_scan_profile_avx512_512_32", "sg_qe_db_stats", "scan_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_db_stats_table_scan_profile_avx512_512_16", "sg_qe_db_stats", "scan_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_db_stats_table_scan_profile_avx512_512_8", "sg_qe_db_stats", "scan_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_db_stats_table_scan_profile_avx512_512_sat", "sg_qe_db_stats", "scan_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_db_stats_table_striped_profile_avx512_512_64", "sg_qe_db_stats", "striped_profile", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_db_stats_table_striped_profile_avx512_512_32", "sg_qe_db_stats", "striped_profile", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_db_stats_table_striped_profile_avx512_512_16", "sg_qe_db_stats", "striped_profile", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_db_stats_table_striped_profile_avx512_512_8", "sg_qe_db_stats", "striped_profile", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_db_stats_table_striped_profile_avx512_512_sat", "sg_qe_db_stats", "striped_profile", "avx512", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qe_db_stats_table_scan_profile_altivec_128_64", "sg_qe_db_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_qe_db_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qe_db_stats_table_scan_profile_altivec_128_32", "sg_qe_db_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -10995,6 +12952,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_rowcol_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_rowcol_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_nw_rowcol_scan_profile_avx512_512_64", "nw", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_nw_rowcol_scan_profile_avx512_512_32", "nw", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_nw_rowcol_scan_profile_avx512_512_16", "nw", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_nw_rowcol_scan_profile_avx512_512_8", "nw", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_nw_rowcol_scan_profile_avx512_512_sat", "nw", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_nw_rowcol_striped_profile_avx512_512_64", "nw", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_nw_rowcol_striped_profile_avx512_512_32", "nw", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_nw_rowcol_striped_profile_avx512_512_16", "nw", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_nw_rowcol_striped_profile_avx512_512_8", "nw", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_nw_rowcol_striped_profile_avx512_512_sat", "nw", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_nw_rowcol_scan_profile_altivec_128_64", "nw", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_nw_rowcol_scan_profile_altivec_128_32", "nw", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11065,6 +13034,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_rowcol_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_rowcol_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_rowcol_scan_profile_avx512_512_64", "sg", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_rowcol_scan_profile_avx512_512_32", "sg", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_rowcol_scan_profile_avx512_512_16", "sg", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_rowcol_scan_profile_avx512_512_8", "sg", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_rowcol_scan_profile_avx512_512_sat", "sg", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_rowcol_striped_profile_avx512_512_64", "sg", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_rowcol_striped_profile_avx512_512_32", "sg", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_rowcol_striped_profile_avx512_512_16", "sg", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_rowcol_striped_profile_avx512_512_8", "sg", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_rowcol_striped_profile_avx512_512_sat", "sg", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_rowcol_scan_profile_altivec_128_64", "sg", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_rowcol_scan_profile_altivec_128_32", "sg", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11135,6 +13116,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_rowcol_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_rowcol_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sw_rowcol_scan_profile_avx512_512_64", "sw", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sw_rowcol_scan_profile_avx512_512_32", "sw", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sw_rowcol_scan_profile_avx512_512_16", "sw", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sw_rowcol_scan_profile_avx512_512_8", "sw", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sw_rowcol_scan_profile_avx512_512_sat", "sw", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sw_rowcol_striped_profile_avx512_512_64", "sw", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sw_rowcol_striped_profile_avx512_512_32", "sw", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sw_rowcol_striped_profile_avx512_512_16", "sw", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sw_rowcol_striped_profile_avx512_512_8", "sw", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sw_rowcol_striped_profile_avx512_512_sat", "sw", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sw_rowcol_scan_profile_altivec_128_64", "sw", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sw_rowcol_scan_profile_altivec_128_32", "sw", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11205,6 +13198,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qb_rowcol_striped_profile_avx2_256_8", "sg_qb", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qb_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qb_rowcol_striped_profile_avx2_256_sat", "sg_qb", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_rowcol_scan_profile_avx512_512_64", "sg_qb", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_rowcol_scan_profile_avx512_512_32", "sg_qb", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_rowcol_scan_profile_avx512_512_16", "sg_qb", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_rowcol_scan_profile_avx512_512_8", "sg_qb", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_rowcol_scan_profile_avx512_512_sat", "sg_qb", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_rowcol_striped_profile_avx512_512_64", "sg_qb", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_rowcol_striped_profile_avx512_512_32", "sg_qb", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_rowcol_striped_profile_avx512_512_16", "sg_qb", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_rowcol_striped_profile_avx512_512_8", "sg_qb", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_rowcol_striped_profile_avx512_512_sat", "sg_qb", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qb_rowcol_scan_profile_altivec_128_64", "sg_qb", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qb_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qb_rowcol_scan_profile_altivec_128_32", "sg_qb", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11275,6 +13280,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qe_rowcol_striped_profile_avx2_256_8", "sg_qe", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qe_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qe_rowcol_striped_profile_avx2_256_sat", "sg_qe", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_rowcol_scan_profile_avx512_512_64", "sg_qe", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_rowcol_scan_profile_avx512_512_32", "sg_qe", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_rowcol_scan_profile_avx512_512_16", "sg_qe", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_rowcol_scan_profile_avx512_512_8", "sg_qe", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_rowcol_scan_profile_avx512_512_sat", "sg_qe", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_rowcol_striped_profile_avx512_512_64", "sg_qe", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_rowcol_striped_profile_avx512_512_32", "sg_qe", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_rowcol_striped_profile_avx512_512_16", "sg_qe", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_rowcol_striped_profile_avx512_512_8", "sg_qe", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_rowcol_striped_profile_avx512_512_sat", "sg_qe", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qe_rowcol_scan_profile_altivec_128_64", "sg_qe", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qe_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qe_rowcol_scan_profile_altivec_128_32", "sg_qe", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11345,6 +13362,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qx_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qx_rowcol_striped_profile_avx2_256_8", "sg_qx", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qx_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qx_rowcol_striped_profile_avx2_256_sat", "sg_qx", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qx_rowcol_scan_profile_avx512_512_64", "sg_qx", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qx_rowcol_scan_profile_avx512_512_32", "sg_qx", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qx_rowcol_scan_profile_avx512_512_16", "sg_qx", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qx_rowcol_scan_profile_avx512_512_8", "sg_qx", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qx_rowcol_scan_profile_avx512_512_sat", "sg_qx", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qx_rowcol_striped_profile_avx512_512_64", "sg_qx", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qx_rowcol_striped_profile_avx512_512_32", "sg_qx", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qx_rowcol_striped_profile_avx512_512_16", "sg_qx", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qx_rowcol_striped_profile_avx512_512_8", "sg_qx", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qx_rowcol_striped_profile_avx512_512_sat", "sg_qx", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qx_rowcol_scan_profile_altivec_128_64", "sg_qx", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qx_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qx_rowcol_scan_profile_altivec_128_32", "sg_qx", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11415,6 +13444,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_db_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_db_rowcol_striped_profile_avx2_256_8", "sg_db", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_db_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_db_rowcol_striped_profile_avx2_256_sat", "sg_db", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_db_rowcol_scan_profile_avx512_512_64", "sg_db", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_db_rowcol_scan_profile_avx512_512_32", "sg_db", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_db_rowcol_scan_profile_avx512_512_16", "sg_db", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_db_rowcol_scan_profile_avx512_512_8", "sg_db", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_db_rowcol_scan_profile_avx512_512_sat", "sg_db", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_db_rowcol_striped_profile_avx512_512_64", "sg_db", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_db_rowcol_striped_profile_avx512_512_32", "sg_db", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_db_rowcol_striped_profile_avx512_512_16", "sg_db", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_db_rowcol_striped_profile_avx512_512_8", "sg_db", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_db_rowcol_striped_profile_avx512_512_sat", "sg_db", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_db_rowcol_scan_profile_altivec_128_64", "sg_db", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_db_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_db_rowcol_scan_profile_altivec_128_32", "sg_db", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11485,6 +13526,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_de_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_de_rowcol_striped_profile_avx2_256_8", "sg_de", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_de_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_de_rowcol_striped_profile_avx2_256_sat", "sg_de", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_de_rowcol_scan_profile_avx512_512_64", "sg_de", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_de_rowcol_scan_profile_avx512_512_32", "sg_de", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_de_rowcol_scan_profile_avx512_512_16", "sg_de", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_de_rowcol_scan_profile_avx512_512_8", "sg_de", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_de_rowcol_scan_profile_avx512_512_sat", "sg_de", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_de_rowcol_striped_profile_avx512_512_64", "sg_de", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_de_rowcol_striped_profile_avx512_512_32", "sg_de", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_de_rowcol_striped_profile_avx512_512_16", "sg_de", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_de_rowcol_striped_profile_avx512_512_8", "sg_de", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_de_rowcol_striped_profile_avx512_512_sat", "sg_de", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_de_rowcol_scan_profile_altivec_128_64", "sg_de", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_de_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_de_rowcol_scan_profile_altivec_128_32", "sg_de", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11555,6 +13608,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_dx_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_dx_rowcol_striped_profile_avx2_256_8", "sg_dx", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_dx_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_dx_rowcol_striped_profile_avx2_256_sat", "sg_dx", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_dx_rowcol_scan_profile_avx512_512_64", "sg_dx", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_dx_rowcol_scan_profile_avx512_512_32", "sg_dx", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_dx_rowcol_scan_profile_avx512_512_16", "sg_dx", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_dx_rowcol_scan_profile_avx512_512_8", "sg_dx", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_dx_rowcol_scan_profile_avx512_512_sat", "sg_dx", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_dx_rowcol_striped_profile_avx512_512_64", "sg_dx", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_dx_rowcol_striped_profile_avx512_512_32", "sg_dx", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_dx_rowcol_striped_profile_avx512_512_16", "sg_dx", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_dx_rowcol_striped_profile_avx512_512_8", "sg_dx", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_dx_rowcol_striped_profile_avx512_512_sat", "sg_dx", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_dx_rowcol_scan_profile_altivec_128_64", "sg_dx", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_dx_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_dx_rowcol_scan_profile_altivec_128_32", "sg_dx", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11625,6 +13690,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_de_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qb_de_rowcol_striped_profile_avx2_256_8", "sg_qb_de", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qb_de_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qb_de_rowcol_striped_profile_avx2_256_sat", "sg_qb_de", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_de_rowcol_scan_profile_avx512_512_64", "sg_qb_de", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_de_rowcol_scan_profile_avx512_512_32", "sg_qb_de", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_de_rowcol_scan_profile_avx512_512_16", "sg_qb_de", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_de_rowcol_scan_profile_avx512_512_8", "sg_qb_de", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_de_rowcol_scan_profile_avx512_512_sat", "sg_qb_de", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_de_rowcol_striped_profile_avx512_512_64", "sg_qb_de", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_de_rowcol_striped_profile_avx512_512_32", "sg_qb_de", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_de_rowcol_striped_profile_avx512_512_16", "sg_qb_de", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_de_rowcol_striped_profile_avx512_512_8", "sg_qb_de", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_de_rowcol_striped_profile_avx512_512_sat", "sg_qb_de", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qb_de_rowcol_scan_profile_altivec_128_64", "sg_qb_de", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qb_de_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qb_de_rowcol_scan_profile_altivec_128_32", "sg_qb_de", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11695,6 +13772,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_db_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qe_db_rowcol_striped_profile_avx2_256_8", "sg_qe_db", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_qe_db_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qe_db_rowcol_striped_profile_avx2_256_sat", "sg_qe_db", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_rowcol_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_db_rowcol_scan_profile_avx512_512_64", "sg_qe_db", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_db_rowcol_scan_profile_avx512_512_32", "sg_qe_db", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_db_rowcol_scan_profile_avx512_512_16", "sg_qe_db", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_db_rowcol_scan_profile_avx512_512_8", "sg_qe_db", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_db_rowcol_scan_profile_avx512_512_sat", "sg_qe_db", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_db_rowcol_striped_profile_avx512_512_64", "sg_qe_db", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_db_rowcol_striped_profile_avx512_512_32", "sg_qe_db", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_db_rowcol_striped_profile_avx512_512_16", "sg_qe_db", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_db_rowcol_striped_profile_avx512_512_8", "sg_qe_db", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_db_rowcol_striped_profile_avx512_512_sat", "sg_qe_db", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qe_db_rowcol_scan_profile_altivec_128_64", "sg_qe_db", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_qe_db_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qe_db_rowcol_scan_profile_altivec_128_32", "sg_qe_db", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -11765,6 +13854,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_rowcol_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_nw_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_rowcol_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_nw_stats_rowcol_scan_profile_avx512_512_64", "nw_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_nw_stats_rowcol_scan_profile_avx512_512_32", "nw_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_nw_stats_rowcol_scan_profile_avx512_512_16", "nw_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_nw_stats_rowcol_scan_profile_avx512_512_8", "nw_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_nw_stats_rowcol_scan_profile_avx512_512_sat", "nw_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_nw_stats_rowcol_striped_profile_avx512_512_64", "nw_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_nw_stats_rowcol_striped_profile_avx512_512_32", "nw_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_nw_stats_rowcol_striped_profile_avx512_512_16", "nw_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_nw_stats_rowcol_striped_profile_avx512_512_8", "nw_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_nw_stats_rowcol_striped_profile_avx512_512_sat", "nw_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_nw_stats_rowcol_scan_profile_altivec_128_64", "nw_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_nw_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_nw_stats_rowcol_scan_profile_altivec_128_32", "nw_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -11835,6 +13936,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_rowcol_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_rowcol_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_stats_rowcol_scan_profile_avx512_512_64", "sg_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_stats_rowcol_scan_profile_avx512_512_32", "sg_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_stats_rowcol_scan_profile_avx512_512_16", "sg_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_stats_rowcol_scan_profile_avx512_512_8", "sg_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_stats_rowcol_scan_profile_avx512_512_sat", "sg_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_stats_rowcol_striped_profile_avx512_512_64", "sg_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_stats_rowcol_striped_profile_avx512_512_32", "sg_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_stats_rowcol_striped_profile_avx512_512_16", "sg_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_stats_rowcol_striped_profile_avx512_512_8", "sg_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_stats_rowcol_striped_profile_avx512_512_sat", "sg_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_stats_rowcol_scan_profile_altivec_128_64", "sg_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_stats_rowcol_scan_profile_altivec_128_32", "sg_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -11905,6 +14018,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_rowcol_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sw_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_rowcol_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sw_stats_rowcol_scan_profile_avx512_512_64", "sw_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sw_stats_rowcol_scan_profile_avx512_512_32", "sw_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sw_stats_rowcol_scan_profile_avx512_512_16", "sw_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sw_stats_rowcol_scan_profile_avx512_512_8", "sw_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sw_stats_rowcol_scan_profile_avx512_512_sat", "sw_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sw_stats_rowcol_striped_profile_avx512_512_64", "sw_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sw_stats_rowcol_striped_profile_avx512_512_32", "sw_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sw_stats_rowcol_striped_profile_avx512_512_16", "sw_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sw_stats_rowcol_striped_profile_avx512_512_8", "sw_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sw_stats_rowcol_striped_profile_avx512_512_sat", "sw_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sw_stats_rowcol_scan_profile_altivec_128_64", "sw_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sw_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sw_stats_rowcol_scan_profile_altivec_128_32", "sw_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -11975,6 +14100,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qb_stats_rowcol_striped_profile_avx2_256_8", "sg_qb_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qb_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qb_stats_rowcol_striped_profile_avx2_256_sat", "sg_qb_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_64", "sg_qb_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_32", "sg_qb_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_16", "sg_qb_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_8", "sg_qb_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_stats_rowcol_scan_profile_avx512_512_sat", "sg_qb_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_64", "sg_qb_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_32", "sg_qb_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_16", "sg_qb_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_8", "sg_qb_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_stats_rowcol_striped_profile_avx512_512_sat", "sg_qb_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qb_stats_rowcol_scan_profile_altivec_128_64", "sg_qb_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qb_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qb_stats_rowcol_scan_profile_altivec_128_32", "sg_qb_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -12045,6 +14182,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qe_stats_rowcol_striped_profile_avx2_256_8", "sg_qe_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qe_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qe_stats_rowcol_striped_profile_avx2_256_sat", "sg_qe_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_64", "sg_qe_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_32", "sg_qe_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_16", "sg_qe_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_8", "sg_qe_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_stats_rowcol_scan_profile_avx512_512_sat", "sg_qe_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_64", "sg_qe_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_32", "sg_qe_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_16", "sg_qe_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_8", "sg_qe_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_stats_rowcol_striped_profile_avx512_512_sat", "sg_qe_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qe_stats_rowcol_scan_profile_altivec_128_64", "sg_qe_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qe_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qe_stats_rowcol_scan_profile_altivec_128_32", "sg_qe_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -12115,6 +14264,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qx_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qx_stats_rowcol_striped_profile_avx2_256_8", "sg_qx_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qx_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qx_stats_rowcol_striped_profile_avx2_256_sat", "sg_qx_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_64", "sg_qx_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_32", "sg_qx_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_16", "sg_qx_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_8", "sg_qx_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qx_stats_rowcol_scan_profile_avx512_512_sat", "sg_qx_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_64", "sg_qx_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_32", "sg_qx_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_16", "sg_qx_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_8", "sg_qx_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qx_stats_rowcol_striped_profile_avx512_512_sat", "sg_qx_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qx_stats_rowcol_scan_profile_altivec_128_64", "sg_qx_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qx_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qx_stats_rowcol_scan_profile_altivec_128_32", "sg_qx_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -12185,6 +14346,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_db_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_db_stats_rowcol_striped_profile_avx2_256_8", "sg_db_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_db_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_db_stats_rowcol_striped_profile_avx2_256_sat", "sg_db_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_db_stats_rowcol_scan_profile_avx512_512_64", "sg_db_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_db_stats_rowcol_scan_profile_avx512_512_32", "sg_db_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_db_stats_rowcol_scan_profile_avx512_512_16", "sg_db_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_db_stats_rowcol_scan_profile_avx512_512_8", "sg_db_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_db_stats_rowcol_scan_profile_avx512_512_sat", "sg_db_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_db_stats_rowcol_striped_profile_avx512_512_64", "sg_db_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_db_stats_rowcol_striped_profile_avx512_512_32", "sg_db_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_db_stats_rowcol_striped_profile_avx512_512_16", "sg_db_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_db_stats_rowcol_striped_profile_avx512_512_8", "sg_db_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_db_stats_rowcol_striped_profile_avx512_512_sat", "sg_db_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_db_stats_rowcol_scan_profile_altivec_128_64", "sg_db_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_db_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_db_stats_rowcol_scan_profile_altivec_128_32", "sg_db_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -12255,6 +14428,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_de_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_de_stats_rowcol_striped_profile_avx2_256_8", "sg_de_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_de_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_de_stats_rowcol_striped_profile_avx2_256_sat", "sg_de_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_de_stats_rowcol_scan_profile_avx512_512_64", "sg_de_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_de_stats_rowcol_scan_profile_avx512_512_32", "sg_de_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_de_stats_rowcol_scan_profile_avx512_512_16", "sg_de_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_de_stats_rowcol_scan_profile_avx512_512_8", "sg_de_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_de_stats_rowcol_scan_profile_avx512_512_sat", "sg_de_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_de_stats_rowcol_striped_profile_avx512_512_64", "sg_de_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_de_stats_rowcol_striped_profile_avx512_512_32", "sg_de_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_de_stats_rowcol_striped_profile_avx512_512_16", "sg_de_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_de_stats_rowcol_striped_profile_avx512_512_8", "sg_de_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_de_stats_rowcol_striped_profile_avx512_512_sat", "sg_de_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_de_stats_rowcol_scan_profile_altivec_128_64", "sg_de_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_de_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_de_stats_rowcol_scan_profile_altivec_128_32", "sg_de_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -12325,6 +14510,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_dx_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_dx_stats_rowcol_striped_profile_avx2_256_8", "sg_dx_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_dx_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_dx_stats_rowcol_striped_profile_avx2_256_sat", "sg_dx_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_64", "sg_dx_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_32", "sg_dx_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_16", "sg_dx_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_8", "sg_dx_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_dx_stats_rowcol_scan_profile_avx512_512_sat", "sg_dx_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_64", "sg_dx_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_32", "sg_dx_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_16", "sg_dx_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_8", "sg_dx_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_dx_stats_rowcol_striped_profile_avx512_512_sat", "sg_dx_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_dx_stats_rowcol_scan_profile_altivec_128_64", "sg_dx_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_dx_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_dx_stats_rowcol_scan_profile_altivec_128_32", "sg_dx_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -12395,6 +14592,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_de_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qb_de_stats_rowcol_striped_profile_avx2_256_8", "sg_qb_de_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qb_de_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qb_de_stats_rowcol_striped_profile_avx2_256_sat", "sg_qb_de_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_64", "sg_qb_de_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_32", "sg_qb_de_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_16", "sg_qb_de_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_8", "sg_qb_de_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_de_stats_rowcol_scan_profile_avx512_512_sat", "sg_qb_de_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_64", "sg_qb_de_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_32", "sg_qb_de_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_16", "sg_qb_de_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_8", "sg_qb_de_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qb_de_stats_rowcol_striped_profile_avx512_512_sat", "sg_qb_de_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qb_de_stats_rowcol_scan_profile_altivec_128_64", "sg_qb_de_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qb_de_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qb_de_stats_rowcol_scan_profile_altivec_128_32", "sg_qb_de_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -12465,6 +14674,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_db_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_qe_db_stats_rowcol_striped_profile_avx2_256_8", "sg_qe_db_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_qe_db_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_qe_db_stats_rowcol_striped_profile_avx2_256_sat", "sg_qe_db_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_64", "sg_qe_db_stats", "scan_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_32", "sg_qe_db_stats", "scan_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_16", "sg_qe_db_stats", "scan_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_8", "sg_qe_db_stats", "scan_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_db_stats_rowcol_scan_profile_avx512_512_sat", "sg_qe_db_stats", "scan_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_64, parasail_profile_create_stats_avx512_512_64, "parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_64", "sg_qe_db_stats", "striped_profile", "avx512", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_32, parasail_profile_create_stats_avx512_512_32, "parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_32", "sg_qe_db_stats", "striped_profile", "avx512", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_16, parasail_profile_create_stats_avx512_512_16, "parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_16", "sg_qe_db_stats", "striped_profile", "avx512", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_8, parasail_profile_create_stats_avx512_512_8, "parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_8", "sg_qe_db_stats", "striped_profile", "avx512", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_sat, parasail_profile_create_stats_avx512_512_sat, "parasail_sg_qe_db_stats_rowcol_striped_profile_avx512_512_sat", "sg_qe_db_stats", "striped_profile", "avx512", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_qe_db_stats_rowcol_scan_profile_altivec_128_64", "sg_qe_db_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_qe_db_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_qe_db_stats_rowcol_scan_profile_altivec_128_32", "sg_qe_db_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -12535,6 +14756,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_trace_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_nw_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_trace_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_nw_trace_scan_profile_avx512_512_64", "nw", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_nw_trace_scan_profile_avx512_512_32", "nw", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_nw_trace_scan_profile_avx512_512_16", "nw", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_nw_trace_scan_profile_avx512_512_8", "nw", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_nw_trace_scan_profile_avx512_512_sat", "nw", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_nw_trace_striped_profile_avx512_512_64", "nw", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_nw_trace_striped_profile_avx512_512_32", "nw", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_nw_trace_striped_profile_avx512_512_16", "nw", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_nw_trace_striped_profile_avx512_512_8", "nw", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_nw_trace_striped_profile_avx512_512_sat", "nw", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_nw_trace_scan_profile_altivec_128_64", "nw", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_nw_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_nw_trace_scan_profile_altivec_128_32", "nw", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -12605,6 +14838,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_trace_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_trace_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_trace_scan_profile_avx512_512_64", "sg", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_trace_scan_profile_avx512_512_32", "sg", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_trace_scan_profile_avx512_512_16", "sg", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_trace_scan_profile_avx512_512_8", "sg", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_trace_scan_profile_avx512_512_sat", "sg", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_trace_striped_profile_avx512_512_64", "sg", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_trace_striped_profile_avx512_512_32", "sg", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_trace_striped_profile_avx512_512_16", "sg", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_trace_striped_profile_avx512_512_8", "sg", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_trace_striped_profile_avx512_512_sat", "sg", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_trace_scan_profile_altivec_128_64", "sg", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_trace_scan_profile_altivec_128_32", "sg", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -12675,6 +14920,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_trace_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sw_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_trace_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sw_trace_scan_profile_avx512_512_64", "sw", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sw_trace_scan_profile_avx512_512_32", "sw", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sw_trace_scan_profile_avx512_512_16", "sw", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sw_trace_scan_profile_avx512_512_8", "sw", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sw_trace_scan_profile_avx512_512_sat", "sw", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sw_trace_striped_profile_avx512_512_64", "sw", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sw_trace_striped_profile_avx512_512_32", "sw", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sw_trace_striped_profile_avx512_512_16", "sw", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sw_trace_striped_profile_avx512_512_8", "sw", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sw_trace_striped_profile_avx512_512_sat", "sw", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sw_trace_scan_profile_altivec_128_64", "sw", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sw_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sw_trace_scan_profile_altivec_128_32", "sw", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -12745,6 +15002,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qb_trace_striped_profile_avx2_256_8", "sg_qb", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qb_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qb_trace_striped_profile_avx2_256_sat", "sg_qb", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_trace_scan_profile_avx512_512_64", "sg_qb", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_trace_scan_profile_avx512_512_32", "sg_qb", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_trace_scan_profile_avx512_512_16", "sg_qb", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_trace_scan_profile_avx512_512_8", "sg_qb", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_trace_scan_profile_avx512_512_sat", "sg_qb", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_trace_striped_profile_avx512_512_64", "sg_qb", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_trace_striped_profile_avx512_512_32", "sg_qb", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_trace_striped_profile_avx512_512_16", "sg_qb", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_trace_striped_profile_avx512_512_8", "sg_qb", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_trace_striped_profile_avx512_512_sat", "sg_qb", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qb_trace_scan_profile_altivec_128_64", "sg_qb", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qb_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qb_trace_scan_profile_altivec_128_32", "sg_qb", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -12815,6 +15084,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qe_trace_striped_profile_avx2_256_8", "sg_qe", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qe_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qe_trace_striped_profile_avx2_256_sat", "sg_qe", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_trace_scan_profile_avx512_512_64", "sg_qe", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_trace_scan_profile_avx512_512_32", "sg_qe", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_trace_scan_profile_avx512_512_16", "sg_qe", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_trace_scan_profile_avx512_512_8", "sg_qe", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_trace_scan_profile_avx512_512_sat", "sg_qe", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_trace_striped_profile_avx512_512_64", "sg_qe", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_trace_striped_profile_avx512_512_32", "sg_qe", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_trace_striped_profile_avx512_512_16", "sg_qe", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_trace_striped_profile_avx512_512_8", "sg_qe", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_trace_striped_profile_avx512_512_sat", "sg_qe", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qe_trace_scan_profile_altivec_128_64", "sg_qe", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qe_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qe_trace_scan_profile_altivec_128_32", "sg_qe", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -12885,6 +15166,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qx_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qx_trace_striped_profile_avx2_256_8", "sg_qx", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qx_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qx_trace_striped_profile_avx2_256_sat", "sg_qx", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qx_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qx_trace_scan_profile_avx512_512_64", "sg_qx", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qx_trace_scan_profile_avx512_512_32", "sg_qx", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qx_trace_scan_profile_avx512_512_16", "sg_qx", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qx_trace_scan_profile_avx512_512_8", "sg_qx", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qx_trace_scan_profile_avx512_512_sat", "sg_qx", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qx_trace_striped_profile_avx512_512_64", "sg_qx", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qx_trace_striped_profile_avx512_512_32", "sg_qx", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qx_trace_striped_profile_avx512_512_16", "sg_qx", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qx_trace_striped_profile_avx512_512_8", "sg_qx", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qx_trace_striped_profile_avx512_512_sat", "sg_qx", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qx_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qx_trace_scan_profile_altivec_128_64", "sg_qx", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qx_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qx_trace_scan_profile_altivec_128_32", "sg_qx", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -12955,6 +15248,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_db_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_db_trace_striped_profile_avx2_256_8", "sg_db", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_db_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_db_trace_striped_profile_avx2_256_sat", "sg_db", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_db_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_db_trace_scan_profile_avx512_512_64", "sg_db", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_db_trace_scan_profile_avx512_512_32", "sg_db", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_db_trace_scan_profile_avx512_512_16", "sg_db", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_db_trace_scan_profile_avx512_512_8", "sg_db", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_db_trace_scan_profile_avx512_512_sat", "sg_db", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_db_trace_striped_profile_avx512_512_64", "sg_db", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_db_trace_striped_profile_avx512_512_32", "sg_db", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_db_trace_striped_profile_avx512_512_16", "sg_db", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_db_trace_striped_profile_avx512_512_8", "sg_db", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_db_trace_striped_profile_avx512_512_sat", "sg_db", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_db_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_db_trace_scan_profile_altivec_128_64", "sg_db", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_db_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_db_trace_scan_profile_altivec_128_32", "sg_db", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -13025,6 +15330,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_de_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_de_trace_striped_profile_avx2_256_8", "sg_de", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_de_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_de_trace_striped_profile_avx2_256_sat", "sg_de", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_de_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_de_trace_scan_profile_avx512_512_64", "sg_de", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_de_trace_scan_profile_avx512_512_32", "sg_de", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_de_trace_scan_profile_avx512_512_16", "sg_de", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_de_trace_scan_profile_avx512_512_8", "sg_de", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_de_trace_scan_profile_avx512_512_sat", "sg_de", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_de_trace_striped_profile_avx512_512_64", "sg_de", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_de_trace_striped_profile_avx512_512_32", "sg_de", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_de_trace_striped_profile_avx512_512_16", "sg_de", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_de_trace_striped_profile_avx512_512_8", "sg_de", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_de_trace_striped_profile_avx512_512_sat", "sg_de", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_de_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_de_trace_scan_profile_altivec_128_64", "sg_de", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_de_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_de_trace_scan_profile_altivec_128_32", "sg_de", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -13095,6 +15412,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_dx_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_dx_trace_striped_profile_avx2_256_8", "sg_dx", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_dx_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_dx_trace_striped_profile_avx2_256_sat", "sg_dx", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_dx_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_dx_trace_scan_profile_avx512_512_64", "sg_dx", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_dx_trace_scan_profile_avx512_512_32", "sg_dx", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_dx_trace_scan_profile_avx512_512_16", "sg_dx", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_dx_trace_scan_profile_avx512_512_8", "sg_dx", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_dx_trace_scan_profile_avx512_512_sat", "sg_dx", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_dx_trace_striped_profile_avx512_512_64", "sg_dx", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_dx_trace_striped_profile_avx512_512_32", "sg_dx", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_dx_trace_striped_profile_avx512_512_16", "sg_dx", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_dx_trace_striped_profile_avx512_512_8", "sg_dx", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_dx_trace_striped_profile_avx512_512_sat", "sg_dx", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_dx_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_dx_trace_scan_profile_altivec_128_64", "sg_dx", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_dx_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_dx_trace_scan_profile_altivec_128_32", "sg_dx", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -13165,6 +15494,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qb_de_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qb_de_trace_striped_profile_avx2_256_8", "sg_qb_de", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qb_de_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qb_de_trace_striped_profile_avx2_256_sat", "sg_qb_de", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qb_de_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_de_trace_scan_profile_avx512_512_64", "sg_qb_de", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_de_trace_scan_profile_avx512_512_32", "sg_qb_de", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_de_trace_scan_profile_avx512_512_16", "sg_qb_de", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_de_trace_scan_profile_avx512_512_8", "sg_qb_de", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_de_trace_scan_profile_avx512_512_sat", "sg_qb_de", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qb_de_trace_striped_profile_avx512_512_64", "sg_qb_de", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qb_de_trace_striped_profile_avx512_512_32", "sg_qb_de", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qb_de_trace_striped_profile_avx512_512_16", "sg_qb_de", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qb_de_trace_striped_profile_avx512_512_8", "sg_qb_de", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qb_de_trace_striped_profile_avx512_512_sat", "sg_qb_de", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qb_de_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qb_de_trace_scan_profile_altivec_128_64", "sg_qb_de", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qb_de_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qb_de_trace_scan_profile_altivec_128_32", "sg_qb_de", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -13235,6 +15576,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_qe_db_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_qe_db_trace_striped_profile_avx2_256_8", "sg_qe_db", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_qe_db_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_qe_db_trace_striped_profile_avx2_256_sat", "sg_qe_db", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_qe_db_trace_scan_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_db_trace_scan_profile_avx512_512_64", "sg_qe_db", "scan_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_db_trace_scan_profile_avx512_512_32", "sg_qe_db", "scan_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_db_trace_scan_profile_avx512_512_16", "sg_qe_db", "scan_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_db_trace_scan_profile_avx512_512_8", "sg_qe_db", "scan_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_db_trace_scan_profile_avx512_512_sat", "sg_qe_db", "scan_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_profile_avx512_512_64, parasail_profile_create_avx512_512_64, "parasail_sg_qe_db_trace_striped_profile_avx512_512_64", "sg_qe_db", "striped_profile", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_profile_avx512_512_32, parasail_profile_create_avx512_512_32, "parasail_sg_qe_db_trace_striped_profile_avx512_512_32", "sg_qe_db", "striped_profile", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_profile_avx512_512_16, parasail_profile_create_avx512_512_16, "parasail_sg_qe_db_trace_striped_profile_avx512_512_16", "sg_qe_db", "striped_profile", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_profile_avx512_512_8, parasail_profile_create_avx512_512_8, "parasail_sg_qe_db_trace_striped_profile_avx512_512_8", "sg_qe_db", "striped_profile", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_profile_avx512_512_sat, parasail_profile_create_avx512_512_sat, "parasail_sg_qe_db_trace_striped_profile_avx512_512_sat", "sg_qe_db", "striped_profile", "avx512", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_qe_db_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_qe_db_trace_scan_profile_altivec_128_64", "sg_qe_db", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_qe_db_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_qe_db_trace_scan_profile_altivec_128_32", "sg_qe_db", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -9,6 +9,7 @@
 #define _PARASAIL_INTERNAL_ALTIVEC_H_
 
 #include <stdint.h>
+#include <string.h>
 
 #include <altivec.h>
 
@@ -623,6 +624,41 @@ static inline vec128i _mm_blendv_epi8(vec128i a, vec128i b, vec128i mask)
     return a;
 }
 
+static inline vec128i _mm_loadu_si128(const vec128i *address)
+{
+    vec128i_8_t A;
+    memcpy(A.v, address, sizeof(A.v));
+    return A.m;
+}
+
+static inline void _mm_storeu_si128(vec128i *address, vec128i v)
+{
+    vec128i_8_t A;
+    A.m = v;
+    memcpy(address, A.v, sizeof(A.v));
+}
+
+static inline vec128i _mm_adds_epu8(vec128i a, vec128i b)
+{
+    return (vec128i) vec_adds((vec16ub) a, (vec16ub) b);
+}
+
+static inline vec128i _mm_subs_epu8(vec128i a, vec128i b)
+{
+    return (vec128i) vec_subs((vec16ub) a, (vec16ub) b);
+}
+
+static inline vec128i _mm_max_epu8(vec128i a, vec128i b)
+{
+    return (vec128i) vec_max((vec16ub) a, (vec16ub) b);
+}
+
+static inline vec128i _mm_shuffle_epi8(vec128i a, vec128i b)
+{
+    vec128i r = (vec128i) vec_perm((vec16ub) a, (vec16ub) a, (vec16ub) b);
+    return _mm_andnot_si128(_mm_cmplt_epi8(b, _mm_setzero_si128()), r);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,54 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#ifndef _PARASAIL_INTERNAL_AVX512_H_
+#define _PARASAIL_INTERNAL_AVX512_H_
+
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef union __m512i_8 {
+    __m512i m;
+    int8_t v[64];
+} __m512i_8_t;
+
+typedef union __m512i_16 {
+    __m512i m;
+    int16_t v[32];
+} __m512i_16_t;
+
+typedef union __m512i_32 {
+    __m512i m;
+    int32_t v[16];
+} __m512i_32_t;
+
+typedef union __m512i_64 {
+    __m512i m;
+    int64_t v[8];
+} __m512i_64_t;
+
+extern
+__m512i * parasail_memalign___m512i(size_t alignment, size_t size);
+
+extern
+void parasail_memset___m512i(__m512i *b, __m512i c, size_t len);
+
+extern
+void parasail_free___m512i(void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PARASAIL_INTERNAL_AVX512_H_ */
@@ -33,6 +33,68 @@ extern void parasail_memset_int16_t(int16_t *b, int16_t c, size_t len);
 extern void parasail_memset_int32_t(int32_t *b, int32_t c, size_t len);
 extern void parasail_memset_int64_t(int64_t *b, int64_t c, size_t len);
 
+/* Column state handed from a saturated sw striped kernel to the next
+ * wider one so that it resumes instead of starting over.  H and E are
+ * unbiased and in query order; column is -1 until a kernel saturates. */
+typedef struct parasail_sat_state {
+    int *H;         /* H of the saturated column */
+    int *E;         /* E of the saturated column */
+    int column;     /* database position of the saturated column */
+    int score;      /* best score through the saturated column */
+} parasail_sat_state_t;
+
+/* save copies the real query rows of a striped column out in query
+ * order, unbiased; load copies them back in striped order */
+extern void parasail_sat_state_save_int8_t(
+        parasail_sat_state_t * const restrict state,
+        const int8_t * const restrict H,
+        const int8_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int8_t bias);
+extern void parasail_sat_state_load_int8_t(
+        const parasail_sat_state_t * const restrict state,
+        int8_t * const restrict H,
+        int8_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int8_t bias);
+extern void parasail_sat_state_save_int16_t(
+        parasail_sat_state_t * const restrict state,
+        const int16_t * const restrict H,
+        const int16_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int16_t bias);
+extern void parasail_sat_state_load_int16_t(
+        const parasail_sat_state_t * const restrict state,
+        int16_t * const restrict H,
+        int16_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int16_t bias);
+extern void parasail_sat_state_save_int32_t(
+        parasail_sat_state_t * const restrict state,
+        const int32_t * const restrict H,
+        const int32_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int32_t bias);
+extern void parasail_sat_state_load_int32_t(
+        const parasail_sat_state_t * const restrict state,
+        int32_t * const restrict H,
+        int32_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int32_t bias);
+extern void parasail_sat_state_save_int64_t(
+        parasail_sat_state_t * const restrict state,
+        const int64_t * const restrict H,
+        const int64_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int64_t bias);
+extern void parasail_sat_state_load_int64_t(
+        const parasail_sat_state_t * const restrict state,
+        int64_t * const restrict H,
+        int64_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int64_t bias);
+
+extern void parasail_result_init(parasail_result_t *result);
 extern parasail_result_t* parasail_result_new();
 extern parasail_result_t* parasail_result_new_stats();
 extern parasail_result_t* parasail_result_new_table1(const int a, const int b);
@@ -40,10 +102,20 @@ extern parasail_result_t* parasail_result_new_table3(const int a, const int b);
 extern parasail_result_t* parasail_result_new_rowcol1(const int a, const int b);
 extern parasail_result_t* parasail_result_new_rowcol3(const int a, const int b);
 extern parasail_result_t* parasail_result_new_trace(const int a, const int b, const size_t alignment, const size_t size);
+extern parasail_result_t* parasail_result_new_trace_path(parasail_cigar_t *path);
 
+extern void parasail_profile_init(parasail_profile_t *profile,
+        const char * s1, const int s1Len, const parasail_matrix_t *matrix);
 extern parasail_profile_t* parasail_profile_new(
         const char * s1, const int s1Len, const parasail_matrix_t *matrix);
 
+/* Leave one width of the profile to be built by creator on the first
+ * parasail_profile_materialize for it. */
+extern void parasail_profile_defer(parasail_profile_t *profile, int bits,
+        parasail_pcreator_t *creator);
+/* Whether one width of the profile is built or deferred. */
+extern int parasail_profile_has(const parasail_profile_t *profile, int bits);
+
 extern char* parasail_reverse(const char *s, size_t end);
 extern uint32_t* parasail_reverse_uint32_t(const uint32_t *s, size_t end);
 
@@ -57,6 +129,141 @@ extern uint32_t* parasail_reverse_uint32_t(const uint32_t *s, size_t end);
 #define PARASAIL_FLAG_BITS_INT PARASAIL_FLAG_BITS_64
 #endif
 
+/* Expand one 4-bit cell of a PARASAIL_TRACE_FORMAT_PACKED table into
+ * the PARASAIL_* trace bits.  Bits 0-1 hold the direction (0 zero,
+ * 1 ins, 2 del, 3 diag), bit 2 is set for INS_E and bit 3 for DEL_F. */
+static inline int parasail_trace_unpack(int cell)
+{
+    static const int direction[4] = {
+        PARASAIL_ZERO, PARASAIL_INS, PARASAIL_DEL, PARASAIL_DIAG
+    };
+    return direction[cell & 3]
+        | ((cell & 4) ? PARASAIL_INS_E : PARASAIL_DIAG_E)
+        | ((cell & 8) ? PARASAIL_DEL_F : PARASAIL_DIAG_F);
+}
+
+/* Banded anti-diagonal kernels for one instruction set and width.
+ * flags selects the algorithm and variant (PARASAIL_FLAG_NW, _SG or _SW,
+ * optionally with PARASAIL_FLAG_STATS or PARASAIL_FLAG_TRACE).  When e1
+ * and e2 are not NULL their packed indices are read in place instead of
+ * mapping s1 and s2. */
+typedef parasail_result_t* parasail_banded_kernel_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive);
+
+extern parasail_banded_kernel_t parasail_banded_novec_32;
+extern parasail_banded_kernel_t parasail_banded_sse41_128_8;
+extern parasail_banded_kernel_t parasail_banded_sse41_128_16;
+extern parasail_banded_kernel_t parasail_banded_sse41_128_32;
+extern parasail_banded_kernel_t parasail_banded_avx2_256_8;
+extern parasail_banded_kernel_t parasail_banded_avx2_256_16;
+extern parasail_banded_kernel_t parasail_banded_avx2_256_32;
+extern parasail_banded_kernel_t parasail_banded_avx512_512_8;
+extern parasail_banded_kernel_t parasail_banded_avx512_512_16;
+extern parasail_banded_kernel_t parasail_banded_avx512_512_32;
+
+/* The best banded kernel of each width for the CPU, and the 8, 16 then
+ * 32-bit chain of them; generated in kernel_dispatch.c and satcheck.c. */
+extern parasail_banded_kernel_t parasail_banded_8;
+extern parasail_banded_kernel_t parasail_banded_16;
+extern parasail_banded_kernel_t parasail_banded_32;
+extern parasail_banded_kernel_t parasail_banded_sat;
+
+/* Profile-free striped kernels for one instruction set and width.
+ * flags selects the algorithm (PARASAIL_FLAG_NW, _SG or _SW).  The
+ * matrix must have at most 16 residues with scores that fit in 8 bits. */
+typedef parasail_result_t* parasail_dna_kernel_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int flags);
+
+extern parasail_dna_kernel_t parasail_dna_sse41_128_8;
+extern parasail_dna_kernel_t parasail_dna_sse41_128_16;
+extern parasail_dna_kernel_t parasail_dna_sse41_128_32;
+extern parasail_dna_kernel_t parasail_dna_avx2_256_8;
+extern parasail_dna_kernel_t parasail_dna_avx2_256_16;
+extern parasail_dna_kernel_t parasail_dna_avx2_256_32;
+extern parasail_dna_kernel_t parasail_dna_avx512_512_8;
+extern parasail_dna_kernel_t parasail_dna_avx512_512_16;
+extern parasail_dna_kernel_t parasail_dna_avx512_512_32;
+
+/* The striped functions that take the place of the dna kernels without
+ * a vector ISA or for other matrices, and as for the banded kernels the
+ * dispatched kernel of each width and their 8, 16 then 32-bit chain. */
+extern parasail_dna_kernel_t parasail_dna_striped_8;
+extern parasail_dna_kernel_t parasail_dna_striped_16;
+extern parasail_dna_kernel_t parasail_dna_striped_32;
+extern parasail_dna_kernel_t parasail_dna_striped_sat;
+extern parasail_dna_kernel_t parasail_dna_8;
+extern parasail_dna_kernel_t parasail_dna_16;
+extern parasail_dna_kernel_t parasail_dna_32;
+extern parasail_dna_kernel_t parasail_dna_sat;
+
+/* Hybrid striped and scan kernels for one instruction set and width.
+ * flags selects the algorithm (PARASAIL_FLAG_NW, _SG or _SW). */
+typedef parasail_result_t* parasail_hybrid_kernel_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int flags);
+
+extern parasail_hybrid_kernel_t parasail_hybrid_sse41_128_8;
+extern parasail_hybrid_kernel_t parasail_hybrid_sse41_128_16;
+extern parasail_hybrid_kernel_t parasail_hybrid_sse41_128_32;
+extern parasail_hybrid_kernel_t parasail_hybrid_avx2_256_8;
+extern parasail_hybrid_kernel_t parasail_hybrid_avx2_256_16;
+extern parasail_hybrid_kernel_t parasail_hybrid_avx2_256_32;
+extern parasail_hybrid_kernel_t parasail_hybrid_avx512_512_8;
+extern parasail_hybrid_kernel_t parasail_hybrid_avx512_512_16;
+extern parasail_hybrid_kernel_t parasail_hybrid_avx512_512_32;
+
+/* The scan functions used without a vector ISA, and the dispatched
+ * kernel of each width and their 8, 16 then 32-bit chain. */
+extern parasail_hybrid_kernel_t parasail_hybrid_scan_8;
+extern parasail_hybrid_kernel_t parasail_hybrid_scan_16;
+extern parasail_hybrid_kernel_t parasail_hybrid_scan_32;
+extern parasail_hybrid_kernel_t parasail_hybrid_8;
+extern parasail_hybrid_kernel_t parasail_hybrid_16;
+extern parasail_hybrid_kernel_t parasail_hybrid_32;
+extern parasail_hybrid_kernel_t parasail_hybrid_sat;
+
+/* Striped functions that run queries of up to four segments in
+ * register-resident kernels and longer ones in the striped function of
+ * the same instruction set and width.  The dispatchers of the plain
+ * striped functions point at these, except for 8-bit nw. */
+extern parasail_function_t parasail_nw_striped_short_sse41_128_16;
+extern parasail_function_t parasail_nw_striped_short_sse41_128_32;
+extern parasail_function_t parasail_nw_striped_short_avx2_256_16;
+extern parasail_function_t parasail_nw_striped_short_avx2_256_32;
+extern parasail_function_t parasail_nw_striped_short_avx512_512_16;
+extern parasail_function_t parasail_nw_striped_short_avx512_512_32;
+extern parasail_function_t parasail_sg_striped_short_sse41_128_8;
+extern parasail_function_t parasail_sg_striped_short_sse41_128_16;
+extern parasail_function_t parasail_sg_striped_short_sse41_128_32;
+extern parasail_function_t parasail_sg_striped_short_avx2_256_8;
+extern parasail_function_t parasail_sg_striped_short_avx2_256_16;
+extern parasail_function_t parasail_sg_striped_short_avx2_256_32;
+extern parasail_function_t parasail_sg_striped_short_avx512_512_8;
+extern parasail_function_t parasail_sg_striped_short_avx512_512_16;
+extern parasail_function_t parasail_sg_striped_short_avx512_512_32;
+extern parasail_function_t parasail_sw_striped_short_sse41_128_8;
+extern parasail_function_t parasail_sw_striped_short_sse41_128_16;
+extern parasail_function_t parasail_sw_striped_short_sse41_128_32;
+extern parasail_function_t parasail_sw_striped_short_avx2_256_8;
+extern parasail_function_t parasail_sw_striped_short_avx2_256_16;
+extern parasail_function_t parasail_sw_striped_short_avx2_256_32;
+extern parasail_function_t parasail_sw_striped_short_avx512_512_8;
+extern parasail_function_t parasail_sw_striped_short_avx512_512_16;
+extern parasail_function_t parasail_sw_striped_short_avx512_512_32;
+
 extern int* parasail_striped_unwind(
         int lena,
         int lenb,
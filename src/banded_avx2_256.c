@@ -0,0 +1,195 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * AVX2 banded anti-diagonal kernels, see banded_kernel.c.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "banded_helper.h"
+
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+static inline __m256i vkeep8(int n)
+{
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8((int8_t)n),
+            _mm256_setr_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+                16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31));
+}
+
+static inline __m256i vkeep16(int n)
+{
+    return _mm256_cmpgt_epi16(_mm256_set1_epi16((int16_t)n),
+            _mm256_setr_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+}
+
+static inline __m256i vkeep32(int n)
+{
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+            _mm256_setr_epi32(0,1,2,3,4,5,6,7));
+}
+
+static inline int hmax8(__m256i v)
+{
+    __m128i w = _mm_max_epi8(_mm256_castsi256_si128(v),
+            _mm256_extracti128_si256(v, 1));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 4));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 2));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 1));
+    return (int8_t)_mm_extract_epi8(w, 0);
+}
+
+static inline int hmin8(__m256i v)
+{
+    __m128i w = _mm_min_epi8(_mm256_castsi256_si128(v),
+            _mm256_extracti128_si256(v, 1));
+    w = _mm_min_epi8(w, _mm_srli_si128(w, 8));
+    w = _mm_min_epi8(w, _mm_srli_si128(w, 4));
+    w = _mm_min_epi8(w, _mm_srli_si128(w, 2));
+    w = _mm_min_epi8(w, _mm_srli_si128(w, 1));
+    return (int8_t)_mm_extract_epi8(w, 0);
+}
+
+static inline int hmax16(__m256i v)
+{
+    __m128i w = _mm_max_epi16(_mm256_castsi256_si128(v),
+            _mm256_extracti128_si256(v, 1));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 4));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 2));
+    return (int16_t)_mm_extract_epi16(w, 0);
+}
+
+static inline int hmin16(__m256i v)
+{
+    __m128i w = _mm_min_epi16(_mm256_castsi256_si128(v),
+            _mm256_extracti128_si256(v, 1));
+    w = _mm_min_epi16(w, _mm_srli_si128(w, 8));
+    w = _mm_min_epi16(w, _mm_srli_si128(w, 4));
+    w = _mm_min_epi16(w, _mm_srli_si128(w, 2));
+    return (int16_t)_mm_extract_epi16(w, 0);
+}
+
+static inline int hmax32(__m256i v)
+{
+    __m128i w = _mm_max_epi32(_mm256_castsi256_si128(v),
+            _mm256_extracti128_si256(v, 1));
+    w = _mm_max_epi32(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi32(w, _mm_srli_si128(w, 4));
+    return _mm_cvtsi128_si32(w);
+}
+
+#define VEC __m256i
+#define MASK __m256i
+#define VLOADU(p) _mm256_loadu_si256((const __m256i*)(p))
+#define VSTOREU(p,v) _mm256_storeu_si256((__m256i*)(p), v)
+#define VOR(a,b) _mm256_or_si256(a, b)
+#define VBLEND(a,b,m) _mm256_blendv_epi8(a, b, m)
+#define FLAG_ISA PARASAIL_FLAG_DIAG
+
+#define WIDTH 8
+#define LANES 32
+#define INT int8_t
+#define NEG_INF INT8_MIN
+#define POS_LIMIT INT8_MAX
+#define VSET1(x) _mm256_set1_epi8((int8_t)(x))
+#define VADD(a,b) _mm256_adds_epi8(a, b)
+#define VSUB(a,b) _mm256_subs_epi8(a, b)
+#define VMAX(a,b) _mm256_max_epi8(a, b)
+#define VMIN(a,b) _mm256_min_epi8(a, b)
+#define VCMPEQ(a,b) _mm256_cmpeq_epi8(a, b)
+#define VCMPGT(a,b) _mm256_cmpgt_epi8(a, b)
+#define VKEEP(n) vkeep8(n)
+#define VHMAX(v) hmax8(v)
+#define VHMIN(v) hmin8(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_8
+#define FLAG_LANES PARASAIL_FLAG_LANES_32
+#define ENAME parasail_banded_avx2_256_8
+#include "banded_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_LIMIT
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VCMPEQ
+#undef VCMPGT
+#undef VKEEP
+#undef VHMAX
+#undef VHMIN
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 16
+#define LANES 16
+#define INT int16_t
+#define NEG_INF INT16_MIN
+#define POS_LIMIT INT16_MAX
+#define VSET1(x) _mm256_set1_epi16((int16_t)(x))
+#define VADD(a,b) _mm256_adds_epi16(a, b)
+#define VSUB(a,b) _mm256_subs_epi16(a, b)
+#define VMAX(a,b) _mm256_max_epi16(a, b)
+#define VMIN(a,b) _mm256_min_epi16(a, b)
+#define VCMPEQ(a,b) _mm256_cmpeq_epi16(a, b)
+#define VCMPGT(a,b) _mm256_cmpgt_epi16(a, b)
+#define VKEEP(n) vkeep16(n)
+#define VHMAX(v) hmax16(v)
+#define VHMIN(v) hmin16(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_16
+#define FLAG_LANES PARASAIL_FLAG_LANES_16
+#define ENAME parasail_banded_avx2_256_16
+#include "banded_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_LIMIT
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VCMPEQ
+#undef VCMPGT
+#undef VKEEP
+#undef VHMAX
+#undef VHMIN
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 32
+#define LANES 8
+#define INT int32_t
+#define NEG_INF (INT32_MIN/2)
+#define POS_LIMIT INT32_MAX
+#define VSET1(x) _mm256_set1_epi32(x)
+#define VADD(a,b) _mm256_add_epi32(a, b)
+#define VSUB(a,b) _mm256_sub_epi32(a, b)
+#define VMAX(a,b) _mm256_max_epi32(a, b)
+#define VMIN(a,b) _mm256_min_epi32(a, b)
+#define VCMPEQ(a,b) _mm256_cmpeq_epi32(a, b)
+#define VCMPGT(a,b) _mm256_cmpgt_epi32(a, b)
+#define VKEEP(n) vkeep32(n)
+#define VHMAX(v) hmax32(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_32
+#define FLAG_LANES PARASAIL_FLAG_LANES_8
+#define ENAME parasail_banded_avx2_256_32
+#include "banded_template.c"
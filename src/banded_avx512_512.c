@@ -0,0 +1,183 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * AVX-512BW banded anti-diagonal kernels, see banded_kernel.c.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "banded_helper.h"
+
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+static inline int hmax8(__m512i v)
+{
+    __m256i u = _mm256_max_epi8(_mm512_castsi512_si256(v),
+            _mm512_extracti64x4_epi64(v, 1));
+    __m128i w = _mm_max_epi8(_mm256_castsi256_si128(u),
+            _mm256_extracti128_si256(u, 1));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 4));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 2));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 1));
+    return (int8_t)_mm_extract_epi8(w, 0);
+}
+
+static inline int hmin8(__m512i v)
+{
+    __m256i u = _mm256_min_epi8(_mm512_castsi512_si256(v),
+            _mm512_extracti64x4_epi64(v, 1));
+    __m128i w = _mm_min_epi8(_mm256_castsi256_si128(u),
+            _mm256_extracti128_si256(u, 1));
+    w = _mm_min_epi8(w, _mm_srli_si128(w, 8));
+    w = _mm_min_epi8(w, _mm_srli_si128(w, 4));
+    w = _mm_min_epi8(w, _mm_srli_si128(w, 2));
+    w = _mm_min_epi8(w, _mm_srli_si128(w, 1));
+    return (int8_t)_mm_extract_epi8(w, 0);
+}
+
+static inline int hmax16(__m512i v)
+{
+    __m256i u = _mm256_max_epi16(_mm512_castsi512_si256(v),
+            _mm512_extracti64x4_epi64(v, 1));
+    __m128i w = _mm_max_epi16(_mm256_castsi256_si128(u),
+            _mm256_extracti128_si256(u, 1));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 4));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 2));
+    return (int16_t)_mm_extract_epi16(w, 0);
+}
+
+static inline int hmin16(__m512i v)
+{
+    __m256i u = _mm256_min_epi16(_mm512_castsi512_si256(v),
+            _mm512_extracti64x4_epi64(v, 1));
+    __m128i w = _mm_min_epi16(_mm256_castsi256_si128(u),
+            _mm256_extracti128_si256(u, 1));
+    w = _mm_min_epi16(w, _mm_srli_si128(w, 8));
+    w = _mm_min_epi16(w, _mm_srli_si128(w, 4));
+    w = _mm_min_epi16(w, _mm_srli_si128(w, 2));
+    return (int16_t)_mm_extract_epi16(w, 0);
+}
+
+#define VEC __m512i
+#define VLOADU(p) _mm512_loadu_si512((const void*)(p))
+#define VSTOREU(p,v) _mm512_storeu_si512((void*)(p), v)
+#define VOR(a,b) _mm512_or_si512(a, b)
+#define FLAG_ISA PARASAIL_FLAG_DIAG
+
+#define WIDTH 8
+#define LANES 64
+#define INT int8_t
+#define MASK __mmask64
+#define NEG_INF INT8_MIN
+#define POS_LIMIT INT8_MAX
+#define VSET1(x) _mm512_set1_epi8((int8_t)(x))
+#define VADD(a,b) _mm512_adds_epi8(a, b)
+#define VSUB(a,b) _mm512_subs_epi8(a, b)
+#define VMAX(a,b) _mm512_max_epi8(a, b)
+#define VMIN(a,b) _mm512_min_epi8(a, b)
+#define VCMPEQ(a,b) _mm512_cmpeq_epi8_mask(a, b)
+#define VCMPGT(a,b) _mm512_cmpgt_epi8_mask(a, b)
+#define VBLEND(a,b,m) _mm512_mask_blend_epi8(m, a, b)
+#define VKEEP(n) ((__mmask64)((1ULL << (n)) - 1))
+#define VHMAX(v) hmax8(v)
+#define VHMIN(v) hmin8(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_8
+#define FLAG_LANES PARASAIL_FLAG_LANES_64
+#define ENAME parasail_banded_avx512_512_8
+#include "banded_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef MASK
+#undef NEG_INF
+#undef POS_LIMIT
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VCMPEQ
+#undef VCMPGT
+#undef VBLEND
+#undef VKEEP
+#undef VHMAX
+#undef VHMIN
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 16
+#define LANES 32
+#define INT int16_t
+#define MASK __mmask32
+#define NEG_INF INT16_MIN
+#define POS_LIMIT INT16_MAX
+#define VSET1(x) _mm512_set1_epi16((int16_t)(x))
+#define VADD(a,b) _mm512_adds_epi16(a, b)
+#define VSUB(a,b) _mm512_subs_epi16(a, b)
+#define VMAX(a,b) _mm512_max_epi16(a, b)
+#define VMIN(a,b) _mm512_min_epi16(a, b)
+#define VCMPEQ(a,b) _mm512_cmpeq_epi16_mask(a, b)
+#define VCMPGT(a,b) _mm512_cmpgt_epi16_mask(a, b)
+#define VBLEND(a,b,m) _mm512_mask_blend_epi16(m, a, b)
+#define VKEEP(n) ((__mmask32)((1U << (n)) - 1))
+#define VHMAX(v) hmax16(v)
+#define VHMIN(v) hmin16(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_16
+#define FLAG_LANES PARASAIL_FLAG_LANES_32
+#define ENAME parasail_banded_avx512_512_16
+#include "banded_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef MASK
+#undef NEG_INF
+#undef POS_LIMIT
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VCMPEQ
+#undef VCMPGT
+#undef VBLEND
+#undef VKEEP
+#undef VHMAX
+#undef VHMIN
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 32
+#define LANES 16
+#define INT int32_t
+#define MASK __mmask16
+#define NEG_INF (INT32_MIN/2)
+#define POS_LIMIT INT32_MAX
+#define VSET1(x) _mm512_set1_epi32(x)
+#define VADD(a,b) _mm512_add_epi32(a, b)
+#define VSUB(a,b) _mm512_sub_epi32(a, b)
+#define VMAX(a,b) _mm512_max_epi32(a, b)
+#define VMIN(a,b) _mm512_min_epi32(a, b)
+#define VCMPEQ(a,b) _mm512_cmpeq_epi32_mask(a, b)
+#define VCMPGT(a,b) _mm512_cmpgt_epi32_mask(a, b)
+#define VBLEND(a,b,m) _mm512_mask_blend_epi32(m, a, b)
+#define VKEEP(n) ((__mmask16)((1U << (n)) - 1))
+#define VHMAX(v) _mm512_reduce_max_epi32(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_32
+#define FLAG_LANES PARASAIL_FLAG_LANES_16
+#define ENAME parasail_banded_avx512_512_32
+#include "banded_template.c"
@@ -0,0 +1,73 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+/* implement the wrapper functions */
+
+#define BANDED_WRAPPER(NAME, CALL, FLAGS, ADAPTIVE)                     \
+parasail_result_t* NAME(                                                \
+        const char * const restrict s1, const int s1Len,                \
+        const char * const restrict s2, const int s2Len,                \
+        const int open, const int gap, const int k,                     \
+        const parasail_matrix_t *matrix)                                \
+{                                                                       \
+    return CALL(s1, s1Len, s2, s2Len, open, gap, k, matrix,             \
+            NULL, NULL, FLAGS, ADAPTIVE);                               \
+}
+
+/* the encoded sequences carry their lengths and matrix */
+#define BANDED_ENCODED_WRAPPER(NAME, CALL, FLAGS, ADAPTIVE)             \
+parasail_result_t* NAME(                                                \
+        const parasail_encoded_t * const restrict s1,                   \
+        const parasail_encoded_t * const restrict s2,                   \
+        const int open, const int gap, const int k)                     \
+{                                                                       \
+    if (s1->matrix != s2->matrix) {                                     \
+        fprintf(stderr, #NAME ": sequences encoded with different matrices\n"); \
+        return NULL;                                                    \
+    }                                                                   \
+    return CALL(NULL, s1->length, NULL, s2->length, open, gap, k,       \
+            s1->matrix, s1, s2, FLAGS, ADAPTIVE);                       \
+}
+
+#define BANDED_WRAPPERS(PREFIX, FLAGS, ADAPTIVE)                        \
+BANDED_WRAPPER(PREFIX##_8, parasail_banded_8, FLAGS, ADAPTIVE)          \
+BANDED_WRAPPER(PREFIX##_16, parasail_banded_16, FLAGS, ADAPTIVE)        \
+BANDED_WRAPPER(PREFIX##_32, parasail_banded_32, FLAGS, ADAPTIVE)        \
+BANDED_WRAPPER(PREFIX##_sat, parasail_banded_sat, FLAGS, ADAPTIVE)      \
+BANDED_ENCODED_WRAPPER(PREFIX##_encoded_8, parasail_banded_8, FLAGS, ADAPTIVE) \
+BANDED_ENCODED_WRAPPER(PREFIX##_encoded_16, parasail_banded_16, FLAGS, ADAPTIVE) \
+BANDED_ENCODED_WRAPPER(PREFIX##_encoded_32, parasail_banded_32, FLAGS, ADAPTIVE) \
+BANDED_ENCODED_WRAPPER(PREFIX##_encoded_sat, parasail_banded_sat, FLAGS, ADAPTIVE)
+
+BANDED_WRAPPERS(parasail_nw_banded, PARASAIL_FLAG_NW, 0)
+BANDED_WRAPPERS(parasail_sg_banded, PARASAIL_FLAG_SG, 0)
+BANDED_WRAPPERS(parasail_sw_banded, PARASAIL_FLAG_SW, 0)
+BANDED_WRAPPERS(parasail_nw_stats_banded, PARASAIL_FLAG_NW | PARASAIL_FLAG_STATS, 0)
+BANDED_WRAPPERS(parasail_sg_stats_banded, PARASAIL_FLAG_SG | PARASAIL_FLAG_STATS, 0)
+BANDED_WRAPPERS(parasail_sw_stats_banded, PARASAIL_FLAG_SW | PARASAIL_FLAG_STATS, 0)
+BANDED_WRAPPERS(parasail_nw_trace_banded, PARASAIL_FLAG_NW | PARASAIL_FLAG_TRACE, 0)
+BANDED_WRAPPERS(parasail_sg_trace_banded, PARASAIL_FLAG_SG | PARASAIL_FLAG_TRACE, 0)
+BANDED_WRAPPERS(parasail_sw_trace_banded, PARASAIL_FLAG_SW | PARASAIL_FLAG_TRACE, 0)
+
+BANDED_WRAPPERS(parasail_nw_banded_adaptive, PARASAIL_FLAG_NW, 1)
+BANDED_WRAPPERS(parasail_sg_banded_adaptive, PARASAIL_FLAG_SG, 1)
+BANDED_WRAPPERS(parasail_sw_banded_adaptive, PARASAIL_FLAG_SW, 1)
+BANDED_WRAPPERS(parasail_nw_stats_banded_adaptive, PARASAIL_FLAG_NW | PARASAIL_FLAG_STATS, 1)
+BANDED_WRAPPERS(parasail_sg_stats_banded_adaptive, PARASAIL_FLAG_SG | PARASAIL_FLAG_STATS, 1)
+BANDED_WRAPPERS(parasail_sw_stats_banded_adaptive, PARASAIL_FLAG_SW | PARASAIL_FLAG_STATS, 1)
+BANDED_WRAPPERS(parasail_nw_trace_banded_adaptive, PARASAIL_FLAG_NW | PARASAIL_FLAG_TRACE, 1)
+BANDED_WRAPPERS(parasail_sg_trace_banded_adaptive, PARASAIL_FLAG_SG | PARASAIL_FLAG_TRACE, 1)
+BANDED_WRAPPERS(parasail_sw_trace_banded_adaptive, PARASAIL_FLAG_SW | PARASAIL_FLAG_TRACE, 1)
@@ -0,0 +1,98 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Helpers shared by the banded anti-diagonal kernels.
+ */
+#ifndef _PARASAIL_BANDED_HELPER_H_
+#define _PARASAIL_BANDED_HELPER_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+
+/* Trace codes of the banded kernels, one per cell.  Bits 0-1 say where
+ * H came from, bit 2 is set when E extended a gap and bit 3 when F did. */
+#define BANDED_ZERO  0  /* local alignment starts after this cell */
+#define BANDED_DIAG  1
+#define BANDED_DEL   2  /* H came from E, a gap in s1 */
+#define BANDED_INS   3  /* H came from F, a gap in s2 */
+#define BANDED_E_EXT 4
+#define BANDED_F_EXT 8
+
+/* floor and ceiling of x/2, also for negative x */
+static inline int banded_floor2(int x)
+{
+    return x >= 0 ? x/2 : -((1-x)/2);
+}
+
+static inline int banded_ceil2(int x)
+{
+    return x >= 0 ? (x+1)/2 : -((-x)/2);
+}
+
+/* a boundary score, clamped to the range of the kernel */
+static inline int banded_boundary(int value, int limit, int *saturated)
+{
+    if (value <= limit) {
+        *saturated = 1;
+        return limit;
+    }
+    return value;
+}
+
+/* Alignment path built while walking back from the end cell; ops are
+ * merged as they are pushed and put in order by banded_path_finish. */
+typedef struct banded_path {
+    uint32_t *seq;
+    int len;
+    int size;
+} banded_path_t;
+
+static inline void banded_path_init(banded_path_t *path)
+{
+    path->size = 16;
+    path->len = 0;
+    path->seq = (uint32_t*)malloc(sizeof(uint32_t)*path->size);
+}
+
+static inline void banded_path_push(banded_path_t *path, int len, char op)
+{
+    uint32_t code = parasail_cigar_encode(0, op);
+    if (len <= 0) {
+        return;
+    }
+    if (path->len > 0
+            && (path->seq[path->len-1] & 0xfU) == code) {
+        path->seq[path->len-1] += (uint32_t)len << 4;
+        return;
+    }
+    if (path->len >= path->size) {
+        path->size *= 2;
+        path->seq = (uint32_t*)realloc(path->seq, sizeof(uint32_t)*path->size);
+    }
+    path->seq[path->len++] = parasail_cigar_encode(len, op);
+}
+
+static inline parasail_cigar_t* banded_path_finish(
+        banded_path_t *path, int beg_query, int beg_ref)
+{
+    parasail_cigar_t *cigar = (parasail_cigar_t*)malloc(sizeof(parasail_cigar_t));
+    int i = 0;
+    for (i=0; i<path->len/2; ++i) {
+        uint32_t tmp = path->seq[i];
+        path->seq[i] = path->seq[path->len-1-i];
+        path->seq[path->len-1-i] = tmp;
+    }
+    cigar->seq = path->seq;
+    cigar->len = path->len;
+    cigar->beg_query = beg_query;
+    cigar->beg_ref = beg_ref;
+    return cigar;
+}
+
+#endif /* _PARASAIL_BANDED_HELPER_H_ */
@@ -0,0 +1,571 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Body of one banded anti-diagonal kernel.  banded_template.c includes
+ * this file once per algorithm (BANDED_NW, BANDED_SG or BANDED_SW) and
+ * variant (BANDED_STATS, BANDED_TRACE or neither) with KNAME naming the
+ * kernel.
+ *
+ * Anti-diagonal r holds the cells (t, r-t) for query positions t.  Its
+ * cells depend only on anti-diagonals r-1 and r-2, so all of them are
+ * computed in parallel, LANES at a time, from three rotating H rows
+ * indexed by t; the t-1 neighbors are unaligned loads.  Only the cells
+ * from st to en of each anti-diagonal are computed, and the row entries
+ * just outside that window are reset to the boundary or -inf, so cells
+ * outside the band are never reached.  For a fixed band st and en
+ * follow the diagonals of the band.  For an adaptive band the window
+ * keeps k+1 cells and moves one row down or stays after every
+ * anti-diagonal, whichever brings its center closer to the best cell
+ * of the anti-diagonal just computed.
+ */
+
+#ifdef BANDED_NW
+#define BOUNDARY(x) ((INT)banded_boundary(-open-(x)*gap, NEG_INF, &saturated))
+#else
+#define BOUNDARY(x) 0
+#endif
+
+static parasail_result_t* KNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int adaptive)
+{
+    const int n = matrix->size;
+    const int last = s1Len + s2Len - 2;
+    const int dlo = MIN(0, s1Len-s2Len) - k;
+    const int dhi = MAX(0, s1Len-s2Len) + k;
+    const int window = k + 1;
+    const long stride = (long)s1Len + 2*LANES + 2;
+#ifdef BANDED_STATS
+    const int nbuf = 26;
+#else
+    const int nbuf = 7;
+#endif
+    /* encoded sequences are read in place: residue t of e1 or e2 is the
+     * bits-wide field at (t & pmask)*bits of byte t >> pshift */
+    const int encoded = NULL != e1 && NULL != e2;
+    const int bits = encoded ? e1->bits : 8;
+    const int pshift = 8 == bits ? 0 : 4 == bits ? 1 : 2;
+    const int pmask = (1 << pshift) - 1;
+    const int rmask = (1 << bits) - 1;
+    int * const restrict s1Row = encoded ? NULL : parasail_memalign_int(16, s1Len);
+    int * const restrict s2Rev = encoded ? NULL : parasail_memalign_int(16, s2Len);
+    INT * const restrict slab = (INT*)parasail_memalign(64, sizeof(INT)*nbuf*stride);
+    INT *Hb[3];
+    INT *Fb[2];
+    INT * const restrict E = slab + 3*stride + LANES;
+    INT * const restrict SC = slab + 6*stride + LANES;
+#ifdef BANDED_STATS
+    INT *HMb[3];
+    INT *HSb[3];
+    INT *HLb[3];
+    INT *FMb[2];
+    INT *FSb[2];
+    INT *FLb[2];
+    INT * const restrict EM = slab + 16*stride + LANES;
+    INT * const restrict ES = slab + 17*stride + LANES;
+    INT * const restrict EL = slab + 18*stride + LANES;
+    INT * const restrict MT = slab + 25*stride + LANES;
+    VEC vMaxL = VSET1(0);
+    int matches = 0;
+    int similar = 0;
+    int length = 0;
+#endif
+#ifdef BANDED_TRACE
+    const long cells = adaptive ? window : (dhi-dlo)/2 + 1;
+    INT * const restrict trace = (INT*)parasail_memalign(64,
+            sizeof(INT)*(cells*(last+1) + LANES));
+    int * const restrict tst = parasail_memalign_int(16, last+1);
+    int * const restrict ten = parasail_memalign_int(16, last+1);
+    long * const restrict toff = (long*)malloc(sizeof(long)*(last+1));
+    long offset = 0;
+    parasail_cigar_t *path = NULL;
+#endif
+    parasail_result_t *result = NULL;
+    const VEC vOpen = VSET1(open);
+    const VEC vGap = VSET1(gap);
+    const VEC vZero = VSET1(0);
+    const VEC vNegInf = VSET1(NEG_INF);
+#ifdef BANDED_STATS
+    const VEC vOne = VSET1(1);
+#endif
+#ifdef BANDED_TRACE
+    const VEC vDiag = VSET1(BANDED_DIAG);
+    const VEC vDel = VSET1(BANDED_DEL);
+    const VEC vIns = VSET1(BANDED_INS);
+    const VEC vEExt = VSET1(BANDED_E_EXT);
+    const VEC vFExt = VSET1(BANDED_F_EXT);
+#endif
+#if WIDTH < 32
+    const VEC vPosLimit = VSET1(POS_LIMIT);
+    VEC vMaxH = vNegInf;
+    VEC vMinH = vPosLimit;
+#endif
+    int saturated = 0;
+    int score = NEG_INF;
+    int end_query = s1Len-1;
+    int end_ref = s2Len-1;
+#ifdef BANDED_SG
+    int end_rank = INT32_MAX;
+#endif
+    int lo = -((window-1)/2);
+    long i = 0;
+    int r = 0;
+    int t = 0;
+
+    if (!encoded) {
+        for (t=0; t<s1Len; ++t) {
+            s1Row[t] = n*matrix->mapper[(unsigned char)_s1[t]];
+        }
+        for (t=0; t<s2Len; ++t) {
+            s2Rev[t] = matrix->mapper[(unsigned char)_s2[s2Len-1-t]];
+        }
+    }
+
+    /* H, E and F start at -inf, everything else at zero */
+    for (i=0; i<7*stride; ++i) {
+        slab[i] = NEG_INF;
+    }
+    for (i=6*stride; i<nbuf*stride; ++i) {
+        slab[i] = 0;
+    }
+    for (i=0; i<3; ++i) {
+        Hb[i] = slab + i*stride + LANES;
+    }
+    for (i=0; i<2; ++i) {
+        Fb[i] = slab + (4+i)*stride + LANES;
+    }
+#ifdef BANDED_STATS
+    for (i=0; i<3; ++i) {
+        HMb[i] = slab + (7+i)*stride + LANES;
+        HSb[i] = slab + (10+i)*stride + LANES;
+        HLb[i] = slab + (13+i)*stride + LANES;
+    }
+    for (i=0; i<2; ++i) {
+        FMb[i] = slab + (19+i)*stride + LANES;
+        FSb[i] = slab + (21+i)*stride + LANES;
+        FLb[i] = slab + (23+i)*stride + LANES;
+    }
+#endif
+
+    /* anti-diagonal -2 is the corner, -1 the cells left of and above
+     * the first cell */
+    Hb[1][-1] = 0;
+    Hb[2][-1] = BOUNDARY(0);
+    Hb[2][0] = BOUNDARY(0);
+
+    for (r=0; r<=last; ++r) {
+        INT * const restrict H0 = Hb[r%3];
+        const INT * const restrict H1 = Hb[(r+2)%3];
+        const INT * const restrict H2 = Hb[(r+1)%3];
+        INT * const restrict F0 = Fb[r&1];
+        const INT * const restrict F1 = Fb[(r+1)&1];
+#ifdef BANDED_STATS
+        INT * const restrict HM0 = HMb[r%3];
+        INT * const restrict HS0 = HSb[r%3];
+        INT * const restrict HL0 = HLb[r%3];
+        const INT * const restrict HM1 = HMb[(r+2)%3];
+        const INT * const restrict HS1 = HSb[(r+2)%3];
+        const INT * const restrict HL1 = HLb[(r+2)%3];
+        const INT * const restrict HM2 = HMb[(r+1)%3];
+        const INT * const restrict HS2 = HSb[(r+1)%3];
+        const INT * const restrict HL2 = HLb[(r+1)%3];
+        INT * const restrict FM0 = FMb[r&1];
+        INT * const restrict FS0 = FSb[r&1];
+        INT * const restrict FL0 = FLb[r&1];
+        const INT * const restrict FM1 = FMb[(r+1)&1];
+        const INT * const restrict FS1 = FSb[(r+1)&1];
+        const INT * const restrict FL1 = FLb[(r+1)&1];
+#endif
+        const int lo_clip = MAX(0, r-s2Len+1);
+        const int hi_clip = MIN(s1Len-1, r);
+        VEC vAnti = vNegInf;
+        int st = 0;
+        int en = 0;
+#ifdef BANDED_TRACE
+        INT * const restrict T = trace + offset;
+#endif
+
+        if (adaptive) {
+            st = MAX(lo_clip, lo);
+            en = MIN(hi_clip, lo+window-1);
+        }
+        else {
+            st = MAX(lo_clip, banded_ceil2(r+dlo));
+            en = MIN(hi_clip, banded_floor2(r+dhi));
+        }
+
+        if (encoded) {
+            const unsigned char * const restrict p1 = e1->index;
+            const unsigned char * const restrict p2 = e2->index;
+            for (t=st; t<=en; ++t) {
+                const int u = r-t;
+                const int c1 = (p1[t>>pshift] >> ((t&pmask)*bits)) & rmask;
+                const int c2 = (p2[u>>pshift] >> ((u&pmask)*bits)) & rmask;
+                SC[t] = (INT)matrix->matrix[n*c1 + c2];
+#ifdef BANDED_STATS
+                MT[t] = (INT)(c1 == c2);
+#endif
+            }
+        }
+        else {
+            /* s2r[t] is the mapped s2[r-t] */
+            const int * const restrict s2r = s2Rev + (s2Len-1-r);
+            for (t=st; t<=en; ++t) {
+                SC[t] = (INT)matrix->matrix[s1Row[t] + s2r[t]];
+#ifdef BANDED_STATS
+                MT[t] = (INT)(s1Row[t] == n*s2r[t]);
+#endif
+            }
+        }
+
+        for (t=st; t<=en; t+=LANES) {
+            VEC vH;
+            VEC vE;
+            VEC vF;
+            VEC vHdiag;
+            VEC vEopn;
+            VEC vEext;
+            VEC vFopn;
+            VEC vFext;
+            vHdiag = VADD(VLOADU(H2+t-1), VLOADU(SC+t));
+            vEopn = VSUB(VLOADU(H1+t), vOpen);
+            vEext = VSUB(VLOADU(E+t), vGap);
+            vFopn = VSUB(VLOADU(H1+t-1), vOpen);
+            vFext = VSUB(VLOADU(F1+t-1), vGap);
+            vE = VMAX(vEopn, vEext);
+            vF = VMAX(vFopn, vFext);
+            vH = VMAX(VMAX(vHdiag, vE), vF);
+#ifdef BANDED_SW
+            vH = VMAX(vH, vZero);
+#endif
+#ifdef BANDED_TRACE
+            {
+                VEC vT = VBLEND(vDel, vIns, VCMPEQ(vH, vF));
+                vT = VBLEND(vT, vDiag, VCMPEQ(vH, vHdiag));
+#ifdef BANDED_SW
+                vT = VBLEND(vT, vZero, VCMPEQ(vH, vZero));
+#endif
+                vT = VOR(vT, VBLEND(vZero, vEExt, VCMPGT(vEext, vEopn)));
+                vT = VOR(vT, VBLEND(vZero, vFExt, VCMPGT(vFext, vFopn)));
+                VSTOREU(T+t-st, vT);
+            }
+#endif
+#ifdef BANDED_STATS
+            {
+                const MASK mE = VCMPGT(vEopn, vEext);
+                const MASK mF = VCMPGT(vFopn, vFext);
+                const MASK mDiag = VCMPEQ(vH, vHdiag);
+                const MASK mIns = VCMPEQ(vH, vF);
+                VEC vEM = VBLEND(VLOADU(EM+t), VLOADU(HM1+t), mE);
+                VEC vES = VBLEND(VLOADU(ES+t), VLOADU(HS1+t), mE);
+                VEC vEL = VBLEND(VLOADU(EL+t), VLOADU(HL1+t), mE);
+                VEC vFM = VBLEND(VLOADU(FM1+t-1), VLOADU(HM1+t-1), mF);
+                VEC vFS = VBLEND(VLOADU(FS1+t-1), VLOADU(HS1+t-1), mF);
+                VEC vFL = VBLEND(VLOADU(FL1+t-1), VLOADU(HL1+t-1), mF);
+                VEC vHM;
+                VEC vHS;
+                VEC vHL;
+                vEL = VADD(vEL, vOne);
+                vFL = VADD(vFL, vOne);
+                vHM = VBLEND(VBLEND(vEM, vFM, mIns),
+                        VADD(VLOADU(HM2+t-1), VLOADU(MT+t)), mDiag);
+                vHS = VBLEND(VBLEND(vES, vFS, mIns),
+                        VADD(VLOADU(HS2+t-1),
+                            VBLEND(vZero, vOne, VCMPGT(VLOADU(SC+t), vZero))),
+                        mDiag);
+                vHL = VBLEND(VBLEND(vEL, vFL, mIns),
+                        VADD(VLOADU(HL2+t-1), vOne), mDiag);
+#ifdef BANDED_SW
+                {
+                    const MASK mZero = VCMPEQ(vH, vZero);
+                    vHM = VBLEND(vHM, vZero, mZero);
+                    vHS = VBLEND(vHS, vZero, mZero);
+                    vHL = VBLEND(vHL, vZero, mZero);
+                }
+#endif
+                if (en-t+1 < LANES) {
+                    vHL = VBLEND(vZero, vHL, VKEEP(en-t+1));
+                }
+                vMaxL = VMAX(vMaxL, vHL);
+                VSTOREU(EM+t, vEM);
+                VSTOREU(ES+t, vES);
+                VSTOREU(EL+t, vEL);
+                VSTOREU(FM0+t, vFM);
+                VSTOREU(FS0+t, vFS);
+                VSTOREU(FL0+t, vFL);
+                VSTOREU(HM0+t, vHM);
+                VSTOREU(HS0+t, vHS);
+                VSTOREU(HL0+t, vHL);
+            }
+#endif
+            /* lanes past the end of the window are outside the band */
+            if (en-t+1 < LANES) {
+                const MASK mKeep = VKEEP(en-t+1);
+#if WIDTH < 32
+                vMinH = VMIN(vMinH, VBLEND(vPosLimit, vH, mKeep));
+#endif
+                vH = VBLEND(vNegInf, vH, mKeep);
+                vE = VBLEND(vNegInf, vE, mKeep);
+                vF = VBLEND(vNegInf, vF, mKeep);
+            }
+#if WIDTH < 32
+            else {
+                vMinH = VMIN(vMinH, vH);
+            }
+            vMaxH = VMAX(vMaxH, vH);
+#endif
+            vAnti = VMAX(vAnti, vH);
+            VSTOREU(H0+t, vH);
+            VSTOREU(E+t, vE);
+            VSTOREU(F0+t, vF);
+        }
+
+        /* reset the entries just outside the window */
+        H0[st-1] = 0 == st ? BOUNDARY(r+1) : NEG_INF;
+        F0[st-1] = NEG_INF;
+        H0[en+1] = r == en ? BOUNDARY(r+1) : NEG_INF;
+        E[en+1] = NEG_INF;
+        F0[en+1] = NEG_INF;
+#ifdef BANDED_STATS
+        HM0[st-1] = 0;
+        HS0[st-1] = 0;
+        HL0[st-1] = 0;
+        FM0[st-1] = 0;
+        FS0[st-1] = 0;
+        FL0[st-1] = 0;
+        HM0[en+1] = 0;
+        HS0[en+1] = 0;
+        HL0[en+1] = 0;
+        EM[en+1] = 0;
+        ES[en+1] = 0;
+        EL[en+1] = 0;
+#endif
+#ifdef BANDED_TRACE
+        tst[r] = st;
+        ten[r] = en;
+        toff[r] = offset;
+        offset += en-st+1;
+#endif
+
+#ifdef BANDED_NW
+        if (r == last) {
+            score = H0[s1Len-1];
+#ifdef BANDED_STATS
+            matches = HM0[s1Len-1];
+            similar = HS0[s1Len-1];
+            length = HL0[s1Len-1];
+#endif
+        }
+#endif
+#ifdef BANDED_SG
+        /* same order of preference as parasail_sg: the last row before
+         * the last column, then lower j, then lower i, the corner last */
+        if (r >= s2Len-1 && st == lo_clip && lo_clip < s1Len-1) {
+            const int value = H0[lo_clip];
+            const int rank = s2Len + lo_clip;
+            if (value > score || (value == score && rank < end_rank)) {
+                score = value;
+                end_rank = rank;
+                end_query = lo_clip;
+                end_ref = s2Len-1;
+#ifdef BANDED_STATS
+                matches = HM0[lo_clip];
+                similar = HS0[lo_clip];
+                length = HL0[lo_clip];
+#endif
+            }
+        }
+        if (r >= s1Len-1 && en == s1Len-1) {
+            const int value = H0[s1Len-1];
+            const int j = r-(s1Len-1);
+            const int rank = j == s2Len-1 ? s1Len+s2Len : j;
+            if (value > score || (value == score && rank < end_rank)) {
+                score = value;
+                end_rank = rank;
+                end_query = s1Len-1;
+                end_ref = j;
+#ifdef BANDED_STATS
+                matches = HM0[s1Len-1];
+                similar = HS0[s1Len-1];
+                length = HL0[s1Len-1];
+#endif
+            }
+        }
+#endif
+#ifdef BANDED_SW
+        /* same order of preference as parasail_sw: lower j, then lower i */
+        if (VHMAX(vAnti) >= score) {
+            for (t=st; t<=en; ++t) {
+                const int value = H0[t];
+                const int j = r-t;
+                if (value > score || (value == score
+                            && (j < end_ref || (j == end_ref && t < end_query)))) {
+                    score = value;
+                    end_query = t;
+                    end_ref = j;
+#ifdef BANDED_STATS
+                    matches = HM0[t];
+                    similar = HS0[t];
+                    length = HL0[t];
+#endif
+                }
+            }
+        }
+#endif
+
+        if (adaptive) {
+            /* move the window toward the best cell, but never so far
+             * that it could miss the last cell */
+            const int best = VHMAX(vAnti);
+            int down = 0;
+            for (t=st; t<en && H0[t] != best; ++t) {
+            }
+            down = 2*t - (2*lo + window - 1);
+            lo += down > 0 || (0 == down && (r & 1));
+            lo = MAX(lo, r + 3 - s2Len - window);
+            lo = MIN(lo, s1Len-1);
+        }
+    }
+
+#if WIDTH < 32
+    if (VHMAX(vMaxH) >= POS_LIMIT || VHMIN(vMinH) <= NEG_INF) {
+        saturated = 1;
+    }
+#ifdef BANDED_STATS
+    if (VHMAX(vMaxL) >= POS_LIMIT) {
+        saturated = 1;
+    }
+#endif
+#endif
+
+#ifdef BANDED_TRACE
+    {
+        banded_path_t bp;
+        int ti = end_query;
+        int tj = end_ref;
+        int state = BANDED_DIAG;
+        banded_path_init(&bp);
+#ifdef BANDED_SW
+        if (score <= 0 || saturated) {
+            ti = -1;
+            tj = -1;
+        }
+#endif
+#ifdef BANDED_SG
+        banded_path_push(&bp, s2Len-1-end_ref, 'D');
+        banded_path_push(&bp, s1Len-1-end_query, 'I');
+#endif
+        if (saturated) {
+            ti = -1;
+            tj = -1;
+        }
+        while (ti >= 0 && tj >= 0) {
+            const int d = ti+tj;
+            int code = 0;
+            if (ti < tst[d] || ti > ten[d]) {
+                break;
+            }
+            code = (int)trace[toff[d] + ti - tst[d]];
+            if (BANDED_DIAG == state) {
+                state = code & 3;
+                if (BANDED_ZERO == state) {
+                    break;
+                }
+                if (BANDED_DIAG == state) {
+                    banded_path_push(&bp, 1, 'M');
+                    --ti;
+                    --tj;
+                }
+            }
+            else if (BANDED_DEL == state) {
+                banded_path_push(&bp, 1, 'D');
+                state = (code & BANDED_E_EXT) ? BANDED_DEL : BANDED_DIAG;
+                --tj;
+            }
+            else {
+                banded_path_push(&bp, 1, 'I');
+                state = (code & BANDED_F_EXT) ? BANDED_INS : BANDED_DIAG;
+                --ti;
+            }
+        }
+#ifdef BANDED_SW
+        if (score <= 0 || saturated) {
+            path = banded_path_finish(&bp, end_query+1, end_ref+1);
+        }
+        else {
+            path = banded_path_finish(&bp, ti+1, tj+1);
+        }
+#else
+        /* the rest of the global path runs along the boundary */
+        if (!saturated) {
+            banded_path_push(&bp, tj+1, 'D');
+            banded_path_push(&bp, ti+1, 'I');
+        }
+        path = banded_path_finish(&bp, 0, 0);
+#endif
+    }
+    result = parasail_result_new_trace_path(path);
+    result->flag |= PARASAIL_FLAG_TRACE;
+#elif defined(BANDED_STATS)
+    result = parasail_result_new_stats();
+    result->flag |= PARASAIL_FLAG_STATS;
+#else
+    result = parasail_result_new();
+#endif
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = POS_LIMIT;
+        end_query = 0;
+        end_ref = 0;
+#ifdef BANDED_STATS
+        matches = 0;
+        similar = 0;
+        length = 0;
+#endif
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+#ifdef BANDED_STATS
+    result->stats->matches = matches;
+    result->stats->similar = similar;
+    result->stats->length = length;
+#endif
+#ifdef BANDED_NW
+    result->flag |= PARASAIL_FLAG_NW;
+#endif
+#ifdef BANDED_SG
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_BEG | PARASAIL_FLAG_SG_S1_END
+        | PARASAIL_FLAG_SG_S2_BEG | PARASAIL_FLAG_SG_S2_END;
+#endif
+#ifdef BANDED_SW
+    result->flag |= PARASAIL_FLAG_SW;
+#endif
+    result->flag |= PARASAIL_FLAG_BANDED | FLAG_ISA | FLAG_BITS | FLAG_LANES;
+
+#ifdef BANDED_TRACE
+    free(toff);
+    parasail_free(ten);
+    parasail_free(tst);
+    parasail_free(trace);
+#endif
+    parasail_free(slab);
+    if (NULL != s2Rev) parasail_free(s2Rev);
+    if (NULL != s1Row) parasail_free(s1Row);
+
+    return result;
+}
+
+#undef BOUNDARY
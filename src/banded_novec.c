@@ -0,0 +1,49 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Serial banded anti-diagonal kernels, see banded_kernel.c.  The same
+ * kernel body with one lane of plain ints, used when no vector
+ * instruction set is available.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "banded_helper.h"
+
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+#define VEC int32_t
+#define MASK int
+#define VLOADU(p) (*(p))
+#define VSTOREU(p,v) (*(p) = (v))
+#define VOR(a,b) ((a) | (b))
+#define VBLEND(a,b,m) ((m) ? (b) : (a))
+#define FLAG_ISA PARASAIL_FLAG_NOVEC
+
+#define WIDTH 32
+#define LANES 1
+#define INT int32_t
+#define NEG_INF (INT32_MIN/2)
+#define POS_LIMIT INT32_MAX
+#define VSET1(x) (x)
+#define VADD(a,b) ((a) + (b))
+#define VSUB(a,b) ((a) - (b))
+#define VMAX(a,b) MAX(a, b)
+#define VMIN(a,b) MIN(a, b)
+#define VCMPEQ(a,b) ((a) == (b))
+#define VCMPGT(a,b) ((a) > (b))
+#define VKEEP(n) ((n) > 0)
+#define VHMAX(v) (v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_32
+#define FLAG_LANES PARASAIL_FLAG_LANES_1
+#define ENAME parasail_banded_novec_32
+#include "banded_template.c"
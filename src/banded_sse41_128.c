@@ -0,0 +1,188 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * SSE4.1 banded anti-diagonal kernels, see banded_kernel.c.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#include <smmintrin.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "banded_helper.h"
+
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+static inline __m128i vkeep8(int n)
+{
+    return _mm_cmpgt_epi8(_mm_set1_epi8((int8_t)n),
+            _mm_setr_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+}
+
+static inline __m128i vkeep16(int n)
+{
+    return _mm_cmpgt_epi16(_mm_set1_epi16((int16_t)n),
+            _mm_setr_epi16(0,1,2,3,4,5,6,7));
+}
+
+static inline __m128i vkeep32(int n)
+{
+    return _mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0,1,2,3));
+}
+
+static inline int hmax8(__m128i v)
+{
+    v = _mm_max_epi8(v, _mm_srli_si128(v, 8));
+    v = _mm_max_epi8(v, _mm_srli_si128(v, 4));
+    v = _mm_max_epi8(v, _mm_srli_si128(v, 2));
+    v = _mm_max_epi8(v, _mm_srli_si128(v, 1));
+    return (int8_t)_mm_extract_epi8(v, 0);
+}
+
+static inline int hmin8(__m128i v)
+{
+    v = _mm_min_epi8(v, _mm_srli_si128(v, 8));
+    v = _mm_min_epi8(v, _mm_srli_si128(v, 4));
+    v = _mm_min_epi8(v, _mm_srli_si128(v, 2));
+    v = _mm_min_epi8(v, _mm_srli_si128(v, 1));
+    return (int8_t)_mm_extract_epi8(v, 0);
+}
+
+static inline int hmax16(__m128i v)
+{
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 8));
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 4));
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 2));
+    return (int16_t)_mm_extract_epi16(v, 0);
+}
+
+static inline int hmin16(__m128i v)
+{
+    v = _mm_min_epi16(v, _mm_srli_si128(v, 8));
+    v = _mm_min_epi16(v, _mm_srli_si128(v, 4));
+    v = _mm_min_epi16(v, _mm_srli_si128(v, 2));
+    return (int16_t)_mm_extract_epi16(v, 0);
+}
+
+static inline int hmax32(__m128i v)
+{
+    v = _mm_max_epi32(v, _mm_srli_si128(v, 8));
+    v = _mm_max_epi32(v, _mm_srli_si128(v, 4));
+    return _mm_cvtsi128_si32(v);
+}
+
+#define VEC __m128i
+#define MASK __m128i
+#define VLOADU(p) _mm_loadu_si128((const __m128i*)(p))
+#define VSTOREU(p,v) _mm_storeu_si128((__m128i*)(p), v)
+#define VOR(a,b) _mm_or_si128(a, b)
+#define VBLEND(a,b,m) _mm_blendv_epi8(a, b, m)
+#define FLAG_ISA PARASAIL_FLAG_DIAG
+
+#define WIDTH 8
+#define LANES 16
+#define INT int8_t
+#define NEG_INF INT8_MIN
+#define POS_LIMIT INT8_MAX
+#define VSET1(x) _mm_set1_epi8((int8_t)(x))
+#define VADD(a,b) _mm_adds_epi8(a, b)
+#define VSUB(a,b) _mm_subs_epi8(a, b)
+#define VMAX(a,b) _mm_max_epi8(a, b)
+#define VMIN(a,b) _mm_min_epi8(a, b)
+#define VCMPEQ(a,b) _mm_cmpeq_epi8(a, b)
+#define VCMPGT(a,b) _mm_cmpgt_epi8(a, b)
+#define VKEEP(n) vkeep8(n)
+#define VHMAX(v) hmax8(v)
+#define VHMIN(v) hmin8(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_8
+#define FLAG_LANES PARASAIL_FLAG_LANES_16
+#define ENAME parasail_banded_sse41_128_8
+#include "banded_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_LIMIT
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VCMPEQ
+#undef VCMPGT
+#undef VKEEP
+#undef VHMAX
+#undef VHMIN
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 16
+#define LANES 8
+#define INT int16_t
+#define NEG_INF INT16_MIN
+#define POS_LIMIT INT16_MAX
+#define VSET1(x) _mm_set1_epi16((int16_t)(x))
+#define VADD(a,b) _mm_adds_epi16(a, b)
+#define VSUB(a,b) _mm_subs_epi16(a, b)
+#define VMAX(a,b) _mm_max_epi16(a, b)
+#define VMIN(a,b) _mm_min_epi16(a, b)
+#define VCMPEQ(a,b) _mm_cmpeq_epi16(a, b)
+#define VCMPGT(a,b) _mm_cmpgt_epi16(a, b)
+#define VKEEP(n) vkeep16(n)
+#define VHMAX(v) hmax16(v)
+#define VHMIN(v) hmin16(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_16
+#define FLAG_LANES PARASAIL_FLAG_LANES_8
+#define ENAME parasail_banded_sse41_128_16
+#include "banded_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_LIMIT
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VCMPEQ
+#undef VCMPGT
+#undef VKEEP
+#undef VHMAX
+#undef VHMIN
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 32
+#define LANES 4
+#define INT int32_t
+#define NEG_INF (INT32_MIN/2)
+#define POS_LIMIT INT32_MAX
+#define VSET1(x) _mm_set1_epi32(x)
+#define VADD(a,b) _mm_add_epi32(a, b)
+#define VSUB(a,b) _mm_sub_epi32(a, b)
+#define VMAX(a,b) _mm_max_epi32(a, b)
+#define VMIN(a,b) _mm_min_epi32(a, b)
+#define VCMPEQ(a,b) _mm_cmpeq_epi32(a, b)
+#define VCMPGT(a,b) _mm_cmpgt_epi32(a, b)
+#define VKEEP(n) vkeep32(n)
+#define VHMAX(v) hmax32(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_32
+#define FLAG_LANES PARASAIL_FLAG_LANES_4
+#define ENAME parasail_banded_sse41_128_32
+#include "banded_template.c"
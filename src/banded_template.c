@@ -0,0 +1,100 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Instantiates the banded anti-diagonal kernels for one vector width.
+ * The including file defines the vector operations for that width and
+ * ENAME, the name of the function that selects among the kernels.
+ */
+
+#ifndef BANDED_CONCAT
+#define BANDED_CONCAT_(a,b) a##b
+#define BANDED_CONCAT(a,b) BANDED_CONCAT_(a,b)
+#endif
+
+#define BANDED_NW
+#define KNAME BANDED_CONCAT(ENAME, _nw)
+#include "banded_kernel.c"
+#undef KNAME
+#define BANDED_STATS
+#define KNAME BANDED_CONCAT(ENAME, _nw_stats)
+#include "banded_kernel.c"
+#undef KNAME
+#undef BANDED_STATS
+#define BANDED_TRACE
+#define KNAME BANDED_CONCAT(ENAME, _nw_trace)
+#include "banded_kernel.c"
+#undef KNAME
+#undef BANDED_TRACE
+#undef BANDED_NW
+
+#define BANDED_SG
+#define KNAME BANDED_CONCAT(ENAME, _sg)
+#include "banded_kernel.c"
+#undef KNAME
+#define BANDED_STATS
+#define KNAME BANDED_CONCAT(ENAME, _sg_stats)
+#include "banded_kernel.c"
+#undef KNAME
+#undef BANDED_STATS
+#define BANDED_TRACE
+#define KNAME BANDED_CONCAT(ENAME, _sg_trace)
+#include "banded_kernel.c"
+#undef KNAME
+#undef BANDED_TRACE
+#undef BANDED_SG
+
+#define BANDED_SW
+#define KNAME BANDED_CONCAT(ENAME, _sw)
+#include "banded_kernel.c"
+#undef KNAME
+#define BANDED_STATS
+#define KNAME BANDED_CONCAT(ENAME, _sw_stats)
+#include "banded_kernel.c"
+#undef KNAME
+#undef BANDED_STATS
+#define BANDED_TRACE
+#define KNAME BANDED_CONCAT(ENAME, _sw_trace)
+#include "banded_kernel.c"
+#undef KNAME
+#undef BANDED_TRACE
+#undef BANDED_SW
+
+parasail_result_t* ENAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive)
+{
+    if (flags & PARASAIL_FLAG_STATS) {
+        if (flags & PARASAIL_FLAG_NW) {
+            return BANDED_CONCAT(ENAME, _nw_stats)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+        }
+        if (flags & PARASAIL_FLAG_SG) {
+            return BANDED_CONCAT(ENAME, _sg_stats)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+        }
+        return BANDED_CONCAT(ENAME, _sw_stats)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+    }
+    if (flags & PARASAIL_FLAG_TRACE) {
+        if (flags & PARASAIL_FLAG_NW) {
+            return BANDED_CONCAT(ENAME, _nw_trace)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+        }
+        if (flags & PARASAIL_FLAG_SG) {
+            return BANDED_CONCAT(ENAME, _sg_trace)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+        }
+        return BANDED_CONCAT(ENAME, _sw_trace)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+    }
+    if (flags & PARASAIL_FLAG_NW) {
+        return BANDED_CONCAT(ENAME, _nw)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+    }
+    if (flags & PARASAIL_FLAG_SG) {
+        return BANDED_CONCAT(ENAME, _sg)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+    }
+    return BANDED_CONCAT(ENAME, _sw)(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, adaptive);
+}
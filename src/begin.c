@@ -0,0 +1,121 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Begin coordinates of a score-only result.  The prefixes of s1 and s2
+ * that end at the end cell are reversed and extended from that cell, so
+ * the reverse pass is anchored there; where it first reaches the score
+ * of the forward pass is where the alignment begins.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+int parasail_result_find_begin(
+        parasail_result_t * const restrict result,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    const int flag = result->flag;
+    const int score = result->score;
+    const int end_query = result->end_query;
+    const int end_ref = result->end_ref;
+    char *s1_reverse = NULL;
+    char *s2_reverse = NULL;
+    parasail_result_t *reverse = NULL;
+    parasail_extension_t extension;
+    int xdrop = -1;
+    int found = 0;
+
+    result->begin_query = -1;
+    result->begin_ref = -1;
+
+    if (flag & PARASAIL_FLAG_SATURATED) {
+        return 0;
+    }
+    if (end_query < 0 || end_query >= s1Len
+            || end_ref < 0 || end_ref >= s2Len) {
+        return 0;
+    }
+
+    if (flag & PARASAIL_FLAG_NW) {
+        result->begin_query = 0;
+        result->begin_ref = 0;
+        return 1;
+    }
+    else if (flag & PARASAIL_FLAG_SW) {
+        /* the empty alignment has no begin */
+        if (score <= 0) {
+            return 0;
+        }
+        /* every suffix of a local alignment scores above 0 and every
+         * prefix at least 0, so along the reverse path no cell falls
+         * more than score below the best one */
+        xdrop = score;
+    }
+    else if (flag & PARASAIL_FLAG_SG) {
+        /* without free begin gaps the alignment starts at the origin */
+        if (!(flag & (PARASAIL_FLAG_SG_S1_BEG | PARASAIL_FLAG_SG_S2_BEG))) {
+            result->begin_query = 0;
+            result->begin_ref = 0;
+            return 1;
+        }
+    }
+    else {
+        return 0;
+    }
+
+    s1_reverse = parasail_reverse(s1, end_query+1);
+    s2_reverse = parasail_reverse(s2, end_ref+1);
+    reverse = parasail_extend_scan_sat(
+            s1_reverse, end_query+1,
+            s2_reverse, end_ref+1,
+            open, gap, matrix, xdrop, -1, &extension);
+    free(s2_reverse);
+    free(s1_reverse);
+
+    if (NULL == reverse || parasail_result_is_saturated(reverse)) {
+        /* nothing found */
+    }
+    else if (flag & PARASAIL_FLAG_SW) {
+        if (reverse->score == score) {
+            result->begin_query = end_query - reverse->end_query;
+            result->begin_ref = end_ref - reverse->end_ref;
+            found = 1;
+        }
+    }
+    else {
+        /* a free s1 begin means the alignment starts at the first
+         * residue of s2, the last column of the reverse pass, and a
+         * free s2 begin at the first residue of s1, its last row */
+        if ((flag & PARASAIL_FLAG_SG_S1_BEG)
+                && extension.ref_end_query >= 0
+                && extension.ref_end_score == score) {
+            result->begin_query = end_query - extension.ref_end_query;
+            result->begin_ref = 0;
+            found = 1;
+        }
+        else if ((flag & PARASAIL_FLAG_SG_S2_BEG)
+                && extension.query_end_ref >= 0
+                && extension.query_end_score == score) {
+            result->begin_query = 0;
+            result->begin_ref = end_ref - extension.query_end_ref;
+            found = 1;
+        }
+    }
+
+    if (NULL != reverse) {
+        parasail_result_free(reverse);
+    }
+
+    return found;
+}
@@ -0,0 +1,412 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Bit-parallel alignment for unit-cost scoring.  When open == gap and
+ * the residues of both sequences only ever score one of two values,
+ * the linear-gap recurrences reduce to edit distance or to the longest
+ * common subsequence, both of which are computed 64 cells at a time
+ * with the bit-vector algorithms of Myers (1999, in Hyyro's
+ * formulation) and Allison-Dix/Hyyro.  Queries longer than 64 residues
+ * span several words, the horizontal delta or the addition carry at the
+ * bottom of each word chained into the next.  bitpar_nw and bitpar_sg
+ * return NULL for any other scoring, which the bitpar functions pass to
+ * the scan saturation-checking functions.  Local alignment has no such
+ * reduction: with a positive match the score depends on where the
+ * alignment starts, which edit distance and LCS do not track.
+ */
+#include "config.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define BITPAR_WORD 64
+#define BITPAR_HIGH (UINT64_C(1) << (BITPAR_WORD-1))
+
+typedef struct bitpar {
+    int *s1;
+    int *s2;
+    int words;          /* number of 64-row blocks covering s1 */
+    uint64_t *Peq;      /* [residue][word], bit set where s1 matches */
+    int match;          /* the larger of the two scores */
+    int mismatch;       /* the smaller of the two scores */
+} bitpar_t;
+
+static void bitpar_free(bitpar_t *B)
+{
+    if (NULL != B->Peq) parasail_free(B->Peq);
+    if (NULL != B->s2) parasail_free(B->s2);
+    if (NULL != B->s1) parasail_free(B->s1);
+}
+
+/* Collect the matrix indices of the distinct residues of a sequence,
+ * without allocating.  Returns the number of indices. */
+static int bitpar_residues(const char * const restrict s, const int len,
+        const parasail_matrix_t *matrix, int *index)
+{
+    unsigned char seen[256];
+    int count = 0;
+    int i = 0;
+    int k = 0;
+
+    memset(seen, 0, sizeof(seen));
+    for (i=0; i<len; ++i) {
+        const unsigned char c = (unsigned char)s[i];
+        int m = 0;
+        if (seen[c]) continue;
+        seen[c] = 1;
+        m = matrix->mapper[c];
+        for (k=0; k<count; ++k) {
+            if (index[k] == m) break;
+        }
+        if (k == count) {
+            index[count++] = m;
+        }
+    }
+
+    return count;
+}
+
+/* Find the two scores of the matrix entries the residues can reach,
+ * then map both sequences.  Returns 0, before allocating anything, when
+ * the gaps are not linear or more than two distinct scores are in use. */
+static int bitpar_init(bitpar_t *B,
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int size = matrix->size;
+    int index1[256];
+    int index2[256];
+    int count1 = 0;
+    int count2 = 0;
+    int hi = INT_MIN;
+    int lo = INT_MAX;
+    int count = 0;
+    int W = 0;
+    int i = 0;
+    int j = 0;
+    int d = 0;
+
+    B->s1 = NULL;
+    B->s2 = NULL;
+    B->Peq = NULL;
+
+    if (open != gap || gap <= 0 || s1Len <= 0 || s2Len <= 0) {
+        return 0;
+    }
+
+    count1 = bitpar_residues(_s1, s1Len, matrix, index1);
+    count2 = bitpar_residues(_s2, s2Len, matrix, index2);
+    for (i=0; i<count1; ++i) {
+        for (d=0; d<count2; ++d) {
+            const int value = matrix->matrix[size*index1[i] + index2[d]];
+            if (count > 0 && (value == hi || value == lo)) continue;
+            if (count == 2) {
+                return 0;
+            }
+            ++count;
+            if (value > hi) hi = value;
+            if (value < lo) lo = value;
+        }
+    }
+
+    W = (s1Len + BITPAR_WORD - 1) / BITPAR_WORD;
+    B->words = W;
+    B->match = hi;
+    B->mismatch = lo;
+    B->s1 = parasail_memalign_int(16, s1Len);
+    B->s2 = parasail_memalign_int(16, s2Len);
+    for (i=0; i<s1Len; ++i) {
+        B->s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        B->s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    B->Peq = (uint64_t*)parasail_memalign(16, sizeof(uint64_t)*size*W);
+    parasail_memset(B->Peq, 0, sizeof(uint64_t)*size*W);
+    for (d=0; d<count2; ++d) {
+        uint64_t *Peq = &B->Peq[(size_t)W*index2[d]];
+        for (i=0; i<s1Len; ++i) {
+            if (matrix->matrix[size*B->s1[i] + index2[d]] == hi) {
+                Peq[i/BITPAR_WORD] |= UINT64_C(1) << (i%BITPAR_WORD);
+            }
+        }
+    }
+
+    return 1;
+}
+
+/* Edit distance of s1 against s2 with the cost of a mismatch or of one
+ * gap residue being 1.  For global alignment the first row and column
+ * cost one per residue, otherwise they are free.  Returns the cost of
+ * the last cell; the smallest cost in the last row and its first column
+ * go to row_cost and row_end.  On return Pv and Mv hold the vertical
+ * deltas of the last column. */
+static int bitpar_edit(const bitpar_t *B, int s1Len, int s2Len, int global,
+        uint64_t *Pv, uint64_t *Mv, int *row_cost, int *row_end)
+{
+    const int W = B->words;
+    const int last = (s1Len - 1) % BITPAR_WORD;
+    int cost = global ? s1Len : 0;
+    int b = 0;
+    int j = 0;
+
+    for (b=0; b<W; ++b) {
+        Pv[b] = global ? ~UINT64_C(0) : 0;
+        Mv[b] = 0;
+    }
+    *row_cost = INT_MAX;
+    *row_end = s2Len-1;
+
+    for (j=0; j<s2Len; ++j) {
+        const uint64_t *Peq = &B->Peq[(size_t)W*B->s2[j]];
+        int hin = global ? 1 : 0;
+        for (b=0; b<W; ++b) {
+            uint64_t pv = Pv[b];
+            uint64_t mv = Mv[b];
+            uint64_t eq = Peq[b];
+            uint64_t xv = eq | mv;
+            uint64_t xh = 0;
+            uint64_t ph = 0;
+            uint64_t mh = 0;
+            int hout = 0;
+            if (hin < 0) {
+                eq |= 1;
+            }
+            xh = (((eq & pv) + pv) ^ pv) | eq;
+            ph = mv | ~(xh | pv);
+            mh = pv & xh;
+            if (b == W-1) {
+                cost += (int)((ph >> last) & 1) - (int)((mh >> last) & 1);
+            }
+            if (ph & BITPAR_HIGH) {
+                hout = 1;
+            }
+            else if (mh & BITPAR_HIGH) {
+                hout = -1;
+            }
+            ph <<= 1;
+            mh <<= 1;
+            if (hin < 0) {
+                mh |= 1;
+            }
+            else if (hin > 0) {
+                ph |= 1;
+            }
+            Pv[b] = mh | ~(xv | ph);
+            Mv[b] = ph & xv;
+            hin = hout;
+        }
+        if (cost < *row_cost) {
+            *row_cost = cost;
+            *row_end = j;
+        }
+    }
+
+    return cost;
+}
+
+static int bitpar_popcount(uint64_t x)
+{
+    x = x - ((x >> 1) & UINT64_C(0x5555555555555555));
+    x = (x & UINT64_C(0x3333333333333333))
+        + ((x >> 2) & UINT64_C(0x3333333333333333));
+    x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+    return (int)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+
+/* Length of the longest common subsequence of s1 and s2.  A zero bit
+ * of V marks a row where the LCS grows; the addition carry runs from
+ * each word into the next. */
+static int bitpar_lcs(const bitpar_t *B, int s1Len, int s2Len, uint64_t *V)
+{
+    const int W = B->words;
+    const int tail = s1Len % BITPAR_WORD;
+    int length = 0;
+    int b = 0;
+    int j = 0;
+
+    for (b=0; b<W; ++b) {
+        V[b] = ~UINT64_C(0);
+    }
+
+    for (j=0; j<s2Len; ++j) {
+        const uint64_t *Peq = &B->Peq[(size_t)W*B->s2[j]];
+        uint64_t carry = 0;
+        for (b=0; b<W; ++b) {
+            uint64_t v = V[b];
+            uint64_t u = v & Peq[b];
+            uint64_t t = v + u;
+            uint64_t s = t + carry;
+            carry = (t < v) | (s < t);
+            V[b] = s | (v & ~u);
+        }
+    }
+
+    for (b=0; b<W; ++b) {
+        uint64_t zeros = ~V[b];
+        if (b == W-1 && tail) {
+            zeros &= (UINT64_C(1) << tail) - 1;
+        }
+        length += bitpar_popcount(zeros);
+    }
+
+    return length;
+}
+
+static parasail_result_t* bitpar_nw(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t *result = NULL;
+    bitpar_t B;
+    int a = 0;
+    int b = 0;
+    int g = gap;
+
+    if (!bitpar_init(&B, s1, s1Len, s2, s2Len, open, gap, matrix)) {
+        return NULL;
+    }
+
+    a = B.match;
+    b = B.mismatch;
+    if (a > b && a == 2*b + 2*g) {
+        /* a match is worth two halves of the gaps it saves, so the
+         * score is a fixed share of the length less the edit cost */
+        uint64_t *Pv = (uint64_t*)parasail_memalign(16, sizeof(uint64_t)*B.words);
+        uint64_t *Mv = (uint64_t*)parasail_memalign(16, sizeof(uint64_t)*B.words);
+        int row_cost = 0;
+        int row_end = 0;
+        int cost = bitpar_edit(&B, s1Len, s2Len, 1, Pv, Mv, &row_cost, &row_end);
+        result = parasail_result_new();
+        result->score = (b+g)*(s1Len+s2Len) - (b+2*g)*cost;
+        parasail_free(Mv);
+        parasail_free(Pv);
+    }
+    else if (a > b && b <= -2*g && a + 2*g > 0) {
+        /* a mismatch never beats a deletion and an insertion, so only
+         * the number of matches matters */
+        uint64_t *V = (uint64_t*)parasail_memalign(16, sizeof(uint64_t)*B.words);
+        int length = bitpar_lcs(&B, s1Len, s2Len, V);
+        result = parasail_result_new();
+        result->score = (a+2*g)*length - g*(s1Len+s2Len);
+        parasail_free(V);
+    }
+    else {
+        bitpar_free(&B);
+        return NULL;
+    }
+
+    result->end_query = s1Len-1;
+    result->end_ref = s2Len-1;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_NOVEC
+        | PARASAIL_FLAG_BITS_INT | PARASAIL_FLAG_LANES_1;
+
+    bitpar_free(&B);
+
+    return result;
+}
+
+static parasail_result_t* bitpar_sg(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t *result = NULL;
+    bitpar_t B;
+    uint64_t *Pv = NULL;
+    uint64_t *Mv = NULL;
+    int row_cost = 0;
+    int row_end = 0;
+    int col_cost = INT_MAX;
+    int col_end = 0;
+    int cost = 0;
+    int i = 0;
+
+    if (!bitpar_init(&B, s1, s1Len, s2, s2Len, open, gap, matrix)) {
+        return NULL;
+    }
+
+    /* with free end gaps the aligned length varies, so only a zero
+     * match score leaves the edit cost as the whole score */
+    if (!(B.match == 0 && B.mismatch == -gap)) {
+        bitpar_free(&B);
+        return NULL;
+    }
+
+    Pv = (uint64_t*)parasail_memalign(16, sizeof(uint64_t)*B.words);
+    Mv = (uint64_t*)parasail_memalign(16, sizeof(uint64_t)*B.words);
+    bitpar_edit(&B, s1Len, s2Len, 0, Pv, Mv, &row_cost, &row_end);
+
+    /* rebuild the last column from its vertical deltas, skipping the
+     * last row which the row minimum already covers */
+    for (i=0; i<s1Len-1; ++i) {
+        const uint64_t bit = UINT64_C(1) << (i%BITPAR_WORD);
+        if (Pv[i/BITPAR_WORD] & bit) ++cost;
+        if (Mv[i/BITPAR_WORD] & bit) --cost;
+        if (cost < col_cost) {
+            col_cost = cost;
+            col_end = i;
+        }
+    }
+
+    /* ties go to the last column unless the last row ends earlier,
+     * as in parasail_sg */
+    result = parasail_result_new();
+    if (row_cost < col_cost || (row_cost == col_cost && row_end < s2Len-1)) {
+        result->score = -gap*row_cost;
+        result->end_query = s1Len-1;
+        result->end_ref = row_end;
+    }
+    else {
+        result->score = -gap*col_cost;
+        result->end_query = col_end;
+        result->end_ref = s2Len-1;
+    }
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_NOVEC
+        | PARASAIL_FLAG_BITS_INT | PARASAIL_FLAG_LANES_1;
+    result->flag |= PARASAIL_FLAG_SG_S1_BEG | PARASAIL_FLAG_SG_S1_END
+        | PARASAIL_FLAG_SG_S2_BEG | PARASAIL_FLAG_SG_S2_END;
+
+    parasail_free(Mv);
+    parasail_free(Pv);
+    bitpar_free(&B);
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_bitpar(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t *result = bitpar_nw(
+            s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (NULL == result) {
+        result = parasail_nw_scan_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    return result;
+}
+
+parasail_result_t* parasail_sg_bitpar(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t *result = bitpar_sg(
+            s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (NULL == result) {
+        result = parasail_sg_scan_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    return result;
+}
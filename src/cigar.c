@@ -156,6 +156,8 @@ void parasail_cigar_free(parasail_cigar_t *cigar)
 #define CONCAT3(X, Y, Z) CONCAT3_(X, Y, Z)
 #define LOC_NOVEC int64_t loc = i*lenb + j;
 #define LOC_STRIPED int64_t loc = j*segLen*segWidth + (i%segLen)*segWidth + (i/segLen);
+#define LOC_PACKED int64_t loc = j*segLenP*segWidth + ((i%segLen)/(T/4))*segWidth + (i/segLen); \
+                   int shift = (int)(4*((i%segLen)%(T/4)));
 
 #define T 8
 #include "cigar_template.c"
@@ -167,6 +169,14 @@ void parasail_cigar_free(parasail_cigar_t *cigar)
 #undef T
 #undef STRIPED
 
+#define T 8
+#define STRIPED
+#define PACKED
+#include "cigar_template.c"
+#undef T
+#undef STRIPED
+#undef PACKED
+
 #define T 16
 #include "cigar_template.c"
 #undef T
@@ -177,15 +187,31 @@ void parasail_cigar_free(parasail_cigar_t *cigar)
 #undef T
 #undef STRIPED
 
+#define T 16
+#define STRIPED
+#define PACKED
+#include "cigar_template.c"
+#undef T
+#undef STRIPED
+#undef PACKED
+
+#define T 32
+#include "cigar_template.c"
+#undef T
+
 #define T 32
+#define STRIPED
 #include "cigar_template.c"
 #undef T
+#undef STRIPED
 
 #define T 32
 #define STRIPED
+#define PACKED
 #include "cigar_template.c"
 #undef T
 #undef STRIPED
+#undef PACKED
 
 #define T 64
 #include "cigar_template.c"
@@ -197,6 +223,106 @@ void parasail_cigar_free(parasail_cigar_t *cigar)
 #undef T
 #undef STRIPED
 
+#define T 64
+#define STRIPED
+#define PACKED
+#include "cigar_template.c"
+#undef T
+#undef STRIPED
+#undef PACKED
+
+/* linear-memory traces store the path with M ops; split them into =/X */
+static inline parasail_cigar_t* parasail_cigar_path(
+        const char *seqA,
+        const char *seqB,
+        parasail_result_t *result,
+        int case_sensitive,
+        const char *alphabet_aliases_)
+{
+    char alphabet_aliases[256];
+    size_t aliases_size = 0;
+    const parasail_cigar_t *path = (const parasail_cigar_t*)result->trace->trace_table;
+    size_t size = path->len+1;
+    parasail_cigar_t *cigar = malloc(sizeof(parasail_cigar_t));
+    uint32_t c_mat = 0;
+    uint32_t c_mis = 0;
+    uint32_t c_del = 0;
+    uint32_t c_ins = 0;
+    int64_t i = path->beg_query;
+    int64_t j = path->beg_ref;
+    int k = 0;
+    if (NULL != alphabet_aliases_) {
+        size_t i;
+        aliases_size = strlen(alphabet_aliases_);
+        assert(aliases_size % 2 == 0 && aliases_size < 256); // even number of characters in alias
+        for (i=0; i<aliases_size; ++i) {
+            alphabet_aliases[i] = case_sensitive ? alphabet_aliases_[i] :
+                                                   toupper(alphabet_aliases_[i]);
+        }
+    }
+    cigar->seq = malloc(sizeof(uint32_t)*size);
+    cigar->len = 0;
+    for (k=0; k<path->len; ++k) {
+        char op = parasail_cigar_decode_op(path->seq[k]);
+        uint32_t len = parasail_cigar_decode_len(path->seq[k]);
+        if ('I' == op) {
+            if (0 == c_del) {
+                WRITE_ANY;
+            }
+            c_del += len;
+            i += len;
+        }
+        else if ('D' == op) {
+            if (0 == c_ins) {
+                WRITE_ANY;
+            }
+            c_ins += len;
+            j += len;
+        }
+        else {
+            uint32_t l;
+            for (l=0; l<len; ++l) {
+                char a = case_sensitive ? seqA[i] : toupper(seqA[i]);
+                char b = case_sensitive ? seqB[j] : toupper(seqB[j]);
+                int matches = (a == b);
+                if (NULL != alphabet_aliases_) {
+                    size_t i;
+                    for (i=0; i<aliases_size; i+=1) {
+                        if (alphabet_aliases[i] == a) {
+                            matches |= alphabet_aliases[i+1] == b;
+                        }
+                        else if (alphabet_aliases[i+1] == a) {
+                            matches |= alphabet_aliases[i] == b;
+                        }
+                    }
+                }
+                if (matches) {
+                    if (0 == c_mat) {
+                        WRITE_ANY;
+                    }
+                    c_mat += 1;
+                }
+                else {
+                    if (0 == c_mis) {
+                        WRITE_ANY;
+                    }
+                    c_mis += 1;
+                }
+                ++i;
+                ++j;
+            }
+        }
+    }
+
+    /* in case we missed the last write */
+    WRITE_ANY;
+
+    cigar->beg_query = path->beg_query;
+    cigar->beg_ref = path->beg_ref;
+
+    return cigar;
+}
+
 parasail_cigar_t* parasail_result_get_cigar_extra(
         parasail_result_t *result,
         const char *seqA,
@@ -209,7 +335,24 @@ parasail_cigar_t* parasail_result_get_cigar_extra(
 {
     assert(parasail_result_is_trace(result));
 
-    if (result->flag & PARASAIL_FLAG_STRIPED || result->flag & PARASAIL_FLAG_SCAN) {
+    if (PARASAIL_TRACE_FORMAT_PATH == result->trace->format) {
+        return parasail_cigar_path(seqA, seqB, result, case_sensitive, alphabet_aliases);
+    }
+    else if (PARASAIL_TRACE_FORMAT_PACKED == result->trace->format) {
+        if (result->flag & PARASAIL_FLAG_BITS_8) {
+            return parasail_cigar_packed_8(seqA, lena, seqB, lenb, matrix, result, case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_16) {
+            return parasail_cigar_packed_16(seqA, lena, seqB, lenb, matrix, result, case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_32) {
+            return parasail_cigar_packed_32(seqA, lena, seqB, lenb, matrix, result, case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_64) {
+            return parasail_cigar_packed_64(seqA, lena, seqB, lenb, matrix, result, case_sensitive, alphabet_aliases);
+        }
+    }
+    else if (result->flag & PARASAIL_FLAG_STRIPED || result->flag & PARASAIL_FLAG_SCAN) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
             return parasail_cigar_striped_8(seqA, lena, seqB, lenb, matrix, result, case_sensitive, alphabet_aliases);
         }
@@ -242,3 +385,161 @@ parasail_cigar_t* parasail_result_get_cigar(
     return parasail_result_get_cigar_extra(result, seqA, lena, seqB, lenb, matrix, 0, NULL);
 }
 
+
+/* append len residues of op to cigar, merging with the last operation */
+static inline void parasail_cigar_append(
+        parasail_cigar_t *cigar, uint32_t len, char op)
+{
+    if (0 == len) {
+        return;
+    }
+    if (cigar->len > 0
+            && parasail_cigar_decode_op(cigar->seq[cigar->len-1]) == op) {
+        len += parasail_cigar_decode_len(cigar->seq[cigar->len-1]);
+        cigar->seq[cigar->len-1] = parasail_cigar_encode(len, op);
+    }
+    else {
+        cigar->seq[cigar->len++] = parasail_cigar_encode(len, op);
+    }
+}
+
+/* A global path through an m by n window with g gapped residues pairs
+ * at most (m+n-g)/2 residues and pays at least open+(g-1)*gap, so the
+ * score bounds g, and a path with g gapped residues strays at most
+ * (g-|m-n|)/2 diagonals outside the band between the window corners. */
+static inline int parasail_window_band(
+        int m, int n, int score, int open, int gap,
+        const parasail_matrix_t *matrix)
+{
+    const int64_t max = matrix->max > 0 ? matrix->max : 0;
+    const int64_t diff = m > n ? m-n : n-m;
+    int64_t g = 0;
+    int64_t k = 0;
+    if (max + 2*gap <= 0) {
+        return m+n;
+    }
+    g = (max*(m+n) - 2*(int64_t)score - 2*open + 2*gap) / (max + 2*gap);
+    k = g > diff ? (g - diff)/2 + 1 : 1;
+    return k < m+n ? (int)k : m+n;
+}
+
+parasail_cigar_t* parasail_result_get_cigar_window_extra(
+        parasail_result_t *result,
+        const char *seqA,
+        int lena,
+        const char *seqB,
+        int lenb,
+        int open,
+        int gap,
+        const parasail_matrix_t *matrix,
+        int case_sensitive,
+        const char *alphabet_aliases)
+{
+    parasail_result_t *trace = NULL;
+    parasail_cigar_t *window = NULL;
+    parasail_cigar_t *cigar = NULL;
+    int begin_query = 0;
+    int begin_ref = 0;
+    int end_query = 0;
+    int end_ref = 0;
+    int m = 0;
+    int n = 0;
+    int k = 0;
+    int l = 0;
+
+    /* a trace result already has its full traceback */
+    if (parasail_result_is_trace(result)) {
+        return parasail_result_get_cigar_extra(result, seqA, lena, seqB,
+                lenb, matrix, case_sensitive, alphabet_aliases);
+    }
+
+    if (result->begin_query < 0 || result->begin_ref < 0) {
+        if (!parasail_result_find_begin(result, seqA, lena, seqB, lenb,
+                    open, gap, matrix)) {
+            return NULL;
+        }
+    }
+    begin_query = result->begin_query;
+    begin_ref = result->begin_ref;
+    end_query = result->end_query;
+    end_ref = result->end_ref;
+    if (begin_query > end_query || begin_ref > end_ref
+            || end_query >= lena || end_ref >= lenb) {
+        return NULL;
+    }
+    m = end_query - begin_query + 1;
+    n = end_ref - begin_ref + 1;
+
+    /* the window is aligned end to end; should the score bound not
+     * hold, e.g. the penalties differ from the alignment's, retry over
+     * the whole window */
+    k = parasail_window_band(m, n, result->score, open, gap, matrix);
+    trace = parasail_nw_trace_banded_sat(seqA+begin_query, m,
+            seqB+begin_ref, n, open, gap, k, matrix);
+    if (NULL != trace && trace->score != result->score && k < m+n) {
+        parasail_result_free(trace);
+        trace = parasail_nw_trace_banded_sat(seqA+begin_query, m,
+                seqB+begin_ref, n, open, gap, m+n, matrix);
+    }
+    if (NULL == trace) {
+        return NULL;
+    }
+    if (trace->score != result->score) {
+        parasail_result_free(trace);
+        return NULL;
+    }
+    window = parasail_result_get_cigar_extra(trace, seqA+begin_query, m,
+            seqB+begin_ref, n, matrix, case_sensitive, alphabet_aliases);
+    parasail_result_free(trace);
+    if (NULL == window) {
+        return NULL;
+    }
+
+    if (!(result->flag & PARASAIL_FLAG_SG)) {
+        window->beg_query += begin_query;
+        window->beg_ref += begin_ref;
+        return window;
+    }
+
+    /* semi-global alignment includes the end gaps, as the trace
+     * functions report them */
+    if (end_query+1 != lena && end_ref+1 != lenb) {
+        parasail_cigar_free(window);
+        return NULL;
+    }
+    cigar = malloc(sizeof(parasail_cigar_t));
+    cigar->seq = malloc(sizeof(uint32_t)*(window->len+4));
+    cigar->len = 0;
+    cigar->beg_query = 0;
+    cigar->beg_ref = 0;
+    parasail_cigar_append(cigar, begin_query, 'I');
+    parasail_cigar_append(cigar, begin_ref, 'D');
+    for (l=0; l<window->len; ++l) {
+        parasail_cigar_append(cigar,
+                parasail_cigar_decode_len(window->seq[l]),
+                parasail_cigar_decode_op(window->seq[l]));
+    }
+    if (end_query+1 == lena) {
+        parasail_cigar_append(cigar, lenb-1-end_ref, 'D');
+    }
+    else {
+        parasail_cigar_append(cigar, lena-1-end_query, 'I');
+    }
+    parasail_cigar_free(window);
+
+    return cigar;
+}
+
+parasail_cigar_t* parasail_result_get_cigar_window(
+        parasail_result_t *result,
+        const char *seqA,
+        int lena,
+        const char *seqB,
+        int lenb,
+        int open,
+        int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_result_get_cigar_window_extra(result, seqA, lena,
+            seqB, lenb, open, gap, matrix, 0, NULL);
+}
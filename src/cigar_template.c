@@ -1,10 +1,19 @@
 /* this file is only included by cigar.c, multiple times */
 
+#if defined(PACKED)
+#define D CONCAT3(uint, T, _t)
+#define TRACE parasail_trace_unpack((int)((HT[loc] >> shift) & 15))
+#else
 #define D CONCAT3(int, T, _t)
+#define TRACE HT[loc]
+#endif
 
 #define UNUSED(expr) do { (void)(expr); } while (0)
 
-#if defined(STRIPED)
+#if defined(PACKED)
+#define NAME parasail_cigar_packed_
+#define LOC LOC_PACKED
+#elif defined(STRIPED)
 #define NAME parasail_cigar_striped_
 #define LOC LOC_STRIPED
 #else
@@ -81,6 +90,9 @@ static inline parasail_cigar_t* CONCAT(NAME, T) (
 #if defined(STRIPED)
     int64_t segWidth = 0;
     int64_t segLen = 0;
+#if defined(PACKED)
+    int64_t segLenP = 0;
+#endif
     if (result->flag & PARASAIL_FLAG_LANES_1) {
         segWidth = 1;
     }
@@ -103,6 +115,9 @@ static inline parasail_cigar_t* CONCAT(NAME, T) (
         segWidth = 64;
     }
     segLen = (lena + segWidth - 1) / segWidth;
+#endif
+#if defined(PACKED)
+    segLenP = (segLen + T/4 - 1) / (T/4);
 #endif
     if (NULL != alphabet_aliases_) {
         size_t i;
@@ -164,7 +179,7 @@ static inline parasail_cigar_t* CONCAT(NAME, T) (
             break;
         }
         if (PARASAIL_DIAG == where) {
-            if (HT[loc] & PARASAIL_DIAG) {
+            if (TRACE & PARASAIL_DIAG) {
                 char a = case_sensitive ? seqA[i] : toupper(seqA[i]);
                 char b = case_sensitive ? seqB[j] : toupper(seqB[j]);
                 int matches = (a == b);
@@ -194,10 +209,10 @@ static inline parasail_cigar_t* CONCAT(NAME, T) (
                 --i;
                 --j;
             }
-            else if (HT[loc] & PARASAIL_INS) {
+            else if (TRACE & PARASAIL_INS) {
                 where = PARASAIL_INS;
             }
-            else if (HT[loc] & PARASAIL_DEL) {
+            else if (TRACE & PARASAIL_DEL) {
                 where = PARASAIL_DEL;
             }
             /* no bits were set, so this is the zero condition */
@@ -211,10 +226,10 @@ static inline parasail_cigar_t* CONCAT(NAME, T) (
             }
             c_ins += 1;
             --j;
-            if (HT[loc] & PARASAIL_DIAG_E) {
+            if (TRACE & PARASAIL_DIAG_E) {
                 where = PARASAIL_DIAG;
             }
-            else if (HT[loc] & PARASAIL_INS_E) {
+            else if (TRACE & PARASAIL_INS_E) {
                 where = PARASAIL_INS;
             }
             else {
@@ -228,10 +243,10 @@ static inline parasail_cigar_t* CONCAT(NAME, T) (
             }
             c_del += 1;
             --i;
-            if (HT[loc] & PARASAIL_DIAG_F) {
+            if (TRACE & PARASAIL_DIAG_F) {
                 where = PARASAIL_DIAG;
             }
-            else if (HT[loc] & PARASAIL_DEL_F) {
+            else if (TRACE & PARASAIL_DEL_F) {
                 where = PARASAIL_DEL;
             }
             else {
@@ -261,6 +276,7 @@ static inline parasail_cigar_t* CONCAT(NAME, T) (
 }
 
 #undef D
+#undef TRACE
 #undef NAME
 #undef LOC
 
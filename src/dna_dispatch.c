@@ -0,0 +1,71 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+/* the matrix row of one residue has to fit in a 16-byte shuffle */
+static int dna_matrix(const parasail_matrix_t *matrix)
+{
+    return matrix->size <= 16
+        && matrix->min >= INT8_MIN
+        && matrix->max <= INT8_MAX;
+}
+
+/* without a usable instruction set, use the striped functions */
+#define DNA_FALLBACK(NAME, WIDTH)                                       \
+parasail_result_t* NAME(                                                \
+        const char * const restrict s1, const int s1Len,                \
+        const char * const restrict s2, const int s2Len,                \
+        const int open, const int gap,                                  \
+        const parasail_matrix_t *matrix,                                \
+        const int flags)                                                \
+{                                                                       \
+    if (flags & PARASAIL_FLAG_NW) {                                     \
+        return parasail_nw_striped_##WIDTH(s1, s1Len, s2, s2Len, open, gap, matrix); \
+    }                                                                   \
+    if (flags & PARASAIL_FLAG_SG) {                                     \
+        return parasail_sg_striped_##WIDTH(s1, s1Len, s2, s2Len, open, gap, matrix); \
+    }                                                                   \
+    return parasail_sw_striped_##WIDTH(s1, s1Len, s2, s2Len, open, gap, matrix); \
+}
+
+DNA_FALLBACK(parasail_dna_striped_8, 8)
+DNA_FALLBACK(parasail_dna_striped_16, 16)
+DNA_FALLBACK(parasail_dna_striped_32, 32)
+DNA_FALLBACK(parasail_dna_striped_sat, sat)
+
+/* implement the wrapper functions; matrices that do not fit the
+ * in-register lookup use the striped functions with a profile */
+
+#define DNA_WRAPPER(NAME, CALL, FALLBACK, FLAGS)                        \
+parasail_result_t* NAME(                                                \
+        const char * const restrict s1, const int s1Len,                \
+        const char * const restrict s2, const int s2Len,                \
+        const int open, const int gap,                                  \
+        const parasail_matrix_t *matrix)                                \
+{                                                                       \
+    if (!dna_matrix(matrix)) {                                          \
+        return FALLBACK(s1, s1Len, s2, s2Len, open, gap, matrix, FLAGS);\
+    }                                                                   \
+    return CALL(s1, s1Len, s2, s2Len, open, gap, matrix, FLAGS);        \
+}
+
+#define DNA_WRAPPERS(PREFIX, FLAGS)                                     \
+DNA_WRAPPER(PREFIX##_8, parasail_dna_8, parasail_dna_striped_8, FLAGS)      \
+DNA_WRAPPER(PREFIX##_16, parasail_dna_16, parasail_dna_striped_16, FLAGS)   \
+DNA_WRAPPER(PREFIX##_32, parasail_dna_32, parasail_dna_striped_32, FLAGS)   \
+DNA_WRAPPER(PREFIX##_sat, parasail_dna_sat, parasail_dna_striped_sat, FLAGS)
+
+DNA_WRAPPERS(parasail_nw_striped_dna, PARASAIL_FLAG_NW)
+DNA_WRAPPERS(parasail_sg_striped_dna, PARASAIL_FLAG_SG)
+DNA_WRAPPERS(parasail_sw_striped_dna, PARASAIL_FLAG_SW)
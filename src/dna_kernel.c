@@ -0,0 +1,372 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Striped alignment without a query profile.  Instead of one profile
+ * vector per query segment and residue, the query is stored once as
+ * striped matrix indices and the substitution scores are looked up in
+ * registers: the matrix row of the current database residue fits in 16
+ * bytes, and a byte shuffle with the query indices produces the scores
+ * of a whole segment.  Wider lanes put 0x80 in their upper index bytes
+ * so that the shuffle zeroes them, and the score is then sign extended
+ * by a pair of shifts.  Padding rows past the end of the query use 0x80
+ * in every byte and so score zero, just like the profile padding.
+ *
+ * Included once per algorithm by dna_template.c with one of DNA_NW,
+ * DNA_SG or DNA_SW defined, and KNAME naming the function.  The
+ * results are identical to the striped functions of the same width.
+ */
+
+parasail_result_t* KNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int32_t n = matrix->size;
+    const int32_t segWidth = LANES; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    VEC * const restrict vQuery = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    VEC * restrict pvHStore = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    VEC * restrict pvHLoad = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    VEC * const restrict pvE = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    VEC vRow[16];
+    const VEC vGapO = VSET1(open);
+    const VEC vGapE = VSET1(gap);
+#ifdef DNA_SW
+    VEC * const restrict pvHMax = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    const INT bias = NEG_INF;
+    const INT maxp = POS_INF - (INT)(matrix->max + 1);
+    const VEC vBias = VSET1(bias);
+    VEC vMaxH = vBias;
+    VEC vMaxHUnit = vBias;
+    INT score = bias;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    int saturated = 0;
+#else
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (s1Len - 1) / segLen;
+    INT * const restrict boundary = (INT*)parasail_memalign(sizeof(VEC), sizeof(INT)*(s2Len+1));
+    const INT NEG_LIMIT = (-open < matrix->min ?
+        NEG_INF + open : NEG_INF - matrix->min) + 1;
+    const INT POS_LIMIT = POS_INF - matrix->max - 1;
+    const VEC vNegLimit = VSET1(NEG_LIMIT);
+    const VEC vPosLimit = VSET1(POS_LIMIT);
+    VEC vSaturationCheckMin = vPosLimit;
+    VEC vSaturationCheckMax = vNegLimit;
+    INT score = NEG_LIMIT;
+    int32_t end_query = s1Len - 1;
+    int32_t end_ref = s2Len - 1;
+#endif
+    parasail_result_t *result = parasail_result_new();
+
+    /* the query as matrix indices in the low byte of each lane */
+    {
+        unsigned char *t = (unsigned char*)vQuery;
+        memset(vQuery, 0x80, sizeof(VEC)*segLen);
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int32_t q = segNum*segLen + i;
+                if (q < s1Len) {
+                    t[(i*segWidth + segNum)*sizeof(INT)] =
+                        (unsigned char)matrix->mapper[(unsigned char)s1[q]];
+                }
+            }
+        }
+    }
+
+    /* one 16-byte matrix row per database residue */
+    for (k=0; k<n; ++k) {
+        int8_t row[16];
+        int32_t q = 0;
+        for (q=0; q<16; ++q) {
+            row[q] = (int8_t)(q < n ? matrix->matrix[n*k + q] : 0);
+        }
+        vRow[k] = VROW(row);
+    }
+
+#ifdef DNA_SW
+    /* initialize H and E */
+    for (i=0; i<segLen; ++i) {
+        VSTORE(pvHStore + i, vBias);
+        VSTORE(pvE + i, vBias);
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        VEC vE;
+        VEC vF = vBias;
+        /* load final segment of pvHStore and shift left by one lane */
+        VEC vH = VINSERT0(VSHIFT(pvHStore[segLen - 1]), bias);
+        const VEC vR = vRow[matrix->mapper[(unsigned char)s2[j]]];
+
+        /* Swap the 2 H buffers. */
+        VEC *pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = VADD(vH, VLOOKUP(vR, VLOAD(vQuery + i)));
+            vH = VMAX(vH, vBias);
+            vE = VLOAD(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = VMAX(vH, vE);
+            vH = VMAX(vH, vF);
+            /* Save vH values. */
+            VSTORE(pvHStore + i, vH);
+            vMaxH = VMAX(vH, vMaxH);
+
+            /* Update vE value. */
+            vH = VSUB(vH, vGapO);
+            vE = VSUB(vE, vGapE);
+            vE = VMAX(vE, vH);
+            VSTORE(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = VSUB(vF, vGapE);
+            vF = VMAX(vF, vH);
+
+            /* Load the next vH. */
+            vH = VLOAD(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = VINSERT0(VSHIFT(vF), bias);
+            for (i=0; i<segLen; ++i) {
+                vH = VLOAD(pvHStore + i);
+                vH = VMAX(vH, vF);
+                VSTORE(pvHStore + i, vH);
+                vMaxH = VMAX(vH, vMaxH);
+                vH = VSUB(vH, vGapO);
+                vF = VSUB(vF, vGapE);
+                if (!VANYGT(vF, vH)) goto end;
+            }
+        }
+end:
+        if (VANYGT(vMaxH, vMaxHUnit)) {
+            score = VHMAX(vMaxH);
+            /* if score has potential to overflow, abort early */
+            if (score > maxp) {
+                saturated = 1;
+                break;
+            }
+            vMaxHUnit = VSET1(score);
+            end_ref = j;
+            memcpy(pvHMax, pvHStore, sizeof(VEC)*segLen);
+        }
+    }
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = bias;
+        end_query = 0;
+        end_ref = 0;
+    }
+    else if (score > bias) {
+        /* Trace the alignment ending position on read. */
+        const INT *t = (const INT*)pvHMax;
+        const int32_t column_len = segLen * segWidth;
+        end_query = s1Len - 1;
+        for (i=0; i<column_len; ++i, ++t) {
+            if (*t == score) {
+                int32_t temp = i / segWidth + i % segWidth * segLen;
+                if (temp < end_query) {
+                    end_query = temp;
+                }
+            }
+        }
+    }
+
+    result->score = score - bias;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SW | PARASAIL_FLAG_STRIPED
+        | FLAG_BITS | FLAG_LANES;
+
+    parasail_free(pvHMax);
+#else
+    /* initialize H and E */
+    {
+        INT *h = (INT*)pvHStore;
+        INT *e = (INT*)pvE;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+#ifdef DNA_SG
+                int64_t tmp = 0;
+#else
+                int64_t tmp = -open-gap*(int64_t)(segNum*segLen+i);
+#endif
+                *h++ = tmp < NEG_INF ? NEG_INF : tmp;
+                tmp = tmp - open;
+                *e++ = tmp < NEG_INF ? NEG_INF : tmp;
+            }
+        }
+    }
+
+    /* initialize upper boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+#ifdef DNA_SG
+            int64_t tmp = 0;
+#else
+            int64_t tmp = -open-gap*(int64_t)(i-1);
+#endif
+            boundary[i] = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        VEC vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        VEC vF = vNegLimit;
+        /* load final segment of pvHStore and shift left by one lane,
+         * inserting the upper boundary condition */
+        VEC vH = VINSERT0(VSHIFT(pvHStore[segLen - 1]), boundary[j]);
+        const VEC vR = vRow[matrix->mapper[(unsigned char)s2[j]]];
+#ifdef DNA_SG
+        const int64_t tmp = -open;
+#else
+        const int64_t tmp = boundary[j+1] - open;
+#endif
+        const INT vFInsert = tmp < NEG_INF ? NEG_INF : tmp;
+
+        /* Swap the 2 H buffers. */
+        VEC *pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = VADD(vH, VLOOKUP(vR, VLOAD(vQuery + i)));
+            vE = VLOAD(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = VMAX(vH, vE);
+            vH = VMAX(vH, vF);
+            /* Save vH values. */
+            VSTORE(pvHStore + i, vH);
+            vSaturationCheckMin = VMIN(vSaturationCheckMin, vH);
+            vSaturationCheckMax = VMAX(vSaturationCheckMax, vH);
+#ifdef DNA_NW
+            /* the clamped boundary enters through E and F */
+            vSaturationCheckMin = VMIN(vSaturationCheckMin, vE);
+            vSaturationCheckMin = VMIN(vSaturationCheckMin, vF);
+#endif
+
+            /* Update vE value. */
+            vH = VSUB(vH, vGapO);
+            vE = VSUB(vE, vGapE);
+            vE = VMAX(vE, vH);
+            VSTORE(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = VSUB(vF, vGapE);
+            vF = VMAX(vF, vH);
+
+            /* Load the next vH. */
+            vH = VLOAD(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = VINSERT0(VSHIFT(vF), vFInsert);
+            for (i=0; i<segLen; ++i) {
+                vH = VLOAD(pvHStore + i);
+                vH = VMAX(vH, vF);
+                VSTORE(pvHStore + i, vH);
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vH);
+                vSaturationCheckMax = VMAX(vSaturationCheckMax, vH);
+#ifdef DNA_NW
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vF);
+#endif
+                vH = VSUB(vH, vGapO);
+                vF = VSUB(vF, vGapE);
+                if (!VANYGT(vF, vH)) goto end;
+            }
+        }
+end:
+#ifdef DNA_SG
+        /* max of the last row over all columns */
+        {
+            INT h = ((INT*)pvHStore)[offset*segWidth + position];
+            if (h > score) {
+                score = h;
+                end_ref = j;
+            }
+        }
+#else
+        {
+        }
+#endif
+    }
+
+#ifdef DNA_SG
+    /* max of the last column */
+    {
+        const INT *t = (const INT*)pvHStore;
+        const int32_t column_len = segLen * segWidth;
+        for (i=0; i<column_len; ++i, ++t) {
+            int32_t temp = i / segWidth + i % segWidth * segLen;
+            if (temp >= s1Len) continue;
+            if (*t > score) {
+                score = *t;
+                end_query = temp;
+                end_ref = s2Len-1;
+            }
+            else if (*t == score && end_ref == s2Len-1 && temp < end_query) {
+                end_query = temp;
+            }
+        }
+    }
+#else
+    /* the last value of the last column */
+    score = ((INT*)pvHStore)[offset*segWidth + position];
+#endif
+
+    if (VANYGT(vNegLimit, vSaturationCheckMin)
+            || VANYGT(vSaturationCheckMax, vPosLimit)) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+#ifdef DNA_SG
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_BEG | PARASAIL_FLAG_SG_S1_END
+        | PARASAIL_FLAG_SG_S2_BEG | PARASAIL_FLAG_SG_S2_END;
+#else
+    result->flag |= PARASAIL_FLAG_NW;
+#endif
+    result->flag |= PARASAIL_FLAG_STRIPED | FLAG_BITS | FLAG_LANES;
+
+    parasail_free(boundary);
+#endif
+
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(vQuery);
+
+    return result;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Instantiates the profile-free striped kernels for one vector width.
+ * The including file defines the vector operations for that width and
+ * ENAME, the name of the function that selects among the kernels.
+ */
+
+#ifndef DNA_CONCAT
+#define DNA_CONCAT_(a,b) a##b
+#define DNA_CONCAT(a,b) DNA_CONCAT_(a,b)
+#endif
+
+#define DNA_NW
+#define KNAME DNA_CONCAT(ENAME, _nw)
+#include "dna_kernel.c"
+#undef KNAME
+#undef DNA_NW
+
+#define DNA_SG
+#define KNAME DNA_CONCAT(ENAME, _sg)
+#include "dna_kernel.c"
+#undef KNAME
+#undef DNA_SG
+
+#define DNA_SW
+#define KNAME DNA_CONCAT(ENAME, _sw)
+#include "dna_kernel.c"
+#undef KNAME
+#undef DNA_SW
+
+parasail_result_t* ENAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+    if (flags & PARASAIL_FLAG_NW) {
+        return DNA_CONCAT(ENAME, _nw)(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (flags & PARASAIL_FLAG_SG) {
+        return DNA_CONCAT(ENAME, _sg)(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    return DNA_CONCAT(ENAME, _sw)(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
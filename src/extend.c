@@ -0,0 +1,154 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Serial seed extension with x-drop and z-drop termination.  The table
+ * is computed one column of s2 at a time, in the same order as the
+ * striped and scan extension kernels, so that all of them stop at the
+ * same column.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define NEG_INF_32 (INT32_MIN/2)
+#define MAX(a,b) ((a)>(b)?(a):(b))
+
+parasail_result_t* parasail_extend(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_result_t *result = parasail_result_new();
+    int * const restrict s1 = parasail_memalign_int(16, s1Len);
+    int * const restrict H = parasail_memalign_int(16, s1Len+1);
+    int * const restrict E = parasail_memalign_int(16, s1Len+1);
+    int i = 0;
+    int j = 0;
+    int score = 0;
+    int end_query = -1;
+    int end_ref = -1;
+    int query_end_score = NEG_INF_32;
+    int query_end_ref = -1;
+    int stop = PARASAIL_EXTEND_END;
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+
+    /* left boundary, H[i+1] holds row i */
+    H[0] = 0;
+    for (i=1; i<=s1Len; ++i) {
+        H[i] = -open -(i-1)*gap;
+        E[i] = NEG_INF_32;
+    }
+
+    /* iter over second sequence */
+    for (j=0; j<s2Len; ++j) {
+        const int * const restrict matcol = &matrix->matrix[matrix->size*matrix->mapper[(unsigned char)_s2[j]]];
+        int NWH = H[0];
+        int NH = -open - j*gap;
+        int F = NEG_INF_32;
+        int max = NEG_INF_32;
+        int max_query = -1;
+        int cut = 0;
+        H[0] = NH;
+        for (i=1; i<=s1Len; ++i) {
+            int H_dag = NWH + matcol[s1[i-1]];
+            NWH = H[i];
+            E[i] = MAX(E[i] - gap, NWH - open);
+            F = MAX(F - gap, NH - open);
+            NH = MAX(H_dag, E[i]);
+            NH = MAX(NH, F);
+            H[i] = NH;
+            if (NH > max) {
+                max = NH;
+                max_query = i-1;
+            }
+        }
+
+        if (max > score) {
+            score = max;
+            end_query = max_query;
+            end_ref = j;
+        }
+        if (xdrop >= 0 && max < score - xdrop) {
+            stop = PARASAIL_EXTEND_XDROP;
+            ++j;
+            break;
+        }
+        if (zdrop >= 0 && score - max > zdrop) {
+            int diagonal = (j - end_ref) - (max_query - end_query);
+            if (diagonal < 0) {
+                diagonal = -diagonal;
+            }
+            if (score - max > zdrop + gap*diagonal) {
+                stop = PARASAIL_EXTEND_ZDROP;
+                ++j;
+                break;
+            }
+        }
+
+        /* cut the cells that can no longer come within xdrop */
+        cut = xdrop >= 0 ? score - xdrop : NEG_INF_32;
+        if (xdrop >= 0) {
+            for (i=1; i<=s1Len; ++i) {
+                if (H[i] < cut) {
+                    H[i] = NEG_INF_32;
+                }
+            }
+        }
+        if (H[s1Len] >= cut && H[s1Len] > query_end_score) {
+            query_end_score = H[s1Len];
+            query_end_ref = j;
+        }
+    }
+
+    if (NULL != extension) {
+        extension->query_end_score = query_end_ref < 0 ? 0 : query_end_score;
+        extension->query_end_ref = query_end_ref;
+        extension->ref_end_score = 0;
+        extension->ref_end_query = -1;
+        extension->ref_scanned = j;
+        extension->stop = stop;
+        if (PARASAIL_EXTEND_END == stop) {
+            /* the last column is cut, so any cell left in it is alive */
+            int max = NEG_INF_32;
+            for (i=1; i<=s1Len; ++i) {
+                if (H[i] > max) {
+                    max = H[i];
+                    extension->ref_end_query = i-1;
+                }
+            }
+            if (max > NEG_INF_32) {
+                extension->ref_end_score = max;
+            }
+            else {
+                extension->ref_end_query = -1;
+            }
+        }
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_END | PARASAIL_FLAG_SG_S2_END
+        | PARASAIL_FLAG_NOVEC
+        | PARASAIL_FLAG_BITS_INT | PARASAIL_FLAG_LANES_1;
+
+    parasail_free(E);
+    parasail_free(H);
+    parasail_free(s1);
+
+    return result;
+}
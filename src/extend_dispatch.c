@@ -0,0 +1,1024 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+
+/* forward declare the dispatcher functions */
+parasail_extend_function_t parasail_extend_scan_64_dispatcher;
+parasail_extend_function_t parasail_extend_scan_32_dispatcher;
+parasail_extend_function_t parasail_extend_scan_16_dispatcher;
+parasail_extend_function_t parasail_extend_scan_8_dispatcher;
+parasail_extend_function_t parasail_extend_striped_64_dispatcher;
+parasail_extend_function_t parasail_extend_striped_32_dispatcher;
+parasail_extend_function_t parasail_extend_striped_16_dispatcher;
+parasail_extend_function_t parasail_extend_striped_8_dispatcher;
+parasail_extend_pfunction_t parasail_extend_scan_profile_64_dispatcher;
+parasail_extend_pfunction_t parasail_extend_scan_profile_32_dispatcher;
+parasail_extend_pfunction_t parasail_extend_scan_profile_16_dispatcher;
+parasail_extend_pfunction_t parasail_extend_scan_profile_8_dispatcher;
+parasail_extend_pfunction_t parasail_extend_striped_profile_64_dispatcher;
+parasail_extend_pfunction_t parasail_extend_striped_profile_32_dispatcher;
+parasail_extend_pfunction_t parasail_extend_striped_profile_16_dispatcher;
+parasail_extend_pfunction_t parasail_extend_striped_profile_8_dispatcher;
+
+/* declare and initialize the pointer to the dispatcher function */
+parasail_extend_function_t * parasail_extend_scan_64_pointer = parasail_extend_scan_64_dispatcher;
+parasail_extend_function_t * parasail_extend_scan_32_pointer = parasail_extend_scan_32_dispatcher;
+parasail_extend_function_t * parasail_extend_scan_16_pointer = parasail_extend_scan_16_dispatcher;
+parasail_extend_function_t * parasail_extend_scan_8_pointer = parasail_extend_scan_8_dispatcher;
+parasail_extend_function_t * parasail_extend_striped_64_pointer = parasail_extend_striped_64_dispatcher;
+parasail_extend_function_t * parasail_extend_striped_32_pointer = parasail_extend_striped_32_dispatcher;
+parasail_extend_function_t * parasail_extend_striped_16_pointer = parasail_extend_striped_16_dispatcher;
+parasail_extend_function_t * parasail_extend_striped_8_pointer = parasail_extend_striped_8_dispatcher;
+parasail_extend_pfunction_t * parasail_extend_scan_profile_64_pointer = parasail_extend_scan_profile_64_dispatcher;
+parasail_extend_pfunction_t * parasail_extend_scan_profile_32_pointer = parasail_extend_scan_profile_32_dispatcher;
+parasail_extend_pfunction_t * parasail_extend_scan_profile_16_pointer = parasail_extend_scan_profile_16_dispatcher;
+parasail_extend_pfunction_t * parasail_extend_scan_profile_8_pointer = parasail_extend_scan_profile_8_dispatcher;
+parasail_extend_pfunction_t * parasail_extend_striped_profile_64_pointer = parasail_extend_striped_profile_64_dispatcher;
+parasail_extend_pfunction_t * parasail_extend_striped_profile_32_pointer = parasail_extend_striped_profile_32_dispatcher;
+parasail_extend_pfunction_t * parasail_extend_striped_profile_16_pointer = parasail_extend_striped_profile_16_dispatcher;
+parasail_extend_pfunction_t * parasail_extend_striped_profile_8_pointer = parasail_extend_striped_profile_8_dispatcher;
+
+/* dispatcher function implementations */
+
+parasail_result_t* parasail_extend_scan_64_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_scan_64_pointer = parasail_extend_scan_avx512_512_64;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_scan_64_pointer = parasail_extend_scan_avx2_256_64;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_scan_64_pointer = parasail_extend_scan_sse41_128_64;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_scan_64_pointer = parasail_extend_scan_sse2_128_64;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_scan_64_pointer = parasail_extend_scan_altivec_128_64;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_scan_64_pointer = parasail_extend_scan_neon_128_64;
+    }
+    else
+#endif
+    {
+        parasail_extend_scan_64_pointer = parasail_extend;
+    }
+    return parasail_extend_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_scan_32_pointer = parasail_extend_scan_avx512_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_scan_32_pointer = parasail_extend_scan_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_scan_32_pointer = parasail_extend_scan_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_scan_32_pointer = parasail_extend_scan_sse2_128_32;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_scan_32_pointer = parasail_extend_scan_altivec_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_scan_32_pointer = parasail_extend_scan_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_extend_scan_32_pointer = parasail_extend;
+    }
+    return parasail_extend_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_scan_16_pointer = parasail_extend_scan_avx512_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_scan_16_pointer = parasail_extend_scan_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_scan_16_pointer = parasail_extend_scan_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_scan_16_pointer = parasail_extend_scan_sse2_128_16;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_scan_16_pointer = parasail_extend_scan_altivec_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_scan_16_pointer = parasail_extend_scan_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_extend_scan_16_pointer = parasail_extend;
+    }
+    return parasail_extend_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_scan_8_pointer = parasail_extend_scan_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_scan_8_pointer = parasail_extend_scan_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_scan_8_pointer = parasail_extend_scan_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_scan_8_pointer = parasail_extend_scan_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_scan_8_pointer = parasail_extend_scan_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_scan_8_pointer = parasail_extend_scan_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_extend_scan_8_pointer = parasail_extend;
+    }
+    return parasail_extend_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_64_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_striped_64_pointer = parasail_extend_striped_avx512_512_64;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_striped_64_pointer = parasail_extend_striped_avx2_256_64;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_striped_64_pointer = parasail_extend_striped_sse41_128_64;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_striped_64_pointer = parasail_extend_striped_sse2_128_64;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_striped_64_pointer = parasail_extend_striped_altivec_128_64;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_striped_64_pointer = parasail_extend_striped_neon_128_64;
+    }
+    else
+#endif
+    {
+        parasail_extend_striped_64_pointer = parasail_extend;
+    }
+    return parasail_extend_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_striped_32_pointer = parasail_extend_striped_avx512_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_striped_32_pointer = parasail_extend_striped_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_striped_32_pointer = parasail_extend_striped_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_striped_32_pointer = parasail_extend_striped_sse2_128_32;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_striped_32_pointer = parasail_extend_striped_altivec_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_striped_32_pointer = parasail_extend_striped_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_extend_striped_32_pointer = parasail_extend;
+    }
+    return parasail_extend_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_striped_16_pointer = parasail_extend_striped_avx512_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_striped_16_pointer = parasail_extend_striped_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_striped_16_pointer = parasail_extend_striped_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_striped_16_pointer = parasail_extend_striped_sse2_128_16;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_striped_16_pointer = parasail_extend_striped_altivec_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_striped_16_pointer = parasail_extend_striped_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_extend_striped_16_pointer = parasail_extend;
+    }
+    return parasail_extend_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_striped_8_pointer = parasail_extend_striped_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_striped_8_pointer = parasail_extend_striped_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_striped_8_pointer = parasail_extend_striped_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_striped_8_pointer = parasail_extend_striped_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_striped_8_pointer = parasail_extend_striped_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_striped_8_pointer = parasail_extend_striped_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_extend_striped_8_pointer = parasail_extend;
+    }
+    return parasail_extend_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_profile_64_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_scan_profile_64_pointer = parasail_extend_scan_profile_avx512_512_64;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_scan_profile_64_pointer = parasail_extend_scan_profile_avx2_256_64;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_scan_profile_64_pointer = parasail_extend_scan_profile_sse41_128_64;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_scan_profile_64_pointer = parasail_extend_scan_profile_sse2_128_64;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_scan_profile_64_pointer = parasail_extend_scan_profile_altivec_128_64;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_scan_profile_64_pointer = parasail_extend_scan_profile_neon_128_64;
+    }
+    else
+#endif
+    {
+        parasail_extend_scan_profile_64_pointer = NULL;
+    }
+    return parasail_extend_scan_profile_64_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_scan_profile_32_pointer = parasail_extend_scan_profile_avx512_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_scan_profile_32_pointer = parasail_extend_scan_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_scan_profile_32_pointer = parasail_extend_scan_profile_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_scan_profile_32_pointer = parasail_extend_scan_profile_sse2_128_32;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_scan_profile_32_pointer = parasail_extend_scan_profile_altivec_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_scan_profile_32_pointer = parasail_extend_scan_profile_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_extend_scan_profile_32_pointer = NULL;
+    }
+    return parasail_extend_scan_profile_32_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_scan_profile_16_pointer = parasail_extend_scan_profile_avx512_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_scan_profile_16_pointer = parasail_extend_scan_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_scan_profile_16_pointer = parasail_extend_scan_profile_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_scan_profile_16_pointer = parasail_extend_scan_profile_sse2_128_16;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_scan_profile_16_pointer = parasail_extend_scan_profile_altivec_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_scan_profile_16_pointer = parasail_extend_scan_profile_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_extend_scan_profile_16_pointer = NULL;
+    }
+    return parasail_extend_scan_profile_16_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_profile_8_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_scan_profile_8_pointer = parasail_extend_scan_profile_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_scan_profile_8_pointer = parasail_extend_scan_profile_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_scan_profile_8_pointer = parasail_extend_scan_profile_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_scan_profile_8_pointer = parasail_extend_scan_profile_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_scan_profile_8_pointer = parasail_extend_scan_profile_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_scan_profile_8_pointer = parasail_extend_scan_profile_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_extend_scan_profile_8_pointer = NULL;
+    }
+    return parasail_extend_scan_profile_8_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_profile_64_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_striped_profile_64_pointer = parasail_extend_striped_profile_avx512_512_64;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_striped_profile_64_pointer = parasail_extend_striped_profile_avx2_256_64;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_striped_profile_64_pointer = parasail_extend_striped_profile_sse41_128_64;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_striped_profile_64_pointer = parasail_extend_striped_profile_sse2_128_64;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_striped_profile_64_pointer = parasail_extend_striped_profile_altivec_128_64;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_striped_profile_64_pointer = parasail_extend_striped_profile_neon_128_64;
+    }
+    else
+#endif
+    {
+        parasail_extend_striped_profile_64_pointer = NULL;
+    }
+    return parasail_extend_striped_profile_64_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_striped_profile_32_pointer = parasail_extend_striped_profile_avx512_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_striped_profile_32_pointer = parasail_extend_striped_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_striped_profile_32_pointer = parasail_extend_striped_profile_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_striped_profile_32_pointer = parasail_extend_striped_profile_sse2_128_32;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_striped_profile_32_pointer = parasail_extend_striped_profile_altivec_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_striped_profile_32_pointer = parasail_extend_striped_profile_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_extend_striped_profile_32_pointer = NULL;
+    }
+    return parasail_extend_striped_profile_32_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_striped_profile_16_pointer = parasail_extend_striped_profile_avx512_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_striped_profile_16_pointer = parasail_extend_striped_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_striped_profile_16_pointer = parasail_extend_striped_profile_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_striped_profile_16_pointer = parasail_extend_striped_profile_sse2_128_16;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_striped_profile_16_pointer = parasail_extend_striped_profile_altivec_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_striped_profile_16_pointer = parasail_extend_striped_profile_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_extend_striped_profile_16_pointer = NULL;
+    }
+    return parasail_extend_striped_profile_16_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_profile_8_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_extend_striped_profile_8_pointer = parasail_extend_striped_profile_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_extend_striped_profile_8_pointer = parasail_extend_striped_profile_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_extend_striped_profile_8_pointer = parasail_extend_striped_profile_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_extend_striped_profile_8_pointer = parasail_extend_striped_profile_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_extend_striped_profile_8_pointer = parasail_extend_striped_profile_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_extend_striped_profile_8_pointer = parasail_extend_striped_profile_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_extend_striped_profile_8_pointer = NULL;
+    }
+    return parasail_extend_striped_profile_8_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+/* implementation which simply calls the pointer,
+ * first time it's the dispatcher, otherwise it's correct impl */
+
+parasail_result_t* parasail_extend_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    return parasail_extend_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    return parasail_extend_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    return parasail_extend_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    return parasail_extend_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    return parasail_extend_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    return parasail_extend_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    return parasail_extend_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    return parasail_extend_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_materialize(profile, 64);
+    return parasail_extend_scan_profile_64_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_materialize(profile, 32);
+    return parasail_extend_scan_profile_32_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_materialize(profile, 16);
+    return parasail_extend_scan_profile_16_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_materialize(profile, 8);
+    return parasail_extend_scan_profile_8_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_materialize(profile, 64);
+    return parasail_extend_striped_profile_64_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_materialize(profile, 32);
+    return parasail_extend_striped_profile_32_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_materialize(profile, 16);
+    return parasail_extend_striped_profile_16_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
+parasail_result_t* parasail_extend_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_materialize(profile, 8);
+    return parasail_extend_striped_profile_8_pointer(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+}
+
@@ -0,0 +1,345 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_altivec.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+#define MAX(a,b) ((a)>(b)?(a):(b))
+
+
+#define FNAME parasail_extend_scan_altivec_128_32
+#define PNAME parasail_extend_scan_profile_altivec_128_32
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_t *profile = parasail_profile_create_altivec_128_32(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+    parasail_profile_free(profile);
+    return result;
+}
+
+/* first query row of a striped column holding value */
+static inline int32_t first_row(
+        const vec128i * const restrict pv,
+        const int32_t segLen,
+        const int32_t s1Len,
+        const int32_t value)
+{
+    const int32_t *t = (const int32_t*)pv;
+    const int32_t column_len = segLen * 4;
+    int32_t row = s1Len;
+    int32_t i = 0;
+    for (i=0; i<column_len; ++i, ++t) {
+        if (*t == value) {
+            int32_t temp = i / 4 + i % 4 * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = -1;
+    int32_t end_ref = -1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 4; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    /* position of the last query row within a column */
+    const int32_t last = (s1Len - 1) % segLen * segWidth + (s1Len - 1) / segLen;
+    vec128i* const restrict pvP = (vec128i*)profile->profile32.score;
+    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
+    int32_t* const restrict boundary = parasail_memalign_int32_t(16, s2Len+1);
+    vec128i* const restrict pvHt= parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvH = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvHMax = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvGapper = parasail_memalign_vec128i(16, segLen);
+    vec128i vGapO = _mm_set1_epi32(open);
+    vec128i vGapE = _mm_set1_epi32(gap);
+    /* cut cells are set to NEG_LIMIT; anything derived from one stays
+     * below NEG_LIMIT + matrix->max without wrapping */
+    const int32_t NEG_LIMIT = NEG_INF + MAX(open + gap, -matrix->min) + 1;
+    const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
+    vec128i vZero = _mm_setzero_si128();
+    vec128i vNegLimit = _mm_set1_epi32(NEG_LIMIT);
+    vec128i vNegInfFront = vZero;
+    vec128i vSegLenXgap;
+    int score = 0;
+    int query_end_score = 0;
+    int query_end_ref = -1;
+    int stop = PARASAIL_EXTEND_END;
+    int saturated = 0;
+    parasail_result_t *result = parasail_result_new();
+
+    /* the cut must stay above every value derived from a cut cell, and
+     * without a cut the boundary has to be exact */
+    if (xdrop >= 0) {
+        saturated = -(int64_t)xdrop <= (int64_t)NEG_LIMIT + matrix->max;
+    }
+    else {
+        saturated = -2*(int64_t)open
+            - (int64_t)gap*MAX(s1Len, s2Len) < (int64_t)NEG_LIMIT;
+    }
+
+    vNegInfFront = _mm_insert_epi32(vNegInfFront, NEG_LIMIT, 0);
+    {
+        int64_t tmp = -(int64_t)segLen*gap;
+        vSegLenXgap = _mm_add_epi32(vNegInfFront,
+                _mm_slli_si128(_mm_set1_epi32(tmp < NEG_INF ? NEG_INF : tmp), 4));
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            vec128i_32_t h;
+            vec128i_32_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+            }
+            _mm_store_si128(&pvH[index], h.m);
+            _mm_store_si128(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+        }
+    }
+
+    {
+        vec128i vGapper = _mm_sub_epi32(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm_store_si128(pvGapper+i, vGapper);
+            vGapper = _mm_sub_epi32(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len && !saturated; ++j) {
+        vec128i vE;
+        vec128i vHt;
+        vec128i vF;
+        vec128i vH;
+        vec128i vHp;
+        vec128i *pvW;
+        vec128i vW;
+        vec128i vMax = vNegLimit;
+        vec128i vMin = vNegLimit;
+        int32_t max = 0;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm_load_si128(pvH+(segLen-1));
+        vHp = _mm_slli_si128(vHp, 4);
+        vHp = _mm_insert_epi32(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm_sub_epi32(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm_load_si128(pvH+i);
+            vE = _mm_load_si128(pvE+i);
+            vW = _mm_load_si128(pvW+i);
+            vE = _mm_max_epi32(
+                    _mm_sub_epi32(vE, vGapE),
+                    _mm_sub_epi32(vH, vGapO));
+            vHp = _mm_add_epi32(vHp, vW);
+            vF = _mm_max_epi32(vF, _mm_add_epi32(vHt, pvGapper[i]));
+            vHt = _mm_max_epi32(vE, vHp);
+            _mm_store_si128(pvE+i, vE);
+            _mm_store_si128(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm_slli_si128(vHt, 4);
+        vHt = _mm_insert_epi32(vHt, boundary[j+1], 0);
+        vF = _mm_max_epi32(vF, _mm_add_epi32(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            vec128i vFt = _mm_slli_si128(vF, 4);
+            vFt = _mm_add_epi32(vFt, vSegLenXgap);
+            vF = _mm_max_epi32(vF, vFt);
+        }
+
+        /* calculate final H */
+        vF = _mm_slli_si128(vF, 4);
+        vF = _mm_add_epi32(vF, vNegInfFront);
+        vH = _mm_max_epi32(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            vHt = _mm_load_si128(pvHt+i);
+            vF = _mm_max_epi32(
+                    _mm_sub_epi32(vF, vGapE),
+                    _mm_sub_epi32(vH, vGapO));
+            vH = _mm_max_epi32(vHt, vF);
+            _mm_store_si128(pvH+i, vH);
+        }
+
+        /* the padding rows past the end of s1 never reach a real row,
+         * keep them out of the column maximum */
+        {
+            int32_t *t = (int32_t*)pvH;
+            for (k=s1Len; k<segLen*segWidth; ++k) {
+                t[k % segLen * segWidth + k / segLen] = NEG_LIMIT;
+            }
+        }
+
+        /* column maximum */
+        for (i=0; i<segLen; ++i) {
+            vH = _mm_load_si128(pvH + i);
+            vMax = _mm_max_epi32(vMax, vH);
+            vMin = _mm_min_epi32(vMin, vH);
+        }
+        max = _mm_hmax_epi32(vMax);
+        if (max > POS_LIMIT || (xdrop < 0
+                    && _mm_movemask_epi8(_mm_cmplt_epi32(vMin, vNegLimit)))) {
+            saturated = 1;
+            break;
+        }
+
+        if (max > score) {
+            score = max;
+            end_query = -1;
+            end_ref = j;
+            memcpy(pvHMax, pvH, sizeof(vec128i)*segLen);
+        }
+        if (xdrop >= 0 && max < score - xdrop) {
+            stop = PARASAIL_EXTEND_XDROP;
+            ++j;
+            break;
+        }
+        if (zdrop >= 0 && score - max > zdrop) {
+            int32_t diagonal = 0;
+            if (end_query < 0) {
+                end_query = first_row(pvHMax, segLen, s1Len, score);
+            }
+            diagonal = (j - end_ref)
+                - (first_row(pvH, segLen, s1Len, max) - end_query);
+            if (diagonal < 0) {
+                diagonal = -diagonal;
+            }
+            if (score - max > zdrop + gap*diagonal) {
+                stop = PARASAIL_EXTEND_ZDROP;
+                ++j;
+                break;
+            }
+        }
+
+        /* cut the cells that can no longer come within xdrop */
+        if (xdrop >= 0) {
+            vec128i vCut = _mm_set1_epi32(score - xdrop);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm_load_si128(pvH + i);
+                vH = _mm_blendv_epi8(vH, vNegLimit, _mm_cmplt_epi32(vH, vCut));
+                _mm_store_si128(pvH + i, vH);
+            }
+        }
+
+        {
+            int32_t h = ((int32_t*)pvH)[last];
+            if ((xdrop < 0 || h >= score - xdrop)
+                    && (query_end_ref < 0 || h > query_end_score)) {
+                query_end_score = h;
+                query_end_ref = j;
+            }
+        }
+    }
+
+    if (end_ref >= 0 && end_query < 0) {
+        end_query = first_row(pvHMax, segLen, s1Len, score);
+    }
+
+    if (NULL != extension) {
+        extension->query_end_score = query_end_score;
+        extension->query_end_ref = query_end_ref;
+        extension->ref_end_score = 0;
+        extension->ref_end_query = -1;
+        extension->ref_scanned = j;
+        extension->stop = stop;
+        if (PARASAIL_EXTEND_END == stop && !saturated) {
+            /* the last column is cut, so any cell left in it is alive */
+            vec128i vMax = vNegLimit;
+            int32_t max = 0;
+            for (i=0; i<segLen; ++i) {
+                vMax = _mm_max_epi32(vMax, _mm_load_si128(pvH + i));
+            }
+            max = _mm_hmax_epi32(vMax);
+            if (xdrop < 0 || max > NEG_LIMIT) {
+                extension->ref_end_score = max;
+                extension->ref_end_query = first_row(pvH, segLen, s1Len, max);
+            }
+        }
+    }
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+        if (NULL != extension) {
+            extension->query_end_score = 0;
+            extension->query_end_ref = -1;
+            extension->ref_end_score = 0;
+            extension->ref_end_query = -1;
+            extension->ref_scanned = 0;
+            extension->stop = PARASAIL_EXTEND_END;
+        }
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_END | PARASAIL_FLAG_SG_S2_END
+        | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_4;
+
+    parasail_free(pvGapper);
+    parasail_free(pvHMax);
+    parasail_free(pvH);
+    parasail_free(pvHt);
+    parasail_free(boundary);
+    parasail_free(pvE);
+
+    return result;
+}
+
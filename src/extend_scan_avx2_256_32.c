@@ -0,0 +1,377 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+#define MAX(a,b) ((a)>(b)?(a):(b))
+
+#if HAVE_AVX2_MM256_EXTRACT_EPI32
+#define _mm256_extract_epi32_rpl _mm256_extract_epi32
+#else
+static inline int32_t _mm256_extract_epi32_rpl(__m256i a, int imm) {
+    __m256i_32_t A;
+    A.m = a;
+    return A.v[imm];
+}
+#endif
+
+#if HAVE_AVX2_MM256_INSERT_EPI32
+#define _mm256_insert_epi32_rpl _mm256_insert_epi32
+#else
+static inline __m256i _mm256_insert_epi32_rpl(__m256i a, int32_t i, int imm) {
+    __m256i_32_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+#endif
+
+#define _mm256_cmplt_epi32_rpl(a,b) _mm256_cmpgt_epi32(b,a)
+
+#define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+
+static inline int32_t _mm256_hmax_epi32_rpl(__m256i a) {
+    a = _mm256_max_epi32(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,0,0)));
+    a = _mm256_max_epi32(a, _mm256_slli_si256(a, 8));
+    a = _mm256_max_epi32(a, _mm256_slli_si256(a, 4));
+    return _mm256_extract_epi32_rpl(a, 7);
+}
+
+
+#define FNAME parasail_extend_scan_avx2_256_32
+#define PNAME parasail_extend_scan_profile_avx2_256_32
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx_256_32(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+    parasail_profile_free(profile);
+    return result;
+}
+
+/* first query row of a striped column holding value */
+static inline int32_t first_row(
+        const __m256i * const restrict pv,
+        const int32_t segLen,
+        const int32_t s1Len,
+        const int32_t value)
+{
+    const int32_t *t = (const int32_t*)pv;
+    const int32_t column_len = segLen * 8;
+    int32_t row = s1Len;
+    int32_t i = 0;
+    for (i=0; i<column_len; ++i, ++t) {
+        if (*t == value) {
+            int32_t temp = i / 8 + i % 8 * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = -1;
+    int32_t end_ref = -1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    /* position of the last query row within a column */
+    const int32_t last = (s1Len - 1) % segLen * segWidth + (s1Len - 1) / segLen;
+    __m256i* const restrict pvP = (__m256i*)profile->profile32.score;
+    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
+    int32_t* const restrict boundary = parasail_memalign_int32_t(32, s2Len+1);
+    __m256i* const restrict pvHt= parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvH = parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvHMax = parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvGapper = parasail_memalign___m256i(32, segLen);
+    __m256i vGapO = _mm256_set1_epi32(open);
+    __m256i vGapE = _mm256_set1_epi32(gap);
+    /* cut cells are set to NEG_LIMIT; anything derived from one stays
+     * below NEG_LIMIT + matrix->max without wrapping */
+    const int32_t NEG_LIMIT = NEG_INF + MAX(open + gap, -matrix->min) + 1;
+    const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
+    __m256i vZero = _mm256_setzero_si256();
+    __m256i vNegLimit = _mm256_set1_epi32(NEG_LIMIT);
+    __m256i vNegInfFront = vZero;
+    __m256i vSegLenXgap;
+    int score = 0;
+    int query_end_score = 0;
+    int query_end_ref = -1;
+    int stop = PARASAIL_EXTEND_END;
+    int saturated = 0;
+    parasail_result_t *result = parasail_result_new();
+
+    /* the cut must stay above every value derived from a cut cell, and
+     * without a cut the boundary has to be exact */
+    if (xdrop >= 0) {
+        saturated = -(int64_t)xdrop <= (int64_t)NEG_LIMIT + matrix->max;
+    }
+    else {
+        saturated = -2*(int64_t)open
+            - (int64_t)gap*MAX(s1Len, s2Len) < (int64_t)NEG_LIMIT;
+    }
+
+    vNegInfFront = _mm256_insert_epi32_rpl(vNegInfFront, NEG_LIMIT, 0);
+    {
+        int64_t tmp = -(int64_t)segLen*gap;
+        vSegLenXgap = _mm256_add_epi32(vNegInfFront,
+                _mm256_slli_si256_rpl(_mm256_set1_epi32(tmp < NEG_INF ? NEG_INF : tmp), 4));
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m256i_32_t h;
+            __m256i_32_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+            }
+            _mm256_store_si256(&pvH[index], h.m);
+            _mm256_store_si256(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+        }
+    }
+
+    {
+        __m256i vGapper = _mm256_sub_epi32(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm256_store_si256(pvGapper+i, vGapper);
+            vGapper = _mm256_sub_epi32(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len && !saturated; ++j) {
+        __m256i vE;
+        __m256i vHt;
+        __m256i vF;
+        __m256i vH;
+        __m256i vHp;
+        __m256i *pvW;
+        __m256i vW;
+        __m256i vMax = vNegLimit;
+        __m256i vMin = vNegLimit;
+        int32_t max = 0;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm256_load_si256(pvH+(segLen-1));
+        vHp = _mm256_slli_si256_rpl(vHp, 4);
+        vHp = _mm256_insert_epi32_rpl(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm256_sub_epi32(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm256_load_si256(pvH+i);
+            vE = _mm256_load_si256(pvE+i);
+            vW = _mm256_load_si256(pvW+i);
+            vE = _mm256_max_epi32(
+                    _mm256_sub_epi32(vE, vGapE),
+                    _mm256_sub_epi32(vH, vGapO));
+            vHp = _mm256_add_epi32(vHp, vW);
+            vF = _mm256_max_epi32(vF, _mm256_add_epi32(vHt, pvGapper[i]));
+            vHt = _mm256_max_epi32(vE, vHp);
+            _mm256_store_si256(pvE+i, vE);
+            _mm256_store_si256(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm256_slli_si256_rpl(vHt, 4);
+        vHt = _mm256_insert_epi32_rpl(vHt, boundary[j+1], 0);
+        vF = _mm256_max_epi32(vF, _mm256_add_epi32(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            __m256i vFt = _mm256_slli_si256_rpl(vF, 4);
+            vFt = _mm256_add_epi32(vFt, vSegLenXgap);
+            vF = _mm256_max_epi32(vF, vFt);
+        }
+
+        /* calculate final H */
+        vF = _mm256_slli_si256_rpl(vF, 4);
+        vF = _mm256_add_epi32(vF, vNegInfFront);
+        vH = _mm256_max_epi32(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            vHt = _mm256_load_si256(pvHt+i);
+            vF = _mm256_max_epi32(
+                    _mm256_sub_epi32(vF, vGapE),
+                    _mm256_sub_epi32(vH, vGapO));
+            vH = _mm256_max_epi32(vHt, vF);
+            _mm256_store_si256(pvH+i, vH);
+        }
+
+        /* the padding rows past the end of s1 never reach a real row,
+         * keep them out of the column maximum */
+        {
+            int32_t *t = (int32_t*)pvH;
+            for (k=s1Len; k<segLen*segWidth; ++k) {
+                t[k % segLen * segWidth + k / segLen] = NEG_LIMIT;
+            }
+        }
+
+        /* column maximum */
+        for (i=0; i<segLen; ++i) {
+            vH = _mm256_load_si256(pvH + i);
+            vMax = _mm256_max_epi32(vMax, vH);
+            vMin = _mm256_min_epi32(vMin, vH);
+        }
+        max = _mm256_hmax_epi32_rpl(vMax);
+        if (max > POS_LIMIT || (xdrop < 0
+                    && _mm256_movemask_epi8(_mm256_cmplt_epi32_rpl(vMin, vNegLimit)))) {
+            saturated = 1;
+            break;
+        }
+
+        if (max > score) {
+            score = max;
+            end_query = -1;
+            end_ref = j;
+            memcpy(pvHMax, pvH, sizeof(__m256i)*segLen);
+        }
+        if (xdrop >= 0 && max < score - xdrop) {
+            stop = PARASAIL_EXTEND_XDROP;
+            ++j;
+            break;
+        }
+        if (zdrop >= 0 && score - max > zdrop) {
+            int32_t diagonal = 0;
+            if (end_query < 0) {
+                end_query = first_row(pvHMax, segLen, s1Len, score);
+            }
+            diagonal = (j - end_ref)
+                - (first_row(pvH, segLen, s1Len, max) - end_query);
+            if (diagonal < 0) {
+                diagonal = -diagonal;
+            }
+            if (score - max > zdrop + gap*diagonal) {
+                stop = PARASAIL_EXTEND_ZDROP;
+                ++j;
+                break;
+            }
+        }
+
+        /* cut the cells that can no longer come within xdrop */
+        if (xdrop >= 0) {
+            __m256i vCut = _mm256_set1_epi32(score - xdrop);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm256_load_si256(pvH + i);
+                vH = _mm256_blendv_epi8(vH, vNegLimit, _mm256_cmplt_epi32_rpl(vH, vCut));
+                _mm256_store_si256(pvH + i, vH);
+            }
+        }
+
+        {
+            int32_t h = ((int32_t*)pvH)[last];
+            if ((xdrop < 0 || h >= score - xdrop)
+                    && (query_end_ref < 0 || h > query_end_score)) {
+                query_end_score = h;
+                query_end_ref = j;
+            }
+        }
+    }
+
+    if (end_ref >= 0 && end_query < 0) {
+        end_query = first_row(pvHMax, segLen, s1Len, score);
+    }
+
+    if (NULL != extension) {
+        extension->query_end_score = query_end_score;
+        extension->query_end_ref = query_end_ref;
+        extension->ref_end_score = 0;
+        extension->ref_end_query = -1;
+        extension->ref_scanned = j;
+        extension->stop = stop;
+        if (PARASAIL_EXTEND_END == stop && !saturated) {
+            /* the last column is cut, so any cell left in it is alive */
+            __m256i vMax = vNegLimit;
+            int32_t max = 0;
+            for (i=0; i<segLen; ++i) {
+                vMax = _mm256_max_epi32(vMax, _mm256_load_si256(pvH + i));
+            }
+            max = _mm256_hmax_epi32_rpl(vMax);
+            if (xdrop < 0 || max > NEG_LIMIT) {
+                extension->ref_end_score = max;
+                extension->ref_end_query = first_row(pvH, segLen, s1Len, max);
+            }
+        }
+    }
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+        if (NULL != extension) {
+            extension->query_end_score = 0;
+            extension->query_end_ref = -1;
+            extension->ref_end_score = 0;
+            extension->ref_end_query = -1;
+            extension->ref_scanned = 0;
+            extension->stop = PARASAIL_EXTEND_END;
+        }
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_END | PARASAIL_FLAG_SG_S2_END
+        | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_8;
+
+    parasail_free(pvGapper);
+    parasail_free(pvHMax);
+    parasail_free(pvH);
+    parasail_free(pvHt);
+    parasail_free(boundary);
+    parasail_free(pvE);
+
+    return result;
+}
+
@@ -0,0 +1,345 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_neon.h"
+
+#define NEG_INF (INT64_MIN/(int64_t)(2))
+#define MAX(a,b) ((a)>(b)?(a):(b))
+
+
+#define FNAME parasail_extend_scan_neon_128_64
+#define PNAME parasail_extend_scan_profile_neon_128_64
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_t *profile = parasail_profile_create_neon_128_64(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+    parasail_profile_free(profile);
+    return result;
+}
+
+/* first query row of a striped column holding value */
+static inline int32_t first_row(
+        const simde__m128i * const restrict pv,
+        const int32_t segLen,
+        const int32_t s1Len,
+        const int64_t value)
+{
+    const int64_t *t = (const int64_t*)pv;
+    const int32_t column_len = segLen * 2;
+    int32_t row = s1Len;
+    int32_t i = 0;
+    for (i=0; i<column_len; ++i, ++t) {
+        if (*t == value) {
+            int32_t temp = i / 2 + i % 2 * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = -1;
+    int32_t end_ref = -1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 2; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    /* position of the last query row within a column */
+    const int32_t last = (s1Len - 1) % segLen * segWidth + (s1Len - 1) / segLen;
+    simde__m128i* const restrict pvP = (simde__m128i*)profile->profile64.score;
+    simde__m128i* const restrict pvE = parasail_memalign_simde__m128i(16, segLen);
+    int64_t* const restrict boundary = parasail_memalign_int64_t(16, s2Len+1);
+    simde__m128i* const restrict pvHt= parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* const restrict pvH = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* const restrict pvHMax = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* const restrict pvGapper = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i vGapO = simde_mm_set1_epi64x(open);
+    simde__m128i vGapE = simde_mm_set1_epi64x(gap);
+    /* cut cells are set to NEG_LIMIT; anything derived from one stays
+     * below NEG_LIMIT + matrix->max without wrapping */
+    const int64_t NEG_LIMIT = NEG_INF + MAX(open + gap, -matrix->min) + 1;
+    const int64_t POS_LIMIT = INT64_MAX - matrix->max - 1;
+    simde__m128i vZero = simde_mm_setzero_si128();
+    simde__m128i vNegLimit = simde_mm_set1_epi64x(NEG_LIMIT);
+    simde__m128i vNegInfFront = vZero;
+    simde__m128i vSegLenXgap;
+    int score = 0;
+    int query_end_score = 0;
+    int query_end_ref = -1;
+    int stop = PARASAIL_EXTEND_END;
+    int saturated = 0;
+    parasail_result_t *result = parasail_result_new();
+
+    /* the cut must stay above every value derived from a cut cell, and
+     * without a cut the boundary has to be exact */
+    if (xdrop >= 0) {
+        saturated = -(int64_t)xdrop <= (int64_t)NEG_LIMIT + matrix->max;
+    }
+    else {
+        saturated = -2*(int64_t)open
+            - (int64_t)gap*MAX(s1Len, s2Len) < (int64_t)NEG_LIMIT;
+    }
+
+    vNegInfFront = simde_mm_insert_epi64(vNegInfFront, NEG_LIMIT, 0);
+    {
+        int64_t tmp = -(int64_t)segLen*gap;
+        vSegLenXgap = simde_mm_add_epi64(vNegInfFront,
+                simde_mm_slli_si128(simde_mm_set1_epi64x(tmp < NEG_INF ? NEG_INF : tmp), 8));
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            simde__m128i h;
+            simde__m128i e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.i64[segNum] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+                tmp = tmp - open;
+                e.i64[segNum] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+            }
+            simde_mm_store_si128(&pvH[index], h);
+            simde_mm_store_si128(&pvE[index], e);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+        }
+    }
+
+    {
+        simde__m128i vGapper = simde_mm_sub_epi64(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            simde_mm_store_si128(pvGapper+i, vGapper);
+            vGapper = simde_mm_sub_epi64(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len && !saturated; ++j) {
+        simde__m128i vE;
+        simde__m128i vHt;
+        simde__m128i vF;
+        simde__m128i vH;
+        simde__m128i vHp;
+        simde__m128i *pvW;
+        simde__m128i vW;
+        simde__m128i vMax = vNegLimit;
+        simde__m128i vMin = vNegLimit;
+        int64_t max = 0;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = simde_mm_load_si128(pvH+(segLen-1));
+        vHp = simde_mm_slli_si128(vHp, 8);
+        vHp = simde_mm_insert_epi64(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = simde_mm_sub_epi64(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = simde_mm_load_si128(pvH+i);
+            vE = simde_mm_load_si128(pvE+i);
+            vW = simde_mm_load_si128(pvW+i);
+            vE = simde_mm_max_epi64(
+                    simde_mm_sub_epi64(vE, vGapE),
+                    simde_mm_sub_epi64(vH, vGapO));
+            vHp = simde_mm_add_epi64(vHp, vW);
+            vF = simde_mm_max_epi64(vF, simde_mm_add_epi64(vHt, pvGapper[i]));
+            vHt = simde_mm_max_epi64(vE, vHp);
+            simde_mm_store_si128(pvE+i, vE);
+            simde_mm_store_si128(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = simde_mm_slli_si128(vHt, 8);
+        vHt = simde_mm_insert_epi64(vHt, boundary[j+1], 0);
+        vF = simde_mm_max_epi64(vF, simde_mm_add_epi64(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            simde__m128i vFt = simde_mm_slli_si128(vF, 8);
+            vFt = simde_mm_add_epi64(vFt, vSegLenXgap);
+            vF = simde_mm_max_epi64(vF, vFt);
+        }
+
+        /* calculate final H */
+        vF = simde_mm_slli_si128(vF, 8);
+        vF = simde_mm_add_epi64(vF, vNegInfFront);
+        vH = simde_mm_max_epi64(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            vHt = simde_mm_load_si128(pvHt+i);
+            vF = simde_mm_max_epi64(
+                    simde_mm_sub_epi64(vF, vGapE),
+                    simde_mm_sub_epi64(vH, vGapO));
+            vH = simde_mm_max_epi64(vHt, vF);
+            simde_mm_store_si128(pvH+i, vH);
+        }
+
+        /* the padding rows past the end of s1 never reach a real row,
+         * keep them out of the column maximum */
+        {
+            int64_t *t = (int64_t*)pvH;
+            for (k=s1Len; k<segLen*segWidth; ++k) {
+                t[k % segLen * segWidth + k / segLen] = NEG_LIMIT;
+            }
+        }
+
+        /* column maximum */
+        for (i=0; i<segLen; ++i) {
+            vH = simde_mm_load_si128(pvH + i);
+            vMax = simde_mm_max_epi64(vMax, vH);
+            vMin = simde_mm_min_epi64(vMin, vH);
+        }
+        max = simde_mm_hmax_epi64(vMax);
+        if (max > POS_LIMIT || (xdrop < 0
+                    && simde_mm_movemask_epi8(simde_mm_cmplt_epi64(vMin, vNegLimit)))) {
+            saturated = 1;
+            break;
+        }
+
+        if (max > score) {
+            score = max;
+            end_query = -1;
+            end_ref = j;
+            memcpy(pvHMax, pvH, sizeof(simde__m128i)*segLen);
+        }
+        if (xdrop >= 0 && max < score - xdrop) {
+            stop = PARASAIL_EXTEND_XDROP;
+            ++j;
+            break;
+        }
+        if (zdrop >= 0 && score - max > zdrop) {
+            int32_t diagonal = 0;
+            if (end_query < 0) {
+                end_query = first_row(pvHMax, segLen, s1Len, score);
+            }
+            diagonal = (j - end_ref)
+                - (first_row(pvH, segLen, s1Len, max) - end_query);
+            if (diagonal < 0) {
+                diagonal = -diagonal;
+            }
+            if (score - max > zdrop + gap*diagonal) {
+                stop = PARASAIL_EXTEND_ZDROP;
+                ++j;
+                break;
+            }
+        }
+
+        /* cut the cells that can no longer come within xdrop */
+        if (xdrop >= 0) {
+            simde__m128i vCut = simde_mm_set1_epi64x(score - xdrop);
+            for (i=0; i<segLen; ++i) {
+                vH = simde_mm_load_si128(pvH + i);
+                vH = simde_mm_blendv_epi8(vH, vNegLimit, simde_mm_cmplt_epi64(vH, vCut));
+                simde_mm_store_si128(pvH + i, vH);
+            }
+        }
+
+        {
+            int64_t h = ((int64_t*)pvH)[last];
+            if ((xdrop < 0 || h >= score - xdrop)
+                    && (query_end_ref < 0 || h > query_end_score)) {
+                query_end_score = h;
+                query_end_ref = j;
+            }
+        }
+    }
+
+    if (end_ref >= 0 && end_query < 0) {
+        end_query = first_row(pvHMax, segLen, s1Len, score);
+    }
+
+    if (NULL != extension) {
+        extension->query_end_score = query_end_score;
+        extension->query_end_ref = query_end_ref;
+        extension->ref_end_score = 0;
+        extension->ref_end_query = -1;
+        extension->ref_scanned = j;
+        extension->stop = stop;
+        if (PARASAIL_EXTEND_END == stop && !saturated) {
+            /* the last column is cut, so any cell left in it is alive */
+            simde__m128i vMax = vNegLimit;
+            int64_t max = 0;
+            for (i=0; i<segLen; ++i) {
+                vMax = simde_mm_max_epi64(vMax, simde_mm_load_si128(pvH + i));
+            }
+            max = simde_mm_hmax_epi64(vMax);
+            if (xdrop < 0 || max > NEG_LIMIT) {
+                extension->ref_end_score = max;
+                extension->ref_end_query = first_row(pvH, segLen, s1Len, max);
+            }
+        }
+    }
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+        if (NULL != extension) {
+            extension->query_end_score = 0;
+            extension->query_end_ref = -1;
+            extension->ref_end_score = 0;
+            extension->ref_end_query = -1;
+            extension->ref_scanned = 0;
+            extension->stop = PARASAIL_EXTEND_END;
+        }
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_END | PARASAIL_FLAG_SG_S2_END
+        | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_BITS_64 | PARASAIL_FLAG_LANES_2;
+
+    parasail_free(pvGapper);
+    parasail_free(pvHMax);
+    parasail_free(pvH);
+    parasail_free(pvHt);
+    parasail_free(boundary);
+    parasail_free(pvE);
+
+    return result;
+}
+
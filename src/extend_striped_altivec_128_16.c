@@ -0,0 +1,335 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_altivec.h"
+
+#define NEG_INF INT16_MIN
+#define MAX(a,b) ((a)>(b)?(a):(b))
+
+
+#define FNAME parasail_extend_striped_altivec_128_16
+#define PNAME parasail_extend_striped_profile_altivec_128_16
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_t *profile = parasail_profile_create_altivec_128_16(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+    parasail_profile_free(profile);
+    return result;
+}
+
+/* first query row of a striped column holding value */
+static inline int32_t first_row(
+        const vec128i * const restrict pv,
+        const int32_t segLen,
+        const int32_t s1Len,
+        const int16_t value)
+{
+    const int16_t *t = (const int16_t*)pv;
+    const int32_t column_len = segLen * 8;
+    int32_t row = s1Len;
+    int32_t i = 0;
+    for (i=0; i<column_len; ++i, ++t) {
+        if (*t == value) {
+            int32_t temp = i / 8 + i % 8 * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = -1;
+    int32_t end_ref = -1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    /* position of the last query row within a column */
+    const int32_t last = (s1Len - 1) % segLen * segWidth + (s1Len - 1) / segLen;
+    vec128i* const restrict vProfile = (vec128i*)profile->profile16.score;
+    vec128i* restrict pvHStore = parasail_memalign_vec128i(16, segLen);
+    vec128i* restrict pvHLoad = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvHMax = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
+    int16_t* const restrict boundary = parasail_memalign_int16_t(16, s2Len+1);
+    vec128i vGapO = _mm_set1_epi16(open);
+    vec128i vGapE = _mm_set1_epi16(gap);
+    vec128i vNegInf = _mm_set1_epi16(NEG_INF);
+    /* cut cells are set to NEG_LIMIT; anything derived from one stays
+     * below NEG_LIMIT + matrix->max without wrapping */
+    const int16_t NEG_LIMIT = NEG_INF + MAX(open + gap, -matrix->min) + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    vec128i vNegLimit = _mm_set1_epi16(NEG_LIMIT);
+    int score = 0;
+    int query_end_score = 0;
+    int query_end_ref = -1;
+    int stop = PARASAIL_EXTEND_END;
+    int saturated = 0;
+    parasail_result_t *result = parasail_result_new();
+
+    /* the cut must stay above every value derived from a cut cell, and
+     * without a cut the boundary has to be exact */
+    if (xdrop >= 0) {
+        saturated = -(int64_t)xdrop <= (int64_t)NEG_LIMIT + matrix->max;
+    }
+    else {
+        saturated = -2*(int64_t)open
+            - (int64_t)gap*MAX(s1Len, s2Len) < (int64_t)NEG_LIMIT;
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            vec128i_16_t h;
+            vec128i_16_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+            }
+            _mm_store_si128(&pvHStore[index], h.m);
+            _mm_store_si128(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len && !saturated; ++j) {
+        vec128i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        vec128i vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        vec128i vH = _mm_slli_si128(pvHStore[segLen - 1], 2);
+
+        /* Correct part of the vProfile */
+        const vec128i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+
+        vec128i vMax = vNegLimit;
+        vec128i vMin = vNegLimit;
+        int16_t max = 0;
+
+        /* Swap the 2 H buffers. */
+        vec128i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = _mm_insert_epi16(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = _mm_adds_epi16(vH, _mm_load_si128(vP + i));
+            vE = _mm_load_si128(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm_max_epi16(vH, vE);
+            vH = _mm_max_epi16(vH, vF);
+            /* Save vH values. */
+            _mm_store_si128(pvHStore + i, vH);
+
+            /* Update vE value. */
+            vH = _mm_subs_epi16(vH, vGapO);
+            vE = _mm_subs_epi16(vE, vGapE);
+            vE = _mm_max_epi16(vE, vH);
+            _mm_store_si128(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm_subs_epi16(vF, vGapE);
+            vF = _mm_max_epi16(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm_load_si128(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = _mm_slli_si128(vF, 2);
+            vF = _mm_insert_epi16(vF, boundary[j+1]-open, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm_load_si128(pvHStore + i);
+                vH = _mm_max_epi16(vH,vF);
+                _mm_store_si128(pvHStore + i, vH);
+                vH = _mm_subs_epi16(vH, vGapO);
+                vF = _mm_subs_epi16(vF, vGapE);
+                if (! _mm_movemask_epi8(_mm_cmpgt_epi16(vF, vH))) goto end;
+                /*vF = _mm_max_epi16(vF, vH);*/
+            }
+        }
+end:
+        {
+        }
+
+        /* the padding rows past the end of s1 never reach a real row,
+         * keep them out of the column maximum */
+        {
+            int16_t *t = (int16_t*)pvHStore;
+            for (k=s1Len; k<segLen*segWidth; ++k) {
+                t[k % segLen * segWidth + k / segLen] = NEG_LIMIT;
+            }
+        }
+
+        /* column maximum */
+        for (i=0; i<segLen; ++i) {
+            vH = _mm_load_si128(pvHStore + i);
+            vMax = _mm_max_epi16(vMax, vH);
+            vMin = _mm_min_epi16(vMin, vH);
+        }
+        max = _mm_hmax_epi16(vMax);
+        if (max > POS_LIMIT || (xdrop < 0
+                    && _mm_movemask_epi8(_mm_cmplt_epi16(vMin, vNegLimit)))) {
+            saturated = 1;
+            break;
+        }
+
+        if (max > score) {
+            score = max;
+            end_query = -1;
+            end_ref = j;
+            memcpy(pvHMax, pvHStore, sizeof(vec128i)*segLen);
+        }
+        if (xdrop >= 0 && max < score - xdrop) {
+            stop = PARASAIL_EXTEND_XDROP;
+            ++j;
+            break;
+        }
+        if (zdrop >= 0 && score - max > zdrop) {
+            int32_t diagonal = 0;
+            if (end_query < 0) {
+                end_query = first_row(pvHMax, segLen, s1Len, score);
+            }
+            diagonal = (j - end_ref)
+                - (first_row(pvHStore, segLen, s1Len, max) - end_query);
+            if (diagonal < 0) {
+                diagonal = -diagonal;
+            }
+            if (score - max > zdrop + gap*diagonal) {
+                stop = PARASAIL_EXTEND_ZDROP;
+                ++j;
+                break;
+            }
+        }
+
+        /* cut the cells that can no longer come within xdrop */
+        if (xdrop >= 0) {
+            vec128i vCut = _mm_set1_epi16(score - xdrop);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm_load_si128(pvHStore + i);
+                vH = _mm_blendv_epi8(vH, vNegLimit, _mm_cmplt_epi16(vH, vCut));
+                _mm_store_si128(pvHStore + i, vH);
+            }
+        }
+
+        {
+            int16_t h = ((int16_t*)pvHStore)[last];
+            if ((xdrop < 0 || h >= score - xdrop)
+                    && (query_end_ref < 0 || h > query_end_score)) {
+                query_end_score = h;
+                query_end_ref = j;
+            }
+        }
+    }
+
+    if (end_ref >= 0 && end_query < 0) {
+        end_query = first_row(pvHMax, segLen, s1Len, score);
+    }
+
+    if (NULL != extension) {
+        extension->query_end_score = query_end_score;
+        extension->query_end_ref = query_end_ref;
+        extension->ref_end_score = 0;
+        extension->ref_end_query = -1;
+        extension->ref_scanned = j;
+        extension->stop = stop;
+        if (PARASAIL_EXTEND_END == stop && !saturated) {
+            /* the last column is cut, so any cell left in it is alive */
+            vec128i vMax = vNegLimit;
+            int16_t max = 0;
+            for (i=0; i<segLen; ++i) {
+                vMax = _mm_max_epi16(vMax, _mm_load_si128(pvHStore + i));
+            }
+            max = _mm_hmax_epi16(vMax);
+            if (xdrop < 0 || max > NEG_LIMIT) {
+                extension->ref_end_score = max;
+                extension->ref_end_query = first_row(pvHStore, segLen, s1Len, max);
+            }
+        }
+    }
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+        if (NULL != extension) {
+            extension->query_end_score = 0;
+            extension->query_end_ref = -1;
+            extension->ref_end_score = 0;
+            extension->ref_end_query = -1;
+            extension->ref_scanned = 0;
+            extension->stop = PARASAIL_EXTEND_END;
+        }
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_END | PARASAIL_FLAG_SG_S2_END
+        | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHMax);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+
+    return result;
+}
+
@@ -0,0 +1,165 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * AVX2 hybrid striped and scan kernels, see hybrid_kernel.c.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+/* shift left by imm bytes across the 128-bit halves */
+#define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+
+static inline __m256i insert0_8(__m256i v, int8_t x)
+{
+    return _mm256_blendv_epi8(v, _mm256_set1_epi8(x),
+            _mm256_setr_epi8(-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0));
+}
+
+static inline __m256i insert0_16(__m256i v, int16_t x)
+{
+    return _mm256_blendv_epi8(v, _mm256_set1_epi16(x),
+            _mm256_setr_epi16(-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0));
+}
+
+static inline __m256i insert0_32(__m256i v, int32_t x)
+{
+    return _mm256_blend_epi32(v, _mm256_set1_epi32(x), 1);
+}
+
+static inline int hmax8(__m256i v)
+{
+    __m128i w = _mm_max_epi8(_mm256_castsi256_si128(v),
+            _mm256_extracti128_si256(v, 1));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 4));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 2));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 1));
+    return (int8_t)_mm_extract_epi8(w, 0);
+}
+
+static inline int hmax16(__m256i v)
+{
+    __m128i w = _mm_max_epi16(_mm256_castsi256_si128(v),
+            _mm256_extracti128_si256(v, 1));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 4));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 2));
+    return (int16_t)_mm_extract_epi16(w, 0);
+}
+
+static inline int hmax32(__m256i v)
+{
+    __m128i w = _mm_max_epi32(_mm256_castsi256_si128(v),
+            _mm256_extracti128_si256(v, 1));
+    w = _mm_max_epi32(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi32(w, _mm_srli_si128(w, 4));
+    return _mm_cvtsi128_si32(w);
+}
+
+#define VEC __m256i
+#define VLOAD(p) _mm256_load_si256(p)
+#define VSTORE(p,v) _mm256_store_si256(p, v)
+
+#define WIDTH 8
+#define LANES 32
+#define INT int8_t
+#define NEG_INF INT8_MIN
+#define POS_INF INT8_MAX
+#define VSET1(x) _mm256_set1_epi8((int8_t)(x))
+#define VADD(a,b) _mm256_adds_epi8(a, b)
+#define VSUB(a,b) _mm256_subs_epi8(a, b)
+#define VMAX(a,b) _mm256_max_epi8(a, b)
+#define VMIN(a,b) _mm256_min_epi8(a, b)
+#define VANYGT(a,b) _mm256_movemask_epi8(_mm256_cmpgt_epi8(a, b))
+#define VSHIFT(v) _mm256_slli_si256_rpl(v, 1)
+#define VINSERT0(v,x) insert0_8(v, (int8_t)(x))
+#define VHMAX(v) hmax8(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_8
+#define FLAG_LANES PARASAIL_FLAG_LANES_32
+#define ENAME parasail_hybrid_avx2_256_8
+#include "hybrid_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_INF
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VANYGT
+#undef VSHIFT
+#undef VINSERT0
+#undef VHMAX
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 16
+#define LANES 16
+#define INT int16_t
+#define NEG_INF INT16_MIN
+#define POS_INF INT16_MAX
+#define VSET1(x) _mm256_set1_epi16((int16_t)(x))
+#define VADD(a,b) _mm256_adds_epi16(a, b)
+#define VSUB(a,b) _mm256_subs_epi16(a, b)
+#define VMAX(a,b) _mm256_max_epi16(a, b)
+#define VMIN(a,b) _mm256_min_epi16(a, b)
+#define VANYGT(a,b) _mm256_movemask_epi8(_mm256_cmpgt_epi16(a, b))
+#define VSHIFT(v) _mm256_slli_si256_rpl(v, 2)
+#define VINSERT0(v,x) insert0_16(v, (int16_t)(x))
+#define VHMAX(v) hmax16(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_16
+#define FLAG_LANES PARASAIL_FLAG_LANES_16
+#define ENAME parasail_hybrid_avx2_256_16
+#include "hybrid_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_INF
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VANYGT
+#undef VSHIFT
+#undef VINSERT0
+#undef VHMAX
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 32
+#define LANES 8
+#define INT int32_t
+#define NEG_INF (INT32_MIN/2)
+#define POS_INF INT32_MAX
+#define VSET1(x) _mm256_set1_epi32(x)
+#define VADD(a,b) _mm256_add_epi32(a, b)
+#define VSUB(a,b) _mm256_sub_epi32(a, b)
+#define VMAX(a,b) _mm256_max_epi32(a, b)
+#define VMIN(a,b) _mm256_min_epi32(a, b)
+#define VANYGT(a,b) _mm256_movemask_epi8(_mm256_cmpgt_epi32(a, b))
+#define VSHIFT(v) _mm256_slli_si256_rpl(v, 4)
+#define VINSERT0(v,x) insert0_32(v, x)
+#define VHMAX(v) hmax32(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_32
+#define FLAG_LANES PARASAIL_FLAG_LANES_8
+#define ENAME parasail_hybrid_avx2_256_32
+#include "hybrid_template.c"
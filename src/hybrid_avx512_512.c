@@ -0,0 +1,142 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * AVX-512BW hybrid striped and scan kernels, see hybrid_kernel.c.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+/* shift left by imm bytes across the 128-bit lanes */
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+static inline int hmax8(__m512i v)
+{
+    __m256i u = _mm256_max_epi8(_mm512_castsi512_si256(v),
+            _mm512_extracti64x4_epi64(v, 1));
+    __m128i w = _mm_max_epi8(_mm256_castsi256_si128(u),
+            _mm256_extracti128_si256(u, 1));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 4));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 2));
+    w = _mm_max_epi8(w, _mm_srli_si128(w, 1));
+    return (int8_t)_mm_extract_epi8(w, 0);
+}
+
+static inline int hmax16(__m512i v)
+{
+    __m256i u = _mm256_max_epi16(_mm512_castsi512_si256(v),
+            _mm512_extracti64x4_epi64(v, 1));
+    __m128i w = _mm_max_epi16(_mm256_castsi256_si128(u),
+            _mm256_extracti128_si256(u, 1));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 8));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 4));
+    w = _mm_max_epi16(w, _mm_srli_si128(w, 2));
+    return (int16_t)_mm_extract_epi16(w, 0);
+}
+
+#define VEC __m512i
+#define VLOAD(p) _mm512_load_si512((const void*)(p))
+#define VSTORE(p,v) _mm512_store_si512((void*)(p), v)
+
+#define WIDTH 8
+#define LANES 64
+#define INT int8_t
+#define NEG_INF INT8_MIN
+#define POS_INF INT8_MAX
+#define VSET1(x) _mm512_set1_epi8((int8_t)(x))
+#define VADD(a,b) _mm512_adds_epi8(a, b)
+#define VSUB(a,b) _mm512_subs_epi8(a, b)
+#define VMAX(a,b) _mm512_max_epi8(a, b)
+#define VMIN(a,b) _mm512_min_epi8(a, b)
+#define VANYGT(a,b) (0 != _mm512_cmpgt_epi8_mask(a, b))
+#define VSHIFT(v) _mm512_slli_si512_rpl(v, 1)
+#define VINSERT0(v,x) _mm512_mask_set1_epi8(v, 1, (int8_t)(x))
+#define VHMAX(v) hmax8(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_8
+#define FLAG_LANES PARASAIL_FLAG_LANES_64
+#define ENAME parasail_hybrid_avx512_512_8
+#include "hybrid_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_INF
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VANYGT
+#undef VSHIFT
+#undef VINSERT0
+#undef VHMAX
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 16
+#define LANES 32
+#define INT int16_t
+#define NEG_INF INT16_MIN
+#define POS_INF INT16_MAX
+#define VSET1(x) _mm512_set1_epi16((int16_t)(x))
+#define VADD(a,b) _mm512_adds_epi16(a, b)
+#define VSUB(a,b) _mm512_subs_epi16(a, b)
+#define VMAX(a,b) _mm512_max_epi16(a, b)
+#define VMIN(a,b) _mm512_min_epi16(a, b)
+#define VANYGT(a,b) (0 != _mm512_cmpgt_epi16_mask(a, b))
+#define VSHIFT(v) _mm512_slli_si512_rpl(v, 2)
+#define VINSERT0(v,x) _mm512_mask_set1_epi16(v, 1, (int16_t)(x))
+#define VHMAX(v) hmax16(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_16
+#define FLAG_LANES PARASAIL_FLAG_LANES_32
+#define ENAME parasail_hybrid_avx512_512_16
+#include "hybrid_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_INF
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VANYGT
+#undef VSHIFT
+#undef VINSERT0
+#undef VHMAX
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+
+#define WIDTH 32
+#define LANES 16
+#define INT int32_t
+#define NEG_INF (INT32_MIN/2)
+#define POS_INF INT32_MAX
+#define VSET1(x) _mm512_set1_epi32(x)
+#define VADD(a,b) _mm512_add_epi32(a, b)
+#define VSUB(a,b) _mm512_sub_epi32(a, b)
+#define VMAX(a,b) _mm512_max_epi32(a, b)
+#define VMIN(a,b) _mm512_min_epi32(a, b)
+#define VANYGT(a,b) (0 != _mm512_cmpgt_epi32_mask(a, b))
+#define VSHIFT(v) _mm512_slli_si512_rpl(v, 4)
+#define VINSERT0(v,x) _mm512_mask_set1_epi32(v, 1, x)
+#define VHMAX(v) _mm512_reduce_max_epi32(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_32
+#define FLAG_LANES PARASAIL_FLAG_LANES_16
+#define ENAME parasail_hybrid_avx512_512_32
+#include "hybrid_template.c"
@@ -0,0 +1,58 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+/* without a usable instruction set, use the scan functions */
+#define HYBRID_FALLBACK(NAME, WIDTH)                                    \
+parasail_result_t* NAME(                                                \
+        const char * const restrict s1, const int s1Len,                \
+        const char * const restrict s2, const int s2Len,                \
+        const int open, const int gap,                                  \
+        const parasail_matrix_t *matrix,                                \
+        const int flags)                                                \
+{                                                                       \
+    if (flags & PARASAIL_FLAG_NW) {                                     \
+        return parasail_nw_scan_##WIDTH(s1, s1Len, s2, s2Len, open, gap, matrix); \
+    }                                                                   \
+    if (flags & PARASAIL_FLAG_SG) {                                     \
+        return parasail_sg_scan_##WIDTH(s1, s1Len, s2, s2Len, open, gap, matrix); \
+    }                                                                   \
+    return parasail_sw_scan_##WIDTH(s1, s1Len, s2, s2Len, open, gap, matrix); \
+}
+
+HYBRID_FALLBACK(parasail_hybrid_scan_8, 8)
+HYBRID_FALLBACK(parasail_hybrid_scan_16, 16)
+HYBRID_FALLBACK(parasail_hybrid_scan_32, 32)
+
+/* implement the wrapper functions */
+
+#define HYBRID_WRAPPER(NAME, CALL, FLAGS)                               \
+parasail_result_t* NAME(                                                \
+        const char * const restrict s1, const int s1Len,                \
+        const char * const restrict s2, const int s2Len,                \
+        const int open, const int gap,                                  \
+        const parasail_matrix_t *matrix)                                \
+{                                                                       \
+    return CALL(s1, s1Len, s2, s2Len, open, gap, matrix, FLAGS);        \
+}
+
+#define HYBRID_WRAPPERS(PREFIX, FLAGS)                                  \
+HYBRID_WRAPPER(PREFIX##_8, parasail_hybrid_8, FLAGS)            \
+HYBRID_WRAPPER(PREFIX##_16, parasail_hybrid_16, FLAGS)          \
+HYBRID_WRAPPER(PREFIX##_32, parasail_hybrid_32, FLAGS)          \
+HYBRID_WRAPPER(PREFIX##_sat, parasail_hybrid_sat, FLAGS)
+
+HYBRID_WRAPPERS(parasail_nw_hybrid, PARASAIL_FLAG_NW)
+HYBRID_WRAPPERS(parasail_sg_hybrid, PARASAIL_FLAG_SG)
+HYBRID_WRAPPERS(parasail_sw_hybrid, PARASAIL_FLAG_SW)
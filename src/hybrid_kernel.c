@@ -0,0 +1,421 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Striped alignment that changes its column update on the fly.  A
+ * striped column is cheap until the Lazy_F loop has to carry F across
+ * many segments, which is common with a high open to extend ratio or
+ * with repetitive sequence.  Each striped column counts the segments
+ * the Lazy_F loop visited; once a column needs more than a scan column
+ * would cost (one more pass over the segments and a walk across the
+ * lanes), the following columns use the prefix scan update of the
+ * scan functions on the same striped layout.  A striped column is tried
+ * again after a number of scan columns that doubles for as long as the
+ * corrections persist, and the kernel returns to striped columns once
+ * they subside.
+ *
+ * The scan column first computes Ht = max(H diagonal + score, E) over
+ * all segments while running F within each lane.  The F leaving the
+ * last segment of one lane enters the first segment of the next, so a
+ * scalar walk across the lanes gives the F entering every lane, and a
+ * second pass applies it.  The Lazy_F loop also updates E from the
+ * corrected H, so both updates produce the exact table and the results
+ * do not depend on where the kernel switched.  As with the scan
+ * functions, open must not be less than gap.
+ *
+ * Included once per algorithm by hybrid_template.c with one of
+ * HYBRID_NW, HYBRID_SG or HYBRID_SW defined, and KNAME naming the
+ * function.
+ */
+
+parasail_result_t* KNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int32_t n = matrix->size;
+    const int32_t segWidth = LANES; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    VEC * const restrict vProfile = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*n*segLen);
+    VEC * restrict pvHStore = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    VEC * restrict pvHLoad = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    VEC * const restrict pvE = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    /* F leaving each lane, then F entering each lane, of a scan column */
+    VEC * const restrict pvCarry = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC));
+    INT * const restrict carry = (INT*)pvCarry;
+    const int64_t segGap = (int64_t)segLen * gap;
+    const VEC vGapO = VSET1(open);
+    const VEC vGapE = VSET1(gap);
+    /* Lazy_F segment visits that make a striped column dearer than a
+     * scan column, and the scan columns before the next striped try */
+    const int32_t threshold = segLen + segWidth;
+    int32_t backoff = HYBRID_BACKOFF_MIN;
+    int32_t countdown = 0;
+#ifdef HYBRID_SW
+    VEC * const restrict pvHMax = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*segLen);
+    const INT bias = NEG_INF;
+    const INT maxp = POS_INF - (INT)(matrix->max + 1);
+    const VEC vBias = VSET1(bias);
+    const VEC vFStart = vBias;
+    const INT vFInsert = bias;
+    VEC vMaxH = vBias;
+    VEC vMaxHUnit = vBias;
+    INT score = bias;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    int saturated = 0;
+#else
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (s1Len - 1) / segLen;
+    INT * const restrict boundary = (INT*)parasail_memalign(sizeof(VEC), sizeof(INT)*(s2Len+1));
+    const INT NEG_LIMIT = (-open < matrix->min ?
+        NEG_INF + open : NEG_INF - matrix->min) + 1;
+    const INT POS_LIMIT = POS_INF - matrix->max - 1;
+    const VEC vNegLimit = VSET1(NEG_LIMIT);
+    const VEC vPosLimit = VSET1(POS_LIMIT);
+    const VEC vFStart = vNegLimit;
+    VEC vSaturationCheckMin = vPosLimit;
+    VEC vSaturationCheckMax = vNegLimit;
+    INT score = NEG_LIMIT;
+    int32_t end_query = s1Len - 1;
+    int32_t end_ref = s2Len - 1;
+#endif
+    parasail_result_t *result = parasail_result_new();
+
+    /* the striped query profile */
+    {
+        INT *t = (INT*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<segLen; ++i) {
+                int32_t segNum = 0;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    int32_t q = segNum*segLen + i;
+                    *t++ = (INT)(q >= s1Len ? 0 :
+                            matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[q]]]);
+                }
+            }
+        }
+    }
+
+#ifdef HYBRID_SW
+    /* initialize H and E */
+    for (i=0; i<segLen; ++i) {
+        VSTORE(pvHStore + i, vBias);
+        VSTORE(pvE + i, vBias);
+    }
+#else
+    /* initialize H and E */
+    {
+        INT *h = (INT*)pvHStore;
+        INT *e = (INT*)pvE;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+#ifdef HYBRID_SG
+                int64_t tmp = 0;
+#else
+                int64_t tmp = -open-gap*(int64_t)(segNum*segLen+i);
+#endif
+                *h++ = tmp < NEG_INF ? NEG_INF : tmp;
+                tmp = tmp - open;
+                *e++ = tmp < NEG_INF ? NEG_INF : tmp;
+            }
+        }
+    }
+
+    /* initialize upper boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+#ifdef HYBRID_SG
+            int64_t tmp = 0;
+#else
+            int64_t tmp = -open-gap*(int64_t)(i-1);
+#endif
+            boundary[i] = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+    }
+#endif
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        VEC vE;
+        VEC vF = vFStart;
+        const VEC *vP = vProfile + matrix->mapper[(unsigned char)s2[j]]*segLen;
+#ifdef HYBRID_SW
+        /* load final segment of pvHStore and shift left by one lane */
+        VEC vH = VINSERT0(VSHIFT(pvHStore[segLen - 1]), bias);
+#else
+        /* load final segment of pvHStore and shift left by one lane,
+         * inserting the upper boundary condition */
+        VEC vH = VINSERT0(VSHIFT(pvHStore[segLen - 1]), boundary[j]);
+#ifdef HYBRID_SG
+        const int64_t tmp = -open;
+#else
+        const int64_t tmp = boundary[j+1] - open;
+#endif
+        const INT vFInsert = tmp < NEG_INF ? NEG_INF : tmp;
+#endif
+
+        /* Swap the 2 H buffers. */
+        VEC *pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        if (countdown > 0) {
+            /* scan column, first pass: Ht and F within each lane */
+            for (i=0; i<segLen; ++i) {
+                vH = VADD(vH, VLOAD(vP + i));
+#ifdef HYBRID_SW
+                vH = VMAX(vH, vBias);
+#endif
+                vE = VLOAD(pvE + i);
+                vH = VMAX(vH, vE);
+                VSTORE(pvHStore + i, vH);
+                vH = VSUB(vH, vGapO);
+                vF = VSUB(vF, vGapE);
+                vF = VMAX(vF, vH);
+                vH = VLOAD(pvHLoad + i);
+            }
+
+            /* F entering each lane: what left the lane before it, or
+             * what entered that lane less a whole lane of extensions */
+            VSTORE(pvCarry, vF);
+            {
+                int64_t f = vFInsert;
+                for (k=0; k<segWidth; ++k) {
+                    const int64_t out = carry[k];
+                    carry[k] = (INT)f;
+                    f = f - segGap;
+                    f = f > out ? f : out;
+                    f = f < NEG_INF ? NEG_INF : f;
+                }
+            }
+
+            /* second pass: apply F, then update E from the final H */
+            vF = VLOAD(pvCarry);
+            for (i=0; i<segLen; ++i) {
+                vH = VLOAD(pvHStore + i);
+                vE = VLOAD(pvE + i);
+                vH = VMAX(vH, vF);
+                VSTORE(pvHStore + i, vH);
+#ifdef HYBRID_SW
+                vMaxH = VMAX(vH, vMaxH);
+#else
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vH);
+                vSaturationCheckMax = VMAX(vSaturationCheckMax, vH);
+#ifdef HYBRID_NW
+                /* the clamped boundary enters through E and F */
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vE);
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vF);
+#endif
+#endif
+                vH = VSUB(vH, vGapO);
+                vE = VSUB(vE, vGapE);
+                vE = VMAX(vE, vH);
+                VSTORE(pvE + i, vE);
+                vF = VSUB(vF, vGapE);
+                vF = VMAX(vF, vH);
+            }
+
+            if (--countdown == 0 && backoff < HYBRID_BACKOFF_MAX) {
+                backoff *= 2;
+            }
+        }
+        else {
+            int32_t visits = segWidth*segLen;
+
+            /* inner loop to process the query sequence */
+            for (i=0; i<segLen; ++i) {
+                vH = VADD(vH, VLOAD(vP + i));
+#ifdef HYBRID_SW
+                vH = VMAX(vH, vBias);
+#endif
+                vE = VLOAD(pvE + i);
+
+                /* Get max from vH, vE and vF. */
+                vH = VMAX(vH, vE);
+                vH = VMAX(vH, vF);
+                /* Save vH values. */
+                VSTORE(pvHStore + i, vH);
+#ifdef HYBRID_SW
+                vMaxH = VMAX(vH, vMaxH);
+#else
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vH);
+                vSaturationCheckMax = VMAX(vSaturationCheckMax, vH);
+#ifdef HYBRID_NW
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vE);
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vF);
+#endif
+#endif
+
+                /* Update vE value. */
+                vH = VSUB(vH, vGapO);
+                vE = VSUB(vE, vGapE);
+                vE = VMAX(vE, vH);
+                VSTORE(pvE + i, vE);
+
+                /* Update vF value. */
+                vF = VSUB(vF, vGapE);
+                vF = VMAX(vF, vH);
+
+                /* Load the next vH. */
+                vH = VLOAD(pvHLoad + i);
+            }
+
+            /* Lazy_F loop: E is updated from the corrected H so that
+             * the striped and scan columns agree, and the loop stops
+             * on the H before correction, which the inner loop already
+             * passed on as F; the corrected H would stop too early
+             * when open equals gap */
+            for (k=0; k<segWidth; ++k) {
+                vF = VINSERT0(VSHIFT(vF), vFInsert);
+                for (i=0; i<segLen; ++i) {
+                    VEC vHF;
+                    vH = VLOAD(pvHStore + i);
+                    vHF = VMAX(vH, vF);
+                    VSTORE(pvHStore + i, vHF);
+#ifdef HYBRID_SW
+                    vMaxH = VMAX(vHF, vMaxH);
+#else
+                    vSaturationCheckMin = VMIN(vSaturationCheckMin, vHF);
+                    vSaturationCheckMax = VMAX(vSaturationCheckMax, vHF);
+#ifdef HYBRID_NW
+                    vSaturationCheckMin = VMIN(vSaturationCheckMin, vF);
+#endif
+#endif
+                    vE = VLOAD(pvE + i);
+                    vE = VMAX(vE, VSUB(vHF, vGapO));
+                    VSTORE(pvE + i, vE);
+                    vH = VSUB(vH, vGapO);
+                    vF = VSUB(vF, vGapE);
+                    if (!VANYGT(vF, vH)) {
+                        visits = k*segLen + i + 1;
+                        goto end;
+                    }
+                }
+            }
+end:
+            if (visits > threshold) {
+                countdown = backoff;
+            }
+            else {
+                backoff = HYBRID_BACKOFF_MIN;
+            }
+        }
+
+#ifdef HYBRID_SW
+        if (VANYGT(vMaxH, vMaxHUnit)) {
+            score = VHMAX(vMaxH);
+            /* if score has potential to overflow, abort early */
+            if (score > maxp) {
+                saturated = 1;
+                break;
+            }
+            vMaxHUnit = VSET1(score);
+            end_ref = j;
+            memcpy(pvHMax, pvHStore, sizeof(VEC)*segLen);
+        }
+#elif defined(HYBRID_SG)
+        /* max of the last row over all columns */
+        {
+            INT h = ((INT*)pvHStore)[offset*segWidth + position];
+            if (h > score) {
+                score = h;
+                end_ref = j;
+            }
+        }
+#endif
+    }
+
+#ifdef HYBRID_SW
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = bias;
+        end_query = 0;
+        end_ref = 0;
+    }
+    else if (score > bias) {
+        /* Trace the alignment ending position on read. */
+        const INT *t = (const INT*)pvHMax;
+        const int32_t column_len = segLen * segWidth;
+        end_query = s1Len - 1;
+        for (i=0; i<column_len; ++i, ++t) {
+            if (*t == score) {
+                int32_t temp = i / segWidth + i % segWidth * segLen;
+                if (temp < end_query) {
+                    end_query = temp;
+                }
+            }
+        }
+    }
+
+    result->score = score - bias;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SW;
+
+    parasail_free(pvHMax);
+#else
+#ifdef HYBRID_SG
+    /* max of the last column */
+    {
+        const INT *t = (const INT*)pvHStore;
+        const int32_t column_len = segLen * segWidth;
+        for (i=0; i<column_len; ++i, ++t) {
+            int32_t temp = i / segWidth + i % segWidth * segLen;
+            if (temp >= s1Len) continue;
+            if (*t > score) {
+                score = *t;
+                end_query = temp;
+                end_ref = s2Len-1;
+            }
+            else if (*t == score && end_ref == s2Len-1 && temp < end_query) {
+                end_query = temp;
+            }
+        }
+    }
+#else
+    /* the last value of the last column */
+    score = ((INT*)pvHStore)[offset*segWidth + position];
+#endif
+
+    if (VANYGT(vNegLimit, vSaturationCheckMin)
+            || VANYGT(vSaturationCheckMax, vPosLimit)) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+#ifdef HYBRID_SG
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_BEG | PARASAIL_FLAG_SG_S1_END
+        | PARASAIL_FLAG_SG_S2_BEG | PARASAIL_FLAG_SG_S2_END;
+#else
+    result->flag |= PARASAIL_FLAG_NW;
+#endif
+
+    parasail_free(boundary);
+#endif
+    result->flag |= PARASAIL_FLAG_STRIPED | PARASAIL_FLAG_SCAN
+        | FLAG_BITS | FLAG_LANES;
+
+    parasail_free(pvCarry);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(vProfile);
+
+    return result;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Instantiates the hybrid striped and scan kernels for one vector width.
+ * The including file defines the vector operations for that width and
+ * ENAME, the name of the function that selects among the kernels.
+ */
+
+#ifndef HYBRID_CONCAT
+#define HYBRID_CONCAT_(a,b) a##b
+#define HYBRID_CONCAT(a,b) HYBRID_CONCAT_(a,b)
+/* scan columns run before striped columns are tried again */
+#define HYBRID_BACKOFF_MIN 8
+#define HYBRID_BACKOFF_MAX 256
+#endif
+
+#define HYBRID_NW
+#define KNAME HYBRID_CONCAT(ENAME, _nw)
+#include "hybrid_kernel.c"
+#undef KNAME
+#undef HYBRID_NW
+
+#define HYBRID_SG
+#define KNAME HYBRID_CONCAT(ENAME, _sg)
+#include "hybrid_kernel.c"
+#undef KNAME
+#undef HYBRID_SG
+
+#define HYBRID_SW
+#define KNAME HYBRID_CONCAT(ENAME, _sw)
+#include "hybrid_kernel.c"
+#undef KNAME
+#undef HYBRID_SW
+
+parasail_result_t* ENAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+    if (flags & PARASAIL_FLAG_NW) {
+        return HYBRID_CONCAT(ENAME, _nw)(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (flags & PARASAIL_FLAG_SG) {
+        return HYBRID_CONCAT(ENAME, _sg)(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    return HYBRID_CONCAT(ENAME, _sw)(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
@@ -0,0 +1,424 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/memory.h"
+
+/* forward declare the dispatcher functions */
+parasail_banded_kernel_t parasail_banded_8_dispatcher;
+parasail_banded_kernel_t parasail_banded_16_dispatcher;
+parasail_banded_kernel_t parasail_banded_32_dispatcher;
+parasail_dna_kernel_t parasail_dna_8_dispatcher;
+parasail_dna_kernel_t parasail_dna_16_dispatcher;
+parasail_dna_kernel_t parasail_dna_32_dispatcher;
+parasail_hybrid_kernel_t parasail_hybrid_8_dispatcher;
+parasail_hybrid_kernel_t parasail_hybrid_16_dispatcher;
+parasail_hybrid_kernel_t parasail_hybrid_32_dispatcher;
+
+/* declare and initialize the pointer to the dispatcher function */
+parasail_banded_kernel_t * parasail_banded_8_pointer = parasail_banded_8_dispatcher;
+parasail_banded_kernel_t * parasail_banded_16_pointer = parasail_banded_16_dispatcher;
+parasail_banded_kernel_t * parasail_banded_32_pointer = parasail_banded_32_dispatcher;
+parasail_dna_kernel_t * parasail_dna_8_pointer = parasail_dna_8_dispatcher;
+parasail_dna_kernel_t * parasail_dna_16_pointer = parasail_dna_16_dispatcher;
+parasail_dna_kernel_t * parasail_dna_32_pointer = parasail_dna_32_dispatcher;
+parasail_hybrid_kernel_t * parasail_hybrid_8_pointer = parasail_hybrid_8_dispatcher;
+parasail_hybrid_kernel_t * parasail_hybrid_16_pointer = parasail_hybrid_16_dispatcher;
+parasail_hybrid_kernel_t * parasail_hybrid_32_pointer = parasail_hybrid_32_dispatcher;
+
+/* dispatcher function implementations */
+
+parasail_result_t* parasail_banded_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_banded_8_pointer = parasail_banded_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_banded_8_pointer = parasail_banded_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_banded_8_pointer = parasail_banded_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_banded_8_pointer = parasail_banded_novec_32;
+    }
+    return parasail_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, flags, adaptive);
+}
+
+parasail_result_t* parasail_banded_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_banded_16_pointer = parasail_banded_avx512_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_banded_16_pointer = parasail_banded_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_banded_16_pointer = parasail_banded_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_banded_16_pointer = parasail_banded_novec_32;
+    }
+    return parasail_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, flags, adaptive);
+}
+
+parasail_result_t* parasail_banded_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_banded_32_pointer = parasail_banded_avx512_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_banded_32_pointer = parasail_banded_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_banded_32_pointer = parasail_banded_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_banded_32_pointer = parasail_banded_novec_32;
+    }
+    return parasail_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, flags, adaptive);
+}
+
+parasail_result_t* parasail_dna_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_dna_8_pointer = parasail_dna_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_dna_8_pointer = parasail_dna_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_dna_8_pointer = parasail_dna_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_dna_8_pointer = parasail_dna_striped_8;
+    }
+    return parasail_dna_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_dna_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_dna_16_pointer = parasail_dna_avx512_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_dna_16_pointer = parasail_dna_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_dna_16_pointer = parasail_dna_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_dna_16_pointer = parasail_dna_striped_16;
+    }
+    return parasail_dna_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_dna_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_dna_32_pointer = parasail_dna_avx512_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_dna_32_pointer = parasail_dna_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_dna_32_pointer = parasail_dna_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_dna_32_pointer = parasail_dna_striped_32;
+    }
+    return parasail_dna_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_hybrid_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_hybrid_8_pointer = parasail_hybrid_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_hybrid_8_pointer = parasail_hybrid_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_hybrid_8_pointer = parasail_hybrid_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_hybrid_8_pointer = parasail_hybrid_scan_8;
+    }
+    return parasail_hybrid_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_hybrid_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_hybrid_16_pointer = parasail_hybrid_avx512_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_hybrid_16_pointer = parasail_hybrid_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_hybrid_16_pointer = parasail_hybrid_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_hybrid_16_pointer = parasail_hybrid_scan_16;
+    }
+    return parasail_hybrid_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_hybrid_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_hybrid_32_pointer = parasail_hybrid_avx512_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_hybrid_32_pointer = parasail_hybrid_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_hybrid_32_pointer = parasail_hybrid_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_hybrid_32_pointer = parasail_hybrid_scan_32;
+    }
+    return parasail_hybrid_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+/* implementation which simply calls the pointer,
+ * first time it's the dispatcher, otherwise it's correct impl */
+
+parasail_result_t* parasail_banded_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive)
+{
+    return parasail_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, flags, adaptive);
+}
+
+parasail_result_t* parasail_banded_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive)
+{
+    return parasail_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, flags, adaptive);
+}
+
+parasail_result_t* parasail_banded_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive)
+{
+    return parasail_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, flags, adaptive);
+}
+
+parasail_result_t* parasail_dna_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+    return parasail_dna_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_dna_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+    return parasail_dna_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_dna_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+    return parasail_dna_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_hybrid_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+    return parasail_hybrid_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_hybrid_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+    return parasail_hybrid_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
+parasail_result_t* parasail_hybrid_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags)
+{
+    return parasail_hybrid_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix, flags);
+}
+
@@ -125,19 +125,210 @@ void parasail_memset_int64_t(int64_t *b, int64_t c, size_t len)
     }
 }
 
-parasail_result_t* parasail_result_new()
+void parasail_sat_state_save_int8_t(
+        parasail_sat_state_t * const restrict state,
+        const int8_t * const restrict H,
+        const int8_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int8_t bias)
+{
+    int i = 0;
+    int k = 0;
+
+    if (NULL == state->H) {
+        state->H = parasail_memalign_int(16, s1Len);
+        state->E = parasail_memalign_int(16, s1Len);
+    }
+    for (i=0; i<segLen; ++i) {
+        for (k=0; k<lanes; ++k) {
+            int q = k*segLen + i;
+            if (q < s1Len) {
+                state->H[q] = (int)(H[i*lanes + k] - bias);
+                state->E[q] = (int)(E[i*lanes + k] - bias);
+            }
+        }
+    }
+}
+
+void parasail_sat_state_load_int8_t(
+        const parasail_sat_state_t * const restrict state,
+        int8_t * const restrict H,
+        int8_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int8_t bias)
 {
-    /* declare all variables */
-    parasail_result_t *result = NULL;
+    int i = 0;
+    int k = 0;
 
-    result = (parasail_result_t*)malloc(sizeof(parasail_result_t));
-    assert(result);
+    for (i=0; i<segLen; ++i) {
+        for (k=0; k<lanes; ++k) {
+            int q = k*segLen + i;
+            if (q < s1Len) {
+                H[i*lanes + k] = (int8_t)(state->H[q] + bias);
+                E[i*lanes + k] = (int8_t)(state->E[q] + bias);
+            }
+        }
+    }
+}
+
+void parasail_sat_state_save_int16_t(
+        parasail_sat_state_t * const restrict state,
+        const int16_t * const restrict H,
+        const int16_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int16_t bias)
+{
+    int i = 0;
+    int k = 0;
+
+    if (NULL == state->H) {
+        state->H = parasail_memalign_int(16, s1Len);
+        state->E = parasail_memalign_int(16, s1Len);
+    }
+    for (i=0; i<segLen; ++i) {
+        for (k=0; k<lanes; ++k) {
+            int q = k*segLen + i;
+            if (q < s1Len) {
+                state->H[q] = (int)(H[i*lanes + k] - bias);
+                state->E[q] = (int)(E[i*lanes + k] - bias);
+            }
+        }
+    }
+}
+
+void parasail_sat_state_load_int16_t(
+        const parasail_sat_state_t * const restrict state,
+        int16_t * const restrict H,
+        int16_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int16_t bias)
+{
+    int i = 0;
+    int k = 0;
+
+    for (i=0; i<segLen; ++i) {
+        for (k=0; k<lanes; ++k) {
+            int q = k*segLen + i;
+            if (q < s1Len) {
+                H[i*lanes + k] = (int16_t)(state->H[q] + bias);
+                E[i*lanes + k] = (int16_t)(state->E[q] + bias);
+            }
+        }
+    }
+}
+
+void parasail_sat_state_save_int32_t(
+        parasail_sat_state_t * const restrict state,
+        const int32_t * const restrict H,
+        const int32_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int32_t bias)
+{
+    int i = 0;
+    int k = 0;
+
+    if (NULL == state->H) {
+        state->H = parasail_memalign_int(16, s1Len);
+        state->E = parasail_memalign_int(16, s1Len);
+    }
+    for (i=0; i<segLen; ++i) {
+        for (k=0; k<lanes; ++k) {
+            int q = k*segLen + i;
+            if (q < s1Len) {
+                state->H[q] = (int)(H[i*lanes + k] - bias);
+                state->E[q] = (int)(E[i*lanes + k] - bias);
+            }
+        }
+    }
+}
+
+void parasail_sat_state_load_int32_t(
+        const parasail_sat_state_t * const restrict state,
+        int32_t * const restrict H,
+        int32_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int32_t bias)
+{
+    int i = 0;
+    int k = 0;
 
+    for (i=0; i<segLen; ++i) {
+        for (k=0; k<lanes; ++k) {
+            int q = k*segLen + i;
+            if (q < s1Len) {
+                H[i*lanes + k] = (int32_t)(state->H[q] + bias);
+                E[i*lanes + k] = (int32_t)(state->E[q] + bias);
+            }
+        }
+    }
+}
+
+void parasail_sat_state_save_int64_t(
+        parasail_sat_state_t * const restrict state,
+        const int64_t * const restrict H,
+        const int64_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int64_t bias)
+{
+    int i = 0;
+    int k = 0;
+
+    if (NULL == state->H) {
+        state->H = parasail_memalign_int(16, s1Len);
+        state->E = parasail_memalign_int(16, s1Len);
+    }
+    for (i=0; i<segLen; ++i) {
+        for (k=0; k<lanes; ++k) {
+            int q = k*segLen + i;
+            if (q < s1Len) {
+                state->H[q] = (int)(H[i*lanes + k] - bias);
+                state->E[q] = (int)(E[i*lanes + k] - bias);
+            }
+        }
+    }
+}
+
+void parasail_sat_state_load_int64_t(
+        const parasail_sat_state_t * const restrict state,
+        int64_t * const restrict H,
+        int64_t * const restrict E,
+        const int s1Len, const int segLen, const int lanes,
+        const int64_t bias)
+{
+    int i = 0;
+    int k = 0;
+
+    for (i=0; i<segLen; ++i) {
+        for (k=0; k<lanes; ++k) {
+            int q = k*segLen + i;
+            if (q < s1Len) {
+                H[i*lanes + k] = (int64_t)(state->H[q] + bias);
+                E[i*lanes + k] = (int64_t)(state->E[q] + bias);
+            }
+        }
+    }
+}
+
+void parasail_result_init(parasail_result_t *result)
+{
     result->score = 0;
     result->end_query = 0;
     result->end_ref = 0;
     result->flag = 0;
     result->extra = NULL;
+    result->begin_query = -1;
+    result->begin_ref = -1;
+}
+
+parasail_result_t* parasail_result_new()
+{
+    /* declare all variables */
+    parasail_result_t *result = NULL;
+
+    result = (parasail_result_t*)malloc(sizeof(parasail_result_t));
+    assert(result);
+
+    parasail_result_init(result);
 
     return result;
 }
@@ -253,6 +444,28 @@ parasail_result_t* parasail_result_new_trace(const int a, const int b, const siz
     assert(result->trace->trace_table);
     result->trace->trace_ins_table = NULL;
     result->trace->trace_del_table = NULL;
+    result->trace->format = PARASAIL_TRACE_FORMAT_TABLE;
+
+    return result;
+}
+
+parasail_result_t* parasail_result_new_trace_path(parasail_cigar_t *path)
+{
+    /* declare all variables */
+    parasail_result_t *result = NULL;
+
+    /* validate inputs */
+    assert(NULL != path);
+
+    /* allocate struct to hold memory */
+    result = parasail_result_new();
+
+    result->trace = (parasail_result_extra_trace_t*)malloc(sizeof(parasail_result_extra_trace_t));
+    assert(result->trace);
+    result->trace->trace_table = path;
+    result->trace->trace_ins_table = NULL;
+    result->trace->trace_del_table = NULL;
+    result->trace->format = PARASAIL_TRACE_FORMAT_PATH;
 
     return result;
 }
@@ -336,7 +549,10 @@ void parasail_result_free(parasail_result_t *result)
         }
     }
     if (result->flag & PARASAIL_FLAG_TRACE) {
-        parasail_free(result->trace->trace_table);
+        if (PARASAIL_TRACE_FORMAT_PATH == result->trace->format)
+            parasail_cigar_free(result->trace->trace_table);
+        else
+            parasail_free(result->trace->trace_table);
         if (NULL != result->trace->trace_ins_table)
             parasail_free(result->trace->trace_ins_table);
         if (NULL != result->trace->trace_del_table)
@@ -493,15 +709,33 @@ void parasail_matrix_free(parasail_matrix_t *matrix)
     }
 }
 
-parasail_profile_t* parasail_profile_new(
+#if defined(__GNUC__)
+#define PARASAIL_CAS(ptr, old, new) __sync_bool_compare_and_swap(ptr, old, new)
+#define PARASAIL_BARRIER() __sync_synchronize()
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define PARASAIL_CAS(ptr, old, new) \
+    (_InterlockedCompareExchangePointer((void* volatile*)(ptr), new, old) == (old))
+#define PARASAIL_BARRIER() _ReadWriteBarrier()
+#else
+/* without atomics, deferred widths must not be built from two threads */
+#define PARASAIL_CAS(ptr, old, new) (*(ptr) == (old) ? (*(ptr) = (new), 1) : 0)
+#define PARASAIL_BARRIER()
+#endif
+
+/* Widths of a profile deferred until a kernel of that width first
+ * needs them.  The first thread to build a width publishes it in
+ * built[]; a thread that loses the race frees its copy and waits for
+ * the winner to move the width into the profile. */
+struct parasail_profile_lazy {
+    parasail_pcreator_t *creator[4];
+    parasail_profile_t * volatile built[4];
+    volatile int ready[4];
+};
+
+void parasail_profile_init(parasail_profile_t *profile,
         const char * s1, const int s1Len, const parasail_matrix_t *matrix)
 {
-    /* declare all variables */
-    parasail_profile_t *profile = NULL;
-
-    profile = (parasail_profile_t*)malloc(sizeof(parasail_profile_t));
-    assert(profile);
-
     profile->s1 = s1;
     profile->s1Len = s1Len;
     profile->matrix = matrix;
@@ -519,6 +753,20 @@ parasail_profile_t* parasail_profile_new(
     profile->profile64.similar = NULL;
     profile->free = NULL;
     profile->stop = INT32_MAX;
+    profile->lazy = NULL;
+    profile->trace_format = PARASAIL_TRACE_FORMAT_TABLE;
+}
+
+parasail_profile_t* parasail_profile_new(
+        const char * s1, const int s1Len, const parasail_matrix_t *matrix)
+{
+    /* declare all variables */
+    parasail_profile_t *profile = NULL;
+
+    profile = (parasail_profile_t*)malloc(sizeof(parasail_profile_t));
+    assert(profile);
+
+    parasail_profile_init(profile, s1, s1Len, matrix);
 
     return profile;
 }
@@ -565,9 +813,238 @@ void parasail_profile_free(parasail_profile_t *profile)
         profile->free(profile->profile64.similar);
     }
 
+    if (NULL != profile->lazy) {
+        int i = 0;
+        /* the built widths were moved into the profile above; only
+         * the structs that carried them are left */
+        for (i=0; i<4; ++i) {
+            if (NULL != profile->lazy->built[i]) {
+                free(profile->lazy->built[i]);
+            }
+        }
+        free(profile->lazy);
+    }
+
     free(profile);
 }
 
+static int parasail_profile_width_index(int bits)
+{
+    switch (bits) {
+        case 8: return 0;
+        case 16: return 1;
+        case 32: return 2;
+        case 64: return 3;
+        default: return -1;
+    }
+}
+
+static parasail_profile_data_t* parasail_profile_width(
+        parasail_profile_t *profile, int index)
+{
+    switch (index) {
+        case 0: return &profile->profile8;
+        case 1: return &profile->profile16;
+        case 2: return &profile->profile32;
+        default: return &profile->profile64;
+    }
+}
+
+void parasail_profile_defer(parasail_profile_t *profile, int bits,
+        parasail_pcreator_t *creator)
+{
+    int index = parasail_profile_width_index(bits);
+
+    assert(index >= 0);
+    if (NULL == profile->lazy) {
+        profile->lazy = (struct parasail_profile_lazy*)calloc(1,
+                sizeof(struct parasail_profile_lazy));
+        assert(profile->lazy);
+    }
+    profile->lazy->creator[index] = creator;
+}
+
+int parasail_profile_has(const parasail_profile_t *profile, int bits)
+{
+    int index = parasail_profile_width_index(bits);
+
+    if (index < 0) {
+        return 0;
+    }
+    if (NULL != parasail_profile_width((parasail_profile_t*)profile, index)->score) {
+        return 1;
+    }
+    return NULL != profile->lazy && NULL != profile->lazy->creator[index];
+}
+
+void parasail_profile_materialize(const parasail_profile_t *profile, int bits)
+{
+    /* the deferred widths are not part of the profile's logical value,
+     * so building them is allowed through a const profile */
+    parasail_profile_t *mutable_profile = (parasail_profile_t*)profile;
+    struct parasail_profile_lazy *lazy = profile->lazy;
+    parasail_profile_t *built = NULL;
+    int index = 0;
+
+    if (NULL == lazy) {
+        return;
+    }
+    index = parasail_profile_width_index(bits);
+    if (index < 0 || NULL == lazy->creator[index]) {
+        return;
+    }
+    if (lazy->ready[index]) {
+        PARASAIL_BARRIER();
+        return;
+    }
+
+    built = lazy->creator[index](profile->s1, profile->s1Len, profile->matrix);
+    if (PARASAIL_CAS(&lazy->built[index], NULL, built)) {
+        *parasail_profile_width(mutable_profile, index) =
+            *parasail_profile_width(built, index);
+        PARASAIL_BARRIER();
+        lazy->ready[index] = 1;
+    }
+    else {
+        parasail_profile_free(built);
+        while (!lazy->ready[index]) {
+            /* the winner only has a few stores left to make */
+        }
+        PARASAIL_BARRIER();
+    }
+}
+
+/* 64-byte alignment satisfies every vector width in use */
+#define PARASAIL_WORKSPACE_ALIGN 64
+
+parasail_workspace_t* parasail_workspace_create(size_t size)
+{
+    /* declare all variables */
+    parasail_workspace_t *workspace = NULL;
+
+    workspace = (parasail_workspace_t*)malloc(sizeof(parasail_workspace_t));
+    assert(workspace);
+
+    workspace->memory = NULL;
+    workspace->size = 0;
+    parasail_workspace_grow(workspace, size);
+
+    return workspace;
+}
+
+void parasail_workspace_grow(parasail_workspace_t *workspace, size_t size)
+{
+    size_t new_size = 0;
+
+    /* validate inputs */
+    assert(NULL != workspace);
+
+    if (size <= workspace->size && NULL != workspace->memory) {
+        return;
+    }
+
+    /* grow geometrically so that slowly increasing lengths do not
+     * reallocate on every call */
+    new_size = workspace->size * 2;
+    if (new_size < size) {
+        new_size = size;
+    }
+    if (new_size < PARASAIL_WORKSPACE_ALIGN) {
+        new_size = PARASAIL_WORKSPACE_ALIGN;
+    }
+
+    if (NULL != workspace->memory) {
+        parasail_free(workspace->memory);
+    }
+    workspace->memory = parasail_memalign(PARASAIL_WORKSPACE_ALIGN, new_size);
+    workspace->size = new_size;
+}
+
+void parasail_workspace_free(parasail_workspace_t *workspace)
+{
+    /* validate inputs */
+    assert(NULL != workspace);
+
+    if (NULL != workspace->memory) {
+        parasail_free(workspace->memory);
+    }
+    free(workspace);
+}
+
+parasail_encoded_t* parasail_encode(
+        const char * const restrict s, const int length,
+        const parasail_matrix_t* matrix)
+{
+    /* declare all variables */
+    parasail_encoded_t *encoded = NULL;
+    int per_byte = 0;
+    int i = 0;
+
+    /* validate inputs */
+    assert(NULL != s || 0 == length);
+    assert(length >= 0);
+    assert(NULL != matrix);
+
+    if (matrix->size > 256) {
+        return NULL;
+    }
+
+    encoded = (parasail_encoded_t*)malloc(sizeof(parasail_encoded_t));
+    assert(encoded);
+
+    encoded->matrix = matrix;
+    encoded->length = length;
+    encoded->bits = matrix->size <= 4 ? 2 : matrix->size <= 16 ? 4 : 8;
+    per_byte = 8 / encoded->bits;
+    encoded->index = (unsigned char*)calloc(
+            (length + per_byte - 1) / per_byte + 1, sizeof(unsigned char));
+    assert(encoded->index);
+
+    for (i=0; i<length; ++i) {
+        int index = matrix->mapper[(unsigned char)s[i]];
+        encoded->index[i / per_byte] |=
+            (unsigned char)(index << (i % per_byte * encoded->bits));
+    }
+
+    return encoded;
+}
+
+void parasail_encoded_free(parasail_encoded_t *encoded)
+{
+    /* validate inputs */
+    assert(NULL != encoded);
+
+    free(encoded->index);
+    free(encoded);
+}
+
+void parasail_encoded_decode(
+        const parasail_encoded_t * const restrict encoded,
+        int * const restrict index)
+{
+    const unsigned char * const restrict packed = encoded->index;
+    const int length = encoded->length;
+    int i = 0;
+
+    switch (encoded->bits) {
+        case 2:
+            for (i=0; i<length; ++i) {
+                index[i] = (packed[i>>2] >> ((i&3)<<1)) & 3;
+            }
+            break;
+        case 4:
+            for (i=0; i<length; ++i) {
+                index[i] = (packed[i>>1] >> ((i&1)<<2)) & 15;
+            }
+            break;
+        default:
+            for (i=0; i<length; ++i) {
+                index[i] = packed[i];
+            }
+            break;
+    }
+}
+
 char* parasail_reverse(const char *s, size_t length)
 {
     char *r = NULL;
@@ -687,6 +1164,16 @@ int parasail_result_get_end_ref(const parasail_result_t * const restrict result)
     return result->end_ref;
 }
 
+int parasail_result_get_begin_query(const parasail_result_t * const restrict result)
+{
+    return result->begin_query;
+}
+
+int parasail_result_get_begin_ref(const parasail_result_t * const restrict result)
+{
+    return result->begin_ref;
+}
+
 int parasail_result_get_matches(const parasail_result_t * const restrict result)
 {
     assert(parasail_result_is_stats(result));
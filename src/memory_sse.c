@@ -165,15 +165,12 @@ parasail_profile_t* parasail_profile_create_sse_128_sat(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile8 = parasail_profile_create_sse_128_8(s1, s1Len, matrix);
-    parasail_profile_t *profile16 = parasail_profile_create_sse_128_16(s1, s1Len, matrix);
-    parasail_profile_t *profile32 = parasail_profile_create_sse_128_32(s1, s1Len, matrix);
-    profile8->profile16 = profile16->profile16;
-    profile8->profile32 = profile32->profile32;
-    free(profile16);
-    free(profile32);
-
-    return profile8;
+    parasail_profile_t *profile = parasail_profile_create_sse_128_8(s1, s1Len, matrix);
+    /* most pairs never saturate, so 16 and 32 wait until needed */
+    parasail_profile_defer(profile, 16, parasail_profile_create_sse_128_16);
+    parasail_profile_defer(profile, 32, parasail_profile_create_sse_128_32);
+
+    return profile;
 }
 
 parasail_profile_t * parasail_profile_create_stats_sse_128_8(
@@ -356,15 +353,11 @@ parasail_profile_t* parasail_profile_create_stats_sse_128_sat(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile8 = parasail_profile_create_stats_sse_128_8(s1, s1Len, matrix);
-    parasail_profile_t *profile16 = parasail_profile_create_stats_sse_128_16(s1, s1Len, matrix);
-    parasail_profile_t *profile32 = parasail_profile_create_stats_sse_128_32(s1, s1Len, matrix);
-    profile8->profile16 = profile16->profile16;
-    profile8->profile32 = profile32->profile32;
-    free(profile16);
-    free(profile32);
-
-    return profile8;
+    parasail_profile_t *profile = parasail_profile_create_stats_sse_128_8(s1, s1Len, matrix);
+    parasail_profile_defer(profile, 16, parasail_profile_create_stats_sse_128_16);
+    parasail_profile_defer(profile, 32, parasail_profile_create_stats_sse_128_32);
+
+    return profile;
 }
 
 void parasail_free___m128i(void *ptr)
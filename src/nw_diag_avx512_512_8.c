@@ -0,0 +1,1032 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define NEG_INF INT8_MIN
+
+#define _mm512_cmpeq_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a,b))
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_insert_epi8_rpl(a,i,imm) _mm512_mask_set1_epi8(a, (__mmask64)1<<(imm), i)
+
+#define _mm512_extract_epi8_rpl(a,imm) (int8_t)_mm_extract_epi8(_mm512_extracti32x4_epi32(a, (imm)>>4), (imm)&15)
+
+#define _mm512_srli_si512_rpl(a,imm) _mm512_alignr_epi8(_mm512_maskz_shuffle_i32x4(0x0FFF, a, a, _MM_SHUFFLE(3,3,2,1)), a, imm)
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (0 <= i+0 && i+0 < s1Len && 0 <= j-0 && j-0 < s2Len) {
+        array[1LL*(i+0)*s2Len + (j-0)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 63);
+    }
+    if (0 <= i+1 && i+1 < s1Len && 0 <= j-1 && j-1 < s2Len) {
+        array[1LL*(i+1)*s2Len + (j-1)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 62);
+    }
+    if (0 <= i+2 && i+2 < s1Len && 0 <= j-2 && j-2 < s2Len) {
+        array[1LL*(i+2)*s2Len + (j-2)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 61);
+    }
+    if (0 <= i+3 && i+3 < s1Len && 0 <= j-3 && j-3 < s2Len) {
+        array[1LL*(i+3)*s2Len + (j-3)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 60);
+    }
+    if (0 <= i+4 && i+4 < s1Len && 0 <= j-4 && j-4 < s2Len) {
+        array[1LL*(i+4)*s2Len + (j-4)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 59);
+    }
+    if (0 <= i+5 && i+5 < s1Len && 0 <= j-5 && j-5 < s2Len) {
+        array[1LL*(i+5)*s2Len + (j-5)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 58);
+    }
+    if (0 <= i+6 && i+6 < s1Len && 0 <= j-6 && j-6 < s2Len) {
+        array[1LL*(i+6)*s2Len + (j-6)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 57);
+    }
+    if (0 <= i+7 && i+7 < s1Len && 0 <= j-7 && j-7 < s2Len) {
+        array[1LL*(i+7)*s2Len + (j-7)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 56);
+    }
+    if (0 <= i+8 && i+8 < s1Len && 0 <= j-8 && j-8 < s2Len) {
+        array[1LL*(i+8)*s2Len + (j-8)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 55);
+    }
+    if (0 <= i+9 && i+9 < s1Len && 0 <= j-9 && j-9 < s2Len) {
+        array[1LL*(i+9)*s2Len + (j-9)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 54);
+    }
+    if (0 <= i+10 && i+10 < s1Len && 0 <= j-10 && j-10 < s2Len) {
+        array[1LL*(i+10)*s2Len + (j-10)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 53);
+    }
+    if (0 <= i+11 && i+11 < s1Len && 0 <= j-11 && j-11 < s2Len) {
+        array[1LL*(i+11)*s2Len + (j-11)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 52);
+    }
+    if (0 <= i+12 && i+12 < s1Len && 0 <= j-12 && j-12 < s2Len) {
+        array[1LL*(i+12)*s2Len + (j-12)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 51);
+    }
+    if (0 <= i+13 && i+13 < s1Len && 0 <= j-13 && j-13 < s2Len) {
+        array[1LL*(i+13)*s2Len + (j-13)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 50);
+    }
+    if (0 <= i+14 && i+14 < s1Len && 0 <= j-14 && j-14 < s2Len) {
+        array[1LL*(i+14)*s2Len + (j-14)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 49);
+    }
+    if (0 <= i+15 && i+15 < s1Len && 0 <= j-15 && j-15 < s2Len) {
+        array[1LL*(i+15)*s2Len + (j-15)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 48);
+    }
+    if (0 <= i+16 && i+16 < s1Len && 0 <= j-16 && j-16 < s2Len) {
+        array[1LL*(i+16)*s2Len + (j-16)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 47);
+    }
+    if (0 <= i+17 && i+17 < s1Len && 0 <= j-17 && j-17 < s2Len) {
+        array[1LL*(i+17)*s2Len + (j-17)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 46);
+    }
+    if (0 <= i+18 && i+18 < s1Len && 0 <= j-18 && j-18 < s2Len) {
+        array[1LL*(i+18)*s2Len + (j-18)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 45);
+    }
+    if (0 <= i+19 && i+19 < s1Len && 0 <= j-19 && j-19 < s2Len) {
+        array[1LL*(i+19)*s2Len + (j-19)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 44);
+    }
+    if (0 <= i+20 && i+20 < s1Len && 0 <= j-20 && j-20 < s2Len) {
+        array[1LL*(i+20)*s2Len + (j-20)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 43);
+    }
+    if (0 <= i+21 && i+21 < s1Len && 0 <= j-21 && j-21 < s2Len) {
+        array[1LL*(i+21)*s2Len + (j-21)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 42);
+    }
+    if (0 <= i+22 && i+22 < s1Len && 0 <= j-22 && j-22 < s2Len) {
+        array[1LL*(i+22)*s2Len + (j-22)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 41);
+    }
+    if (0 <= i+23 && i+23 < s1Len && 0 <= j-23 && j-23 < s2Len) {
+        array[1LL*(i+23)*s2Len + (j-23)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 40);
+    }
+    if (0 <= i+24 && i+24 < s1Len && 0 <= j-24 && j-24 < s2Len) {
+        array[1LL*(i+24)*s2Len + (j-24)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 39);
+    }
+    if (0 <= i+25 && i+25 < s1Len && 0 <= j-25 && j-25 < s2Len) {
+        array[1LL*(i+25)*s2Len + (j-25)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 38);
+    }
+    if (0 <= i+26 && i+26 < s1Len && 0 <= j-26 && j-26 < s2Len) {
+        array[1LL*(i+26)*s2Len + (j-26)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 37);
+    }
+    if (0 <= i+27 && i+27 < s1Len && 0 <= j-27 && j-27 < s2Len) {
+        array[1LL*(i+27)*s2Len + (j-27)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 36);
+    }
+    if (0 <= i+28 && i+28 < s1Len && 0 <= j-28 && j-28 < s2Len) {
+        array[1LL*(i+28)*s2Len + (j-28)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 35);
+    }
+    if (0 <= i+29 && i+29 < s1Len && 0 <= j-29 && j-29 < s2Len) {
+        array[1LL*(i+29)*s2Len + (j-29)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 34);
+    }
+    if (0 <= i+30 && i+30 < s1Len && 0 <= j-30 && j-30 < s2Len) {
+        array[1LL*(i+30)*s2Len + (j-30)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 33);
+    }
+    if (0 <= i+31 && i+31 < s1Len && 0 <= j-31 && j-31 < s2Len) {
+        array[1LL*(i+31)*s2Len + (j-31)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 32);
+    }
+    if (0 <= i+32 && i+32 < s1Len && 0 <= j-32 && j-32 < s2Len) {
+        array[1LL*(i+32)*s2Len + (j-32)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 31);
+    }
+    if (0 <= i+33 && i+33 < s1Len && 0 <= j-33 && j-33 < s2Len) {
+        array[1LL*(i+33)*s2Len + (j-33)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 30);
+    }
+    if (0 <= i+34 && i+34 < s1Len && 0 <= j-34 && j-34 < s2Len) {
+        array[1LL*(i+34)*s2Len + (j-34)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 29);
+    }
+    if (0 <= i+35 && i+35 < s1Len && 0 <= j-35 && j-35 < s2Len) {
+        array[1LL*(i+35)*s2Len + (j-35)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 28);
+    }
+    if (0 <= i+36 && i+36 < s1Len && 0 <= j-36 && j-36 < s2Len) {
+        array[1LL*(i+36)*s2Len + (j-36)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 27);
+    }
+    if (0 <= i+37 && i+37 < s1Len && 0 <= j-37 && j-37 < s2Len) {
+        array[1LL*(i+37)*s2Len + (j-37)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 26);
+    }
+    if (0 <= i+38 && i+38 < s1Len && 0 <= j-38 && j-38 < s2Len) {
+        array[1LL*(i+38)*s2Len + (j-38)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 25);
+    }
+    if (0 <= i+39 && i+39 < s1Len && 0 <= j-39 && j-39 < s2Len) {
+        array[1LL*(i+39)*s2Len + (j-39)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 24);
+    }
+    if (0 <= i+40 && i+40 < s1Len && 0 <= j-40 && j-40 < s2Len) {
+        array[1LL*(i+40)*s2Len + (j-40)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 23);
+    }
+    if (0 <= i+41 && i+41 < s1Len && 0 <= j-41 && j-41 < s2Len) {
+        array[1LL*(i+41)*s2Len + (j-41)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 22);
+    }
+    if (0 <= i+42 && i+42 < s1Len && 0 <= j-42 && j-42 < s2Len) {
+        array[1LL*(i+42)*s2Len + (j-42)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 21);
+    }
+    if (0 <= i+43 && i+43 < s1Len && 0 <= j-43 && j-43 < s2Len) {
+        array[1LL*(i+43)*s2Len + (j-43)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 20);
+    }
+    if (0 <= i+44 && i+44 < s1Len && 0 <= j-44 && j-44 < s2Len) {
+        array[1LL*(i+44)*s2Len + (j-44)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 19);
+    }
+    if (0 <= i+45 && i+45 < s1Len && 0 <= j-45 && j-45 < s2Len) {
+        array[1LL*(i+45)*s2Len + (j-45)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 18);
+    }
+    if (0 <= i+46 && i+46 < s1Len && 0 <= j-46 && j-46 < s2Len) {
+        array[1LL*(i+46)*s2Len + (j-46)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 17);
+    }
+    if (0 <= i+47 && i+47 < s1Len && 0 <= j-47 && j-47 < s2Len) {
+        array[1LL*(i+47)*s2Len + (j-47)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 16);
+    }
+    if (0 <= i+48 && i+48 < s1Len && 0 <= j-48 && j-48 < s2Len) {
+        array[1LL*(i+48)*s2Len + (j-48)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 15);
+    }
+    if (0 <= i+49 && i+49 < s1Len && 0 <= j-49 && j-49 < s2Len) {
+        array[1LL*(i+49)*s2Len + (j-49)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 14);
+    }
+    if (0 <= i+50 && i+50 < s1Len && 0 <= j-50 && j-50 < s2Len) {
+        array[1LL*(i+50)*s2Len + (j-50)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 13);
+    }
+    if (0 <= i+51 && i+51 < s1Len && 0 <= j-51 && j-51 < s2Len) {
+        array[1LL*(i+51)*s2Len + (j-51)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 12);
+    }
+    if (0 <= i+52 && i+52 < s1Len && 0 <= j-52 && j-52 < s2Len) {
+        array[1LL*(i+52)*s2Len + (j-52)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 11);
+    }
+    if (0 <= i+53 && i+53 < s1Len && 0 <= j-53 && j-53 < s2Len) {
+        array[1LL*(i+53)*s2Len + (j-53)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 10);
+    }
+    if (0 <= i+54 && i+54 < s1Len && 0 <= j-54 && j-54 < s2Len) {
+        array[1LL*(i+54)*s2Len + (j-54)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 9);
+    }
+    if (0 <= i+55 && i+55 < s1Len && 0 <= j-55 && j-55 < s2Len) {
+        array[1LL*(i+55)*s2Len + (j-55)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 8);
+    }
+    if (0 <= i+56 && i+56 < s1Len && 0 <= j-56 && j-56 < s2Len) {
+        array[1LL*(i+56)*s2Len + (j-56)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 7);
+    }
+    if (0 <= i+57 && i+57 < s1Len && 0 <= j-57 && j-57 < s2Len) {
+        array[1LL*(i+57)*s2Len + (j-57)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 6);
+    }
+    if (0 <= i+58 && i+58 < s1Len && 0 <= j-58 && j-58 < s2Len) {
+        array[1LL*(i+58)*s2Len + (j-58)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 5);
+    }
+    if (0 <= i+59 && i+59 < s1Len && 0 <= j-59 && j-59 < s2Len) {
+        array[1LL*(i+59)*s2Len + (j-59)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 4);
+    }
+    if (0 <= i+60 && i+60 < s1Len && 0 <= j-60 && j-60 < s2Len) {
+        array[1LL*(i+60)*s2Len + (j-60)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 3);
+    }
+    if (0 <= i+61 && i+61 < s1Len && 0 <= j-61 && j-61 < s2Len) {
+        array[1LL*(i+61)*s2Len + (j-61)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 2);
+    }
+    if (0 <= i+62 && i+62 < s1Len && 0 <= j-62 && j-62 < s2Len) {
+        array[1LL*(i+62)*s2Len + (j-62)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 1);
+    }
+    if (0 <= i+63 && i+63 < s1Len && 0 <= j-63 && j-63 < s2Len) {
+        array[1LL*(i+63)*s2Len + (j-63)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_rowcol(
+        int *row,
+        int *col,
+        __m512i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (i+0 == s1Len-1 && 0 <= j-0 && j-0 < s2Len) {
+        row[j-0] = (int8_t)_mm512_extract_epi8_rpl(vWH, 63);
+    }
+    if (j-0 == s2Len-1 && 0 <= i+0 && i+0 < s1Len) {
+        col[(i+0)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 63);
+    }
+    if (i+1 == s1Len-1 && 0 <= j-1 && j-1 < s2Len) {
+        row[j-1] = (int8_t)_mm512_extract_epi8_rpl(vWH, 62);
+    }
+    if (j-1 == s2Len-1 && 0 <= i+1 && i+1 < s1Len) {
+        col[(i+1)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 62);
+    }
+    if (i+2 == s1Len-1 && 0 <= j-2 && j-2 < s2Len) {
+        row[j-2] = (int8_t)_mm512_extract_epi8_rpl(vWH, 61);
+    }
+    if (j-2 == s2Len-1 && 0 <= i+2 && i+2 < s1Len) {
+        col[(i+2)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 61);
+    }
+    if (i+3 == s1Len-1 && 0 <= j-3 && j-3 < s2Len) {
+        row[j-3] = (int8_t)_mm512_extract_epi8_rpl(vWH, 60);
+    }
+    if (j-3 == s2Len-1 && 0 <= i+3 && i+3 < s1Len) {
+        col[(i+3)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 60);
+    }
+    if (i+4 == s1Len-1 && 0 <= j-4 && j-4 < s2Len) {
+        row[j-4] = (int8_t)_mm512_extract_epi8_rpl(vWH, 59);
+    }
+    if (j-4 == s2Len-1 && 0 <= i+4 && i+4 < s1Len) {
+        col[(i+4)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 59);
+    }
+    if (i+5 == s1Len-1 && 0 <= j-5 && j-5 < s2Len) {
+        row[j-5] = (int8_t)_mm512_extract_epi8_rpl(vWH, 58);
+    }
+    if (j-5 == s2Len-1 && 0 <= i+5 && i+5 < s1Len) {
+        col[(i+5)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 58);
+    }
+    if (i+6 == s1Len-1 && 0 <= j-6 && j-6 < s2Len) {
+        row[j-6] = (int8_t)_mm512_extract_epi8_rpl(vWH, 57);
+    }
+    if (j-6 == s2Len-1 && 0 <= i+6 && i+6 < s1Len) {
+        col[(i+6)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 57);
+    }
+    if (i+7 == s1Len-1 && 0 <= j-7 && j-7 < s2Len) {
+        row[j-7] = (int8_t)_mm512_extract_epi8_rpl(vWH, 56);
+    }
+    if (j-7 == s2Len-1 && 0 <= i+7 && i+7 < s1Len) {
+        col[(i+7)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 56);
+    }
+    if (i+8 == s1Len-1 && 0 <= j-8 && j-8 < s2Len) {
+        row[j-8] = (int8_t)_mm512_extract_epi8_rpl(vWH, 55);
+    }
+    if (j-8 == s2Len-1 && 0 <= i+8 && i+8 < s1Len) {
+        col[(i+8)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 55);
+    }
+    if (i+9 == s1Len-1 && 0 <= j-9 && j-9 < s2Len) {
+        row[j-9] = (int8_t)_mm512_extract_epi8_rpl(vWH, 54);
+    }
+    if (j-9 == s2Len-1 && 0 <= i+9 && i+9 < s1Len) {
+        col[(i+9)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 54);
+    }
+    if (i+10 == s1Len-1 && 0 <= j-10 && j-10 < s2Len) {
+        row[j-10] = (int8_t)_mm512_extract_epi8_rpl(vWH, 53);
+    }
+    if (j-10 == s2Len-1 && 0 <= i+10 && i+10 < s1Len) {
+        col[(i+10)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 53);
+    }
+    if (i+11 == s1Len-1 && 0 <= j-11 && j-11 < s2Len) {
+        row[j-11] = (int8_t)_mm512_extract_epi8_rpl(vWH, 52);
+    }
+    if (j-11 == s2Len-1 && 0 <= i+11 && i+11 < s1Len) {
+        col[(i+11)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 52);
+    }
+    if (i+12 == s1Len-1 && 0 <= j-12 && j-12 < s2Len) {
+        row[j-12] = (int8_t)_mm512_extract_epi8_rpl(vWH, 51);
+    }
+    if (j-12 == s2Len-1 && 0 <= i+12 && i+12 < s1Len) {
+        col[(i+12)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 51);
+    }
+    if (i+13 == s1Len-1 && 0 <= j-13 && j-13 < s2Len) {
+        row[j-13] = (int8_t)_mm512_extract_epi8_rpl(vWH, 50);
+    }
+    if (j-13 == s2Len-1 && 0 <= i+13 && i+13 < s1Len) {
+        col[(i+13)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 50);
+    }
+    if (i+14 == s1Len-1 && 0 <= j-14 && j-14 < s2Len) {
+        row[j-14] = (int8_t)_mm512_extract_epi8_rpl(vWH, 49);
+    }
+    if (j-14 == s2Len-1 && 0 <= i+14 && i+14 < s1Len) {
+        col[(i+14)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 49);
+    }
+    if (i+15 == s1Len-1 && 0 <= j-15 && j-15 < s2Len) {
+        row[j-15] = (int8_t)_mm512_extract_epi8_rpl(vWH, 48);
+    }
+    if (j-15 == s2Len-1 && 0 <= i+15 && i+15 < s1Len) {
+        col[(i+15)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 48);
+    }
+    if (i+16 == s1Len-1 && 0 <= j-16 && j-16 < s2Len) {
+        row[j-16] = (int8_t)_mm512_extract_epi8_rpl(vWH, 47);
+    }
+    if (j-16 == s2Len-1 && 0 <= i+16 && i+16 < s1Len) {
+        col[(i+16)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 47);
+    }
+    if (i+17 == s1Len-1 && 0 <= j-17 && j-17 < s2Len) {
+        row[j-17] = (int8_t)_mm512_extract_epi8_rpl(vWH, 46);
+    }
+    if (j-17 == s2Len-1 && 0 <= i+17 && i+17 < s1Len) {
+        col[(i+17)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 46);
+    }
+    if (i+18 == s1Len-1 && 0 <= j-18 && j-18 < s2Len) {
+        row[j-18] = (int8_t)_mm512_extract_epi8_rpl(vWH, 45);
+    }
+    if (j-18 == s2Len-1 && 0 <= i+18 && i+18 < s1Len) {
+        col[(i+18)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 45);
+    }
+    if (i+19 == s1Len-1 && 0 <= j-19 && j-19 < s2Len) {
+        row[j-19] = (int8_t)_mm512_extract_epi8_rpl(vWH, 44);
+    }
+    if (j-19 == s2Len-1 && 0 <= i+19 && i+19 < s1Len) {
+        col[(i+19)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 44);
+    }
+    if (i+20 == s1Len-1 && 0 <= j-20 && j-20 < s2Len) {
+        row[j-20] = (int8_t)_mm512_extract_epi8_rpl(vWH, 43);
+    }
+    if (j-20 == s2Len-1 && 0 <= i+20 && i+20 < s1Len) {
+        col[(i+20)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 43);
+    }
+    if (i+21 == s1Len-1 && 0 <= j-21 && j-21 < s2Len) {
+        row[j-21] = (int8_t)_mm512_extract_epi8_rpl(vWH, 42);
+    }
+    if (j-21 == s2Len-1 && 0 <= i+21 && i+21 < s1Len) {
+        col[(i+21)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 42);
+    }
+    if (i+22 == s1Len-1 && 0 <= j-22 && j-22 < s2Len) {
+        row[j-22] = (int8_t)_mm512_extract_epi8_rpl(vWH, 41);
+    }
+    if (j-22 == s2Len-1 && 0 <= i+22 && i+22 < s1Len) {
+        col[(i+22)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 41);
+    }
+    if (i+23 == s1Len-1 && 0 <= j-23 && j-23 < s2Len) {
+        row[j-23] = (int8_t)_mm512_extract_epi8_rpl(vWH, 40);
+    }
+    if (j-23 == s2Len-1 && 0 <= i+23 && i+23 < s1Len) {
+        col[(i+23)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 40);
+    }
+    if (i+24 == s1Len-1 && 0 <= j-24 && j-24 < s2Len) {
+        row[j-24] = (int8_t)_mm512_extract_epi8_rpl(vWH, 39);
+    }
+    if (j-24 == s2Len-1 && 0 <= i+24 && i+24 < s1Len) {
+        col[(i+24)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 39);
+    }
+    if (i+25 == s1Len-1 && 0 <= j-25 && j-25 < s2Len) {
+        row[j-25] = (int8_t)_mm512_extract_epi8_rpl(vWH, 38);
+    }
+    if (j-25 == s2Len-1 && 0 <= i+25 && i+25 < s1Len) {
+        col[(i+25)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 38);
+    }
+    if (i+26 == s1Len-1 && 0 <= j-26 && j-26 < s2Len) {
+        row[j-26] = (int8_t)_mm512_extract_epi8_rpl(vWH, 37);
+    }
+    if (j-26 == s2Len-1 && 0 <= i+26 && i+26 < s1Len) {
+        col[(i+26)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 37);
+    }
+    if (i+27 == s1Len-1 && 0 <= j-27 && j-27 < s2Len) {
+        row[j-27] = (int8_t)_mm512_extract_epi8_rpl(vWH, 36);
+    }
+    if (j-27 == s2Len-1 && 0 <= i+27 && i+27 < s1Len) {
+        col[(i+27)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 36);
+    }
+    if (i+28 == s1Len-1 && 0 <= j-28 && j-28 < s2Len) {
+        row[j-28] = (int8_t)_mm512_extract_epi8_rpl(vWH, 35);
+    }
+    if (j-28 == s2Len-1 && 0 <= i+28 && i+28 < s1Len) {
+        col[(i+28)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 35);
+    }
+    if (i+29 == s1Len-1 && 0 <= j-29 && j-29 < s2Len) {
+        row[j-29] = (int8_t)_mm512_extract_epi8_rpl(vWH, 34);
+    }
+    if (j-29 == s2Len-1 && 0 <= i+29 && i+29 < s1Len) {
+        col[(i+29)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 34);
+    }
+    if (i+30 == s1Len-1 && 0 <= j-30 && j-30 < s2Len) {
+        row[j-30] = (int8_t)_mm512_extract_epi8_rpl(vWH, 33);
+    }
+    if (j-30 == s2Len-1 && 0 <= i+30 && i+30 < s1Len) {
+        col[(i+30)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 33);
+    }
+    if (i+31 == s1Len-1 && 0 <= j-31 && j-31 < s2Len) {
+        row[j-31] = (int8_t)_mm512_extract_epi8_rpl(vWH, 32);
+    }
+    if (j-31 == s2Len-1 && 0 <= i+31 && i+31 < s1Len) {
+        col[(i+31)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 32);
+    }
+    if (i+32 == s1Len-1 && 0 <= j-32 && j-32 < s2Len) {
+        row[j-32] = (int8_t)_mm512_extract_epi8_rpl(vWH, 31);
+    }
+    if (j-32 == s2Len-1 && 0 <= i+32 && i+32 < s1Len) {
+        col[(i+32)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 31);
+    }
+    if (i+33 == s1Len-1 && 0 <= j-33 && j-33 < s2Len) {
+        row[j-33] = (int8_t)_mm512_extract_epi8_rpl(vWH, 30);
+    }
+    if (j-33 == s2Len-1 && 0 <= i+33 && i+33 < s1Len) {
+        col[(i+33)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 30);
+    }
+    if (i+34 == s1Len-1 && 0 <= j-34 && j-34 < s2Len) {
+        row[j-34] = (int8_t)_mm512_extract_epi8_rpl(vWH, 29);
+    }
+    if (j-34 == s2Len-1 && 0 <= i+34 && i+34 < s1Len) {
+        col[(i+34)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 29);
+    }
+    if (i+35 == s1Len-1 && 0 <= j-35 && j-35 < s2Len) {
+        row[j-35] = (int8_t)_mm512_extract_epi8_rpl(vWH, 28);
+    }
+    if (j-35 == s2Len-1 && 0 <= i+35 && i+35 < s1Len) {
+        col[(i+35)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 28);
+    }
+    if (i+36 == s1Len-1 && 0 <= j-36 && j-36 < s2Len) {
+        row[j-36] = (int8_t)_mm512_extract_epi8_rpl(vWH, 27);
+    }
+    if (j-36 == s2Len-1 && 0 <= i+36 && i+36 < s1Len) {
+        col[(i+36)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 27);
+    }
+    if (i+37 == s1Len-1 && 0 <= j-37 && j-37 < s2Len) {
+        row[j-37] = (int8_t)_mm512_extract_epi8_rpl(vWH, 26);
+    }
+    if (j-37 == s2Len-1 && 0 <= i+37 && i+37 < s1Len) {
+        col[(i+37)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 26);
+    }
+    if (i+38 == s1Len-1 && 0 <= j-38 && j-38 < s2Len) {
+        row[j-38] = (int8_t)_mm512_extract_epi8_rpl(vWH, 25);
+    }
+    if (j-38 == s2Len-1 && 0 <= i+38 && i+38 < s1Len) {
+        col[(i+38)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 25);
+    }
+    if (i+39 == s1Len-1 && 0 <= j-39 && j-39 < s2Len) {
+        row[j-39] = (int8_t)_mm512_extract_epi8_rpl(vWH, 24);
+    }
+    if (j-39 == s2Len-1 && 0 <= i+39 && i+39 < s1Len) {
+        col[(i+39)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 24);
+    }
+    if (i+40 == s1Len-1 && 0 <= j-40 && j-40 < s2Len) {
+        row[j-40] = (int8_t)_mm512_extract_epi8_rpl(vWH, 23);
+    }
+    if (j-40 == s2Len-1 && 0 <= i+40 && i+40 < s1Len) {
+        col[(i+40)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 23);
+    }
+    if (i+41 == s1Len-1 && 0 <= j-41 && j-41 < s2Len) {
+        row[j-41] = (int8_t)_mm512_extract_epi8_rpl(vWH, 22);
+    }
+    if (j-41 == s2Len-1 && 0 <= i+41 && i+41 < s1Len) {
+        col[(i+41)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 22);
+    }
+    if (i+42 == s1Len-1 && 0 <= j-42 && j-42 < s2Len) {
+        row[j-42] = (int8_t)_mm512_extract_epi8_rpl(vWH, 21);
+    }
+    if (j-42 == s2Len-1 && 0 <= i+42 && i+42 < s1Len) {
+        col[(i+42)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 21);
+    }
+    if (i+43 == s1Len-1 && 0 <= j-43 && j-43 < s2Len) {
+        row[j-43] = (int8_t)_mm512_extract_epi8_rpl(vWH, 20);
+    }
+    if (j-43 == s2Len-1 && 0 <= i+43 && i+43 < s1Len) {
+        col[(i+43)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 20);
+    }
+    if (i+44 == s1Len-1 && 0 <= j-44 && j-44 < s2Len) {
+        row[j-44] = (int8_t)_mm512_extract_epi8_rpl(vWH, 19);
+    }
+    if (j-44 == s2Len-1 && 0 <= i+44 && i+44 < s1Len) {
+        col[(i+44)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 19);
+    }
+    if (i+45 == s1Len-1 && 0 <= j-45 && j-45 < s2Len) {
+        row[j-45] = (int8_t)_mm512_extract_epi8_rpl(vWH, 18);
+    }
+    if (j-45 == s2Len-1 && 0 <= i+45 && i+45 < s1Len) {
+        col[(i+45)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 18);
+    }
+    if (i+46 == s1Len-1 && 0 <= j-46 && j-46 < s2Len) {
+        row[j-46] = (int8_t)_mm512_extract_epi8_rpl(vWH, 17);
+    }
+    if (j-46 == s2Len-1 && 0 <= i+46 && i+46 < s1Len) {
+        col[(i+46)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 17);
+    }
+    if (i+47 == s1Len-1 && 0 <= j-47 && j-47 < s2Len) {
+        row[j-47] = (int8_t)_mm512_extract_epi8_rpl(vWH, 16);
+    }
+    if (j-47 == s2Len-1 && 0 <= i+47 && i+47 < s1Len) {
+        col[(i+47)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 16);
+    }
+    if (i+48 == s1Len-1 && 0 <= j-48 && j-48 < s2Len) {
+        row[j-48] = (int8_t)_mm512_extract_epi8_rpl(vWH, 15);
+    }
+    if (j-48 == s2Len-1 && 0 <= i+48 && i+48 < s1Len) {
+        col[(i+48)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 15);
+    }
+    if (i+49 == s1Len-1 && 0 <= j-49 && j-49 < s2Len) {
+        row[j-49] = (int8_t)_mm512_extract_epi8_rpl(vWH, 14);
+    }
+    if (j-49 == s2Len-1 && 0 <= i+49 && i+49 < s1Len) {
+        col[(i+49)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 14);
+    }
+    if (i+50 == s1Len-1 && 0 <= j-50 && j-50 < s2Len) {
+        row[j-50] = (int8_t)_mm512_extract_epi8_rpl(vWH, 13);
+    }
+    if (j-50 == s2Len-1 && 0 <= i+50 && i+50 < s1Len) {
+        col[(i+50)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 13);
+    }
+    if (i+51 == s1Len-1 && 0 <= j-51 && j-51 < s2Len) {
+        row[j-51] = (int8_t)_mm512_extract_epi8_rpl(vWH, 12);
+    }
+    if (j-51 == s2Len-1 && 0 <= i+51 && i+51 < s1Len) {
+        col[(i+51)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 12);
+    }
+    if (i+52 == s1Len-1 && 0 <= j-52 && j-52 < s2Len) {
+        row[j-52] = (int8_t)_mm512_extract_epi8_rpl(vWH, 11);
+    }
+    if (j-52 == s2Len-1 && 0 <= i+52 && i+52 < s1Len) {
+        col[(i+52)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 11);
+    }
+    if (i+53 == s1Len-1 && 0 <= j-53 && j-53 < s2Len) {
+        row[j-53] = (int8_t)_mm512_extract_epi8_rpl(vWH, 10);
+    }
+    if (j-53 == s2Len-1 && 0 <= i+53 && i+53 < s1Len) {
+        col[(i+53)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 10);
+    }
+    if (i+54 == s1Len-1 && 0 <= j-54 && j-54 < s2Len) {
+        row[j-54] = (int8_t)_mm512_extract_epi8_rpl(vWH, 9);
+    }
+    if (j-54 == s2Len-1 && 0 <= i+54 && i+54 < s1Len) {
+        col[(i+54)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 9);
+    }
+    if (i+55 == s1Len-1 && 0 <= j-55 && j-55 < s2Len) {
+        row[j-55] = (int8_t)_mm512_extract_epi8_rpl(vWH, 8);
+    }
+    if (j-55 == s2Len-1 && 0 <= i+55 && i+55 < s1Len) {
+        col[(i+55)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 8);
+    }
+    if (i+56 == s1Len-1 && 0 <= j-56 && j-56 < s2Len) {
+        row[j-56] = (int8_t)_mm512_extract_epi8_rpl(vWH, 7);
+    }
+    if (j-56 == s2Len-1 && 0 <= i+56 && i+56 < s1Len) {
+        col[(i+56)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 7);
+    }
+    if (i+57 == s1Len-1 && 0 <= j-57 && j-57 < s2Len) {
+        row[j-57] = (int8_t)_mm512_extract_epi8_rpl(vWH, 6);
+    }
+    if (j-57 == s2Len-1 && 0 <= i+57 && i+57 < s1Len) {
+        col[(i+57)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 6);
+    }
+    if (i+58 == s1Len-1 && 0 <= j-58 && j-58 < s2Len) {
+        row[j-58] = (int8_t)_mm512_extract_epi8_rpl(vWH, 5);
+    }
+    if (j-58 == s2Len-1 && 0 <= i+58 && i+58 < s1Len) {
+        col[(i+58)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 5);
+    }
+    if (i+59 == s1Len-1 && 0 <= j-59 && j-59 < s2Len) {
+        row[j-59] = (int8_t)_mm512_extract_epi8_rpl(vWH, 4);
+    }
+    if (j-59 == s2Len-1 && 0 <= i+59 && i+59 < s1Len) {
+        col[(i+59)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 4);
+    }
+    if (i+60 == s1Len-1 && 0 <= j-60 && j-60 < s2Len) {
+        row[j-60] = (int8_t)_mm512_extract_epi8_rpl(vWH, 3);
+    }
+    if (j-60 == s2Len-1 && 0 <= i+60 && i+60 < s1Len) {
+        col[(i+60)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 3);
+    }
+    if (i+61 == s1Len-1 && 0 <= j-61 && j-61 < s2Len) {
+        row[j-61] = (int8_t)_mm512_extract_epi8_rpl(vWH, 2);
+    }
+    if (j-61 == s2Len-1 && 0 <= i+61 && i+61 < s1Len) {
+        col[(i+61)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 2);
+    }
+    if (i+62 == s1Len-1 && 0 <= j-62 && j-62 < s2Len) {
+        row[j-62] = (int8_t)_mm512_extract_epi8_rpl(vWH, 1);
+    }
+    if (j-62 == s2Len-1 && 0 <= i+62 && i+62 < s1Len) {
+        col[(i+62)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 1);
+    }
+    if (i+63 == s1Len-1 && 0 <= j-63 && j-63 < s2Len) {
+        row[j-63] = (int8_t)_mm512_extract_epi8_rpl(vWH, 0);
+    }
+    if (j-63 == s2Len-1 && 0 <= i+63 && i+63 < s1Len) {
+        col[(i+63)] = (int8_t)_mm512_extract_epi8_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_diag_avx512_512_8
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_diag_avx512_512_8
+#else
+#define FNAME parasail_nw_diag_avx512_512_8
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 64; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    int8_t * const restrict s1 = parasail_memalign_int8_t(64, s1Len+PAD);
+    int8_t * const restrict s2B= parasail_memalign_int8_t(64, s2Len+PAD2);
+    int8_t * const restrict _H_pr = parasail_memalign_int8_t(64, s2Len+PAD2);
+    int8_t * const restrict _F_pr = parasail_memalign_int8_t(64, s2Len+PAD2);
+    int8_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int8_t * const restrict H_pr = _H_pr+PAD;
+    int8_t * const restrict F_pr = _F_pr+PAD;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int8_t score = NEG_INF;
+    __m512i vNegInf = _mm512_set1_epi8(NEG_INF);
+    __m512i vOpen = _mm512_set1_epi8(open);
+    __m512i vGap  = _mm512_set1_epi8(gap);
+    __m512i vOne = _mm512_set1_epi8(1);
+    __m512i vN = _mm512_set1_epi8(N);
+    __m512i vGapN = _mm512_set1_epi8(gap*N);
+    __m512i vNegOne = _mm512_set1_epi8(-1);
+    __m512i vI = _mm512_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63);
+    __m512i vJreset = _mm512_set_epi8(0,-1,-2,-3,-4,-5,-6,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-17,-18,-19,-20,-21,-22,-23,-24,-25,-26,-27,-28,-29,-30,-31,-32,-33,-34,-35,-36,-37,-38,-39,-40,-41,-42,-43,-44,-45,-46,-47,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-59,-60,-61,-62,-63);
+    __m512i vMax = vNegInf;
+    __m512i vILimit = _mm512_set1_epi8(s1Len);
+    __m512i vILimit1 = _mm512_subs_epi8(vILimit, vOne);
+    __m512i vJLimit = _mm512_set1_epi8(s2Len);
+    __m512i vJLimit1 = _mm512_subs_epi8(vJLimit, vOne);
+    __m512i vIBoundary = _mm512_set_epi8(
+            -open-0*gap,
+            -open-1*gap,
+            -open-2*gap,
+            -open-3*gap,
+            -open-4*gap,
+            -open-5*gap,
+            -open-6*gap,
+            -open-7*gap,
+            -open-8*gap,
+            -open-9*gap,
+            -open-10*gap,
+            -open-11*gap,
+            -open-12*gap,
+            -open-13*gap,
+            -open-14*gap,
+            -open-15*gap,
+            -open-16*gap,
+            -open-17*gap,
+            -open-18*gap,
+            -open-19*gap,
+            -open-20*gap,
+            -open-21*gap,
+            -open-22*gap,
+            -open-23*gap,
+            -open-24*gap,
+            -open-25*gap,
+            -open-26*gap,
+            -open-27*gap,
+            -open-28*gap,
+            -open-29*gap,
+            -open-30*gap,
+            -open-31*gap,
+            -open-32*gap,
+            -open-33*gap,
+            -open-34*gap,
+            -open-35*gap,
+            -open-36*gap,
+            -open-37*gap,
+            -open-38*gap,
+            -open-39*gap,
+            -open-40*gap,
+            -open-41*gap,
+            -open-42*gap,
+            -open-43*gap,
+            -open-44*gap,
+            -open-45*gap,
+            -open-46*gap,
+            -open-47*gap,
+            -open-48*gap,
+            -open-49*gap,
+            -open-50*gap,
+            -open-51*gap,
+            -open-52*gap,
+            -open-53*gap,
+            -open-54*gap,
+            -open-55*gap,
+            -open-56*gap,
+            -open-57*gap,
+            -open-58*gap,
+            -open-59*gap,
+            -open-60*gap,
+            -open-61*gap,
+            -open-62*gap,
+            -open-63*gap
+            );
+    __m512i vNegLimit = _mm512_set1_epi8(INT8_MIN);
+    __m512i vPosLimit = _mm512_set1_epi8(INT8_MAX);
+    __m512i vSaturationCheckMin = vPosLimit;
+    __m512i vSaturationCheckMax = vNegLimit;
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = -open - j*gap;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        __m512i vNH = vNegInf;
+        __m512i vWH = vNegInf;
+        __m512i vE = vNegInf;
+        __m512i vF = vNegInf;
+        __m512i vJ = vJreset;
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        const int * const restrict matrow8 = &matrix->matrix[matrix->size*s1[i+8]];
+        const int * const restrict matrow9 = &matrix->matrix[matrix->size*s1[i+9]];
+        const int * const restrict matrow10 = &matrix->matrix[matrix->size*s1[i+10]];
+        const int * const restrict matrow11 = &matrix->matrix[matrix->size*s1[i+11]];
+        const int * const restrict matrow12 = &matrix->matrix[matrix->size*s1[i+12]];
+        const int * const restrict matrow13 = &matrix->matrix[matrix->size*s1[i+13]];
+        const int * const restrict matrow14 = &matrix->matrix[matrix->size*s1[i+14]];
+        const int * const restrict matrow15 = &matrix->matrix[matrix->size*s1[i+15]];
+        const int * const restrict matrow16 = &matrix->matrix[matrix->size*s1[i+16]];
+        const int * const restrict matrow17 = &matrix->matrix[matrix->size*s1[i+17]];
+        const int * const restrict matrow18 = &matrix->matrix[matrix->size*s1[i+18]];
+        const int * const restrict matrow19 = &matrix->matrix[matrix->size*s1[i+19]];
+        const int * const restrict matrow20 = &matrix->matrix[matrix->size*s1[i+20]];
+        const int * const restrict matrow21 = &matrix->matrix[matrix->size*s1[i+21]];
+        const int * const restrict matrow22 = &matrix->matrix[matrix->size*s1[i+22]];
+        const int * const restrict matrow23 = &matrix->matrix[matrix->size*s1[i+23]];
+        const int * const restrict matrow24 = &matrix->matrix[matrix->size*s1[i+24]];
+        const int * const restrict matrow25 = &matrix->matrix[matrix->size*s1[i+25]];
+        const int * const restrict matrow26 = &matrix->matrix[matrix->size*s1[i+26]];
+        const int * const restrict matrow27 = &matrix->matrix[matrix->size*s1[i+27]];
+        const int * const restrict matrow28 = &matrix->matrix[matrix->size*s1[i+28]];
+        const int * const restrict matrow29 = &matrix->matrix[matrix->size*s1[i+29]];
+        const int * const restrict matrow30 = &matrix->matrix[matrix->size*s1[i+30]];
+        const int * const restrict matrow31 = &matrix->matrix[matrix->size*s1[i+31]];
+        const int * const restrict matrow32 = &matrix->matrix[matrix->size*s1[i+32]];
+        const int * const restrict matrow33 = &matrix->matrix[matrix->size*s1[i+33]];
+        const int * const restrict matrow34 = &matrix->matrix[matrix->size*s1[i+34]];
+        const int * const restrict matrow35 = &matrix->matrix[matrix->size*s1[i+35]];
+        const int * const restrict matrow36 = &matrix->matrix[matrix->size*s1[i+36]];
+        const int * const restrict matrow37 = &matrix->matrix[matrix->size*s1[i+37]];
+        const int * const restrict matrow38 = &matrix->matrix[matrix->size*s1[i+38]];
+        const int * const restrict matrow39 = &matrix->matrix[matrix->size*s1[i+39]];
+        const int * const restrict matrow40 = &matrix->matrix[matrix->size*s1[i+40]];
+        const int * const restrict matrow41 = &matrix->matrix[matrix->size*s1[i+41]];
+        const int * const restrict matrow42 = &matrix->matrix[matrix->size*s1[i+42]];
+        const int * const restrict matrow43 = &matrix->matrix[matrix->size*s1[i+43]];
+        const int * const restrict matrow44 = &matrix->matrix[matrix->size*s1[i+44]];
+        const int * const restrict matrow45 = &matrix->matrix[matrix->size*s1[i+45]];
+        const int * const restrict matrow46 = &matrix->matrix[matrix->size*s1[i+46]];
+        const int * const restrict matrow47 = &matrix->matrix[matrix->size*s1[i+47]];
+        const int * const restrict matrow48 = &matrix->matrix[matrix->size*s1[i+48]];
+        const int * const restrict matrow49 = &matrix->matrix[matrix->size*s1[i+49]];
+        const int * const restrict matrow50 = &matrix->matrix[matrix->size*s1[i+50]];
+        const int * const restrict matrow51 = &matrix->matrix[matrix->size*s1[i+51]];
+        const int * const restrict matrow52 = &matrix->matrix[matrix->size*s1[i+52]];
+        const int * const restrict matrow53 = &matrix->matrix[matrix->size*s1[i+53]];
+        const int * const restrict matrow54 = &matrix->matrix[matrix->size*s1[i+54]];
+        const int * const restrict matrow55 = &matrix->matrix[matrix->size*s1[i+55]];
+        const int * const restrict matrow56 = &matrix->matrix[matrix->size*s1[i+56]];
+        const int * const restrict matrow57 = &matrix->matrix[matrix->size*s1[i+57]];
+        const int * const restrict matrow58 = &matrix->matrix[matrix->size*s1[i+58]];
+        const int * const restrict matrow59 = &matrix->matrix[matrix->size*s1[i+59]];
+        const int * const restrict matrow60 = &matrix->matrix[matrix->size*s1[i+60]];
+        const int * const restrict matrow61 = &matrix->matrix[matrix->size*s1[i+61]];
+        const int * const restrict matrow62 = &matrix->matrix[matrix->size*s1[i+62]];
+        const int * const restrict matrow63 = &matrix->matrix[matrix->size*s1[i+63]];
+        vNH = _mm512_srli_si512_rpl(vNH, 1);
+        vNH = _mm512_insert_epi8_rpl(vNH, H_pr[-1], 63);
+        vWH = _mm512_srli_si512_rpl(vWH, 1);
+        vWH = _mm512_insert_epi8_rpl(vWH, -open - i*gap, 63);
+        H_pr[-1] = -open - (i+N)*gap;
+        /* iterate over database sequence */
+        for (j=0; j<s2Len+PAD; ++j) {
+            __m512i vMat;
+            __m512i vNWH = vNH;
+            vNH = _mm512_srli_si512_rpl(vWH, 1);
+            vNH = _mm512_insert_epi8_rpl(vNH, H_pr[j], 63);
+            vF = _mm512_srli_si512_rpl(vF, 1);
+            vF = _mm512_insert_epi8_rpl(vF, F_pr[j], 63);
+            vF = _mm512_max_epi8(
+                    _mm512_subs_epi8(vNH, vOpen),
+                    _mm512_subs_epi8(vF, vGap));
+            vE = _mm512_max_epi8(
+                    _mm512_subs_epi8(vWH, vOpen),
+                    _mm512_subs_epi8(vE, vGap));
+            vMat = _mm512_set_epi8(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]],
+                    matrow8[s2[j-8]],
+                    matrow9[s2[j-9]],
+                    matrow10[s2[j-10]],
+                    matrow11[s2[j-11]],
+                    matrow12[s2[j-12]],
+                    matrow13[s2[j-13]],
+                    matrow14[s2[j-14]],
+                    matrow15[s2[j-15]],
+                    matrow16[s2[j-16]],
+                    matrow17[s2[j-17]],
+                    matrow18[s2[j-18]],
+                    matrow19[s2[j-19]],
+                    matrow20[s2[j-20]],
+                    matrow21[s2[j-21]],
+                    matrow22[s2[j-22]],
+                    matrow23[s2[j-23]],
+                    matrow24[s2[j-24]],
+                    matrow25[s2[j-25]],
+                    matrow26[s2[j-26]],
+                    matrow27[s2[j-27]],
+                    matrow28[s2[j-28]],
+                    matrow29[s2[j-29]],
+                    matrow30[s2[j-30]],
+                    matrow31[s2[j-31]],
+                    matrow32[s2[j-32]],
+                    matrow33[s2[j-33]],
+                    matrow34[s2[j-34]],
+                    matrow35[s2[j-35]],
+                    matrow36[s2[j-36]],
+                    matrow37[s2[j-37]],
+                    matrow38[s2[j-38]],
+                    matrow39[s2[j-39]],
+                    matrow40[s2[j-40]],
+                    matrow41[s2[j-41]],
+                    matrow42[s2[j-42]],
+                    matrow43[s2[j-43]],
+                    matrow44[s2[j-44]],
+                    matrow45[s2[j-45]],
+                    matrow46[s2[j-46]],
+                    matrow47[s2[j-47]],
+                    matrow48[s2[j-48]],
+                    matrow49[s2[j-49]],
+                    matrow50[s2[j-50]],
+                    matrow51[s2[j-51]],
+                    matrow52[s2[j-52]],
+                    matrow53[s2[j-53]],
+                    matrow54[s2[j-54]],
+                    matrow55[s2[j-55]],
+                    matrow56[s2[j-56]],
+                    matrow57[s2[j-57]],
+                    matrow58[s2[j-58]],
+                    matrow59[s2[j-59]],
+                    matrow60[s2[j-60]],
+                    matrow61[s2[j-61]],
+                    matrow62[s2[j-62]],
+                    matrow63[s2[j-63]]
+                    );
+            vNWH = _mm512_adds_epi8(vNWH, vMat);
+            vWH = _mm512_max_epi8(vNWH, vE);
+            vWH = _mm512_max_epi8(vWH, vF);
+            /* as minor diagonal vector passes across the j=-1 boundary,
+             * assign the appropriate boundary conditions */
+            {
+                __m512i cond = _mm512_cmpeq_epi8_rpl(vJ,vNegOne);
+                vWH = _mm512_blendv_epi8_rpl(vWH, vIBoundary, cond);
+                vF = _mm512_blendv_epi8_rpl(vF, vNegInf, cond);
+                vE = _mm512_blendv_epi8_rpl(vE, vNegInf, cond);
+            }
+            /* check for saturation */
+            {
+                vSaturationCheckMax = _mm512_max_epi8(vSaturationCheckMax, vWH);
+                vSaturationCheckMin = _mm512_min_epi8(vSaturationCheckMin, vWH);
+            }
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->tables->score_table, vWH, i, s1Len, j, s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+            arr_store_rowcol(result->rowcols->score_row, result->rowcols->score_col, vWH, i, s1Len, j, s2Len);
+#endif
+            H_pr[j-63] = (int8_t)_mm512_extract_epi8_rpl(vWH,0);
+            F_pr[j-63] = (int8_t)_mm512_extract_epi8_rpl(vF,0);
+            /* as minor diagonal vector passes across table, extract
+               last table value at the i,j bound */
+            {
+                __m512i cond_valid_I = _mm512_cmpeq_epi8_rpl(vI, vILimit1);
+                __m512i cond_valid_J = _mm512_cmpeq_epi8_rpl(vJ, vJLimit1);
+                __m512i cond_all = _mm512_and_si512(cond_valid_I, cond_valid_J);
+                vMax = _mm512_blendv_epi8_rpl(vMax, vWH, cond_all);
+            }
+            vJ = _mm512_adds_epi8(vJ, vOne);
+        }
+        vI = _mm512_adds_epi8(vI, vN);
+        vIBoundary = _mm512_subs_epi8(vIBoundary, vGapN);
+    }
+
+    /* max in vMax */
+    for (i=0; i<N; ++i) {
+        int8_t value;
+        value = (int8_t) _mm512_extract_epi8_rpl(vMax, 63);
+        if (value > score) {
+            score = value;
+        }
+        vMax = _mm512_slli_si512_rpl(vMax, 1);
+    }
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(
+            _mm512_cmpeq_epi8_rpl(vSaturationCheckMin, vNegLimit),
+            _mm512_cmpeq_epi8_rpl(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT8_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_64;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
+
@@ -0,0 +1,299 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+
+#define _mm512_cmpgt_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmpgt_epi64_mask(a,b), _mm512_set1_epi64(-1))
+
+#define _mm512_insert_epi64_rpl(a,i,imm) _mm512_mask_set1_epi64(a, (__mmask8)1<<(imm), i)
+
+#define _mm512_extract_epi64_rpl(a,imm) _mm_extract_epi64(_mm512_extracti32x4_epi32(a, (imm)>>1), (imm)&1)
+
+#define _mm512_cmplt_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmplt_epi64_mask(a,b), _mm512_set1_epi64(-1))
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    array[1LL*(0*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 0);
+    array[1LL*(1*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 1);
+    array[1LL*(2*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 2);
+    array[1LL*(3*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 3);
+    array[1LL*(4*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 4);
+    array[1LL*(5*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 5);
+    array[1LL*(6*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 6);
+    array[1LL*(7*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 7);
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen)
+{
+    col[0*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 0);
+    col[1*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 1);
+    col[2*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 2);
+    col[3*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 3);
+    col[4*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 4);
+    col[5*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 5);
+    col[6*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 6);
+    col[7*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 7);
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_scan_avx512_512_64
+#define PNAME parasail_nw_table_scan_profile_avx512_512_64
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_scan_avx512_512_64
+#define PNAME parasail_nw_rowcol_scan_profile_avx512_512_64
+#else
+#define FNAME parasail_nw_scan_avx512_512_64
+#define PNAME parasail_nw_scan_profile_avx512_512_64
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx512_512_64(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m512i* const restrict pvP = (__m512i*)profile->profile64.score;
+    __m512i* const restrict pvE = parasail_memalign___m512i(64, segLen);
+    int64_t* const restrict boundary = parasail_memalign_int64_t(64, s2Len+1);
+    __m512i* const restrict pvHt= parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvH = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvGapper = parasail_memalign___m512i(64, segLen);
+    __m512i vGapO = _mm512_set1_epi64(open);
+    __m512i vGapE = _mm512_set1_epi64(gap);
+    const int64_t NEG_LIMIT = (-open < matrix->min ?
+        INT64_MIN + open : INT64_MIN - matrix->min) + 1;
+    const int64_t POS_LIMIT = INT64_MAX - matrix->max - 1;
+    __m512i vZero = _mm512_setzero_si512();
+    int64_t score = NEG_LIMIT;
+    __m512i vNegLimit = _mm512_set1_epi64(NEG_LIMIT);
+    __m512i vPosLimit = _mm512_set1_epi64(POS_LIMIT);
+    __m512i vSaturationCheckMin = vPosLimit;
+    __m512i vSaturationCheckMax = vNegLimit;
+    __m512i vNegInfFront = vZero;
+    __m512i vSegLenXgap;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    vNegInfFront = _mm512_insert_epi64_rpl(vNegInfFront, NEG_LIMIT, 0);
+    vSegLenXgap = _mm512_add_epi64(vNegInfFront,
+            _mm512_slli_si512_rpl(_mm512_set1_epi64(-segLen*gap), 8));
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m512i_64_t h;
+            __m512i_64_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+            }
+            _mm512_store_si512(&pvH[index], h.m);
+            _mm512_store_si512(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT64_MIN ? INT64_MIN : tmp;
+        }
+    }
+
+    {
+        __m512i vGapper = _mm512_sub_epi64(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm512_store_si512(pvGapper+i, vGapper);
+            vGapper = _mm512_sub_epi64(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vE;
+        __m512i vHt;
+        __m512i vF;
+        __m512i vH;
+        __m512i vHp;
+        __m512i *pvW;
+        __m512i vW;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm512_load_si512(pvH+(segLen-1));
+        vHp = _mm512_slli_si512_rpl(vHp, 8);
+        vHp = _mm512_insert_epi64_rpl(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm512_sub_epi64(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm512_load_si512(pvH+i);
+            vE = _mm512_load_si512(pvE+i);
+            vW = _mm512_load_si512(pvW+i);
+            vE = _mm512_max_epi64(
+                    _mm512_sub_epi64(vE, vGapE),
+                    _mm512_sub_epi64(vH, vGapO));
+            vHp = _mm512_add_epi64(vHp, vW);
+            vF = _mm512_max_epi64(vF, _mm512_add_epi64(vHt, pvGapper[i]));
+            vHt = _mm512_max_epi64(vE, vHp);
+            _mm512_store_si512(pvE+i, vE);
+            _mm512_store_si512(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm512_slli_si512_rpl(vHt, 8);
+        vHt = _mm512_insert_epi64_rpl(vHt, boundary[j+1], 0);
+        vF = _mm512_max_epi64(vF, _mm512_add_epi64(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            __m512i vFt = _mm512_slli_si512_rpl(vF, 8);
+            vFt = _mm512_add_epi64(vFt, vSegLenXgap);
+            vF = _mm512_max_epi64(vF, vFt);
+        }
+
+        /* calculate final H */
+        vF = _mm512_slli_si512_rpl(vF, 8);
+        vF = _mm512_add_epi64(vF, vNegInfFront);
+        vH = _mm512_max_epi64(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            vHt = _mm512_load_si512(pvHt+i);
+            vF = _mm512_max_epi64(
+                    _mm512_sub_epi64(vF, vGapE),
+                    _mm512_sub_epi64(vH, vGapO));
+            vH = _mm512_max_epi64(vHt, vF);
+            _mm512_store_si512(pvH+i, vH);
+            vSaturationCheckMin = _mm512_min_epi64(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm512_max_epi64(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+        } 
+
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm512_load_si512(pvH + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl(vH, 8);
+            }
+            result->rowcols->score_row[j] = (int64_t) _mm512_extract_epi64_rpl (vH, 7);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m512i vH = _mm512_load_si512(pvH+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        __m512i vH = _mm512_load_si512(pvH + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm512_slli_si512_rpl(vH, 8);
+        }
+        score = (int64_t) _mm512_extract_epi64_rpl (vH, 7);
+    }
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(
+            _mm512_cmplt_epi64_rpl(vSaturationCheckMin, vNegLimit),
+            _mm512_cmpgt_epi64_rpl(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_BITS_64 | PARASAIL_FLAG_LANES_8;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvGapper);
+    parasail_free(pvH);
+    parasail_free(pvHt);
+    parasail_free(boundary);
+    parasail_free(pvE);
+
+    return result;
+}
+
+
@@ -0,0 +1,413 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+
+#define _mm512_cmpgt_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(a,b))
+
+#define _mm512_insert_epi8_rpl(a,i,imm) _mm512_mask_set1_epi8(a, (__mmask64)1<<(imm), i)
+
+#define _mm512_extract_epi8_rpl(a,imm) (int8_t)_mm_extract_epi8(_mm512_extracti32x4_epi32(a, (imm)>>4), (imm)&15)
+
+#define _mm512_cmplt_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmplt_epi8_mask(a,b))
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+#define _mm512_cmpeq_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a,b))
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    array[1LL*( 0*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  0);
+    array[1LL*( 1*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  1);
+    array[1LL*( 2*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  2);
+    array[1LL*( 3*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  3);
+    array[1LL*( 4*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  4);
+    array[1LL*( 5*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  5);
+    array[1LL*( 6*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  6);
+    array[1LL*( 7*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  7);
+    array[1LL*( 8*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  8);
+    array[1LL*( 9*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  9);
+    array[1LL*(10*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 10);
+    array[1LL*(11*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 11);
+    array[1LL*(12*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 12);
+    array[1LL*(13*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 13);
+    array[1LL*(14*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 14);
+    array[1LL*(15*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 15);
+    array[1LL*(16*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 16);
+    array[1LL*(17*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 17);
+    array[1LL*(18*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 18);
+    array[1LL*(19*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 19);
+    array[1LL*(20*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 20);
+    array[1LL*(21*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 21);
+    array[1LL*(22*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 22);
+    array[1LL*(23*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 23);
+    array[1LL*(24*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 24);
+    array[1LL*(25*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 25);
+    array[1LL*(26*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 26);
+    array[1LL*(27*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 27);
+    array[1LL*(28*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 28);
+    array[1LL*(29*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 29);
+    array[1LL*(30*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 30);
+    array[1LL*(31*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 31);
+    array[1LL*(32*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 32);
+    array[1LL*(33*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 33);
+    array[1LL*(34*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 34);
+    array[1LL*(35*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 35);
+    array[1LL*(36*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 36);
+    array[1LL*(37*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 37);
+    array[1LL*(38*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 38);
+    array[1LL*(39*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 39);
+    array[1LL*(40*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 40);
+    array[1LL*(41*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 41);
+    array[1LL*(42*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 42);
+    array[1LL*(43*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 43);
+    array[1LL*(44*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 44);
+    array[1LL*(45*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 45);
+    array[1LL*(46*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 46);
+    array[1LL*(47*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 47);
+    array[1LL*(48*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 48);
+    array[1LL*(49*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 49);
+    array[1LL*(50*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 50);
+    array[1LL*(51*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 51);
+    array[1LL*(52*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 52);
+    array[1LL*(53*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 53);
+    array[1LL*(54*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 54);
+    array[1LL*(55*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 55);
+    array[1LL*(56*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 56);
+    array[1LL*(57*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 57);
+    array[1LL*(58*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 58);
+    array[1LL*(59*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 59);
+    array[1LL*(60*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 60);
+    array[1LL*(61*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 61);
+    array[1LL*(62*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 62);
+    array[1LL*(63*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 63);
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen)
+{
+    col[ 0*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  0);
+    col[ 1*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  1);
+    col[ 2*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  2);
+    col[ 3*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  3);
+    col[ 4*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  4);
+    col[ 5*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  5);
+    col[ 6*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  6);
+    col[ 7*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  7);
+    col[ 8*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  8);
+    col[ 9*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  9);
+    col[10*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 10);
+    col[11*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 11);
+    col[12*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 12);
+    col[13*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 13);
+    col[14*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 14);
+    col[15*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 15);
+    col[16*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 16);
+    col[17*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 17);
+    col[18*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 18);
+    col[19*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 19);
+    col[20*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 20);
+    col[21*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 21);
+    col[22*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 22);
+    col[23*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 23);
+    col[24*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 24);
+    col[25*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 25);
+    col[26*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 26);
+    col[27*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 27);
+    col[28*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 28);
+    col[29*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 29);
+    col[30*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 30);
+    col[31*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 31);
+    col[32*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 32);
+    col[33*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 33);
+    col[34*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 34);
+    col[35*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 35);
+    col[36*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 36);
+    col[37*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 37);
+    col[38*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 38);
+    col[39*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 39);
+    col[40*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 40);
+    col[41*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 41);
+    col[42*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 42);
+    col[43*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 43);
+    col[44*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 44);
+    col[45*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 45);
+    col[46*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 46);
+    col[47*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 47);
+    col[48*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 48);
+    col[49*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 49);
+    col[50*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 50);
+    col[51*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 51);
+    col[52*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 52);
+    col[53*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 53);
+    col[54*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 54);
+    col[55*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 55);
+    col[56*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 56);
+    col[57*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 57);
+    col[58*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 58);
+    col[59*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 59);
+    col[60*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 60);
+    col[61*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 61);
+    col[62*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 62);
+    col[63*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 63);
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_scan_avx512_512_8
+#define PNAME parasail_nw_table_scan_profile_avx512_512_8
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_scan_avx512_512_8
+#define PNAME parasail_nw_rowcol_scan_profile_avx512_512_8
+#else
+#define FNAME parasail_nw_scan_avx512_512_8
+#define PNAME parasail_nw_scan_profile_avx512_512_8
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx512_512_8(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 64; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m512i* const restrict pvP = (__m512i*)profile->profile8.score;
+    __m512i* const restrict pvE = parasail_memalign___m512i(64, segLen);
+    int8_t* const restrict boundary = parasail_memalign_int8_t(64, s2Len+1);
+    __m512i* const restrict pvHt= parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvH = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvGapper = parasail_memalign___m512i(64, segLen);
+    __m512i vGapO = _mm512_set1_epi8(open);
+    __m512i vGapE = _mm512_set1_epi8(gap);
+    const int8_t NEG_LIMIT = (-open < matrix->min ?
+        INT8_MIN + open : INT8_MIN - matrix->min) + 1;
+    const int8_t POS_LIMIT = INT8_MAX - matrix->max - 1;
+    __m512i vZero = _mm512_setzero_si512();
+    int8_t score = NEG_LIMIT;
+    __m512i vNegLimit = _mm512_set1_epi8(NEG_LIMIT);
+    __m512i vPosLimit = _mm512_set1_epi8(POS_LIMIT);
+    __m512i vSaturationCheckMin = vPosLimit;
+    __m512i vSaturationCheckMax = vNegLimit;
+    __m512i vNegInfFront = vZero;
+    __m512i vSegLenXgap;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    vNegInfFront = _mm512_insert_epi8_rpl(vNegInfFront, NEG_LIMIT, 0);
+    vSegLenXgap = _mm512_adds_epi8(vNegInfFront,
+            _mm512_slli_si512_rpl(_mm512_set1_epi8(-segLen*gap), 1));
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m512i_8_t h;
+            __m512i_8_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT8_MIN ? INT8_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT8_MIN ? INT8_MIN : tmp;
+            }
+            _mm512_store_si512(&pvH[index], h.m);
+            _mm512_store_si512(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT8_MIN ? INT8_MIN : tmp;
+        }
+    }
+
+    {
+        __m512i vGapper = _mm512_subs_epi8(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm512_store_si512(pvGapper+i, vGapper);
+            vGapper = _mm512_subs_epi8(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vE;
+        __m512i vHt;
+        __m512i vF;
+        __m512i vH;
+        __m512i vHp;
+        __m512i *pvW;
+        __m512i vW;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm512_load_si512(pvH+(segLen-1));
+        vHp = _mm512_slli_si512_rpl(vHp, 1);
+        vHp = _mm512_insert_epi8_rpl(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm512_subs_epi8(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm512_load_si512(pvH+i);
+            vE = _mm512_load_si512(pvE+i);
+            vW = _mm512_load_si512(pvW+i);
+            vE = _mm512_max_epi8(
+                    _mm512_subs_epi8(vE, vGapE),
+                    _mm512_subs_epi8(vH, vGapO));
+            vHp = _mm512_adds_epi8(vHp, vW);
+            vF = _mm512_max_epi8(vF, _mm512_adds_epi8(vHt, pvGapper[i]));
+            vHt = _mm512_max_epi8(vE, vHp);
+            _mm512_store_si512(pvE+i, vE);
+            _mm512_store_si512(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm512_slli_si512_rpl(vHt, 1);
+        vHt = _mm512_insert_epi8_rpl(vHt, boundary[j+1], 0);
+        vF = _mm512_max_epi8(vF, _mm512_adds_epi8(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            __m512i vFt = _mm512_slli_si512_rpl(vF, 1);
+            vFt = _mm512_adds_epi8(vFt, vSegLenXgap);
+            vF = _mm512_max_epi8(vF, vFt);
+        }
+
+        /* calculate final H */
+        vF = _mm512_slli_si512_rpl(vF, 1);
+        vF = _mm512_adds_epi8(vF, vNegInfFront);
+        vH = _mm512_max_epi8(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            vHt = _mm512_load_si512(pvHt+i);
+            vF = _mm512_max_epi8(
+                    _mm512_subs_epi8(vF, vGapE),
+                    _mm512_subs_epi8(vH, vGapO));
+            vH = _mm512_max_epi8(vHt, vF);
+            _mm512_store_si512(pvH+i, vH);
+            vSaturationCheckMin = _mm512_min_epi8(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm512_max_epi8(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+        } 
+
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm512_load_si512(pvH + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl(vH, 1);
+            }
+            result->rowcols->score_row[j] = (int8_t) _mm512_extract_epi8_rpl (vH, 63);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m512i vH = _mm512_load_si512(pvH+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        __m512i vH = _mm512_load_si512(pvH + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm512_slli_si512_rpl(vH, 1);
+        }
+        score = (int8_t) _mm512_extract_epi8_rpl (vH, 63);
+    }
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(
+            _mm512_cmplt_epi8_rpl(vSaturationCheckMin, vNegLimit),
+            _mm512_cmpgt_epi8_rpl(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_64;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvGapper);
+    parasail_free(pvH);
+    parasail_free(pvHt);
+    parasail_free(boundary);
+    parasail_free(pvE);
+
+    return result;
+}
+
+
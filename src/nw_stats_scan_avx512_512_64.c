@@ -0,0 +1,511 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+
+#define _mm512_cmpeq_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmpeq_epi64_mask(a,b), _mm512_set1_epi64(-1))
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_cmpgt_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmpgt_epi64_mask(a,b), _mm512_set1_epi64(-1))
+
+#define _mm512_insert_epi64_rpl(a,i,imm) _mm512_mask_set1_epi64(a, (__mmask8)1<<(imm), i)
+
+#define _mm512_extract_epi64_rpl(a,imm) _mm_extract_epi64(_mm512_extracti32x4_epi32(a, (imm)>>1), (imm)&1)
+
+#define _mm512_cmplt_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmplt_epi64_mask(a,b), _mm512_set1_epi64(-1))
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    array[1LL*(0*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 0);
+    array[1LL*(1*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 1);
+    array[1LL*(2*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 2);
+    array[1LL*(3*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 3);
+    array[1LL*(4*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 4);
+    array[1LL*(5*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 5);
+    array[1LL*(6*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 6);
+    array[1LL*(7*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 7);
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen)
+{
+    col[0*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 0);
+    col[1*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 1);
+    col[2*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 2);
+    col[3*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 3);
+    col[4*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 4);
+    col[5*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 5);
+    col[6*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 6);
+    col[7*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 7);
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_stats_table_scan_avx512_512_64
+#define PNAME parasail_nw_stats_table_scan_profile_avx512_512_64
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_stats_rowcol_scan_avx512_512_64
+#define PNAME parasail_nw_stats_rowcol_scan_profile_avx512_512_64
+#else
+#define FNAME parasail_nw_stats_scan_avx512_512_64
+#define PNAME parasail_nw_stats_scan_profile_avx512_512_64
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_stats_avx512_512_64(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m512i* const restrict pvP  = (__m512i*)profile->profile64.score;
+    __m512i* const restrict pvPm = (__m512i*)profile->profile64.matches;
+    __m512i* const restrict pvPs = (__m512i*)profile->profile64.similar;
+    __m512i* const restrict pvE  = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvEM = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvES = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvEL = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvH  = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHM = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHS = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHL = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHMax  = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHMMax = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHSMax = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHLMax = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvGapper = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvGapperL = parasail_memalign___m512i(64, segLen);
+    int64_t* const restrict boundary = parasail_memalign_int64_t(64, s2Len+1);
+    __m512i vGapO = _mm512_set1_epi64(open);
+    __m512i vGapE = _mm512_set1_epi64(gap);
+    const int64_t NEG_LIMIT = (-open < matrix->min ?
+        INT64_MIN + open : INT64_MIN - matrix->min) + 1;
+    const int64_t POS_LIMIT = INT64_MAX - matrix->max - 1;
+    __m512i vZero = _mm512_setzero_si512();
+    __m512i vOne = _mm512_set1_epi64(1);
+    int64_t score = NEG_LIMIT;
+    int64_t matches = 0;
+    int64_t similar = 0;
+    int64_t length = 0;
+    __m512i vNegLimit = _mm512_set1_epi64(NEG_LIMIT);
+    __m512i vPosLimit = _mm512_set1_epi64(POS_LIMIT);
+    __m512i vSaturationCheckMin = vPosLimit;
+    __m512i vSaturationCheckMax = vNegLimit;
+    __m512i vNegInfFront = vZero;
+    __m512i vSegLenXgap;
+    __m512i vSegLen = _mm512_slli_si512_rpl(_mm512_set1_epi64(segLen), 8);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table3(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol3(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new_stats();
+#endif
+#endif
+
+    vNegInfFront = _mm512_insert_epi64_rpl(vNegInfFront, NEG_LIMIT, 0);
+    vSegLenXgap = _mm512_add_epi64(vNegInfFront,
+            _mm512_slli_si512_rpl(_mm512_set1_epi64(-segLen*gap), 8));
+
+    parasail_memset___m512i(pvHM, vZero, segLen);
+    parasail_memset___m512i(pvHS, vZero, segLen);
+    parasail_memset___m512i(pvHL, vZero, segLen);
+    parasail_memset___m512i(pvE, vNegLimit, segLen);
+    parasail_memset___m512i(pvEM, vZero, segLen);
+    parasail_memset___m512i(pvES, vZero, segLen);
+    parasail_memset___m512i(pvEL, vZero, segLen);
+    {
+        __m512i vGapper = _mm512_sub_epi64(vZero,vGapO);
+        __m512i vGapperL = vOne;
+        for (i=segLen-1; i>=0; --i) {
+            _mm512_store_si512(pvGapper+i, vGapper);
+            _mm512_store_si512(pvGapperL+i, vGapperL);
+            vGapper = _mm512_sub_epi64(vGapper, vGapE);
+            vGapperL = _mm512_add_epi64(vGapperL, vOne);
+        }
+    }
+
+    /* initialize H */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m512i_64_t h;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+            }
+            _mm512_store_si512(&pvH[index], h.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT64_MIN ? INT64_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vE;
+        __m512i vE_ext;
+        __m512i vE_opn;
+        __m512i vEM;
+        __m512i vES;
+        __m512i vEL;
+        __m512i vHt;
+        __m512i vHtM;
+        __m512i vHtS;
+        __m512i vHtL;
+        __m512i vF;
+        __m512i vF_ext;
+        __m512i vF_opn;
+        __m512i vFM;
+        __m512i vFS;
+        __m512i vFL;
+        __m512i vH;
+        __m512i vHM;
+        __m512i vHS;
+        __m512i vHL;
+        __m512i vHp;
+        __m512i vHpM;
+        __m512i vHpS;
+        __m512i vHpL;
+        __m512i *pvW;
+        __m512i vW;
+        __m512i *pvWM;
+        __m512i vWM;
+        __m512i *pvWS;
+        __m512i vWS;
+        __m512i case1;
+        __m512i case2;
+        __m512i vGapper;
+        __m512i vGapperL;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm512_load_si512(pvH+(segLen-1));
+        vHpM = _mm512_load_si512(pvHM+(segLen-1));
+        vHpS = _mm512_load_si512(pvHS+(segLen-1));
+        vHpL = _mm512_load_si512(pvHL+(segLen-1));
+        vHp = _mm512_slli_si512_rpl(vHp, 8);
+        vHpM = _mm512_slli_si512_rpl(vHpM, 8);
+        vHpS = _mm512_slli_si512_rpl(vHpS, 8);
+        vHpL = _mm512_slli_si512_rpl(vHpL, 8);
+        vHp = _mm512_insert_epi64_rpl(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        pvWM= pvPm+ matrix->mapper[(unsigned char)s2[j]]*segLen;
+        pvWS= pvPs+ matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm512_sub_epi64(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        vFM = vZero;
+        vFS = vZero;
+        vFL = vZero;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm512_load_si512(pvH+i);
+            vHM= _mm512_load_si512(pvHM+i);
+            vHS= _mm512_load_si512(pvHS+i);
+            vHL= _mm512_load_si512(pvHL+i);
+            vE = _mm512_load_si512(pvE+i);
+            vEM= _mm512_load_si512(pvEM+i);
+            vES= _mm512_load_si512(pvES+i);
+            vEL= _mm512_load_si512(pvEL+i);
+            vW = _mm512_load_si512(pvW+i);
+            vWM = _mm512_load_si512(pvWM+i);
+            vWS = _mm512_load_si512(pvWS+i);
+            vGapper = _mm512_load_si512(pvGapper+i);
+            vGapperL = _mm512_load_si512(pvGapperL+i);
+            vE_opn = _mm512_sub_epi64(vH, vGapO);
+            vE_ext = _mm512_sub_epi64(vE, vGapE);
+            case1 = _mm512_cmpgt_epi64_rpl(vE_opn, vE_ext);
+            vE = _mm512_max_epi64(vE_opn, vE_ext);
+            vEM = _mm512_blendv_epi8_rpl(vEM, vHM, case1);
+            vES = _mm512_blendv_epi8_rpl(vES, vHS, case1);
+            vEL = _mm512_blendv_epi8_rpl(vEL, vHL, case1);
+            vEL = _mm512_add_epi64(vEL, vOne);
+            vGapper = _mm512_add_epi64(vHt, vGapper);
+            case1 = _mm512_or_si512(
+                    _mm512_cmpgt_epi64_rpl(vF, vGapper),
+                    _mm512_cmpeq_epi64_rpl(vF, vGapper));
+            vF = _mm512_max_epi64(vF, vGapper);
+            vFM = _mm512_blendv_epi8_rpl(vHtM, vFM, case1);
+            vFS = _mm512_blendv_epi8_rpl(vHtS, vFS, case1);
+            vFL = _mm512_blendv_epi8_rpl(
+                    _mm512_add_epi64(vHtL, vGapperL),
+                    vFL, case1);
+            vHp = _mm512_add_epi64(vHp, vW);
+            vHpM = _mm512_add_epi64(vHpM, vWM);
+            vHpS = _mm512_add_epi64(vHpS, vWS);
+            vHpL = _mm512_add_epi64(vHpL, vOne);
+            case1 = _mm512_cmpgt_epi64_rpl(vE, vHp);
+            vHt = _mm512_max_epi64(vE, vHp);
+            vHtM = _mm512_blendv_epi8_rpl(vHpM, vEM, case1);
+            vHtS = _mm512_blendv_epi8_rpl(vHpS, vES, case1);
+            vHtL = _mm512_blendv_epi8_rpl(vHpL, vEL, case1);
+            _mm512_store_si512(pvE+i, vE);
+            _mm512_store_si512(pvEM+i, vEM);
+            _mm512_store_si512(pvES+i, vES);
+            _mm512_store_si512(pvEL+i, vEL);
+            _mm512_store_si512(pvH+i, vHp);
+            _mm512_store_si512(pvHM+i, vHpM);
+            _mm512_store_si512(pvHS+i, vHpS);
+            _mm512_store_si512(pvHL+i, vHpL);
+            vHp = vH;
+            vHpM = vHM;
+            vHpS = vHS;
+            vHpL = vHL;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm512_slli_si512_rpl(vHt, 8);
+        vHtM = _mm512_slli_si512_rpl(vHtM, 8);
+        vHtS = _mm512_slli_si512_rpl(vHtS, 8);
+        vHtL = _mm512_slli_si512_rpl(vHtL, 8);
+        vHt = _mm512_insert_epi64_rpl(vHt, boundary[j+1], 0);
+        vGapper = _mm512_load_si512(pvGapper);
+        vGapperL = _mm512_load_si512(pvGapperL);
+        vGapper = _mm512_add_epi64(vHt, vGapper);
+        case1 = _mm512_or_si512(
+                _mm512_cmpgt_epi64_rpl(vGapper, vF),
+                _mm512_cmpeq_epi64_rpl(vGapper, vF));
+        vF = _mm512_max_epi64(vF, vGapper);
+        vFM = _mm512_blendv_epi8_rpl(vFM, vHtM, case1);
+        vFS = _mm512_blendv_epi8_rpl(vFS, vHtS, case1);
+        vFL = _mm512_blendv_epi8_rpl(
+                vFL,
+                _mm512_add_epi64(vHtL, vGapperL),
+                case1);
+        for (i=0; i<segWidth-2; ++i) {
+            __m512i vFt = _mm512_slli_si512_rpl(vF, 8);
+            __m512i vFtM = _mm512_slli_si512_rpl(vFM, 8);
+            __m512i vFtS = _mm512_slli_si512_rpl(vFS, 8);
+            __m512i vFtL = _mm512_slli_si512_rpl(vFL, 8);
+            vFt = _mm512_add_epi64(vFt, vSegLenXgap);
+            case1 = _mm512_or_si512(
+                    _mm512_cmpgt_epi64_rpl(vFt, vF),
+                    _mm512_cmpeq_epi64_rpl(vFt, vF));
+            vF = _mm512_max_epi64(vF, vFt);
+            vFM = _mm512_blendv_epi8_rpl(vFM, vFtM, case1);
+            vFS = _mm512_blendv_epi8_rpl(vFS, vFtS, case1);
+            vFL = _mm512_blendv_epi8_rpl(
+                    vFL,
+                    _mm512_add_epi64(vFtL, vSegLen),
+                    case1);
+        }
+
+        /* calculate final H */
+        vF = _mm512_slli_si512_rpl(vF, 8);
+        vFM = _mm512_slli_si512_rpl(vFM, 8);
+        vFS = _mm512_slli_si512_rpl(vFS, 8);
+        vFL = _mm512_slli_si512_rpl(vFL, 8);
+        vF = _mm512_add_epi64(vF, vNegInfFront);
+        case1 = _mm512_cmpgt_epi64_rpl(vF, vHt);
+        vH = _mm512_max_epi64(vF, vHt);
+        vHM = _mm512_blendv_epi8_rpl(vHtM, vFM, case1);
+        vHS = _mm512_blendv_epi8_rpl(vHtS, vFS, case1);
+        vHL = _mm512_blendv_epi8_rpl(vHtL, vFL, case1);
+        for (i=0; i<segLen; ++i) {
+            vHp = _mm512_load_si512(pvH+i);
+            vHpM = _mm512_load_si512(pvHM+i);
+            vHpS = _mm512_load_si512(pvHS+i);
+            vHpL = _mm512_load_si512(pvHL+i);
+            vE = _mm512_load_si512(pvE+i);
+            vEM = _mm512_load_si512(pvEM+i);
+            vES = _mm512_load_si512(pvES+i);
+            vEL = _mm512_load_si512(pvEL+i);
+            vF_opn = _mm512_sub_epi64(vH, vGapO);
+            vF_ext = _mm512_sub_epi64(vF, vGapE);
+            vF = _mm512_max_epi64(vF_opn, vF_ext);
+            case1 = _mm512_cmpgt_epi64_rpl(vF_opn, vF_ext);
+            vFM = _mm512_blendv_epi8_rpl(vFM, vHM, case1);
+            vFS = _mm512_blendv_epi8_rpl(vFS, vHS, case1);
+            vFL = _mm512_blendv_epi8_rpl(vFL, vHL, case1);
+            vFL = _mm512_add_epi64(vFL, vOne);
+            vH = _mm512_max_epi64(vHp, vE);
+            vH = _mm512_max_epi64(vH, vF);
+            case1 = _mm512_cmpeq_epi64_rpl(vH, vHp);
+            case2 = _mm512_cmpeq_epi64_rpl(vH, vF);
+            vHM = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vEM, vFM, case2),
+                    vHpM, case1);
+            vHS = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vES, vFS, case2),
+                    vHpS, case1);
+            vHL = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vEL, vFL, case2),
+                    vHpL, case1);
+            _mm512_store_si512(pvH+i, vH);
+            _mm512_store_si512(pvHM+i, vHM);
+            _mm512_store_si512(pvHS+i, vHS);
+            _mm512_store_si512(pvHL+i, vHL);
+            vSaturationCheckMin = _mm512_min_epi64(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm512_max_epi64(vSaturationCheckMax, vH);
+            vSaturationCheckMax = _mm512_max_epi64(vSaturationCheckMax, vHM);
+            vSaturationCheckMax = _mm512_max_epi64(vSaturationCheckMax, vHS);
+            vSaturationCheckMax = _mm512_max_epi64(vSaturationCheckMax, vHL);
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->stats->tables->score_table, vH, i, segLen, j, s2Len);
+            arr_store_si512(result->stats->tables->matches_table, vHM, i, segLen, j, s2Len);
+            arr_store_si512(result->stats->tables->similar_table, vHS, i, segLen, j, s2Len);
+            arr_store_si512(result->stats->tables->length_table, vHL, i, segLen, j, s2Len);
+#endif
+        } 
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm512_load_si512(pvH + offset);
+            vHM = _mm512_load_si512(pvHM + offset);
+            vHS = _mm512_load_si512(pvHS + offset);
+            vHL = _mm512_load_si512(pvHL + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl(vH, 8);
+                vHM = _mm512_slli_si512_rpl(vHM, 8);
+                vHS = _mm512_slli_si512_rpl(vHS, 8);
+                vHL = _mm512_slli_si512_rpl(vHL, 8);
+            }
+            result->stats->rowcols->score_row[j] = (int64_t) _mm512_extract_epi64_rpl (vH, 7);
+            result->stats->rowcols->matches_row[j] = (int64_t) _mm512_extract_epi64_rpl (vHM, 7);
+            result->stats->rowcols->similar_row[j] = (int64_t) _mm512_extract_epi64_rpl (vHS, 7);
+            result->stats->rowcols->length_row[j] = (int64_t) _mm512_extract_epi64_rpl (vHL, 7);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m512i vH = _mm512_load_si512(pvH+i);
+        __m512i vHM = _mm512_load_si512(pvHM+i);
+        __m512i vHS = _mm512_load_si512(pvHS+i);
+        __m512i vHL = _mm512_load_si512(pvHL+i);
+        arr_store_col(result->stats->rowcols->score_col, vH, i, segLen);
+        arr_store_col(result->stats->rowcols->matches_col, vHM, i, segLen);
+        arr_store_col(result->stats->rowcols->similar_col, vHS, i, segLen);
+        arr_store_col(result->stats->rowcols->length_col, vHL, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        __m512i vH = _mm512_load_si512(pvH + offset);
+        __m512i vHM = _mm512_load_si512(pvHM + offset);
+        __m512i vHS = _mm512_load_si512(pvHS + offset);
+        __m512i vHL = _mm512_load_si512(pvHL + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm512_slli_si512_rpl(vH, 8);
+            vHM = _mm512_slli_si512_rpl(vHM, 8);
+            vHS = _mm512_slli_si512_rpl(vHS, 8);
+            vHL = _mm512_slli_si512_rpl(vHL, 8);
+        }
+        score = (int64_t) _mm512_extract_epi64_rpl (vH, 7);
+        matches = (int64_t) _mm512_extract_epi64_rpl (vHM, 7);
+        similar = (int64_t) _mm512_extract_epi64_rpl (vHS, 7);
+        length = (int64_t) _mm512_extract_epi64_rpl (vHL, 7);
+    }
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(
+            _mm512_cmplt_epi64_rpl(vSaturationCheckMin, vNegLimit),
+            _mm512_cmpgt_epi64_rpl(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        matches = 0;
+        similar = 0;
+        length = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->stats->matches = matches;
+    result->stats->similar = similar;
+    result->stats->length = length;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_STATS
+        | PARASAIL_FLAG_BITS_64 | PARASAIL_FLAG_LANES_8;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvGapperL);
+    parasail_free(pvGapper);
+    parasail_free(pvHLMax);
+    parasail_free(pvHSMax);
+    parasail_free(pvHMMax);
+    parasail_free(pvHMax);
+    parasail_free(pvHL);
+    parasail_free(pvHS);
+    parasail_free(pvHM);
+    parasail_free(pvH);
+    parasail_free(pvEL);
+    parasail_free(pvES);
+    parasail_free(pvEM);
+    parasail_free(pvE);
+
+    return result;
+}
+
+
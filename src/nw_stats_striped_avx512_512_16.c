@@ -0,0 +1,555 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define SWAP(A,B) { __m512i* tmp = A; A = B; B = tmp; }
+
+
+#define _mm512_cmpeq_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(a,b))
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_cmpgt_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(a,b))
+
+#define _mm512_cmplt_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmplt_epi16_mask(a,b))
+
+#define _mm512_insert_epi16_rpl(a,i,imm) _mm512_mask_set1_epi16(a, (__mmask32)1<<(imm), i)
+
+#define _mm512_extract_epi16_rpl(a,imm) (int16_t)_mm_extract_epi16(_mm512_extracti32x4_epi32(a, (imm)>>3), (imm)&7)
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    array[1LL*( 0*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  0);
+    array[1LL*( 1*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  1);
+    array[1LL*( 2*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  2);
+    array[1LL*( 3*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  3);
+    array[1LL*( 4*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  4);
+    array[1LL*( 5*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  5);
+    array[1LL*( 6*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  6);
+    array[1LL*( 7*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  7);
+    array[1LL*( 8*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  8);
+    array[1LL*( 9*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  9);
+    array[1LL*(10*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 10);
+    array[1LL*(11*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 11);
+    array[1LL*(12*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 12);
+    array[1LL*(13*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 13);
+    array[1LL*(14*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 14);
+    array[1LL*(15*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 15);
+    array[1LL*(16*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 16);
+    array[1LL*(17*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 17);
+    array[1LL*(18*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 18);
+    array[1LL*(19*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 19);
+    array[1LL*(20*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 20);
+    array[1LL*(21*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 21);
+    array[1LL*(22*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 22);
+    array[1LL*(23*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 23);
+    array[1LL*(24*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 24);
+    array[1LL*(25*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 25);
+    array[1LL*(26*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 26);
+    array[1LL*(27*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 27);
+    array[1LL*(28*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 28);
+    array[1LL*(29*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 29);
+    array[1LL*(30*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 30);
+    array[1LL*(31*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 31);
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen)
+{
+    col[ 0*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  0);
+    col[ 1*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  1);
+    col[ 2*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  2);
+    col[ 3*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  3);
+    col[ 4*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  4);
+    col[ 5*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  5);
+    col[ 6*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  6);
+    col[ 7*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  7);
+    col[ 8*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  8);
+    col[ 9*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  9);
+    col[10*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 10);
+    col[11*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 11);
+    col[12*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 12);
+    col[13*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 13);
+    col[14*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 14);
+    col[15*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 15);
+    col[16*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 16);
+    col[17*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 17);
+    col[18*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 18);
+    col[19*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 19);
+    col[20*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 20);
+    col[21*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 21);
+    col[22*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 22);
+    col[23*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 23);
+    col[24*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 24);
+    col[25*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 25);
+    col[26*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 26);
+    col[27*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 27);
+    col[28*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 28);
+    col[29*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 29);
+    col[30*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 30);
+    col[31*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 31);
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_stats_table_striped_avx512_512_16
+#define PNAME parasail_nw_stats_table_striped_profile_avx512_512_16
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_stats_rowcol_striped_avx512_512_16
+#define PNAME parasail_nw_stats_rowcol_striped_profile_avx512_512_16
+#else
+#define FNAME parasail_nw_stats_striped_avx512_512_16
+#define PNAME parasail_nw_stats_striped_profile_avx512_512_16
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_stats_avx512_512_16(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 32; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m512i* const restrict vProfile  = (__m512i*)profile->profile16.score;
+    __m512i* const restrict vProfileM = (__m512i*)profile->profile16.matches;
+    __m512i* const restrict vProfileS = (__m512i*)profile->profile16.similar;
+    __m512i* restrict pvHStore        = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHLoad         = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHMStore       = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHMLoad        = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHSStore       = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHSLoad        = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHLStore       = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHLLoad        = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvE             = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvEM      = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvES      = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvEL      = parasail_memalign___m512i(64, segLen);
+    int16_t* const restrict boundary  = parasail_memalign_int16_t(64, s2Len+1);
+    const __m512i vGapO = _mm512_set1_epi16(open);
+    const __m512i vGapE = _mm512_set1_epi16(gap);
+    const int16_t NEG_LIMIT = (-open < matrix->min ?
+        INT16_MIN + open : INT16_MIN - matrix->min) + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    const __m512i vZero = _mm512_setzero_si512();
+    const __m512i vOne = _mm512_set1_epi16(1);
+    int16_t score = NEG_LIMIT;
+    int16_t matches = 0;
+    int16_t similar = 0;
+    int16_t length = 0;
+    __m512i vNegLimit = _mm512_set1_epi16(NEG_LIMIT);
+    __m512i vNegInf = _mm512_set1_epi16(NEG_LIMIT-1);
+    __m512i vPosLimit = _mm512_set1_epi16(POS_LIMIT);
+    __m512i vSaturationCheckMin = vPosLimit;
+    __m512i vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table3(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol3(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new_stats();
+#endif
+#endif
+
+    parasail_memset___m512i(pvHMStore, vZero, segLen);
+    parasail_memset___m512i(pvHSStore, vZero, segLen);
+    parasail_memset___m512i(pvHLStore, vZero, segLen);
+    parasail_memset___m512i(pvEM, vZero, segLen);
+    parasail_memset___m512i(pvES, vZero, segLen);
+    parasail_memset___m512i(pvEL, vOne, segLen);
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m512i_16_t h;
+            __m512i_16_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+            }
+            _mm512_store_si512(&pvHStore[index], h.m);
+            _mm512_store_si512(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT16_MIN ? INT16_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vEF_opn;
+        __m512i vE;
+        __m512i vE_ext;
+        __m512i vEM;
+        __m512i vES;
+        __m512i vEL;
+        __m512i vF;
+        __m512i vF_ext;
+        __m512i vFM;
+        __m512i vFS;
+        __m512i vFL;
+        __m512i vH;
+        __m512i vH_dag;
+        __m512i vHM;
+        __m512i vHS;
+        __m512i vHL;
+        const __m512i* vP = NULL;
+        const __m512i* vPM = NULL;
+        const __m512i* vPS = NULL;
+
+        /* Initialize F value to neg inf.  Any errors to vH values will
+         * be corrected in the Lazy_F loop.  Neg inf is below NEG_LIMIT
+         * so that an H value floored by it is still seen as saturated. */
+        vF = vNegInf;
+        vFM = vZero;
+        vFS = vZero;
+        vFL = vOne;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        vH = _mm512_load_si512(&pvHStore[segLen - 1]);
+        vHM = _mm512_load_si512(&pvHMStore[segLen - 1]);
+        vHS = _mm512_load_si512(&pvHSStore[segLen - 1]);
+        vHL = _mm512_load_si512(&pvHLStore[segLen - 1]);
+        vH = _mm512_slli_si512_rpl(vH, 2);
+        vHM = _mm512_slli_si512_rpl(vHM, 2);
+        vHS = _mm512_slli_si512_rpl(vHS, 2);
+        vHL = _mm512_slli_si512_rpl(vHL, 2);
+
+        /* insert upper boundary condition */
+        vH = _mm512_insert_epi16_rpl(vH, boundary[j], 0);
+
+        /* Correct part of the vProfile */
+        vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+        vPM = vProfileM + matrix->mapper[(unsigned char)s2[j]] * segLen;
+        vPS = vProfileS + matrix->mapper[(unsigned char)s2[j]] * segLen;
+
+        /* Swap the 2 H buffers. */
+        SWAP(pvHLoad,  pvHStore)
+        SWAP(pvHMLoad, pvHMStore)
+        SWAP(pvHSLoad, pvHSStore)
+        SWAP(pvHLLoad, pvHLStore)
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            __m512i case1;
+            __m512i case2;
+
+            vE = _mm512_load_si512(pvE+ i);
+            vEM = _mm512_load_si512(pvEM+ i);
+            vES = _mm512_load_si512(pvES+ i);
+            vEL = _mm512_load_si512(pvEL+ i);
+
+            /* Get max from vH, vE and vF. */
+            vH_dag = _mm512_add_epi16(vH, _mm512_load_si512(vP + i));
+            vH = _mm512_max_epi16(vH_dag, vE);
+            vH = _mm512_max_epi16(vH, vF);
+            /* Save vH values. */
+            _mm512_store_si512(pvHStore + i, vH);
+
+            case1 = _mm512_cmpeq_epi16_rpl(vH, vH_dag);
+            case2 = _mm512_cmpeq_epi16_rpl(vH, vF);
+
+            /* calculate vM */
+            vHM = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vEM, vFM, case2),
+                    _mm512_add_epi16(vHM, _mm512_load_si512(vPM + i)),
+                    case1);
+            _mm512_store_si512(pvHMStore + i, vHM);
+
+            /* calculate vS */
+            vHS = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vES, vFS, case2),
+                    _mm512_add_epi16(vHS, _mm512_load_si512(vPS + i)),
+                    case1);
+            _mm512_store_si512(pvHSStore + i, vHS);
+
+            /* calculate vL */
+            vHL = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vEL, vFL, case2),
+                    _mm512_add_epi16(vHL, vOne),
+                    case1);
+            _mm512_store_si512(pvHLStore + i, vHL);
+
+            vSaturationCheckMin = _mm512_min_epi16(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vH);
+            vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vHM);
+            vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vHS);
+            vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vHL);
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->stats->tables->matches_table, vHM, i, segLen, j, s2Len);
+            arr_store_si512(result->stats->tables->similar_table, vHS, i, segLen, j, s2Len);
+            arr_store_si512(result->stats->tables->length_table, vHL, i, segLen, j, s2Len);
+            arr_store_si512(result->stats->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+            vEF_opn = _mm512_sub_epi16(vH, vGapO);
+
+            /* Update vE value. */
+            vE_ext = _mm512_sub_epi16(vE, vGapE);
+            vE = _mm512_max_epi16(vEF_opn, vE_ext);
+            case1 = _mm512_cmpgt_epi16_rpl(vEF_opn, vE_ext);
+            vEM = _mm512_blendv_epi8_rpl(vEM, vHM, case1);
+            vES = _mm512_blendv_epi8_rpl(vES, vHS, case1);
+            vEL = _mm512_blendv_epi8_rpl(
+                    _mm512_add_epi16(vEL, vOne),
+                    _mm512_add_epi16(vHL, vOne),
+                    case1);
+            _mm512_store_si512(pvE + i, vE);
+            _mm512_store_si512(pvEM + i, vEM);
+            _mm512_store_si512(pvES + i, vES);
+            _mm512_store_si512(pvEL + i, vEL);
+
+            /* Update vF value. */
+            vF_ext = _mm512_sub_epi16(vF, vGapE);
+            vF = _mm512_max_epi16(vEF_opn, vF_ext);
+            case1 = _mm512_cmpgt_epi16_rpl(vEF_opn, vF_ext);
+            vFM = _mm512_blendv_epi8_rpl(vFM, vHM, case1);
+            vFS = _mm512_blendv_epi8_rpl(vFS, vHS, case1);
+            vFL = _mm512_blendv_epi8_rpl(
+                    _mm512_add_epi16(vFL, vOne),
+                    _mm512_add_epi16(vHL, vOne),
+                    case1);
+
+            /* Load the next vH. */
+            vH = _mm512_load_si512(pvHLoad + i);
+            vHM = _mm512_load_si512(pvHMLoad + i);
+            vHS = _mm512_load_si512(pvHSLoad + i);
+            vHL = _mm512_load_si512(pvHLLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            __m512i vHp = _mm512_load_si512(&pvHLoad[segLen - 1]);
+            int64_t tmp = boundary[j+1]-open;
+            int16_t tmp2 = tmp < INT16_MIN ? INT16_MIN : tmp;
+            vHp = _mm512_slli_si512_rpl(vHp, 2);
+            vF = _mm512_slli_si512_rpl(vF, 2);
+            vFM = _mm512_slli_si512_rpl(vFM, 2);
+            vFS = _mm512_slli_si512_rpl(vFS, 2);
+            vFL = _mm512_slli_si512_rpl(vFL, 2);
+            vHp = _mm512_insert_epi16_rpl(vHp, boundary[j], 0);
+            vF = _mm512_insert_epi16_rpl(vF, tmp2, 0);
+            vFL = _mm512_insert_epi16_rpl(vFL, 1, 0);
+            for (i=0; i<segLen; ++i) {
+                __m512i case1;
+                __m512i case2;
+                __m512i cond;
+
+                vHp = _mm512_add_epi16(vHp, _mm512_load_si512(vP + i));
+                vH = _mm512_load_si512(pvHStore + i);
+                vH = _mm512_max_epi16(vH,vF);
+                _mm512_store_si512(pvHStore + i, vH);
+                case1 = _mm512_cmpeq_epi16_rpl(vH, vHp);
+                case2 = _mm512_cmpeq_epi16_rpl(vH, vF);
+                cond = _mm512_andnot_si512(case1, case2);
+
+                /* calculate vM */
+                vHM = _mm512_load_si512(pvHMStore + i);
+                vHM = _mm512_blendv_epi8_rpl(vHM, vFM, cond);
+                _mm512_store_si512(pvHMStore + i, vHM);
+
+                /* calculate vS */
+                vHS = _mm512_load_si512(pvHSStore + i);
+                vHS = _mm512_blendv_epi8_rpl(vHS, vFS, cond);
+                _mm512_store_si512(pvHSStore + i, vHS);
+
+                /* calculate vL */
+                vHL = _mm512_load_si512(pvHLStore + i);
+                vHL = _mm512_blendv_epi8_rpl(vHL, vFL, cond);
+                _mm512_store_si512(pvHLStore + i, vHL);
+
+                vSaturationCheckMin = _mm512_min_epi16(vSaturationCheckMin, vH);
+                vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vH);
+                vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vHM);
+                vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vHS);
+                vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vHL);
+#ifdef PARASAIL_TABLE
+                arr_store_si512(result->stats->tables->matches_table, vHM, i, segLen, j, s2Len);
+                arr_store_si512(result->stats->tables->similar_table, vHS, i, segLen, j, s2Len);
+                arr_store_si512(result->stats->tables->length_table, vHL, i, segLen, j, s2Len);
+                arr_store_si512(result->stats->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                /* Update vF value. */
+                vEF_opn = _mm512_sub_epi16(vH, vGapO);
+                vF_ext = _mm512_sub_epi16(vF, vGapE);
+                if (! _mm512_movepi8_mask(
+                            _mm512_or_si512(
+                                _mm512_cmpgt_epi16_rpl(vF_ext, vEF_opn),
+                                _mm512_cmpeq_epi16_rpl(vF_ext, vEF_opn))))
+                    goto end;
+                /*vF = _mm512_max_epi16(vEF_opn, vF_ext);*/
+                vF = vF_ext;
+                cond = _mm512_cmpgt_epi16_rpl(vEF_opn, vF_ext);
+                vFM = _mm512_blendv_epi8_rpl(vFM, vHM, cond);
+                vFS = _mm512_blendv_epi8_rpl(vFS, vHS, cond);
+                vFL = _mm512_blendv_epi8_rpl(
+                        _mm512_add_epi16(vFL, vOne),
+                        _mm512_add_epi16(vHL, vOne),
+                        cond);
+                vHp = _mm512_load_si512(pvHLoad + i);
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm512_load_si512(pvHStore + offset);
+            vHM = _mm512_load_si512(pvHMStore + offset);
+            vHS = _mm512_load_si512(pvHSStore + offset);
+            vHL = _mm512_load_si512(pvHLStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl (vH, 2);
+                vHM = _mm512_slli_si512_rpl (vHM, 2);
+                vHS = _mm512_slli_si512_rpl (vHS, 2);
+                vHL = _mm512_slli_si512_rpl (vHL, 2);
+            }
+            result->stats->rowcols->score_row[j] = (int16_t) _mm512_extract_epi16_rpl (vH, 31);
+            result->stats->rowcols->matches_row[j] = (int16_t) _mm512_extract_epi16_rpl (vHM, 31);
+            result->stats->rowcols->similar_row[j] = (int16_t) _mm512_extract_epi16_rpl (vHS, 31);
+            result->stats->rowcols->length_row[j] = (int16_t) _mm512_extract_epi16_rpl (vHL, 31);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m512i vH = _mm512_load_si512(pvHStore+i);
+        __m512i vHM = _mm512_load_si512(pvHMStore+i);
+        __m512i vHS = _mm512_load_si512(pvHSStore+i);
+        __m512i vHL = _mm512_load_si512(pvHLStore+i);
+        arr_store_col(result->stats->rowcols->score_col, vH, i, segLen);
+        arr_store_col(result->stats->rowcols->matches_col, vHM, i, segLen);
+        arr_store_col(result->stats->rowcols->similar_col, vHS, i, segLen);
+        arr_store_col(result->stats->rowcols->length_col, vHL, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        __m512i vH = _mm512_load_si512(pvHStore + offset);
+        __m512i vHM = _mm512_load_si512(pvHMStore + offset);
+        __m512i vHS = _mm512_load_si512(pvHSStore + offset);
+        __m512i vHL = _mm512_load_si512(pvHLStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm512_slli_si512_rpl (vH, 2);
+            vHM = _mm512_slli_si512_rpl (vHM, 2);
+            vHS = _mm512_slli_si512_rpl (vHS, 2);
+            vHL = _mm512_slli_si512_rpl (vHL, 2);
+        }
+        score = (int16_t) _mm512_extract_epi16_rpl (vH, 31);
+        matches = (int16_t) _mm512_extract_epi16_rpl (vHM, 31);
+        similar = (int16_t) _mm512_extract_epi16_rpl (vHS, 31);
+        length = (int16_t) _mm512_extract_epi16_rpl (vHL, 31);
+    }
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(
+            _mm512_cmplt_epi16_rpl(vSaturationCheckMin, vNegLimit),
+            _mm512_cmpgt_epi16_rpl(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        matches = 0;
+        similar = 0;
+        length = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->stats->matches = matches;
+    result->stats->similar = similar;
+    result->stats->length = length;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_STATS
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_32;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvEL);
+    parasail_free(pvES);
+    parasail_free(pvEM);
+    parasail_free(pvE);
+    parasail_free(pvHLLoad);
+    parasail_free(pvHLStore);
+    parasail_free(pvHSLoad);
+    parasail_free(pvHSStore);
+    parasail_free(pvHMLoad);
+    parasail_free(pvHMStore);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+
+    return result;
+}
+
+
@@ -114,6 +114,7 @@ parasail_result_t* PNAME(
     int64_t similar = 0;
     int64_t length = 0;
     simde__m128i vNegLimit = simde_mm_set1_epi64x(NEG_LIMIT);
+    simde__m128i vNegInf = simde_mm_set1_epi64x(NEG_LIMIT-1);
     simde__m128i vPosLimit = simde_mm_set1_epi64x(POS_LIMIT);
     simde__m128i vSaturationCheckMin = vPosLimit;
     simde__m128i vSaturationCheckMax = vNegLimit;
@@ -185,8 +186,9 @@ parasail_result_t* PNAME(
         const simde__m128i* vPS = NULL;
 
         /* Initialize F value to neg inf.  Any errors to vH values will
-         * be corrected in the Lazy_F loop.  */
-        vF = vNegLimit;
+         * be corrected in the Lazy_F loop.  Neg inf is below NEG_LIMIT
+         * so that an H value floored by it is still seen as saturated. */
+        vF = vNegInf;
         vFM = vZero;
         vFS = vZero;
         vFL = vOne;
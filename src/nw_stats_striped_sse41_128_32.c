@@ -123,6 +123,7 @@ parasail_result_t* PNAME(
     int32_t similar = 0;
     int32_t length = 0;
     __m128i vNegLimit = _mm_set1_epi32(NEG_LIMIT);
+    __m128i vNegInf = _mm_set1_epi32(NEG_LIMIT-1);
     __m128i vPosLimit = _mm_set1_epi32(POS_LIMIT);
     __m128i vSaturationCheckMin = vPosLimit;
     __m128i vSaturationCheckMax = vNegLimit;
@@ -194,8 +195,9 @@ parasail_result_t* PNAME(
         const __m128i* vPS = NULL;
 
         /* Initialize F value to neg inf.  Any errors to vH values will
-         * be corrected in the Lazy_F loop.  */
-        vF = vNegLimit;
+         * be corrected in the Lazy_F loop.  Neg inf is below NEG_LIMIT
+         * so that an H value floored by it is still seen as saturated. */
+        vF = vNegInf;
         vFM = vZero;
         vFS = vZero;
         vFL = vOne;
@@ -147,6 +147,7 @@ parasail_result_t* PNAME(
     int8_t similar = 0;
     int8_t length = 0;
     __m128i vNegLimit = _mm_set1_epi8(NEG_LIMIT);
+    __m128i vNegInf = _mm_set1_epi8(NEG_LIMIT-1);
     __m128i vPosLimit = _mm_set1_epi8(POS_LIMIT);
     __m128i vSaturationCheckMin = vPosLimit;
     __m128i vSaturationCheckMax = vNegLimit;
@@ -218,8 +219,9 @@ parasail_result_t* PNAME(
         const __m128i* vPS = NULL;
 
         /* Initialize F value to neg inf.  Any errors to vH values will
-         * be corrected in the Lazy_F loop.  */
-        vF = vNegLimit;
+         * be corrected in the Lazy_F loop.  Neg inf is below NEG_LIMIT
+         * so that an H value floored by it is still seen as saturated. */
+        vF = vNegInf;
         vFM = vZero;
         vFS = vZero;
         vFL = vOne;
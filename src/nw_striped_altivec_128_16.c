@@ -67,6 +67,8 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_nw_striped_altivec_128_16
 #define PNAME parasail_nw_striped_profile_altivec_128_16
+#define FNAME_WS parasail_nw_striped_ws_altivec_128_16
+#define PNAME_WS parasail_nw_striped_profile_ws_altivec_128_16
 #endif
 #endif
 
@@ -81,10 +83,15 @@ parasail_result_t* FNAME(
     return result;
 }
 
-parasail_result_t* PNAME(
+static inline void striped_kernel(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        vec128i* restrict pvHStore,
+        vec128i* restrict pvHLoad,
+        vec128i* const restrict pvE,
+        int16_t* const restrict boundary,
+        parasail_result_t * const restrict result)
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -98,24 +105,11 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     vec128i* const restrict vProfile = (vec128i*)profile->profile16.score;
-    vec128i* restrict pvHStore = parasail_memalign_vec128i(16, segLen);
-    vec128i* restrict pvHLoad =  parasail_memalign_vec128i(16, segLen);
-    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
-    int16_t* const restrict boundary = parasail_memalign_int16_t(16, s2Len+1);
     vec128i vGapO = _mm_set1_epi16(open);
     vec128i vGapE = _mm_set1_epi16(gap);
     vec128i vNegInf = _mm_set1_epi16(NEG_INF);
     int16_t score = NEG_INF;
     
-#ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
-#else
-#ifdef PARASAIL_ROWCOL
-    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
-#endif
-#endif
 
     /* initialize H and E */
     {
@@ -260,8 +254,33 @@ end:
 #endif
 #ifdef PARASAIL_ROWCOL
     result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+    vec128i* const restrict pvHStore = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvHLoad = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
+    int16_t* const restrict boundary = parasail_memalign_int16_t(16, s2Len+1);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
 #endif
 
+    striped_kernel(profile, s2, s2Len, open, gap,
+            pvHStore, pvHLoad, pvE, boundary, result);
+
     parasail_free(boundary);
     parasail_free(pvE);
     parasail_free(pvHLoad);
@@ -270,3 +289,77 @@ end:
     return result;
 }
 
+#ifdef PNAME_WS
+parasail_result_t* FNAME_WS(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t segNum = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    parasail_profile_t profile;
+    int16_t *t = NULL;
+
+    /* the profile is built in the workspace ahead of the DP columns */
+    parasail_workspace_grow(workspace, sizeof(vec128i)*segLen*(n+3) + sizeof(int16_t)*(s2Len+1));
+    {
+        vec128i* const restrict vProfile = (vec128i*)workspace->memory;
+        vec128i* const restrict pvHStore = vProfile + n*segLen;
+        vec128i* const restrict pvHLoad = pvHStore + segLen;
+        vec128i* const restrict pvE = pvHLoad + segLen;
+        int16_t* const restrict boundary = (int16_t*)(pvE + segLen);
+
+        t = (int16_t*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<segLen; ++i) {
+                j = i;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    *t++ = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
+                    j += segLen;
+                }
+            }
+        }
+
+        parasail_profile_init(&profile, s1, s1Len, matrix);
+        profile.profile16.score = vProfile;
+        parasail_result_init(result);
+        striped_kernel(&profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* PNAME_WS(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+
+    parasail_workspace_grow(workspace, sizeof(vec128i)*segLen*3 + sizeof(int16_t)*(s2Len+1));
+    {
+        vec128i* const restrict pvHStore = (vec128i*)workspace->memory;
+        vec128i* const restrict pvHLoad = pvHStore + segLen;
+        vec128i* const restrict pvE = pvHLoad + segLen;
+        int16_t* const restrict boundary = (int16_t*)(pvE + segLen);
+
+        parasail_result_init(result);
+        striped_kernel(profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+#endif
+
@@ -55,6 +55,8 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_nw_striped_altivec_128_64
 #define PNAME parasail_nw_striped_profile_altivec_128_64
+#define FNAME_WS parasail_nw_striped_ws_altivec_128_64
+#define PNAME_WS parasail_nw_striped_profile_ws_altivec_128_64
 #endif
 #endif
 
@@ -69,10 +71,15 @@ parasail_result_t* FNAME(
     return result;
 }
 
-parasail_result_t* PNAME(
+static inline void striped_kernel(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        vec128i* restrict pvHStore,
+        vec128i* restrict pvHLoad,
+        vec128i* const restrict pvE,
+        int64_t* const restrict boundary,
+        parasail_result_t * const restrict result)
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -86,24 +93,11 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     vec128i* const restrict vProfile = (vec128i*)profile->profile64.score;
-    vec128i* restrict pvHStore = parasail_memalign_vec128i(16, segLen);
-    vec128i* restrict pvHLoad =  parasail_memalign_vec128i(16, segLen);
-    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
-    int64_t* const restrict boundary = parasail_memalign_int64_t(16, s2Len+1);
     vec128i vGapO = _mm_set1_epi64(open);
     vec128i vGapE = _mm_set1_epi64(gap);
     vec128i vNegInf = _mm_set1_epi64(NEG_INF);
     int64_t score = NEG_INF;
     
-#ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
-#else
-#ifdef PARASAIL_ROWCOL
-    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
-#endif
-#endif
 
     /* initialize H and E */
     {
@@ -248,8 +242,33 @@ end:
 #endif
 #ifdef PARASAIL_ROWCOL
     result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    const int32_t segWidth = 2; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+    vec128i* const restrict pvHStore = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvHLoad = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
+    int64_t* const restrict boundary = parasail_memalign_int64_t(16, s2Len+1);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
 #endif
 
+    striped_kernel(profile, s2, s2Len, open, gap,
+            pvHStore, pvHLoad, pvE, boundary, result);
+
     parasail_free(boundary);
     parasail_free(pvE);
     parasail_free(pvHLoad);
@@ -258,3 +277,77 @@ end:
     return result;
 }
 
+#ifdef PNAME_WS
+parasail_result_t* FNAME_WS(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t segNum = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 2; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    parasail_profile_t profile;
+    int64_t *t = NULL;
+
+    /* the profile is built in the workspace ahead of the DP columns */
+    parasail_workspace_grow(workspace, sizeof(vec128i)*segLen*(n+3) + sizeof(int64_t)*(s2Len+1));
+    {
+        vec128i* const restrict vProfile = (vec128i*)workspace->memory;
+        vec128i* const restrict pvHStore = vProfile + n*segLen;
+        vec128i* const restrict pvHLoad = pvHStore + segLen;
+        vec128i* const restrict pvE = pvHLoad + segLen;
+        int64_t* const restrict boundary = (int64_t*)(pvE + segLen);
+
+        t = (int64_t*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<segLen; ++i) {
+                j = i;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    *t++ = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
+                    j += segLen;
+                }
+            }
+        }
+
+        parasail_profile_init(&profile, s1, s1Len, matrix);
+        profile.profile64.score = vProfile;
+        parasail_result_init(result);
+        striped_kernel(&profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* PNAME_WS(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    const int32_t segWidth = 2; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+
+    parasail_workspace_grow(workspace, sizeof(vec128i)*segLen*3 + sizeof(int64_t)*(s2Len+1));
+    {
+        vec128i* const restrict pvHStore = (vec128i*)workspace->memory;
+        vec128i* const restrict pvHLoad = pvHStore + segLen;
+        vec128i* const restrict pvE = pvHLoad + segLen;
+        int64_t* const restrict boundary = (int64_t*)(pvE + segLen);
+
+        parasail_result_init(result);
+        striped_kernel(profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+#endif
+
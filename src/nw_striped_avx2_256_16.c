@@ -106,6 +106,8 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_nw_striped_avx2_256_16
 #define PNAME parasail_nw_striped_profile_avx2_256_16
+#define FNAME_WS parasail_nw_striped_ws_avx2_256_16
+#define PNAME_WS parasail_nw_striped_profile_ws_avx2_256_16
 #endif
 #endif
 
@@ -120,10 +122,15 @@ parasail_result_t* FNAME(
     return result;
 }
 
-parasail_result_t* PNAME(
+static inline void striped_kernel(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        __m256i* restrict pvHStore,
+        __m256i* restrict pvHLoad,
+        __m256i* const restrict pvE,
+        int16_t* const restrict boundary,
+        parasail_result_t * const restrict result)
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -137,24 +144,11 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     __m256i* const restrict vProfile = (__m256i*)profile->profile16.score;
-    __m256i* restrict pvHStore = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHLoad =  parasail_memalign___m256i(32, segLen);
-    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
-    int16_t* const restrict boundary = parasail_memalign_int16_t(32, s2Len+1);
     __m256i vGapO = _mm256_set1_epi16(open);
     __m256i vGapE = _mm256_set1_epi16(gap);
     __m256i vNegInf = _mm256_set1_epi16(NEG_INF);
     int16_t score = NEG_INF;
     
-#ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
-#else
-#ifdef PARASAIL_ROWCOL
-    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
-#endif
-#endif
 
     /* initialize H and E */
     {
@@ -299,8 +293,33 @@ end:
 #endif
 #ifdef PARASAIL_ROWCOL
     result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+    __m256i* const restrict pvHStore = parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvHLoad = parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
+    int16_t* const restrict boundary = parasail_memalign_int16_t(32, s2Len+1);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
 #endif
 
+    striped_kernel(profile, s2, s2Len, open, gap,
+            pvHStore, pvHLoad, pvE, boundary, result);
+
     parasail_free(boundary);
     parasail_free(pvE);
     parasail_free(pvHLoad);
@@ -309,3 +328,77 @@ end:
     return result;
 }
 
+#ifdef PNAME_WS
+parasail_result_t* FNAME_WS(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t segNum = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    parasail_profile_t profile;
+    int16_t *t = NULL;
+
+    /* the profile is built in the workspace ahead of the DP columns */
+    parasail_workspace_grow(workspace, sizeof(__m256i)*segLen*(n+3) + sizeof(int16_t)*(s2Len+1));
+    {
+        __m256i* const restrict vProfile = (__m256i*)workspace->memory;
+        __m256i* const restrict pvHStore = vProfile + n*segLen;
+        __m256i* const restrict pvHLoad = pvHStore + segLen;
+        __m256i* const restrict pvE = pvHLoad + segLen;
+        int16_t* const restrict boundary = (int16_t*)(pvE + segLen);
+
+        t = (int16_t*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<segLen; ++i) {
+                j = i;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    *t++ = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
+                    j += segLen;
+                }
+            }
+        }
+
+        parasail_profile_init(&profile, s1, s1Len, matrix);
+        profile.profile16.score = vProfile;
+        parasail_result_init(result);
+        striped_kernel(&profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* PNAME_WS(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+
+    parasail_workspace_grow(workspace, sizeof(__m256i)*segLen*3 + sizeof(int16_t)*(s2Len+1));
+    {
+        __m256i* const restrict pvHStore = (__m256i*)workspace->memory;
+        __m256i* const restrict pvHLoad = pvHStore + segLen;
+        __m256i* const restrict pvE = pvHLoad + segLen;
+        int16_t* const restrict boundary = (int16_t*)(pvE + segLen);
+
+        parasail_result_init(result);
+        striped_kernel(profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+#endif
+
@@ -0,0 +1,371 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define NEG_INF (INT64_MIN/(int64_t)(2))
+
+#define _mm512_insert_epi64_rpl(a,i,imm) _mm512_mask_set1_epi64(a, (__mmask8)1<<(imm), i)
+
+#define _mm512_extract_epi64_rpl(a,imm) _mm_extract_epi64(_mm512_extracti32x4_epi32(a, (imm)>>1), (imm)&1)
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    array[1LL*(0*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 0);
+    array[1LL*(1*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 1);
+    array[1LL*(2*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 2);
+    array[1LL*(3*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 3);
+    array[1LL*(4*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 4);
+    array[1LL*(5*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 5);
+    array[1LL*(6*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 6);
+    array[1LL*(7*seglen+t)*dlen + d] = (int64_t)_mm512_extract_epi64_rpl(vH, 7);
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen)
+{
+    col[0*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 0);
+    col[1*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 1);
+    col[2*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 2);
+    col[3*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 3);
+    col[4*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 4);
+    col[5*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 5);
+    col[6*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 6);
+    col[7*seglen+t] = (int64_t)_mm512_extract_epi64_rpl(vH, 7);
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_striped_avx512_512_64
+#define PNAME parasail_nw_table_striped_profile_avx512_512_64
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_striped_avx512_512_64
+#define PNAME parasail_nw_rowcol_striped_profile_avx512_512_64
+#else
+#define FNAME parasail_nw_striped_avx512_512_64
+#define PNAME parasail_nw_striped_profile_avx512_512_64
+#define FNAME_WS parasail_nw_striped_ws_avx512_512_64
+#define PNAME_WS parasail_nw_striped_profile_ws_avx512_512_64
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx512_512_64(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+static inline void striped_kernel(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        __m512i* restrict pvHStore,
+        __m512i* restrict pvHLoad,
+        __m512i* const restrict pvE,
+        int64_t* const restrict boundary,
+        parasail_result_t * const restrict result)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m512i* const restrict vProfile = (__m512i*)profile->profile64.score;
+    __m512i vGapO = _mm512_set1_epi64(open);
+    __m512i vGapE = _mm512_set1_epi64(gap);
+    __m512i vNegInf = _mm512_set1_epi64(NEG_INF);
+    int64_t score = NEG_INF;
+    
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m512i_64_t h;
+            __m512i_64_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+            }
+            _mm512_store_si512(&pvHStore[index], h.m);
+            _mm512_store_si512(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT64_MIN ? INT64_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        __m512i vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        __m512i vH = _mm512_slli_si512_rpl(pvHStore[segLen - 1], 8);
+
+        /* Correct part of the vProfile */
+        const __m512i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+
+        /* Swap the 2 H buffers. */
+        __m512i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = _mm512_insert_epi64_rpl(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = _mm512_add_epi64(vH, _mm512_load_si512(vP + i));
+            vE = _mm512_load_si512(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm512_max_epi64(vH, vE);
+            vH = _mm512_max_epi64(vH, vF);
+            /* Save vH values. */
+            _mm512_store_si512(pvHStore + i, vH);
+            
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = _mm512_sub_epi64(vH, vGapO);
+            vE = _mm512_sub_epi64(vE, vGapE);
+            vE = _mm512_max_epi64(vE, vH);
+            _mm512_store_si512(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm512_sub_epi64(vF, vGapE);
+            vF = _mm512_max_epi64(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm512_load_si512(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            int64_t tmp2 = tmp < INT64_MIN ? INT64_MIN : tmp;
+            vF = _mm512_slli_si512_rpl(vF, 8);
+            vF = _mm512_insert_epi64_rpl(vF, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm512_load_si512(pvHStore + i);
+                vH = _mm512_max_epi64(vH,vF);
+                _mm512_store_si512(pvHStore + i, vH);
+                
+#ifdef PARASAIL_TABLE
+                arr_store_si512(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = _mm512_sub_epi64(vH, vGapO);
+                vF = _mm512_sub_epi64(vF, vGapE);
+                if (! _mm512_cmpgt_epi64_mask(vF, vH)) goto end;
+                /*vF = _mm512_max_epi64(vF, vH);*/
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm512_load_si512(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl(vH, 8);
+            }
+            result->rowcols->score_row[j] = (int64_t) _mm512_extract_epi64_rpl (vH, 7);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m512i vH = _mm512_load_si512(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        __m512i vH = _mm512_load_si512(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm512_slli_si512_rpl (vH, 8);
+        }
+        score = (int64_t) _mm512_extract_epi64_rpl (vH, 7);
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_64 | PARASAIL_FLAG_LANES_8;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+    __m512i* const restrict pvHStore = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHLoad = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvE = parasail_memalign___m512i(64, segLen);
+    int64_t* const restrict boundary = parasail_memalign_int64_t(64, s2Len+1);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    striped_kernel(profile, s2, s2Len, open, gap,
+            pvHStore, pvHLoad, pvE, boundary, result);
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+
+    return result;
+}
+
+#ifdef PNAME_WS
+parasail_result_t* FNAME_WS(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t segNum = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    parasail_profile_t profile;
+    int64_t *t = NULL;
+
+    /* the profile is built in the workspace ahead of the DP columns */
+    parasail_workspace_grow(workspace, sizeof(__m512i)*segLen*(n+3) + sizeof(int64_t)*(s2Len+1));
+    {
+        __m512i* const restrict vProfile = (__m512i*)workspace->memory;
+        __m512i* const restrict pvHStore = vProfile + n*segLen;
+        __m512i* const restrict pvHLoad = pvHStore + segLen;
+        __m512i* const restrict pvE = pvHLoad + segLen;
+        int64_t* const restrict boundary = (int64_t*)(pvE + segLen);
+
+        t = (int64_t*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<segLen; ++i) {
+                j = i;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    *t++ = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
+                    j += segLen;
+                }
+            }
+        }
+
+        parasail_profile_init(&profile, s1, s1Len, matrix);
+        profile.profile64.score = vProfile;
+        parasail_result_init(result);
+        striped_kernel(&profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* PNAME_WS(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+
+    parasail_workspace_grow(workspace, sizeof(__m512i)*segLen*3 + sizeof(int64_t)*(s2Len+1));
+    {
+        __m512i* const restrict pvHStore = (__m512i*)workspace->memory;
+        __m512i* const restrict pvHLoad = pvHStore + segLen;
+        __m512i* const restrict pvE = pvHLoad + segLen;
+        int64_t* const restrict boundary = (int64_t*)(pvE + segLen);
+
+        parasail_result_init(result);
+        striped_kernel(profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+#endif
+
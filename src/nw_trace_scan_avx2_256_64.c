@@ -80,23 +80,59 @@ static inline __m256i _mm256_min_epi64_rpl(__m256i a, __m256i b) {
 #define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
 
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 64/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         __m256i *array,
-        __m256i vH,
-        int32_t t,
+        const __m256i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    _mm256_store_si256(array + (1LL*d*seglen+t), vH);
+    const int32_t cells = 64 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const __m256i vZero = _mm256_setzero_si256();
+    const __m256i vInsDiag = _mm256_set1_epi64x_rpl(PARASAIL_INS | PARASAIL_DIAG);
+    const __m256i vDelDiag = _mm256_set1_epi64x_rpl(PARASAIL_DEL | PARASAIL_DIAG);
+    const __m256i vInsE = _mm256_set1_epi64x_rpl(PARASAIL_INS_E);
+    const __m256i vDelF = _mm256_set1_epi64x_rpl(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        __m256i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            __m256i vT = _mm256_load_si256(pvT + q*cells + p);
+            __m256i vBit0 = _mm256_set1_epi64x_rpl((int64_t)(1ULL << (4*p)));
+            __m256i vBit1 = _mm256_set1_epi64x_rpl((int64_t)(1ULL << (4*p+1)));
+            __m256i vBit2 = _mm256_set1_epi64x_rpl((int64_t)(1ULL << (4*p+2)));
+            __m256i vBit3 = _mm256_set1_epi64x_rpl((int64_t)(1ULL << (4*p+3)));
+            vP = _mm256_or_si256(vP, _mm256_andnot_si256(
+                        _mm256_cmpeq_epi64(_mm256_and_si256(vT, vInsDiag), vZero), vBit0));
+            vP = _mm256_or_si256(vP, _mm256_andnot_si256(
+                        _mm256_cmpeq_epi64(_mm256_and_si256(vT, vDelDiag), vZero), vBit1));
+            vP = _mm256_or_si256(vP, _mm256_andnot_si256(
+                        _mm256_cmpeq_epi64(_mm256_and_si256(vT, vInsE), vZero), vBit2));
+            vP = _mm256_or_si256(vP, _mm256_andnot_si256(
+                        _mm256_cmpeq_epi64(_mm256_and_si256(vT, vDelF), vZero), vBit3));
+        }
+        _mm256_store_si256(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline __m256i arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         __m256i *array,
-        int32_t t,
+        const __m256i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    return _mm256_load_si256(array + (1LL*d*seglen+t));
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        _mm256_store_si256(array + (1LL*d*seglen+t), _mm256_load_si256(pvT + t));
+    }
 }
 
 #define FNAME parasail_nw_trace_scan_avx2_256_64
@@ -135,6 +171,7 @@ parasail_result_t* PNAME(
     __m256i* const restrict pvHt = parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvH  = parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvGapper = parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvT = parasail_memalign___m256i(32, segLen);
     __m256i vGapO = _mm256_set1_epi64x_rpl(open);
     __m256i vGapE = _mm256_set1_epi64x_rpl(gap);
     const int64_t NEG_LIMIT = (-open < matrix->min ?
@@ -148,7 +185,10 @@ parasail_result_t* PNAME(
     __m256i vSaturationCheckMax = vNegLimit;
     __m256i vNegInfFront = vZero;
     __m256i vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 32, sizeof(__m256i));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 64/4 - 1) / (64/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 32, sizeof(__m256i));
     __m256i vTIns  = _mm256_set1_epi64x_rpl(PARASAIL_INS);
     __m256i vTDel  = _mm256_set1_epi64x_rpl(PARASAIL_DEL);
     __m256i vTDiag = _mm256_set1_epi64x_rpl(PARASAIL_DIAG);
@@ -235,7 +275,7 @@ parasail_result_t* PNAME(
             vE_ext = _mm256_sub_epi64(vE, vGapE);
             case1 = _mm256_cmpgt_epi64(vE_opn, vE_ext);
             vET = _mm256_blendv_epi8(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            _mm256_store_si256(pvT + i, vET);
             vE = _mm256_max_epi64_rpl(vE_opn, vE_ext);
             vSaturationCheckMin = _mm256_min_epi64_rpl(vSaturationCheckMin, vE);
             vGapper = _mm256_add_epi64(vHt, vGapper);
@@ -265,7 +305,7 @@ parasail_result_t* PNAME(
         vF = _mm256_add_epi64(vF, vNegInfFront);
         vH = _mm256_max_epi64_rpl(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = _mm256_load_si256(pvT + i);
             vHp = _mm256_load_si256(pvH+i);
             vHt = _mm256_load_si256(pvHt+i);
             vF_opn = _mm256_sub_epi64(vH, vGapO);
@@ -281,12 +321,19 @@ parasail_result_t* PNAME(
                     vTDiag, case1);
             vT = _mm256_or_si256(vT, vET);
             vT = _mm256_or_si256(vT, vFT);
-            arr_store(result->trace->trace_table, vT, i, segLen, j);
+            _mm256_store_si256(pvT + i, vT);
             _mm256_store_si256(pvH+i, vH);
             vSaturationCheckMin = _mm256_min_epi64_rpl(vSaturationCheckMin, vH);
             vSaturationCheckMin = _mm256_min_epi64_rpl(vSaturationCheckMin, vF);
             vSaturationCheckMax = _mm256_max_epi64_rpl(vSaturationCheckMax, vH);
         }
+
+        if (packed) {
+            arr_pack(result->trace->trace_table, pvT, segLen, j);
+        }
+        else {
+            arr_copy(result->trace->trace_table, pvT, segLen, j);
+        }
     }
 
     /* extract last value from the last column */
@@ -313,7 +360,10 @@ parasail_result_t* PNAME(
     result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_SCAN
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_64 | PARASAIL_FLAG_LANES_4;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
 
+    parasail_free(pvT);
     parasail_free(pvGapper);
     parasail_free(pvH);
     parasail_free(pvHt);
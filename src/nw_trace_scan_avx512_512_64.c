@@ -0,0 +1,328 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+
+#define _mm512_cmpeq_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmpeq_epi64_mask(a,b), _mm512_set1_epi64(-1))
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_cmpgt_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmpgt_epi64_mask(a,b), _mm512_set1_epi64(-1))
+
+#define _mm512_insert_epi64_rpl(a,i,imm) _mm512_mask_set1_epi64(a, (__mmask8)1<<(imm), i)
+
+#define _mm512_extract_epi64_rpl(a,imm) _mm_extract_epi64(_mm512_extracti32x4_epi32(a, (imm)>>1), (imm)&1)
+
+#define _mm512_cmplt_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmplt_epi64_mask(a,b), _mm512_set1_epi64(-1))
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 64/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
+        __m512i *array,
+        const __m512i *pvT,
+        int32_t seglen,
+        int32_t d)
+{
+    const int32_t cells = 64 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const __m512i vZero = _mm512_setzero_si512();
+    const __m512i vInsDiag = _mm512_set1_epi64(PARASAIL_INS | PARASAIL_DIAG);
+    const __m512i vDelDiag = _mm512_set1_epi64(PARASAIL_DEL | PARASAIL_DIAG);
+    const __m512i vInsE = _mm512_set1_epi64(PARASAIL_INS_E);
+    const __m512i vDelF = _mm512_set1_epi64(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        __m512i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            __m512i vT = _mm512_load_si512(pvT + q*cells + p);
+            __m512i vBit0 = _mm512_set1_epi64((int64_t)(1ULL << (4*p)));
+            __m512i vBit1 = _mm512_set1_epi64((int64_t)(1ULL << (4*p+1)));
+            __m512i vBit2 = _mm512_set1_epi64((int64_t)(1ULL << (4*p+2)));
+            __m512i vBit3 = _mm512_set1_epi64((int64_t)(1ULL << (4*p+3)));
+            vP = _mm512_or_si512(vP, _mm512_andnot_si512(
+                        _mm512_cmpeq_epi64_rpl(_mm512_and_si512(vT, vInsDiag), vZero), vBit0));
+            vP = _mm512_or_si512(vP, _mm512_andnot_si512(
+                        _mm512_cmpeq_epi64_rpl(_mm512_and_si512(vT, vDelDiag), vZero), vBit1));
+            vP = _mm512_or_si512(vP, _mm512_andnot_si512(
+                        _mm512_cmpeq_epi64_rpl(_mm512_and_si512(vT, vInsE), vZero), vBit2));
+            vP = _mm512_or_si512(vP, _mm512_andnot_si512(
+                        _mm512_cmpeq_epi64_rpl(_mm512_and_si512(vT, vDelF), vZero), vBit3));
+        }
+        _mm512_store_si512(array + (1LL*d*seglenp+q), vP);
+    }
+}
+
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
+        __m512i *array,
+        const __m512i *pvT,
+        int32_t seglen,
+        int32_t d)
+{
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        _mm512_store_si512(array + (1LL*d*seglen+t), _mm512_load_si512(pvT + t));
+    }
+}
+
+#define FNAME parasail_nw_trace_scan_avx512_512_64
+#define PNAME parasail_nw_trace_scan_profile_avx512_512_64
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx512_512_64(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m512i* const restrict pvP  = (__m512i*)profile->profile64.score;
+    __m512i* const restrict pvE  = parasail_memalign___m512i(64, segLen);
+    int64_t* const restrict boundary = parasail_memalign_int64_t(64, s2Len+1);
+    __m512i* const restrict pvHt = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvH  = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvGapper = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvT = parasail_memalign___m512i(64, segLen);
+    __m512i vGapO = _mm512_set1_epi64(open);
+    __m512i vGapE = _mm512_set1_epi64(gap);
+    const int64_t NEG_LIMIT = (-open < matrix->min ?
+        INT64_MIN + open : INT64_MIN - matrix->min) + 1;
+    const int64_t POS_LIMIT = INT64_MAX - matrix->max - 1;
+    __m512i vZero = _mm512_setzero_si512();
+    int64_t score = NEG_LIMIT;
+    __m512i vNegLimit = _mm512_set1_epi64(NEG_LIMIT);
+    __m512i vPosLimit = _mm512_set1_epi64(POS_LIMIT);
+    __m512i vSaturationCheckMin = vPosLimit;
+    __m512i vSaturationCheckMax = vNegLimit;
+    __m512i vNegInfFront = vZero;
+    __m512i vSegLenXgap;
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 64/4 - 1) / (64/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 64, sizeof(__m512i));
+    __m512i vTIns  = _mm512_set1_epi64(PARASAIL_INS);
+    __m512i vTDel  = _mm512_set1_epi64(PARASAIL_DEL);
+    __m512i vTDiag = _mm512_set1_epi64(PARASAIL_DIAG);
+    __m512i vTDiagE = _mm512_set1_epi64(PARASAIL_DIAG_E);
+    __m512i vTInsE = _mm512_set1_epi64(PARASAIL_INS_E);
+    __m512i vTDiagF = _mm512_set1_epi64(PARASAIL_DIAG_F);
+    __m512i vTDelF = _mm512_set1_epi64(PARASAIL_DEL_F);
+
+    vNegInfFront = _mm512_insert_epi64_rpl(vNegInfFront, NEG_LIMIT, 0);
+    vSegLenXgap = _mm512_add_epi64(vNegInfFront,
+            _mm512_slli_si512_rpl(_mm512_set1_epi64(-segLen*gap), 8));
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m512i_64_t h;
+            __m512i_64_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+            }
+            _mm512_store_si512(&pvH[index], h.m);
+            _mm512_store_si512(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT64_MIN ? INT64_MIN : tmp;
+        }
+    }
+
+    {
+        __m512i vGapper = _mm512_sub_epi64(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm512_store_si512(pvGapper+i, vGapper);
+            vGapper = _mm512_sub_epi64(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vE;
+        __m512i vE_ext;
+        __m512i vE_opn;
+        __m512i vHt;
+        __m512i vF;
+        __m512i vF_ext;
+        __m512i vF_opn;
+        __m512i vH;
+        __m512i vHp;
+        __m512i *pvW;
+        __m512i vW;
+        __m512i case1;
+        __m512i case2;
+        __m512i vGapper;
+        __m512i vT;
+        __m512i vET;
+        __m512i vFT;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm512_load_si512(pvH+(segLen-1));
+        vHp = _mm512_slli_si512_rpl(vHp, 8);
+        vHp = _mm512_insert_epi64_rpl(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm512_sub_epi64(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm512_load_si512(pvH+i);
+            vE = _mm512_load_si512(pvE+i);
+            vW = _mm512_load_si512(pvW+i);
+            vGapper = _mm512_load_si512(pvGapper+i);
+            vE_opn = _mm512_sub_epi64(vH, vGapO);
+            vE_ext = _mm512_sub_epi64(vE, vGapE);
+            case1 = _mm512_cmpgt_epi64_rpl(vE_opn, vE_ext);
+            vET = _mm512_blendv_epi8_rpl(vTInsE, vTDiagE, case1);
+            _mm512_store_si512(pvT + i, vET);
+            vE = _mm512_max_epi64(vE_opn, vE_ext);
+            vSaturationCheckMin = _mm512_min_epi64(vSaturationCheckMin, vE);
+            vGapper = _mm512_add_epi64(vHt, vGapper);
+            vF = _mm512_max_epi64(vF, vGapper);
+            vHp = _mm512_add_epi64(vHp, vW);
+            vHt = _mm512_max_epi64(vE, vHp);
+            _mm512_store_si512(pvE+i, vE);
+            _mm512_store_si512(pvHt+i, vHt);
+            _mm512_store_si512(pvH+i, vHp);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm512_slli_si512_rpl(vHt, 8);
+        vHt = _mm512_insert_epi64_rpl(vHt, boundary[j+1], 0);
+        vGapper = _mm512_load_si512(pvGapper);
+        vGapper = _mm512_add_epi64(vHt, vGapper);
+        vF = _mm512_max_epi64(vF, vGapper);
+        for (i=0; i<segWidth-2; ++i) {
+            __m512i vFt = _mm512_slli_si512_rpl(vF, 8);
+            vFt = _mm512_add_epi64(vFt, vSegLenXgap);
+            vF = _mm512_max_epi64(vF, vFt);
+        }
+
+        /* calculate final H */
+        vF = _mm512_slli_si512_rpl(vF, 8);
+        vF = _mm512_add_epi64(vF, vNegInfFront);
+        vH = _mm512_max_epi64(vF, vHt);
+        for (i=0; i<segLen; ++i) {
+            vET = _mm512_load_si512(pvT + i);
+            vHp = _mm512_load_si512(pvH+i);
+            vHt = _mm512_load_si512(pvHt+i);
+            vF_opn = _mm512_sub_epi64(vH, vGapO);
+            vF_ext = _mm512_sub_epi64(vF, vGapE);
+            vF = _mm512_max_epi64(vF_opn, vF_ext);
+            case1 = _mm512_cmpgt_epi64_rpl(vF_opn, vF_ext);
+            vFT = _mm512_blendv_epi8_rpl(vTDelF, vTDiagF, case1);
+            vH = _mm512_max_epi64(vHt, vF);
+            case1 = _mm512_cmpeq_epi64_rpl(vH, vHp);
+            case2 = _mm512_cmpeq_epi64_rpl(vH, vF);
+            vT = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vTIns, vTDel, case2),
+                    vTDiag, case1);
+            vT = _mm512_or_si512(vT, vET);
+            vT = _mm512_or_si512(vT, vFT);
+            _mm512_store_si512(pvT + i, vT);
+            _mm512_store_si512(pvH+i, vH);
+            vSaturationCheckMin = _mm512_min_epi64(vSaturationCheckMin, vH);
+            vSaturationCheckMin = _mm512_min_epi64(vSaturationCheckMin, vF);
+            vSaturationCheckMax = _mm512_max_epi64(vSaturationCheckMax, vH);
+        }
+
+        if (packed) {
+            arr_pack(result->trace->trace_table, pvT, segLen, j);
+        }
+        else {
+            arr_copy(result->trace->trace_table, pvT, segLen, j);
+        }
+    }
+
+    /* extract last value from the last column */
+    {
+        __m512i vH = _mm512_load_si512(pvH + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm512_slli_si512_rpl(vH, 8);
+        }
+        score = (int64_t) _mm512_extract_epi64_rpl (vH, 7);
+    }
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(
+            _mm512_cmplt_epi64_rpl(vSaturationCheckMin, vNegLimit),
+            _mm512_cmpgt_epi64_rpl(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_TRACE
+        | PARASAIL_FLAG_BITS_64 | PARASAIL_FLAG_LANES_8;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
+
+    parasail_free(pvT);
+    parasail_free(pvGapper);
+    parasail_free(pvH);
+    parasail_free(pvHt);
+    parasail_free(boundary);
+    parasail_free(pvE);
+
+    return result;
+}
+
+
@@ -18,23 +18,59 @@
 
 
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 8/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         simde__m128i *array,
-        simde__m128i vH,
-        int32_t t,
+        const simde__m128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    simde_mm_store_si128(array + (1LL*d*seglen+t), vH);
+    const int32_t cells = 8 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const simde__m128i vZero = simde_mm_setzero_si128();
+    const simde__m128i vInsDiag = simde_mm_set1_epi8(PARASAIL_INS | PARASAIL_DIAG);
+    const simde__m128i vDelDiag = simde_mm_set1_epi8(PARASAIL_DEL | PARASAIL_DIAG);
+    const simde__m128i vInsE = simde_mm_set1_epi8(PARASAIL_INS_E);
+    const simde__m128i vDelF = simde_mm_set1_epi8(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        simde__m128i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            simde__m128i vT = simde_mm_load_si128(pvT + q*cells + p);
+            simde__m128i vBit0 = simde_mm_set1_epi8((int8_t)(1ULL << (4*p)));
+            simde__m128i vBit1 = simde_mm_set1_epi8((int8_t)(1ULL << (4*p+1)));
+            simde__m128i vBit2 = simde_mm_set1_epi8((int8_t)(1ULL << (4*p+2)));
+            simde__m128i vBit3 = simde_mm_set1_epi8((int8_t)(1ULL << (4*p+3)));
+            vP = simde_mm_or_si128(vP, simde_mm_andnot_si128(
+                        simde_mm_cmpeq_epi8(simde_mm_and_si128(vT, vInsDiag), vZero), vBit0));
+            vP = simde_mm_or_si128(vP, simde_mm_andnot_si128(
+                        simde_mm_cmpeq_epi8(simde_mm_and_si128(vT, vDelDiag), vZero), vBit1));
+            vP = simde_mm_or_si128(vP, simde_mm_andnot_si128(
+                        simde_mm_cmpeq_epi8(simde_mm_and_si128(vT, vInsE), vZero), vBit2));
+            vP = simde_mm_or_si128(vP, simde_mm_andnot_si128(
+                        simde_mm_cmpeq_epi8(simde_mm_and_si128(vT, vDelF), vZero), vBit3));
+        }
+        simde_mm_store_si128(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline simde__m128i arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         simde__m128i *array,
-        int32_t t,
+        const simde__m128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    return simde_mm_load_si128(array + (1LL*d*seglen+t));
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        simde_mm_store_si128(array + (1LL*d*seglen+t), simde_mm_load_si128(pvT + t));
+    }
 }
 
 #define FNAME parasail_nw_trace_scan_neon_128_8
@@ -73,6 +109,7 @@ parasail_result_t* PNAME(
     simde__m128i* const restrict pvHt = parasail_memalign_simde__m128i(16, segLen);
     simde__m128i* const restrict pvH  = parasail_memalign_simde__m128i(16, segLen);
     simde__m128i* const restrict pvGapper = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* const restrict pvT = parasail_memalign_simde__m128i(16, segLen);
     simde__m128i vGapO = simde_mm_set1_epi8(open);
     simde__m128i vGapE = simde_mm_set1_epi8(gap);
     const int8_t NEG_LIMIT = (-open < matrix->min ?
@@ -86,7 +123,10 @@ parasail_result_t* PNAME(
     simde__m128i vSaturationCheckMax = vNegLimit;
     simde__m128i vNegInfFront = vZero;
     simde__m128i vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(simde__m128i));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 8/4 - 1) / (8/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 16, sizeof(simde__m128i));
     simde__m128i vTIns  = simde_mm_set1_epi8(PARASAIL_INS);
     simde__m128i vTDel  = simde_mm_set1_epi8(PARASAIL_DEL);
     simde__m128i vTDiag = simde_mm_set1_epi8(PARASAIL_DIAG);
@@ -173,7 +213,7 @@ parasail_result_t* PNAME(
             vE_ext = simde_mm_subs_epi8(vE, vGapE);
             case1 = simde_mm_cmpgt_epi8(vE_opn, vE_ext);
             vET = simde_mm_blendv_epi8(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            simde_mm_store_si128(pvT + i, vET);
             vE = simde_mm_max_epi8(vE_opn, vE_ext);
             vSaturationCheckMin = simde_mm_min_epi8(vSaturationCheckMin, vE);
             vGapper = simde_mm_adds_epi8(vHt, vGapper);
@@ -203,7 +243,7 @@ parasail_result_t* PNAME(
         vF = simde_mm_adds_epi8(vF, vNegInfFront);
         vH = simde_mm_max_epi8(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = simde_mm_load_si128(pvT + i);
             vHp = simde_mm_load_si128(pvH+i);
             vHt = simde_mm_load_si128(pvHt+i);
             vF_opn = simde_mm_subs_epi8(vH, vGapO);
@@ -219,12 +259,19 @@ parasail_result_t* PNAME(
                     vTDiag, case1);
             vT = simde_mm_or_si128(vT, vET);
             vT = simde_mm_or_si128(vT, vFT);
-            arr_store(result->trace->trace_table, vT, i, segLen, j);
+            simde_mm_store_si128(pvT + i, vT);
             simde_mm_store_si128(pvH+i, vH);
             vSaturationCheckMin = simde_mm_min_epi8(vSaturationCheckMin, vH);
             vSaturationCheckMin = simde_mm_min_epi8(vSaturationCheckMin, vF);
             vSaturationCheckMax = simde_mm_max_epi8(vSaturationCheckMax, vH);
         }
+
+        if (packed) {
+            arr_pack(result->trace->trace_table, pvT, segLen, j);
+        }
+        else {
+            arr_copy(result->trace->trace_table, pvT, segLen, j);
+        }
     }
 
     /* extract last value from the last column */
@@ -251,7 +298,10 @@ parasail_result_t* PNAME(
     result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_SCAN
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_16;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
 
+    parasail_free(pvT);
     parasail_free(pvGapper);
     parasail_free(pvH);
     parasail_free(pvHt);
@@ -28,23 +28,59 @@ static inline __m128i _mm_blendv_epi8_rpl(__m128i a, __m128i b, __m128i mask) {
 }
 
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 16/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         __m128i *array,
-        __m128i vH,
-        int32_t t,
+        const __m128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    _mm_store_si128(array + (1LL*d*seglen+t), vH);
+    const int32_t cells = 16 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const __m128i vZero = _mm_setzero_si128();
+    const __m128i vInsDiag = _mm_set1_epi16(PARASAIL_INS | PARASAIL_DIAG);
+    const __m128i vDelDiag = _mm_set1_epi16(PARASAIL_DEL | PARASAIL_DIAG);
+    const __m128i vInsE = _mm_set1_epi16(PARASAIL_INS_E);
+    const __m128i vDelF = _mm_set1_epi16(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        __m128i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            __m128i vT = _mm_load_si128(pvT + q*cells + p);
+            __m128i vBit0 = _mm_set1_epi16((int16_t)(1ULL << (4*p)));
+            __m128i vBit1 = _mm_set1_epi16((int16_t)(1ULL << (4*p+1)));
+            __m128i vBit2 = _mm_set1_epi16((int16_t)(1ULL << (4*p+2)));
+            __m128i vBit3 = _mm_set1_epi16((int16_t)(1ULL << (4*p+3)));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi16(_mm_and_si128(vT, vInsDiag), vZero), vBit0));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi16(_mm_and_si128(vT, vDelDiag), vZero), vBit1));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi16(_mm_and_si128(vT, vInsE), vZero), vBit2));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi16(_mm_and_si128(vT, vDelF), vZero), vBit3));
+        }
+        _mm_store_si128(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline __m128i arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         __m128i *array,
-        int32_t t,
+        const __m128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    return _mm_load_si128(array + (1LL*d*seglen+t));
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        _mm_store_si128(array + (1LL*d*seglen+t), _mm_load_si128(pvT + t));
+    }
 }
 
 #define FNAME parasail_nw_trace_scan_sse2_128_16
@@ -83,6 +119,7 @@ parasail_result_t* PNAME(
     __m128i* const restrict pvHt = parasail_memalign___m128i(16, segLen);
     __m128i* const restrict pvH  = parasail_memalign___m128i(16, segLen);
     __m128i* const restrict pvGapper = parasail_memalign___m128i(16, segLen);
+    __m128i* const restrict pvT = parasail_memalign___m128i(16, segLen);
     __m128i vGapO = _mm_set1_epi16(open);
     __m128i vGapE = _mm_set1_epi16(gap);
     const int16_t NEG_LIMIT = (-open < matrix->min ?
@@ -96,7 +133,10 @@ parasail_result_t* PNAME(
     __m128i vSaturationCheckMax = vNegLimit;
     __m128i vNegInfFront = vZero;
     __m128i vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(__m128i));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 16/4 - 1) / (16/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 16, sizeof(__m128i));
     __m128i vTIns  = _mm_set1_epi16(PARASAIL_INS);
     __m128i vTDel  = _mm_set1_epi16(PARASAIL_DEL);
     __m128i vTDiag = _mm_set1_epi16(PARASAIL_DIAG);
@@ -183,7 +223,7 @@ parasail_result_t* PNAME(
             vE_ext = _mm_sub_epi16(vE, vGapE);
             case1 = _mm_cmpgt_epi16(vE_opn, vE_ext);
             vET = _mm_blendv_epi8_rpl(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            _mm_store_si128(pvT + i, vET);
             vE = _mm_max_epi16(vE_opn, vE_ext);
             vSaturationCheckMin = _mm_min_epi16(vSaturationCheckMin, vE);
             vGapper = _mm_add_epi16(vHt, vGapper);
@@ -213,7 +253,7 @@ parasail_result_t* PNAME(
         vF = _mm_add_epi16(vF, vNegInfFront);
         vH = _mm_max_epi16(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = _mm_load_si128(pvT + i);
             vHp = _mm_load_si128(pvH+i);
             vHt = _mm_load_si128(pvHt+i);
             vF_opn = _mm_sub_epi16(vH, vGapO);
@@ -229,12 +269,19 @@ parasail_result_t* PNAME(
                     vTDiag, case1);
             vT = _mm_or_si128(vT, vET);
             vT = _mm_or_si128(vT, vFT);
-            arr_store(result->trace->trace_table, vT, i, segLen, j);
+            _mm_store_si128(pvT + i, vT);
             _mm_store_si128(pvH+i, vH);
             vSaturationCheckMin = _mm_min_epi16(vSaturationCheckMin, vH);
             vSaturationCheckMin = _mm_min_epi16(vSaturationCheckMin, vF);
             vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vH);
         }
+
+        if (packed) {
+            arr_pack(result->trace->trace_table, pvT, segLen, j);
+        }
+        else {
+            arr_copy(result->trace->trace_table, pvT, segLen, j);
+        }
     }
 
     /* extract last value from the last column */
@@ -261,7 +308,10 @@ parasail_result_t* PNAME(
     result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_SCAN
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
 
+    parasail_free(pvT);
     parasail_free(pvGapper);
     parasail_free(pvH);
     parasail_free(pvHt);
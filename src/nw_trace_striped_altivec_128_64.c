@@ -21,23 +21,59 @@
 #define NEG_INF (INT64_MIN/(int64_t)(2))
 
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 64/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         vec128i *array,
-        vec128i vH,
-        int32_t t,
+        const vec128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    _mm_store_si128(array + (1LL*d*seglen+t), vH);
+    const int32_t cells = 64 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const vec128i vZero = _mm_setzero_si128();
+    const vec128i vInsDiag = _mm_set1_epi64(PARASAIL_INS | PARASAIL_DIAG);
+    const vec128i vDelDiag = _mm_set1_epi64(PARASAIL_DEL | PARASAIL_DIAG);
+    const vec128i vInsE = _mm_set1_epi64(PARASAIL_INS_E);
+    const vec128i vDelF = _mm_set1_epi64(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        vec128i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            vec128i vT = _mm_load_si128(pvT + q*cells + p);
+            vec128i vBit0 = _mm_set1_epi64((int64_t)(1ULL << (4*p)));
+            vec128i vBit1 = _mm_set1_epi64((int64_t)(1ULL << (4*p+1)));
+            vec128i vBit2 = _mm_set1_epi64((int64_t)(1ULL << (4*p+2)));
+            vec128i vBit3 = _mm_set1_epi64((int64_t)(1ULL << (4*p+3)));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi64(_mm_and_si128(vT, vInsDiag), vZero), vBit0));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi64(_mm_and_si128(vT, vDelDiag), vZero), vBit1));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi64(_mm_and_si128(vT, vInsE), vZero), vBit2));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi64(_mm_and_si128(vT, vDelF), vZero), vBit3));
+        }
+        _mm_store_si128(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline vec128i arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         vec128i *array,
-        int32_t t,
+        const vec128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    return _mm_load_si128(array + (1LL*d*seglen+t));
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        _mm_store_si128(array + (1LL*d*seglen+t), _mm_load_si128(pvT + t));
+    }
 }
 
 #define FNAME parasail_nw_trace_striped_altivec_128_64
@@ -78,12 +114,17 @@ parasail_result_t* PNAME(
     vec128i* restrict pvEaLoad = parasail_memalign_vec128i(16, segLen);
     vec128i* const restrict pvHT = parasail_memalign_vec128i(16, segLen);
     int64_t* const restrict boundary = parasail_memalign_int64_t(16, s2Len+1);
+    vec128i* restrict pvT = parasail_memalign_vec128i(16, segLen);
+    vec128i* restrict pvTNext = parasail_memalign_vec128i(16, segLen);
     vec128i vGapO = _mm_set1_epi64(open);
     vec128i vGapE = _mm_set1_epi64(gap);
     vec128i vNegInf = _mm_set1_epi64(NEG_INF);
     int64_t score = NEG_INF;
     
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(vec128i));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 64/4 - 1) / (64/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 16, sizeof(vec128i));
     vec128i vTIns  = _mm_set1_epi64(PARASAIL_INS);
     vec128i vTDel  = _mm_set1_epi64(PARASAIL_DEL);
     vec128i vTDiag = _mm_set1_epi64(PARASAIL_DIAG);
@@ -124,7 +165,7 @@ parasail_result_t* PNAME(
     }
 
     for (i=0; i<segLen; ++i) {
-        arr_store(result->trace->trace_table, vTDiagE, i, segLen, 0);
+        _mm_store_si128(pvT + i, vTDiagE);
     }
 
     /* outer loop over database sequence */
@@ -171,7 +212,7 @@ parasail_result_t* PNAME(
             
 
             {
-                vec128i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                vec128i vTAll = _mm_load_si128(pvT + i);
                 vec128i case1 = _mm_cmpeq_epi64(vH, vH_dag);
                 vec128i case2 = _mm_cmpeq_epi64(vH, vF);
                 vec128i vT = _mm_blendv_epi8(
@@ -179,7 +220,7 @@ parasail_result_t* PNAME(
                         vTDiag, case1);
                 _mm_store_si128(pvHT + i, vT);
                 vT = _mm_or_si128(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i, segLen, j);
+                _mm_store_si128(pvT + i, vT);
             }
 
             vEF_opn = _mm_sub_epi64(vH, vGapO);
@@ -196,7 +237,7 @@ parasail_result_t* PNAME(
                 if (j+1<s2Len) {
                     vec128i cond = _mm_cmpgt_epi64(vEF_opn, vEa_ext);
                     vec128i vT = _mm_blendv_epi8(vTInsE, vTDiagE, cond);
-                    arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                    _mm_store_si128(pvTNext + i, vT);
                 }
             }
 
@@ -204,11 +245,11 @@ parasail_result_t* PNAME(
             vF_ext = _mm_sub_epi64(vF, vGapE);
             vF = _mm_max_epi64(vEF_opn, vF_ext);
             if (i+1<segLen) {
-                vec128i vTAll = arr_load(result->trace->trace_table, i+1, segLen, j);
+                vec128i vTAll = _mm_load_si128(pvT + i+1);
                 vec128i cond = _mm_cmpgt_epi64(vEF_opn, vF_ext);
                 vec128i vT = _mm_blendv_epi8(vTDelF, vTDiagF, cond);
                 vT = _mm_or_si128(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i+1, segLen, j);
+                _mm_store_si128(pvT + i+1, vT);
             }
 
             /* Load the next vH. */
@@ -251,22 +292,22 @@ parasail_result_t* PNAME(
                     case1 = _mm_cmpeq_epi64(vH, vHp);
                     case2 = _mm_cmpeq_epi64(vH, vF);
                     cond = _mm_andnot_si128(case1,case2);
-                    vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    vTAll = _mm_load_si128(pvT + i);
                     vT = _mm_load_si128(pvHT + i);
                     vT = _mm_blendv_epi8(vT, vTDel, cond);
                     _mm_store_si128(pvHT + i, vT);
                     vTAll = _mm_and_si128(vTAll, vTMask);
                     vTAll = _mm_or_si128(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    _mm_store_si128(pvT + i, vTAll);
                 }
                 /* Update vF value. */
                 {
-                    vec128i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    vec128i vTAll = _mm_load_si128(pvT + i);
                     vec128i cond = _mm_cmpgt_epi64(vEF_opn, vFa_ext);
                     vec128i vT = _mm_blendv_epi8(vTDelF, vTDiagF, cond);
                     vTAll = _mm_and_si128(vTAll, vFTMask);
                     vTAll = _mm_or_si128(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    _mm_store_si128(pvT + i, vTAll);
                 }
                 vEF_opn = _mm_sub_epi64(vH, vGapO);
                 vF_ext = _mm_sub_epi64(vF, vGapE);
@@ -278,7 +319,7 @@ parasail_result_t* PNAME(
                     if (j+1<s2Len) {
                         vec128i cond = _mm_cmpgt_epi64(vEF_opn, vEa_ext);
                         vec128i vT = _mm_blendv_epi8(vTInsE, vTDiagE, cond);
-                        arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                        _mm_store_si128(pvTNext + i, vT);
                     }
                 }
                 if (! _mm_movemask_epi8(
@@ -295,6 +336,13 @@ parasail_result_t* PNAME(
         }
 end:
         {
+            if (packed) {
+                arr_pack(result->trace->trace_table, pvT, segLen, j);
+            }
+            else {
+                arr_copy(result->trace->trace_table, pvT, segLen, j);
+            }
+            SWAP(pvT, pvTNext)
         }
     }
 
@@ -315,7 +363,11 @@ end:
     result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_64 | PARASAIL_FLAG_LANES_2;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
 
+    parasail_free(pvTNext);
+    parasail_free(pvT);
     parasail_free(boundary);
     parasail_free(pvHT);
     parasail_free(pvEaLoad);
@@ -0,0 +1,394 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define SWAP(A,B) { __m512i* tmp = A; A = B; B = tmp; }
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+
+#define _mm512_cmpeq_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmpeq_epi32_mask(a,b), _mm512_set1_epi32(-1))
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_cmpgt_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmpgt_epi32_mask(a,b), _mm512_set1_epi32(-1))
+
+#define _mm512_insert_epi32_rpl(a,i,imm) _mm512_mask_set1_epi32(a, (__mmask16)1<<(imm), i)
+
+#define _mm512_extract_epi32_rpl(a,imm) _mm_extract_epi32(_mm512_extracti32x4_epi32(a, (imm)>>2), (imm)&3)
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 32/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
+        __m512i *array,
+        const __m512i *pvT,
+        int32_t seglen,
+        int32_t d)
+{
+    const int32_t cells = 32 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const __m512i vZero = _mm512_setzero_si512();
+    const __m512i vInsDiag = _mm512_set1_epi32(PARASAIL_INS | PARASAIL_DIAG);
+    const __m512i vDelDiag = _mm512_set1_epi32(PARASAIL_DEL | PARASAIL_DIAG);
+    const __m512i vInsE = _mm512_set1_epi32(PARASAIL_INS_E);
+    const __m512i vDelF = _mm512_set1_epi32(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        __m512i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            __m512i vT = _mm512_load_si512(pvT + q*cells + p);
+            __m512i vBit0 = _mm512_set1_epi32((int32_t)(1ULL << (4*p)));
+            __m512i vBit1 = _mm512_set1_epi32((int32_t)(1ULL << (4*p+1)));
+            __m512i vBit2 = _mm512_set1_epi32((int32_t)(1ULL << (4*p+2)));
+            __m512i vBit3 = _mm512_set1_epi32((int32_t)(1ULL << (4*p+3)));
+            vP = _mm512_or_si512(vP, _mm512_andnot_si512(
+                        _mm512_cmpeq_epi32_rpl(_mm512_and_si512(vT, vInsDiag), vZero), vBit0));
+            vP = _mm512_or_si512(vP, _mm512_andnot_si512(
+                        _mm512_cmpeq_epi32_rpl(_mm512_and_si512(vT, vDelDiag), vZero), vBit1));
+            vP = _mm512_or_si512(vP, _mm512_andnot_si512(
+                        _mm512_cmpeq_epi32_rpl(_mm512_and_si512(vT, vInsE), vZero), vBit2));
+            vP = _mm512_or_si512(vP, _mm512_andnot_si512(
+                        _mm512_cmpeq_epi32_rpl(_mm512_and_si512(vT, vDelF), vZero), vBit3));
+        }
+        _mm512_store_si512(array + (1LL*d*seglenp+q), vP);
+    }
+}
+
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
+        __m512i *array,
+        const __m512i *pvT,
+        int32_t seglen,
+        int32_t d)
+{
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        _mm512_store_si512(array + (1LL*d*seglen+t), _mm512_load_si512(pvT + t));
+    }
+}
+
+#define FNAME parasail_nw_trace_striped_avx512_512_32
+#define PNAME parasail_nw_trace_striped_profile_avx512_512_32
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx512_512_32(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m512i* const restrict vProfile = (__m512i*)profile->profile32.score;
+    __m512i* restrict pvHStore = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHLoad =  parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvE = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvEaStore = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvEaLoad = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHT = parasail_memalign___m512i(64, segLen);
+    int32_t* const restrict boundary = parasail_memalign_int32_t(64, s2Len+1);
+    __m512i* restrict pvT = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvTNext = parasail_memalign___m512i(64, segLen);
+    __m512i vGapO = _mm512_set1_epi32(open);
+    __m512i vGapE = _mm512_set1_epi32(gap);
+    __m512i vNegInf = _mm512_set1_epi32(NEG_INF);
+    int32_t score = NEG_INF;
+    
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 32/4 - 1) / (32/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 64, sizeof(__m512i));
+    __m512i vTIns  = _mm512_set1_epi32(PARASAIL_INS);
+    __m512i vTDel  = _mm512_set1_epi32(PARASAIL_DEL);
+    __m512i vTDiag = _mm512_set1_epi32(PARASAIL_DIAG);
+    __m512i vTDiagE = _mm512_set1_epi32(PARASAIL_DIAG_E);
+    __m512i vTInsE = _mm512_set1_epi32(PARASAIL_INS_E);
+    __m512i vTDiagF = _mm512_set1_epi32(PARASAIL_DIAG_F);
+    __m512i vTDelF = _mm512_set1_epi32(PARASAIL_DEL_F);
+    __m512i vTMask = _mm512_set1_epi32(PARASAIL_ZERO_MASK);
+    __m512i vFTMask = _mm512_set1_epi32(PARASAIL_F_MASK);
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m512i_32_t h;
+            __m512i_32_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT32_MIN ? INT32_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT32_MIN ? INT32_MIN : tmp;
+            }
+            _mm512_store_si512(&pvHStore[index], h.m);
+            _mm512_store_si512(&pvE[index], e.m);
+            _mm512_store_si512(&pvEaStore[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT32_MIN ? INT32_MIN : tmp;
+        }
+    }
+
+    for (i=0; i<segLen; ++i) {
+        _mm512_store_si512(pvT + i, vTDiagE);
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vEF_opn;
+        __m512i vE;
+        __m512i vE_ext;
+        __m512i vF;
+        __m512i vF_ext;
+        __m512i vFa;
+        __m512i vFa_ext;
+        __m512i vH;
+        __m512i vH_dag;
+        const __m512i* vP = NULL;
+
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 4 bytes */
+        vH = _mm512_load_si512(&pvHStore[segLen - 1]);
+        vH = _mm512_slli_si512_rpl(vH, 4);
+
+        /* insert upper boundary condition */
+        vH = _mm512_insert_epi32_rpl(vH, boundary[j], 0);
+
+        /* Correct part of the vProfile */
+        vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+
+        /* Swap the 2 H buffers. */
+        SWAP(pvHLoad, pvHStore)
+        SWAP(pvEaLoad, pvEaStore)
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vE = _mm512_load_si512(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH_dag = _mm512_add_epi32(vH, _mm512_load_si512(vP + i));
+            vH = _mm512_max_epi32(vH_dag, vE);
+            vH = _mm512_max_epi32(vH, vF);
+            /* Save vH values. */
+            _mm512_store_si512(pvHStore + i, vH);
+            
+
+            {
+                __m512i vTAll = _mm512_load_si512(pvT + i);
+                __m512i case1 = _mm512_cmpeq_epi32_rpl(vH, vH_dag);
+                __m512i case2 = _mm512_cmpeq_epi32_rpl(vH, vF);
+                __m512i vT = _mm512_blendv_epi8_rpl(
+                        _mm512_blendv_epi8_rpl(vTIns, vTDel, case2),
+                        vTDiag, case1);
+                _mm512_store_si512(pvHT + i, vT);
+                vT = _mm512_or_si512(vT, vTAll);
+                _mm512_store_si512(pvT + i, vT);
+            }
+
+            vEF_opn = _mm512_sub_epi32(vH, vGapO);
+
+            /* Update vE value. */
+            vE_ext = _mm512_sub_epi32(vE, vGapE);
+            vE = _mm512_max_epi32(vEF_opn, vE_ext);
+            _mm512_store_si512(pvE + i, vE);
+            {
+                __m512i vEa = _mm512_load_si512(pvEaLoad + i);
+                __m512i vEa_ext = _mm512_sub_epi32(vEa, vGapE);
+                vEa = _mm512_max_epi32(vEF_opn, vEa_ext);
+                _mm512_store_si512(pvEaStore + i, vEa);
+                if (j+1<s2Len) {
+                    __m512i cond = _mm512_cmpgt_epi32_rpl(vEF_opn, vEa_ext);
+                    __m512i vT = _mm512_blendv_epi8_rpl(vTInsE, vTDiagE, cond);
+                    _mm512_store_si512(pvTNext + i, vT);
+                }
+            }
+
+            /* Update vF value. */
+            vF_ext = _mm512_sub_epi32(vF, vGapE);
+            vF = _mm512_max_epi32(vEF_opn, vF_ext);
+            if (i+1<segLen) {
+                __m512i vTAll = _mm512_load_si512(pvT + i+1);
+                __m512i cond = _mm512_cmpgt_epi32_rpl(vEF_opn, vF_ext);
+                __m512i vT = _mm512_blendv_epi8_rpl(vTDelF, vTDiagF, cond);
+                vT = _mm512_or_si512(vT, vTAll);
+                _mm512_store_si512(pvT + i+1, vT);
+            }
+
+            /* Load the next vH. */
+            vH = _mm512_load_si512(pvHLoad + i);
+        }
+
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        vFa_ext = vF_ext;
+        vFa = vF;
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            int32_t tmp2 = tmp < INT32_MIN ? INT32_MIN : tmp;
+            __m512i vHp = _mm512_load_si512(&pvHLoad[segLen - 1]);
+            vHp = _mm512_slli_si512_rpl(vHp, 4);
+            vHp = _mm512_insert_epi32_rpl(vHp, boundary[j], 0);
+            vEF_opn = _mm512_slli_si512_rpl(vEF_opn, 4);
+            vEF_opn = _mm512_insert_epi32_rpl(vEF_opn, tmp2, 0);
+            vF_ext = _mm512_slli_si512_rpl(vF_ext, 4);
+            vF_ext = _mm512_insert_epi32_rpl(vF_ext, NEG_INF, 0);
+            vF = _mm512_slli_si512_rpl(vF, 4);
+            vF = _mm512_insert_epi32_rpl(vF, tmp2, 0);
+            vFa_ext = _mm512_slli_si512_rpl(vFa_ext, 4);
+            vFa_ext = _mm512_insert_epi32_rpl(vFa_ext, NEG_INF, 0);
+            vFa = _mm512_slli_si512_rpl(vFa, 4);
+            vFa = _mm512_insert_epi32_rpl(vFa, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm512_load_si512(pvHStore + i);
+                vH = _mm512_max_epi32(vH,vF);
+                _mm512_store_si512(pvHStore + i, vH);
+                
+                {
+                    __m512i vTAll;
+                    __m512i vT;
+                    __m512i case1;
+                    __m512i case2;
+                    __m512i cond;
+                    vHp = _mm512_add_epi32(vHp, _mm512_load_si512(vP + i));
+                    case1 = _mm512_cmpeq_epi32_rpl(vH, vHp);
+                    case2 = _mm512_cmpeq_epi32_rpl(vH, vF);
+                    cond = _mm512_andnot_si512(case1,case2);
+                    vTAll = _mm512_load_si512(pvT + i);
+                    vT = _mm512_load_si512(pvHT + i);
+                    vT = _mm512_blendv_epi8_rpl(vT, vTDel, cond);
+                    _mm512_store_si512(pvHT + i, vT);
+                    vTAll = _mm512_and_si512(vTAll, vTMask);
+                    vTAll = _mm512_or_si512(vTAll, vT);
+                    _mm512_store_si512(pvT + i, vTAll);
+                }
+                /* Update vF value. */
+                {
+                    __m512i vTAll = _mm512_load_si512(pvT + i);
+                    __m512i cond = _mm512_cmpgt_epi32_rpl(vEF_opn, vFa_ext);
+                    __m512i vT = _mm512_blendv_epi8_rpl(vTDelF, vTDiagF, cond);
+                    vTAll = _mm512_and_si512(vTAll, vFTMask);
+                    vTAll = _mm512_or_si512(vTAll, vT);
+                    _mm512_store_si512(pvT + i, vTAll);
+                }
+                vEF_opn = _mm512_sub_epi32(vH, vGapO);
+                vF_ext = _mm512_sub_epi32(vF, vGapE);
+                {
+                    __m512i vEa = _mm512_load_si512(pvEaLoad + i);
+                    __m512i vEa_ext = _mm512_sub_epi32(vEa, vGapE);
+                    vEa = _mm512_max_epi32(vEF_opn, vEa_ext);
+                    _mm512_store_si512(pvEaStore + i, vEa);
+                    if (j+1<s2Len) {
+                        __m512i cond = _mm512_cmpgt_epi32_rpl(vEF_opn, vEa_ext);
+                        __m512i vT = _mm512_blendv_epi8_rpl(vTInsE, vTDiagE, cond);
+                        _mm512_store_si512(pvTNext + i, vT);
+                    }
+                }
+                if (! _mm512_movepi8_mask(
+                            _mm512_or_si512(
+                                _mm512_cmpgt_epi32_rpl(vF_ext, vEF_opn),
+                                _mm512_cmpeq_epi32_rpl(vF_ext, vEF_opn))))
+                    goto end;
+                /*vF = _mm512_max_epi32(vEF_opn, vF_ext);*/
+                vF = vF_ext;
+                vFa_ext = _mm512_sub_epi32(vFa, vGapE);
+                vFa = _mm512_max_epi32(vEF_opn, vFa_ext);
+                vHp = _mm512_load_si512(pvHLoad + i);
+            }
+        }
+end:
+        {
+            if (packed) {
+                arr_pack(result->trace->trace_table, pvT, segLen, j);
+            }
+            else {
+                arr_copy(result->trace->trace_table, pvT, segLen, j);
+            }
+            SWAP(pvT, pvTNext)
+        }
+    }
+
+    /* extract last value from the last column */
+    {
+        __m512i vH = _mm512_load_si512(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm512_slli_si512_rpl (vH, 4);
+        }
+        score = (int32_t) _mm512_extract_epi32_rpl (vH, 15);
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_TRACE
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_16;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
+
+    parasail_free(pvTNext);
+    parasail_free(pvT);
+    parasail_free(boundary);
+    parasail_free(pvHT);
+    parasail_free(pvEaLoad);
+    parasail_free(pvEaStore);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+
+    return result;
+}
+
+
@@ -21,23 +21,59 @@
 #define NEG_INF (INT32_MIN/(int32_t)(2))
 
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 32/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         simde__m128i *array,
-        simde__m128i vH,
-        int32_t t,
+        const simde__m128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    simde_mm_store_si128(array + (1LL*d*seglen+t), vH);
+    const int32_t cells = 32 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const simde__m128i vZero = simde_mm_setzero_si128();
+    const simde__m128i vInsDiag = simde_mm_set1_epi32(PARASAIL_INS | PARASAIL_DIAG);
+    const simde__m128i vDelDiag = simde_mm_set1_epi32(PARASAIL_DEL | PARASAIL_DIAG);
+    const simde__m128i vInsE = simde_mm_set1_epi32(PARASAIL_INS_E);
+    const simde__m128i vDelF = simde_mm_set1_epi32(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        simde__m128i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            simde__m128i vT = simde_mm_load_si128(pvT + q*cells + p);
+            simde__m128i vBit0 = simde_mm_set1_epi32((int32_t)(1ULL << (4*p)));
+            simde__m128i vBit1 = simde_mm_set1_epi32((int32_t)(1ULL << (4*p+1)));
+            simde__m128i vBit2 = simde_mm_set1_epi32((int32_t)(1ULL << (4*p+2)));
+            simde__m128i vBit3 = simde_mm_set1_epi32((int32_t)(1ULL << (4*p+3)));
+            vP = simde_mm_or_si128(vP, simde_mm_andnot_si128(
+                        simde_mm_cmpeq_epi32(simde_mm_and_si128(vT, vInsDiag), vZero), vBit0));
+            vP = simde_mm_or_si128(vP, simde_mm_andnot_si128(
+                        simde_mm_cmpeq_epi32(simde_mm_and_si128(vT, vDelDiag), vZero), vBit1));
+            vP = simde_mm_or_si128(vP, simde_mm_andnot_si128(
+                        simde_mm_cmpeq_epi32(simde_mm_and_si128(vT, vInsE), vZero), vBit2));
+            vP = simde_mm_or_si128(vP, simde_mm_andnot_si128(
+                        simde_mm_cmpeq_epi32(simde_mm_and_si128(vT, vDelF), vZero), vBit3));
+        }
+        simde_mm_store_si128(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline simde__m128i arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         simde__m128i *array,
-        int32_t t,
+        const simde__m128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    return simde_mm_load_si128(array + (1LL*d*seglen+t));
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        simde_mm_store_si128(array + (1LL*d*seglen+t), simde_mm_load_si128(pvT + t));
+    }
 }
 
 #define FNAME parasail_nw_trace_striped_neon_128_32
@@ -78,12 +114,17 @@ parasail_result_t* PNAME(
     simde__m128i* restrict pvEaLoad = parasail_memalign_simde__m128i(16, segLen);
     simde__m128i* const restrict pvHT = parasail_memalign_simde__m128i(16, segLen);
     int32_t* const restrict boundary = parasail_memalign_int32_t(16, s2Len+1);
+    simde__m128i* restrict pvT = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* restrict pvTNext = parasail_memalign_simde__m128i(16, segLen);
     simde__m128i vGapO = simde_mm_set1_epi32(open);
     simde__m128i vGapE = simde_mm_set1_epi32(gap);
     simde__m128i vNegInf = simde_mm_set1_epi32(NEG_INF);
     int32_t score = NEG_INF;
     
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(simde__m128i));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 32/4 - 1) / (32/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 16, sizeof(simde__m128i));
     simde__m128i vTIns  = simde_mm_set1_epi32(PARASAIL_INS);
     simde__m128i vTDel  = simde_mm_set1_epi32(PARASAIL_DEL);
     simde__m128i vTDiag = simde_mm_set1_epi32(PARASAIL_DIAG);
@@ -124,7 +165,7 @@ parasail_result_t* PNAME(
     }
 
     for (i=0; i<segLen; ++i) {
-        arr_store(result->trace->trace_table, vTDiagE, i, segLen, 0);
+        simde_mm_store_si128(pvT + i, vTDiagE);
     }
 
     /* outer loop over database sequence */
@@ -171,7 +212,7 @@ parasail_result_t* PNAME(
             
 
             {
-                simde__m128i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                simde__m128i vTAll = simde_mm_load_si128(pvT + i);
                 simde__m128i case1 = simde_mm_cmpeq_epi32(vH, vH_dag);
                 simde__m128i case2 = simde_mm_cmpeq_epi32(vH, vF);
                 simde__m128i vT = simde_mm_blendv_epi8(
@@ -179,7 +220,7 @@ parasail_result_t* PNAME(
                         vTDiag, case1);
                 simde_mm_store_si128(pvHT + i, vT);
                 vT = simde_mm_or_si128(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i, segLen, j);
+                simde_mm_store_si128(pvT + i, vT);
             }
 
             vEF_opn = simde_mm_sub_epi32(vH, vGapO);
@@ -196,7 +237,7 @@ parasail_result_t* PNAME(
                 if (j+1<s2Len) {
                     simde__m128i cond = simde_mm_cmpgt_epi32(vEF_opn, vEa_ext);
                     simde__m128i vT = simde_mm_blendv_epi8(vTInsE, vTDiagE, cond);
-                    arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                    simde_mm_store_si128(pvTNext + i, vT);
                 }
             }
 
@@ -204,11 +245,11 @@ parasail_result_t* PNAME(
             vF_ext = simde_mm_sub_epi32(vF, vGapE);
             vF = simde_mm_max_epi32(vEF_opn, vF_ext);
             if (i+1<segLen) {
-                simde__m128i vTAll = arr_load(result->trace->trace_table, i+1, segLen, j);
+                simde__m128i vTAll = simde_mm_load_si128(pvT + i+1);
                 simde__m128i cond = simde_mm_cmpgt_epi32(vEF_opn, vF_ext);
                 simde__m128i vT = simde_mm_blendv_epi8(vTDelF, vTDiagF, cond);
                 vT = simde_mm_or_si128(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i+1, segLen, j);
+                simde_mm_store_si128(pvT + i+1, vT);
             }
 
             /* Load the next vH. */
@@ -251,22 +292,22 @@ parasail_result_t* PNAME(
                     case1 = simde_mm_cmpeq_epi32(vH, vHp);
                     case2 = simde_mm_cmpeq_epi32(vH, vF);
                     cond = simde_mm_andnot_si128(case1,case2);
-                    vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    vTAll = simde_mm_load_si128(pvT + i);
                     vT = simde_mm_load_si128(pvHT + i);
                     vT = simde_mm_blendv_epi8(vT, vTDel, cond);
                     simde_mm_store_si128(pvHT + i, vT);
                     vTAll = simde_mm_and_si128(vTAll, vTMask);
                     vTAll = simde_mm_or_si128(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    simde_mm_store_si128(pvT + i, vTAll);
                 }
                 /* Update vF value. */
                 {
-                    simde__m128i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    simde__m128i vTAll = simde_mm_load_si128(pvT + i);
                     simde__m128i cond = simde_mm_cmpgt_epi32(vEF_opn, vFa_ext);
                     simde__m128i vT = simde_mm_blendv_epi8(vTDelF, vTDiagF, cond);
                     vTAll = simde_mm_and_si128(vTAll, vFTMask);
                     vTAll = simde_mm_or_si128(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    simde_mm_store_si128(pvT + i, vTAll);
                 }
                 vEF_opn = simde_mm_sub_epi32(vH, vGapO);
                 vF_ext = simde_mm_sub_epi32(vF, vGapE);
@@ -278,7 +319,7 @@ parasail_result_t* PNAME(
                     if (j+1<s2Len) {
                         simde__m128i cond = simde_mm_cmpgt_epi32(vEF_opn, vEa_ext);
                         simde__m128i vT = simde_mm_blendv_epi8(vTInsE, vTDiagE, cond);
-                        arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                        simde_mm_store_si128(pvTNext + i, vT);
                     }
                 }
                 if (! simde_mm_movemask_epi8(
@@ -295,6 +336,13 @@ parasail_result_t* PNAME(
         }
 end:
         {
+            if (packed) {
+                arr_pack(result->trace->trace_table, pvT, segLen, j);
+            }
+            else {
+                arr_copy(result->trace->trace_table, pvT, segLen, j);
+            }
+            SWAP(pvT, pvTNext)
         }
     }
 
@@ -315,7 +363,11 @@ end:
     result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_4;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
 
+    parasail_free(pvTNext);
+    parasail_free(pvT);
     parasail_free(boundary);
     parasail_free(pvHT);
     parasail_free(pvEaLoad);
@@ -51,23 +51,59 @@ static inline int32_t _mm_extract_epi32_rpl(__m128i a, const int imm) {
 }
 
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 32/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         __m128i *array,
-        __m128i vH,
-        int32_t t,
+        const __m128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    _mm_store_si128(array + (1LL*d*seglen+t), vH);
+    const int32_t cells = 32 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const __m128i vZero = _mm_setzero_si128();
+    const __m128i vInsDiag = _mm_set1_epi32(PARASAIL_INS | PARASAIL_DIAG);
+    const __m128i vDelDiag = _mm_set1_epi32(PARASAIL_DEL | PARASAIL_DIAG);
+    const __m128i vInsE = _mm_set1_epi32(PARASAIL_INS_E);
+    const __m128i vDelF = _mm_set1_epi32(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        __m128i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            __m128i vT = _mm_load_si128(pvT + q*cells + p);
+            __m128i vBit0 = _mm_set1_epi32((int32_t)(1ULL << (4*p)));
+            __m128i vBit1 = _mm_set1_epi32((int32_t)(1ULL << (4*p+1)));
+            __m128i vBit2 = _mm_set1_epi32((int32_t)(1ULL << (4*p+2)));
+            __m128i vBit3 = _mm_set1_epi32((int32_t)(1ULL << (4*p+3)));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi32(_mm_and_si128(vT, vInsDiag), vZero), vBit0));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi32(_mm_and_si128(vT, vDelDiag), vZero), vBit1));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi32(_mm_and_si128(vT, vInsE), vZero), vBit2));
+            vP = _mm_or_si128(vP, _mm_andnot_si128(
+                        _mm_cmpeq_epi32(_mm_and_si128(vT, vDelF), vZero), vBit3));
+        }
+        _mm_store_si128(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline __m128i arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         __m128i *array,
-        int32_t t,
+        const __m128i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    return _mm_load_si128(array + (1LL*d*seglen+t));
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        _mm_store_si128(array + (1LL*d*seglen+t), _mm_load_si128(pvT + t));
+    }
 }
 
 #define FNAME parasail_nw_trace_striped_sse2_128_32
@@ -108,12 +144,17 @@ parasail_result_t* PNAME(
     __m128i* restrict pvEaLoad = parasail_memalign___m128i(16, segLen);
     __m128i* const restrict pvHT = parasail_memalign___m128i(16, segLen);
     int32_t* const restrict boundary = parasail_memalign_int32_t(16, s2Len+1);
+    __m128i* restrict pvT = parasail_memalign___m128i(16, segLen);
+    __m128i* restrict pvTNext = parasail_memalign___m128i(16, segLen);
     __m128i vGapO = _mm_set1_epi32(open);
     __m128i vGapE = _mm_set1_epi32(gap);
     __m128i vNegInf = _mm_set1_epi32(NEG_INF);
     int32_t score = NEG_INF;
     
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(__m128i));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 32/4 - 1) / (32/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 16, sizeof(__m128i));
     __m128i vTIns  = _mm_set1_epi32(PARASAIL_INS);
     __m128i vTDel  = _mm_set1_epi32(PARASAIL_DEL);
     __m128i vTDiag = _mm_set1_epi32(PARASAIL_DIAG);
@@ -154,7 +195,7 @@ parasail_result_t* PNAME(
     }
 
     for (i=0; i<segLen; ++i) {
-        arr_store(result->trace->trace_table, vTDiagE, i, segLen, 0);
+        _mm_store_si128(pvT + i, vTDiagE);
     }
 
     /* outer loop over database sequence */
@@ -201,7 +242,7 @@ parasail_result_t* PNAME(
             
 
             {
-                __m128i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                __m128i vTAll = _mm_load_si128(pvT + i);
                 __m128i case1 = _mm_cmpeq_epi32(vH, vH_dag);
                 __m128i case2 = _mm_cmpeq_epi32(vH, vF);
                 __m128i vT = _mm_blendv_epi8_rpl(
@@ -209,7 +250,7 @@ parasail_result_t* PNAME(
                         vTDiag, case1);
                 _mm_store_si128(pvHT + i, vT);
                 vT = _mm_or_si128(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i, segLen, j);
+                _mm_store_si128(pvT + i, vT);
             }
 
             vEF_opn = _mm_sub_epi32(vH, vGapO);
@@ -226,7 +267,7 @@ parasail_result_t* PNAME(
                 if (j+1<s2Len) {
                     __m128i cond = _mm_cmpgt_epi32(vEF_opn, vEa_ext);
                     __m128i vT = _mm_blendv_epi8_rpl(vTInsE, vTDiagE, cond);
-                    arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                    _mm_store_si128(pvTNext + i, vT);
                 }
             }
 
@@ -234,11 +275,11 @@ parasail_result_t* PNAME(
             vF_ext = _mm_sub_epi32(vF, vGapE);
             vF = _mm_max_epi32_rpl(vEF_opn, vF_ext);
             if (i+1<segLen) {
-                __m128i vTAll = arr_load(result->trace->trace_table, i+1, segLen, j);
+                __m128i vTAll = _mm_load_si128(pvT + i+1);
                 __m128i cond = _mm_cmpgt_epi32(vEF_opn, vF_ext);
                 __m128i vT = _mm_blendv_epi8_rpl(vTDelF, vTDiagF, cond);
                 vT = _mm_or_si128(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i+1, segLen, j);
+                _mm_store_si128(pvT + i+1, vT);
             }
 
             /* Load the next vH. */
@@ -281,22 +322,22 @@ parasail_result_t* PNAME(
                     case1 = _mm_cmpeq_epi32(vH, vHp);
                     case2 = _mm_cmpeq_epi32(vH, vF);
                     cond = _mm_andnot_si128(case1,case2);
-                    vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    vTAll = _mm_load_si128(pvT + i);
                     vT = _mm_load_si128(pvHT + i);
                     vT = _mm_blendv_epi8_rpl(vT, vTDel, cond);
                     _mm_store_si128(pvHT + i, vT);
                     vTAll = _mm_and_si128(vTAll, vTMask);
                     vTAll = _mm_or_si128(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    _mm_store_si128(pvT + i, vTAll);
                 }
                 /* Update vF value. */
                 {
-                    __m128i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    __m128i vTAll = _mm_load_si128(pvT + i);
                     __m128i cond = _mm_cmpgt_epi32(vEF_opn, vFa_ext);
                     __m128i vT = _mm_blendv_epi8_rpl(vTDelF, vTDiagF, cond);
                     vTAll = _mm_and_si128(vTAll, vFTMask);
                     vTAll = _mm_or_si128(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    _mm_store_si128(pvT + i, vTAll);
                 }
                 vEF_opn = _mm_sub_epi32(vH, vGapO);
                 vF_ext = _mm_sub_epi32(vF, vGapE);
@@ -308,7 +349,7 @@ parasail_result_t* PNAME(
                     if (j+1<s2Len) {
                         __m128i cond = _mm_cmpgt_epi32(vEF_opn, vEa_ext);
                         __m128i vT = _mm_blendv_epi8_rpl(vTInsE, vTDiagE, cond);
-                        arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                        _mm_store_si128(pvTNext + i, vT);
                     }
                 }
                 if (! _mm_movemask_epi8(
@@ -325,6 +366,13 @@ parasail_result_t* PNAME(
         }
 end:
         {
+            if (packed) {
+                arr_pack(result->trace->trace_table, pvT, segLen, j);
+            }
+            else {
+                arr_copy(result->trace->trace_table, pvT, segLen, j);
+            }
+            SWAP(pvT, pvTNext)
         }
     }
 
@@ -345,7 +393,11 @@ end:
     result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_4;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
 
+    parasail_free(pvTNext);
+    parasail_free(pvT);
     parasail_free(boundary);
     parasail_free(pvHT);
     parasail_free(pvEaLoad);
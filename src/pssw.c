@@ -17,26 +17,17 @@ parasail_profile_t* parasail_ssw_init(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t* matrix, const int8_t score_size)
 {
-    parasail_profile_t *profile8 = NULL;
-    parasail_profile_t *profile16 = NULL;
-
-    if (score_size == 0 || score_size == 2) {
-        profile8 = parasail_profile_create_8(s1, s1Len, matrix);
-    }
-    if (score_size == 1 || score_size == 2) {
-        profile16 = parasail_profile_create_16(s1, s1Len, matrix);
-    }
-
-    if (profile8 && profile16) {
-        profile8->profile16 = profile16->profile16;
-        free(profile16);
-        return profile8;
+    if (score_size == 0) {
+        return parasail_profile_create_8(s1, s1Len, matrix);
     }
-    else if (profile8) {
-        return profile8;
+    else if (score_size == 1) {
+        return parasail_profile_create_16(s1, s1Len, matrix);
     }
-    else if (profile16) {
-        return profile16;
+    else if (score_size == 2) {
+        /* 16 bits only for the pairs that saturate 8 bits */
+        parasail_profile_t *profile = parasail_profile_create_8(s1, s1Len, matrix);
+        parasail_profile_defer(profile, 16, parasail_profile_create_16);
+        return profile;
     }
 
     return NULL;
@@ -75,8 +66,8 @@ parasail_result_ssw_t* parasail_ssw_profile(
     parasail_cigar_t *cigar = NULL;
 
     /* find the end loc first with the faster implementation */
-    has8 = (NULL != profile->profile8.score);
-    has16 = (NULL != profile->profile16.score);
+    has8 = parasail_profile_has(profile, 8);
+    has16 = parasail_profile_has(profile, 16);
 
     /* find the end loc first with the faster implementation */
     if (has8) {
@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -359,12 +360,22 @@ parasail_result_t* FNAME(
         int32_t max_row = NEG_INF;
         int32_t max_col = NEG_INF;
         int32_t last_val = NEG_INF;
-        int32_t *s = (int32_t*)&vMaxHRow;
-        int32_t *t = (int32_t*)&vMaxHCol;
-        int32_t *u = (int32_t*)&vLastVal;
-        int32_t *i = (int32_t*)&vEndI;
-        int32_t *j = (int32_t*)&vEndJ;
+        int32_t aMaxHRow[8];
+        int32_t aMaxHCol[8];
+        int32_t aLastVal[8];
+        int32_t aEndI[8];
+        int32_t aEndJ[8];
+        int32_t *s = aMaxHRow;
+        int32_t *t = aMaxHCol;
+        int32_t *u = aLastVal;
+        int32_t *i = aEndI;
+        int32_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aLastVal, &vLastVal, sizeof(aLastVal));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++s, ++t, ++u, ++i, ++j) {
             if (*t > max_col || (*t == max_col && *i < end_query)) {
                 max_col = *t;
@@ -0,0 +1,530 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define SG_SUFFIX _diag_avx512_512_32
+#include "sg_helper.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+
+#define _mm512_cmpeq_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmpeq_epi32_mask(a,b), _mm512_set1_epi32(-1))
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_cmpgt_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmpgt_epi32_mask(a,b), _mm512_set1_epi32(-1))
+
+#define _mm512_insert_epi32_rpl(a,i,imm) _mm512_mask_set1_epi32(a, (__mmask16)1<<(imm), i)
+
+#define _mm512_extract_epi32_rpl(a,imm) _mm_extract_epi32(_mm512_extracti32x4_epi32(a, (imm)>>2), (imm)&3)
+
+#define _mm512_cmplt_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmplt_epi32_mask(a,b), _mm512_set1_epi32(-1))
+
+#define _mm512_srli_si512_rpl(a,imm) _mm512_alignr_epi8(_mm512_maskz_shuffle_i32x4(0x0FFF, a, a, _MM_SHUFFLE(3,3,2,1)), a, imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (0 <= i+0 && i+0 < s1Len && 0 <= j-0 && j-0 < s2Len) {
+        array[1LL*(i+0)*s2Len + (j-0)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 15);
+    }
+    if (0 <= i+1 && i+1 < s1Len && 0 <= j-1 && j-1 < s2Len) {
+        array[1LL*(i+1)*s2Len + (j-1)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 14);
+    }
+    if (0 <= i+2 && i+2 < s1Len && 0 <= j-2 && j-2 < s2Len) {
+        array[1LL*(i+2)*s2Len + (j-2)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 13);
+    }
+    if (0 <= i+3 && i+3 < s1Len && 0 <= j-3 && j-3 < s2Len) {
+        array[1LL*(i+3)*s2Len + (j-3)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 12);
+    }
+    if (0 <= i+4 && i+4 < s1Len && 0 <= j-4 && j-4 < s2Len) {
+        array[1LL*(i+4)*s2Len + (j-4)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 11);
+    }
+    if (0 <= i+5 && i+5 < s1Len && 0 <= j-5 && j-5 < s2Len) {
+        array[1LL*(i+5)*s2Len + (j-5)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 10);
+    }
+    if (0 <= i+6 && i+6 < s1Len && 0 <= j-6 && j-6 < s2Len) {
+        array[1LL*(i+6)*s2Len + (j-6)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 9);
+    }
+    if (0 <= i+7 && i+7 < s1Len && 0 <= j-7 && j-7 < s2Len) {
+        array[1LL*(i+7)*s2Len + (j-7)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 8);
+    }
+    if (0 <= i+8 && i+8 < s1Len && 0 <= j-8 && j-8 < s2Len) {
+        array[1LL*(i+8)*s2Len + (j-8)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 7);
+    }
+    if (0 <= i+9 && i+9 < s1Len && 0 <= j-9 && j-9 < s2Len) {
+        array[1LL*(i+9)*s2Len + (j-9)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 6);
+    }
+    if (0 <= i+10 && i+10 < s1Len && 0 <= j-10 && j-10 < s2Len) {
+        array[1LL*(i+10)*s2Len + (j-10)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 5);
+    }
+    if (0 <= i+11 && i+11 < s1Len && 0 <= j-11 && j-11 < s2Len) {
+        array[1LL*(i+11)*s2Len + (j-11)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 4);
+    }
+    if (0 <= i+12 && i+12 < s1Len && 0 <= j-12 && j-12 < s2Len) {
+        array[1LL*(i+12)*s2Len + (j-12)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 3);
+    }
+    if (0 <= i+13 && i+13 < s1Len && 0 <= j-13 && j-13 < s2Len) {
+        array[1LL*(i+13)*s2Len + (j-13)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 2);
+    }
+    if (0 <= i+14 && i+14 < s1Len && 0 <= j-14 && j-14 < s2Len) {
+        array[1LL*(i+14)*s2Len + (j-14)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 1);
+    }
+    if (0 <= i+15 && i+15 < s1Len && 0 <= j-15 && j-15 < s2Len) {
+        array[1LL*(i+15)*s2Len + (j-15)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_rowcol(
+        int *row,
+        int *col,
+        __m512i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (i+0 == s1Len-1 && 0 <= j-0 && j-0 < s2Len) {
+        row[j-0] = (int32_t)_mm512_extract_epi32_rpl(vWH, 15);
+    }
+    if (j-0 == s2Len-1 && 0 <= i+0 && i+0 < s1Len) {
+        col[(i+0)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 15);
+    }
+    if (i+1 == s1Len-1 && 0 <= j-1 && j-1 < s2Len) {
+        row[j-1] = (int32_t)_mm512_extract_epi32_rpl(vWH, 14);
+    }
+    if (j-1 == s2Len-1 && 0 <= i+1 && i+1 < s1Len) {
+        col[(i+1)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 14);
+    }
+    if (i+2 == s1Len-1 && 0 <= j-2 && j-2 < s2Len) {
+        row[j-2] = (int32_t)_mm512_extract_epi32_rpl(vWH, 13);
+    }
+    if (j-2 == s2Len-1 && 0 <= i+2 && i+2 < s1Len) {
+        col[(i+2)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 13);
+    }
+    if (i+3 == s1Len-1 && 0 <= j-3 && j-3 < s2Len) {
+        row[j-3] = (int32_t)_mm512_extract_epi32_rpl(vWH, 12);
+    }
+    if (j-3 == s2Len-1 && 0 <= i+3 && i+3 < s1Len) {
+        col[(i+3)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 12);
+    }
+    if (i+4 == s1Len-1 && 0 <= j-4 && j-4 < s2Len) {
+        row[j-4] = (int32_t)_mm512_extract_epi32_rpl(vWH, 11);
+    }
+    if (j-4 == s2Len-1 && 0 <= i+4 && i+4 < s1Len) {
+        col[(i+4)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 11);
+    }
+    if (i+5 == s1Len-1 && 0 <= j-5 && j-5 < s2Len) {
+        row[j-5] = (int32_t)_mm512_extract_epi32_rpl(vWH, 10);
+    }
+    if (j-5 == s2Len-1 && 0 <= i+5 && i+5 < s1Len) {
+        col[(i+5)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 10);
+    }
+    if (i+6 == s1Len-1 && 0 <= j-6 && j-6 < s2Len) {
+        row[j-6] = (int32_t)_mm512_extract_epi32_rpl(vWH, 9);
+    }
+    if (j-6 == s2Len-1 && 0 <= i+6 && i+6 < s1Len) {
+        col[(i+6)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 9);
+    }
+    if (i+7 == s1Len-1 && 0 <= j-7 && j-7 < s2Len) {
+        row[j-7] = (int32_t)_mm512_extract_epi32_rpl(vWH, 8);
+    }
+    if (j-7 == s2Len-1 && 0 <= i+7 && i+7 < s1Len) {
+        col[(i+7)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 8);
+    }
+    if (i+8 == s1Len-1 && 0 <= j-8 && j-8 < s2Len) {
+        row[j-8] = (int32_t)_mm512_extract_epi32_rpl(vWH, 7);
+    }
+    if (j-8 == s2Len-1 && 0 <= i+8 && i+8 < s1Len) {
+        col[(i+8)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 7);
+    }
+    if (i+9 == s1Len-1 && 0 <= j-9 && j-9 < s2Len) {
+        row[j-9] = (int32_t)_mm512_extract_epi32_rpl(vWH, 6);
+    }
+    if (j-9 == s2Len-1 && 0 <= i+9 && i+9 < s1Len) {
+        col[(i+9)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 6);
+    }
+    if (i+10 == s1Len-1 && 0 <= j-10 && j-10 < s2Len) {
+        row[j-10] = (int32_t)_mm512_extract_epi32_rpl(vWH, 5);
+    }
+    if (j-10 == s2Len-1 && 0 <= i+10 && i+10 < s1Len) {
+        col[(i+10)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 5);
+    }
+    if (i+11 == s1Len-1 && 0 <= j-11 && j-11 < s2Len) {
+        row[j-11] = (int32_t)_mm512_extract_epi32_rpl(vWH, 4);
+    }
+    if (j-11 == s2Len-1 && 0 <= i+11 && i+11 < s1Len) {
+        col[(i+11)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 4);
+    }
+    if (i+12 == s1Len-1 && 0 <= j-12 && j-12 < s2Len) {
+        row[j-12] = (int32_t)_mm512_extract_epi32_rpl(vWH, 3);
+    }
+    if (j-12 == s2Len-1 && 0 <= i+12 && i+12 < s1Len) {
+        col[(i+12)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 3);
+    }
+    if (i+13 == s1Len-1 && 0 <= j-13 && j-13 < s2Len) {
+        row[j-13] = (int32_t)_mm512_extract_epi32_rpl(vWH, 2);
+    }
+    if (j-13 == s2Len-1 && 0 <= i+13 && i+13 < s1Len) {
+        col[(i+13)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 2);
+    }
+    if (i+14 == s1Len-1 && 0 <= j-14 && j-14 < s2Len) {
+        row[j-14] = (int32_t)_mm512_extract_epi32_rpl(vWH, 1);
+    }
+    if (j-14 == s2Len-1 && 0 <= i+14 && i+14 < s1Len) {
+        col[(i+14)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 1);
+    }
+    if (i+15 == s1Len-1 && 0 <= j-15 && j-15 < s2Len) {
+        row[j-15] = (int32_t)_mm512_extract_epi32_rpl(vWH, 0);
+    }
+    if (j-15 == s2Len-1 && 0 <= i+15 && i+15 < s1Len) {
+        col[(i+15)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_sg_flags_table_diag_avx512_512_32
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_sg_flags_rowcol_diag_avx512_512_32
+#else
+#define FNAME parasail_sg_flags_diag_avx512_512_32
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end)
+{
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    int32_t * const restrict s1 = parasail_memalign_int32_t(64, s1Len+PAD);
+    int32_t * const restrict s2B= parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _H_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _F_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int32_t * const restrict H_pr = _H_pr+PAD;
+    int32_t * const restrict F_pr = _F_pr+PAD;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    int32_t score = NEG_INF;
+    __m512i vNegInf = _mm512_set1_epi32(NEG_INF);
+    __m512i vOpen = _mm512_set1_epi32(open);
+    __m512i vGap  = _mm512_set1_epi32(gap);
+    __m512i vOne = _mm512_set1_epi32(1);
+    __m512i vN = _mm512_set1_epi32(N);
+    __m512i vGapN = s1_beg ? _mm512_set1_epi32(0) : _mm512_set1_epi32(gap*N);
+    __m512i vNegOne = _mm512_set1_epi32(-1);
+    __m512i vI = _mm512_set_epi32(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+    __m512i vJreset = _mm512_set_epi32(0,-1,-2,-3,-4,-5,-6,-7,-8,-9,-10,-11,-12,-13,-14,-15);
+    __m512i vMaxHRow = vNegInf;
+    __m512i vMaxHCol = vNegInf;
+    __m512i vLastVal = vNegInf;
+    __m512i vEndI = vNegInf;
+    __m512i vEndJ = vNegInf;
+    __m512i vILimit = _mm512_set1_epi32(s1Len);
+    __m512i vILimit1 = _mm512_sub_epi32(vILimit, vOne);
+    __m512i vJLimit = _mm512_set1_epi32(s2Len);
+    __m512i vJLimit1 = _mm512_sub_epi32(vJLimit, vOne);
+    __m512i vIBoundary = s1_beg ? _mm512_set1_epi32(0) : _mm512_set_epi32(
+            -open-0*gap,
+            -open-1*gap,
+            -open-2*gap,
+            -open-3*gap,
+            -open-4*gap,
+            -open-5*gap,
+            -open-6*gap,
+            -open-7*gap,
+            -open-8*gap,
+            -open-9*gap,
+            -open-10*gap,
+            -open-11*gap,
+            -open-12*gap,
+            -open-13*gap,
+            -open-14*gap,
+            -open-15*gap
+            );
+    
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row */
+    if (s2_beg) {
+        for (j=0; j<s2Len; ++j) {
+            H_pr[j] = 0;
+            F_pr[j] = NEG_INF;
+        }
+    }
+    else {
+        for (j=0; j<s2Len; ++j) {
+            H_pr[j] = -open - j*gap;
+            F_pr[j] = NEG_INF;
+        }
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        __m512i vNH = vNegInf;
+        __m512i vWH = vNegInf;
+        __m512i vE = vNegInf;
+        __m512i vF = vNegInf;
+        __m512i vJ = vJreset;
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        const int * const restrict matrow8 = &matrix->matrix[matrix->size*s1[i+8]];
+        const int * const restrict matrow9 = &matrix->matrix[matrix->size*s1[i+9]];
+        const int * const restrict matrow10 = &matrix->matrix[matrix->size*s1[i+10]];
+        const int * const restrict matrow11 = &matrix->matrix[matrix->size*s1[i+11]];
+        const int * const restrict matrow12 = &matrix->matrix[matrix->size*s1[i+12]];
+        const int * const restrict matrow13 = &matrix->matrix[matrix->size*s1[i+13]];
+        const int * const restrict matrow14 = &matrix->matrix[matrix->size*s1[i+14]];
+        const int * const restrict matrow15 = &matrix->matrix[matrix->size*s1[i+15]];
+        __m512i vIltLimit = _mm512_cmplt_epi32_rpl(vI, vILimit);
+        __m512i vIeqLimit1 = _mm512_cmpeq_epi32_rpl(vI, vILimit1);
+        vNH = _mm512_srli_si512_rpl(vNH, 4);
+        vNH = _mm512_insert_epi32_rpl(vNH, H_pr[-1], 15);
+        vWH = _mm512_srli_si512_rpl(vWH, 4);
+        vWH = _mm512_insert_epi32_rpl(vWH, s1_beg ? 0 : (-open - i*gap), 15);
+        H_pr[-1] = -open - (i+N)*gap;
+        /* iterate over database sequence */
+        for (j=0; j<s2Len+PAD; ++j) {
+            __m512i vMat;
+            __m512i vNWH = vNH;
+            vNH = _mm512_srli_si512_rpl(vWH, 4);
+            vNH = _mm512_insert_epi32_rpl(vNH, H_pr[j], 15);
+            vF = _mm512_srli_si512_rpl(vF, 4);
+            vF = _mm512_insert_epi32_rpl(vF, F_pr[j], 15);
+            vF = _mm512_max_epi32(
+                    _mm512_sub_epi32(vNH, vOpen),
+                    _mm512_sub_epi32(vF, vGap));
+            vE = _mm512_max_epi32(
+                    _mm512_sub_epi32(vWH, vOpen),
+                    _mm512_sub_epi32(vE, vGap));
+            vMat = _mm512_set_epi32(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]],
+                    matrow8[s2[j-8]],
+                    matrow9[s2[j-9]],
+                    matrow10[s2[j-10]],
+                    matrow11[s2[j-11]],
+                    matrow12[s2[j-12]],
+                    matrow13[s2[j-13]],
+                    matrow14[s2[j-14]],
+                    matrow15[s2[j-15]]
+                    );
+            vNWH = _mm512_add_epi32(vNWH, vMat);
+            vWH = _mm512_max_epi32(vNWH, vE);
+            vWH = _mm512_max_epi32(vWH, vF);
+            /* as minor diagonal vector passes across the j=-1 boundary,
+             * assign the appropriate boundary conditions */
+            {
+                __m512i cond = _mm512_cmpeq_epi32_rpl(vJ,vNegOne);
+                vWH = _mm512_blendv_epi8_rpl(vWH, vIBoundary, cond);
+                vF = _mm512_blendv_epi8_rpl(vF, vNegInf, cond);
+                vE = _mm512_blendv_epi8_rpl(vE, vNegInf, cond);
+            }
+            
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->tables->score_table, vWH, i, s1Len, j, s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+            arr_store_rowcol(result->rowcols->score_row, result->rowcols->score_col, vWH, i, s1Len, j, s2Len);
+#endif
+            H_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vWH,0);
+            F_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vF,0);
+            /* as minor diagonal vector passes across the i or j limit
+             * boundary, extract the last value of the column or row */
+            {
+                __m512i vJeqLimit1 = _mm512_cmpeq_epi32_rpl(vJ, vJLimit1);
+                __m512i vJgtNegOne = _mm512_cmpgt_epi32_rpl(vJ, vNegOne);
+                __m512i vJltLimit = _mm512_cmplt_epi32_rpl(vJ, vJLimit);
+                __m512i cond_j = _mm512_and_si512(vIltLimit, vJeqLimit1);
+                __m512i cond_i = _mm512_and_si512(vIeqLimit1,
+                        _mm512_and_si512(vJgtNegOne, vJltLimit));
+                __m512i cond_max_row = _mm512_cmpgt_epi32_rpl(vWH, vMaxHRow);
+                __m512i cond_max_col = _mm512_cmpgt_epi32_rpl(vWH, vMaxHCol);
+                __m512i cond_last_val = _mm512_and_si512(vIeqLimit1, vJeqLimit1);
+                __m512i cond_all_row = _mm512_and_si512(cond_max_row, cond_i);
+                __m512i cond_all_col = _mm512_and_si512(cond_max_col, cond_j);
+                vMaxHRow = _mm512_blendv_epi8_rpl(vMaxHRow, vWH, cond_all_row);
+                vMaxHCol = _mm512_blendv_epi8_rpl(vMaxHCol, vWH, cond_all_col);
+                vLastVal = _mm512_blendv_epi8_rpl(vLastVal, vWH, cond_last_val);
+                vEndI = _mm512_blendv_epi8_rpl(vEndI, vI, cond_all_col);
+                vEndJ = _mm512_blendv_epi8_rpl(vEndJ, vJ, cond_all_row);
+            }
+            vJ = _mm512_add_epi32(vJ, vOne);
+        }
+        vI = _mm512_add_epi32(vI, vN);
+        vIBoundary = _mm512_sub_epi32(vIBoundary, vGapN);
+    }
+
+    /* alignment ending position */
+    {
+        int32_t max_row = NEG_INF;
+        int32_t max_col = NEG_INF;
+        int32_t last_val = NEG_INF;
+        int32_t aMaxHRow[16];
+        int32_t aMaxHCol[16];
+        int32_t aLastVal[16];
+        int32_t aEndI[16];
+        int32_t aEndJ[16];
+        int32_t *s = aMaxHRow;
+        int32_t *t = aMaxHCol;
+        int32_t *u = aLastVal;
+        int32_t *i = aEndI;
+        int32_t *j = aEndJ;
+        int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aLastVal, &vLastVal, sizeof(aLastVal));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
+        for (k=0; k<N; ++k, ++s, ++t, ++u, ++i, ++j) {
+            if (*t > max_col || (*t == max_col && *i < end_query)) {
+                max_col = *t;
+                end_query = *i;
+            }
+            if (*s > max_row) {
+                max_row = *s;
+                end_ref = *j;
+            }
+            if (*u > last_val) {
+                last_val = *u;
+            }
+        }
+        if (s1_end && s2_end) {
+            if (max_col > max_row || (max_col == max_row && end_ref == s2Len-1)) {
+                score = max_col;
+                end_ref = s2Len-1;
+            }
+            else {
+                score = max_row;
+                end_query = s1Len-1;
+            }
+        }
+        else if (s1_end) {
+            score = max_col;
+            end_ref = s2Len-1;
+        }
+        else if (s2_end) {
+            score = max_row;
+            end_query = s1Len-1;
+        }
+        else {
+            score = last_val;
+            end_query = s1Len-1;
+            end_ref = s2Len-1;
+        }
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_16;
+    result->flag |= s1_beg ? PARASAIL_FLAG_SG_S1_BEG : 0;
+    result->flag |= s1_end ? PARASAIL_FLAG_SG_S1_END : 0;
+    result->flag |= s2_beg ? PARASAIL_FLAG_SG_S2_BEG : 0;
+    result->flag |= s2_end ? PARASAIL_FLAG_SG_S2_END : 0;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
+SG_IMPL_ALL
+
+
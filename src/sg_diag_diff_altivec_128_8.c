@@ -0,0 +1,268 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Anti-diagonal alignment on score differences (Suzuki and Kasahara
+ * 2018, as in the ksw2 extension kernels).  Rather than the scores H,
+ * E and F, each cell keeps
+ *
+ *     u(i,j) = H(i,j) - H(i-1,j)      a(i,j) = E(i,j+1) - H(i,j)
+ *     v(i,j) = H(i,j) - H(i,j-1)      b(i,j) = F(i+1,j) - H(i,j)
+ *
+ * which obey, with z = H(i,j) - H(i-1,j-1),
+ *
+ *     z      = max(s(i,j), a(i,j-1)+u(i,j-1), b(i-1,j)+v(i-1,j))
+ *     u(i,j) = z - v(i-1,j)
+ *     v(i,j) = z - u(i,j-1)
+ *     a(i,j) = max(-open, a(i,j-1)+u(i,j-1) - z - gap)
+ *     b(i,j) = max(-open, b(i-1,j)+v(i-1,j) - z - gap)
+ *
+ * u and v lie in [-open, max+open] and a and b in [-open, -gap] no
+ * matter how long the sequences are, so shifted up by open they fit in
+ * unsigned bytes whenever max + 4*open < 256, and z is kept shifted by
+ * 2*open.  u and a are stored by row and v and b by reversed column,
+ * so the cells of one anti-diagonal read and write contiguous bytes.
+ * The scores of the last row and column are recovered at the end as
+ * running sums of v and u.  Within those penalties the kernel never
+ * saturates; other penalties report saturation.
+ *
+ * The substitution scores of an anti-diagonal pair each query residue
+ * with a different database residue.  For matrices of at most 16
+ * residues they are looked up with one byte shuffle per database
+ * residue present, blended by lane; larger matrices read them from a
+ * byte profile of the query, one cell at a time.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_altivec.h"
+
+
+
+parasail_result_t* parasail_sg_diag_diff_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t r = 0;
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t n = matrix->size;
+    const int lookup = n <= 16;
+    uint8_t * restrict pU = NULL;
+    uint8_t * restrict pA = NULL;
+    uint8_t * restrict pV = NULL;
+    uint8_t * restrict pB = NULL;
+    uint8_t * restrict pQ1 = NULL;
+    uint8_t * restrict pQ2 = NULL;
+    uint8_t * restrict pP = NULL;
+    uint8_t * restrict pS = NULL;
+    uint8_t lane[16];
+    vec128i vRow[16];
+    vec128i vRes[16];
+    vec128i vLane;
+    int32_t used = 0;
+    int score = INT32_MIN;
+    int end_query = s1Len-1;
+    int end_ref = s2Len-1;
+    parasail_result_t *result = parasail_result_new();
+
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_BEG | PARASAIL_FLAG_SG_S1_END
+        | PARASAIL_FLAG_SG_S2_BEG | PARASAIL_FLAG_SG_S2_END
+        | PARASAIL_FLAG_DIAG | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_16;
+
+    /* the shifted differences and their sums have to fit in a byte */
+    if (s1Len <= 0 || s2Len <= 0
+            || gap < 0 || open < gap || open > 63
+            || matrix->max + 4*open > UINT8_MAX) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        result->score = INT8_MAX;
+        return result;
+    }
+
+    /* row arrays are indexed by i, column arrays by s2Len-1-j, each
+     * padded so that a vector starting at the last cell stays inside */
+    pU = (uint8_t*)parasail_memalign(16, s1Len+N);
+    pA = (uint8_t*)parasail_memalign(16, s1Len+N);
+    pV = (uint8_t*)parasail_memalign(16, s2Len+N);
+    pB = (uint8_t*)parasail_memalign(16, s2Len+N);
+    /* the sequences as matrix indices, s2 reversed */
+    pQ1 = (uint8_t*)parasail_memalign(16, s1Len+N);
+    pQ2 = (uint8_t*)parasail_memalign(16, s2Len+N);
+
+    for (k=0; k<N; ++k) {
+        lane[k] = (uint8_t)k;
+    }
+    vLane = _mm_loadu_si128((const vec128i*)lane);
+
+    memset(pQ1, 0, s1Len+N);
+    memset(pQ2, 0, s2Len+N);
+    for (i=0; i<s1Len; ++i) {
+        pQ1[i] = (uint8_t)matrix->mapper[(unsigned char)s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        pQ2[s2Len-1-j] = (uint8_t)matrix->mapper[(unsigned char)s2[j]];
+    }
+
+    /* substitution scores are shifted by 2*open; z is never below
+     * -2*open, so lower scores are clamped there */
+    if (lookup) {
+        int present[16] = {0};
+        for (j=0; j<s2Len; ++j) {
+            present[pQ2[j]] = 1;
+        }
+        for (k=0; k<n; ++k) {
+            uint8_t t[16];
+            if (!present[k]) continue;
+            /* the shuffle looks up within each 16-byte lane */
+            memset(t, 0, sizeof(t));
+            for (i=0; i<N; ++i) {
+                if (i%16 < n) {
+                    int s = matrix->matrix[n*(i%16) + k] + 2*open;
+                    t[i] = (uint8_t)(s < 0 ? 0 : s);
+                }
+            }
+            vRow[used] = _mm_loadu_si128((const vec128i*)t);
+            vRes[used] = _mm_set1_epi8(k);
+            ++used;
+        }
+    }
+    else {
+        pP = (uint8_t*)parasail_memalign(16, (size_t)n*s1Len);
+        pS = (uint8_t*)parasail_memalign(16, s1Len+N);
+        memset(pS, 0, s1Len+N);
+        for (k=0; k<n; ++k) {
+            for (i=0; i<s1Len; ++i) {
+                int s = matrix->matrix[n*pQ1[i] + k] + 2*open;
+                pP[(size_t)k*s1Len + i] = (uint8_t)(s < 0 ? 0 : s);
+            }
+        }
+    }
+
+    /* the first column and row are free, so u and v start at 0,
+     * shifted by open; no gap extends in from outside the table, so a
+     * and b start at -open */
+    memset(pU, 0, s1Len+N);
+    memset(pA, 0, s1Len+N);
+    memset(pV, 0, s2Len+N);
+    memset(pB, 0, s2Len+N);
+    memset(pU, open, s1Len);
+    memset(pV, open, s2Len);
+
+    {
+        const vec128i vQ = _mm_set1_epi8(open - gap);
+
+        for (r=0; r<s1Len+s2Len-1; ++r) {
+            const int32_t lo = r < s2Len ? 0 : r - (s2Len-1);
+            const int32_t hi = r < s1Len ? r : s1Len - 1;
+            uint8_t * const restrict pVr = pV + (s2Len - 1 - r);
+            uint8_t * const restrict pBr = pB + (s2Len - 1 - r);
+            const uint8_t * const restrict pQ2r = pQ2 + (s2Len - 1 - r);
+
+            if (!lookup) {
+                for (i=lo; i<=hi; ++i) {
+                    pS[i] = pP[(size_t)pQ2r[i]*s1Len + i];
+                }
+            }
+
+            for (i=lo; i<=hi; i+=N) {
+                vec128i vS;
+                vec128i vU = _mm_loadu_si128((const vec128i*)(pU+i));
+                vec128i vA = _mm_loadu_si128((const vec128i*)(pA+i));
+                vec128i vV = _mm_loadu_si128((const vec128i*)(pVr+i));
+                vec128i vB = _mm_loadu_si128((const vec128i*)(pBr+i));
+                vec128i vE;
+                vec128i vF;
+                vec128i vZ;
+                vec128i vUn;
+                vec128i vVn;
+                vec128i vAn;
+                vec128i vBn;
+                if (lookup) {
+                    const vec128i vQ1 = _mm_loadu_si128((const vec128i*)(pQ1+i));
+                    const vec128i vQ2 = _mm_loadu_si128((const vec128i*)(pQ2r+i));
+                    vS = _mm_shuffle_epi8(vRow[0], vQ1);
+                    for (k=1; k<used; ++k) {
+                        vS = _mm_blendv_epi8(vS, _mm_shuffle_epi8(vRow[k], vQ1),
+                                _mm_cmpeq_epi8(vQ2, vRes[k]));
+                    }
+                }
+                else {
+                    vS = _mm_loadu_si128((const vec128i*)(pS+i));
+                }
+                vE = _mm_adds_epu8(vA, vU);
+                vF = _mm_adds_epu8(vB, vV);
+                vZ = _mm_max_epu8(vS, _mm_max_epu8(vE, vF));
+                vUn = _mm_subs_epi8(vZ, vV);
+                vVn = _mm_subs_epi8(vZ, vU);
+                vAn = _mm_subs_epu8(_mm_adds_epu8(vE, vQ), vZ);
+                vBn = _mm_subs_epu8(_mm_adds_epu8(vF, vQ), vZ);
+                /* the lanes past the anti-diagonal hold cells of other
+                 * rows and columns and keep their old values */
+                if (hi - i + 1 < N) {
+                    const vec128i vMask = _mm_cmpgt_epi8(
+                            _mm_set1_epi8(hi - i + 1), vLane);
+                    vUn = _mm_blendv_epi8(vU, vUn, vMask);
+                    vAn = _mm_blendv_epi8(vA, vAn, vMask);
+                    vVn = _mm_blendv_epi8(vV, vVn, vMask);
+                    vBn = _mm_blendv_epi8(vB, vBn, vMask);
+                }
+                _mm_storeu_si128((vec128i*)(pU+i), vUn);
+                _mm_storeu_si128((vec128i*)(pA+i), vAn);
+                _mm_storeu_si128((vec128i*)(pVr+i), vVn);
+                _mm_storeu_si128((vec128i*)(pBr+i), vBn);
+            }
+        }
+    }
+
+    /* pU now holds u of the last column and pV v of the last row */
+    {
+        int H = 0;
+        for (i=0; i<s1Len-1; ++i) {
+            H += pU[i] - open;
+            if (H > score) {
+                score = H;
+                end_query = i;
+                end_ref = s2Len-1;
+            }
+        }
+        H = 0;
+        for (j=0; j<s2Len; ++j) {
+            H += pV[s2Len-1-j] - open;
+            if (H > score || (H == score && j < end_ref)) {
+                score = H;
+                end_query = s1Len-1;
+                end_ref = j;
+            }
+        }
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    if (NULL != pS) parasail_free(pS);
+    if (NULL != pP) parasail_free(pP);
+    parasail_free(pQ2);
+    parasail_free(pQ1);
+    parasail_free(pB);
+    parasail_free(pV);
+    parasail_free(pA);
+    parasail_free(pU);
+
+    return result;
+}
+
@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -347,12 +348,22 @@ parasail_result_t* FNAME(
         int64_t max_row = NEG_INF;
         int64_t max_col = NEG_INF;
         int64_t last_val = NEG_INF;
-        int64_t *s = (int64_t*)&vMaxHRow;
-        int64_t *t = (int64_t*)&vMaxHCol;
-        int64_t *u = (int64_t*)&vLastVal;
-        int64_t *i = (int64_t*)&vEndI;
-        int64_t *j = (int64_t*)&vEndJ;
+        int64_t aMaxHRow[2];
+        int64_t aMaxHCol[2];
+        int64_t aLastVal[2];
+        int64_t aEndI[2];
+        int64_t aEndJ[2];
+        int64_t *s = aMaxHRow;
+        int64_t *t = aMaxHCol;
+        int64_t *u = aLastVal;
+        int64_t *i = aEndI;
+        int64_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aLastVal, &vLastVal, sizeof(aLastVal));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++s, ++t, ++u, ++i, ++j) {
             if (*t > max_col || (*t == max_col && *i < end_query)) {
                 max_col = *t;
@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -467,12 +468,22 @@ parasail_result_t* FNAME(
 
     /* alignment ending position */
     {
-        int8_t *t = (int8_t*)&vMaxH;
-        int16_t *ilo = (int16_t*)&vEndILo;
-        int16_t *jlo = (int16_t*)&vEndJLo;
-        int16_t *ihi = (int16_t*)&vEndIHi;
-        int16_t *jhi = (int16_t*)&vEndJHi;
+        int8_t aMaxH[16];
+        int16_t aEndILo[16/2];
+        int16_t aEndJLo[16/2];
+        int16_t aEndIHi[16/2];
+        int16_t aEndJHi[16/2];
+        int8_t *t = aMaxH;
+        int16_t *ilo = aEndILo;
+        int16_t *jlo = aEndJLo;
+        int16_t *ihi = aEndIHi;
+        int16_t *jhi = aEndJHi;
         int32_t k;
+        memcpy(aMaxH, &vMaxH, sizeof(aMaxH));
+        memcpy(aEndILo, &vEndILo, sizeof(aEndILo));
+        memcpy(aEndJLo, &vEndJLo, sizeof(aEndJLo));
+        memcpy(aEndIHi, &vEndIHi, sizeof(aEndIHi));
+        memcpy(aEndJHi, &vEndJHi, sizeof(aEndJHi));
         for (k=0; k<N/2; ++k, ++t, ++ilo, ++jlo) {
             if (*t > score) {
                 score = *t;
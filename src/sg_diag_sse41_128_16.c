@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -339,12 +340,22 @@ parasail_result_t* FNAME(
         int16_t max_row = NEG_INF;
         int16_t max_col = NEG_INF;
         int16_t last_val = NEG_INF;
-        int16_t *s = (int16_t*)&vMaxHRow;
-        int16_t *t = (int16_t*)&vMaxHCol;
-        int16_t *u = (int16_t*)&vLastVal;
-        int16_t *i = (int16_t*)&vEndI;
-        int16_t *j = (int16_t*)&vEndJ;
+        int16_t aMaxHRow[8];
+        int16_t aMaxHCol[8];
+        int16_t aLastVal[8];
+        int16_t aEndI[8];
+        int16_t aEndJ[8];
+        int16_t *s = aMaxHRow;
+        int16_t *t = aMaxHCol;
+        int16_t *u = aLastVal;
+        int16_t *i = aEndI;
+        int16_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aLastVal, &vLastVal, sizeof(aLastVal));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++s, ++t, ++u, ++i, ++j) {
             if (*t > max_col || (*t == max_col && *i < end_query)) {
                 max_col = *t;
@@ -12,6 +12,7 @@
 
 #include "parasail.h"
 #include "parasail/cpuid.h"
+#include "parasail/memory.h"
 
 /* forward declare the dispatcher functions */
 parasail_function_t parasail_sg_scan_64_dispatcher;
@@ -305,6 +306,12 @@ parasail_result_t* parasail_sg_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_scan_64_pointer = parasail_sg_scan_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_scan_64_pointer = parasail_sg_scan_avx2_256_64;
@@ -347,6 +354,12 @@ parasail_result_t* parasail_sg_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_scan_32_pointer = parasail_sg_scan_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_scan_32_pointer = parasail_sg_scan_avx2_256_32;
@@ -389,6 +402,12 @@ parasail_result_t* parasail_sg_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_scan_16_pointer = parasail_sg_scan_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_scan_16_pointer = parasail_sg_scan_avx2_256_16;
@@ -431,6 +450,12 @@ parasail_result_t* parasail_sg_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_scan_8_pointer = parasail_sg_scan_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_scan_8_pointer = parasail_sg_scan_avx2_256_8;
@@ -473,6 +498,12 @@ parasail_result_t* parasail_sg_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_striped_64_pointer = parasail_sg_striped_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_striped_64_pointer = parasail_sg_striped_avx2_256_64;
@@ -515,15 +546,21 @@ parasail_result_t* parasail_sg_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_striped_32_pointer = parasail_sg_striped_short_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_sg_striped_32_pointer = parasail_sg_striped_avx2_256_32;
+        parasail_sg_striped_32_pointer = parasail_sg_striped_short_avx2_256_32;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_sg_striped_32_pointer = parasail_sg_striped_sse41_128_32;
+        parasail_sg_striped_32_pointer = parasail_sg_striped_short_sse41_128_32;
     }
     else
 #endif
@@ -557,15 +594,21 @@ parasail_result_t* parasail_sg_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_striped_16_pointer = parasail_sg_striped_short_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_sg_striped_16_pointer = parasail_sg_striped_avx2_256_16;
+        parasail_sg_striped_16_pointer = parasail_sg_striped_short_avx2_256_16;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_sg_striped_16_pointer = parasail_sg_striped_sse41_128_16;
+        parasail_sg_striped_16_pointer = parasail_sg_striped_short_sse41_128_16;
     }
     else
 #endif
@@ -599,15 +642,21 @@ parasail_result_t* parasail_sg_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_striped_8_pointer = parasail_sg_striped_short_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_sg_striped_8_pointer = parasail_sg_striped_avx2_256_8;
+        parasail_sg_striped_8_pointer = parasail_sg_striped_short_avx2_256_8;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_sg_striped_8_pointer = parasail_sg_striped_sse41_128_8;
+        parasail_sg_striped_8_pointer = parasail_sg_striped_short_sse41_128_8;
     }
     else
 #endif
@@ -641,6 +690,12 @@ parasail_result_t* parasail_sg_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_diag_64_pointer = parasail_sg_diag_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_diag_64_pointer = parasail_sg_diag_avx2_256_64;
@@ -683,6 +738,12 @@ parasail_result_t* parasail_sg_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_diag_32_pointer = parasail_sg_diag_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_diag_32_pointer = parasail_sg_diag_avx2_256_32;
@@ -725,6 +786,12 @@ parasail_result_t* parasail_sg_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_diag_16_pointer = parasail_sg_diag_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_diag_16_pointer = parasail_sg_diag_avx2_256_16;
@@ -767,6 +834,12 @@ parasail_result_t* parasail_sg_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_diag_8_pointer = parasail_sg_diag_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_diag_8_pointer = parasail_sg_diag_avx2_256_8;
@@ -809,6 +882,12 @@ parasail_result_t* parasail_sg_stats_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_scan_64_pointer = parasail_sg_stats_scan_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_scan_64_pointer = parasail_sg_stats_scan_avx2_256_64;
@@ -851,6 +930,12 @@ parasail_result_t* parasail_sg_stats_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_scan_32_pointer = parasail_sg_stats_scan_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_scan_32_pointer = parasail_sg_stats_scan_avx2_256_32;
@@ -893,6 +978,12 @@ parasail_result_t* parasail_sg_stats_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_scan_16_pointer = parasail_sg_stats_scan_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_scan_16_pointer = parasail_sg_stats_scan_avx2_256_16;
@@ -935,6 +1026,12 @@ parasail_result_t* parasail_sg_stats_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_scan_8_pointer = parasail_sg_stats_scan_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_scan_8_pointer = parasail_sg_stats_scan_avx2_256_8;
@@ -977,6 +1074,12 @@ parasail_result_t* parasail_sg_stats_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_striped_64_pointer = parasail_sg_stats_striped_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_striped_64_pointer = parasail_sg_stats_striped_avx2_256_64;
@@ -1019,6 +1122,12 @@ parasail_result_t* parasail_sg_stats_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_striped_32_pointer = parasail_sg_stats_striped_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_striped_32_pointer = parasail_sg_stats_striped_avx2_256_32;
@@ -1061,6 +1170,12 @@ parasail_result_t* parasail_sg_stats_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_striped_16_pointer = parasail_sg_stats_striped_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_striped_16_pointer = parasail_sg_stats_striped_avx2_256_16;
@@ -1103,6 +1218,12 @@ parasail_result_t* parasail_sg_stats_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_striped_8_pointer = parasail_sg_stats_striped_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_striped_8_pointer = parasail_sg_stats_striped_avx2_256_8;
@@ -1145,6 +1266,12 @@ parasail_result_t* parasail_sg_stats_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_diag_64_pointer = parasail_sg_stats_diag_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_diag_64_pointer = parasail_sg_stats_diag_avx2_256_64;
@@ -1187,6 +1314,12 @@ parasail_result_t* parasail_sg_stats_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_diag_32_pointer = parasail_sg_stats_diag_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_diag_32_pointer = parasail_sg_stats_diag_avx2_256_32;
@@ -1229,6 +1362,12 @@ parasail_result_t* parasail_sg_stats_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_diag_16_pointer = parasail_sg_stats_diag_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_diag_16_pointer = parasail_sg_stats_diag_avx2_256_16;
@@ -1271,6 +1410,12 @@ parasail_result_t* parasail_sg_stats_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_diag_8_pointer = parasail_sg_stats_diag_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_diag_8_pointer = parasail_sg_stats_diag_avx2_256_8;
@@ -1313,6 +1458,12 @@ parasail_result_t* parasail_sg_table_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_scan_64_pointer = parasail_sg_table_scan_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_scan_64_pointer = parasail_sg_table_scan_avx2_256_64;
@@ -1355,6 +1506,12 @@ parasail_result_t* parasail_sg_table_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_scan_32_pointer = parasail_sg_table_scan_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_scan_32_pointer = parasail_sg_table_scan_avx2_256_32;
@@ -1397,6 +1554,12 @@ parasail_result_t* parasail_sg_table_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_scan_16_pointer = parasail_sg_table_scan_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_scan_16_pointer = parasail_sg_table_scan_avx2_256_16;
@@ -1439,6 +1602,12 @@ parasail_result_t* parasail_sg_table_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_scan_8_pointer = parasail_sg_table_scan_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_scan_8_pointer = parasail_sg_table_scan_avx2_256_8;
@@ -1481,6 +1650,12 @@ parasail_result_t* parasail_sg_table_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_striped_64_pointer = parasail_sg_table_striped_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_striped_64_pointer = parasail_sg_table_striped_avx2_256_64;
@@ -1523,6 +1698,12 @@ parasail_result_t* parasail_sg_table_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_striped_32_pointer = parasail_sg_table_striped_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_striped_32_pointer = parasail_sg_table_striped_avx2_256_32;
@@ -1565,6 +1746,12 @@ parasail_result_t* parasail_sg_table_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_striped_16_pointer = parasail_sg_table_striped_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_striped_16_pointer = parasail_sg_table_striped_avx2_256_16;
@@ -1607,6 +1794,12 @@ parasail_result_t* parasail_sg_table_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_striped_8_pointer = parasail_sg_table_striped_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_striped_8_pointer = parasail_sg_table_striped_avx2_256_8;
@@ -1649,6 +1842,12 @@ parasail_result_t* parasail_sg_table_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_diag_64_pointer = parasail_sg_table_diag_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_diag_64_pointer = parasail_sg_table_diag_avx2_256_64;
@@ -1691,6 +1890,12 @@ parasail_result_t* parasail_sg_table_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_diag_32_pointer = parasail_sg_table_diag_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_diag_32_pointer = parasail_sg_table_diag_avx2_256_32;
@@ -1733,6 +1938,12 @@ parasail_result_t* parasail_sg_table_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_diag_16_pointer = parasail_sg_table_diag_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_diag_16_pointer = parasail_sg_table_diag_avx2_256_16;
@@ -1775,6 +1986,12 @@ parasail_result_t* parasail_sg_table_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_diag_8_pointer = parasail_sg_table_diag_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_diag_8_pointer = parasail_sg_table_diag_avx2_256_8;
@@ -1817,6 +2034,12 @@ parasail_result_t* parasail_sg_stats_table_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_scan_64_pointer = parasail_sg_stats_table_scan_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_scan_64_pointer = parasail_sg_stats_table_scan_avx2_256_64;
@@ -1859,6 +2082,12 @@ parasail_result_t* parasail_sg_stats_table_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_scan_32_pointer = parasail_sg_stats_table_scan_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_scan_32_pointer = parasail_sg_stats_table_scan_avx2_256_32;
@@ -1901,6 +2130,12 @@ parasail_result_t* parasail_sg_stats_table_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_scan_16_pointer = parasail_sg_stats_table_scan_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_scan_16_pointer = parasail_sg_stats_table_scan_avx2_256_16;
@@ -1943,6 +2178,12 @@ parasail_result_t* parasail_sg_stats_table_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_scan_8_pointer = parasail_sg_stats_table_scan_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_scan_8_pointer = parasail_sg_stats_table_scan_avx2_256_8;
@@ -1985,6 +2226,12 @@ parasail_result_t* parasail_sg_stats_table_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_striped_64_pointer = parasail_sg_stats_table_striped_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_striped_64_pointer = parasail_sg_stats_table_striped_avx2_256_64;
@@ -2027,6 +2274,12 @@ parasail_result_t* parasail_sg_stats_table_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_striped_32_pointer = parasail_sg_stats_table_striped_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_striped_32_pointer = parasail_sg_stats_table_striped_avx2_256_32;
@@ -2069,6 +2322,12 @@ parasail_result_t* parasail_sg_stats_table_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_striped_16_pointer = parasail_sg_stats_table_striped_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_striped_16_pointer = parasail_sg_stats_table_striped_avx2_256_16;
@@ -2111,6 +2370,12 @@ parasail_result_t* parasail_sg_stats_table_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_striped_8_pointer = parasail_sg_stats_table_striped_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_striped_8_pointer = parasail_sg_stats_table_striped_avx2_256_8;
@@ -2153,6 +2418,12 @@ parasail_result_t* parasail_sg_stats_table_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_diag_64_pointer = parasail_sg_stats_table_diag_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_diag_64_pointer = parasail_sg_stats_table_diag_avx2_256_64;
@@ -2195,6 +2466,12 @@ parasail_result_t* parasail_sg_stats_table_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_diag_32_pointer = parasail_sg_stats_table_diag_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_diag_32_pointer = parasail_sg_stats_table_diag_avx2_256_32;
@@ -2237,6 +2514,12 @@ parasail_result_t* parasail_sg_stats_table_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_diag_16_pointer = parasail_sg_stats_table_diag_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_diag_16_pointer = parasail_sg_stats_table_diag_avx2_256_16;
@@ -2279,6 +2562,12 @@ parasail_result_t* parasail_sg_stats_table_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_diag_8_pointer = parasail_sg_stats_table_diag_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_diag_8_pointer = parasail_sg_stats_table_diag_avx2_256_8;
@@ -2321,6 +2610,12 @@ parasail_result_t* parasail_sg_rowcol_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_scan_64_pointer = parasail_sg_rowcol_scan_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_scan_64_pointer = parasail_sg_rowcol_scan_avx2_256_64;
@@ -2363,6 +2658,12 @@ parasail_result_t* parasail_sg_rowcol_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_scan_32_pointer = parasail_sg_rowcol_scan_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_scan_32_pointer = parasail_sg_rowcol_scan_avx2_256_32;
@@ -2405,6 +2706,12 @@ parasail_result_t* parasail_sg_rowcol_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_scan_16_pointer = parasail_sg_rowcol_scan_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_scan_16_pointer = parasail_sg_rowcol_scan_avx2_256_16;
@@ -2447,6 +2754,12 @@ parasail_result_t* parasail_sg_rowcol_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_scan_8_pointer = parasail_sg_rowcol_scan_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_scan_8_pointer = parasail_sg_rowcol_scan_avx2_256_8;
@@ -2489,6 +2802,12 @@ parasail_result_t* parasail_sg_rowcol_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_striped_64_pointer = parasail_sg_rowcol_striped_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_striped_64_pointer = parasail_sg_rowcol_striped_avx2_256_64;
@@ -2531,6 +2850,12 @@ parasail_result_t* parasail_sg_rowcol_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_striped_32_pointer = parasail_sg_rowcol_striped_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_striped_32_pointer = parasail_sg_rowcol_striped_avx2_256_32;
@@ -2573,6 +2898,12 @@ parasail_result_t* parasail_sg_rowcol_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_striped_16_pointer = parasail_sg_rowcol_striped_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_striped_16_pointer = parasail_sg_rowcol_striped_avx2_256_16;
@@ -2615,6 +2946,12 @@ parasail_result_t* parasail_sg_rowcol_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_striped_8_pointer = parasail_sg_rowcol_striped_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_striped_8_pointer = parasail_sg_rowcol_striped_avx2_256_8;
@@ -2657,6 +2994,12 @@ parasail_result_t* parasail_sg_rowcol_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_diag_64_pointer = parasail_sg_rowcol_diag_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_diag_64_pointer = parasail_sg_rowcol_diag_avx2_256_64;
@@ -2699,6 +3042,12 @@ parasail_result_t* parasail_sg_rowcol_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_diag_32_pointer = parasail_sg_rowcol_diag_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_diag_32_pointer = parasail_sg_rowcol_diag_avx2_256_32;
@@ -2741,6 +3090,12 @@ parasail_result_t* parasail_sg_rowcol_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_diag_16_pointer = parasail_sg_rowcol_diag_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_diag_16_pointer = parasail_sg_rowcol_diag_avx2_256_16;
@@ -2783,6 +3138,12 @@ parasail_result_t* parasail_sg_rowcol_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_diag_8_pointer = parasail_sg_rowcol_diag_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_diag_8_pointer = parasail_sg_rowcol_diag_avx2_256_8;
@@ -2825,6 +3186,12 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_scan_64_pointer = parasail_sg_stats_rowcol_scan_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_scan_64_pointer = parasail_sg_stats_rowcol_scan_avx2_256_64;
@@ -2867,6 +3234,12 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_scan_32_pointer = parasail_sg_stats_rowcol_scan_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_scan_32_pointer = parasail_sg_stats_rowcol_scan_avx2_256_32;
@@ -2909,6 +3282,12 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_scan_16_pointer = parasail_sg_stats_rowcol_scan_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_scan_16_pointer = parasail_sg_stats_rowcol_scan_avx2_256_16;
@@ -2951,6 +3330,12 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_scan_8_pointer = parasail_sg_stats_rowcol_scan_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_scan_8_pointer = parasail_sg_stats_rowcol_scan_avx2_256_8;
@@ -2993,6 +3378,12 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_striped_64_pointer = parasail_sg_stats_rowcol_striped_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_striped_64_pointer = parasail_sg_stats_rowcol_striped_avx2_256_64;
@@ -3035,6 +3426,12 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_striped_32_pointer = parasail_sg_stats_rowcol_striped_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_striped_32_pointer = parasail_sg_stats_rowcol_striped_avx2_256_32;
@@ -3077,6 +3474,12 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_striped_16_pointer = parasail_sg_stats_rowcol_striped_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_striped_16_pointer = parasail_sg_stats_rowcol_striped_avx2_256_16;
@@ -3119,6 +3522,12 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_striped_8_pointer = parasail_sg_stats_rowcol_striped_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_striped_8_pointer = parasail_sg_stats_rowcol_striped_avx2_256_8;
@@ -3161,6 +3570,12 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_diag_64_pointer = parasail_sg_stats_rowcol_diag_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_diag_64_pointer = parasail_sg_stats_rowcol_diag_avx2_256_64;
@@ -3203,6 +3618,12 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_diag_32_pointer = parasail_sg_stats_rowcol_diag_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_diag_32_pointer = parasail_sg_stats_rowcol_diag_avx2_256_32;
@@ -3245,6 +3666,12 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_diag_16_pointer = parasail_sg_stats_rowcol_diag_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_diag_16_pointer = parasail_sg_stats_rowcol_diag_avx2_256_16;
@@ -3287,6 +3714,12 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_diag_8_pointer = parasail_sg_stats_rowcol_diag_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_diag_8_pointer = parasail_sg_stats_rowcol_diag_avx2_256_8;
@@ -3329,6 +3762,12 @@ parasail_result_t* parasail_sg_trace_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_scan_64_pointer = parasail_sg_trace_scan_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_scan_64_pointer = parasail_sg_trace_scan_avx2_256_64;
@@ -3371,6 +3810,12 @@ parasail_result_t* parasail_sg_trace_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_scan_32_pointer = parasail_sg_trace_scan_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_scan_32_pointer = parasail_sg_trace_scan_avx2_256_32;
@@ -3413,6 +3858,12 @@ parasail_result_t* parasail_sg_trace_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_scan_16_pointer = parasail_sg_trace_scan_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_scan_16_pointer = parasail_sg_trace_scan_avx2_256_16;
@@ -3455,6 +3906,12 @@ parasail_result_t* parasail_sg_trace_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_scan_8_pointer = parasail_sg_trace_scan_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_scan_8_pointer = parasail_sg_trace_scan_avx2_256_8;
@@ -3497,6 +3954,12 @@ parasail_result_t* parasail_sg_trace_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_striped_64_pointer = parasail_sg_trace_striped_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_striped_64_pointer = parasail_sg_trace_striped_avx2_256_64;
@@ -3539,6 +4002,12 @@ parasail_result_t* parasail_sg_trace_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_striped_32_pointer = parasail_sg_trace_striped_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_striped_32_pointer = parasail_sg_trace_striped_avx2_256_32;
@@ -3581,6 +4050,12 @@ parasail_result_t* parasail_sg_trace_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_striped_16_pointer = parasail_sg_trace_striped_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_striped_16_pointer = parasail_sg_trace_striped_avx2_256_16;
@@ -3623,6 +4098,12 @@ parasail_result_t* parasail_sg_trace_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_striped_8_pointer = parasail_sg_trace_striped_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_striped_8_pointer = parasail_sg_trace_striped_avx2_256_8;
@@ -3665,6 +4146,12 @@ parasail_result_t* parasail_sg_trace_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_diag_64_pointer = parasail_sg_trace_diag_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_diag_64_pointer = parasail_sg_trace_diag_avx2_256_64;
@@ -3707,6 +4194,12 @@ parasail_result_t* parasail_sg_trace_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_diag_32_pointer = parasail_sg_trace_diag_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_diag_32_pointer = parasail_sg_trace_diag_avx2_256_32;
@@ -3749,6 +4242,12 @@ parasail_result_t* parasail_sg_trace_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_diag_16_pointer = parasail_sg_trace_diag_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_diag_16_pointer = parasail_sg_trace_diag_avx2_256_16;
@@ -3791,6 +4290,12 @@ parasail_result_t* parasail_sg_trace_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_diag_8_pointer = parasail_sg_trace_diag_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_diag_8_pointer = parasail_sg_trace_diag_avx2_256_8;
@@ -3832,6 +4337,12 @@ parasail_result_t* parasail_sg_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_scan_profile_64_pointer = parasail_sg_scan_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_scan_profile_64_pointer = parasail_sg_scan_profile_avx2_256_64;
@@ -3873,6 +4384,12 @@ parasail_result_t* parasail_sg_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_scan_profile_32_pointer = parasail_sg_scan_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_scan_profile_32_pointer = parasail_sg_scan_profile_avx2_256_32;
@@ -3914,6 +4431,12 @@ parasail_result_t* parasail_sg_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_scan_profile_16_pointer = parasail_sg_scan_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_scan_profile_16_pointer = parasail_sg_scan_profile_avx2_256_16;
@@ -3955,6 +4478,12 @@ parasail_result_t* parasail_sg_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_scan_profile_8_pointer = parasail_sg_scan_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_scan_profile_8_pointer = parasail_sg_scan_profile_avx2_256_8;
@@ -3996,6 +4525,12 @@ parasail_result_t* parasail_sg_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_striped_profile_64_pointer = parasail_sg_striped_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_striped_profile_64_pointer = parasail_sg_striped_profile_avx2_256_64;
@@ -4037,6 +4572,12 @@ parasail_result_t* parasail_sg_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_striped_profile_32_pointer = parasail_sg_striped_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_striped_profile_32_pointer = parasail_sg_striped_profile_avx2_256_32;
@@ -4078,6 +4619,12 @@ parasail_result_t* parasail_sg_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_striped_profile_16_pointer = parasail_sg_striped_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_striped_profile_16_pointer = parasail_sg_striped_profile_avx2_256_16;
@@ -4119,6 +4666,12 @@ parasail_result_t* parasail_sg_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_striped_profile_8_pointer = parasail_sg_striped_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_striped_profile_8_pointer = parasail_sg_striped_profile_avx2_256_8;
@@ -4160,6 +4713,12 @@ parasail_result_t* parasail_sg_stats_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_scan_profile_64_pointer = parasail_sg_stats_scan_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_scan_profile_64_pointer = parasail_sg_stats_scan_profile_avx2_256_64;
@@ -4201,6 +4760,12 @@ parasail_result_t* parasail_sg_stats_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_scan_profile_32_pointer = parasail_sg_stats_scan_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_scan_profile_32_pointer = parasail_sg_stats_scan_profile_avx2_256_32;
@@ -4242,6 +4807,12 @@ parasail_result_t* parasail_sg_stats_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_scan_profile_16_pointer = parasail_sg_stats_scan_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_scan_profile_16_pointer = parasail_sg_stats_scan_profile_avx2_256_16;
@@ -4283,6 +4854,12 @@ parasail_result_t* parasail_sg_stats_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_scan_profile_8_pointer = parasail_sg_stats_scan_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_scan_profile_8_pointer = parasail_sg_stats_scan_profile_avx2_256_8;
@@ -4324,6 +4901,12 @@ parasail_result_t* parasail_sg_stats_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_striped_profile_64_pointer = parasail_sg_stats_striped_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_striped_profile_64_pointer = parasail_sg_stats_striped_profile_avx2_256_64;
@@ -4365,6 +4948,12 @@ parasail_result_t* parasail_sg_stats_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_striped_profile_32_pointer = parasail_sg_stats_striped_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_striped_profile_32_pointer = parasail_sg_stats_striped_profile_avx2_256_32;
@@ -4406,6 +4995,12 @@ parasail_result_t* parasail_sg_stats_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_striped_profile_16_pointer = parasail_sg_stats_striped_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_striped_profile_16_pointer = parasail_sg_stats_striped_profile_avx2_256_16;
@@ -4447,6 +5042,12 @@ parasail_result_t* parasail_sg_stats_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_striped_profile_8_pointer = parasail_sg_stats_striped_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_striped_profile_8_pointer = parasail_sg_stats_striped_profile_avx2_256_8;
@@ -4488,6 +5089,12 @@ parasail_result_t* parasail_sg_table_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_scan_profile_64_pointer = parasail_sg_table_scan_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_scan_profile_64_pointer = parasail_sg_table_scan_profile_avx2_256_64;
@@ -4529,6 +5136,12 @@ parasail_result_t* parasail_sg_table_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_scan_profile_32_pointer = parasail_sg_table_scan_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_scan_profile_32_pointer = parasail_sg_table_scan_profile_avx2_256_32;
@@ -4570,6 +5183,12 @@ parasail_result_t* parasail_sg_table_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_scan_profile_16_pointer = parasail_sg_table_scan_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_scan_profile_16_pointer = parasail_sg_table_scan_profile_avx2_256_16;
@@ -4611,6 +5230,12 @@ parasail_result_t* parasail_sg_table_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_scan_profile_8_pointer = parasail_sg_table_scan_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_scan_profile_8_pointer = parasail_sg_table_scan_profile_avx2_256_8;
@@ -4652,6 +5277,12 @@ parasail_result_t* parasail_sg_table_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_striped_profile_64_pointer = parasail_sg_table_striped_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_striped_profile_64_pointer = parasail_sg_table_striped_profile_avx2_256_64;
@@ -4693,6 +5324,12 @@ parasail_result_t* parasail_sg_table_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_striped_profile_32_pointer = parasail_sg_table_striped_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_striped_profile_32_pointer = parasail_sg_table_striped_profile_avx2_256_32;
@@ -4734,6 +5371,12 @@ parasail_result_t* parasail_sg_table_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_striped_profile_16_pointer = parasail_sg_table_striped_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_striped_profile_16_pointer = parasail_sg_table_striped_profile_avx2_256_16;
@@ -4775,6 +5418,12 @@ parasail_result_t* parasail_sg_table_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_table_striped_profile_8_pointer = parasail_sg_table_striped_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_table_striped_profile_8_pointer = parasail_sg_table_striped_profile_avx2_256_8;
@@ -4816,6 +5465,12 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_scan_profile_64_pointer = parasail_sg_stats_table_scan_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_scan_profile_64_pointer = parasail_sg_stats_table_scan_profile_avx2_256_64;
@@ -4857,6 +5512,12 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_scan_profile_32_pointer = parasail_sg_stats_table_scan_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_scan_profile_32_pointer = parasail_sg_stats_table_scan_profile_avx2_256_32;
@@ -4898,6 +5559,12 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_scan_profile_16_pointer = parasail_sg_stats_table_scan_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_scan_profile_16_pointer = parasail_sg_stats_table_scan_profile_avx2_256_16;
@@ -4939,6 +5606,12 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_scan_profile_8_pointer = parasail_sg_stats_table_scan_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_scan_profile_8_pointer = parasail_sg_stats_table_scan_profile_avx2_256_8;
@@ -4980,6 +5653,12 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_striped_profile_64_pointer = parasail_sg_stats_table_striped_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_striped_profile_64_pointer = parasail_sg_stats_table_striped_profile_avx2_256_64;
@@ -5021,6 +5700,12 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_striped_profile_32_pointer = parasail_sg_stats_table_striped_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_striped_profile_32_pointer = parasail_sg_stats_table_striped_profile_avx2_256_32;
@@ -5062,6 +5747,12 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_striped_profile_16_pointer = parasail_sg_stats_table_striped_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_striped_profile_16_pointer = parasail_sg_stats_table_striped_profile_avx2_256_16;
@@ -5103,6 +5794,12 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_table_striped_profile_8_pointer = parasail_sg_stats_table_striped_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_table_striped_profile_8_pointer = parasail_sg_stats_table_striped_profile_avx2_256_8;
@@ -5144,6 +5841,12 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_scan_profile_64_pointer = parasail_sg_rowcol_scan_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_scan_profile_64_pointer = parasail_sg_rowcol_scan_profile_avx2_256_64;
@@ -5185,6 +5888,12 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_scan_profile_32_pointer = parasail_sg_rowcol_scan_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_scan_profile_32_pointer = parasail_sg_rowcol_scan_profile_avx2_256_32;
@@ -5226,6 +5935,12 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_scan_profile_16_pointer = parasail_sg_rowcol_scan_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_scan_profile_16_pointer = parasail_sg_rowcol_scan_profile_avx2_256_16;
@@ -5267,6 +5982,12 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_scan_profile_8_pointer = parasail_sg_rowcol_scan_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_scan_profile_8_pointer = parasail_sg_rowcol_scan_profile_avx2_256_8;
@@ -5308,6 +6029,12 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_striped_profile_64_pointer = parasail_sg_rowcol_striped_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_striped_profile_64_pointer = parasail_sg_rowcol_striped_profile_avx2_256_64;
@@ -5349,6 +6076,12 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_striped_profile_32_pointer = parasail_sg_rowcol_striped_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_striped_profile_32_pointer = parasail_sg_rowcol_striped_profile_avx2_256_32;
@@ -5390,6 +6123,12 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_striped_profile_16_pointer = parasail_sg_rowcol_striped_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_striped_profile_16_pointer = parasail_sg_rowcol_striped_profile_avx2_256_16;
@@ -5431,6 +6170,12 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_rowcol_striped_profile_8_pointer = parasail_sg_rowcol_striped_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_rowcol_striped_profile_8_pointer = parasail_sg_rowcol_striped_profile_avx2_256_8;
@@ -5472,6 +6217,12 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_scan_profile_64_pointer = parasail_sg_stats_rowcol_scan_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_scan_profile_64_pointer = parasail_sg_stats_rowcol_scan_profile_avx2_256_64;
@@ -5513,6 +6264,12 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_scan_profile_32_pointer = parasail_sg_stats_rowcol_scan_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_scan_profile_32_pointer = parasail_sg_stats_rowcol_scan_profile_avx2_256_32;
@@ -5554,6 +6311,12 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_scan_profile_16_pointer = parasail_sg_stats_rowcol_scan_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_scan_profile_16_pointer = parasail_sg_stats_rowcol_scan_profile_avx2_256_16;
@@ -5595,6 +6358,12 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_scan_profile_8_pointer = parasail_sg_stats_rowcol_scan_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_scan_profile_8_pointer = parasail_sg_stats_rowcol_scan_profile_avx2_256_8;
@@ -5636,6 +6405,12 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_striped_profile_64_pointer = parasail_sg_stats_rowcol_striped_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_striped_profile_64_pointer = parasail_sg_stats_rowcol_striped_profile_avx2_256_64;
@@ -5677,6 +6452,12 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_striped_profile_32_pointer = parasail_sg_stats_rowcol_striped_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_striped_profile_32_pointer = parasail_sg_stats_rowcol_striped_profile_avx2_256_32;
@@ -5718,6 +6499,12 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_striped_profile_16_pointer = parasail_sg_stats_rowcol_striped_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_striped_profile_16_pointer = parasail_sg_stats_rowcol_striped_profile_avx2_256_16;
@@ -5759,6 +6546,12 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_stats_rowcol_striped_profile_8_pointer = parasail_sg_stats_rowcol_striped_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_stats_rowcol_striped_profile_8_pointer = parasail_sg_stats_rowcol_striped_profile_avx2_256_8;
@@ -5800,6 +6593,12 @@ parasail_result_t* parasail_sg_trace_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_scan_profile_64_pointer = parasail_sg_trace_scan_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_scan_profile_64_pointer = parasail_sg_trace_scan_profile_avx2_256_64;
@@ -5841,6 +6640,12 @@ parasail_result_t* parasail_sg_trace_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_scan_profile_32_pointer = parasail_sg_trace_scan_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_scan_profile_32_pointer = parasail_sg_trace_scan_profile_avx2_256_32;
@@ -5882,6 +6687,12 @@ parasail_result_t* parasail_sg_trace_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_scan_profile_16_pointer = parasail_sg_trace_scan_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_scan_profile_16_pointer = parasail_sg_trace_scan_profile_avx2_256_16;
@@ -5923,6 +6734,12 @@ parasail_result_t* parasail_sg_trace_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_scan_profile_8_pointer = parasail_sg_trace_scan_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_scan_profile_8_pointer = parasail_sg_trace_scan_profile_avx2_256_8;
@@ -5964,6 +6781,12 @@ parasail_result_t* parasail_sg_trace_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_striped_profile_64_pointer = parasail_sg_trace_striped_profile_avx512_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_striped_profile_64_pointer = parasail_sg_trace_striped_profile_avx2_256_64;
@@ -6005,6 +6828,12 @@ parasail_result_t* parasail_sg_trace_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_striped_profile_32_pointer = parasail_sg_trace_striped_profile_avx512_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_striped_profile_32_pointer = parasail_sg_trace_striped_profile_avx2_256_32;
@@ -6046,6 +6875,12 @@ parasail_result_t* parasail_sg_trace_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_striped_profile_16_pointer = parasail_sg_trace_striped_profile_avx512_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_striped_profile_16_pointer = parasail_sg_trace_striped_profile_avx2_256_16;
@@ -6087,6 +6922,12 @@ parasail_result_t* parasail_sg_trace_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_trace_striped_profile_8_pointer = parasail_sg_trace_striped_profile_avx512_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sg_trace_striped_profile_8_pointer = parasail_sg_trace_striped_profile_avx2_256_8;
@@ -6887,6 +7728,7 @@ parasail_result_t* parasail_sg_scan_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6895,6 +7737,7 @@ parasail_result_t* parasail_sg_scan_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6903,6 +7746,7 @@ parasail_result_t* parasail_sg_scan_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6911,6 +7755,7 @@ parasail_result_t* parasail_sg_scan_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6919,6 +7764,7 @@ parasail_result_t* parasail_sg_striped_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6927,6 +7773,7 @@ parasail_result_t* parasail_sg_striped_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6935,6 +7782,7 @@ parasail_result_t* parasail_sg_striped_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6943,6 +7791,7 @@ parasail_result_t* parasail_sg_striped_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6951,6 +7800,7 @@ parasail_result_t* parasail_sg_stats_scan_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_stats_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6959,6 +7809,7 @@ parasail_result_t* parasail_sg_stats_scan_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_stats_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6967,6 +7818,7 @@ parasail_result_t* parasail_sg_stats_scan_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_stats_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6975,6 +7827,7 @@ parasail_result_t* parasail_sg_stats_scan_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_stats_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6983,6 +7836,7 @@ parasail_result_t* parasail_sg_stats_striped_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_stats_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6991,6 +7845,7 @@ parasail_result_t* parasail_sg_stats_striped_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_stats_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -6999,6 +7854,7 @@ parasail_result_t* parasail_sg_stats_striped_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_stats_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7007,6 +7863,7 @@ parasail_result_t* parasail_sg_stats_striped_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_stats_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7015,6 +7872,7 @@ parasail_result_t* parasail_sg_table_scan_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_table_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7023,6 +7881,7 @@ parasail_result_t* parasail_sg_table_scan_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_table_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7031,6 +7890,7 @@ parasail_result_t* parasail_sg_table_scan_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_table_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7039,6 +7899,7 @@ parasail_result_t* parasail_sg_table_scan_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_table_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7047,6 +7908,7 @@ parasail_result_t* parasail_sg_table_striped_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_table_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7055,6 +7917,7 @@ parasail_result_t* parasail_sg_table_striped_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_table_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7063,6 +7926,7 @@ parasail_result_t* parasail_sg_table_striped_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_table_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7071,6 +7935,7 @@ parasail_result_t* parasail_sg_table_striped_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_table_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7079,6 +7944,7 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_stats_table_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7087,6 +7953,7 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_stats_table_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7095,6 +7962,7 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_stats_table_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7103,6 +7971,7 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_stats_table_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7111,6 +7980,7 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_stats_table_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7119,6 +7989,7 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_stats_table_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7127,6 +7998,7 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_stats_table_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7135,6 +8007,7 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_stats_table_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7143,6 +8016,7 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_rowcol_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7151,6 +8025,7 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_rowcol_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7159,6 +8034,7 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_rowcol_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7167,6 +8043,7 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_rowcol_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7175,6 +8052,7 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_rowcol_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7183,6 +8061,7 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_rowcol_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7191,6 +8070,7 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_rowcol_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7199,6 +8079,7 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_rowcol_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7207,6 +8088,7 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_stats_rowcol_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7215,6 +8097,7 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_stats_rowcol_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7223,6 +8106,7 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_stats_rowcol_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7231,6 +8115,7 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_stats_rowcol_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7239,6 +8124,7 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_stats_rowcol_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7247,6 +8133,7 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_stats_rowcol_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7255,6 +8142,7 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_stats_rowcol_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7263,6 +8151,7 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_stats_rowcol_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7271,6 +8160,7 @@ parasail_result_t* parasail_sg_trace_scan_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_trace_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7279,6 +8169,7 @@ parasail_result_t* parasail_sg_trace_scan_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_trace_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7287,6 +8178,7 @@ parasail_result_t* parasail_sg_trace_scan_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_trace_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7295,6 +8187,7 @@ parasail_result_t* parasail_sg_trace_scan_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_trace_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7303,6 +8196,7 @@ parasail_result_t* parasail_sg_trace_striped_profile_64(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 64);
     return parasail_sg_trace_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7311,6 +8205,7 @@ parasail_result_t* parasail_sg_trace_striped_profile_32(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 32);
     return parasail_sg_trace_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7319,6 +8214,7 @@ parasail_result_t* parasail_sg_trace_striped_profile_16(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 16);
     return parasail_sg_trace_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
@@ -7327,6 +8223,77 @@ parasail_result_t* parasail_sg_trace_striped_profile_8(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, 8);
     return parasail_sg_trace_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
+/* 8-bit score difference variant of the diag functions */
+
+/* forward declare the dispatcher function */
+parasail_function_t parasail_sg_diag_diff_8_dispatcher;
+
+/* declare and initialize the pointer to the dispatcher function */
+parasail_function_t * parasail_sg_diag_diff_8_pointer = parasail_sg_diag_diff_8_dispatcher;
+
+/* dispatcher function implementation */
+
+parasail_result_t* parasail_sg_diag_diff_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sg_diag_diff_8_pointer = parasail_sg_diag_diff_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sg_diag_diff_8_pointer = parasail_sg_diag_diff_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sg_diag_diff_8_pointer = parasail_sg_diag_diff_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sg_diag_diff_8_pointer = parasail_sg_diag_diff_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sg_diag_diff_8_pointer = parasail_sg_diag_diff_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sg_diag_diff_8_pointer = parasail_sg_diag_diff_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_sg_diag_diff_8_pointer = parasail_sg;
+    }
+    return parasail_sg_diag_diff_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+/* implementation which simply calls the pointer,
+ * first time it's the dispatcher, otherwise it's correct impl */
+
+parasail_result_t* parasail_sg_diag_diff_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sg_diag_diff_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
@@ -0,0 +1,406 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define SG_SUFFIX _scan_avx512_512_16
+#define SG_SUFFIX_PROF _scan_profile_avx512_512_16
+#include "sg_helper.h"
+
+
+#define _mm512_cmpeq_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(a,b))
+
+#define _mm512_cmpgt_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(a,b))
+
+#define _mm512_cmplt_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmplt_epi16_mask(a,b))
+
+#define _mm512_insert_epi16_rpl(a,i,imm) _mm512_mask_set1_epi16(a, (__mmask32)1<<(imm), i)
+
+#define _mm512_extract_epi16_rpl(a,imm) (int16_t)_mm_extract_epi16(_mm512_extracti32x4_epi32(a, (imm)>>3), (imm)&7)
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    array[1LL*( 0*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  0);
+    array[1LL*( 1*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  1);
+    array[1LL*( 2*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  2);
+    array[1LL*( 3*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  3);
+    array[1LL*( 4*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  4);
+    array[1LL*( 5*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  5);
+    array[1LL*( 6*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  6);
+    array[1LL*( 7*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  7);
+    array[1LL*( 8*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  8);
+    array[1LL*( 9*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH,  9);
+    array[1LL*(10*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 10);
+    array[1LL*(11*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 11);
+    array[1LL*(12*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 12);
+    array[1LL*(13*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 13);
+    array[1LL*(14*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 14);
+    array[1LL*(15*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 15);
+    array[1LL*(16*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 16);
+    array[1LL*(17*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 17);
+    array[1LL*(18*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 18);
+    array[1LL*(19*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 19);
+    array[1LL*(20*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 20);
+    array[1LL*(21*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 21);
+    array[1LL*(22*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 22);
+    array[1LL*(23*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 23);
+    array[1LL*(24*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 24);
+    array[1LL*(25*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 25);
+    array[1LL*(26*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 26);
+    array[1LL*(27*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 27);
+    array[1LL*(28*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 28);
+    array[1LL*(29*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 29);
+    array[1LL*(30*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 30);
+    array[1LL*(31*seglen+t)*dlen + d] = (int16_t)_mm512_extract_epi16_rpl(vH, 31);
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen)
+{
+    col[ 0*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  0);
+    col[ 1*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  1);
+    col[ 2*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  2);
+    col[ 3*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  3);
+    col[ 4*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  4);
+    col[ 5*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  5);
+    col[ 6*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  6);
+    col[ 7*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  7);
+    col[ 8*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  8);
+    col[ 9*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH,  9);
+    col[10*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 10);
+    col[11*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 11);
+    col[12*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 12);
+    col[13*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 13);
+    col[14*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 14);
+    col[15*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 15);
+    col[16*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 16);
+    col[17*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 17);
+    col[18*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 18);
+    col[19*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 19);
+    col[20*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 20);
+    col[21*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 21);
+    col[22*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 22);
+    col[23*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 23);
+    col[24*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 24);
+    col[25*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 25);
+    col[26*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 26);
+    col[27*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 27);
+    col[28*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 28);
+    col[29*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 29);
+    col[30*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 30);
+    col[31*seglen+t] = (int16_t)_mm512_extract_epi16_rpl(vH, 31);
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_sg_flags_table_scan_avx512_512_16
+#define PNAME parasail_sg_flags_table_scan_profile_avx512_512_16
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_sg_flags_rowcol_scan_avx512_512_16
+#define PNAME parasail_sg_flags_rowcol_scan_profile_avx512_512_16
+#else
+#define FNAME parasail_sg_flags_scan_avx512_512_16
+#define PNAME parasail_sg_flags_scan_profile_avx512_512_16
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx512_512_16(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap, s1_beg, s1_end, s2_beg, s2_end);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        int s1_beg, int s1_end, int s2_beg, int s2_end)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int s1Len = profile->s1Len;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 32; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m512i* const restrict pvP = (__m512i*)profile->profile16.score;
+    __m512i* const restrict pvE = parasail_memalign___m512i(64, segLen);
+    int16_t* const restrict boundary = parasail_memalign_int16_t(64, s2Len+1);
+    __m512i* const restrict pvHt= parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvH = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvGapper = parasail_memalign___m512i(64, segLen);
+    __m512i vGapO = _mm512_set1_epi16(open);
+    __m512i vGapE = _mm512_set1_epi16(gap);
+    const int16_t NEG_LIMIT = (-open < matrix->min ?
+        INT16_MIN + open : INT16_MIN - matrix->min) + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    __m512i vZero = _mm512_setzero_si512();
+    int16_t score = NEG_LIMIT;
+    __m512i vNegLimit = _mm512_set1_epi16(NEG_LIMIT);
+    __m512i vPosLimit = _mm512_set1_epi16(POS_LIMIT);
+    __m512i vSaturationCheckMin = vPosLimit;
+    __m512i vSaturationCheckMax = vNegLimit;
+    __m512i vMaxH = vNegLimit;
+    __m512i vPosMask = _mm512_cmpeq_epi16_rpl(_mm512_set1_epi16(position),
+            _mm512_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31));
+    __m512i vNegInfFront = vZero;
+    __m512i vSegLenXgap;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    vNegInfFront = _mm512_insert_epi16_rpl(vNegInfFront, NEG_LIMIT, 0);
+    vSegLenXgap = _mm512_add_epi16(vNegInfFront,
+            _mm512_slli_si512_rpl(_mm512_set1_epi16(-segLen*gap), 2));
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m512i_16_t h;
+            __m512i_16_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = s1_beg ? 0 : (-open-gap*(segNum*segLen+i));
+                h.v[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+            }
+            _mm512_store_si512(&pvH[index], h.m);
+            _mm512_store_si512(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = s2_beg ? 0 : (-open-gap*(i-1));
+            boundary[i] = tmp < INT16_MIN ? INT16_MIN : tmp;
+        }
+    }
+
+    {
+        __m512i vGapper = _mm512_sub_epi16(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm512_store_si512(pvGapper+i, vGapper);
+            vGapper = _mm512_sub_epi16(vGapper, vGapE);
+            /* long queries and/or large penalties will break the pseudo prefix scan */
+            vSaturationCheckMin = _mm512_min_epi16(vSaturationCheckMin, vGapper);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vE;
+        __m512i vHt;
+        __m512i vF;
+        __m512i vH;
+        __m512i vHp;
+        __m512i *pvW;
+        __m512i vW;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm512_load_si512(pvH+(segLen-1));
+        vHp = _mm512_slli_si512_rpl(vHp, 2);
+        vHp = _mm512_insert_epi16_rpl(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm512_sub_epi16(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm512_load_si512(pvH+i);
+            vE = _mm512_load_si512(pvE+i);
+            vW = _mm512_load_si512(pvW+i);
+            vE = _mm512_max_epi16(
+                    _mm512_sub_epi16(vE, vGapE),
+                    _mm512_sub_epi16(vH, vGapO));
+            vHp = _mm512_add_epi16(vHp, vW);
+            vF = _mm512_max_epi16(vF, _mm512_add_epi16(vHt, pvGapper[i]));
+            vHt = _mm512_max_epi16(vE, vHp);
+            _mm512_store_si512(pvE+i, vE);
+            _mm512_store_si512(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm512_slli_si512_rpl(vHt, 2);
+        vHt = _mm512_insert_epi16_rpl(vHt, boundary[j+1], 0);
+        vF = _mm512_max_epi16(vF, _mm512_add_epi16(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            __m512i vFt = _mm512_slli_si512_rpl(vF, 2);
+            vFt = _mm512_add_epi16(vFt, vSegLenXgap);
+            vF = _mm512_max_epi16(vF, vFt);
+        }
+
+        /* calculate final H */
+        vF = _mm512_slli_si512_rpl(vF, 2);
+        vF = _mm512_add_epi16(vF, vNegInfFront);
+        vH = _mm512_max_epi16(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            vHt = _mm512_load_si512(pvHt+i);
+            vF = _mm512_max_epi16(
+                    _mm512_sub_epi16(vF, vGapE),
+                    _mm512_sub_epi16(vH, vGapO));
+            vH = _mm512_max_epi16(vHt, vF);
+            _mm512_store_si512(pvH+i, vH);
+            vSaturationCheckMin = _mm512_min_epi16(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm512_max_epi16(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+        } 
+
+        /* extract vector containing last value from column */
+        {
+            __m512i vCompare;
+            vH = _mm512_load_si512(pvH + offset);
+            vCompare = _mm512_and_si512(vPosMask, _mm512_cmpgt_epi16_rpl(vH, vMaxH));
+            vMaxH = _mm512_max_epi16(vH, vMaxH);
+            if (_mm512_movepi8_mask(vCompare)) {
+                end_ref = j;
+            }
+#ifdef PARASAIL_ROWCOL
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl(vH, 2);
+            }
+            result->rowcols->score_row[j] = (int16_t) _mm512_extract_epi16_rpl (vH, 31);
+#endif
+        }
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m512i vH = _mm512_load_si512(pvH + i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* max last value from all columns */
+    if (s2_end)
+    {
+        for (k=0; k<position; ++k) {
+            vMaxH = _mm512_slli_si512_rpl(vMaxH, 2);
+        }
+        score = (int16_t) _mm512_extract_epi16_rpl(vMaxH, 31);
+        end_query = s1Len-1;
+    }
+
+    /* max of last column */
+    if (s1_end)
+    {
+        /* Trace the alignment ending position on read. */
+        int16_t *t = (int16_t*)pvH;
+        int32_t column_len = segLen * segWidth;
+        for (i = 0; i<column_len; ++i, ++t) {
+            int32_t temp = i / segWidth + i % segWidth * segLen;
+            if (temp >= s1Len) continue;
+            if (*t > score) {
+                score = *t;
+                end_query = temp;
+                end_ref = s2Len-1;
+            }
+            else if (*t == score && end_ref == s2Len-1 && temp < end_query) {
+                end_query = temp;
+            }
+        }
+    }
+
+    if (!s1_end && !s2_end) {
+        /* extract last value from the last column */
+        {
+            __m512i vH = _mm512_load_si512(pvH + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl(vH, 2);
+            }
+            score = (int16_t) _mm512_extract_epi16_rpl (vH, 31);
+            end_ref = s2Len - 1;
+            end_query = s1Len - 1;
+        }
+    }
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(
+            _mm512_cmplt_epi16_rpl(vSaturationCheckMin, vNegLimit),
+            _mm512_cmpgt_epi16_rpl(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_32;
+    result->flag |= s1_beg ? PARASAIL_FLAG_SG_S1_BEG : 0;
+    result->flag |= s1_end ? PARASAIL_FLAG_SG_S1_END : 0;
+    result->flag |= s2_beg ? PARASAIL_FLAG_SG_S2_BEG : 0;
+    result->flag |= s2_end ? PARASAIL_FLAG_SG_S2_END : 0;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvGapper);
+    parasail_free(pvH);
+    parasail_free(pvHt);
+    parasail_free(boundary);
+    parasail_free(pvE);
+
+    return result;
+}
+
+SG_IMPL_ALL
+SG_IMPL_PROF_ALL
+
+
@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -634,21 +635,49 @@ parasail_result_t* FNAME(
         int16_t last_valm = NEG_INF;
         int16_t last_vals = NEG_INF;
         int16_t last_vall = NEG_INF;
-        int16_t *rh = (int16_t*)&vMaxHRow;
-        int16_t *rm = (int16_t*)&vMaxMRow;
-        int16_t *rs = (int16_t*)&vMaxSRow;
-        int16_t *rl = (int16_t*)&vMaxLRow;
-        int16_t *ch = (int16_t*)&vMaxHCol;
-        int16_t *cm = (int16_t*)&vMaxMCol;
-        int16_t *cs = (int16_t*)&vMaxSCol;
-        int16_t *cl = (int16_t*)&vMaxLCol;
-        int16_t *lh = (int16_t*)&vLastValH;
-        int16_t *lm = (int16_t*)&vLastValM;
-        int16_t *ls = (int16_t*)&vLastValS;
-        int16_t *ll = (int16_t*)&vLastValL;
-        int16_t *i = (int16_t*)&vEndI;
-        int16_t *j = (int16_t*)&vEndJ;
+        int16_t aMaxHRow[16];
+        int16_t aMaxMRow[16];
+        int16_t aMaxSRow[16];
+        int16_t aMaxLRow[16];
+        int16_t aMaxHCol[16];
+        int16_t aMaxMCol[16];
+        int16_t aMaxSCol[16];
+        int16_t aMaxLCol[16];
+        int16_t aLastValH[16];
+        int16_t aLastValM[16];
+        int16_t aLastValS[16];
+        int16_t aLastValL[16];
+        int16_t aEndI[16];
+        int16_t aEndJ[16];
+        int16_t *rh = aMaxHRow;
+        int16_t *rm = aMaxMRow;
+        int16_t *rs = aMaxSRow;
+        int16_t *rl = aMaxLRow;
+        int16_t *ch = aMaxHCol;
+        int16_t *cm = aMaxMCol;
+        int16_t *cs = aMaxSCol;
+        int16_t *cl = aMaxLCol;
+        int16_t *lh = aLastValH;
+        int16_t *lm = aLastValM;
+        int16_t *ls = aLastValS;
+        int16_t *ll = aLastValL;
+        int16_t *i = aEndI;
+        int16_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxMRow, &vMaxMRow, sizeof(aMaxMRow));
+        memcpy(aMaxSRow, &vMaxSRow, sizeof(aMaxSRow));
+        memcpy(aMaxLRow, &vMaxLRow, sizeof(aMaxLRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aMaxMCol, &vMaxMCol, sizeof(aMaxMCol));
+        memcpy(aMaxSCol, &vMaxSCol, sizeof(aMaxSCol));
+        memcpy(aMaxLCol, &vMaxLCol, sizeof(aMaxLCol));
+        memcpy(aLastValH, &vLastValH, sizeof(aLastValH));
+        memcpy(aLastValM, &vLastValM, sizeof(aLastValM));
+        memcpy(aLastValS, &vLastValS, sizeof(aLastValS));
+        memcpy(aLastValL, &vLastValL, sizeof(aLastValL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++rh, ++rm, ++rs, ++rl, ++ch, ++cm, ++cs, ++cl, ++lh, ++lm, ++ls, ++ll, ++i, ++j) {
             if (*ch > max_colh || (*ch == max_colh && *i < end_query)) {
                 max_colh = *ch;
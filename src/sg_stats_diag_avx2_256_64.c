@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -528,21 +529,49 @@ parasail_result_t* FNAME(
         int64_t last_valm = NEG_INF;
         int64_t last_vals = NEG_INF;
         int64_t last_vall = NEG_INF;
-        int64_t *rh = (int64_t*)&vMaxHRow;
-        int64_t *rm = (int64_t*)&vMaxMRow;
-        int64_t *rs = (int64_t*)&vMaxSRow;
-        int64_t *rl = (int64_t*)&vMaxLRow;
-        int64_t *ch = (int64_t*)&vMaxHCol;
-        int64_t *cm = (int64_t*)&vMaxMCol;
-        int64_t *cs = (int64_t*)&vMaxSCol;
-        int64_t *cl = (int64_t*)&vMaxLCol;
-        int64_t *lh = (int64_t*)&vLastValH;
-        int64_t *lm = (int64_t*)&vLastValM;
-        int64_t *ls = (int64_t*)&vLastValS;
-        int64_t *ll = (int64_t*)&vLastValL;
-        int64_t *i = (int64_t*)&vEndI;
-        int64_t *j = (int64_t*)&vEndJ;
+        int64_t aMaxHRow[4];
+        int64_t aMaxMRow[4];
+        int64_t aMaxSRow[4];
+        int64_t aMaxLRow[4];
+        int64_t aMaxHCol[4];
+        int64_t aMaxMCol[4];
+        int64_t aMaxSCol[4];
+        int64_t aMaxLCol[4];
+        int64_t aLastValH[4];
+        int64_t aLastValM[4];
+        int64_t aLastValS[4];
+        int64_t aLastValL[4];
+        int64_t aEndI[4];
+        int64_t aEndJ[4];
+        int64_t *rh = aMaxHRow;
+        int64_t *rm = aMaxMRow;
+        int64_t *rs = aMaxSRow;
+        int64_t *rl = aMaxLRow;
+        int64_t *ch = aMaxHCol;
+        int64_t *cm = aMaxMCol;
+        int64_t *cs = aMaxSCol;
+        int64_t *cl = aMaxLCol;
+        int64_t *lh = aLastValH;
+        int64_t *lm = aLastValM;
+        int64_t *ls = aLastValS;
+        int64_t *ll = aLastValL;
+        int64_t *i = aEndI;
+        int64_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxMRow, &vMaxMRow, sizeof(aMaxMRow));
+        memcpy(aMaxSRow, &vMaxSRow, sizeof(aMaxSRow));
+        memcpy(aMaxLRow, &vMaxLRow, sizeof(aMaxLRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aMaxMCol, &vMaxMCol, sizeof(aMaxMCol));
+        memcpy(aMaxSCol, &vMaxSCol, sizeof(aMaxSCol));
+        memcpy(aMaxLCol, &vMaxLCol, sizeof(aMaxLCol));
+        memcpy(aLastValH, &vLastValH, sizeof(aLastValH));
+        memcpy(aLastValM, &vLastValM, sizeof(aLastValM));
+        memcpy(aLastValS, &vLastValS, sizeof(aLastValS));
+        memcpy(aLastValL, &vLastValL, sizeof(aLastValL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++rh, ++rm, ++rs, ++rl, ++ch, ++cm, ++cs, ++cl, ++lh, ++lm, ++ls, ++ll, ++i, ++j) {
             if (*ch > max_colh || (*ch == max_colh && *i < end_query)) {
                 max_colh = *ch;
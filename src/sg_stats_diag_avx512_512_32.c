@@ -0,0 +1,780 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define SG_STATS
+#define SG_SUFFIX _diag_avx512_512_32
+#include "sg_helper.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+
+#define _mm512_cmpeq_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmpeq_epi32_mask(a,b), _mm512_set1_epi32(-1))
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_cmpgt_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmpgt_epi32_mask(a,b), _mm512_set1_epi32(-1))
+
+#define _mm512_insert_epi32_rpl(a,i,imm) _mm512_mask_set1_epi32(a, (__mmask16)1<<(imm), i)
+
+#define _mm512_extract_epi32_rpl(a,imm) _mm_extract_epi32(_mm512_extracti32x4_epi32(a, (imm)>>2), (imm)&3)
+
+#define _mm512_cmplt_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmplt_epi32_mask(a,b), _mm512_set1_epi32(-1))
+
+#define _mm512_srli_si512_rpl(a,imm) _mm512_alignr_epi8(_mm512_maskz_shuffle_i32x4(0x0FFF, a, a, _MM_SHUFFLE(3,3,2,1)), a, imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (0 <= i+0 && i+0 < s1Len && 0 <= j-0 && j-0 < s2Len) {
+        array[1LL*(i+0)*s2Len + (j-0)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 15);
+    }
+    if (0 <= i+1 && i+1 < s1Len && 0 <= j-1 && j-1 < s2Len) {
+        array[1LL*(i+1)*s2Len + (j-1)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 14);
+    }
+    if (0 <= i+2 && i+2 < s1Len && 0 <= j-2 && j-2 < s2Len) {
+        array[1LL*(i+2)*s2Len + (j-2)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 13);
+    }
+    if (0 <= i+3 && i+3 < s1Len && 0 <= j-3 && j-3 < s2Len) {
+        array[1LL*(i+3)*s2Len + (j-3)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 12);
+    }
+    if (0 <= i+4 && i+4 < s1Len && 0 <= j-4 && j-4 < s2Len) {
+        array[1LL*(i+4)*s2Len + (j-4)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 11);
+    }
+    if (0 <= i+5 && i+5 < s1Len && 0 <= j-5 && j-5 < s2Len) {
+        array[1LL*(i+5)*s2Len + (j-5)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 10);
+    }
+    if (0 <= i+6 && i+6 < s1Len && 0 <= j-6 && j-6 < s2Len) {
+        array[1LL*(i+6)*s2Len + (j-6)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 9);
+    }
+    if (0 <= i+7 && i+7 < s1Len && 0 <= j-7 && j-7 < s2Len) {
+        array[1LL*(i+7)*s2Len + (j-7)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 8);
+    }
+    if (0 <= i+8 && i+8 < s1Len && 0 <= j-8 && j-8 < s2Len) {
+        array[1LL*(i+8)*s2Len + (j-8)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 7);
+    }
+    if (0 <= i+9 && i+9 < s1Len && 0 <= j-9 && j-9 < s2Len) {
+        array[1LL*(i+9)*s2Len + (j-9)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 6);
+    }
+    if (0 <= i+10 && i+10 < s1Len && 0 <= j-10 && j-10 < s2Len) {
+        array[1LL*(i+10)*s2Len + (j-10)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 5);
+    }
+    if (0 <= i+11 && i+11 < s1Len && 0 <= j-11 && j-11 < s2Len) {
+        array[1LL*(i+11)*s2Len + (j-11)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 4);
+    }
+    if (0 <= i+12 && i+12 < s1Len && 0 <= j-12 && j-12 < s2Len) {
+        array[1LL*(i+12)*s2Len + (j-12)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 3);
+    }
+    if (0 <= i+13 && i+13 < s1Len && 0 <= j-13 && j-13 < s2Len) {
+        array[1LL*(i+13)*s2Len + (j-13)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 2);
+    }
+    if (0 <= i+14 && i+14 < s1Len && 0 <= j-14 && j-14 < s2Len) {
+        array[1LL*(i+14)*s2Len + (j-14)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 1);
+    }
+    if (0 <= i+15 && i+15 < s1Len && 0 <= j-15 && j-15 < s2Len) {
+        array[1LL*(i+15)*s2Len + (j-15)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_rowcol(
+        int *row,
+        int *col,
+        __m512i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (i+0 == s1Len-1 && 0 <= j-0 && j-0 < s2Len) {
+        row[j-0] = (int32_t)_mm512_extract_epi32_rpl(vWH, 15);
+    }
+    if (j-0 == s2Len-1 && 0 <= i+0 && i+0 < s1Len) {
+        col[(i+0)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 15);
+    }
+    if (i+1 == s1Len-1 && 0 <= j-1 && j-1 < s2Len) {
+        row[j-1] = (int32_t)_mm512_extract_epi32_rpl(vWH, 14);
+    }
+    if (j-1 == s2Len-1 && 0 <= i+1 && i+1 < s1Len) {
+        col[(i+1)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 14);
+    }
+    if (i+2 == s1Len-1 && 0 <= j-2 && j-2 < s2Len) {
+        row[j-2] = (int32_t)_mm512_extract_epi32_rpl(vWH, 13);
+    }
+    if (j-2 == s2Len-1 && 0 <= i+2 && i+2 < s1Len) {
+        col[(i+2)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 13);
+    }
+    if (i+3 == s1Len-1 && 0 <= j-3 && j-3 < s2Len) {
+        row[j-3] = (int32_t)_mm512_extract_epi32_rpl(vWH, 12);
+    }
+    if (j-3 == s2Len-1 && 0 <= i+3 && i+3 < s1Len) {
+        col[(i+3)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 12);
+    }
+    if (i+4 == s1Len-1 && 0 <= j-4 && j-4 < s2Len) {
+        row[j-4] = (int32_t)_mm512_extract_epi32_rpl(vWH, 11);
+    }
+    if (j-4 == s2Len-1 && 0 <= i+4 && i+4 < s1Len) {
+        col[(i+4)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 11);
+    }
+    if (i+5 == s1Len-1 && 0 <= j-5 && j-5 < s2Len) {
+        row[j-5] = (int32_t)_mm512_extract_epi32_rpl(vWH, 10);
+    }
+    if (j-5 == s2Len-1 && 0 <= i+5 && i+5 < s1Len) {
+        col[(i+5)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 10);
+    }
+    if (i+6 == s1Len-1 && 0 <= j-6 && j-6 < s2Len) {
+        row[j-6] = (int32_t)_mm512_extract_epi32_rpl(vWH, 9);
+    }
+    if (j-6 == s2Len-1 && 0 <= i+6 && i+6 < s1Len) {
+        col[(i+6)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 9);
+    }
+    if (i+7 == s1Len-1 && 0 <= j-7 && j-7 < s2Len) {
+        row[j-7] = (int32_t)_mm512_extract_epi32_rpl(vWH, 8);
+    }
+    if (j-7 == s2Len-1 && 0 <= i+7 && i+7 < s1Len) {
+        col[(i+7)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 8);
+    }
+    if (i+8 == s1Len-1 && 0 <= j-8 && j-8 < s2Len) {
+        row[j-8] = (int32_t)_mm512_extract_epi32_rpl(vWH, 7);
+    }
+    if (j-8 == s2Len-1 && 0 <= i+8 && i+8 < s1Len) {
+        col[(i+8)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 7);
+    }
+    if (i+9 == s1Len-1 && 0 <= j-9 && j-9 < s2Len) {
+        row[j-9] = (int32_t)_mm512_extract_epi32_rpl(vWH, 6);
+    }
+    if (j-9 == s2Len-1 && 0 <= i+9 && i+9 < s1Len) {
+        col[(i+9)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 6);
+    }
+    if (i+10 == s1Len-1 && 0 <= j-10 && j-10 < s2Len) {
+        row[j-10] = (int32_t)_mm512_extract_epi32_rpl(vWH, 5);
+    }
+    if (j-10 == s2Len-1 && 0 <= i+10 && i+10 < s1Len) {
+        col[(i+10)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 5);
+    }
+    if (i+11 == s1Len-1 && 0 <= j-11 && j-11 < s2Len) {
+        row[j-11] = (int32_t)_mm512_extract_epi32_rpl(vWH, 4);
+    }
+    if (j-11 == s2Len-1 && 0 <= i+11 && i+11 < s1Len) {
+        col[(i+11)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 4);
+    }
+    if (i+12 == s1Len-1 && 0 <= j-12 && j-12 < s2Len) {
+        row[j-12] = (int32_t)_mm512_extract_epi32_rpl(vWH, 3);
+    }
+    if (j-12 == s2Len-1 && 0 <= i+12 && i+12 < s1Len) {
+        col[(i+12)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 3);
+    }
+    if (i+13 == s1Len-1 && 0 <= j-13 && j-13 < s2Len) {
+        row[j-13] = (int32_t)_mm512_extract_epi32_rpl(vWH, 2);
+    }
+    if (j-13 == s2Len-1 && 0 <= i+13 && i+13 < s1Len) {
+        col[(i+13)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 2);
+    }
+    if (i+14 == s1Len-1 && 0 <= j-14 && j-14 < s2Len) {
+        row[j-14] = (int32_t)_mm512_extract_epi32_rpl(vWH, 1);
+    }
+    if (j-14 == s2Len-1 && 0 <= i+14 && i+14 < s1Len) {
+        col[(i+14)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 1);
+    }
+    if (i+15 == s1Len-1 && 0 <= j-15 && j-15 < s2Len) {
+        row[j-15] = (int32_t)_mm512_extract_epi32_rpl(vWH, 0);
+    }
+    if (j-15 == s2Len-1 && 0 <= i+15 && i+15 < s1Len) {
+        col[(i+15)] = (int32_t)_mm512_extract_epi32_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_sg_flags_stats_table_diag_avx512_512_32
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_sg_flags_stats_rowcol_diag_avx512_512_32
+#else
+#define FNAME parasail_sg_flags_stats_diag_avx512_512_32
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end)
+{
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    int32_t * const restrict s1      = parasail_memalign_int32_t(64, s1Len+PAD);
+    int32_t * const restrict s2B     = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _H_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _HM_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _HS_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _HL_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _F_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _FM_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _FS_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict _FL_pr = parasail_memalign_int32_t(64, s2Len+PAD2);
+    int32_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int32_t * const restrict H_pr = _H_pr+PAD;
+    int32_t * const restrict HM_pr = _HM_pr+PAD;
+    int32_t * const restrict HS_pr = _HS_pr+PAD;
+    int32_t * const restrict HL_pr = _HL_pr+PAD;
+    int32_t * const restrict F_pr = _F_pr+PAD;
+    int32_t * const restrict FM_pr = _FM_pr+PAD;
+    int32_t * const restrict FS_pr = _FS_pr+PAD;
+    int32_t * const restrict FL_pr = _FL_pr+PAD;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table3(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol3(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new_stats();
+#endif
+#endif
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const int32_t NEG_LIMIT = (-open < matrix->min ?
+        INT32_MIN + open : INT32_MIN - matrix->min) + 1;
+    const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
+    int32_t score = NEG_LIMIT;
+    int32_t matches = NEG_LIMIT;
+    int32_t similar = NEG_LIMIT;
+    int32_t length = NEG_LIMIT;
+    __m512i vNegLimit = _mm512_set1_epi32(NEG_LIMIT);
+    __m512i vPosLimit = _mm512_set1_epi32(POS_LIMIT);
+    __m512i vSaturationCheckMin = vPosLimit;
+    __m512i vSaturationCheckMax = vNegLimit;
+    __m512i vNegInf = _mm512_set1_epi32(NEG_LIMIT);
+    __m512i vOpen = _mm512_set1_epi32(open);
+    __m512i vGap  = _mm512_set1_epi32(gap);
+    __m512i vZero = _mm512_set1_epi32(0);
+    __m512i vOne = _mm512_set1_epi32(1);
+    __m512i vN = _mm512_set1_epi32(N);
+    __m512i vGapN = s1_beg ? _mm512_set1_epi32(0) : _mm512_set1_epi32(gap*N);
+    __m512i vNegOne = _mm512_set1_epi32(-1);
+    __m512i vI = _mm512_set_epi32(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+    __m512i vJreset = _mm512_set_epi32(0,-1,-2,-3,-4,-5,-6,-7,-8,-9,-10,-11,-12,-13,-14,-15);
+    __m512i vMaxHRow = vNegInf;
+    __m512i vMaxMRow = vNegInf;
+    __m512i vMaxSRow = vNegInf;
+    __m512i vMaxLRow = vNegInf;
+    __m512i vMaxHCol = vNegInf;
+    __m512i vMaxMCol = vNegInf;
+    __m512i vMaxSCol = vNegInf;
+    __m512i vMaxLCol = vNegInf;
+    __m512i vLastValH = vNegInf;
+    __m512i vLastValM = vNegInf;
+    __m512i vLastValS = vNegInf;
+    __m512i vLastValL = vNegInf;
+    __m512i vEndI = vNegInf;
+    __m512i vEndJ = vNegInf;
+    __m512i vILimit = _mm512_set1_epi32(s1Len);
+    __m512i vILimit1 = _mm512_sub_epi32(vILimit, vOne);
+    __m512i vJLimit = _mm512_set1_epi32(s2Len);
+    __m512i vJLimit1 = _mm512_sub_epi32(vJLimit, vOne);
+    __m512i vIBoundary = s1_beg ? _mm512_set1_epi32(0) : _mm512_set_epi32(
+            -open-0*gap,
+            -open-1*gap,
+            -open-2*gap,
+            -open-3*gap,
+            -open-4*gap,
+            -open-5*gap,
+            -open-6*gap,
+            -open-7*gap,
+            -open-8*gap,
+            -open-9*gap,
+            -open-10*gap,
+            -open-11*gap,
+            -open-12*gap,
+            -open-13*gap,
+            -open-14*gap,
+            -open-15*gap);
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row */
+    if (s2_beg) {
+        for (j=0; j<s2Len; ++j) {
+            H_pr[j] = 0;
+            HM_pr[j] = 0;
+            HS_pr[j] = 0;
+            HL_pr[j] = 0;
+            F_pr[j] = NEG_INF;
+            FM_pr[j] = 0;
+            FS_pr[j] = 0;
+            FL_pr[j] = 0;
+        }
+    }
+    else {
+        for (j=0; j<s2Len; ++j) {
+            H_pr[j] = -open - j*gap;
+            HM_pr[j] = 0;
+            HS_pr[j] = 0;
+            HL_pr[j] = 0;
+            F_pr[j] = NEG_INF;
+            FM_pr[j] = 0;
+            FS_pr[j] = 0;
+            FL_pr[j] = 0;
+        }
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = 0;
+        HM_pr[j] = 0;
+        HS_pr[j] = 0;
+        HL_pr[j] = 0;
+        F_pr[j] = 0;
+        FM_pr[j] = 0;
+        FS_pr[j] = 0;
+        FL_pr[j] = 0;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = 0;
+        HM_pr[j] = 0;
+        HS_pr[j] = 0;
+        HL_pr[j] = 0;
+        F_pr[j] = 0;
+        FM_pr[j] = 0;
+        FS_pr[j] = 0;
+        FL_pr[j] = 0;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        __m512i case1 = vZero;
+        __m512i case2 = vZero;
+        __m512i vNH = vNegInf;
+        __m512i vNM = vZero;
+        __m512i vNS = vZero;
+        __m512i vNL = vZero;
+        __m512i vWH = vNegInf;
+        __m512i vWM = vZero;
+        __m512i vWS = vZero;
+        __m512i vWL = vZero;
+        __m512i vE = vNegInf;
+        __m512i vE_opn = vNegInf;
+        __m512i vE_ext = vNegInf;
+        __m512i vEM = vZero;
+        __m512i vES = vZero;
+        __m512i vEL = vZero;
+        __m512i vF = vNegInf;
+        __m512i vF_opn = vNegInf;
+        __m512i vF_ext = vNegInf;
+        __m512i vFM = vZero;
+        __m512i vFS = vZero;
+        __m512i vFL = vZero;
+        __m512i vJ = vJreset;
+        __m512i vs1 = _mm512_set_epi32(
+                s1[i+0],
+                s1[i+1],
+                s1[i+2],
+                s1[i+3],
+                s1[i+4],
+                s1[i+5],
+                s1[i+6],
+                s1[i+7],
+                s1[i+8],
+                s1[i+9],
+                s1[i+10],
+                s1[i+11],
+                s1[i+12],
+                s1[i+13],
+                s1[i+14],
+                s1[i+15]);
+        __m512i vs2 = vNegInf;
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        const int * const restrict matrow8 = &matrix->matrix[matrix->size*s1[i+8]];
+        const int * const restrict matrow9 = &matrix->matrix[matrix->size*s1[i+9]];
+        const int * const restrict matrow10 = &matrix->matrix[matrix->size*s1[i+10]];
+        const int * const restrict matrow11 = &matrix->matrix[matrix->size*s1[i+11]];
+        const int * const restrict matrow12 = &matrix->matrix[matrix->size*s1[i+12]];
+        const int * const restrict matrow13 = &matrix->matrix[matrix->size*s1[i+13]];
+        const int * const restrict matrow14 = &matrix->matrix[matrix->size*s1[i+14]];
+        const int * const restrict matrow15 = &matrix->matrix[matrix->size*s1[i+15]];
+        __m512i vIltLimit = _mm512_cmplt_epi32_rpl(vI, vILimit);
+        __m512i vIeqLimit1 = _mm512_cmpeq_epi32_rpl(vI, vILimit1);
+        vNH = _mm512_srli_si512_rpl(vNH, 4);
+        vNH = _mm512_insert_epi32_rpl(vNH, H_pr[-1], 15);
+        vWH = _mm512_srli_si512_rpl(vWH, 4);
+        vWH = _mm512_insert_epi32_rpl(vWH, s1_beg ? 0 : (-open - i*gap), 15);
+        H_pr[-1] = -open - (i+N)*gap;
+        /* iterate over database sequence */
+        for (j=0; j<s2Len+PAD; ++j) {
+            __m512i vMat;
+            __m512i vNWH = vNH;
+            __m512i vNWM = vNM;
+            __m512i vNWS = vNS;
+            __m512i vNWL = vNL;
+            vNH = _mm512_srli_si512_rpl(vWH, 4);
+            vNH = _mm512_insert_epi32_rpl(vNH, H_pr[j], 15);
+            vNM = _mm512_srli_si512_rpl(vWM, 4);
+            vNM = _mm512_insert_epi32_rpl(vNM, HM_pr[j], 15);
+            vNS = _mm512_srli_si512_rpl(vWS, 4);
+            vNS = _mm512_insert_epi32_rpl(vNS, HS_pr[j], 15);
+            vNL = _mm512_srli_si512_rpl(vWL, 4);
+            vNL = _mm512_insert_epi32_rpl(vNL, HL_pr[j], 15);
+            vF = _mm512_srli_si512_rpl(vF, 4);
+            vF = _mm512_insert_epi32_rpl(vF, F_pr[j], 15);
+            vFM = _mm512_srli_si512_rpl(vFM, 4);
+            vFM = _mm512_insert_epi32_rpl(vFM, FM_pr[j], 15);
+            vFS = _mm512_srli_si512_rpl(vFS, 4);
+            vFS = _mm512_insert_epi32_rpl(vFS, FS_pr[j], 15);
+            vFL = _mm512_srli_si512_rpl(vFL, 4);
+            vFL = _mm512_insert_epi32_rpl(vFL, FL_pr[j], 15);
+            vF_opn = _mm512_sub_epi32(vNH, vOpen);
+            vF_ext = _mm512_sub_epi32(vF, vGap);
+            vF = _mm512_max_epi32(vF_opn, vF_ext);
+            case1 = _mm512_cmpgt_epi32_rpl(vF_opn, vF_ext);
+            vFM = _mm512_blendv_epi8_rpl(vFM, vNM, case1);
+            vFS = _mm512_blendv_epi8_rpl(vFS, vNS, case1);
+            vFL = _mm512_blendv_epi8_rpl(vFL, vNL, case1);
+            vFL = _mm512_add_epi32(vFL, vOne);
+            vE_opn = _mm512_sub_epi32(vWH, vOpen);
+            vE_ext = _mm512_sub_epi32(vE, vGap);
+            vE = _mm512_max_epi32(vE_opn, vE_ext);
+            case1 = _mm512_cmpgt_epi32_rpl(vE_opn, vE_ext);
+            vEM = _mm512_blendv_epi8_rpl(vEM, vWM, case1);
+            vES = _mm512_blendv_epi8_rpl(vES, vWS, case1);
+            vEL = _mm512_blendv_epi8_rpl(vEL, vWL, case1);
+            vEL = _mm512_add_epi32(vEL, vOne);
+            vs2 = _mm512_srli_si512_rpl(vs2, 4);
+            vs2 = _mm512_insert_epi32_rpl(vs2, s2[j], 15);
+            vMat = _mm512_set_epi32(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]],
+                    matrow8[s2[j-8]],
+                    matrow9[s2[j-9]],
+                    matrow10[s2[j-10]],
+                    matrow11[s2[j-11]],
+                    matrow12[s2[j-12]],
+                    matrow13[s2[j-13]],
+                    matrow14[s2[j-14]],
+                    matrow15[s2[j-15]]
+                    );
+            vNWH = _mm512_add_epi32(vNWH, vMat);
+            vWH = _mm512_max_epi32(vNWH, vE);
+            vWH = _mm512_max_epi32(vWH, vF);
+            case1 = _mm512_cmpeq_epi32_rpl(vWH, vNWH);
+            case2 = _mm512_cmpeq_epi32_rpl(vWH, vF);
+            vWM = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vEM, vFM, case2),
+                    _mm512_add_epi32(vNWM,
+                        _mm512_and_si512(
+                            _mm512_cmpeq_epi32_rpl(vs1,vs2),
+                            vOne)),
+                    case1);
+            vWS = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vES, vFS, case2),
+                    _mm512_add_epi32(vNWS,
+                        _mm512_and_si512(
+                            _mm512_cmpgt_epi32_rpl(vMat,vZero),
+                            vOne)),
+                    case1);
+            vWL = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vEL, vFL, case2),
+                    _mm512_add_epi32(vNWL, vOne), case1);
+            /* as minor diagonal vector passes across the j=-1 boundary,
+             * assign the appropriate boundary conditions */
+            {
+                __m512i cond = _mm512_cmpeq_epi32_rpl(vJ,vNegOne);
+                vWH = _mm512_blendv_epi8_rpl(vWH, vIBoundary, cond);
+                vWM = _mm512_andnot_si512(cond, vWM);
+                vWS = _mm512_andnot_si512(cond, vWS);
+                vWL = _mm512_andnot_si512(cond, vWL);
+                vE = _mm512_blendv_epi8_rpl(vE, vNegInf, cond);
+                vEM = _mm512_andnot_si512(cond, vEM);
+                vES = _mm512_andnot_si512(cond, vES);
+                vEL = _mm512_andnot_si512(cond, vEL);
+            }
+            vSaturationCheckMin = _mm512_min_epi32(vSaturationCheckMin, vWH);
+            vSaturationCheckMax = _mm512_max_epi32(vSaturationCheckMax, vWH);
+            vSaturationCheckMax = _mm512_max_epi32(vSaturationCheckMax, vWM);
+            vSaturationCheckMax = _mm512_max_epi32(vSaturationCheckMax, vWS);
+            vSaturationCheckMax = _mm512_max_epi32(vSaturationCheckMax, vWL);
+            vSaturationCheckMax = _mm512_max_epi32(vSaturationCheckMax, vWL);
+            vSaturationCheckMax = _mm512_max_epi32(vSaturationCheckMax, vJ);
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->stats->tables->score_table, vWH, i, s1Len, j, s2Len);
+            arr_store_si512(result->stats->tables->matches_table, vWM, i, s1Len, j, s2Len);
+            arr_store_si512(result->stats->tables->similar_table, vWS, i, s1Len, j, s2Len);
+            arr_store_si512(result->stats->tables->length_table, vWL, i, s1Len, j, s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+            arr_store_rowcol(result->stats->rowcols->score_row,   result->stats->rowcols->score_col, vWH, i, s1Len, j, s2Len);
+            arr_store_rowcol(result->stats->rowcols->matches_row, result->stats->rowcols->matches_col, vWM, i, s1Len, j, s2Len);
+            arr_store_rowcol(result->stats->rowcols->similar_row, result->stats->rowcols->similar_col, vWS, i, s1Len, j, s2Len);
+            arr_store_rowcol(result->stats->rowcols->length_row,  result->stats->rowcols->length_col, vWL, i, s1Len, j, s2Len);
+#endif
+            H_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vWH,0);
+            HM_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vWM,0);
+            HS_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vWS,0);
+            HL_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vWL,0);
+            F_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vF,0);
+            FM_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vFM,0);
+            FS_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vFS,0);
+            FL_pr[j-15] = (int32_t)_mm512_extract_epi32_rpl(vFL,0);
+            /* as minor diagonal vector passes across the i or j limit
+             * boundary, extract the last value of the column or row */
+            {
+                __m512i vJeqLimit1 = _mm512_cmpeq_epi32_rpl(vJ, vJLimit1);
+                __m512i vJgtNegOne = _mm512_cmpgt_epi32_rpl(vJ, vNegOne);
+                __m512i vJltLimit = _mm512_cmplt_epi32_rpl(vJ, vJLimit);
+                __m512i cond_j = _mm512_and_si512(vIltLimit, vJeqLimit1);
+                __m512i cond_i = _mm512_and_si512(vIeqLimit1,
+                        _mm512_and_si512(vJgtNegOne, vJltLimit));
+                __m512i cond_max_row = _mm512_cmpgt_epi32_rpl(vWH, vMaxHRow);
+                __m512i cond_max_col = _mm512_cmpgt_epi32_rpl(vWH, vMaxHCol);
+                __m512i cond_last_val = _mm512_and_si512(vIeqLimit1, vJeqLimit1);
+                __m512i cond_all_row = _mm512_and_si512(cond_max_row, cond_i);
+                __m512i cond_all_col = _mm512_and_si512(cond_max_col, cond_j);
+                vMaxHRow = _mm512_blendv_epi8_rpl(vMaxHRow, vWH, cond_all_row);
+                vMaxMRow = _mm512_blendv_epi8_rpl(vMaxMRow, vWM, cond_all_row);
+                vMaxSRow = _mm512_blendv_epi8_rpl(vMaxSRow, vWS, cond_all_row);
+                vMaxLRow = _mm512_blendv_epi8_rpl(vMaxLRow, vWL, cond_all_row);
+                vMaxHCol = _mm512_blendv_epi8_rpl(vMaxHCol, vWH, cond_all_col);
+                vMaxMCol = _mm512_blendv_epi8_rpl(vMaxMCol, vWM, cond_all_col);
+                vMaxSCol = _mm512_blendv_epi8_rpl(vMaxSCol, vWS, cond_all_col);
+                vMaxLCol = _mm512_blendv_epi8_rpl(vMaxLCol, vWL, cond_all_col);
+                vLastValH = _mm512_blendv_epi8_rpl(vLastValH, vWH, cond_last_val);
+                vLastValM = _mm512_blendv_epi8_rpl(vLastValM, vWM, cond_last_val);
+                vLastValS = _mm512_blendv_epi8_rpl(vLastValS, vWS, cond_last_val);
+                vLastValL = _mm512_blendv_epi8_rpl(vLastValL, vWL, cond_last_val);
+                vEndI = _mm512_blendv_epi8_rpl(vEndI, vI, cond_all_col);
+                vEndJ = _mm512_blendv_epi8_rpl(vEndJ, vJ, cond_all_row);
+            }
+            vJ = _mm512_add_epi32(vJ, vOne);
+        }
+        vI = _mm512_add_epi32(vI, vN);
+        vIBoundary = _mm512_sub_epi32(vIBoundary, vGapN);
+        vSaturationCheckMax = _mm512_max_epi32(vSaturationCheckMax, vI);
+    }
+
+    /* alignment ending position */
+    {
+        int32_t max_rowh = NEG_INF;
+        int32_t max_rowm = NEG_INF;
+        int32_t max_rows = NEG_INF;
+        int32_t max_rowl = NEG_INF;
+        int32_t max_colh = NEG_INF;
+        int32_t max_colm = NEG_INF;
+        int32_t max_cols = NEG_INF;
+        int32_t max_coll = NEG_INF;
+        int32_t last_valh = NEG_INF;
+        int32_t last_valm = NEG_INF;
+        int32_t last_vals = NEG_INF;
+        int32_t last_vall = NEG_INF;
+        int32_t aMaxHRow[16];
+        int32_t aMaxMRow[16];
+        int32_t aMaxSRow[16];
+        int32_t aMaxLRow[16];
+        int32_t aMaxHCol[16];
+        int32_t aMaxMCol[16];
+        int32_t aMaxSCol[16];
+        int32_t aMaxLCol[16];
+        int32_t aLastValH[16];
+        int32_t aLastValM[16];
+        int32_t aLastValS[16];
+        int32_t aLastValL[16];
+        int32_t aEndI[16];
+        int32_t aEndJ[16];
+        int32_t *rh = aMaxHRow;
+        int32_t *rm = aMaxMRow;
+        int32_t *rs = aMaxSRow;
+        int32_t *rl = aMaxLRow;
+        int32_t *ch = aMaxHCol;
+        int32_t *cm = aMaxMCol;
+        int32_t *cs = aMaxSCol;
+        int32_t *cl = aMaxLCol;
+        int32_t *lh = aLastValH;
+        int32_t *lm = aLastValM;
+        int32_t *ls = aLastValS;
+        int32_t *ll = aLastValL;
+        int32_t *i = aEndI;
+        int32_t *j = aEndJ;
+        int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxMRow, &vMaxMRow, sizeof(aMaxMRow));
+        memcpy(aMaxSRow, &vMaxSRow, sizeof(aMaxSRow));
+        memcpy(aMaxLRow, &vMaxLRow, sizeof(aMaxLRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aMaxMCol, &vMaxMCol, sizeof(aMaxMCol));
+        memcpy(aMaxSCol, &vMaxSCol, sizeof(aMaxSCol));
+        memcpy(aMaxLCol, &vMaxLCol, sizeof(aMaxLCol));
+        memcpy(aLastValH, &vLastValH, sizeof(aLastValH));
+        memcpy(aLastValM, &vLastValM, sizeof(aLastValM));
+        memcpy(aLastValS, &vLastValS, sizeof(aLastValS));
+        memcpy(aLastValL, &vLastValL, sizeof(aLastValL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
+        for (k=0; k<N; ++k, ++rh, ++rm, ++rs, ++rl, ++ch, ++cm, ++cs, ++cl, ++lh, ++lm, ++ls, ++ll, ++i, ++j) {
+            if (*ch > max_colh || (*ch == max_colh && *i < end_query)) {
+                max_colh = *ch;
+                end_query = *i;
+                max_colm = *cm;
+                max_cols = *cs;
+                max_coll = *cl;
+            }
+            if (*rh > max_rowh) {
+                max_rowh = *rh;
+                end_ref = *j;
+                max_rowm = *rm;
+                max_rows = *rs;
+                max_rowl = *rl;
+            }
+            if (*lh > last_valh) {
+                last_valh = *lh;
+                last_valm = *lm;
+                last_vals = *ls;
+                last_vall = *ll;
+            }
+        }
+        if (s1_end && s2_end) {
+            if (max_colh > max_rowh || (max_colh == max_rowh && end_ref == s2Len-1)) {
+                score = max_colh;
+                end_ref = s2Len-1;
+                matches = max_colm;
+                similar = max_cols;
+                length = max_coll;
+            }
+            else {
+                score = max_rowh;
+                end_query = s1Len-1;
+                matches = max_rowm;
+                similar = max_rows;
+                length = max_rowl;
+            }
+        }
+        else if (s1_end) {
+            score = max_colh;
+            end_ref = s2Len-1;
+            matches = max_colm;
+            similar = max_cols;
+            length = max_coll;
+        }
+        else if (s2_end) {
+            score = max_rowh;
+            end_query = s1Len-1;
+            matches = max_rowm;
+            similar = max_rows;
+            length = max_rowl;
+        }
+        else {
+            score = last_valh;
+            end_query = s1Len-1;
+            end_ref = s2Len-1;
+            matches = last_valm;
+            similar = last_vals;
+            length = last_vall;
+        }
+    }
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(
+            _mm512_cmplt_epi32_rpl(vSaturationCheckMin, vNegLimit),
+            _mm512_cmpgt_epi32_rpl(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        matches = 0;
+        similar = 0;
+        length = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->stats->matches = matches;
+    result->stats->similar = similar;
+    result->stats->length = length;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_STATS
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_16;
+    result->flag |= s1_beg ? PARASAIL_FLAG_SG_S1_BEG : 0;
+    result->flag |= s1_end ? PARASAIL_FLAG_SG_S1_END : 0;
+    result->flag |= s2_beg ? PARASAIL_FLAG_SG_S2_BEG : 0;
+    result->flag |= s2_end ? PARASAIL_FLAG_SG_S2_END : 0;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(_FL_pr);
+    parasail_free(_FS_pr);
+    parasail_free(_FM_pr);
+    parasail_free(_F_pr);
+    parasail_free(_HL_pr);
+    parasail_free(_HS_pr);
+    parasail_free(_HM_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
+SG_IMPL_ALL
+
+
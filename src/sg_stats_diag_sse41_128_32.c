@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -458,21 +459,49 @@ parasail_result_t* FNAME(
         int32_t last_valm = NEG_INF;
         int32_t last_vals = NEG_INF;
         int32_t last_vall = NEG_INF;
-        int32_t *rh = (int32_t*)&vMaxHRow;
-        int32_t *rm = (int32_t*)&vMaxMRow;
-        int32_t *rs = (int32_t*)&vMaxSRow;
-        int32_t *rl = (int32_t*)&vMaxLRow;
-        int32_t *ch = (int32_t*)&vMaxHCol;
-        int32_t *cm = (int32_t*)&vMaxMCol;
-        int32_t *cs = (int32_t*)&vMaxSCol;
-        int32_t *cl = (int32_t*)&vMaxLCol;
-        int32_t *lh = (int32_t*)&vLastValH;
-        int32_t *lm = (int32_t*)&vLastValM;
-        int32_t *ls = (int32_t*)&vLastValS;
-        int32_t *ll = (int32_t*)&vLastValL;
-        int32_t *i = (int32_t*)&vEndI;
-        int32_t *j = (int32_t*)&vEndJ;
+        int32_t aMaxHRow[4];
+        int32_t aMaxMRow[4];
+        int32_t aMaxSRow[4];
+        int32_t aMaxLRow[4];
+        int32_t aMaxHCol[4];
+        int32_t aMaxMCol[4];
+        int32_t aMaxSCol[4];
+        int32_t aMaxLCol[4];
+        int32_t aLastValH[4];
+        int32_t aLastValM[4];
+        int32_t aLastValS[4];
+        int32_t aLastValL[4];
+        int32_t aEndI[4];
+        int32_t aEndJ[4];
+        int32_t *rh = aMaxHRow;
+        int32_t *rm = aMaxMRow;
+        int32_t *rs = aMaxSRow;
+        int32_t *rl = aMaxLRow;
+        int32_t *ch = aMaxHCol;
+        int32_t *cm = aMaxMCol;
+        int32_t *cs = aMaxSCol;
+        int32_t *cl = aMaxLCol;
+        int32_t *lh = aLastValH;
+        int32_t *lm = aLastValM;
+        int32_t *ls = aLastValS;
+        int32_t *ll = aLastValL;
+        int32_t *i = aEndI;
+        int32_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxMRow, &vMaxMRow, sizeof(aMaxMRow));
+        memcpy(aMaxSRow, &vMaxSRow, sizeof(aMaxSRow));
+        memcpy(aMaxLRow, &vMaxLRow, sizeof(aMaxLRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aMaxMCol, &vMaxMCol, sizeof(aMaxMCol));
+        memcpy(aMaxSCol, &vMaxSCol, sizeof(aMaxSCol));
+        memcpy(aMaxLCol, &vMaxLCol, sizeof(aMaxLCol));
+        memcpy(aLastValH, &vLastValH, sizeof(aLastValH));
+        memcpy(aLastValM, &vLastValM, sizeof(aLastValM));
+        memcpy(aLastValS, &vLastValS, sizeof(aLastValS));
+        memcpy(aLastValL, &vLastValL, sizeof(aLastValL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++rh, ++rm, ++rs, ++rl, ++ch, ++cm, ++cs, ++cl, ++lh, ++lm, ++ls, ++ll, ++i, ++j) {
             if (*ch > max_colh || (*ch == max_colh && *i < end_query)) {
                 max_colh = *ch;
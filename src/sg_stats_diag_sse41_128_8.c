@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -614,21 +615,49 @@ parasail_result_t* FNAME(
         int8_t last_valm = NEG_INF;
         int8_t last_vals = NEG_INF;
         int8_t last_vall = NEG_INF;
-        int8_t *rh = (int8_t*)&vMaxHRow;
-        int8_t *rm = (int8_t*)&vMaxMRow;
-        int8_t *rs = (int8_t*)&vMaxSRow;
-        int8_t *rl = (int8_t*)&vMaxLRow;
-        int8_t *ch = (int8_t*)&vMaxHCol;
-        int8_t *cm = (int8_t*)&vMaxMCol;
-        int8_t *cs = (int8_t*)&vMaxSCol;
-        int8_t *cl = (int8_t*)&vMaxLCol;
-        int8_t *lh = (int8_t*)&vLastValH;
-        int8_t *lm = (int8_t*)&vLastValM;
-        int8_t *ls = (int8_t*)&vLastValS;
-        int8_t *ll = (int8_t*)&vLastValL;
-        int8_t *i = (int8_t*)&vEndI;
-        int8_t *j = (int8_t*)&vEndJ;
+        int8_t aMaxHRow[16];
+        int8_t aMaxMRow[16];
+        int8_t aMaxSRow[16];
+        int8_t aMaxLRow[16];
+        int8_t aMaxHCol[16];
+        int8_t aMaxMCol[16];
+        int8_t aMaxSCol[16];
+        int8_t aMaxLCol[16];
+        int8_t aLastValH[16];
+        int8_t aLastValM[16];
+        int8_t aLastValS[16];
+        int8_t aLastValL[16];
+        int8_t aEndI[16];
+        int8_t aEndJ[16];
+        int8_t *rh = aMaxHRow;
+        int8_t *rm = aMaxMRow;
+        int8_t *rs = aMaxSRow;
+        int8_t *rl = aMaxLRow;
+        int8_t *ch = aMaxHCol;
+        int8_t *cm = aMaxMCol;
+        int8_t *cs = aMaxSCol;
+        int8_t *cl = aMaxLCol;
+        int8_t *lh = aLastValH;
+        int8_t *lm = aLastValM;
+        int8_t *ls = aLastValS;
+        int8_t *ll = aLastValL;
+        int8_t *i = aEndI;
+        int8_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxMRow, &vMaxMRow, sizeof(aMaxMRow));
+        memcpy(aMaxSRow, &vMaxSRow, sizeof(aMaxSRow));
+        memcpy(aMaxLRow, &vMaxLRow, sizeof(aMaxLRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aMaxMCol, &vMaxMCol, sizeof(aMaxMCol));
+        memcpy(aMaxSCol, &vMaxSCol, sizeof(aMaxSCol));
+        memcpy(aMaxLCol, &vMaxLCol, sizeof(aMaxLCol));
+        memcpy(aLastValH, &vLastValH, sizeof(aLastValH));
+        memcpy(aLastValM, &vLastValM, sizeof(aLastValM));
+        memcpy(aLastValS, &vLastValS, sizeof(aLastValS));
+        memcpy(aLastValL, &vLastValL, sizeof(aLastValL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++rh, ++rm, ++rs, ++rl, ++ch, ++cm, ++cs, ++cl, ++lh, ++lm, ++ls, ++ll, ++i, ++j) {
             if (*ch > max_colh || (*ch == max_colh && *i < end_query)) {
                 max_colh = *ch;
@@ -125,6 +125,7 @@ parasail_result_t* PNAME(
     int32_t similar = 0;
     int32_t length = 0;
     vec128i vNegLimit = _mm_set1_epi32(NEG_LIMIT);
+    vec128i vNegInf = _mm_set1_epi32(NEG_LIMIT-1);
     vec128i vPosLimit = _mm_set1_epi32(POS_LIMIT);
     vec128i vSaturationCheckMin = vPosLimit;
     vec128i vSaturationCheckMax = vNegLimit;
@@ -202,8 +203,9 @@ parasail_result_t* PNAME(
         const vec128i* vPS = NULL;
 
         /* Initialize F value to neg inf.  Any errors to vH values will
-         * be corrected in the Lazy_F loop. */
-        vF = vNegLimit;
+         * be corrected in the Lazy_F loop.  Neg inf is below NEG_LIMIT
+         * so that an H value floored by it is still seen as saturated. */
+        vF = vNegInf;
         vFM = vZero;
         vFS = vZero;
         vFL = vOne;
@@ -130,6 +130,7 @@ parasail_result_t* PNAME(
     const int8_t POS_LIMIT = INT8_MAX - matrix->max - 1;
     int8_t score = NEG_LIMIT;
     vec128i vNegLimit = _mm_set1_epi8(NEG_LIMIT);
+    vec128i vNegInf = _mm_set1_epi8(NEG_LIMIT-1);
     vec128i vPosLimit = _mm_set1_epi8(POS_LIMIT);
     vec128i vSaturationCheckMin = vPosLimit;
     vec128i vSaturationCheckMax = vNegLimit;
@@ -178,8 +179,10 @@ parasail_result_t* PNAME(
     for (j=0; j<s2Len; ++j) {
         vec128i vE;
         /* Initialize F value to -inf.  Any errors to vH values will be
-         * corrected in the Lazy_F loop.  */
-        vec128i vF = vNegLimit;
+         * corrected in the Lazy_F loop.  -inf is below NEG_LIMIT so that
+         * an H value floored by it is still seen as saturated, which
+         * matters when the whole query fits in one segment. */
+        vec128i vF = vNegInf;
 
         /* load final segment of pvHStore and shift left by 2 bytes */
         vec128i vH = _mm_slli_si128(pvHStore[segLen - 1], 1);
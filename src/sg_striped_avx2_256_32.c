@@ -139,6 +139,7 @@ parasail_result_t* PNAME(
     const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
     int32_t score = NEG_LIMIT;
     __m256i vNegLimit = _mm256_set1_epi32(NEG_LIMIT);
+    __m256i vNegInf = _mm256_set1_epi32(NEG_LIMIT-1);
     __m256i vPosLimit = _mm256_set1_epi32(POS_LIMIT);
     __m256i vSaturationCheckMin = vPosLimit;
     __m256i vSaturationCheckMax = vNegLimit;
@@ -187,8 +188,10 @@ parasail_result_t* PNAME(
     for (j=0; j<s2Len; ++j) {
         __m256i vE;
         /* Initialize F value to -inf.  Any errors to vH values will be
-         * corrected in the Lazy_F loop.  */
-        __m256i vF = vNegLimit;
+         * corrected in the Lazy_F loop.  -inf is below NEG_LIMIT so that
+         * an H value floored by it is still seen as saturated, which
+         * matters when the whole query fits in one segment. */
+        __m256i vF = vNegInf;
 
         /* load final segment of pvHStore and shift left by 2 bytes */
         __m256i vH = _mm256_slli_si256_rpl(pvHStore[segLen - 1], 4);
@@ -106,6 +106,7 @@ parasail_result_t* PNAME(
     const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
     int32_t score = NEG_LIMIT;
     simde__m128i vNegLimit = simde_mm_set1_epi32(NEG_LIMIT);
+    simde__m128i vNegInf = simde_mm_set1_epi32(NEG_LIMIT-1);
     simde__m128i vPosLimit = simde_mm_set1_epi32(POS_LIMIT);
     simde__m128i vSaturationCheckMin = vPosLimit;
     simde__m128i vSaturationCheckMax = vNegLimit;
@@ -154,8 +155,10 @@ parasail_result_t* PNAME(
     for (j=0; j<s2Len; ++j) {
         simde__m128i vE;
         /* Initialize F value to -inf.  Any errors to vH values will be
-         * corrected in the Lazy_F loop.  */
-        simde__m128i vF = vNegLimit;
+         * corrected in the Lazy_F loop.  -inf is below NEG_LIMIT so that
+         * an H value floored by it is still seen as saturated, which
+         * matters when the whole query fits in one segment. */
+        simde__m128i vF = vNegInf;
 
         /* load final segment of pvHStore and shift left by 2 bytes */
         simde__m128i vH = simde_mm_slli_si128(pvHStore[segLen - 1], 4);
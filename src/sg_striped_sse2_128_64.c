@@ -191,6 +191,7 @@ parasail_result_t* PNAME(
     const int64_t POS_LIMIT = INT64_MAX - matrix->max - 1;
     int64_t score = NEG_LIMIT;
     __m128i vNegLimit = _mm_set1_epi64x_rpl(NEG_LIMIT);
+    __m128i vNegInf = _mm_set1_epi64x_rpl(NEG_LIMIT-1);
     __m128i vPosLimit = _mm_set1_epi64x_rpl(POS_LIMIT);
     __m128i vSaturationCheckMin = vPosLimit;
     __m128i vSaturationCheckMax = vNegLimit;
@@ -239,8 +240,10 @@ parasail_result_t* PNAME(
     for (j=0; j<s2Len; ++j) {
         __m128i vE;
         /* Initialize F value to -inf.  Any errors to vH values will be
-         * corrected in the Lazy_F loop.  */
-        __m128i vF = vNegLimit;
+         * corrected in the Lazy_F loop.  -inf is below NEG_LIMIT so that
+         * an H value floored by it is still seen as saturated, which
+         * matters when the whole query fits in one segment. */
+        __m128i vF = vNegInf;
 
         /* load final segment of pvHStore and shift left by 2 bytes */
         __m128i vH = _mm_slli_si128(pvHStore[segLen - 1], 8);
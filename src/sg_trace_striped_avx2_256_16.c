@@ -49,23 +49,59 @@ static inline int16_t _mm256_extract_epi16_rpl(__m256i a, int imm) {
 #define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
 
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and 16/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         __m256i *array,
-        __m256i vH,
-        int32_t t,
+        const __m256i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    _mm256_store_si256(array + (1LL*d*seglen+t), vH);
+    const int32_t cells = 16 / 4;
+    const int32_t seglenp = (seglen + cells - 1) / cells;
+    const __m256i vZero = _mm256_setzero_si256();
+    const __m256i vInsDiag = _mm256_set1_epi16(PARASAIL_INS | PARASAIL_DIAG);
+    const __m256i vDelDiag = _mm256_set1_epi16(PARASAIL_DEL | PARASAIL_DIAG);
+    const __m256i vInsE = _mm256_set1_epi16(PARASAIL_INS_E);
+    const __m256i vDelF = _mm256_set1_epi16(PARASAIL_DEL_F);
+    int32_t q = 0;
+    int32_t p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        __m256i vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            __m256i vT = _mm256_load_si256(pvT + q*cells + p);
+            __m256i vBit0 = _mm256_set1_epi16((int16_t)(1ULL << (4*p)));
+            __m256i vBit1 = _mm256_set1_epi16((int16_t)(1ULL << (4*p+1)));
+            __m256i vBit2 = _mm256_set1_epi16((int16_t)(1ULL << (4*p+2)));
+            __m256i vBit3 = _mm256_set1_epi16((int16_t)(1ULL << (4*p+3)));
+            vP = _mm256_or_si256(vP, _mm256_andnot_si256(
+                        _mm256_cmpeq_epi16(_mm256_and_si256(vT, vInsDiag), vZero), vBit0));
+            vP = _mm256_or_si256(vP, _mm256_andnot_si256(
+                        _mm256_cmpeq_epi16(_mm256_and_si256(vT, vDelDiag), vZero), vBit1));
+            vP = _mm256_or_si256(vP, _mm256_andnot_si256(
+                        _mm256_cmpeq_epi16(_mm256_and_si256(vT, vInsE), vZero), vBit2));
+            vP = _mm256_or_si256(vP, _mm256_andnot_si256(
+                        _mm256_cmpeq_epi16(_mm256_and_si256(vT, vDelF), vZero), vBit3));
+        }
+        _mm256_store_si256(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline __m256i arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         __m256i *array,
-        int32_t t,
+        const __m256i *pvT,
         int32_t seglen,
         int32_t d)
 {
-    return _mm256_load_si256(array + (1LL*d*seglen+t));
+    int32_t t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        _mm256_store_si256(array + (1LL*d*seglen+t), _mm256_load_si256(pvT + t));
+    }
 }
 
 #define FNAME parasail_sg_flags_trace_striped_avx2_256_16
@@ -108,6 +144,8 @@ parasail_result_t* PNAME(
     __m256i* restrict pvEaLoad = parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvHT = parasail_memalign___m256i(32, segLen);
     int16_t* const restrict boundary = parasail_memalign_int16_t(32, s2Len+1);
+    __m256i* restrict pvT = parasail_memalign___m256i(32, segLen);
+    __m256i* restrict pvTNext = parasail_memalign___m256i(32, segLen);
     __m256i vGapO = _mm256_set1_epi16(open);
     __m256i vGapE = _mm256_set1_epi16(gap);
     __m256i vNegInf = _mm256_set1_epi16(NEG_INF);
@@ -116,7 +154,10 @@ parasail_result_t* PNAME(
     __m256i vPosMask = _mm256_cmpeq_epi16(_mm256_set1_epi16(position),
             _mm256_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
     
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 32, sizeof(__m256i));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const int32_t segLenP = packed
+        ? (segLen + 16/4 - 1) / (16/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, 32, sizeof(__m256i));
     __m256i vTIns  = _mm256_set1_epi16(PARASAIL_INS);
     __m256i vTDel  = _mm256_set1_epi16(PARASAIL_DEL);
     __m256i vTDiag = _mm256_set1_epi16(PARASAIL_DIAG);
@@ -157,7 +198,7 @@ parasail_result_t* PNAME(
     }
 
     for (i=0; i<segLen; ++i) {
-        arr_store(result->trace->trace_table, vTDiagE, i, segLen, 0);
+        _mm256_store_si256(pvT + i, vTDiagE);
     }
 
     /* outer loop over database sequence */
@@ -204,7 +245,7 @@ parasail_result_t* PNAME(
             
 
             {
-                __m256i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                __m256i vTAll = _mm256_load_si256(pvT + i);
                 __m256i case1 = _mm256_cmpeq_epi16(vH, vH_dag);
                 __m256i case2 = _mm256_cmpeq_epi16(vH, vF);
                 __m256i vT = _mm256_blendv_epi8(
@@ -212,7 +253,7 @@ parasail_result_t* PNAME(
                         vTDiag, case1);
                 _mm256_store_si256(pvHT + i, vT);
                 vT = _mm256_or_si256(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i, segLen, j);
+                _mm256_store_si256(pvT + i, vT);
             }
 
             vEF_opn = _mm256_sub_epi16(vH, vGapO);
@@ -229,7 +270,7 @@ parasail_result_t* PNAME(
                 if (j+1<s2Len) {
                     __m256i cond = _mm256_cmpgt_epi16(vEF_opn, vEa_ext);
                     __m256i vT = _mm256_blendv_epi8(vTInsE, vTDiagE, cond);
-                    arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                    _mm256_store_si256(pvTNext + i, vT);
                 }
             }
 
@@ -237,11 +278,11 @@ parasail_result_t* PNAME(
             vF_ext = _mm256_sub_epi16(vF, vGapE);
             vF = _mm256_max_epi16(vEF_opn, vF_ext);
             if (i+1<segLen) {
-                __m256i vTAll = arr_load(result->trace->trace_table, i+1, segLen, j);
+                __m256i vTAll = _mm256_load_si256(pvT + i+1);
                 __m256i cond = _mm256_cmpgt_epi16(vEF_opn, vF_ext);
                 __m256i vT = _mm256_blendv_epi8(vTDelF, vTDiagF, cond);
                 vT = _mm256_or_si256(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i+1, segLen, j);
+                _mm256_store_si256(pvT + i+1, vT);
             }
 
             /* Load the next vH. */
@@ -283,22 +324,22 @@ parasail_result_t* PNAME(
                     case1 = _mm256_cmpeq_epi16(vH, vHp);
                     case2 = _mm256_cmpeq_epi16(vH, vF);
                     cond = _mm256_andnot_si256(case1,case2);
-                    vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    vTAll = _mm256_load_si256(pvT + i);
                     vT = _mm256_load_si256(pvHT + i);
                     vT = _mm256_blendv_epi8(vT, vTDel, cond);
                     _mm256_store_si256(pvHT + i, vT);
                     vTAll = _mm256_and_si256(vTAll, vTMask);
                     vTAll = _mm256_or_si256(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    _mm256_store_si256(pvT + i, vTAll);
                 }
                 /* Update vF value. */
                 {
-                    __m256i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    __m256i vTAll = _mm256_load_si256(pvT + i);
                     __m256i cond = _mm256_cmpgt_epi16(vEF_opn, vFa_ext);
                     __m256i vT = _mm256_blendv_epi8(vTDelF, vTDiagF, cond);
                     vTAll = _mm256_and_si256(vTAll, vFTMask);
                     vTAll = _mm256_or_si256(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    _mm256_store_si256(pvT + i, vTAll);
                 }
                 vEF_opn = _mm256_sub_epi16(vH, vGapO);
                 vF_ext = _mm256_sub_epi16(vF, vGapE);
@@ -310,7 +351,7 @@ parasail_result_t* PNAME(
                     if (j+1<s2Len) {
                         __m256i cond = _mm256_cmpgt_epi16(vEF_opn, vEa_ext);
                         __m256i vT = _mm256_blendv_epi8(vTInsE, vTDiagE, cond);
-                        arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                        _mm256_store_si256(pvTNext + i, vT);
                     }
                 }
                 if (! _mm256_movemask_epi8(
@@ -326,6 +367,16 @@ parasail_result_t* PNAME(
             }
         }
 end:
+        {
+            if (packed) {
+                arr_pack(result->trace->trace_table, pvT, segLen, j);
+            }
+            else {
+                arr_copy(result->trace->trace_table, pvT, segLen, j);
+            }
+            SWAP(pvT, pvTNext)
+        }
+
         {
             /* extract vector containing last value from the column */
             __m256i vCompare;
@@ -389,11 +440,15 @@ end:
     result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_STRIPED
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_16;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
     result->flag |= s1_beg ? PARASAIL_FLAG_SG_S1_BEG : 0;
     result->flag |= s1_end ? PARASAIL_FLAG_SG_S1_END : 0;
     result->flag |= s2_beg ? PARASAIL_FLAG_SG_S2_BEG : 0;
     result->flag |= s2_end ? PARASAIL_FLAG_SG_S2_END : 0;
 
+    parasail_free(pvTNext);
+    parasail_free(pvT);
     parasail_free(boundary);
     parasail_free(pvHT);
     parasail_free(pvEaLoad);
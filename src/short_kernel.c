@@ -0,0 +1,360 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Striped alignment for queries of at most SEGLEN segments.  The
+ * number of segments is a compile time constant, so the loops over the
+ * segments unroll completely and the H and E columns, the previous H
+ * column and the profile column of the current database residue stay
+ * in registers instead of going through pvHStore, pvHLoad and pvE.
+ * Only the query profile itself is kept in memory.
+ *
+ * Included once per algorithm and number of segments by
+ * short_template.c with one of SHORT_NW, SHORT_SG or SHORT_SW defined,
+ * and KNAME naming the function.  Results are those of the striped
+ * functions of the same width, saturation included, except that nw
+ * also checks for saturation at 16 and 32 bits.
+ */
+
+static parasail_result_t* KNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    const int32_t n = matrix->size;
+    const int32_t segWidth = LANES; /* number of values in vector unit */
+    const int32_t segLen = SEGLEN;
+    VEC * const restrict vProfile = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*n*SEGLEN);
+    /* initial values in, last or best column out */
+    VEC * const restrict pvColumn = (VEC*)parasail_memalign(sizeof(VEC), sizeof(VEC)*2*SEGLEN);
+    VEC vHStore[SEGLEN];
+    VEC vHLoad[SEGLEN];
+    VEC vE[SEGLEN];
+    const VEC vGapO = VSET1(open);
+    const VEC vGapE = VSET1(gap);
+#ifdef SHORT_SW
+    const INT bias = NEG_INF;
+    const INT maxp = POS_INF - (INT)(matrix->max + 1);
+    const VEC vBias = VSET1(bias);
+    VEC vMaxH = vBias;
+    VEC vMaxHUnit = vBias;
+    INT score = bias;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    int saturated = 0;
+#else
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (s1Len - 1) / segLen;
+    const INT NEG_LIMIT = (-open < matrix->min ?
+        NEG_INF + open : NEG_INF - matrix->min) + 1;
+    const INT POS_LIMIT = POS_INF - matrix->max - 1;
+    const VEC vNegLimit = VSET1(NEG_LIMIT);
+    const VEC vPosLimit = VSET1(POS_LIMIT);
+    VEC vSaturationCheckMin = vPosLimit;
+    VEC vSaturationCheckMax = vNegLimit;
+    INT score = NEG_LIMIT;
+    int32_t end_query = s1Len - 1;
+    int32_t end_ref = s2Len - 1;
+    /* the upper boundary of the current and the next column */
+    INT boundary = 0;
+    INT boundaryNext = 0;
+#endif
+    parasail_result_t *result = parasail_result_new();
+
+    /* the striped query profile */
+    {
+        INT *t = (INT*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<SEGLEN; ++i) {
+                int32_t segNum = 0;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    int32_t q = segNum*segLen + i;
+                    *t++ = (INT)(q >= s1Len ? 0 :
+                            matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[q]]]);
+                }
+            }
+        }
+    }
+
+#ifdef SHORT_SW
+    /* initialize H and E */
+    for (i=0; i<SEGLEN; ++i) {
+        vHStore[i] = vBias;
+        vE[i] = vBias;
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        VEC vF = vBias;
+        /* final segment of H shifted left by one lane */
+        VEC vH = VINSERT0(VSHIFT(vHStore[SEGLEN - 1]), bias);
+        const VEC *vP = vProfile + matrix->mapper[(unsigned char)s2[j]]*SEGLEN;
+
+        for (i=0; i<SEGLEN; ++i) {
+            vHLoad[i] = vHStore[i];
+        }
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<SEGLEN; ++i) {
+            vH = VADD(vH, VLOAD(vP + i));
+            vH = VMAX(vH, vBias);
+
+            /* Get max from vH, vE and vF. */
+            vH = VMAX(vH, vE[i]);
+            vH = VMAX(vH, vF);
+            vHStore[i] = vH;
+            vMaxH = VMAX(vH, vMaxH);
+
+            /* Update vE value. */
+            vH = VSUB(vH, vGapO);
+            vE[i] = VMAX(VSUB(vE[i], vGapE), vH);
+
+            /* Update vF value. */
+            vF = VSUB(vF, vGapE);
+            vF = VMAX(vF, vH);
+
+            vH = vHLoad[i];
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = VINSERT0(VSHIFT(vF), bias);
+            for (i=0; i<SEGLEN; ++i) {
+                vH = VMAX(vHStore[i], vF);
+                vHStore[i] = vH;
+                vMaxH = VMAX(vH, vMaxH);
+                vH = VSUB(vH, vGapO);
+                vF = VSUB(vF, vGapE);
+                if (!VANYGT(vF, vH)) goto end;
+            }
+        }
+end:
+        if (VANYGT(vMaxH, vMaxHUnit)) {
+            score = VHMAX(vMaxH);
+            /* if score has potential to overflow, abort early */
+            if (score > maxp) {
+                saturated = 1;
+                break;
+            }
+            vMaxHUnit = VSET1(score);
+            end_ref = j;
+            for (i=0; i<SEGLEN; ++i) {
+                VSTORE(pvColumn + i, vHStore[i]);
+            }
+        }
+    }
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        end_query = 0;
+        end_ref = 0;
+    }
+    else if (score > bias) {
+        /* Trace the alignment ending position on read. */
+        const INT *t = (const INT*)pvColumn;
+        const int32_t column_len = segLen * segWidth;
+        end_query = s1Len - 1;
+        for (i=0; i<column_len; ++i, ++t) {
+            if (*t == score) {
+                int32_t temp = i / segWidth + i % segWidth * segLen;
+                if (temp < end_query) {
+                    end_query = temp;
+                }
+            }
+        }
+    }
+
+    /* saturated scores are reported as the striped functions do */
+#if WIDTH == 32
+    result->score = saturated ? POS_INF : score - bias;
+#else
+    result->score = saturated ? POS_INF - bias : score - bias;
+#endif
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SW;
+#else
+    /* initialize H and E */
+    {
+        INT *h = (INT*)pvColumn;
+        INT *e = (INT*)(pvColumn + SEGLEN);
+        for (i=0; i<SEGLEN; ++i) {
+            int32_t segNum = 0;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+#ifdef SHORT_SG
+                int64_t tmp = 0;
+#else
+                int64_t tmp = -open-gap*(int64_t)(segNum*segLen+i);
+#endif
+                *h++ = tmp < NEG_INF ? NEG_INF : tmp;
+                tmp = tmp - open;
+                *e++ = tmp < NEG_INF ? NEG_INF : tmp;
+            }
+        }
+        for (i=0; i<SEGLEN; ++i) {
+            vHStore[i] = VLOAD(pvColumn + i);
+            vE[i] = VLOAD(pvColumn + SEGLEN + i);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        VEC vF = vNegLimit;
+        VEC vH;
+        const VEC *vP = vProfile + matrix->mapper[(unsigned char)s2[j]]*SEGLEN;
+        INT vFInsert;
+
+        /* the upper boundary of this column and the next */
+#ifdef SHORT_SG
+        boundaryNext = 0;
+        vFInsert = -open < NEG_INF ? NEG_INF : -open;
+#else
+        {
+            const int64_t tmp = -open-gap*(int64_t)j;
+            boundaryNext = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+        {
+            const int64_t tmp = (int64_t)boundaryNext - open;
+            vFInsert = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+#endif
+
+        /* final segment of H shifted left by one lane, inserting the
+         * upper boundary condition */
+        vH = VINSERT0(VSHIFT(vHStore[SEGLEN - 1]), boundary);
+        boundary = boundaryNext;
+
+        for (i=0; i<SEGLEN; ++i) {
+            vHLoad[i] = vHStore[i];
+        }
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<SEGLEN; ++i) {
+            vH = VADD(vH, VLOAD(vP + i));
+
+            /* Get max from vH, vE and vF. */
+            vH = VMAX(vH, vE[i]);
+            vH = VMAX(vH, vF);
+            vHStore[i] = vH;
+            vSaturationCheckMin = VMIN(vSaturationCheckMin, vH);
+            vSaturationCheckMax = VMAX(vSaturationCheckMax, vH);
+#ifdef SHORT_NW
+            /* the clamped boundary enters through E and F */
+            vSaturationCheckMin = VMIN(vSaturationCheckMin, vE[i]);
+            vSaturationCheckMin = VMIN(vSaturationCheckMin, vF);
+#endif
+
+            /* Update vE value. */
+            vH = VSUB(vH, vGapO);
+            vE[i] = VMAX(VSUB(vE[i], vGapE), vH);
+
+            /* Update vF value. */
+            vF = VSUB(vF, vGapE);
+            vF = VMAX(vF, vH);
+
+            vH = vHLoad[i];
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = VINSERT0(VSHIFT(vF), vFInsert);
+            for (i=0; i<SEGLEN; ++i) {
+                vH = VMAX(vHStore[i], vF);
+                vHStore[i] = vH;
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vH);
+                vSaturationCheckMax = VMAX(vSaturationCheckMax, vH);
+#ifdef SHORT_NW
+                vSaturationCheckMin = VMIN(vSaturationCheckMin, vF);
+#endif
+                vH = VSUB(vH, vGapO);
+                vF = VSUB(vF, vGapE);
+                if (!VANYGT(vF, vH)) goto end;
+            }
+        }
+end:
+#ifdef SHORT_SG
+        /* max of the last row over all columns; the segment is picked
+         * with constant indices so that H stays in registers */
+        {
+            INT h;
+            for (i=0; i<SEGLEN; ++i) {
+                if (i == offset) {
+                    VSTORE(pvColumn, vHStore[i]);
+                }
+            }
+            h = ((INT*)pvColumn)[position];
+            if (h > score) {
+                score = h;
+                end_ref = j;
+            }
+        }
+#else
+        {
+        }
+#endif
+    }
+
+    for (i=0; i<SEGLEN; ++i) {
+        VSTORE(pvColumn + i, vHStore[i]);
+    }
+
+#ifdef SHORT_SG
+    /* max of the last column */
+    {
+        const INT *t = (const INT*)pvColumn;
+        const int32_t column_len = segLen * segWidth;
+        for (i=0; i<column_len; ++i, ++t) {
+            int32_t temp = i / segWidth + i % segWidth * segLen;
+            if (temp >= s1Len) continue;
+            if (*t > score) {
+                score = *t;
+                end_query = temp;
+                end_ref = s2Len-1;
+            }
+            else if (*t == score && end_ref == s2Len-1 && temp < end_query) {
+                end_query = temp;
+            }
+        }
+    }
+#else
+    /* the last value of the last column */
+    score = ((INT*)pvColumn)[offset*segWidth + position];
+#endif
+
+    if (VANYGT(vNegLimit, vSaturationCheckMin)
+            || VANYGT(vSaturationCheckMax, vPosLimit)) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+#ifdef SHORT_SG
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_BEG | PARASAIL_FLAG_SG_S1_END
+        | PARASAIL_FLAG_SG_S2_BEG | PARASAIL_FLAG_SG_S2_END;
+#else
+    result->flag |= PARASAIL_FLAG_NW;
+#endif
+#endif
+    result->flag |= PARASAIL_FLAG_STRIPED | FLAG_BITS | FLAG_LANES;
+
+    parasail_free(pvColumn);
+    parasail_free(vProfile);
+
+    return result;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * SSE4.1 striped kernels for short queries, see short_kernel.c.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+static inline int hmax8(__m128i v)
+{
+    v = _mm_max_epi8(v, _mm_srli_si128(v, 8));
+    v = _mm_max_epi8(v, _mm_srli_si128(v, 4));
+    v = _mm_max_epi8(v, _mm_srli_si128(v, 2));
+    v = _mm_max_epi8(v, _mm_srli_si128(v, 1));
+    return (int8_t)_mm_extract_epi8(v, 0);
+}
+
+static inline int hmax16(__m128i v)
+{
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 8));
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 4));
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 2));
+    return (int16_t)_mm_extract_epi16(v, 0);
+}
+
+static inline int hmax32(__m128i v)
+{
+    v = _mm_max_epi32(v, _mm_srli_si128(v, 8));
+    v = _mm_max_epi32(v, _mm_srli_si128(v, 4));
+    return _mm_cvtsi128_si32(v);
+}
+
+#define VEC __m128i
+#define VLOAD(p) _mm_load_si128(p)
+#define VSTORE(p,v) _mm_store_si128(p, v)
+
+#define WIDTH 8
+#define LANES 16
+#define INT int8_t
+#define NEG_INF INT8_MIN
+#define POS_INF INT8_MAX
+#define VSET1(x) _mm_set1_epi8((int8_t)(x))
+#define VADD(a,b) _mm_adds_epi8(a, b)
+#define VSUB(a,b) _mm_subs_epi8(a, b)
+#define VMAX(a,b) _mm_max_epi8(a, b)
+#define VMIN(a,b) _mm_min_epi8(a, b)
+#define VANYGT(a,b) _mm_movemask_epi8(_mm_cmpgt_epi8(a, b))
+#define VSHIFT(v) _mm_slli_si128(v, 1)
+#define VINSERT0(v,x) _mm_insert_epi8(v, (int8_t)(x), 0)
+#define VHMAX(v) hmax8(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_8
+#define FLAG_LANES PARASAIL_FLAG_LANES_16
+#define SNAME(alg) parasail_##alg##_striped_short_sse41_128_8
+#define FNAME(alg) parasail_##alg##_striped_sse41_128_8
+#define ENAME parasail_short_sse41_128_8
+#include "short_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_INF
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VANYGT
+#undef VSHIFT
+#undef VINSERT0
+#undef VHMAX
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+#undef SNAME
+#undef FNAME
+
+#define WIDTH 16
+#define LANES 8
+#define INT int16_t
+#define NEG_INF INT16_MIN
+#define POS_INF INT16_MAX
+#define VSET1(x) _mm_set1_epi16((int16_t)(x))
+#define VADD(a,b) _mm_adds_epi16(a, b)
+#define VSUB(a,b) _mm_subs_epi16(a, b)
+#define VMAX(a,b) _mm_max_epi16(a, b)
+#define VMIN(a,b) _mm_min_epi16(a, b)
+#define VANYGT(a,b) _mm_movemask_epi8(_mm_cmpgt_epi16(a, b))
+#define VSHIFT(v) _mm_slli_si128(v, 2)
+#define VINSERT0(v,x) _mm_insert_epi16(v, (int16_t)(x), 0)
+#define VHMAX(v) hmax16(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_16
+#define FLAG_LANES PARASAIL_FLAG_LANES_8
+#define SNAME(alg) parasail_##alg##_striped_short_sse41_128_16
+#define FNAME(alg) parasail_##alg##_striped_sse41_128_16
+#define ENAME parasail_short_sse41_128_16
+#include "short_template.c"
+#undef WIDTH
+#undef LANES
+#undef INT
+#undef NEG_INF
+#undef POS_INF
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMAX
+#undef VMIN
+#undef VANYGT
+#undef VSHIFT
+#undef VINSERT0
+#undef VHMAX
+#undef FLAG_BITS
+#undef FLAG_LANES
+#undef ENAME
+#undef SNAME
+#undef FNAME
+
+#define WIDTH 32
+#define LANES 4
+#define INT int32_t
+#define NEG_INF (INT32_MIN/2)
+#define POS_INF INT32_MAX
+#define VSET1(x) _mm_set1_epi32(x)
+#define VADD(a,b) _mm_add_epi32(a, b)
+#define VSUB(a,b) _mm_sub_epi32(a, b)
+#define VMAX(a,b) _mm_max_epi32(a, b)
+#define VMIN(a,b) _mm_min_epi32(a, b)
+#define VANYGT(a,b) _mm_movemask_epi8(_mm_cmpgt_epi32(a, b))
+#define VSHIFT(v) _mm_slli_si128(v, 4)
+#define VINSERT0(v,x) _mm_insert_epi32(v, x, 0)
+#define VHMAX(v) hmax32(v)
+#define FLAG_BITS PARASAIL_FLAG_BITS_32
+#define FLAG_LANES PARASAIL_FLAG_LANES_4
+#define SNAME(alg) parasail_##alg##_striped_short_sse41_128_32
+#define FNAME(alg) parasail_##alg##_striped_sse41_128_32
+#define ENAME parasail_short_sse41_128_32
+#include "short_template.c"
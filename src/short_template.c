@@ -0,0 +1,153 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Instantiates the short query kernels for one vector width, one per
+ * algorithm and number of segments from 1 to 4.  The including file
+ * defines the vector operations for that width, ENAME, the prefix of
+ * the kernel names, and SNAME(alg) and FNAME(alg), the names of the
+ * selecting function and of the striped function it falls back to.
+ */
+
+#ifndef SHORT_CONCAT
+#define SHORT_CONCAT_(a,b) a##b
+#define SHORT_CONCAT(a,b) SHORT_CONCAT_(a,b)
+#endif
+
+/* the 8-bit striped nw functions report every result as saturated, so
+ * the dispatchers keep them and there is no 8-bit nw kernel here */
+#if WIDTH != 8
+#define SHORT_NW
+#define SEGLEN 1
+#define KNAME SHORT_CONCAT(ENAME, _nw_1)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_NW
+
+#define SHORT_NW
+#define SEGLEN 2
+#define KNAME SHORT_CONCAT(ENAME, _nw_2)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_NW
+
+#define SHORT_NW
+#define SEGLEN 3
+#define KNAME SHORT_CONCAT(ENAME, _nw_3)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_NW
+
+#define SHORT_NW
+#define SEGLEN 4
+#define KNAME SHORT_CONCAT(ENAME, _nw_4)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_NW
+#endif
+
+#define SHORT_SG
+#define SEGLEN 1
+#define KNAME SHORT_CONCAT(ENAME, _sg_1)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_SG
+
+#define SHORT_SG
+#define SEGLEN 2
+#define KNAME SHORT_CONCAT(ENAME, _sg_2)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_SG
+
+#define SHORT_SG
+#define SEGLEN 3
+#define KNAME SHORT_CONCAT(ENAME, _sg_3)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_SG
+
+#define SHORT_SG
+#define SEGLEN 4
+#define KNAME SHORT_CONCAT(ENAME, _sg_4)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_SG
+
+#define SHORT_SW
+#define SEGLEN 1
+#define KNAME SHORT_CONCAT(ENAME, _sw_1)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_SW
+
+#define SHORT_SW
+#define SEGLEN 2
+#define KNAME SHORT_CONCAT(ENAME, _sw_2)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_SW
+
+#define SHORT_SW
+#define SEGLEN 3
+#define KNAME SHORT_CONCAT(ENAME, _sw_3)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_SW
+
+#define SHORT_SW
+#define SEGLEN 4
+#define KNAME SHORT_CONCAT(ENAME, _sw_4)
+#include "short_kernel.c"
+#undef KNAME
+#undef SEGLEN
+#undef SHORT_SW
+
+/* queries of up to four segments use the kernels above, longer ones
+ * the striped function */
+#define SHORT_SELECT(ALG)                                               \
+parasail_result_t* SNAME(ALG)(                                          \
+        const char * const restrict s1, const int s1Len,                \
+        const char * const restrict s2, const int s2Len,                \
+        const int open, const int gap,                                  \
+        const parasail_matrix_t *matrix)                                \
+{                                                                       \
+    switch ((s1Len + LANES - 1) / LANES) {                              \
+        case 1:                                                         \
+            return SHORT_CONCAT(ENAME, _##ALG##_1)(                     \
+                    s1, s1Len, s2, s2Len, open, gap, matrix);           \
+        case 2:                                                         \
+            return SHORT_CONCAT(ENAME, _##ALG##_2)(                     \
+                    s1, s1Len, s2, s2Len, open, gap, matrix);           \
+        case 3:                                                         \
+            return SHORT_CONCAT(ENAME, _##ALG##_3)(                     \
+                    s1, s1Len, s2, s2Len, open, gap, matrix);           \
+        case 4:                                                         \
+            return SHORT_CONCAT(ENAME, _##ALG##_4)(                     \
+                    s1, s1Len, s2, s2Len, open, gap, matrix);           \
+        default:                                                        \
+            return FNAME(ALG)(s1, s1Len, s2, s2Len, open, gap, matrix); \
+    }                                                                   \
+}
+
+#if WIDTH != 8
+SHORT_SELECT(nw)
+#endif
+SHORT_SELECT(sg)
+SHORT_SELECT(sw)
+
+#undef SHORT_SELECT
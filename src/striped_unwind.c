@@ -1,11 +1,13 @@
 #if defined(T)
 
 #define D CONCAT3(int, T, _t)
+#define U CONCAT3(uint, T, _t)
 
 static inline int* CONCAT(parasail_striped_unwind_, T) (
         int lena,
         int lenb,
         int segWidth,
+        int packed,
         void *array_)
 {
     int i;
@@ -18,7 +20,19 @@ static inline int* CONCAT(parasail_striped_unwind_, T) (
         for (i=0; i<column_len; ++i) {
             int32_t i_unwound = i / segWidth + i % segWidth * segLen;
             if (i_unwound < lena) {
-                ret[i_unwound*lenb + j] = (int)array[j*column_len + i];
+                if (packed) {
+                    /* T/4 consecutive segments share one element */
+                    const int32_t cells = T / 4;
+                    const int32_t segLenP = (segLen + cells - 1) / cells;
+                    const int32_t seg = i / segWidth;
+                    U cell = (U)array[j*segLenP*segWidth
+                        + seg/cells*segWidth + i % segWidth];
+                    ret[i_unwound*lenb + j] = parasail_trace_unpack(
+                            (int)((cell >> (4*(seg%cells))) & 15));
+                }
+                else {
+                    ret[i_unwound*lenb + j] = (int)array[j*column_len + i];
+                }
             }
         }
     }
@@ -27,6 +41,7 @@ static inline int* CONCAT(parasail_striped_unwind_, T) (
 
 
 #undef D
+#undef U
 
 #else
 
@@ -70,6 +85,7 @@ int* parasail_striped_unwind(
         void *array)
 {
     int *ret = NULL;
+    int packed = (PARASAIL_TRACE_FORMAT_PACKED == result->trace->format);
 
     assert((result->flag & PARASAIL_FLAG_STRIPED)
             || result->flag & PARASAIL_FLAG_SCAN);
@@ -79,16 +95,16 @@ int* parasail_striped_unwind(
     }
     else if (result->flag & PARASAIL_FLAG_LANES_2) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
-            ret = parasail_striped_unwind_8(lena, lenb, 2, array);
+            ret = parasail_striped_unwind_8(lena, lenb, 2, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            ret = parasail_striped_unwind_16(lena, lenb, 2, array);
+            ret = parasail_striped_unwind_16(lena, lenb, 2, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            ret = parasail_striped_unwind_32(lena, lenb, 2, array);
+            ret = parasail_striped_unwind_32(lena, lenb, 2, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            ret = parasail_striped_unwind_64(lena, lenb, 2, array);
+            ret = parasail_striped_unwind_64(lena, lenb, 2, packed, array);
         }
         else {
             assert(0);
@@ -96,16 +112,16 @@ int* parasail_striped_unwind(
     }
     else if (result->flag & PARASAIL_FLAG_LANES_4) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
-            ret = parasail_striped_unwind_8(lena, lenb, 4, array);
+            ret = parasail_striped_unwind_8(lena, lenb, 4, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            ret = parasail_striped_unwind_16(lena, lenb, 4, array);
+            ret = parasail_striped_unwind_16(lena, lenb, 4, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            ret = parasail_striped_unwind_32(lena, lenb, 4, array);
+            ret = parasail_striped_unwind_32(lena, lenb, 4, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            ret = parasail_striped_unwind_64(lena, lenb, 4, array);
+            ret = parasail_striped_unwind_64(lena, lenb, 4, packed, array);
         }
         else {
             assert(0);
@@ -113,16 +129,16 @@ int* parasail_striped_unwind(
     }
     else if (result->flag & PARASAIL_FLAG_LANES_8) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
-            ret = parasail_striped_unwind_8(lena, lenb, 8, array);
+            ret = parasail_striped_unwind_8(lena, lenb, 8, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            ret = parasail_striped_unwind_16(lena, lenb, 8, array);
+            ret = parasail_striped_unwind_16(lena, lenb, 8, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            ret = parasail_striped_unwind_32(lena, lenb, 8, array);
+            ret = parasail_striped_unwind_32(lena, lenb, 8, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            ret = parasail_striped_unwind_64(lena, lenb, 8, array);
+            ret = parasail_striped_unwind_64(lena, lenb, 8, packed, array);
         }
         else {
             assert(0);
@@ -130,16 +146,16 @@ int* parasail_striped_unwind(
     }
     else if (result->flag & PARASAIL_FLAG_LANES_16) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
-            ret = parasail_striped_unwind_8(lena, lenb, 16, array);
+            ret = parasail_striped_unwind_8(lena, lenb, 16, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            ret = parasail_striped_unwind_16(lena, lenb, 16, array);
+            ret = parasail_striped_unwind_16(lena, lenb, 16, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            ret = parasail_striped_unwind_32(lena, lenb, 16, array);
+            ret = parasail_striped_unwind_32(lena, lenb, 16, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            ret = parasail_striped_unwind_64(lena, lenb, 16, array);
+            ret = parasail_striped_unwind_64(lena, lenb, 16, packed, array);
         }
         else {
             assert(0);
@@ -147,16 +163,16 @@ int* parasail_striped_unwind(
     }
     else if (result->flag & PARASAIL_FLAG_LANES_32) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
-            ret = parasail_striped_unwind_8(lena, lenb, 32, array);
+            ret = parasail_striped_unwind_8(lena, lenb, 32, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            ret = parasail_striped_unwind_16(lena, lenb, 32, array);
+            ret = parasail_striped_unwind_16(lena, lenb, 32, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            ret = parasail_striped_unwind_32(lena, lenb, 32, array);
+            ret = parasail_striped_unwind_32(lena, lenb, 32, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            ret = parasail_striped_unwind_64(lena, lenb, 32, array);
+            ret = parasail_striped_unwind_64(lena, lenb, 32, packed, array);
         }
         else {
             assert(0);
@@ -164,16 +180,16 @@ int* parasail_striped_unwind(
     }
     else if (result->flag & PARASAIL_FLAG_LANES_64) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
-            ret = parasail_striped_unwind_8(lena, lenb, 64, array);
+            ret = parasail_striped_unwind_8(lena, lenb, 64, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            ret = parasail_striped_unwind_16(lena, lenb, 64, array);
+            ret = parasail_striped_unwind_16(lena, lenb, 64, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            ret = parasail_striped_unwind_32(lena, lenb, 64, array);
+            ret = parasail_striped_unwind_32(lena, lenb, 64, packed, array);
         }
         else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            ret = parasail_striped_unwind_64(lena, lenb, 64, array);
+            ret = parasail_striped_unwind_64(lena, lenb, 64, packed, array);
         }
         else {
             assert(0);
@@ -0,0 +1,316 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+
+/* forward declare the dispatcher functions */
+parasail_batch_function_t parasail_sw_batch_32_dispatcher;
+parasail_batch_function_t parasail_sw_batch_16_dispatcher;
+parasail_batch_function_t parasail_sw_batch_8_dispatcher;
+
+/* declare and initialize the pointer to the dispatcher function */
+parasail_batch_function_t * parasail_sw_batch_32_pointer = parasail_sw_batch_32_dispatcher;
+parasail_batch_function_t * parasail_sw_batch_16_pointer = parasail_sw_batch_16_dispatcher;
+parasail_batch_function_t * parasail_sw_batch_8_pointer = parasail_sw_batch_8_dispatcher;
+
+/* serial fallback when no inter-sequence kernel is available */
+static void parasail_sw_batch_serial(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    int i = 0;
+    for (i=0; i<count; ++i) {
+        results[i] = parasail_sw(s1, s1Len, s2s[i], s2Lens[i], open, gap, matrix);
+    }
+}
+
+/* dispatcher function implementations */
+
+void parasail_sw_batch_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_avx512_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_sse2_128_32;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_altivec_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_serial;
+    }
+    parasail_sw_batch_32_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+}
+
+void parasail_sw_batch_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_avx512_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_sse2_128_16;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_altivec_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_serial;
+    }
+    parasail_sw_batch_16_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+}
+
+void parasail_sw_batch_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_serial;
+    }
+    parasail_sw_batch_8_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+}
+
+/* implement the wrapper functions */
+
+void parasail_sw_batch_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    parasail_sw_batch_32_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+}
+
+void parasail_sw_batch_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    parasail_sw_batch_16_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+}
+
+void parasail_sw_batch_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    parasail_sw_batch_8_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+}
+
+/* Run the whole batch at 8 bits, then only the saturated database
+ * sequences again at 16 bits, and any still saturated at 32 bits.  A
+ * result is only replaced once its retry produced one.  Without memory
+ * to gather the saturated sequences, each is retried on its own. */
+void parasail_sw_batch_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    parasail_batch_function_t * const retry[2] = {
+        parasail_sw_batch_16, parasail_sw_batch_32};
+    int i = 0;
+    int j = 0;
+    int k = 0;
+    int w = 0;
+    int sat_count = 0;
+    int *sat_index = NULL;
+    const char **sat_s2s = NULL;
+    int *sat_s2Lens = NULL;
+    parasail_result_t **sat_results = NULL;
+
+    parasail_sw_batch_8(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+
+    for (i=0; i<count; ++i) {
+        if (NULL != results[i] && parasail_result_is_saturated(results[i])) {
+            ++sat_count;
+        }
+    }
+    if (0 == sat_count) {
+        return;
+    }
+
+    sat_index = (int*)malloc(sizeof(int)*sat_count);
+    sat_s2s = (const char**)malloc(sizeof(const char*)*sat_count);
+    sat_s2Lens = (int*)malloc(sizeof(int)*sat_count);
+    sat_results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*sat_count);
+    if (NULL == sat_index || NULL == sat_s2s
+            || NULL == sat_s2Lens || NULL == sat_results) {
+        free(sat_results);
+        free(sat_s2Lens);
+        free(sat_s2s);
+        free(sat_index);
+        for (i=0; i<count; ++i) {
+            for (w=0; w<2; ++w) {
+                parasail_result_t *result = NULL;
+                if (NULL == results[i]
+                        || !parasail_result_is_saturated(results[i])) {
+                    break;
+                }
+                retry[w](s1, s1Len, s2s+i, s2Lens+i, 1,
+                        open, gap, matrix, &result);
+                if (NULL != result) {
+                    parasail_result_free(results[i]);
+                    results[i] = result;
+                }
+            }
+        }
+        return;
+    }
+
+    for (i=0,k=0; i<count; ++i) {
+        if (NULL != results[i] && parasail_result_is_saturated(results[i])) {
+            sat_index[k] = i;
+            sat_s2s[k] = s2s[i];
+            sat_s2Lens[k] = s2Lens[i];
+            ++k;
+        }
+    }
+
+    for (w=0; w<2 && sat_count>0; ++w) {
+        retry[w](s1, s1Len, sat_s2s, sat_s2Lens, sat_count,
+                open, gap, matrix, sat_results);
+        /* keep only the sequences that are still saturated */
+        for (k=0,j=0; k<sat_count; ++k) {
+            i = sat_index[k];
+            if (NULL != sat_results[k]) {
+                parasail_result_free(results[i]);
+                results[i] = sat_results[k];
+            }
+            if (parasail_result_is_saturated(results[i])) {
+                sat_index[j] = i;
+                sat_s2s[j] = s2s[i];
+                sat_s2Lens[j] = s2Lens[i];
+                ++j;
+            }
+        }
+        sat_count = j;
+    }
+
+    free(sat_results);
+    free(sat_s2Lens);
+    free(sat_s2s);
+    free(sat_index);
+}
\ No newline at end of file
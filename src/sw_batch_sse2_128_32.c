@@ -0,0 +1,258 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Inter-sequence local alignment, one database sequence per vector
+ * lane, after the approach used by SWIPE (Rognes, 2011).  The query is
+ * walked row by row while each lane walks its own database sequence.
+ * When a lane reaches the end of its database sequence, its score is
+ * retired and the lane is refilled with the next database sequence.
+ *
+ * The 8- and 16-bit kernels keep scores relative to a bias at the
+ * bottom of the range so that the saturating add also clamps local
+ * scores at zero; the 32-bit kernels clamp at zero with a max().  The
+ * end positions are those of parasail_sw: the first column, and within
+ * it the first row, holding the maximum.  A column is only searched for
+ * its row when it raised its lane's maximum.  Saturated results report
+ * end positions of 0.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_sse.h"
+
+
+static inline __m128i _mm_max_epi32_rpl(__m128i a, __m128i b) {
+    __m128i mask = _mm_cmpgt_epi32(a, b);
+    a = _mm_and_si128(a, mask);
+    b = _mm_andnot_si128(mask, b);
+    return _mm_or_si128(a, b);
+}
+
+static inline __m128i _mm_min_epi32_rpl(__m128i a, __m128i b) {
+    __m128i mask = _mm_cmpgt_epi32(b, a);
+    a = _mm_and_si128(a, mask);
+    b = _mm_andnot_si128(mask, b);
+    return _mm_or_si128(a, b);
+}
+
+
+static inline parasail_result_t* batch_result(
+        int32_t score, int32_t maxp, int32_t bias,
+        int end_query, int end_ref)
+{
+    parasail_result_t *result = parasail_result_new();
+    if (score > maxp) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT32_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+    result->score = score - bias;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SW
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_4;
+    return result;
+}
+
+void parasail_sw_batch_sse2_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    int32_t i = 0;
+    int32_t a = 0;
+    int32_t lane = 0;
+    int32_t next = 0;
+    const int32_t n = matrix->size;
+    const int32_t segWidth = 4; /* number of values in vector unit */
+    const int32_t rows = s1Len > 0 ? s1Len : 1;
+    int32_t * const restrict s1Map = parasail_memalign_int32_t(16, rows);
+    int32_t * const restrict matrixT = parasail_memalign_int32_t(16, n*n);
+    __m128i* const restrict vProfile = parasail_memalign___m128i(16, n);
+    int32_t * const restrict profile = (int32_t*)vProfile;
+    __m128i* const restrict pvH = parasail_memalign___m128i(16, rows);
+    __m128i* const restrict pvE = parasail_memalign___m128i(16, rows);
+    const int32_t * const H = (const int32_t*)pvH;
+    /* lane views of the running maximum, the refill limit and the
+     * maximum before the current column */
+    __m128i* const pvLanes = parasail_memalign___m128i(16, 3);
+    int32_t * const maxLanes = (int32_t*)(pvLanes + 0);
+    int32_t * const limitLanes = (int32_t*)(pvLanes + 1);
+    int32_t * const prevLanes = (int32_t*)(pvLanes + 2);
+    int32_t seq[4];
+    int32_t pos[4];
+    int32_t fresh[4];
+    int32_t endQuery[4];
+    int32_t endRef[4];
+    __m128i vGapO = _mm_set1_epi32(open);
+    __m128i vGapE = _mm_set1_epi32(gap);
+    int32_t bias = 0;
+    __m128i vBias = _mm_set1_epi32(bias);
+    __m128i vMaxH = vBias;
+    int32_t maxp = INT32_MAX - (int32_t)(matrix->max+1);
+
+    /* map the query once; transpose the matrix so that a database
+     * residue's column of scores is contiguous */
+    for (i=0; i<s1Len; ++i) {
+        s1Map[i] = matrix->mapper[(unsigned char)s1[i]];
+    }
+    for (a=0; a<n; ++a) {
+        for (i=0; i<n; ++i) {
+            matrixT[a*n + i] = (int32_t)matrix->matrix[i*n + a];
+        }
+    }
+
+    /* initialize H and E; lanes start out idle */
+    parasail_memset___m128i(pvH, vBias, rows);
+    parasail_memset___m128i(pvE, vBias, rows);
+    for (lane=0; lane<segWidth; ++lane) {
+        seq[lane] = -1;
+        pos[lane] = 0;
+        fresh[lane] = 0;
+        endQuery[lane] = 0;
+        endRef[lane] = 0;
+    }
+
+    /* outer loop over database columns, one per lane */
+    for (;;) {
+        int active = 0;
+        int refill = 0;
+
+        /* retire lanes whose database sequence is finished and
+         * refill them with the next database sequence */
+        _mm_store_si128(pvLanes + 0, vMaxH);
+        for (lane=0; lane<segWidth; ++lane) {
+            limitLanes[lane] = INT32_MAX;
+            if (seq[lane] >= 0 && pos[lane] == s2Lens[seq[lane]]) {
+                results[seq[lane]] = batch_result(maxLanes[lane], maxp,
+                        bias, endQuery[lane], endRef[lane]);
+                seq[lane] = -1;
+            }
+            if (seq[lane] < 0) {
+                while (next < count && s2Lens[next] <= 0) {
+                    results[next] = batch_result(bias, maxp, bias, s1Len, 0);
+                    ++next;
+                }
+                if (next < count) {
+                    seq[lane] = next++;
+                    pos[lane] = 0;
+                    fresh[lane] = 1;
+                    endQuery[lane] = s1Len;
+                    endRef[lane] = s2Lens[seq[lane]];
+                    maxLanes[lane] = bias;
+                    limitLanes[lane] = bias;
+                    refill = 1;
+                }
+            }
+            if (seq[lane] >= 0) {
+                active = 1;
+            }
+        }
+        if (!active) {
+            break;
+        }
+
+        /* zero the columns of refilled lanes; all values are bounded
+         * below by the bias so a min() against it is a masked reset */
+        if (refill) {
+            __m128i vLimit = _mm_load_si128(pvLanes + 1);
+            vMaxH = _mm_load_si128(pvLanes + 0);
+            for (i=0; i<s1Len; ++i) {
+                _mm_store_si128(pvH + i,
+                        _mm_min_epi32_rpl(_mm_load_si128(pvH + i), vLimit));
+                _mm_store_si128(pvE + i,
+                        _mm_min_epi32_rpl(_mm_load_si128(pvE + i), vLimit));
+            }
+        }
+
+        /* gather the scores of each lane's current database residue */
+        for (lane=0; lane<segWidth; ++lane) {
+            if (seq[lane] >= 0) {
+                const int32_t *column = matrixT + n*matrix->mapper[
+                    (unsigned char)s2s[seq[lane]][pos[lane]]];
+                for (a=0; a<n; ++a) {
+                    profile[a*segWidth + lane] = column[a];
+                }
+                ++pos[lane];
+            }
+            else {
+                for (a=0; a<n; ++a) {
+                    profile[a*segWidth + lane] = 0;
+                }
+            }
+        }
+
+        /* inner loop to process the query sequence */
+        {
+            __m128i vPrev = vMaxH;
+            __m128i vHDiag = vBias;
+            __m128i vF = vBias;
+            for (i=0; i<s1Len; ++i) {
+                __m128i vH;
+                __m128i vHLeft = _mm_load_si128(pvH + i);
+                __m128i vE = _mm_load_si128(pvE + i);
+
+                vH = _mm_max_epi32_rpl(_mm_add_epi32(vHDiag, _mm_load_si128(vProfile + s1Map[i])), vBias);
+                vH = _mm_max_epi32_rpl(vH, vE);
+                vH = _mm_max_epi32_rpl(vH, vF);
+                _mm_store_si128(pvH + i, vH);
+                vMaxH = _mm_max_epi32_rpl(vMaxH, vH);
+                vHDiag = vHLeft;
+
+                /* Update vE and vF values. */
+                vH = _mm_sub_epi32(vH, vGapO);
+                vE = _mm_sub_epi32(vE, vGapE);
+                vE = _mm_max_epi32_rpl(vE, vH);
+                _mm_store_si128(pvE + i, vE);
+                vF = _mm_sub_epi32(vF, vGapE);
+                vF = _mm_max_epi32_rpl(vF, vH);
+            }
+
+            /* a lane whose maximum rose in this column ends there, at
+             * the first row holding the new maximum */
+            if (refill || _mm_movemask_epi8(_mm_cmpgt_epi32(vMaxH, vPrev))) {
+                _mm_store_si128(pvLanes + 0, vMaxH);
+                _mm_store_si128(pvLanes + 2, vPrev);
+                for (lane=0; lane<segWidth; ++lane) {
+                    if (seq[lane] < 0
+                            || !(fresh[lane] || maxLanes[lane] > prevLanes[lane])) {
+                        continue;
+                    }
+                    fresh[lane] = 0;
+                    for (i=0; i<s1Len; ++i) {
+                        if (H[i*segWidth + lane] == maxLanes[lane]) {
+                            endQuery[lane] = i;
+                            endRef[lane] = pos[lane] - 1;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    parasail_free(pvLanes);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(vProfile);
+    parasail_free(matrixT);
+    parasail_free(s1Map);
+}
+
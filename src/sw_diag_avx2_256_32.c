@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -323,10 +324,16 @@ parasail_result_t* FNAME(
 
     /* alignment ending position */
     {
-        int32_t *t = (int32_t*)&vMaxH;
-        int32_t *i = (int32_t*)&vEndI;
-        int32_t *j = (int32_t*)&vEndJ;
+        int32_t aMaxH[8];
+        int32_t aEndI[8];
+        int32_t aEndJ[8];
+        int32_t *t = aMaxH;
+        int32_t *i = aEndI;
+        int32_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxH, &vMaxH, sizeof(aMaxH));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++t, ++i, ++j) {
             if (*t > score) {
                 score = *t;
@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -317,10 +318,16 @@ parasail_result_t* FNAME(
 
     /* alignment ending position */
     {
-        int64_t *t = (int64_t*)&vMaxH;
-        int64_t *i = (int64_t*)&vEndI;
-        int64_t *j = (int64_t*)&vEndJ;
+        int64_t aMaxH[4];
+        int64_t aEndI[4];
+        int64_t aEndJ[4];
+        int64_t *t = aMaxH;
+        int64_t *i = aEndI;
+        int64_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxH, &vMaxH, sizeof(aMaxH));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++t, ++i, ++j) {
             if (*t > score) {
                 score = *t;
@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 
 
@@ -374,13 +375,25 @@ parasail_result_t* FNAME(
 
     /* alignment ending position */
     {
-        int64_t *t = (int64_t*)&vMaxH;
-        int64_t *m = (int64_t*)&vMaxM;
-        int64_t *s = (int64_t*)&vMaxS;
-        int64_t *l = (int64_t*)&vMaxL;
-        int64_t *i = (int64_t*)&vEndI;
-        int64_t *j = (int64_t*)&vEndJ;
+        int64_t aMaxH[2];
+        int64_t aMaxM[2];
+        int64_t aMaxS[2];
+        int64_t aMaxL[2];
+        int64_t aEndI[2];
+        int64_t aEndJ[2];
+        int64_t *t = aMaxH;
+        int64_t *m = aMaxM;
+        int64_t *s = aMaxS;
+        int64_t *l = aMaxL;
+        int64_t *i = aEndI;
+        int64_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxH, &vMaxH, sizeof(aMaxH));
+        memcpy(aMaxM, &vMaxM, sizeof(aMaxM));
+        memcpy(aMaxS, &vMaxS, sizeof(aMaxS));
+        memcpy(aMaxL, &vMaxL, sizeof(aMaxL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++t, ++m, ++s, ++l, ++i, ++j) {
             if (*t > score) {
                 score = *t;
@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -567,13 +568,25 @@ parasail_result_t* FNAME(
 
     /* alignment ending position */
     {
-        int16_t *t = (int16_t*)&vMaxH;
-        int16_t *m = (int16_t*)&vMaxM;
-        int16_t *s = (int16_t*)&vMaxS;
-        int16_t *l = (int16_t*)&vMaxL;
-        int16_t *i = (int16_t*)&vEndI;
-        int16_t *j = (int16_t*)&vEndJ;
+        int16_t aMaxH[16];
+        int16_t aMaxM[16];
+        int16_t aMaxS[16];
+        int16_t aMaxL[16];
+        int16_t aEndI[16];
+        int16_t aEndJ[16];
+        int16_t *t = aMaxH;
+        int16_t *m = aMaxM;
+        int16_t *s = aMaxS;
+        int16_t *l = aMaxL;
+        int16_t *i = aEndI;
+        int16_t *j = aEndJ;
         int32_t k;
+        memcpy(aMaxH, &vMaxH, sizeof(aMaxH));
+        memcpy(aMaxM, &vMaxM, sizeof(aMaxM));
+        memcpy(aMaxS, &vMaxS, sizeof(aMaxS));
+        memcpy(aMaxL, &vMaxL, sizeof(aMaxL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++t, ++m, ++s, ++l, ++i, ++j) {
             if (*t > score) {
                 score = *t;
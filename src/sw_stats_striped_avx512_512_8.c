@@ -0,0 +1,773 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define FASTSTATS
+
+#define SWAP(A,B) { __m512i* tmp = A; A = B; B = tmp; }
+#define SWAP3(A,B,C) { __m512i* tmp = A; A = B; B = C; C = tmp; }
+
+#define NEG_INF INT8_MIN
+
+#define _mm512_cmpeq_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a,b))
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_cmpgt_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(a,b))
+
+#define _mm512_extract_epi8_rpl(a,imm) (int8_t)_mm_extract_epi8(_mm512_extracti32x4_epi32(a, (imm)>>4), (imm)&15)
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+static inline int8_t _mm512_hmax_epi8_rpl(__m512i a) {
+    __m256i b = _mm256_max_epi8(_mm512_castsi512_si256(a), _mm512_extracti64x4_epi64(a, 1));
+    __m128i c = _mm_max_epi8(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 8));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 4));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 2));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 1));
+    return (int8_t)_mm_extract_epi8(c, 0);
+}
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store(
+        int *array,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        int32_t bias)
+{
+    array[1LL*( 0*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  0) - bias;
+    array[1LL*( 1*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  1) - bias;
+    array[1LL*( 2*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  2) - bias;
+    array[1LL*( 3*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  3) - bias;
+    array[1LL*( 4*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  4) - bias;
+    array[1LL*( 5*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  5) - bias;
+    array[1LL*( 6*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  6) - bias;
+    array[1LL*( 7*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  7) - bias;
+    array[1LL*( 8*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  8) - bias;
+    array[1LL*( 9*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  9) - bias;
+    array[1LL*(10*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 10) - bias;
+    array[1LL*(11*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 11) - bias;
+    array[1LL*(12*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 12) - bias;
+    array[1LL*(13*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 13) - bias;
+    array[1LL*(14*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 14) - bias;
+    array[1LL*(15*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 15) - bias;
+    array[1LL*(16*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 16) - bias;
+    array[1LL*(17*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 17) - bias;
+    array[1LL*(18*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 18) - bias;
+    array[1LL*(19*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 19) - bias;
+    array[1LL*(20*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 20) - bias;
+    array[1LL*(21*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 21) - bias;
+    array[1LL*(22*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 22) - bias;
+    array[1LL*(23*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 23) - bias;
+    array[1LL*(24*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 24) - bias;
+    array[1LL*(25*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 25) - bias;
+    array[1LL*(26*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 26) - bias;
+    array[1LL*(27*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 27) - bias;
+    array[1LL*(28*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 28) - bias;
+    array[1LL*(29*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 29) - bias;
+    array[1LL*(30*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 30) - bias;
+    array[1LL*(31*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 31) - bias;
+    array[1LL*(32*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 32) - bias;
+    array[1LL*(33*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 33) - bias;
+    array[1LL*(34*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 34) - bias;
+    array[1LL*(35*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 35) - bias;
+    array[1LL*(36*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 36) - bias;
+    array[1LL*(37*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 37) - bias;
+    array[1LL*(38*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 38) - bias;
+    array[1LL*(39*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 39) - bias;
+    array[1LL*(40*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 40) - bias;
+    array[1LL*(41*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 41) - bias;
+    array[1LL*(42*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 42) - bias;
+    array[1LL*(43*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 43) - bias;
+    array[1LL*(44*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 44) - bias;
+    array[1LL*(45*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 45) - bias;
+    array[1LL*(46*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 46) - bias;
+    array[1LL*(47*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 47) - bias;
+    array[1LL*(48*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 48) - bias;
+    array[1LL*(49*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 49) - bias;
+    array[1LL*(50*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 50) - bias;
+    array[1LL*(51*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 51) - bias;
+    array[1LL*(52*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 52) - bias;
+    array[1LL*(53*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 53) - bias;
+    array[1LL*(54*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 54) - bias;
+    array[1LL*(55*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 55) - bias;
+    array[1LL*(56*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 56) - bias;
+    array[1LL*(57*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 57) - bias;
+    array[1LL*(58*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 58) - bias;
+    array[1LL*(59*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 59) - bias;
+    array[1LL*(60*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 60) - bias;
+    array[1LL*(61*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 61) - bias;
+    array[1LL*(62*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 62) - bias;
+    array[1LL*(63*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 63) - bias;
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t bias)
+{
+    col[ 0*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  0) - bias;
+    col[ 1*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  1) - bias;
+    col[ 2*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  2) - bias;
+    col[ 3*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  3) - bias;
+    col[ 4*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  4) - bias;
+    col[ 5*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  5) - bias;
+    col[ 6*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  6) - bias;
+    col[ 7*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  7) - bias;
+    col[ 8*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  8) - bias;
+    col[ 9*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  9) - bias;
+    col[10*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 10) - bias;
+    col[11*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 11) - bias;
+    col[12*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 12) - bias;
+    col[13*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 13) - bias;
+    col[14*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 14) - bias;
+    col[15*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 15) - bias;
+    col[16*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 16) - bias;
+    col[17*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 17) - bias;
+    col[18*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 18) - bias;
+    col[19*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 19) - bias;
+    col[20*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 20) - bias;
+    col[21*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 21) - bias;
+    col[22*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 22) - bias;
+    col[23*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 23) - bias;
+    col[24*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 24) - bias;
+    col[25*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 25) - bias;
+    col[26*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 26) - bias;
+    col[27*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 27) - bias;
+    col[28*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 28) - bias;
+    col[29*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 29) - bias;
+    col[30*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 30) - bias;
+    col[31*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 31) - bias;
+    col[32*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 32) - bias;
+    col[33*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 33) - bias;
+    col[34*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 34) - bias;
+    col[35*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 35) - bias;
+    col[36*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 36) - bias;
+    col[37*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 37) - bias;
+    col[38*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 38) - bias;
+    col[39*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 39) - bias;
+    col[40*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 40) - bias;
+    col[41*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 41) - bias;
+    col[42*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 42) - bias;
+    col[43*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 43) - bias;
+    col[44*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 44) - bias;
+    col[45*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 45) - bias;
+    col[46*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 46) - bias;
+    col[47*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 47) - bias;
+    col[48*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 48) - bias;
+    col[49*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 49) - bias;
+    col[50*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 50) - bias;
+    col[51*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 51) - bias;
+    col[52*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 52) - bias;
+    col[53*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 53) - bias;
+    col[54*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 54) - bias;
+    col[55*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 55) - bias;
+    col[56*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 56) - bias;
+    col[57*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 57) - bias;
+    col[58*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 58) - bias;
+    col[59*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 59) - bias;
+    col[60*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 60) - bias;
+    col[61*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 61) - bias;
+    col[62*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 62) - bias;
+    col[63*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 63) - bias;
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_sw_stats_table_striped_avx512_512_8
+#define PNAME parasail_sw_stats_table_striped_profile_avx512_512_8
+#define INAME PNAME
+#define STATIC
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_sw_stats_rowcol_striped_avx512_512_8
+#define PNAME parasail_sw_stats_rowcol_striped_profile_avx512_512_8
+#define INAME PNAME
+#define STATIC
+#else
+#define FNAME parasail_sw_stats_striped_avx512_512_8
+#ifdef FASTSTATS
+#define PNAME parasail_sw_stats_striped_profile_avx512_512_8_internal
+#define INAME parasail_sw_stats_striped_profile_avx512_512_8
+#define STATIC static
+#else
+#define PNAME parasail_sw_stats_striped_profile_avx512_512_8
+#define INAME PNAME
+#define STATIC
+#endif
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_stats_avx512_512_8(s1, s1Len, matrix);
+    parasail_result_t *result = INAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+STATIC parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 64; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    __m512i* const restrict vProfile  = (__m512i*)profile->profile8.score;
+    __m512i* const restrict vProfileM = (__m512i*)profile->profile8.matches;
+    __m512i* const restrict vProfileS = (__m512i*)profile->profile8.similar;
+    __m512i* restrict pvHStore        = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHLoad         = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHMStore       = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHMLoad        = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHSStore       = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHSLoad        = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHLStore       = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHLLoad        = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvE       = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvEM      = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvES      = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvEL      = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHMax          = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHMMax         = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHSMax         = parasail_memalign___m512i(64, segLen);
+    __m512i* restrict pvHLMax         = parasail_memalign___m512i(64, segLen);
+    __m512i vGapO = _mm512_set1_epi8(open);
+    __m512i vGapE = _mm512_set1_epi8(gap);
+    __m512i vZero = _mm512_setzero_si512();
+    __m512i vOne = _mm512_set1_epi8(1);
+    int8_t bias = INT8_MIN;
+    int8_t score = bias;
+    int8_t matches = bias;
+    int8_t similar = bias;
+    int8_t length = bias;
+    __m512i vBias = _mm512_set1_epi8(bias);
+    __m512i vBias1 = _mm512_adds_epi8(vBias,vOne);
+    __m512i vMaxH = vBias;
+    __m512i vMaxHUnit = vBias;
+    __m512i insert_mask = _mm512_cmpgt_epi8_rpl(
+            _mm512_set_epi8(0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1),
+            vZero);
+    __m512i vSaturationCheckMax = vBias;
+    __m512i vPosLimit = _mm512_set1_epi8(INT8_MAX);
+    int8_t maxp = INT8_MAX - (int8_t)(matrix->max+1);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table3(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol3(segLen*segWidth, s2Len);
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+#else
+    parasail_result_t *result = parasail_result_new_stats();
+#endif
+#endif
+
+    parasail_memset___m512i(pvHStore, vBias, segLen);
+    parasail_memset___m512i(pvHMStore, vBias, segLen);
+    parasail_memset___m512i(pvHSStore, vBias, segLen);
+    parasail_memset___m512i(pvHLStore, vBias, segLen);
+    parasail_memset___m512i(pvE, vBias, segLen);
+    parasail_memset___m512i(pvEM, vBias, segLen);
+    parasail_memset___m512i(pvES, vBias, segLen);
+    parasail_memset___m512i(pvEL, vBias1, segLen);
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m512i vEF_opn;
+        __m512i vE;
+        __m512i vE_ext;
+        __m512i vEM;
+        __m512i vES;
+        __m512i vEL;
+        __m512i vF;
+        __m512i vF_ext;
+        __m512i vFM;
+        __m512i vFS;
+        __m512i vFL;
+        __m512i vH;
+        __m512i vH_dag;
+        __m512i vHM;
+        __m512i vHS;
+        __m512i vHL;
+        const __m512i* vP = NULL;
+        const __m512i* vPM = NULL;
+        const __m512i* vPS = NULL;
+
+        /* Initialize F value to 0.  Any errors to vH values will be
+         * corrected in the Lazy_F loop. */
+        vF = vBias;
+        vFM = vBias;
+        vFS = vBias;
+        vFL = vBias1;
+
+        /* load final segment of pvHStore and shift left by 1 bytes */
+        vH = _mm512_load_si512(&pvHStore[segLen - 1]);
+        vHM = _mm512_load_si512(&pvHMStore[segLen - 1]);
+        vHS = _mm512_load_si512(&pvHSStore[segLen - 1]);
+        vHL = _mm512_load_si512(&pvHLStore[segLen - 1]);
+        vH = _mm512_slli_si512_rpl(vH, 1);
+        vHM = _mm512_slli_si512_rpl(vHM, 1);
+        vHS = _mm512_slli_si512_rpl(vHS, 1);
+        vHL = _mm512_slli_si512_rpl(vHL, 1);
+        vH = _mm512_blendv_epi8_rpl(vH, vBias, insert_mask);
+        vHM = _mm512_blendv_epi8_rpl(vHM, vBias, insert_mask);
+        vHS = _mm512_blendv_epi8_rpl(vHS, vBias, insert_mask);
+        vHL = _mm512_blendv_epi8_rpl(vHL, vBias, insert_mask);
+
+        /* Correct part of the vProfile */
+        vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+        vPM = vProfileM + matrix->mapper[(unsigned char)s2[j]] * segLen;
+        vPS = vProfileS + matrix->mapper[(unsigned char)s2[j]] * segLen;
+
+        if (end_ref == j-2) {
+            /* Swap in the max buffer. */
+            SWAP3(pvHMax,  pvHLoad,  pvHStore)
+            SWAP3(pvHMMax, pvHMLoad, pvHMStore)
+            SWAP3(pvHSMax, pvHSLoad, pvHSStore)
+            SWAP3(pvHLMax, pvHLLoad, pvHLStore)
+        }
+        else {
+            /* Swap the 2 H buffers. */
+            SWAP(pvHLoad,  pvHStore)
+            SWAP(pvHMLoad, pvHMStore)
+            SWAP(pvHSLoad, pvHSStore)
+            SWAP(pvHLLoad, pvHLStore)
+        }
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            __m512i cond_zero;
+            __m512i case1;
+            __m512i case2;
+
+            vE = _mm512_load_si512(pvE+ i);
+            vEM = _mm512_load_si512(pvEM+ i);
+            vES = _mm512_load_si512(pvES+ i);
+            vEL = _mm512_load_si512(pvEL+ i);
+
+            /* Get max from vH, vE and vF. */
+            vH_dag = _mm512_adds_epi8(vH, _mm512_load_si512(vP + i));
+            /*vH = _mm512_max_epi8(vH_dag, vBias);*/
+            vH = _mm512_max_epi8(vH_dag, vE);
+            vH = _mm512_max_epi8(vH, vF);
+            /* Save vH values. */
+            _mm512_store_si512(pvHStore + i, vH);
+            cond_zero = _mm512_cmpeq_epi8_rpl(vH, vBias);
+
+            case1 = _mm512_cmpeq_epi8_rpl(vH, vH_dag);
+            case2 = _mm512_cmpeq_epi8_rpl(vH, vF);
+
+            /* calculate vM */
+            vHM = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vEM, vFM, case2),
+                    _mm512_adds_epi8(vHM, _mm512_load_si512(vPM + i)), case1);
+            vHM = _mm512_blendv_epi8_rpl(vHM, vBias, cond_zero);
+            _mm512_store_si512(pvHMStore + i, vHM);
+
+            /* calculate vS */
+            vHS = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vES, vFS, case2),
+                    _mm512_adds_epi8(vHS, _mm512_load_si512(vPS + i)), case1);
+            vHS = _mm512_blendv_epi8_rpl(vHS, vBias, cond_zero);
+            _mm512_store_si512(pvHSStore + i, vHS);
+
+            /* calculate vL */
+            vHL = _mm512_blendv_epi8_rpl(
+                    _mm512_blendv_epi8_rpl(vEL, vFL, case2),
+                    _mm512_adds_epi8(vHL, vOne), case1);
+            vHL = _mm512_blendv_epi8_rpl(vHL, vBias, cond_zero);
+            _mm512_store_si512(pvHLStore + i, vHL);
+
+            vSaturationCheckMax = _mm512_max_epi8(vSaturationCheckMax, vHM);
+            vSaturationCheckMax = _mm512_max_epi8(vSaturationCheckMax, vHS);
+            vSaturationCheckMax = _mm512_max_epi8(vSaturationCheckMax, vHL);
+#ifdef PARASAIL_TABLE
+            arr_store(result->stats->tables->matches_table, vHM, i, segLen, j, s2Len, bias);
+            arr_store(result->stats->tables->similar_table, vHS, i, segLen, j, s2Len, bias);
+            arr_store(result->stats->tables->length_table, vHL, i, segLen, j, s2Len, bias);
+            arr_store(result->stats->tables->score_table, vH, i, segLen, j, s2Len, bias);
+#endif
+            vMaxH = _mm512_max_epi8(vH, vMaxH);
+            vEF_opn = _mm512_subs_epi8(vH, vGapO);
+
+            /* Update vE value. */
+            vE_ext = _mm512_subs_epi8(vE, vGapE);
+            vE = _mm512_max_epi8(vEF_opn, vE_ext);
+            case1 = _mm512_cmpgt_epi8_rpl(vEF_opn, vE_ext);
+            vEM = _mm512_blendv_epi8_rpl(vEM, vHM, case1);
+            vES = _mm512_blendv_epi8_rpl(vES, vHS, case1);
+            vEL = _mm512_blendv_epi8_rpl(
+                    _mm512_adds_epi8(vEL, vOne),
+                    _mm512_adds_epi8(vHL, vOne),
+                    case1);
+            _mm512_store_si512(pvE + i, vE);
+            _mm512_store_si512(pvEM + i, vEM);
+            _mm512_store_si512(pvES + i, vES);
+            _mm512_store_si512(pvEL + i, vEL);
+
+            /* Update vF value. */
+            vF_ext = _mm512_subs_epi8(vF, vGapE);
+            vF = _mm512_max_epi8(vEF_opn, vF_ext);
+            case1 = _mm512_cmpgt_epi8_rpl(vEF_opn, vF_ext);
+            vFM = _mm512_blendv_epi8_rpl(vFM, vHM, case1);
+            vFS = _mm512_blendv_epi8_rpl(vFS, vHS, case1);
+            vFL = _mm512_blendv_epi8_rpl(
+                    _mm512_adds_epi8(vFL, vOne),
+                    _mm512_adds_epi8(vHL, vOne),
+                    case1);
+
+            /* Load the next vH. */
+            vH = _mm512_load_si512(pvHLoad + i);
+            vHM = _mm512_load_si512(pvHMLoad + i);
+            vHS = _mm512_load_si512(pvHSLoad + i);
+            vHL = _mm512_load_si512(pvHLLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            __m512i vHp = _mm512_load_si512(&pvHLoad[segLen - 1]);
+            vHp = _mm512_slli_si512_rpl(vHp, 1);
+            vF = _mm512_slli_si512_rpl(vF, 1);
+            vFM = _mm512_slli_si512_rpl(vFM, 1);
+            vFS = _mm512_slli_si512_rpl(vFS, 1);
+            vFL = _mm512_slli_si512_rpl(vFL, 1);
+            vHp = _mm512_blendv_epi8_rpl(vHp, vBias, insert_mask);
+            vF = _mm512_blendv_epi8_rpl(vF, vBias, insert_mask);
+            vFM = _mm512_blendv_epi8_rpl(vFM, vBias, insert_mask);
+            vFS = _mm512_blendv_epi8_rpl(vFS, vBias, insert_mask);
+            vFL = _mm512_blendv_epi8_rpl(vFL, vBias1, insert_mask);
+            for (i=0; i<segLen; ++i) {
+                __m512i case1;
+                __m512i case2;
+                __m512i cond;
+
+                vHp = _mm512_adds_epi8(vHp, _mm512_load_si512(vP + i));
+                vH = _mm512_load_si512(pvHStore + i);
+                vH = _mm512_max_epi8(vH, vF);
+                _mm512_store_si512(pvHStore + i, vH);
+                case1 = _mm512_cmpeq_epi8_rpl(vH, vHp);
+                case2 = _mm512_cmpeq_epi8_rpl(vH, vF);
+                cond = _mm512_andnot_si512(case1, case2);
+
+                /* calculate vM */
+                vHM = _mm512_load_si512(pvHMStore + i);
+                vHM = _mm512_blendv_epi8_rpl(vHM, vFM, cond);
+                _mm512_store_si512(pvHMStore + i, vHM);
+
+                /* calculate vS */
+                vHS = _mm512_load_si512(pvHSStore + i);
+                vHS = _mm512_blendv_epi8_rpl(vHS, vFS, cond);
+                _mm512_store_si512(pvHSStore + i, vHS);
+
+                /* calculate vL */
+                vHL = _mm512_load_si512(pvHLStore + i);
+                vHL = _mm512_blendv_epi8_rpl(vHL, vFL, cond);
+                _mm512_store_si512(pvHLStore + i, vHL);
+
+                vSaturationCheckMax = _mm512_max_epi8(vSaturationCheckMax, vHM);
+                vSaturationCheckMax = _mm512_max_epi8(vSaturationCheckMax, vHS);
+                vSaturationCheckMax = _mm512_max_epi8(vSaturationCheckMax, vHL);
+#ifdef PARASAIL_TABLE
+                arr_store(result->stats->tables->matches_table, vHM, i, segLen, j, s2Len, bias);
+                arr_store(result->stats->tables->similar_table, vHS, i, segLen, j, s2Len, bias);
+                arr_store(result->stats->tables->length_table, vHL, i, segLen, j, s2Len, bias);
+                arr_store(result->stats->tables->score_table, vH, i, segLen, j, s2Len, bias);
+#endif
+                vMaxH = _mm512_max_epi8(vH, vMaxH);
+                /* Update vF value. */
+                vEF_opn = _mm512_subs_epi8(vH, vGapO);
+                vF_ext = _mm512_subs_epi8(vF, vGapE);
+                if (! _mm512_movepi8_mask(
+                            _mm512_or_si512(
+                                _mm512_cmpgt_epi8_rpl(vF_ext, vEF_opn),
+                                _mm512_and_si512(
+                                    _mm512_cmpeq_epi8_rpl(vF_ext, vEF_opn),
+                                    _mm512_cmpgt_epi8_rpl(vF_ext, vBias)))))
+                    goto end;
+                /*vF = _mm512_max_epi8(vEF_opn, vF_ext);*/
+                vF = vF_ext;
+                cond = _mm512_cmpgt_epi8_rpl(vEF_opn, vF_ext);
+                vFM = _mm512_blendv_epi8_rpl(vFM, vHM, cond);
+                vFS = _mm512_blendv_epi8_rpl(vFS, vHS, cond);
+                vFL = _mm512_blendv_epi8_rpl(
+                        _mm512_adds_epi8(vFL, vOne),
+                        _mm512_adds_epi8(vHL, vOne),
+                        cond);
+                vHp = _mm512_load_si512(pvHLoad + i);
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm512_load_si512(pvHStore + offset);
+            vHM = _mm512_load_si512(pvHMStore + offset);
+            vHS = _mm512_load_si512(pvHSStore + offset);
+            vHL = _mm512_load_si512(pvHLStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl(vH, 1);
+                vHM = _mm512_slli_si512_rpl(vHM, 1);
+                vHS = _mm512_slli_si512_rpl(vHS, 1);
+                vHL = _mm512_slli_si512_rpl(vHL, 1);
+            }
+            result->stats->rowcols->score_row[j] = (int8_t) _mm512_extract_epi8_rpl (vH, 63) - bias;
+            result->stats->rowcols->matches_row[j] = (int8_t) _mm512_extract_epi8_rpl (vHM, 63) - bias;
+            result->stats->rowcols->similar_row[j] = (int8_t) _mm512_extract_epi8_rpl (vHS, 63) - bias;
+            result->stats->rowcols->length_row[j] = (int8_t) _mm512_extract_epi8_rpl (vHL, 63) - bias;
+        }
+#endif
+
+        {
+            __m512i vCompare = _mm512_cmpgt_epi8_rpl(vMaxH, vMaxHUnit);
+            if (_mm512_movepi8_mask(vCompare)) {
+                score = _mm512_hmax_epi8_rpl(vMaxH);
+                /* if score has potential to overflow, abort early */
+                if (score > maxp) {
+                    result->flag |= PARASAIL_FLAG_SATURATED;
+                    break;
+                }
+                vMaxHUnit = _mm512_set1_epi8(score);
+                end_ref = j;
+            }
+        }
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m512i vH = _mm512_load_si512(pvHStore+i);
+        __m512i vHM = _mm512_load_si512(pvHMStore+i);
+        __m512i vHS = _mm512_load_si512(pvHSStore+i);
+        __m512i vHL = _mm512_load_si512(pvHLStore+i);
+        arr_store_col(result->stats->rowcols->score_col, vH, i, segLen, bias);
+        arr_store_col(result->stats->rowcols->matches_col, vHM, i, segLen, bias);
+        arr_store_col(result->stats->rowcols->similar_col, vHS, i, segLen, bias);
+        arr_store_col(result->stats->rowcols->length_col, vHL, i, segLen, bias);
+    }
+#endif
+
+    if (score == INT8_MAX
+            || _mm512_movepi8_mask(_mm512_cmpeq_epi8_rpl(vSaturationCheckMax,vPosLimit))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+    }
+
+    if (parasail_result_is_saturated(result)) {
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+        matches = 0;
+        similar = 0;
+        length = 0;
+    }
+    else {
+        if (end_ref == j-1) {
+            /* end_ref was the last store column */
+            SWAP(pvHMax,  pvHStore)
+            SWAP(pvHMMax, pvHMStore)
+            SWAP(pvHSMax, pvHSStore)
+            SWAP(pvHLMax, pvHLStore)
+        }
+        else if (end_ref == j-2) {
+            /* end_ref was the last load column */
+            SWAP(pvHMax,  pvHLoad)
+            SWAP(pvHMMax, pvHMLoad)
+            SWAP(pvHSMax, pvHSLoad)
+            SWAP(pvHLMax, pvHLLoad)
+        }
+        /* Trace the alignment ending position on read. */
+        {
+            int8_t *t = (int8_t*)pvHMax;
+            int8_t *m = (int8_t*)pvHMMax;
+            int8_t *s = (int8_t*)pvHSMax;
+            int8_t *l = (int8_t*)pvHLMax;
+            int32_t column_len = segLen * segWidth;
+            end_query = s1Len;
+            for (i = 0; i<column_len; ++i, ++t, ++m, ++s, ++l) {
+                if (*t == score) {
+                    int32_t temp = i / segWidth + i % segWidth * segLen;
+                    if (temp < end_query) {
+                        end_query = temp;
+                        matches = *m;
+                        similar = *s;
+                        length = *l;
+                    }
+                }
+            }
+        }
+    }
+
+    result->score = score - bias;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->stats->matches = matches - bias;
+    result->stats->similar = similar - bias;
+    result->stats->length = length - bias;
+    result->flag |= PARASAIL_FLAG_SW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_STATS
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_64;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvHLMax);
+    parasail_free(pvHSMax);
+    parasail_free(pvHMMax);
+    parasail_free(pvHMax);
+    parasail_free(pvEL);
+    parasail_free(pvES);
+    parasail_free(pvEM);
+    parasail_free(pvE);
+    parasail_free(pvHLLoad);
+    parasail_free(pvHLStore);
+    parasail_free(pvHSLoad);
+    parasail_free(pvHSStore);
+    parasail_free(pvHMLoad);
+    parasail_free(pvHMStore);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+
+    return result;
+}
+
+#ifdef FASTSTATS
+#ifdef PARASAIL_TABLE
+#else
+#ifdef PARASAIL_ROWCOL
+#else
+#include <assert.h>
+parasail_result_t* INAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    const char *s1 = profile->s1;
+    const parasail_matrix_t *matrix = profile->matrix;
+
+    /* find the end loc first with the faster implementation */
+    parasail_result_t *result = parasail_sw_striped_profile_avx512_512_8(profile, s2, s2Len, open, gap);
+    if (!parasail_result_is_saturated(result)) {
+#if 0
+        int s1Len_new = 0;
+        int s2Len_new = 0;
+        char *s1_new = NULL;
+        char *s2_new = NULL;
+        parasail_profile_t *profile_new = NULL;
+        parasail_result_t *result_new = NULL;
+        int s1_begin = 0;
+        int s2_begin = 0;
+        int s1Len_final = 0;
+        int s2Len_final = 0;
+        parasail_profile_t *profile_final = NULL;
+        parasail_result_t *result_final = NULL;
+
+        /* using the end loc and the non-stats version of the function,
+         * reverse the inputs and find the beg loc */
+        s1Len_new = result->end_query+1;
+        s2Len_new = result->end_ref+1;
+        s1_new = parasail_reverse(s1, s1Len_new);
+        s2_new = parasail_reverse(s2, s2Len_new);
+        profile_new = parasail_profile_create_avx512_512_8(
+                s1_new, s1Len_new, matrix);
+        profile_new->stop = result->score;
+        result_new = parasail_sw_striped_profile_avx512_512_8(
+                profile_new, s2_new, s2Len_new, open, gap);
+
+        /* using both the beg and end loc, call the original stats func */
+        s1_begin = s1Len_new - result_new->end_query - 1;
+        s2_begin = s2Len_new - result_new->end_ref - 1;
+        s1Len_final = s1Len_new - s1_begin;
+        s2Len_final = s2Len_new - s2_begin;
+        assert(s1_begin >= 0);
+        assert(s2_begin >= 0);
+        assert(s1Len_new > s1_begin);
+        assert(s2Len_new > s2_begin);
+        profile_final = parasail_profile_create_stats_avx512_512_8(
+                &s1[s1_begin], s1Len_final, matrix);
+        result_final = PNAME(
+                profile_final, &s2[s2_begin], s2Len_final, open, gap);
+
+        /* clean up all the temporary profiles, sequences, and results */
+        free(s1_new);
+        free(s2_new);
+        parasail_profile_free(profile_new);
+        parasail_profile_free(profile_final);
+        parasail_result_free(result);
+        parasail_result_free(result_new);
+
+        /* correct the end locations before returning */
+        result_final->end_query = s1Len_new-1;
+        result_final->end_ref = s2Len_new-1;
+        return result_final;
+#else
+        int s1Len_new = 0;
+        int s2Len_new = 0;
+        parasail_profile_t *profile_final = NULL;
+        parasail_result_t *result_final = NULL;
+
+        /* using the end loc, call the original stats function */
+        s1Len_new = result->end_query+1;
+        s2Len_new = result->end_ref+1;
+        profile_final = parasail_profile_create_stats_avx512_512_8(
+                s1, s1Len_new, matrix);
+        result_final = PNAME(
+                profile_final, s2, s2Len_new, open, gap);
+
+        /* clean up all the temporary profiles, sequences, and results */
+        parasail_profile_free(profile_final);
+        parasail_result_free(result);
+
+        /* correct the end locations before returning */
+        result_final->end_query = s1Len_new-1;
+        result_final->end_ref = s2Len_new-1;
+        return result_final;
+#endif
+    }
+    else {
+        return result;
+    }
+}
+#endif
+#endif
+#endif
+
+
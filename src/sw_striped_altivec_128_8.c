@@ -85,6 +85,9 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_sw_striped_altivec_128_8
 #define PNAME parasail_sw_striped_profile_altivec_128_8
+#define FNAME_WS parasail_sw_striped_ws_altivec_128_8
+#define PNAME_WS parasail_sw_striped_profile_ws_altivec_128_8
+#define PNAME_RESUME parasail_sw_striped_profile_resume_altivec_128_8
 #endif
 #endif
 
@@ -99,14 +102,21 @@ parasail_result_t* FNAME(
     return result;
 }
 
-parasail_result_t* PNAME(
+static inline void striped_kernel(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        vec128i* restrict pvHStore,
+        vec128i* restrict pvHLoad,
+        vec128i* restrict pvHMax,
+        vec128i* const restrict pvE,
+        parasail_sat_state_t * const restrict state,
+        parasail_result_t * const restrict result)
 {
     int32_t i = 0;
     int32_t j = 0;
     int32_t k = 0;
+    int32_t j_begin = 0;
     int32_t end_query = 0;
     int32_t end_ref = 0;
     const int s1Len = profile->s1Len;
@@ -114,10 +124,6 @@ parasail_result_t* PNAME(
     const int32_t segWidth = 16; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     vec128i* const restrict vProfile = (vec128i*)profile->profile8.score;
-    vec128i* restrict pvHStore = parasail_memalign_vec128i(16, segLen);
-    vec128i* restrict pvHLoad = parasail_memalign_vec128i(16, segLen);
-    vec128i* restrict pvHMax = parasail_memalign_vec128i(16, segLen);
-    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
     vec128i vGapO = _mm_set1_epi8(open);
     vec128i vGapE = _mm_set1_epi8(gap);
     vec128i vZero = _mm_set1_epi8(0);
@@ -131,24 +137,29 @@ parasail_result_t* PNAME(
             _mm_set_epi8(0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1),
             vZero);
     /*int8_t stop = profile->stop == INT32_MAX ?  INT8_MAX : (int8_t)profile->stop-bias;*/
-#ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
-#else
 #ifdef PARASAIL_ROWCOL
-    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
-#else
-    parasail_result_t *result = parasail_result_new();
-#endif
 #endif
 
     /* initialize H and E */
     parasail_memset_vec128i(pvHStore, vBias, segLen);
     parasail_memset_vec128i(pvE, vBias, segLen);
 
+    /* resume after the column where a narrower kernel saturated; that
+     * column holds the best score so far, so it is also the max column */
+    if (NULL != state && state->column >= 0) {
+        parasail_sat_state_load_int8_t(state,
+                (int8_t*)pvHStore, (int8_t*)pvE, s1Len, segLen, 16, bias);
+        score = (int8_t)(state->score + bias);
+        vMaxH = _mm_set1_epi8(score);
+        vMaxHUnit = vMaxH;
+        end_ref = state->column;
+        j_begin = state->column + 1;
+    }
+
     /* outer loop over database sequence */
-    for (j=0; j<s2Len; ++j) {
+    for (j=j_begin; j<s2Len; ++j) {
         vec128i vE;
         vec128i vF;
         vec128i vH;
@@ -250,6 +261,14 @@ end:
                 /* if score has potential to overflow, abort early */
                 if (score > maxp) {
                     result->flag |= PARASAIL_FLAG_SATURATED;
+                    if (NULL != state) {
+                        /* nothing in this column has overflowed yet */
+                        parasail_sat_state_save_int8_t(state,
+                                (const int8_t*)pvHStore, (const int8_t*)pvE,
+                                s1Len, segLen, 16, bias);
+                        state->column = j;
+                        state->score = score - bias;
+                    }
                     break;
                 }
                 vMaxHUnit = _mm_set1_epi8(score);
@@ -316,6 +335,32 @@ end:
 #ifdef PARASAIL_ROWCOL
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
+}
+
+static inline parasail_result_t* striped_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_sat_state_t * const restrict state)
+{
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+    vec128i* const restrict pvHStore = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvHLoad = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvHMax = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    striped_kernel(profile, s2, s2Len, open, gap,
+            pvHStore, pvHLoad, pvHMax, pvE, state, result);
 
     parasail_free(pvE);
     parasail_free(pvHMax);
@@ -325,3 +370,96 @@ end:
     return result;
 }
 
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return striped_profile(profile, s2, s2Len, open, gap, NULL);
+}
+
+#ifdef PNAME_RESUME
+parasail_result_t* PNAME_RESUME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_sat_state_t * const restrict state)
+{
+    return striped_profile(profile, s2, s2Len, open, gap, state);
+}
+#endif
+
+#ifdef PNAME_WS
+parasail_result_t* FNAME_WS(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t segNum = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    parasail_profile_t profile;
+    int8_t *t = NULL;
+
+    /* the profile is built in the workspace ahead of the DP columns */
+    parasail_workspace_grow(workspace, sizeof(vec128i)*segLen*(n+4));
+    {
+        vec128i* const restrict vProfile = (vec128i*)workspace->memory;
+        vec128i* const restrict pvHStore = vProfile + n*segLen;
+        vec128i* const restrict pvHLoad = pvHStore + segLen;
+        vec128i* const restrict pvHMax = pvHLoad + segLen;
+        vec128i* const restrict pvE = pvHMax + segLen;
+
+        t = (int8_t*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<segLen; ++i) {
+                j = i;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    *t++ = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
+                    j += segLen;
+                }
+            }
+        }
+
+        parasail_profile_init(&profile, s1, s1Len, matrix);
+        profile.profile8.score = vProfile;
+        parasail_result_init(result);
+        striped_kernel(&profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvHMax, pvE, NULL, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* PNAME_WS(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+
+    parasail_workspace_grow(workspace, sizeof(vec128i)*segLen*4);
+    {
+        vec128i* const restrict pvHStore = (vec128i*)workspace->memory;
+        vec128i* const restrict pvHLoad = pvHStore + segLen;
+        vec128i* const restrict pvHMax = pvHLoad + segLen;
+        vec128i* const restrict pvE = pvHMax + segLen;
+
+        parasail_result_init(result);
+        striped_kernel(profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvHMax, pvE, NULL, result);
+    }
+
+    return result;
+}
+#endif
+
@@ -0,0 +1,579 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx512.h"
+
+#define NEG_INF INT8_MIN
+
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+
+#define _mm512_cmpgt_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(a,b))
+
+#define _mm512_extract_epi8_rpl(a,imm) (int8_t)_mm_extract_epi8(_mm512_extracti32x4_epi32(a, (imm)>>4), (imm)&15)
+
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+
+static inline int8_t _mm512_hmax_epi8_rpl(__m512i a) {
+    __m256i b = _mm256_max_epi8(_mm512_castsi512_si256(a), _mm512_extracti64x4_epi64(a, 1));
+    __m128i c = _mm_max_epi8(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 8));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 4));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 2));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 1));
+    return (int8_t)_mm_extract_epi8(c, 0);
+}
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si512(
+        int *array,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        int32_t bias)
+{
+    array[1LL*( 0*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  0) - bias;
+    array[1LL*( 1*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  1) - bias;
+    array[1LL*( 2*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  2) - bias;
+    array[1LL*( 3*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  3) - bias;
+    array[1LL*( 4*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  4) - bias;
+    array[1LL*( 5*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  5) - bias;
+    array[1LL*( 6*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  6) - bias;
+    array[1LL*( 7*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  7) - bias;
+    array[1LL*( 8*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  8) - bias;
+    array[1LL*( 9*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH,  9) - bias;
+    array[1LL*(10*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 10) - bias;
+    array[1LL*(11*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 11) - bias;
+    array[1LL*(12*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 12) - bias;
+    array[1LL*(13*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 13) - bias;
+    array[1LL*(14*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 14) - bias;
+    array[1LL*(15*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 15) - bias;
+    array[1LL*(16*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 16) - bias;
+    array[1LL*(17*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 17) - bias;
+    array[1LL*(18*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 18) - bias;
+    array[1LL*(19*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 19) - bias;
+    array[1LL*(20*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 20) - bias;
+    array[1LL*(21*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 21) - bias;
+    array[1LL*(22*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 22) - bias;
+    array[1LL*(23*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 23) - bias;
+    array[1LL*(24*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 24) - bias;
+    array[1LL*(25*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 25) - bias;
+    array[1LL*(26*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 26) - bias;
+    array[1LL*(27*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 27) - bias;
+    array[1LL*(28*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 28) - bias;
+    array[1LL*(29*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 29) - bias;
+    array[1LL*(30*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 30) - bias;
+    array[1LL*(31*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 31) - bias;
+    array[1LL*(32*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 32) - bias;
+    array[1LL*(33*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 33) - bias;
+    array[1LL*(34*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 34) - bias;
+    array[1LL*(35*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 35) - bias;
+    array[1LL*(36*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 36) - bias;
+    array[1LL*(37*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 37) - bias;
+    array[1LL*(38*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 38) - bias;
+    array[1LL*(39*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 39) - bias;
+    array[1LL*(40*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 40) - bias;
+    array[1LL*(41*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 41) - bias;
+    array[1LL*(42*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 42) - bias;
+    array[1LL*(43*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 43) - bias;
+    array[1LL*(44*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 44) - bias;
+    array[1LL*(45*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 45) - bias;
+    array[1LL*(46*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 46) - bias;
+    array[1LL*(47*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 47) - bias;
+    array[1LL*(48*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 48) - bias;
+    array[1LL*(49*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 49) - bias;
+    array[1LL*(50*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 50) - bias;
+    array[1LL*(51*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 51) - bias;
+    array[1LL*(52*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 52) - bias;
+    array[1LL*(53*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 53) - bias;
+    array[1LL*(54*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 54) - bias;
+    array[1LL*(55*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 55) - bias;
+    array[1LL*(56*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 56) - bias;
+    array[1LL*(57*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 57) - bias;
+    array[1LL*(58*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 58) - bias;
+    array[1LL*(59*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 59) - bias;
+    array[1LL*(60*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 60) - bias;
+    array[1LL*(61*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 61) - bias;
+    array[1LL*(62*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 62) - bias;
+    array[1LL*(63*seglen+t)*dlen + d] = (int8_t)_mm512_extract_epi8_rpl(vH, 63) - bias;
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m512i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t bias)
+{
+    col[ 0*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  0) - bias;
+    col[ 1*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  1) - bias;
+    col[ 2*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  2) - bias;
+    col[ 3*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  3) - bias;
+    col[ 4*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  4) - bias;
+    col[ 5*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  5) - bias;
+    col[ 6*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  6) - bias;
+    col[ 7*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  7) - bias;
+    col[ 8*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  8) - bias;
+    col[ 9*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH,  9) - bias;
+    col[10*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 10) - bias;
+    col[11*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 11) - bias;
+    col[12*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 12) - bias;
+    col[13*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 13) - bias;
+    col[14*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 14) - bias;
+    col[15*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 15) - bias;
+    col[16*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 16) - bias;
+    col[17*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 17) - bias;
+    col[18*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 18) - bias;
+    col[19*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 19) - bias;
+    col[20*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 20) - bias;
+    col[21*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 21) - bias;
+    col[22*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 22) - bias;
+    col[23*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 23) - bias;
+    col[24*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 24) - bias;
+    col[25*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 25) - bias;
+    col[26*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 26) - bias;
+    col[27*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 27) - bias;
+    col[28*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 28) - bias;
+    col[29*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 29) - bias;
+    col[30*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 30) - bias;
+    col[31*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 31) - bias;
+    col[32*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 32) - bias;
+    col[33*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 33) - bias;
+    col[34*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 34) - bias;
+    col[35*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 35) - bias;
+    col[36*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 36) - bias;
+    col[37*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 37) - bias;
+    col[38*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 38) - bias;
+    col[39*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 39) - bias;
+    col[40*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 40) - bias;
+    col[41*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 41) - bias;
+    col[42*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 42) - bias;
+    col[43*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 43) - bias;
+    col[44*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 44) - bias;
+    col[45*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 45) - bias;
+    col[46*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 46) - bias;
+    col[47*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 47) - bias;
+    col[48*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 48) - bias;
+    col[49*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 49) - bias;
+    col[50*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 50) - bias;
+    col[51*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 51) - bias;
+    col[52*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 52) - bias;
+    col[53*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 53) - bias;
+    col[54*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 54) - bias;
+    col[55*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 55) - bias;
+    col[56*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 56) - bias;
+    col[57*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 57) - bias;
+    col[58*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 58) - bias;
+    col[59*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 59) - bias;
+    col[60*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 60) - bias;
+    col[61*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 61) - bias;
+    col[62*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 62) - bias;
+    col[63*seglen+t] = (int8_t)_mm512_extract_epi8_rpl(vH, 63) - bias;
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_sw_table_striped_avx512_512_8
+#define PNAME parasail_sw_table_striped_profile_avx512_512_8
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_sw_rowcol_striped_avx512_512_8
+#define PNAME parasail_sw_rowcol_striped_profile_avx512_512_8
+#else
+#define FNAME parasail_sw_striped_avx512_512_8
+#define PNAME parasail_sw_striped_profile_avx512_512_8
+#define FNAME_WS parasail_sw_striped_ws_avx512_512_8
+#define PNAME_WS parasail_sw_striped_profile_ws_avx512_512_8
+#define PNAME_RESUME parasail_sw_striped_profile_resume_avx512_512_8
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx512_512_8(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+static inline void striped_kernel(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        __m512i* restrict pvHStore,
+        __m512i* restrict pvHLoad,
+        __m512i* restrict pvHMax,
+        __m512i* const restrict pvE,
+        parasail_sat_state_t * const restrict state,
+        parasail_result_t * const restrict result)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t j_begin = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 64; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    __m512i* const restrict vProfile = (__m512i*)profile->profile8.score;
+    __m512i vGapO = _mm512_set1_epi8(open);
+    __m512i vGapE = _mm512_set1_epi8(gap);
+    __m512i vZero = _mm512_set1_epi8(0);
+    int8_t bias = INT8_MIN;
+    int8_t score = bias;
+    __m512i vBias = _mm512_set1_epi8(bias);
+    __m512i vMaxH = vBias;
+    __m512i vMaxHUnit = vBias;
+    int8_t maxp = INT8_MAX - (int8_t)(matrix->max+1);
+    __m512i insert_mask = _mm512_cmpgt_epi8_rpl(
+            _mm512_set_epi8(0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1),
+            vZero);
+    /*int8_t stop = profile->stop == INT32_MAX ?  INT8_MAX : (int8_t)profile->stop-bias;*/
+#ifdef PARASAIL_ROWCOL
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+#endif
+
+    /* initialize H and E */
+    parasail_memset___m512i(pvHStore, vBias, segLen);
+    parasail_memset___m512i(pvE, vBias, segLen);
+
+    /* resume after the column where a narrower kernel saturated; that
+     * column holds the best score so far, so it is also the max column */
+    if (NULL != state && state->column >= 0) {
+        parasail_sat_state_load_int8_t(state,
+                (int8_t*)pvHStore, (int8_t*)pvE, s1Len, segLen, 64, bias);
+        score = (int8_t)(state->score + bias);
+        vMaxH = _mm512_set1_epi8(score);
+        vMaxHUnit = vMaxH;
+        end_ref = state->column;
+        j_begin = state->column + 1;
+    }
+
+    /* outer loop over database sequence */
+    for (j=j_begin; j<s2Len; ++j) {
+        __m512i vE;
+        __m512i vF;
+        __m512i vH;
+        const __m512i* vP = NULL;
+        __m512i* pv = NULL;
+
+        /* Initialize F value to 0.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        vF = vBias;
+
+        /* load final segment of pvHStore and shift left by 1 bytes */
+        vH = _mm512_slli_si512_rpl(pvHStore[segLen - 1], 1);
+        vH = _mm512_blendv_epi8_rpl(vH, vBias, insert_mask);
+
+        /* Correct part of the vProfile */
+        vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+
+        if (end_ref == j-2) {
+            /* Swap in the max buffer. */
+            pv = pvHMax;
+            pvHMax = pvHLoad;
+            pvHLoad = pvHStore;
+            pvHStore = pv;
+        }
+        else {
+            /* Swap the 2 H buffers. */
+            pv = pvHLoad;
+            pvHLoad = pvHStore;
+            pvHStore = pv;
+        }
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = _mm512_adds_epi8(vH, _mm512_load_si512(vP + i));
+            vE = _mm512_load_si512(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm512_max_epi8(vH, vE);
+            vH = _mm512_max_epi8(vH, vF);
+            /* Save vH values. */
+            _mm512_store_si512(pvHStore + i, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si512(result->tables->score_table, vH, i, segLen, j, s2Len, bias);
+#endif
+            vMaxH = _mm512_max_epi8(vH, vMaxH);
+
+            /* Update vE value. */
+            vH = _mm512_subs_epi8(vH, vGapO);
+            vE = _mm512_subs_epi8(vE, vGapE);
+            vE = _mm512_max_epi8(vE, vH);
+            _mm512_store_si512(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm512_subs_epi8(vF, vGapE);
+            vF = _mm512_max_epi8(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm512_load_si512(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = _mm512_slli_si512_rpl(vF, 1);
+            vF = _mm512_blendv_epi8_rpl(vF, vBias, insert_mask);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm512_load_si512(pvHStore + i);
+                vH = _mm512_max_epi8(vH,vF);
+                _mm512_store_si512(pvHStore + i, vH);
+#ifdef PARASAIL_TABLE
+                arr_store_si512(result->tables->score_table, vH, i, segLen, j, s2Len, bias);
+#endif
+                vMaxH = _mm512_max_epi8(vH, vMaxH);
+                vH = _mm512_subs_epi8(vH, vGapO);
+                vF = _mm512_subs_epi8(vF, vGapE);
+                if (! _mm512_cmpgt_epi8_mask(vF, vH)) goto end;
+                /*vF = _mm512_max_epi8(vF, vH);*/
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm512_load_si512(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm512_slli_si512_rpl(vH, 1);
+            }
+            result->rowcols->score_row[j] = (int8_t) _mm512_extract_epi8_rpl (vH, 63) - bias;
+        }
+#endif
+
+        {
+            __m512i vCompare = _mm512_cmpgt_epi8_rpl(vMaxH, vMaxHUnit);
+            if (_mm512_movepi8_mask(vCompare)) {
+                score = _mm512_hmax_epi8_rpl(vMaxH);
+                /* if score has potential to overflow, abort early */
+                if (score > maxp) {
+                    result->flag |= PARASAIL_FLAG_SATURATED;
+                    if (NULL != state) {
+                        /* nothing in this column has overflowed yet */
+                        parasail_sat_state_save_int8_t(state,
+                                (const int8_t*)pvHStore, (const int8_t*)pvE,
+                                s1Len, segLen, 64, bias);
+                        state->column = j;
+                        state->score = score - bias;
+                    }
+                    break;
+                }
+                vMaxHUnit = _mm512_set1_epi8(score);
+                end_ref = j;
+            }
+        }
+
+        /*if (score == stop) break;*/
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m512i vH = _mm512_load_si512(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen, bias);
+    }
+#endif
+
+    if (score == INT8_MAX) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+    }
+
+    if (parasail_result_is_saturated(result)) {
+        score = INT8_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+    else {
+        if (end_ref == j-1) {
+            /* end_ref was the last store column */
+            __m512i *pv = pvHMax;
+            pvHMax = pvHStore;
+            pvHStore = pv;
+        }
+        else if (end_ref == j-2) {
+            /* end_ref was the last load column */
+            __m512i *pv = pvHMax;
+            pvHMax = pvHLoad;
+            pvHLoad = pv;
+        }
+        /* Trace the alignment ending position on read. */
+        {
+            int8_t *t = (int8_t*)pvHMax;
+            int32_t column_len = segLen * segWidth;
+            end_query = s1Len - 1;
+            for (i = 0; i<column_len; ++i, ++t) {
+                if (*t == score) {
+                    int32_t temp = i / segWidth + i % segWidth * segLen;
+                    if (temp < end_query) {
+                        end_query = temp;
+                    }
+                }
+            }
+        }
+    }
+
+    result->score = score - bias;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_64;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+}
+
+static inline parasail_result_t* striped_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_sat_state_t * const restrict state)
+{
+    const int32_t segWidth = 64; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+    __m512i* const restrict pvHStore = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHLoad = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvHMax = parasail_memalign___m512i(64, segLen);
+    __m512i* const restrict pvE = parasail_memalign___m512i(64, segLen);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    striped_kernel(profile, s2, s2Len, open, gap,
+            pvHStore, pvHLoad, pvHMax, pvE, state, result);
+
+    parasail_free(pvE);
+    parasail_free(pvHMax);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return striped_profile(profile, s2, s2Len, open, gap, NULL);
+}
+
+#ifdef PNAME_RESUME
+parasail_result_t* PNAME_RESUME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_sat_state_t * const restrict state)
+{
+    return striped_profile(profile, s2, s2Len, open, gap, state);
+}
+#endif
+
+#ifdef PNAME_WS
+parasail_result_t* FNAME_WS(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t segNum = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 64; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    parasail_profile_t profile;
+    int8_t *t = NULL;
+
+    /* the profile is built in the workspace ahead of the DP columns */
+    parasail_workspace_grow(workspace, sizeof(__m512i)*segLen*(n+4));
+    {
+        __m512i* const restrict vProfile = (__m512i*)workspace->memory;
+        __m512i* const restrict pvHStore = vProfile + n*segLen;
+        __m512i* const restrict pvHLoad = pvHStore + segLen;
+        __m512i* const restrict pvHMax = pvHLoad + segLen;
+        __m512i* const restrict pvE = pvHMax + segLen;
+
+        t = (int8_t*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<segLen; ++i) {
+                j = i;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    *t++ = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
+                    j += segLen;
+                }
+            }
+        }
+
+        parasail_profile_init(&profile, s1, s1Len, matrix);
+        profile.profile8.score = vProfile;
+        parasail_result_init(result);
+        striped_kernel(&profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvHMax, pvE, NULL, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* PNAME_WS(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    const int32_t segWidth = 64; /* number of values in vector unit */
+    const int32_t segLen = (profile->s1Len + segWidth - 1) / segWidth;
+
+    parasail_workspace_grow(workspace, sizeof(__m512i)*segLen*4);
+    {
+        __m512i* const restrict pvHStore = (__m512i*)workspace->memory;
+        __m512i* const restrict pvHLoad = pvHStore + segLen;
+        __m512i* const restrict pvHMax = pvHLoad + segLen;
+        __m512i* const restrict pvE = pvHMax + segLen;
+
+        parasail_result_init(result);
+        striped_kernel(profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvHMax, pvE, NULL, result);
+    }
+
+    return result;
+}
+#endif
+
@@ -0,0 +1,475 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Linear-memory traceback.  The score and end location come from the
+ * serial reference kernels, the begin location from a backwards pass
+ * anchored at the end, and the path between them from the Myers-Miller
+ * divide-and-conquer algorithm for affine gaps (Hirschberg's method
+ * extended to track gaps crossing the split row).  Memory is O(s1Len +
+ * s2Len); the path is stored in the result as a parasail_cigar_t in
+ * PARASAIL_TRACE_FORMAT_PATH, whose M ops are split into =/X when
+ * parasail_result_get_cigar is called.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define SG_TRACE
+#define SG_SUFFIX _linear
+#include "sg_helper.h"
+
+#define NEG_INF_32 (INT32_MIN/2)
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+typedef struct linear {
+    const parasail_matrix_t *matrix;
+    int g;                      /* open - gap */
+    int h;                      /* gap */
+    int *CC;                    /* forward H of the split row */
+    int *DD;                    /* forward F of the split row */
+    int *RR;                    /* reverse H of the split row */
+    int *SS;                    /* reverse F of the split row */
+    parasail_cigar_t *path;
+    int size;                   /* capacity of path->seq */
+} linear_t;
+
+/* append an op, merging it with the previous one when they match */
+static inline void path_push(linear_t *L, int len, char op)
+{
+    parasail_cigar_t *path = L->path;
+    uint32_t code = parasail_cigar_encode(0, op);
+    if (len <= 0) {
+        return;
+    }
+    if (path->len > 0
+            && (path->seq[path->len-1] & 0xfU) == code) {
+        path->seq[path->len-1] += (uint32_t)len << 4;
+        return;
+    }
+    if (path->len >= L->size) {
+        L->size *= 2;
+        path->seq = realloc(path->seq, sizeof(uint32_t)*L->size);
+    }
+    path->seq[path->len++] = parasail_cigar_encode(len, op);
+}
+
+/* internally a deletion consumes s1, which the CIGAR calls an I */
+#define REP(L)     path_push(L, 1, 'M')
+#define DEL(L,K)   path_push(L, K, 'I')
+#define INS(L,K)   path_push(L, K, 'D')
+
+static inline int gapscore(const linear_t *L, int k)
+{
+    return k <= 0 ? 0 : -(L->g + L->h*k);
+}
+
+/* Align s1[0..M) to s2[0..N) globally, appending the path to L->path.
+ * tb and te are the open penalties charged for a deletion touching the
+ * top and bottom of this block; zero when the caller already opened
+ * it.  Returns the score. */
+static int align(linear_t *L, const int *A, int M, const int *B, int N,
+        int tb, int te)
+{
+    const int g = L->g;
+    const int h = L->h;
+    const int size = L->matrix->size;
+    const int *matrix = L->matrix->matrix;
+    int *CC = L->CC;
+    int *DD = L->DD;
+    int *RR = L->RR;
+    int *SS = L->SS;
+    int midi = 0;
+    int midj = 0;
+    int type = 1;
+    int best = 0;
+    int i = 0;
+    int j = 0;
+    int c = 0;
+    int d = 0;
+    int e = 0;
+    int s = 0;
+    int t = 0;
+
+    if (N <= 0) {
+        DEL(L, M);
+        return M > 0 ? -(MIN(tb,te) + h*M) : 0;
+    }
+
+    if (M <= 1) {
+        if (M <= 0) {
+            INS(L, N);
+            return gapscore(L, N);
+        }
+        /* delete A[0] next to the cheaper boundary and insert all of B,
+         * or substitute A[0] for some B[j-1] */
+        best = -(MIN(tb,te) + h) + gapscore(L, N);
+        for (j=1; j<=N; ++j) {
+            c = gapscore(L, j-1) + matrix[size*A[0]+B[j-1]]
+                + gapscore(L, N-j);
+            if (c > best) {
+                best = c;
+                midj = j;
+            }
+        }
+        if (0 == midj) {
+            if (tb <= te) {
+                DEL(L, 1);
+                INS(L, N);
+            }
+            else {
+                INS(L, N);
+                DEL(L, 1);
+            }
+        }
+        else {
+            INS(L, midj-1);
+            REP(L);
+            INS(L, N-midj);
+        }
+        return best;
+    }
+
+    midi = M/2;
+
+    /* forward pass over the upper half */
+    CC[0] = 0;
+    t = -g;
+    for (j=1; j<=N; ++j) {
+        t -= h;
+        CC[j] = t;
+        DD[j] = t - g;
+    }
+    t = -tb;
+    for (i=1; i<=midi; ++i) {
+        const int * const restrict matrow = &matrix[size*A[i-1]];
+        s = CC[0];
+        t -= h;
+        c = t;
+        CC[0] = c;
+        e = t - g;
+        for (j=1; j<=N; ++j) {
+            e = MAX(e, c - g) - h;
+            d = MAX(DD[j], CC[j] - g) - h;
+            c = s + matrow[B[j-1]];
+            c = MAX(c, d);
+            c = MAX(c, e);
+            s = CC[j];
+            CC[j] = c;
+            DD[j] = d;
+        }
+    }
+    DD[0] = CC[0];
+
+    /* reverse pass over the lower half */
+    RR[0] = 0;
+    t = -g;
+    for (j=1; j<=N; ++j) {
+        t -= h;
+        RR[j] = t;
+        SS[j] = t - g;
+    }
+    t = -te;
+    for (i=M-1; i>=midi; --i) {
+        const int * const restrict matrow = &matrix[size*A[i]];
+        s = RR[0];
+        t -= h;
+        c = t;
+        RR[0] = c;
+        e = t - g;
+        for (j=1; j<=N; ++j) {
+            e = MAX(e, c - g) - h;
+            d = MAX(SS[j], RR[j] - g) - h;
+            c = s + matrow[B[N-j]];
+            c = MAX(c, d);
+            c = MAX(c, e);
+            s = RR[j];
+            RR[j] = c;
+            SS[j] = d;
+        }
+    }
+    SS[0] = RR[0];
+
+    /* cross the split row through a cell, or inside a deletion whose
+     * open penalty both halves charged */
+    best = CC[0] + RR[N];
+    midj = 0;
+    for (j=0; j<=N; ++j) {
+        c = CC[j] + RR[N-j];
+        if (c > best) {
+            best = c;
+            midj = j;
+        }
+    }
+    for (j=N; j>=0; --j) {
+        c = DD[j] + SS[N-j] + g;
+        if (c > best) {
+            best = c;
+            midj = j;
+            type = 2;
+        }
+    }
+
+    if (1 == type) {
+        align(L, A, midi, B, midj, tb, g);
+        align(L, A+midi, M-midi, B+midj, N-midj, g, te);
+    }
+    else {
+        align(L, A, midi-1, B, midj, tb, 0);
+        DEL(L, 2);
+        align(L, A+midi+1, M-midi-1, B+midj, N-midj, 0, te);
+    }
+
+    return best;
+}
+
+/* Find where an alignment ending at s1[end_query], s2[end_ref] with
+ * the given score begins, scanning backwards from that cell.  Local
+ * alignments may begin anywhere; otherwise only the cells the flags
+ * leave free are candidates, plus the origin. */
+static void find_begin(
+        const int * const restrict s1, const int end_query,
+        const int * const restrict s2, const int end_ref,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        int local, int s1_beg, int s2_beg, int score,
+        int *beg_query, int *beg_ref)
+{
+    const int M = end_query+1;
+    const int N = end_ref+1;
+    int * const restrict H = parasail_memalign_int(16, N+1);
+    int * const restrict F = parasail_memalign_int(16, N+1);
+    int best = NEG_INF_32;
+    int i = 0;
+    int j = 0;
+
+    *beg_query = 0;
+    *beg_ref = 0;
+
+    H[0] = 0;
+    F[0] = NEG_INF_32;
+    for (j=1; j<=N; ++j) {
+        H[j] = -open - (j-1)*gap;
+        F[j] = NEG_INF_32;
+    }
+    if (s1_beg && !local) {
+        best = H[N];
+        *beg_query = M;
+        *beg_ref = 0;
+    }
+
+    for (i=1; i<=M; ++i) {
+        const int * const restrict matrow = &matrix->matrix[matrix->size*s1[M-i]];
+        int NH = H[0];
+        int WH = -open - (i-1)*gap;
+        int E = NEG_INF_32;
+        H[0] = WH;
+        if (!local && s2_beg && i == M && WH > best) {
+            best = WH;
+            *beg_query = 0;
+            *beg_ref = N;
+        }
+        for (j=1; j<=N; ++j) {
+            int NWH = NH;
+            NH = H[j];
+            F[j] = MAX(NH - open, F[j] - gap);
+            E = MAX(WH - open, E - gap);
+            WH = NWH + matrow[s2[N-j]];
+            WH = MAX(WH, E);
+            WH = MAX(WH, F[j]);
+            H[j] = WH;
+            if (local) {
+                if (WH > best) {
+                    best = WH;
+                    *beg_query = M-i;
+                    *beg_ref = N-j;
+                    if (best >= score) {
+                        goto done;
+                    }
+                }
+            }
+            else if (i == M && (s2_beg || j == N) && WH > best) {
+                best = WH;
+                *beg_query = 0;
+                *beg_ref = N-j;
+            }
+        }
+        /* WH is the last column, where skipping s1 may be free */
+        if (!local && s1_beg && i < M && WH > best) {
+            best = WH;
+            *beg_query = M-i;
+            *beg_ref = 0;
+        }
+    }
+
+done:
+    parasail_free(F);
+    parasail_free(H);
+}
+
+/* Build the path of an alignment ending at s1[end_query], s2[end_ref]
+ * with score *score, finding its begin first unless the flags pin it
+ * to the origin.  *score is then replaced by the score of the path,
+ * which global alignments do not know beforehand. */
+static parasail_cigar_t* trace_path(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        int local, int s1_beg, int s2_beg,
+        int end_query, int end_ref, int *score)
+{
+    parasail_cigar_t *path = malloc(sizeof(parasail_cigar_t));
+    int * const restrict s1 = parasail_memalign_int(16, s1Len);
+    int * const restrict s2 = parasail_memalign_int(16, s2Len);
+    linear_t L;
+    int beg_query = 0;
+    int beg_ref = 0;
+    int i = 0;
+    int j = 0;
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    L.matrix = matrix;
+    L.g = open - gap;
+    L.h = gap;
+    L.CC = parasail_memalign_int(16, s2Len+1);
+    L.DD = parasail_memalign_int(16, s2Len+1);
+    L.RR = parasail_memalign_int(16, s2Len+1);
+    L.SS = parasail_memalign_int(16, s2Len+1);
+    L.path = path;
+    L.size = 16;
+    path->seq = malloc(sizeof(uint32_t)*L.size);
+    path->len = 0;
+
+    if (local && *score <= 0) {
+        /* nothing aligned, same as the table traceback */
+        beg_query = end_query+1;
+        beg_ref = end_ref+1;
+    }
+    else {
+        int core = 0;
+        if (local || s1_beg || s2_beg) {
+            find_begin(s1, end_query, s2, end_ref, open, gap, matrix,
+                    local, s1_beg, s2_beg, *score, &beg_query, &beg_ref);
+        }
+        if (!local) {
+            /* semi-global alignment includes the end gaps */
+            DEL(&L, beg_query);
+            INS(&L, beg_ref);
+        }
+        core = align(&L, s1+beg_query, end_query+1-beg_query,
+                s2+beg_ref, end_ref+1-beg_ref, L.g, L.g);
+        if (!local) {
+            DEL(&L, s1Len-1-end_query);
+            INS(&L, s2Len-1-end_ref);
+            beg_query = 0;
+            beg_ref = 0;
+        }
+        *score = core;
+    }
+    path->beg_query = beg_query;
+    path->beg_ref = beg_ref;
+
+    parasail_free(L.SS);
+    parasail_free(L.RR);
+    parasail_free(L.DD);
+    parasail_free(L.CC);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return path;
+}
+
+static parasail_result_t* trace_result(
+        parasail_cigar_t *path, int score, int end_query, int end_ref)
+{
+    parasail_result_t *result = parasail_result_new_trace_path(path);
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NOVEC | PARASAIL_FLAG_TRACE
+        | PARASAIL_FLAG_BITS_INT | PARASAIL_FLAG_LANES_1;
+    return result;
+}
+
+parasail_result_t* parasail_nw_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t *result = NULL;
+    parasail_cigar_t *path = NULL;
+    int score = 0;
+
+    path = trace_path(s1, s1Len, s2, s2Len, open, gap, matrix,
+            0, 0, 0, s1Len-1, s2Len-1, &score);
+    result = trace_result(path, score, s1Len-1, s2Len-1);
+    result->flag |= PARASAIL_FLAG_NW;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t *result = NULL;
+    parasail_result_t *ends = NULL;
+    parasail_cigar_t *path = NULL;
+    int score = 0;
+
+    ends = parasail_sw(s1, s1Len, s2, s2Len, open, gap, matrix);
+    score = ends->score;
+    path = trace_path(s1, s1Len, s2, s2Len, open, gap, matrix,
+            1, 0, 0, ends->end_query, ends->end_ref, &score);
+    result = trace_result(path, ends->score, ends->end_query, ends->end_ref);
+    result->flag |= PARASAIL_FLAG_SW;
+    parasail_result_free(ends);
+
+    return result;
+}
+
+#define FNAME parasail_sg_flags_trace_linear
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end)
+{
+    parasail_result_t *result = NULL;
+    parasail_result_t *ends = NULL;
+    parasail_cigar_t *path = NULL;
+    int score = 0;
+
+    ends = parasail_sg_flags(s1, s1Len, s2, s2Len, open, gap, matrix,
+            s1_beg, s1_end, s2_beg, s2_end);
+    score = ends->score;
+    path = trace_path(s1, s1Len, s2, s2Len, open, gap, matrix,
+            0, s1_beg, s2_beg, ends->end_query, ends->end_ref, &score);
+    result = trace_result(path, ends->score, ends->end_query, ends->end_ref);
+    result->flag |= PARASAIL_FLAG_SG;
+    result->flag |= s1_beg ? PARASAIL_FLAG_SG_S1_BEG : 0;
+    result->flag |= s1_end ? PARASAIL_FLAG_SG_S1_END : 0;
+    result->flag |= s2_beg ? PARASAIL_FLAG_SG_S2_BEG : 0;
+    result->flag |= s2_end ? PARASAIL_FLAG_SG_S2_END : 0;
+    parasail_result_free(ends);
+
+    return result;
+}
+
+SG_IMPL_ALL
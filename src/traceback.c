@@ -63,22 +63,190 @@ static inline char match_char(
     return 'X'; /* shouldn't happen */
 }
 
+/* print the forward-order aligned strings, width columns per block */
+static void print_traceback(
+        const char *qr,
+        const char *ar,
+        const char *dr,
+        int64_t q_pindex,
+        int64_t d_pindex,
+        const char *nameA,
+        const char *nameB,
+        char match, char pos, char neg,
+        int width,
+        int name_width,
+        int use_stats,
+        int int_width,
+        FILE *stream,
+        int score)
+{
+    int64_t namelenA = (NULL == nameA) ? 0 : (int64_t)strlen(nameA);
+    int64_t namelenB = (NULL == nameB) ? 0 : (int64_t)strlen(nameB);
+    int64_t mch = 0;
+    int64_t sim = 0;
+    int64_t gap = 0;
+    int64_t len = strlen(ar);
+    int64_t qi = 0;
+    int64_t ai = 0;
+    int64_t di = 0;
+    int64_t i = 0;
+    int64_t j = 0;
+
+    for (i=0; i<len; i+=width) {
+        fprintf(stream, "\n");
+        for (j=0; j<name_width; ++j) {
+            if (j >= namelenB) break;
+            fprintf(stream, "%c", nameB[j]);
+        }
+        for (; j<name_width; ++j) {
+            fprintf(stream, " ");
+        }
+        fprintf(stream, " %*lld ", int_width, (long long)d_pindex+1);
+        for (j=0; j<len&&j<width&&di<len; ++j) {
+            if (dr[di] != '-') ++d_pindex;
+            fprintf(stream, "%c", dr[di]);
+            ++di;
+        }
+        fprintf(stream, " %*lld\n", int_width, (long long)d_pindex);
+        for (j=0; j<name_width+1+int_width+1; ++j) {
+            fprintf(stream, " ");
+        }
+        for (j=0; j<len&&j<width&&ai<len; ++j) {
+            if (ar[ai] == match) { ++mch; ++sim; }
+            else if (ar[ai] == pos) ++sim;
+            else if (ar[ai] == neg) ;
+            else if (ar[ai] == ' ') ++gap;
+            else {
+                fprintf(stderr, "bad char in traceback '%c'\n", ar[ai]);
+                assert(0);
+            }
+            fprintf(stream, "%c", ar[ai]);
+            ++ai;
+        }
+        fprintf(stream, "\n");
+        for (j=0; j<name_width; ++j) {
+            if (j >= namelenA) break;
+            fprintf(stream, "%c", nameA[j]);
+        }
+        for (; j<name_width; ++j) {
+            fprintf(stream, " ");
+        }
+        fprintf(stream, " %*lld ", int_width, (long long)q_pindex+1);
+        for (j=0; j<len&&j<width&&qi<len; ++j) {
+            if (qr[qi] != '-') ++q_pindex;
+            fprintf(stream, "%c", qr[qi]);
+            ++qi;
+        }
+        fprintf(stream, " %*lld\n", int_width, (long long)q_pindex);
+    }
+    if (use_stats) {
+        fprintf(stream, "\n");
+        fprintf(stream, "Length: %lld\n", (long long)len);
+        fprintf(stream, "Identity:   %*lld/%lld (%4.1f%%)\n", int_width, (long long)mch, (long long)len, 100.0*mch/len);
+        fprintf(stream, "Similarity: %*lld/%lld (%4.1f%%)\n", int_width, (long long)sim, (long long)len, 100.0*sim/len);
+        fprintf(stream, "Gaps:       %*lld/%lld (%4.1f%%)\n", int_width, (long long)gap, (long long)len, 100.0*gap/len);
+        fprintf(stream, "Score: %d\n", score);
+    }
+}
+
+/* linear-memory traces store the path itself, already in forward order */
+static inline parasail_traceback_t* parasail_result_get_traceback_path(
+        parasail_result_t *result,
+        const char *seqA,
+        int lena,
+        const char *seqB,
+        int lenb,
+        const parasail_matrix_t *matrix,
+        char match, char pos, char neg,
+        int case_sensitive,
+        const char *alphabet_aliases_)
+{
+    char alphabet_aliases[256];
+    size_t aliases_size = 0;
+    const parasail_cigar_t *path = (const parasail_cigar_t*)result->trace->trace_table;
+    parasail_traceback_t *traceback = NULL;
+    char *q = malloc(sizeof(char)*(lena+lenb+1));
+    char *d = malloc(sizeof(char)*(lena+lenb+1));
+    char *a = malloc(sizeof(char)*(lena+lenb+1));
+    char *qc = q;
+    char *dc = d;
+    char *ac = a;
+    int64_t i = path->beg_query;
+    int64_t j = path->beg_ref;
+    int k = 0;
+    if (NULL != alphabet_aliases_) {
+        size_t i;
+        aliases_size = strlen(alphabet_aliases_);
+        assert(aliases_size % 2 == 0 && aliases_size < 256); // even number of characters in alias
+        for (i=0; i<aliases_size; ++i) {
+            alphabet_aliases[i] = case_sensitive ? alphabet_aliases_[i] :
+                                                   toupper(alphabet_aliases_[i]);
+        }
+    }
+    for (k=0; k<path->len; ++k) {
+        char op = parasail_cigar_decode_op(path->seq[k]);
+        uint32_t len = parasail_cigar_decode_len(path->seq[k]);
+        uint32_t l;
+        for (l=0; l<len; ++l) {
+            if ('I' == op) {
+                *(qc++) = seqA[i];
+                *(dc++) = '-';
+                *(ac++) = ' ';
+                ++i;
+            }
+            else if ('D' == op) {
+                *(qc++) = '-';
+                *(dc++) = seqB[j];
+                *(ac++) = ' ';
+                ++j;
+            }
+            else {
+                *(qc++) = seqA[i];
+                *(dc++) = seqB[j];
+                *(ac++) = match_char(seqA[i], seqB[j], matrix, match, pos, neg, case_sensitive, alphabet_aliases, aliases_size);
+                ++i;
+                ++j;
+            }
+        }
+    }
+    *(qc++) = '\0';
+    *(dc++) = '\0';
+    *(ac++) = '\0';
+
+    traceback = malloc(sizeof(parasail_traceback_t));
+    traceback->query = q;
+    traceback->comp = a;
+    traceback->ref = d;
+
+    return traceback;
+}
+
 #define CONCAT_(X, Y) X##Y
 #define CONCAT(X, Y) CONCAT_(X, Y)
 #define CONCAT3_(X, Y, Z) X##Y##Z
 #define CONCAT3(X, Y, Z) CONCAT3_(X, Y, Z)
 #define LOC_NOVEC int64_t loc = i*lenb + j;
 #define LOC_STRIPED int64_t loc = j*segLen*segWidth + (i%segLen)*segWidth + (i/segLen);
+#define LOC_PACKED int64_t loc = j*segLenP*segWidth + ((i%segLen)/(T/4))*segWidth + (i/segLen); \
+                   int shift = (int)(4*((i%segLen)%(T/4)));
+
+#define T 8
+#include "traceback_template.c"
+#undef T
 
 #define T 8
+#define STRIPED
 #include "traceback_template.c"
 #undef T
+#undef STRIPED
 
 #define T 8
 #define STRIPED
+#define PACKED
 #include "traceback_template.c"
 #undef T
 #undef STRIPED
+#undef PACKED
 
 #define T 16
 #include "traceback_template.c"
@@ -90,6 +258,14 @@ static inline char match_char(
 #undef T
 #undef STRIPED
 
+#define T 16
+#define STRIPED
+#define PACKED
+#include "traceback_template.c"
+#undef T
+#undef STRIPED
+#undef PACKED
+
 #define T 32
 #include "traceback_template.c"
 #undef T
@@ -100,15 +276,31 @@ static inline char match_char(
 #undef T
 #undef STRIPED
 
+#define T 32
+#define STRIPED
+#define PACKED
+#include "traceback_template.c"
+#undef T
+#undef STRIPED
+#undef PACKED
+
+#define T 64
+#include "traceback_template.c"
+#undef T
+
 #define T 64
+#define STRIPED
 #include "traceback_template.c"
 #undef T
+#undef STRIPED
 
 #define T 64
 #define STRIPED
+#define PACKED
 #include "traceback_template.c"
 #undef T
 #undef STRIPED
+#undef PACKED
 
 parasail_traceback_t* parasail_result_get_traceback_extra(
         parasail_result_t *result,
@@ -123,7 +315,39 @@ parasail_traceback_t* parasail_result_get_traceback_extra(
 {
     assert(parasail_result_is_trace(result));
 
-    if (result->flag & PARASAIL_FLAG_STRIPED
+    if (PARASAIL_TRACE_FORMAT_PATH == result->trace->format) {
+        return parasail_result_get_traceback_path(
+                result, seqA, lena, seqB, lenb,
+                matrix, match, pos, neg,
+                case_sensitive, alphabet_aliases);
+    }
+    else if (PARASAIL_TRACE_FORMAT_PACKED == result->trace->format) {
+        if (result->flag & PARASAIL_FLAG_BITS_8) {
+            return parasail_result_get_traceback_packed_8(
+                    result, seqA, lena, seqB, lenb,
+                    matrix, match, pos, neg,
+                    case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_16) {
+            return parasail_result_get_traceback_packed_16(
+                    result, seqA, lena, seqB, lenb,
+                    matrix, match, pos, neg,
+                    case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_32) {
+            return parasail_result_get_traceback_packed_32(
+                    result, seqA, lena, seqB, lenb,
+                    matrix, match, pos, neg,
+                    case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_64) {
+            return parasail_result_get_traceback_packed_64(
+                    result, seqA, lena, seqB, lenb,
+                    matrix, match, pos, neg,
+                    case_sensitive, alphabet_aliases);
+        }
+    }
+    else if (result->flag & PARASAIL_FLAG_STRIPED
             || result->flag & PARASAIL_FLAG_SCAN) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
             return parasail_result_get_traceback_striped_8(
@@ -201,7 +425,50 @@ void parasail_traceback_generic_extra2(
 {
     assert(parasail_result_is_trace(result));
 
-    if (result->flag & PARASAIL_FLAG_STRIPED
+    if (PARASAIL_TRACE_FORMAT_PATH == result->trace->format) {
+        parasail_traceback_t *traceback = parasail_result_get_traceback_path(
+                result, seqA, lena, seqB, lenb,
+                matrix, match, pos, neg,
+                case_sensitive, alphabet_aliases);
+        const parasail_cigar_t *path = (const parasail_cigar_t*)result->trace->trace_table;
+        char tmp[32];
+        int _int_width = snprintf(tmp, 32, "%llu", (unsigned long long)lena+(unsigned long long)lenb);
+        if (int_width < _int_width) {
+            int_width = _int_width;
+        }
+        print_traceback(traceback->query, traceback->comp, traceback->ref,
+                path->beg_query, path->beg_ref, nameA, nameB,
+                match, pos, neg, width, name_width, use_stats, int_width,
+                stream, result->score);
+        parasail_traceback_free(traceback);
+    }
+    else if (PARASAIL_TRACE_FORMAT_PACKED == result->trace->format) {
+        if (result->flag & PARASAIL_FLAG_BITS_8) {
+            parasail_traceback_packed_8(seqA, lena, seqB, lenb, nameA,
+                    nameB, matrix, result, match, pos, neg, width,
+                    name_width, use_stats, int_width, stream,
+                    case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_16) {
+            parasail_traceback_packed_16(seqA, lena, seqB, lenb, nameA,
+                    nameB, matrix, result, match, pos, neg, width,
+                    name_width, use_stats, int_width, stream,
+                    case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_32) {
+            parasail_traceback_packed_32(seqA, lena, seqB, lenb, nameA,
+                    nameB, matrix, result, match, pos, neg, width,
+                    name_width, use_stats, int_width, stream,
+                    case_sensitive, alphabet_aliases);
+        }
+        else if (result->flag & PARASAIL_FLAG_BITS_64) {
+            parasail_traceback_packed_64(seqA, lena, seqB, lenb, nameA,
+                    nameB, matrix, result, match, pos, neg, width,
+                    name_width, use_stats, int_width, stream,
+                    case_sensitive, alphabet_aliases);
+        }
+    }
+    else if (result->flag & PARASAIL_FLAG_STRIPED
             || result->flag & PARASAIL_FLAG_SCAN) {
         if (result->flag & PARASAIL_FLAG_BITS_8) {
             parasail_traceback_striped_8(seqA, lena, seqB, lenb, nameA,
@@ -1,8 +1,17 @@
 /* this file is only included by traceback.c, multiple times */
 
+#if defined(PACKED)
+#define D CONCAT3(uint, T, _t)
+#define TRACE parasail_trace_unpack((int)((HT[loc] >> shift) & 15))
+#else
 #define D CONCAT3(int, T, _t)
+#define TRACE HT[loc]
+#endif
 
-#if defined(STRIPED)
+#if defined(PACKED)
+#define NAME parasail_result_get_traceback_packed_
+#define LOC LOC_PACKED
+#elif defined(STRIPED)
 #define NAME parasail_result_get_traceback_striped_
 #define LOC LOC_STRIPED
 #else
@@ -37,6 +46,9 @@ static inline parasail_traceback_t* CONCAT(NAME, T) (
 #if defined(STRIPED)
     int64_t segWidth = 0;
     int64_t segLen = 0;
+#if defined(PACKED)
+    int64_t segLenP = 0;
+#endif
     if (result->flag & PARASAIL_FLAG_LANES_1) {
         segWidth = 1;
     }
@@ -59,6 +71,9 @@ static inline parasail_traceback_t* CONCAT(NAME, T) (
         segWidth = 64;
     }
     segLen = (lena + segWidth - 1) / segWidth;
+#endif
+#if defined(PACKED)
+    segLenP = (segLen + T/4 - 1) / (T/4);
 #endif
     if (NULL != alphabet_aliases_) {
         size_t i;
@@ -119,17 +134,17 @@ static inline parasail_traceback_t* CONCAT(NAME, T) (
             break;
         }
         if (PARASAIL_DIAG == where) {
-            if (HT[loc] & PARASAIL_DIAG) {
+            if (TRACE & PARASAIL_DIAG) {
                 *(qc++) = seqA[i];
                 *(dc++) = seqB[j];
                 *(ac++) = match_char(seqA[i], seqB[j], matrix, match, pos, neg, case_sensitive, alphabet_aliases, aliases_size);
                 --i;
                 --j;
             }
-            else if (HT[loc] & PARASAIL_INS) {
+            else if (TRACE & PARASAIL_INS) {
                 where = PARASAIL_INS;
             }
-            else if (HT[loc] & PARASAIL_DEL) {
+            else if (TRACE & PARASAIL_DEL) {
                 where = PARASAIL_DEL;
             }
             else {
@@ -141,10 +156,10 @@ static inline parasail_traceback_t* CONCAT(NAME, T) (
             *(dc++) = seqB[j];
             *(ac++) = ' ';
             --j;
-            if (HT[loc] & PARASAIL_DIAG_E) {
+            if (TRACE & PARASAIL_DIAG_E) {
                 where = PARASAIL_DIAG;
             }
-            else if (HT[loc] & PARASAIL_INS_E) {
+            else if (TRACE & PARASAIL_INS_E) {
                 where = PARASAIL_INS;
             }
             else {
@@ -156,10 +171,10 @@ static inline parasail_traceback_t* CONCAT(NAME, T) (
             *(dc++) = '-';
             *(ac++) = ' ';
             --i;
-            if (HT[loc] & PARASAIL_DIAG_F) {
+            if (TRACE & PARASAIL_DIAG_F) {
                 where = PARASAIL_DIAG;
             }
-            else if (HT[loc] & PARASAIL_DEL_F) {
+            else if (TRACE & PARASAIL_DEL_F) {
                 where = PARASAIL_DEL;
             }
             else {
@@ -192,7 +207,10 @@ static inline parasail_traceback_t* CONCAT(NAME, T) (
 #undef NAME
 #undef LOC
 
-#if defined(STRIPED)
+#if defined(PACKED)
+#define NAME parasail_traceback_packed_
+#define LOC LOC_PACKED
+#elif defined(STRIPED)
 #define NAME parasail_traceback_striped_
 #define LOC LOC_STRIPED
 #else
@@ -232,13 +250,14 @@ static inline void CONCAT(NAME, T) (
     int64_t c_ins = 0;
     int64_t c_del = 0;
     D *HT = (D*)result->trace->trace_table;
-    int64_t namelenA = (NULL == nameA) ? 0 : (int64_t)strlen(nameA);
-    int64_t namelenB = (NULL == nameB) ? 0 : (int64_t)strlen(nameB);
     char tmp[32];
     int _int_width = 0;
 #if defined(STRIPED)
     int64_t segWidth = 0;
     int64_t segLen = 0;
+#if defined(PACKED)
+    int64_t segLenP = 0;
+#endif
     if (result->flag & PARASAIL_FLAG_LANES_1) {
         segWidth = 1;
     }
@@ -261,6 +280,9 @@ static inline void CONCAT(NAME, T) (
         segWidth = 64;
     }
     segLen = (lena + segWidth - 1) / segWidth;
+#endif
+#if defined(PACKED)
+    segLenP = (segLen + T/4 - 1) / (T/4);
 #endif
     if (NULL != alphabet_aliases_) {
         size_t i;
@@ -331,17 +353,17 @@ static inline void CONCAT(NAME, T) (
             break;
         }
         if (PARASAIL_DIAG == where) {
-            if (HT[loc] & PARASAIL_DIAG) {
+            if (TRACE & PARASAIL_DIAG) {
                 *(qc++) = seqA[i];
                 *(dc++) = seqB[j];
                 *(ac++) = match_char(seqA[i], seqB[j], matrix, match, pos, neg, case_sensitive, alphabet_aliases, aliases_size);
                 --i;
                 --j;
             }
-            else if (HT[loc] & PARASAIL_INS) {
+            else if (TRACE & PARASAIL_INS) {
                 where = PARASAIL_INS;
             }
-            else if (HT[loc] & PARASAIL_DEL) {
+            else if (TRACE & PARASAIL_DEL) {
                 where = PARASAIL_DEL;
             }
             else {
@@ -354,10 +376,10 @@ static inline void CONCAT(NAME, T) (
             *(dc++) = seqB[j];
             *(ac++) = ' ';
             --j;
-            if (HT[loc] & PARASAIL_DIAG_E) {
+            if (TRACE & PARASAIL_DIAG_E) {
                 where = PARASAIL_DIAG;
             }
-            else if (HT[loc] & PARASAIL_INS_E) {
+            else if (TRACE & PARASAIL_INS_E) {
                 where = PARASAIL_INS;
             }
             else {
@@ -370,10 +392,10 @@ static inline void CONCAT(NAME, T) (
             *(dc++) = '-';
             *(ac++) = ' ';
             --i;
-            if (HT[loc] & PARASAIL_DIAG_F) {
+            if (TRACE & PARASAIL_DIAG_F) {
                 where = PARASAIL_DIAG;
             }
-            else if (HT[loc] & PARASAIL_DEL_F) {
+            else if (TRACE & PARASAIL_DEL_F) {
                 where = PARASAIL_DEL;
             }
             else {
@@ -391,19 +413,13 @@ static inline void CONCAT(NAME, T) (
     *(dc++) = '\0';
     *(ac++) = '\0';
 
-    if (1) {
+    {
         char *qr = NULL;
         char *ar = NULL;
         char *dr = NULL;
-        int64_t mch = 0;
-        int64_t sim = 0;
-        int64_t gap = 0;
         int64_t len = strlen(a);
         int64_t q_pindex = 0;
         int64_t d_pindex = 0;
-        int64_t qi = 0;
-        int64_t ai = 0;
-        int64_t di = 0;
 
         if (result->flag & PARASAIL_FLAG_SW) {
             q_pindex = result->end_query + 1 - len + c_ins;
@@ -416,70 +432,13 @@ static inline void CONCAT(NAME, T) (
         qr = parasail_reverse(q, strlen(q));
         ar = parasail_reverse(a, strlen(a));
         dr = parasail_reverse(d, strlen(d));
-        for (i=0; i<len; i+=width) {
-            fprintf(stream, "\n");
-            for (j=0; j<name_width; ++j) {
-                if (j >= namelenB) break;
-                fprintf(stream, "%c", nameB[j]);
-            }
-            for (; j<name_width; ++j) {
-                fprintf(stream, " ");
-            }
-            fprintf(stream, " %*lld ", int_width, (long long)d_pindex+1);
-            for (j=0; j<len&&j<width&&di<len; ++j) {
-                if (dr[di] != '-') ++d_pindex;
-                fprintf(stream, "%c", dr[di]);
-                ++di;
-            }
-            fprintf(stream, " %*lld\n", int_width, (long long)d_pindex);
-            for (j=0; j<name_width+1+int_width+1; ++j) {
-                fprintf(stream, " ");
-            }
-            for (j=0; j<len&&j<width&&ai<len; ++j) {
-                if (ar[ai] == match) { ++mch; ++sim; }
-                else if (ar[ai] == pos) ++sim;
-                else if (ar[ai] == neg) ;
-                else if (ar[ai] == ' ') ++gap;
-                else {
-                    fprintf(stderr, "bad char in traceback '%c'\n", ar[ai]);
-                    assert(0);
-                }
-                fprintf(stream, "%c", ar[ai]);
-                ++ai;
-            }
-            fprintf(stream, "\n");
-            for (j=0; j<name_width; ++j) {
-                if (j >= namelenA) break;
-                fprintf(stream, "%c", nameA[j]);
-            }
-            for (; j<name_width; ++j) {
-                fprintf(stream, " ");
-            }
-            fprintf(stream, " %*lld ", int_width, (long long)q_pindex+1);
-            for (j=0; j<len&&j<width&&qi<len; ++j) {
-                if (qr[qi] != '-') ++q_pindex;
-                fprintf(stream, "%c", qr[qi]);
-                ++qi;
-            }
-            fprintf(stream, " %*lld\n", int_width, (long long)q_pindex);
-        }
-        if (use_stats) {
-            fprintf(stream, "\n");
-            fprintf(stream, "Length: %lld\n", (long long)len);
-            fprintf(stream, "Identity:   %*lld/%lld (%4.1f%%)\n", int_width, (long long)mch, (long long)len, 100.0*mch/len);
-            fprintf(stream, "Similarity: %*lld/%lld (%4.1f%%)\n", int_width, (long long)sim, (long long)len, 100.0*sim/len);
-            fprintf(stream, "Gaps:       %*lld/%lld (%4.1f%%)\n", int_width, (long long)gap, (long long)len, 100.0*gap/len);
-            fprintf(stream, "Score: %d\n", result->score);
-        }
+        print_traceback(qr, ar, dr, q_pindex, d_pindex, nameA, nameB,
+                match, pos, neg, width, name_width, use_stats, int_width,
+                stream, result->score);
         free(qr);
         free(ar);
         free(dr);
     }
-    else {
-        fprintf(stream, "%s\n", q);
-        fprintf(stream, "%s\n", a);
-        fprintf(stream, "%s\n", d);
-    }
 
     free(q);
     free(d);
@@ -489,4 +448,5 @@ static inline void CONCAT(NAME, T) (
 #undef NAME
 #undef LOC
 #undef D
+#undef TRACE
 
@@ -75,6 +75,26 @@ static parasail_function_info_t parasail_nw_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_avx2 = {"parasail_nw_avx2", parasail_nw_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_avx512_functions[] = {
+{parasail_nw,                         "parasail_nw",                         "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_nw_scan,                    "parasail_nw_scan",                    "nw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512_512_64,      "parasail_nw_scan_avx512_512_64",      "nw",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512_512_32,      "parasail_nw_scan_avx512_512_32",      "nw",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512_512_16,      "parasail_nw_scan_avx512_512_16",      "nw",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512_512_8,       "parasail_nw_scan_avx512_512_8",       "nw",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_64,   "parasail_nw_striped_avx512_512_64",   "nw", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_32,   "parasail_nw_striped_avx512_512_32",   "nw", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_16,   "parasail_nw_striped_avx512_512_16",   "nw", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512_512_8,    "parasail_nw_striped_avx512_512_8",    "nw", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_64,      "parasail_nw_diag_avx512_512_64",      "nw",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_32,      "parasail_nw_diag_avx512_512_32",      "nw",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_16,      "parasail_nw_diag_avx512_512_16",      "nw",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512_512_8,       "parasail_nw_diag_avx512_512_8",       "nw",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_avx512 = {"parasail_nw_avx512", parasail_nw_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_altivec_functions[] = {
 {parasail_nw,                         "parasail_nw",                         "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -202,6 +222,26 @@ static parasail_function_info_t parasail_sg_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_avx2 = {"parasail_sg_avx2", parasail_sg_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_avx512_functions[] = {
+{parasail_sg,                         "parasail_sg",                         "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_scan,                    "parasail_sg_scan",                    "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512_512_64,      "parasail_sg_scan_avx512_512_64",      "sg",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512_512_32,      "parasail_sg_scan_avx512_512_32",      "sg",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512_512_16,      "parasail_sg_scan_avx512_512_16",      "sg",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512_512_8,       "parasail_sg_scan_avx512_512_8",       "sg",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_64,   "parasail_sg_striped_avx512_512_64",   "sg", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_32,   "parasail_sg_striped_avx512_512_32",   "sg", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_16,   "parasail_sg_striped_avx512_512_16",   "sg", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512_512_8,    "parasail_sg_striped_avx512_512_8",    "sg", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_64,      "parasail_sg_diag_avx512_512_64",      "sg",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_32,      "parasail_sg_diag_avx512_512_32",      "sg",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_16,      "parasail_sg_diag_avx512_512_16",      "sg",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512_512_8,       "parasail_sg_diag_avx512_512_8",       "sg",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_avx512 = {"parasail_sg_avx512", parasail_sg_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_altivec_functions[] = {
 {parasail_sg,                         "parasail_sg",                         "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -329,6 +369,26 @@ static parasail_function_info_t parasail_sw_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_avx2 = {"parasail_sw_avx2", parasail_sw_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_avx512_functions[] = {
+{parasail_sw,                         "parasail_sw",                         "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sw_scan,                    "parasail_sw_scan",                    "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512_512_64,      "parasail_sw_scan_avx512_512_64",      "sw",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512_512_32,      "parasail_sw_scan_avx512_512_32",      "sw",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512_512_16,      "parasail_sw_scan_avx512_512_16",      "sw",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512_512_8,       "parasail_sw_scan_avx512_512_8",       "sw",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_64,   "parasail_sw_striped_avx512_512_64",   "sw", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_32,   "parasail_sw_striped_avx512_512_32",   "sw", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_16,   "parasail_sw_striped_avx512_512_16",   "sw", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512_512_8,    "parasail_sw_striped_avx512_512_8",    "sw", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_64,      "parasail_sw_diag_avx512_512_64",      "sw",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_32,      "parasail_sw_diag_avx512_512_32",      "sw",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_16,      "parasail_sw_diag_avx512_512_16",      "sw",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512_512_8,       "parasail_sw_diag_avx512_512_8",       "sw",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_avx512 = {"parasail_sw_avx512", parasail_sw_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_altivec_functions[] = {
 {parasail_sw,                         "parasail_sw",                         "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -456,6 +516,26 @@ static parasail_function_info_t parasail_sg_qb_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_avx2 = {"parasail_sg_qb_avx2", parasail_sg_qb_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_avx512_functions[] = {
+{parasail_sg_qb,                      "parasail_sg_qb",                      "sg_qb",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qb_scan,                 "parasail_sg_qb_scan",                 "sg_qb",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_avx512_512_64,   "parasail_sg_qb_scan_avx512_512_64",   "sg_qb",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_avx512_512_32,   "parasail_sg_qb_scan_avx512_512_32",   "sg_qb",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_avx512_512_16,   "parasail_sg_qb_scan_avx512_512_16",   "sg_qb",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_scan_avx512_512_8,    "parasail_sg_qb_scan_avx512_512_8",    "sg_qb",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_64, "parasail_sg_qb_striped_avx512_512_64", "sg_qb", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_32, "parasail_sg_qb_striped_avx512_512_32", "sg_qb", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_16, "parasail_sg_qb_striped_avx512_512_16", "sg_qb", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_striped_avx512_512_8, "parasail_sg_qb_striped_avx512_512_8", "sg_qb", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_64,   "parasail_sg_qb_diag_avx512_512_64",   "sg_qb",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_32,   "parasail_sg_qb_diag_avx512_512_32",   "sg_qb",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_16,   "parasail_sg_qb_diag_avx512_512_16",   "sg_qb",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_diag_avx512_512_8,    "parasail_sg_qb_diag_avx512_512_8",    "sg_qb",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_avx512 = {"parasail_sg_qb_avx512", parasail_sg_qb_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_altivec_functions[] = {
 {parasail_sg_qb,                      "parasail_sg_qb",                      "sg_qb",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -583,6 +663,26 @@ static parasail_function_info_t parasail_sg_qe_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_avx2 = {"parasail_sg_qe_avx2", parasail_sg_qe_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_avx512_functions[] = {
+{parasail_sg_qe,                      "parasail_sg_qe",                      "sg_qe",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qe_scan,                 "parasail_sg_qe_scan",                 "sg_qe",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_avx512_512_64,   "parasail_sg_qe_scan_avx512_512_64",   "sg_qe",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_avx512_512_32,   "parasail_sg_qe_scan_avx512_512_32",   "sg_qe",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_avx512_512_16,   "parasail_sg_qe_scan_avx512_512_16",   "sg_qe",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_scan_avx512_512_8,    "parasail_sg_qe_scan_avx512_512_8",    "sg_qe",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_64, "parasail_sg_qe_striped_avx512_512_64", "sg_qe", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_32, "parasail_sg_qe_striped_avx512_512_32", "sg_qe", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_16, "parasail_sg_qe_striped_avx512_512_16", "sg_qe", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_striped_avx512_512_8, "parasail_sg_qe_striped_avx512_512_8", "sg_qe", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_64,   "parasail_sg_qe_diag_avx512_512_64",   "sg_qe",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_32,   "parasail_sg_qe_diag_avx512_512_32",   "sg_qe",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_16,   "parasail_sg_qe_diag_avx512_512_16",   "sg_qe",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_diag_avx512_512_8,    "parasail_sg_qe_diag_avx512_512_8",    "sg_qe",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_avx512 = {"parasail_sg_qe_avx512", parasail_sg_qe_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_altivec_functions[] = {
 {parasail_sg_qe,                      "parasail_sg_qe",                      "sg_qe",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -710,6 +810,26 @@ static parasail_function_info_t parasail_sg_qx_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qx_avx2 = {"parasail_sg_qx_avx2", parasail_sg_qx_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qx_avx512_functions[] = {
+{parasail_sg_qx,                      "parasail_sg_qx",                      "sg_qx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qx_scan,                 "parasail_sg_qx_scan",                 "sg_qx",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_avx512_512_64,   "parasail_sg_qx_scan_avx512_512_64",   "sg_qx",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_avx512_512_32,   "parasail_sg_qx_scan_avx512_512_32",   "sg_qx",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_avx512_512_16,   "parasail_sg_qx_scan_avx512_512_16",   "sg_qx",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_scan_avx512_512_8,    "parasail_sg_qx_scan_avx512_512_8",    "sg_qx",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_64, "parasail_sg_qx_striped_avx512_512_64", "sg_qx", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_32, "parasail_sg_qx_striped_avx512_512_32", "sg_qx", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_16, "parasail_sg_qx_striped_avx512_512_16", "sg_qx", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_striped_avx512_512_8, "parasail_sg_qx_striped_avx512_512_8", "sg_qx", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_64,   "parasail_sg_qx_diag_avx512_512_64",   "sg_qx",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_32,   "parasail_sg_qx_diag_avx512_512_32",   "sg_qx",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_16,   "parasail_sg_qx_diag_avx512_512_16",   "sg_qx",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_diag_avx512_512_8,    "parasail_sg_qx_diag_avx512_512_8",    "sg_qx",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qx_avx512 = {"parasail_sg_qx_avx512", parasail_sg_qx_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qx_altivec_functions[] = {
 {parasail_sg_qx,                      "parasail_sg_qx",                      "sg_qx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -837,6 +957,26 @@ static parasail_function_info_t parasail_sg_db_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_db_avx2 = {"parasail_sg_db_avx2", parasail_sg_db_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_db_avx512_functions[] = {
+{parasail_sg_db,                      "parasail_sg_db",                      "sg_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_db_scan,                 "parasail_sg_db_scan",                 "sg_db",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_avx512_512_64,   "parasail_sg_db_scan_avx512_512_64",   "sg_db",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_avx512_512_32,   "parasail_sg_db_scan_avx512_512_32",   "sg_db",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_avx512_512_16,   "parasail_sg_db_scan_avx512_512_16",   "sg_db",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_scan_avx512_512_8,    "parasail_sg_db_scan_avx512_512_8",    "sg_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_64, "parasail_sg_db_striped_avx512_512_64", "sg_db", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_32, "parasail_sg_db_striped_avx512_512_32", "sg_db", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_16, "parasail_sg_db_striped_avx512_512_16", "sg_db", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_striped_avx512_512_8, "parasail_sg_db_striped_avx512_512_8", "sg_db", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_64,   "parasail_sg_db_diag_avx512_512_64",   "sg_db",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_32,   "parasail_sg_db_diag_avx512_512_32",   "sg_db",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_16,   "parasail_sg_db_diag_avx512_512_16",   "sg_db",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_diag_avx512_512_8,    "parasail_sg_db_diag_avx512_512_8",    "sg_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_db_avx512 = {"parasail_sg_db_avx512", parasail_sg_db_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_db_altivec_functions[] = {
 {parasail_sg_db,                      "parasail_sg_db",                      "sg_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -964,6 +1104,26 @@ static parasail_function_info_t parasail_sg_de_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_de_avx2 = {"parasail_sg_de_avx2", parasail_sg_de_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_de_avx512_functions[] = {
+{parasail_sg_de,                      "parasail_sg_de",                      "sg_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_de_scan,                 "parasail_sg_de_scan",                 "sg_de",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_avx512_512_64,   "parasail_sg_de_scan_avx512_512_64",   "sg_de",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_avx512_512_32,   "parasail_sg_de_scan_avx512_512_32",   "sg_de",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_avx512_512_16,   "parasail_sg_de_scan_avx512_512_16",   "sg_de",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_scan_avx512_512_8,    "parasail_sg_de_scan_avx512_512_8",    "sg_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_64, "parasail_sg_de_striped_avx512_512_64", "sg_de", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_32, "parasail_sg_de_striped_avx512_512_32", "sg_de", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_16, "parasail_sg_de_striped_avx512_512_16", "sg_de", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_striped_avx512_512_8, "parasail_sg_de_striped_avx512_512_8", "sg_de", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_64,   "parasail_sg_de_diag_avx512_512_64",   "sg_de",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_32,   "parasail_sg_de_diag_avx512_512_32",   "sg_de",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_16,   "parasail_sg_de_diag_avx512_512_16",   "sg_de",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_diag_avx512_512_8,    "parasail_sg_de_diag_avx512_512_8",    "sg_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_de_avx512 = {"parasail_sg_de_avx512", parasail_sg_de_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_de_altivec_functions[] = {
 {parasail_sg_de,                      "parasail_sg_de",                      "sg_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -1091,6 +1251,26 @@ static parasail_function_info_t parasail_sg_dx_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_dx_avx2 = {"parasail_sg_dx_avx2", parasail_sg_dx_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_dx_avx512_functions[] = {
+{parasail_sg_dx,                      "parasail_sg_dx",                      "sg_dx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_dx_scan,                 "parasail_sg_dx_scan",                 "sg_dx",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_avx512_512_64,   "parasail_sg_dx_scan_avx512_512_64",   "sg_dx",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_avx512_512_32,   "parasail_sg_dx_scan_avx512_512_32",   "sg_dx",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_avx512_512_16,   "parasail_sg_dx_scan_avx512_512_16",   "sg_dx",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_scan_avx512_512_8,    "parasail_sg_dx_scan_avx512_512_8",    "sg_dx",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_64, "parasail_sg_dx_striped_avx512_512_64", "sg_dx", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_32, "parasail_sg_dx_striped_avx512_512_32", "sg_dx", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_16, "parasail_sg_dx_striped_avx512_512_16", "sg_dx", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_striped_avx512_512_8, "parasail_sg_dx_striped_avx512_512_8", "sg_dx", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_64,   "parasail_sg_dx_diag_avx512_512_64",   "sg_dx",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_32,   "parasail_sg_dx_diag_avx512_512_32",   "sg_dx",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_16,   "parasail_sg_dx_diag_avx512_512_16",   "sg_dx",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_diag_avx512_512_8,    "parasail_sg_dx_diag_avx512_512_8",    "sg_dx",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_dx_avx512 = {"parasail_sg_dx_avx512", parasail_sg_dx_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_dx_altivec_functions[] = {
 {parasail_sg_dx,                      "parasail_sg_dx",                      "sg_dx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -1218,6 +1398,26 @@ static parasail_function_info_t parasail_sg_qb_de_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_de_avx2 = {"parasail_sg_qb_de_avx2", parasail_sg_qb_de_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_de_avx512_functions[] = {
+{parasail_sg_qb_de,                   "parasail_sg_qb_de",                   "sg_qb_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qb_de_scan,              "parasail_sg_qb_de_scan",              "sg_qb_de",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_avx512_512_64, "parasail_sg_qb_de_scan_avx512_512_64", "sg_qb_de",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_avx512_512_32, "parasail_sg_qb_de_scan_avx512_512_32", "sg_qb_de",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_avx512_512_16, "parasail_sg_qb_de_scan_avx512_512_16", "sg_qb_de",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_scan_avx512_512_8, "parasail_sg_qb_de_scan_avx512_512_8", "sg_qb_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_64, "parasail_sg_qb_de_striped_avx512_512_64", "sg_qb_de", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_32, "parasail_sg_qb_de_striped_avx512_512_32", "sg_qb_de", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_16, "parasail_sg_qb_de_striped_avx512_512_16", "sg_qb_de", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_striped_avx512_512_8, "parasail_sg_qb_de_striped_avx512_512_8", "sg_qb_de", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_64, "parasail_sg_qb_de_diag_avx512_512_64", "sg_qb_de",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_32, "parasail_sg_qb_de_diag_avx512_512_32", "sg_qb_de",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_16, "parasail_sg_qb_de_diag_avx512_512_16", "sg_qb_de",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_diag_avx512_512_8, "parasail_sg_qb_de_diag_avx512_512_8", "sg_qb_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_de_avx512 = {"parasail_sg_qb_de_avx512", parasail_sg_qb_de_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_de_altivec_functions[] = {
 {parasail_sg_qb_de,                   "parasail_sg_qb_de",                   "sg_qb_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -1345,6 +1545,26 @@ static parasail_function_info_t parasail_sg_qe_db_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_db_avx2 = {"parasail_sg_qe_db_avx2", parasail_sg_qe_db_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_db_avx512_functions[] = {
+{parasail_sg_qe_db,                   "parasail_sg_qe_db",                   "sg_qe_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qe_db_scan,              "parasail_sg_qe_db_scan",              "sg_qe_db",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_avx512_512_64, "parasail_sg_qe_db_scan_avx512_512_64", "sg_qe_db",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_avx512_512_32, "parasail_sg_qe_db_scan_avx512_512_32", "sg_qe_db",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_avx512_512_16, "parasail_sg_qe_db_scan_avx512_512_16", "sg_qe_db",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_scan_avx512_512_8, "parasail_sg_qe_db_scan_avx512_512_8", "sg_qe_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_64, "parasail_sg_qe_db_striped_avx512_512_64", "sg_qe_db", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_32, "parasail_sg_qe_db_striped_avx512_512_32", "sg_qe_db", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_16, "parasail_sg_qe_db_striped_avx512_512_16", "sg_qe_db", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_striped_avx512_512_8, "parasail_sg_qe_db_striped_avx512_512_8", "sg_qe_db", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_64, "parasail_sg_qe_db_diag_avx512_512_64", "sg_qe_db",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_32, "parasail_sg_qe_db_diag_avx512_512_32", "sg_qe_db",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_16, "parasail_sg_qe_db_diag_avx512_512_16", "sg_qe_db",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_diag_avx512_512_8, "parasail_sg_qe_db_diag_avx512_512_8", "sg_qe_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_db_avx512 = {"parasail_sg_qe_db_avx512", parasail_sg_qe_db_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_db_altivec_functions[] = {
 {parasail_sg_qe_db,                   "parasail_sg_qe_db",                   "sg_qe_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -1472,6 +1692,26 @@ static parasail_function_info_t parasail_nw_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_stats_avx2 = {"parasail_nw_stats_avx2", parasail_nw_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_stats_avx512_functions[] = {
+{parasail_nw_stats,                   "parasail_nw_stats",                   "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_nw_stats_scan,              "parasail_nw_stats_scan",              "nw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512_512_64, "parasail_nw_stats_scan_avx512_512_64", "nw_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512_512_32, "parasail_nw_stats_scan_avx512_512_32", "nw_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512_512_16, "parasail_nw_stats_scan_avx512_512_16", "nw_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512_512_8, "parasail_nw_stats_scan_avx512_512_8", "nw_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_64, "parasail_nw_stats_striped_avx512_512_64", "nw_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_32, "parasail_nw_stats_striped_avx512_512_32", "nw_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_16, "parasail_nw_stats_striped_avx512_512_16", "nw_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512_512_8, "parasail_nw_stats_striped_avx512_512_8", "nw_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_64, "parasail_nw_stats_diag_avx512_512_64", "nw_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_32, "parasail_nw_stats_diag_avx512_512_32", "nw_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_16, "parasail_nw_stats_diag_avx512_512_16", "nw_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512_512_8, "parasail_nw_stats_diag_avx512_512_8", "nw_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_stats_avx512 = {"parasail_nw_stats_avx512", parasail_nw_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_stats_altivec_functions[] = {
 {parasail_nw_stats,                   "parasail_nw_stats",                   "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -1599,6 +1839,26 @@ static parasail_function_info_t parasail_sg_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_stats_avx2 = {"parasail_sg_stats_avx2", parasail_sg_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_stats_avx512_functions[] = {
+{parasail_sg_stats,                   "parasail_sg_stats",                   "sg_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_stats_scan,              "parasail_sg_stats_scan",              "sg_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512_512_64, "parasail_sg_stats_scan_avx512_512_64", "sg_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512_512_32, "parasail_sg_stats_scan_avx512_512_32", "sg_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512_512_16, "parasail_sg_stats_scan_avx512_512_16", "sg_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512_512_8, "parasail_sg_stats_scan_avx512_512_8", "sg_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_64, "parasail_sg_stats_striped_avx512_512_64", "sg_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_32, "parasail_sg_stats_striped_avx512_512_32", "sg_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_16, "parasail_sg_stats_striped_avx512_512_16", "sg_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512_512_8, "parasail_sg_stats_striped_avx512_512_8", "sg_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_64, "parasail_sg_stats_diag_avx512_512_64", "sg_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_32, "parasail_sg_stats_diag_avx512_512_32", "sg_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_16, "parasail_sg_stats_diag_avx512_512_16", "sg_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512_512_8, "parasail_sg_stats_diag_avx512_512_8", "sg_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_stats_avx512 = {"parasail_sg_stats_avx512", parasail_sg_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_stats_altivec_functions[] = {
 {parasail_sg_stats,                   "parasail_sg_stats",                   "sg_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -1726,6 +1986,26 @@ static parasail_function_info_t parasail_sw_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_stats_avx2 = {"parasail_sw_stats_avx2", parasail_sw_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_stats_avx512_functions[] = {
+{parasail_sw_stats,                   "parasail_sw_stats",                   "sw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sw_stats_scan,              "parasail_sw_stats_scan",              "sw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512_512_64, "parasail_sw_stats_scan_avx512_512_64", "sw_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512_512_32, "parasail_sw_stats_scan_avx512_512_32", "sw_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512_512_16, "parasail_sw_stats_scan_avx512_512_16", "sw_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512_512_8, "parasail_sw_stats_scan_avx512_512_8", "sw_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_64, "parasail_sw_stats_striped_avx512_512_64", "sw_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_32, "parasail_sw_stats_striped_avx512_512_32", "sw_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_16, "parasail_sw_stats_striped_avx512_512_16", "sw_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512_512_8, "parasail_sw_stats_striped_avx512_512_8", "sw_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_64, "parasail_sw_stats_diag_avx512_512_64", "sw_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_32, "parasail_sw_stats_diag_avx512_512_32", "sw_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_16, "parasail_sw_stats_diag_avx512_512_16", "sw_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512_512_8, "parasail_sw_stats_diag_avx512_512_8", "sw_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_stats_avx512 = {"parasail_sw_stats_avx512", parasail_sw_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_stats_altivec_functions[] = {
 {parasail_sw_stats,                   "parasail_sw_stats",                   "sw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -1853,6 +2133,26 @@ static parasail_function_info_t parasail_sg_qb_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_stats_avx2 = {"parasail_sg_qb_stats_avx2", parasail_sg_qb_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_stats_avx512_functions[] = {
+{parasail_sg_qb_stats,                "parasail_sg_qb_stats",                "sg_qb_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qb_stats_scan,           "parasail_sg_qb_stats_scan",           "sg_qb_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_avx512_512_64, "parasail_sg_qb_stats_scan_avx512_512_64", "sg_qb_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_avx512_512_32, "parasail_sg_qb_stats_scan_avx512_512_32", "sg_qb_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_avx512_512_16, "parasail_sg_qb_stats_scan_avx512_512_16", "sg_qb_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_scan_avx512_512_8, "parasail_sg_qb_stats_scan_avx512_512_8", "sg_qb_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_64, "parasail_sg_qb_stats_striped_avx512_512_64", "sg_qb_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_32, "parasail_sg_qb_stats_striped_avx512_512_32", "sg_qb_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_16, "parasail_sg_qb_stats_striped_avx512_512_16", "sg_qb_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_striped_avx512_512_8, "parasail_sg_qb_stats_striped_avx512_512_8", "sg_qb_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_64, "parasail_sg_qb_stats_diag_avx512_512_64", "sg_qb_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_32, "parasail_sg_qb_stats_diag_avx512_512_32", "sg_qb_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_16, "parasail_sg_qb_stats_diag_avx512_512_16", "sg_qb_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_diag_avx512_512_8, "parasail_sg_qb_stats_diag_avx512_512_8", "sg_qb_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_stats_avx512 = {"parasail_sg_qb_stats_avx512", parasail_sg_qb_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_stats_altivec_functions[] = {
 {parasail_sg_qb_stats,                "parasail_sg_qb_stats",                "sg_qb_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -1980,6 +2280,26 @@ static parasail_function_info_t parasail_sg_qe_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_stats_avx2 = {"parasail_sg_qe_stats_avx2", parasail_sg_qe_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_stats_avx512_functions[] = {
+{parasail_sg_qe_stats,                "parasail_sg_qe_stats",                "sg_qe_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qe_stats_scan,           "parasail_sg_qe_stats_scan",           "sg_qe_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_avx512_512_64, "parasail_sg_qe_stats_scan_avx512_512_64", "sg_qe_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_avx512_512_32, "parasail_sg_qe_stats_scan_avx512_512_32", "sg_qe_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_avx512_512_16, "parasail_sg_qe_stats_scan_avx512_512_16", "sg_qe_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_scan_avx512_512_8, "parasail_sg_qe_stats_scan_avx512_512_8", "sg_qe_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_64, "parasail_sg_qe_stats_striped_avx512_512_64", "sg_qe_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_32, "parasail_sg_qe_stats_striped_avx512_512_32", "sg_qe_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_16, "parasail_sg_qe_stats_striped_avx512_512_16", "sg_qe_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_striped_avx512_512_8, "parasail_sg_qe_stats_striped_avx512_512_8", "sg_qe_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_64, "parasail_sg_qe_stats_diag_avx512_512_64", "sg_qe_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_32, "parasail_sg_qe_stats_diag_avx512_512_32", "sg_qe_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_16, "parasail_sg_qe_stats_diag_avx512_512_16", "sg_qe_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_diag_avx512_512_8, "parasail_sg_qe_stats_diag_avx512_512_8", "sg_qe_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_stats_avx512 = {"parasail_sg_qe_stats_avx512", parasail_sg_qe_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_stats_altivec_functions[] = {
 {parasail_sg_qe_stats,                "parasail_sg_qe_stats",                "sg_qe_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2107,6 +2427,26 @@ static parasail_function_info_t parasail_sg_qx_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qx_stats_avx2 = {"parasail_sg_qx_stats_avx2", parasail_sg_qx_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qx_stats_avx512_functions[] = {
+{parasail_sg_qx_stats,                "parasail_sg_qx_stats",                "sg_qx_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qx_stats_scan,           "parasail_sg_qx_stats_scan",           "sg_qx_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_avx512_512_64, "parasail_sg_qx_stats_scan_avx512_512_64", "sg_qx_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_avx512_512_32, "parasail_sg_qx_stats_scan_avx512_512_32", "sg_qx_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_avx512_512_16, "parasail_sg_qx_stats_scan_avx512_512_16", "sg_qx_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_scan_avx512_512_8, "parasail_sg_qx_stats_scan_avx512_512_8", "sg_qx_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_64, "parasail_sg_qx_stats_striped_avx512_512_64", "sg_qx_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_32, "parasail_sg_qx_stats_striped_avx512_512_32", "sg_qx_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_16, "parasail_sg_qx_stats_striped_avx512_512_16", "sg_qx_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_striped_avx512_512_8, "parasail_sg_qx_stats_striped_avx512_512_8", "sg_qx_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_64, "parasail_sg_qx_stats_diag_avx512_512_64", "sg_qx_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_32, "parasail_sg_qx_stats_diag_avx512_512_32", "sg_qx_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_16, "parasail_sg_qx_stats_diag_avx512_512_16", "sg_qx_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_diag_avx512_512_8, "parasail_sg_qx_stats_diag_avx512_512_8", "sg_qx_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qx_stats_avx512 = {"parasail_sg_qx_stats_avx512", parasail_sg_qx_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qx_stats_altivec_functions[] = {
 {parasail_sg_qx_stats,                "parasail_sg_qx_stats",                "sg_qx_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2234,6 +2574,26 @@ static parasail_function_info_t parasail_sg_db_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_db_stats_avx2 = {"parasail_sg_db_stats_avx2", parasail_sg_db_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_db_stats_avx512_functions[] = {
+{parasail_sg_db_stats,                "parasail_sg_db_stats",                "sg_db_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_db_stats_scan,           "parasail_sg_db_stats_scan",           "sg_db_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_avx512_512_64, "parasail_sg_db_stats_scan_avx512_512_64", "sg_db_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_avx512_512_32, "parasail_sg_db_stats_scan_avx512_512_32", "sg_db_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_avx512_512_16, "parasail_sg_db_stats_scan_avx512_512_16", "sg_db_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_scan_avx512_512_8, "parasail_sg_db_stats_scan_avx512_512_8", "sg_db_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_64, "parasail_sg_db_stats_striped_avx512_512_64", "sg_db_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_32, "parasail_sg_db_stats_striped_avx512_512_32", "sg_db_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_16, "parasail_sg_db_stats_striped_avx512_512_16", "sg_db_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_striped_avx512_512_8, "parasail_sg_db_stats_striped_avx512_512_8", "sg_db_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_64, "parasail_sg_db_stats_diag_avx512_512_64", "sg_db_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_32, "parasail_sg_db_stats_diag_avx512_512_32", "sg_db_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_16, "parasail_sg_db_stats_diag_avx512_512_16", "sg_db_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_diag_avx512_512_8, "parasail_sg_db_stats_diag_avx512_512_8", "sg_db_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_db_stats_avx512 = {"parasail_sg_db_stats_avx512", parasail_sg_db_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_db_stats_altivec_functions[] = {
 {parasail_sg_db_stats,                "parasail_sg_db_stats",                "sg_db_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2361,6 +2721,26 @@ static parasail_function_info_t parasail_sg_de_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_de_stats_avx2 = {"parasail_sg_de_stats_avx2", parasail_sg_de_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_de_stats_avx512_functions[] = {
+{parasail_sg_de_stats,                "parasail_sg_de_stats",                "sg_de_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_de_stats_scan,           "parasail_sg_de_stats_scan",           "sg_de_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_avx512_512_64, "parasail_sg_de_stats_scan_avx512_512_64", "sg_de_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_avx512_512_32, "parasail_sg_de_stats_scan_avx512_512_32", "sg_de_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_avx512_512_16, "parasail_sg_de_stats_scan_avx512_512_16", "sg_de_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_scan_avx512_512_8, "parasail_sg_de_stats_scan_avx512_512_8", "sg_de_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_64, "parasail_sg_de_stats_striped_avx512_512_64", "sg_de_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_32, "parasail_sg_de_stats_striped_avx512_512_32", "sg_de_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_16, "parasail_sg_de_stats_striped_avx512_512_16", "sg_de_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_striped_avx512_512_8, "parasail_sg_de_stats_striped_avx512_512_8", "sg_de_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_64, "parasail_sg_de_stats_diag_avx512_512_64", "sg_de_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_32, "parasail_sg_de_stats_diag_avx512_512_32", "sg_de_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_16, "parasail_sg_de_stats_diag_avx512_512_16", "sg_de_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_diag_avx512_512_8, "parasail_sg_de_stats_diag_avx512_512_8", "sg_de_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_de_stats_avx512 = {"parasail_sg_de_stats_avx512", parasail_sg_de_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_de_stats_altivec_functions[] = {
 {parasail_sg_de_stats,                "parasail_sg_de_stats",                "sg_de_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2488,6 +2868,26 @@ static parasail_function_info_t parasail_sg_dx_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_dx_stats_avx2 = {"parasail_sg_dx_stats_avx2", parasail_sg_dx_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_dx_stats_avx512_functions[] = {
+{parasail_sg_dx_stats,                "parasail_sg_dx_stats",                "sg_dx_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_dx_stats_scan,           "parasail_sg_dx_stats_scan",           "sg_dx_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_avx512_512_64, "parasail_sg_dx_stats_scan_avx512_512_64", "sg_dx_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_avx512_512_32, "parasail_sg_dx_stats_scan_avx512_512_32", "sg_dx_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_avx512_512_16, "parasail_sg_dx_stats_scan_avx512_512_16", "sg_dx_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_scan_avx512_512_8, "parasail_sg_dx_stats_scan_avx512_512_8", "sg_dx_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_64, "parasail_sg_dx_stats_striped_avx512_512_64", "sg_dx_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_32, "parasail_sg_dx_stats_striped_avx512_512_32", "sg_dx_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_16, "parasail_sg_dx_stats_striped_avx512_512_16", "sg_dx_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_striped_avx512_512_8, "parasail_sg_dx_stats_striped_avx512_512_8", "sg_dx_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_64, "parasail_sg_dx_stats_diag_avx512_512_64", "sg_dx_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_32, "parasail_sg_dx_stats_diag_avx512_512_32", "sg_dx_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_16, "parasail_sg_dx_stats_diag_avx512_512_16", "sg_dx_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_diag_avx512_512_8, "parasail_sg_dx_stats_diag_avx512_512_8", "sg_dx_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_dx_stats_avx512 = {"parasail_sg_dx_stats_avx512", parasail_sg_dx_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_dx_stats_altivec_functions[] = {
 {parasail_sg_dx_stats,                "parasail_sg_dx_stats",                "sg_dx_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2615,6 +3015,26 @@ static parasail_function_info_t parasail_sg_qb_de_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_de_stats_avx2 = {"parasail_sg_qb_de_stats_avx2", parasail_sg_qb_de_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_de_stats_avx512_functions[] = {
+{parasail_sg_qb_de_stats,             "parasail_sg_qb_de_stats",             "sg_qb_de_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qb_de_stats_scan,        "parasail_sg_qb_de_stats_scan",        "sg_qb_de_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_avx512_512_64, "parasail_sg_qb_de_stats_scan_avx512_512_64", "sg_qb_de_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_avx512_512_32, "parasail_sg_qb_de_stats_scan_avx512_512_32", "sg_qb_de_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_avx512_512_16, "parasail_sg_qb_de_stats_scan_avx512_512_16", "sg_qb_de_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_scan_avx512_512_8, "parasail_sg_qb_de_stats_scan_avx512_512_8", "sg_qb_de_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_64, "parasail_sg_qb_de_stats_striped_avx512_512_64", "sg_qb_de_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_32, "parasail_sg_qb_de_stats_striped_avx512_512_32", "sg_qb_de_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_16, "parasail_sg_qb_de_stats_striped_avx512_512_16", "sg_qb_de_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_striped_avx512_512_8, "parasail_sg_qb_de_stats_striped_avx512_512_8", "sg_qb_de_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_64, "parasail_sg_qb_de_stats_diag_avx512_512_64", "sg_qb_de_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_32, "parasail_sg_qb_de_stats_diag_avx512_512_32", "sg_qb_de_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_16, "parasail_sg_qb_de_stats_diag_avx512_512_16", "sg_qb_de_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_diag_avx512_512_8, "parasail_sg_qb_de_stats_diag_avx512_512_8", "sg_qb_de_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_de_stats_avx512 = {"parasail_sg_qb_de_stats_avx512", parasail_sg_qb_de_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_de_stats_altivec_functions[] = {
 {parasail_sg_qb_de_stats,             "parasail_sg_qb_de_stats",             "sg_qb_de_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2742,6 +3162,26 @@ static parasail_function_info_t parasail_sg_qe_db_stats_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_db_stats_avx2 = {"parasail_sg_qe_db_stats_avx2", parasail_sg_qe_db_stats_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_db_stats_avx512_functions[] = {
+{parasail_sg_qe_db_stats,             "parasail_sg_qe_db_stats",             "sg_qe_db_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qe_db_stats_scan,        "parasail_sg_qe_db_stats_scan",        "sg_qe_db_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_avx512_512_64, "parasail_sg_qe_db_stats_scan_avx512_512_64", "sg_qe_db_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_avx512_512_32, "parasail_sg_qe_db_stats_scan_avx512_512_32", "sg_qe_db_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_avx512_512_16, "parasail_sg_qe_db_stats_scan_avx512_512_16", "sg_qe_db_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_scan_avx512_512_8, "parasail_sg_qe_db_stats_scan_avx512_512_8", "sg_qe_db_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_64, "parasail_sg_qe_db_stats_striped_avx512_512_64", "sg_qe_db_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_32, "parasail_sg_qe_db_stats_striped_avx512_512_32", "sg_qe_db_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_16, "parasail_sg_qe_db_stats_striped_avx512_512_16", "sg_qe_db_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_striped_avx512_512_8, "parasail_sg_qe_db_stats_striped_avx512_512_8", "sg_qe_db_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_64, "parasail_sg_qe_db_stats_diag_avx512_512_64", "sg_qe_db_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_32, "parasail_sg_qe_db_stats_diag_avx512_512_32", "sg_qe_db_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_16, "parasail_sg_qe_db_stats_diag_avx512_512_16", "sg_qe_db_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_diag_avx512_512_8, "parasail_sg_qe_db_stats_diag_avx512_512_8", "sg_qe_db_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_db_stats_avx512 = {"parasail_sg_qe_db_stats_avx512", parasail_sg_qe_db_stats_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_db_stats_altivec_functions[] = {
 {parasail_sg_qe_db_stats,             "parasail_sg_qe_db_stats",             "sg_qe_db_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
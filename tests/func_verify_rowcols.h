@@ -75,6 +75,26 @@ static parasail_function_info_t parasail_nw_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_rowcol_avx2 = {"parasail_nw_rowcol_avx2", parasail_nw_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_rowcol_avx512_functions[] = {
+{parasail_nw_rowcol,                  "parasail_nw_rowcol",                  "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_nw_rowcol_scan,             "parasail_nw_rowcol_scan",             "nw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512_512_64, "parasail_nw_rowcol_scan_avx512_512_64", "nw",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512_512_32, "parasail_nw_rowcol_scan_avx512_512_32", "nw",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512_512_16, "parasail_nw_rowcol_scan_avx512_512_16", "nw",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512_512_8, "parasail_nw_rowcol_scan_avx512_512_8", "nw",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_64, "parasail_nw_rowcol_striped_avx512_512_64", "nw", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_32, "parasail_nw_rowcol_striped_avx512_512_32", "nw", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_16, "parasail_nw_rowcol_striped_avx512_512_16", "nw", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512_512_8, "parasail_nw_rowcol_striped_avx512_512_8", "nw", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_64, "parasail_nw_rowcol_diag_avx512_512_64", "nw",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_32, "parasail_nw_rowcol_diag_avx512_512_32", "nw",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_16, "parasail_nw_rowcol_diag_avx512_512_16", "nw",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512_512_8, "parasail_nw_rowcol_diag_avx512_512_8", "nw",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_rowcol_avx512 = {"parasail_nw_rowcol_avx512", parasail_nw_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_rowcol_altivec_functions[] = {
 {parasail_nw_rowcol,                  "parasail_nw_rowcol",                  "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -196,6 +216,26 @@ static parasail_function_info_t parasail_sg_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_rowcol_avx2 = {"parasail_sg_rowcol_avx2", parasail_sg_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_rowcol_avx512_functions[] = {
+{parasail_sg_rowcol,                  "parasail_sg_rowcol",                  "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_rowcol_scan,             "parasail_sg_rowcol_scan",             "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512_512_64, "parasail_sg_rowcol_scan_avx512_512_64", "sg",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512_512_32, "parasail_sg_rowcol_scan_avx512_512_32", "sg",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512_512_16, "parasail_sg_rowcol_scan_avx512_512_16", "sg",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512_512_8, "parasail_sg_rowcol_scan_avx512_512_8", "sg",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_64, "parasail_sg_rowcol_striped_avx512_512_64", "sg", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_32, "parasail_sg_rowcol_striped_avx512_512_32", "sg", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_16, "parasail_sg_rowcol_striped_avx512_512_16", "sg", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512_512_8, "parasail_sg_rowcol_striped_avx512_512_8", "sg", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_64, "parasail_sg_rowcol_diag_avx512_512_64", "sg",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_32, "parasail_sg_rowcol_diag_avx512_512_32", "sg",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_16, "parasail_sg_rowcol_diag_avx512_512_16", "sg",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512_512_8, "parasail_sg_rowcol_diag_avx512_512_8", "sg",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_rowcol_avx512 = {"parasail_sg_rowcol_avx512", parasail_sg_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_rowcol_altivec_functions[] = {
 {parasail_sg_rowcol,                  "parasail_sg_rowcol",                  "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -317,6 +357,26 @@ static parasail_function_info_t parasail_sw_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_rowcol_avx2 = {"parasail_sw_rowcol_avx2", parasail_sw_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_rowcol_avx512_functions[] = {
+{parasail_sw_rowcol,                  "parasail_sw_rowcol",                  "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sw_rowcol_scan,             "parasail_sw_rowcol_scan",             "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512_512_64, "parasail_sw_rowcol_scan_avx512_512_64", "sw",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512_512_32, "parasail_sw_rowcol_scan_avx512_512_32", "sw",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512_512_16, "parasail_sw_rowcol_scan_avx512_512_16", "sw",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512_512_8, "parasail_sw_rowcol_scan_avx512_512_8", "sw",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_64, "parasail_sw_rowcol_striped_avx512_512_64", "sw", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_32, "parasail_sw_rowcol_striped_avx512_512_32", "sw", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_16, "parasail_sw_rowcol_striped_avx512_512_16", "sw", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512_512_8, "parasail_sw_rowcol_striped_avx512_512_8", "sw", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_64, "parasail_sw_rowcol_diag_avx512_512_64", "sw",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_32, "parasail_sw_rowcol_diag_avx512_512_32", "sw",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_16, "parasail_sw_rowcol_diag_avx512_512_16", "sw",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512_512_8, "parasail_sw_rowcol_diag_avx512_512_8", "sw",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_rowcol_avx512 = {"parasail_sw_rowcol_avx512", parasail_sw_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_rowcol_altivec_functions[] = {
 {parasail_sw_rowcol,                  "parasail_sw_rowcol",                  "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -438,6 +498,26 @@ static parasail_function_info_t parasail_sg_qb_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_rowcol_avx2 = {"parasail_sg_qb_rowcol_avx2", parasail_sg_qb_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_rowcol_avx512_functions[] = {
+{parasail_sg_qb_rowcol,               "parasail_sg_qb_rowcol",               "sg_qb",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qb_rowcol_scan,          "parasail_sg_qb_rowcol_scan",          "sg_qb",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_avx512_512_64, "parasail_sg_qb_rowcol_scan_avx512_512_64", "sg_qb",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_avx512_512_32, "parasail_sg_qb_rowcol_scan_avx512_512_32", "sg_qb",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_avx512_512_16, "parasail_sg_qb_rowcol_scan_avx512_512_16", "sg_qb",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_scan_avx512_512_8, "parasail_sg_qb_rowcol_scan_avx512_512_8", "sg_qb",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_64, "parasail_sg_qb_rowcol_striped_avx512_512_64", "sg_qb", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_32, "parasail_sg_qb_rowcol_striped_avx512_512_32", "sg_qb", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_16, "parasail_sg_qb_rowcol_striped_avx512_512_16", "sg_qb", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_striped_avx512_512_8, "parasail_sg_qb_rowcol_striped_avx512_512_8", "sg_qb", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_64, "parasail_sg_qb_rowcol_diag_avx512_512_64", "sg_qb",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_32, "parasail_sg_qb_rowcol_diag_avx512_512_32", "sg_qb",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_16, "parasail_sg_qb_rowcol_diag_avx512_512_16", "sg_qb",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_rowcol_diag_avx512_512_8, "parasail_sg_qb_rowcol_diag_avx512_512_8", "sg_qb",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_rowcol_avx512 = {"parasail_sg_qb_rowcol_avx512", parasail_sg_qb_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_rowcol_altivec_functions[] = {
 {parasail_sg_qb_rowcol,               "parasail_sg_qb_rowcol",               "sg_qb",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -559,6 +639,26 @@ static parasail_function_info_t parasail_sg_qe_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_rowcol_avx2 = {"parasail_sg_qe_rowcol_avx2", parasail_sg_qe_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_rowcol_avx512_functions[] = {
+{parasail_sg_qe_rowcol,               "parasail_sg_qe_rowcol",               "sg_qe",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qe_rowcol_scan,          "parasail_sg_qe_rowcol_scan",          "sg_qe",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_avx512_512_64, "parasail_sg_qe_rowcol_scan_avx512_512_64", "sg_qe",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_avx512_512_32, "parasail_sg_qe_rowcol_scan_avx512_512_32", "sg_qe",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_avx512_512_16, "parasail_sg_qe_rowcol_scan_avx512_512_16", "sg_qe",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_scan_avx512_512_8, "parasail_sg_qe_rowcol_scan_avx512_512_8", "sg_qe",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_64, "parasail_sg_qe_rowcol_striped_avx512_512_64", "sg_qe", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_32, "parasail_sg_qe_rowcol_striped_avx512_512_32", "sg_qe", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_16, "parasail_sg_qe_rowcol_striped_avx512_512_16", "sg_qe", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_striped_avx512_512_8, "parasail_sg_qe_rowcol_striped_avx512_512_8", "sg_qe", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_64, "parasail_sg_qe_rowcol_diag_avx512_512_64", "sg_qe",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_32, "parasail_sg_qe_rowcol_diag_avx512_512_32", "sg_qe",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_16, "parasail_sg_qe_rowcol_diag_avx512_512_16", "sg_qe",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_rowcol_diag_avx512_512_8, "parasail_sg_qe_rowcol_diag_avx512_512_8", "sg_qe",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_rowcol_avx512 = {"parasail_sg_qe_rowcol_avx512", parasail_sg_qe_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_rowcol_altivec_functions[] = {
 {parasail_sg_qe_rowcol,               "parasail_sg_qe_rowcol",               "sg_qe",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -680,6 +780,26 @@ static parasail_function_info_t parasail_sg_qx_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qx_rowcol_avx2 = {"parasail_sg_qx_rowcol_avx2", parasail_sg_qx_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qx_rowcol_avx512_functions[] = {
+{parasail_sg_qx_rowcol,               "parasail_sg_qx_rowcol",               "sg_qx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qx_rowcol_scan,          "parasail_sg_qx_rowcol_scan",          "sg_qx",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_avx512_512_64, "parasail_sg_qx_rowcol_scan_avx512_512_64", "sg_qx",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_avx512_512_32, "parasail_sg_qx_rowcol_scan_avx512_512_32", "sg_qx",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_avx512_512_16, "parasail_sg_qx_rowcol_scan_avx512_512_16", "sg_qx",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_scan_avx512_512_8, "parasail_sg_qx_rowcol_scan_avx512_512_8", "sg_qx",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_64, "parasail_sg_qx_rowcol_striped_avx512_512_64", "sg_qx", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_32, "parasail_sg_qx_rowcol_striped_avx512_512_32", "sg_qx", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_16, "parasail_sg_qx_rowcol_striped_avx512_512_16", "sg_qx", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_striped_avx512_512_8, "parasail_sg_qx_rowcol_striped_avx512_512_8", "sg_qx", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_64, "parasail_sg_qx_rowcol_diag_avx512_512_64", "sg_qx",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_32, "parasail_sg_qx_rowcol_diag_avx512_512_32", "sg_qx",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_16, "parasail_sg_qx_rowcol_diag_avx512_512_16", "sg_qx",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qx_rowcol_diag_avx512_512_8, "parasail_sg_qx_rowcol_diag_avx512_512_8", "sg_qx",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qx_rowcol_avx512 = {"parasail_sg_qx_rowcol_avx512", parasail_sg_qx_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qx_rowcol_altivec_functions[] = {
 {parasail_sg_qx_rowcol,               "parasail_sg_qx_rowcol",               "sg_qx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -801,6 +921,26 @@ static parasail_function_info_t parasail_sg_db_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_db_rowcol_avx2 = {"parasail_sg_db_rowcol_avx2", parasail_sg_db_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_db_rowcol_avx512_functions[] = {
+{parasail_sg_db_rowcol,               "parasail_sg_db_rowcol",               "sg_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_db_rowcol_scan,          "parasail_sg_db_rowcol_scan",          "sg_db",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_avx512_512_64, "parasail_sg_db_rowcol_scan_avx512_512_64", "sg_db",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_avx512_512_32, "parasail_sg_db_rowcol_scan_avx512_512_32", "sg_db",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_avx512_512_16, "parasail_sg_db_rowcol_scan_avx512_512_16", "sg_db",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_scan_avx512_512_8, "parasail_sg_db_rowcol_scan_avx512_512_8", "sg_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_64, "parasail_sg_db_rowcol_striped_avx512_512_64", "sg_db", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_32, "parasail_sg_db_rowcol_striped_avx512_512_32", "sg_db", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_16, "parasail_sg_db_rowcol_striped_avx512_512_16", "sg_db", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_striped_avx512_512_8, "parasail_sg_db_rowcol_striped_avx512_512_8", "sg_db", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_64, "parasail_sg_db_rowcol_diag_avx512_512_64", "sg_db",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_32, "parasail_sg_db_rowcol_diag_avx512_512_32", "sg_db",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_16, "parasail_sg_db_rowcol_diag_avx512_512_16", "sg_db",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_db_rowcol_diag_avx512_512_8, "parasail_sg_db_rowcol_diag_avx512_512_8", "sg_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_db_rowcol_avx512 = {"parasail_sg_db_rowcol_avx512", parasail_sg_db_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_db_rowcol_altivec_functions[] = {
 {parasail_sg_db_rowcol,               "parasail_sg_db_rowcol",               "sg_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -922,6 +1062,26 @@ static parasail_function_info_t parasail_sg_de_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_de_rowcol_avx2 = {"parasail_sg_de_rowcol_avx2", parasail_sg_de_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_de_rowcol_avx512_functions[] = {
+{parasail_sg_de_rowcol,               "parasail_sg_de_rowcol",               "sg_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_de_rowcol_scan,          "parasail_sg_de_rowcol_scan",          "sg_de",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_avx512_512_64, "parasail_sg_de_rowcol_scan_avx512_512_64", "sg_de",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_avx512_512_32, "parasail_sg_de_rowcol_scan_avx512_512_32", "sg_de",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_avx512_512_16, "parasail_sg_de_rowcol_scan_avx512_512_16", "sg_de",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_scan_avx512_512_8, "parasail_sg_de_rowcol_scan_avx512_512_8", "sg_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_64, "parasail_sg_de_rowcol_striped_avx512_512_64", "sg_de", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_32, "parasail_sg_de_rowcol_striped_avx512_512_32", "sg_de", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_16, "parasail_sg_de_rowcol_striped_avx512_512_16", "sg_de", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_striped_avx512_512_8, "parasail_sg_de_rowcol_striped_avx512_512_8", "sg_de", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_64, "parasail_sg_de_rowcol_diag_avx512_512_64", "sg_de",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_32, "parasail_sg_de_rowcol_diag_avx512_512_32", "sg_de",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_16, "parasail_sg_de_rowcol_diag_avx512_512_16", "sg_de",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_de_rowcol_diag_avx512_512_8, "parasail_sg_de_rowcol_diag_avx512_512_8", "sg_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_de_rowcol_avx512 = {"parasail_sg_de_rowcol_avx512", parasail_sg_de_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_de_rowcol_altivec_functions[] = {
 {parasail_sg_de_rowcol,               "parasail_sg_de_rowcol",               "sg_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -1043,6 +1203,26 @@ static parasail_function_info_t parasail_sg_dx_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_dx_rowcol_avx2 = {"parasail_sg_dx_rowcol_avx2", parasail_sg_dx_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_dx_rowcol_avx512_functions[] = {
+{parasail_sg_dx_rowcol,               "parasail_sg_dx_rowcol",               "sg_dx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_dx_rowcol_scan,          "parasail_sg_dx_rowcol_scan",          "sg_dx",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_avx512_512_64, "parasail_sg_dx_rowcol_scan_avx512_512_64", "sg_dx",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_avx512_512_32, "parasail_sg_dx_rowcol_scan_avx512_512_32", "sg_dx",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_avx512_512_16, "parasail_sg_dx_rowcol_scan_avx512_512_16", "sg_dx",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_scan_avx512_512_8, "parasail_sg_dx_rowcol_scan_avx512_512_8", "sg_dx",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_64, "parasail_sg_dx_rowcol_striped_avx512_512_64", "sg_dx", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_32, "parasail_sg_dx_rowcol_striped_avx512_512_32", "sg_dx", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_16, "parasail_sg_dx_rowcol_striped_avx512_512_16", "sg_dx", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_striped_avx512_512_8, "parasail_sg_dx_rowcol_striped_avx512_512_8", "sg_dx", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_64, "parasail_sg_dx_rowcol_diag_avx512_512_64", "sg_dx",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_32, "parasail_sg_dx_rowcol_diag_avx512_512_32", "sg_dx",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_16, "parasail_sg_dx_rowcol_diag_avx512_512_16", "sg_dx",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_dx_rowcol_diag_avx512_512_8, "parasail_sg_dx_rowcol_diag_avx512_512_8", "sg_dx",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_dx_rowcol_avx512 = {"parasail_sg_dx_rowcol_avx512", parasail_sg_dx_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_dx_rowcol_altivec_functions[] = {
 {parasail_sg_dx_rowcol,               "parasail_sg_dx_rowcol",               "sg_dx",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -1164,6 +1344,26 @@ static parasail_function_info_t parasail_sg_qb_de_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_de_rowcol_avx2 = {"parasail_sg_qb_de_rowcol_avx2", parasail_sg_qb_de_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_de_rowcol_avx512_functions[] = {
+{parasail_sg_qb_de_rowcol,            "parasail_sg_qb_de_rowcol",            "sg_qb_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qb_de_rowcol_scan,       "parasail_sg_qb_de_rowcol_scan",       "sg_qb_de",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_avx512_512_64, "parasail_sg_qb_de_rowcol_scan_avx512_512_64", "sg_qb_de",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_avx512_512_32, "parasail_sg_qb_de_rowcol_scan_avx512_512_32", "sg_qb_de",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_avx512_512_16, "parasail_sg_qb_de_rowcol_scan_avx512_512_16", "sg_qb_de",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_scan_avx512_512_8, "parasail_sg_qb_de_rowcol_scan_avx512_512_8", "sg_qb_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_64, "parasail_sg_qb_de_rowcol_striped_avx512_512_64", "sg_qb_de", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_32, "parasail_sg_qb_de_rowcol_striped_avx512_512_32", "sg_qb_de", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_16, "parasail_sg_qb_de_rowcol_striped_avx512_512_16", "sg_qb_de", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_striped_avx512_512_8, "parasail_sg_qb_de_rowcol_striped_avx512_512_8", "sg_qb_de", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_64, "parasail_sg_qb_de_rowcol_diag_avx512_512_64", "sg_qb_de",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_32, "parasail_sg_qb_de_rowcol_diag_avx512_512_32", "sg_qb_de",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_16, "parasail_sg_qb_de_rowcol_diag_avx512_512_16", "sg_qb_de",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qb_de_rowcol_diag_avx512_512_8, "parasail_sg_qb_de_rowcol_diag_avx512_512_8", "sg_qb_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_de_rowcol_avx512 = {"parasail_sg_qb_de_rowcol_avx512", parasail_sg_qb_de_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_de_rowcol_altivec_functions[] = {
 {parasail_sg_qb_de_rowcol,            "parasail_sg_qb_de_rowcol",            "sg_qb_de",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -1285,6 +1485,26 @@ static parasail_function_info_t parasail_sg_qe_db_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_db_rowcol_avx2 = {"parasail_sg_qe_db_rowcol_avx2", parasail_sg_qe_db_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_db_rowcol_avx512_functions[] = {
+{parasail_sg_qe_db_rowcol,            "parasail_sg_qe_db_rowcol",            "sg_qe_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_qe_db_rowcol_scan,       "parasail_sg_qe_db_rowcol_scan",       "sg_qe_db",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_avx512_512_64, "parasail_sg_qe_db_rowcol_scan_avx512_512_64", "sg_qe_db",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_avx512_512_32, "parasail_sg_qe_db_rowcol_scan_avx512_512_32", "sg_qe_db",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_avx512_512_16, "parasail_sg_qe_db_rowcol_scan_avx512_512_16", "sg_qe_db",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_scan_avx512_512_8, "parasail_sg_qe_db_rowcol_scan_avx512_512_8", "sg_qe_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_64, "parasail_sg_qe_db_rowcol_striped_avx512_512_64", "sg_qe_db", "striped", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_32, "parasail_sg_qe_db_rowcol_striped_avx512_512_32", "sg_qe_db", "striped", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_16, "parasail_sg_qe_db_rowcol_striped_avx512_512_16", "sg_qe_db", "striped", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_striped_avx512_512_8, "parasail_sg_qe_db_rowcol_striped_avx512_512_8", "sg_qe_db", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_64, "parasail_sg_qe_db_rowcol_diag_avx512_512_64", "sg_qe_db",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_32, "parasail_sg_qe_db_rowcol_diag_avx512_512_32", "sg_qe_db",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_16, "parasail_sg_qe_db_rowcol_diag_avx512_512_16", "sg_qe_db",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_qe_db_rowcol_diag_avx512_512_8, "parasail_sg_qe_db_rowcol_diag_avx512_512_8", "sg_qe_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_db_rowcol_avx512 = {"parasail_sg_qe_db_rowcol_avx512", parasail_sg_qe_db_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_db_rowcol_altivec_functions[] = {
 {parasail_sg_qe_db_rowcol,            "parasail_sg_qe_db_rowcol",            "sg_qe_db",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -1406,6 +1626,26 @@ static parasail_function_info_t parasail_nw_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_stats_rowcol_avx2 = {"parasail_nw_stats_rowcol_avx2", parasail_nw_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_stats_rowcol_avx512_functions[] = {
+{parasail_nw_stats_rowcol,            "parasail_nw_stats_rowcol",            "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_nw_stats_rowcol_scan,       "parasail_nw_stats_rowcol_scan",       "nw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512_512_64, "parasail_nw_stats_rowcol_scan_avx512_512_64", "nw_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512_512_32, "parasail_nw_stats_rowcol_scan_avx512_512_32", "nw_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512_512_16, "parasail_nw_stats_rowcol_scan_avx512_512_16", "nw_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512_512_8, "parasail_nw_stats_rowcol_scan_avx512_512_8", "nw_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_64, "parasail_nw_stats_rowcol_striped_avx512_512_64", "nw_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_32, "parasail_nw_stats_rowcol_striped_avx512_512_32", "nw_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_16, "parasail_nw_stats_rowcol_striped_avx512_512_16", "nw_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512_512_8, "parasail_nw_stats_rowcol_striped_avx512_512_8", "nw_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_64, "parasail_nw_stats_rowcol_diag_avx512_512_64", "nw_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_32, "parasail_nw_stats_rowcol_diag_avx512_512_32", "nw_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_16, "parasail_nw_stats_rowcol_diag_avx512_512_16", "nw_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512_512_8, "parasail_nw_stats_rowcol_diag_avx512_512_8", "nw_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_stats_rowcol_avx512 = {"parasail_nw_stats_rowcol_avx512", parasail_nw_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_stats_rowcol_altivec_functions[] = {
 {parasail_nw_stats_rowcol,            "parasail_nw_stats_rowcol",            "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -1527,6 +1767,26 @@ static parasail_function_info_t parasail_sg_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_stats_rowcol_avx2 = {"parasail_sg_stats_rowcol_avx2", parasail_sg_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_stats_rowcol_avx512_functions[] = {
+{parasail_sg_stats_rowcol,            "parasail_sg_stats_rowcol",            "sg_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_stats_rowcol_scan,       "parasail_sg_stats_rowcol_scan",       "sg_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512_512_64, "parasail_sg_stats_rowcol_scan_avx512_512_64", "sg_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512_512_32, "parasail_sg_stats_rowcol_scan_avx512_512_32", "sg_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512_512_16, "parasail_sg_stats_rowcol_scan_avx512_512_16", "sg_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512_512_8, "parasail_sg_stats_rowcol_scan_avx512_512_8", "sg_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_64, "parasail_sg_stats_rowcol_striped_avx512_512_64", "sg_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_32, "parasail_sg_stats_rowcol_striped_avx512_512_32", "sg_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_16, "parasail_sg_stats_rowcol_striped_avx512_512_16", "sg_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512_512_8, "parasail_sg_stats_rowcol_striped_avx512_512_8", "sg_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_64, "parasail_sg_stats_rowcol_diag_avx512_512_64", "sg_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_32, "parasail_sg_stats_rowcol_diag_avx512_512_32", "sg_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_16, "parasail_sg_stats_rowcol_diag_avx512_512_16", "sg_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512_512_8, "parasail_sg_stats_rowcol_diag_avx512_512_8", "sg_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_stats_rowcol_avx512 = {"parasail_sg_stats_rowcol_avx512", parasail_sg_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_stats_rowcol_altivec_functions[] = {
 {parasail_sg_stats_rowcol,            "parasail_sg_stats_rowcol",            "sg_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -1648,6 +1908,26 @@ static parasail_function_info_t parasail_sw_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_stats_rowcol_avx2 = {"parasail_sw_stats_rowcol_avx2", parasail_sw_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_stats_rowcol_avx512_functions[] = {
+{parasail_sw_stats_rowcol,            "parasail_sw_stats_rowcol",            "sw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sw_stats_rowcol_scan,       "parasail_sw_stats_rowcol_scan",       "sw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512_512_64, "parasail_sw_stats_rowcol_scan_avx512_512_64", "sw_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512_512_32, "parasail_sw_stats_rowcol_scan_avx512_512_32", "sw_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512_512_16, "parasail_sw_stats_rowcol_scan_avx512_512_16", "sw_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512_512_8, "parasail_sw_stats_rowcol_scan_avx512_512_8", "sw_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_64, "parasail_sw_stats_rowcol_striped_avx512_512_64", "sw_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_32, "parasail_sw_stats_rowcol_striped_avx512_512_32", "sw_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_16, "parasail_sw_stats_rowcol_striped_avx512_512_16", "sw_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512_512_8, "parasail_sw_stats_rowcol_striped_avx512_512_8", "sw_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_64, "parasail_sw_stats_rowcol_diag_avx512_512_64", "sw_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_32, "parasail_sw_stats_rowcol_diag_avx512_512_32", "sw_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_16, "parasail_sw_stats_rowcol_diag_avx512_512_16", "sw_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512_512_8, "parasail_sw_stats_rowcol_diag_avx512_512_8", "sw_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_stats_rowcol_avx512 = {"parasail_sw_stats_rowcol_avx512", parasail_sw_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_stats_rowcol_altivec_functions[] = {
 {parasail_sw_stats_rowcol,            "parasail_sw_stats_rowcol",            "sw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -1769,6 +2049,26 @@ static parasail_function_info_t parasail_sg_qb_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_stats_rowcol_avx2 = {"parasail_sg_qb_stats_rowcol_avx2", parasail_sg_qb_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_stats_rowcol_avx512_functions[] = {
+{parasail_sg_qb_stats_rowcol,         "parasail_sg_qb_stats_rowcol",         "sg_qb_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qb_stats_rowcol_scan,    "parasail_sg_qb_stats_rowcol_scan",    "sg_qb_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_64, "parasail_sg_qb_stats_rowcol_scan_avx512_512_64", "sg_qb_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_32, "parasail_sg_qb_stats_rowcol_scan_avx512_512_32", "sg_qb_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_16, "parasail_sg_qb_stats_rowcol_scan_avx512_512_16", "sg_qb_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_scan_avx512_512_8, "parasail_sg_qb_stats_rowcol_scan_avx512_512_8", "sg_qb_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_64, "parasail_sg_qb_stats_rowcol_striped_avx512_512_64", "sg_qb_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_32, "parasail_sg_qb_stats_rowcol_striped_avx512_512_32", "sg_qb_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_16, "parasail_sg_qb_stats_rowcol_striped_avx512_512_16", "sg_qb_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_striped_avx512_512_8, "parasail_sg_qb_stats_rowcol_striped_avx512_512_8", "sg_qb_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_64, "parasail_sg_qb_stats_rowcol_diag_avx512_512_64", "sg_qb_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_32, "parasail_sg_qb_stats_rowcol_diag_avx512_512_32", "sg_qb_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_16, "parasail_sg_qb_stats_rowcol_diag_avx512_512_16", "sg_qb_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_stats_rowcol_diag_avx512_512_8, "parasail_sg_qb_stats_rowcol_diag_avx512_512_8", "sg_qb_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_stats_rowcol_avx512 = {"parasail_sg_qb_stats_rowcol_avx512", parasail_sg_qb_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_stats_rowcol_altivec_functions[] = {
 {parasail_sg_qb_stats_rowcol,         "parasail_sg_qb_stats_rowcol",         "sg_qb_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -1890,6 +2190,26 @@ static parasail_function_info_t parasail_sg_qe_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_stats_rowcol_avx2 = {"parasail_sg_qe_stats_rowcol_avx2", parasail_sg_qe_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_stats_rowcol_avx512_functions[] = {
+{parasail_sg_qe_stats_rowcol,         "parasail_sg_qe_stats_rowcol",         "sg_qe_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qe_stats_rowcol_scan,    "parasail_sg_qe_stats_rowcol_scan",    "sg_qe_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_64, "parasail_sg_qe_stats_rowcol_scan_avx512_512_64", "sg_qe_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_32, "parasail_sg_qe_stats_rowcol_scan_avx512_512_32", "sg_qe_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_16, "parasail_sg_qe_stats_rowcol_scan_avx512_512_16", "sg_qe_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_scan_avx512_512_8, "parasail_sg_qe_stats_rowcol_scan_avx512_512_8", "sg_qe_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_64, "parasail_sg_qe_stats_rowcol_striped_avx512_512_64", "sg_qe_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_32, "parasail_sg_qe_stats_rowcol_striped_avx512_512_32", "sg_qe_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_16, "parasail_sg_qe_stats_rowcol_striped_avx512_512_16", "sg_qe_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_striped_avx512_512_8, "parasail_sg_qe_stats_rowcol_striped_avx512_512_8", "sg_qe_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_64, "parasail_sg_qe_stats_rowcol_diag_avx512_512_64", "sg_qe_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_32, "parasail_sg_qe_stats_rowcol_diag_avx512_512_32", "sg_qe_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_16, "parasail_sg_qe_stats_rowcol_diag_avx512_512_16", "sg_qe_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_stats_rowcol_diag_avx512_512_8, "parasail_sg_qe_stats_rowcol_diag_avx512_512_8", "sg_qe_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_stats_rowcol_avx512 = {"parasail_sg_qe_stats_rowcol_avx512", parasail_sg_qe_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_stats_rowcol_altivec_functions[] = {
 {parasail_sg_qe_stats_rowcol,         "parasail_sg_qe_stats_rowcol",         "sg_qe_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2011,6 +2331,26 @@ static parasail_function_info_t parasail_sg_qx_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qx_stats_rowcol_avx2 = {"parasail_sg_qx_stats_rowcol_avx2", parasail_sg_qx_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qx_stats_rowcol_avx512_functions[] = {
+{parasail_sg_qx_stats_rowcol,         "parasail_sg_qx_stats_rowcol",         "sg_qx_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qx_stats_rowcol_scan,    "parasail_sg_qx_stats_rowcol_scan",    "sg_qx_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_64, "parasail_sg_qx_stats_rowcol_scan_avx512_512_64", "sg_qx_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_32, "parasail_sg_qx_stats_rowcol_scan_avx512_512_32", "sg_qx_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_16, "parasail_sg_qx_stats_rowcol_scan_avx512_512_16", "sg_qx_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_scan_avx512_512_8, "parasail_sg_qx_stats_rowcol_scan_avx512_512_8", "sg_qx_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_64, "parasail_sg_qx_stats_rowcol_striped_avx512_512_64", "sg_qx_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_32, "parasail_sg_qx_stats_rowcol_striped_avx512_512_32", "sg_qx_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_16, "parasail_sg_qx_stats_rowcol_striped_avx512_512_16", "sg_qx_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_striped_avx512_512_8, "parasail_sg_qx_stats_rowcol_striped_avx512_512_8", "sg_qx_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_64, "parasail_sg_qx_stats_rowcol_diag_avx512_512_64", "sg_qx_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_32, "parasail_sg_qx_stats_rowcol_diag_avx512_512_32", "sg_qx_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_16, "parasail_sg_qx_stats_rowcol_diag_avx512_512_16", "sg_qx_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qx_stats_rowcol_diag_avx512_512_8, "parasail_sg_qx_stats_rowcol_diag_avx512_512_8", "sg_qx_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qx_stats_rowcol_avx512 = {"parasail_sg_qx_stats_rowcol_avx512", parasail_sg_qx_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qx_stats_rowcol_altivec_functions[] = {
 {parasail_sg_qx_stats_rowcol,         "parasail_sg_qx_stats_rowcol",         "sg_qx_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2132,6 +2472,26 @@ static parasail_function_info_t parasail_sg_db_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_db_stats_rowcol_avx2 = {"parasail_sg_db_stats_rowcol_avx2", parasail_sg_db_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_db_stats_rowcol_avx512_functions[] = {
+{parasail_sg_db_stats_rowcol,         "parasail_sg_db_stats_rowcol",         "sg_db_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_db_stats_rowcol_scan,    "parasail_sg_db_stats_rowcol_scan",    "sg_db_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_avx512_512_64, "parasail_sg_db_stats_rowcol_scan_avx512_512_64", "sg_db_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_avx512_512_32, "parasail_sg_db_stats_rowcol_scan_avx512_512_32", "sg_db_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_avx512_512_16, "parasail_sg_db_stats_rowcol_scan_avx512_512_16", "sg_db_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_scan_avx512_512_8, "parasail_sg_db_stats_rowcol_scan_avx512_512_8", "sg_db_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_64, "parasail_sg_db_stats_rowcol_striped_avx512_512_64", "sg_db_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_32, "parasail_sg_db_stats_rowcol_striped_avx512_512_32", "sg_db_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_16, "parasail_sg_db_stats_rowcol_striped_avx512_512_16", "sg_db_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_striped_avx512_512_8, "parasail_sg_db_stats_rowcol_striped_avx512_512_8", "sg_db_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_64, "parasail_sg_db_stats_rowcol_diag_avx512_512_64", "sg_db_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_32, "parasail_sg_db_stats_rowcol_diag_avx512_512_32", "sg_db_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_16, "parasail_sg_db_stats_rowcol_diag_avx512_512_16", "sg_db_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_db_stats_rowcol_diag_avx512_512_8, "parasail_sg_db_stats_rowcol_diag_avx512_512_8", "sg_db_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_db_stats_rowcol_avx512 = {"parasail_sg_db_stats_rowcol_avx512", parasail_sg_db_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_db_stats_rowcol_altivec_functions[] = {
 {parasail_sg_db_stats_rowcol,         "parasail_sg_db_stats_rowcol",         "sg_db_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2253,6 +2613,26 @@ static parasail_function_info_t parasail_sg_de_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_de_stats_rowcol_avx2 = {"parasail_sg_de_stats_rowcol_avx2", parasail_sg_de_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_de_stats_rowcol_avx512_functions[] = {
+{parasail_sg_de_stats_rowcol,         "parasail_sg_de_stats_rowcol",         "sg_de_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_de_stats_rowcol_scan,    "parasail_sg_de_stats_rowcol_scan",    "sg_de_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_avx512_512_64, "parasail_sg_de_stats_rowcol_scan_avx512_512_64", "sg_de_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_avx512_512_32, "parasail_sg_de_stats_rowcol_scan_avx512_512_32", "sg_de_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_avx512_512_16, "parasail_sg_de_stats_rowcol_scan_avx512_512_16", "sg_de_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_scan_avx512_512_8, "parasail_sg_de_stats_rowcol_scan_avx512_512_8", "sg_de_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_64, "parasail_sg_de_stats_rowcol_striped_avx512_512_64", "sg_de_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_32, "parasail_sg_de_stats_rowcol_striped_avx512_512_32", "sg_de_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_16, "parasail_sg_de_stats_rowcol_striped_avx512_512_16", "sg_de_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_striped_avx512_512_8, "parasail_sg_de_stats_rowcol_striped_avx512_512_8", "sg_de_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_64, "parasail_sg_de_stats_rowcol_diag_avx512_512_64", "sg_de_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_32, "parasail_sg_de_stats_rowcol_diag_avx512_512_32", "sg_de_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_16, "parasail_sg_de_stats_rowcol_diag_avx512_512_16", "sg_de_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_de_stats_rowcol_diag_avx512_512_8, "parasail_sg_de_stats_rowcol_diag_avx512_512_8", "sg_de_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_de_stats_rowcol_avx512 = {"parasail_sg_de_stats_rowcol_avx512", parasail_sg_de_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_de_stats_rowcol_altivec_functions[] = {
 {parasail_sg_de_stats_rowcol,         "parasail_sg_de_stats_rowcol",         "sg_de_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2374,6 +2754,26 @@ static parasail_function_info_t parasail_sg_dx_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_dx_stats_rowcol_avx2 = {"parasail_sg_dx_stats_rowcol_avx2", parasail_sg_dx_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_dx_stats_rowcol_avx512_functions[] = {
+{parasail_sg_dx_stats_rowcol,         "parasail_sg_dx_stats_rowcol",         "sg_dx_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_dx_stats_rowcol_scan,    "parasail_sg_dx_stats_rowcol_scan",    "sg_dx_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_64, "parasail_sg_dx_stats_rowcol_scan_avx512_512_64", "sg_dx_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_32, "parasail_sg_dx_stats_rowcol_scan_avx512_512_32", "sg_dx_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_16, "parasail_sg_dx_stats_rowcol_scan_avx512_512_16", "sg_dx_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_scan_avx512_512_8, "parasail_sg_dx_stats_rowcol_scan_avx512_512_8", "sg_dx_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_64, "parasail_sg_dx_stats_rowcol_striped_avx512_512_64", "sg_dx_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_32, "parasail_sg_dx_stats_rowcol_striped_avx512_512_32", "sg_dx_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_16, "parasail_sg_dx_stats_rowcol_striped_avx512_512_16", "sg_dx_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_striped_avx512_512_8, "parasail_sg_dx_stats_rowcol_striped_avx512_512_8", "sg_dx_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_64, "parasail_sg_dx_stats_rowcol_diag_avx512_512_64", "sg_dx_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_32, "parasail_sg_dx_stats_rowcol_diag_avx512_512_32", "sg_dx_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_16, "parasail_sg_dx_stats_rowcol_diag_avx512_512_16", "sg_dx_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_dx_stats_rowcol_diag_avx512_512_8, "parasail_sg_dx_stats_rowcol_diag_avx512_512_8", "sg_dx_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_dx_stats_rowcol_avx512 = {"parasail_sg_dx_stats_rowcol_avx512", parasail_sg_dx_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_dx_stats_rowcol_altivec_functions[] = {
 {parasail_sg_dx_stats_rowcol,         "parasail_sg_dx_stats_rowcol",         "sg_dx_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2495,6 +2895,26 @@ static parasail_function_info_t parasail_sg_qb_de_stats_rowcol_avx2_functions[]
 };
 static parasail_function_group_t parasail_sg_qb_de_stats_rowcol_avx2 = {"parasail_sg_qb_de_stats_rowcol_avx2", parasail_sg_qb_de_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_de_stats_rowcol_avx512_functions[] = {
+{parasail_sg_qb_de_stats_rowcol,      "parasail_sg_qb_de_stats_rowcol",      "sg_qb_de_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qb_de_stats_rowcol_scan, "parasail_sg_qb_de_stats_rowcol_scan", "sg_qb_de_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_64, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_64", "sg_qb_de_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_32, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_32", "sg_qb_de_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_16, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_16", "sg_qb_de_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_scan_avx512_512_8, "parasail_sg_qb_de_stats_rowcol_scan_avx512_512_8", "sg_qb_de_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_64, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_64", "sg_qb_de_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_32, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_32", "sg_qb_de_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_16, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_16", "sg_qb_de_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_striped_avx512_512_8, "parasail_sg_qb_de_stats_rowcol_striped_avx512_512_8", "sg_qb_de_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_64, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_64", "sg_qb_de_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_32, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_32", "sg_qb_de_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_16, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_16", "sg_qb_de_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_rowcol_diag_avx512_512_8, "parasail_sg_qb_de_stats_rowcol_diag_avx512_512_8", "sg_qb_de_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_de_stats_rowcol_avx512 = {"parasail_sg_qb_de_stats_rowcol_avx512", parasail_sg_qb_de_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_de_stats_rowcol_altivec_functions[] = {
 {parasail_sg_qb_de_stats_rowcol,      "parasail_sg_qb_de_stats_rowcol",      "sg_qb_de_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -2616,6 +3036,26 @@ static parasail_function_info_t parasail_sg_qe_db_stats_rowcol_avx2_functions[]
 };
 static parasail_function_group_t parasail_sg_qe_db_stats_rowcol_avx2 = {"parasail_sg_qe_db_stats_rowcol_avx2", parasail_sg_qe_db_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_db_stats_rowcol_avx512_functions[] = {
+{parasail_sg_qe_db_stats_rowcol,      "parasail_sg_qe_db_stats_rowcol",      "sg_qe_db_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_qe_db_stats_rowcol_scan, "parasail_sg_qe_db_stats_rowcol_scan", "sg_qe_db_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_64, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_64", "sg_qe_db_stats",    "scan", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_32, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_32", "sg_qe_db_stats",    "scan", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_16, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_16", "sg_qe_db_stats",    "scan", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_scan_avx512_512_8, "parasail_sg_qe_db_stats_rowcol_scan_avx512_512_8", "sg_qe_db_stats",    "scan", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_64, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_64", "sg_qe_db_stats", "striped", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_32, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_32", "sg_qe_db_stats", "striped", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_16, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_16", "sg_qe_db_stats", "striped", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_striped_avx512_512_8, "parasail_sg_qe_db_stats_rowcol_striped_avx512_512_8", "sg_qe_db_stats", "striped", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_64, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_64", "sg_qe_db_stats",    "diag", "avx512", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_32, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_32", "sg_qe_db_stats",    "diag", "avx512", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_16, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_16", "sg_qe_db_stats",    "diag", "avx512", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_rowcol_diag_avx512_512_8, "parasail_sg_qe_db_stats_rowcol_diag_avx512_512_8", "sg_qe_db_stats",    "diag", "avx512", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_db_stats_rowcol_avx512 = {"parasail_sg_qe_db_stats_rowcol_avx512", parasail_sg_qe_db_stats_rowcol_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_db_stats_rowcol_altivec_functions[] = {
 {parasail_sg_qe_db_stats_rowcol,      "parasail_sg_qe_db_stats_rowcol",      "sg_qe_db_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
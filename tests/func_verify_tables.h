@@ -72,6 +72,25 @@ static parasail_function_info_t parasail_nw_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_table_avx2 = {"parasail_nw_table_avx2", parasail_nw_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_table_avx512_functions[] = {
+{parasail_nw_table,                   "parasail_nw_table",                   "nw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_nw_table_scan_avx512_512_64, "parasail_nw_table_scan_avx512_512_64", "nw",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512_512_32, "parasail_nw_table_scan_avx512_512_32", "nw",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512_512_16, "parasail_nw_table_scan_avx512_512_16", "nw",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512_512_8, "parasail_nw_table_scan_avx512_512_8", "nw",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_64, "parasail_nw_table_striped_avx512_512_64", "nw", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_32, "parasail_nw_table_striped_avx512_512_32", "nw", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_16, "parasail_nw_table_striped_avx512_512_16", "nw", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512_512_8, "parasail_nw_table_striped_avx512_512_8", "nw", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_64, "parasail_nw_table_diag_avx512_512_64", "nw",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_32, "parasail_nw_table_diag_avx512_512_32", "nw",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_16, "parasail_nw_table_diag_avx512_512_16", "nw",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512_512_8, "parasail_nw_table_diag_avx512_512_8", "nw",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_table_avx512 = {"parasail_nw_table_avx512", parasail_nw_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_table_altivec_functions[] = {
 {parasail_nw_table,                   "parasail_nw_table",                   "nw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -193,6 +212,25 @@ static parasail_function_info_t parasail_sg_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_table_avx2 = {"parasail_sg_table_avx2", parasail_sg_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_table_avx512_functions[] = {
+{parasail_sg_table,                   "parasail_sg_table",                   "sg",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_table_scan_avx512_512_64, "parasail_sg_table_scan_avx512_512_64", "sg",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512_512_32, "parasail_sg_table_scan_avx512_512_32", "sg",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512_512_16, "parasail_sg_table_scan_avx512_512_16", "sg",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512_512_8, "parasail_sg_table_scan_avx512_512_8", "sg",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_64, "parasail_sg_table_striped_avx512_512_64", "sg", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_32, "parasail_sg_table_striped_avx512_512_32", "sg", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_16, "parasail_sg_table_striped_avx512_512_16", "sg", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512_512_8, "parasail_sg_table_striped_avx512_512_8", "sg", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_64, "parasail_sg_table_diag_avx512_512_64", "sg",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_32, "parasail_sg_table_diag_avx512_512_32", "sg",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_16, "parasail_sg_table_diag_avx512_512_16", "sg",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512_512_8, "parasail_sg_table_diag_avx512_512_8", "sg",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_table_avx512 = {"parasail_sg_table_avx512", parasail_sg_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_table_altivec_functions[] = {
 {parasail_sg_table,                   "parasail_sg_table",                   "sg",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -314,6 +352,25 @@ static parasail_function_info_t parasail_sw_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_table_avx2 = {"parasail_sw_table_avx2", parasail_sw_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_table_avx512_functions[] = {
+{parasail_sw_table,                   "parasail_sw_table",                   "sw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sw_table_scan_avx512_512_64, "parasail_sw_table_scan_avx512_512_64", "sw",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512_512_32, "parasail_sw_table_scan_avx512_512_32", "sw",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512_512_16, "parasail_sw_table_scan_avx512_512_16", "sw",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512_512_8, "parasail_sw_table_scan_avx512_512_8", "sw",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_64, "parasail_sw_table_striped_avx512_512_64", "sw", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_32, "parasail_sw_table_striped_avx512_512_32", "sw", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_16, "parasail_sw_table_striped_avx512_512_16", "sw", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512_512_8, "parasail_sw_table_striped_avx512_512_8", "sw", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_64, "parasail_sw_table_diag_avx512_512_64", "sw",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_32, "parasail_sw_table_diag_avx512_512_32", "sw",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_16, "parasail_sw_table_diag_avx512_512_16", "sw",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512_512_8, "parasail_sw_table_diag_avx512_512_8", "sw",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_table_avx512 = {"parasail_sw_table_avx512", parasail_sw_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_table_altivec_functions[] = {
 {parasail_sw_table,                   "parasail_sw_table",                   "sw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -435,6 +492,25 @@ static parasail_function_info_t parasail_sg_qb_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_table_avx2 = {"parasail_sg_qb_table_avx2", parasail_sg_qb_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_table_avx512_functions[] = {
+{parasail_sg_qb_table,                "parasail_sg_qb_table",                "sg_qb",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_qb_table_scan_avx512_512_64, "parasail_sg_qb_table_scan_avx512_512_64", "sg_qb",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_avx512_512_32, "parasail_sg_qb_table_scan_avx512_512_32", "sg_qb",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_avx512_512_16, "parasail_sg_qb_table_scan_avx512_512_16", "sg_qb",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_scan_avx512_512_8, "parasail_sg_qb_table_scan_avx512_512_8", "sg_qb",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_64, "parasail_sg_qb_table_striped_avx512_512_64", "sg_qb", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_32, "parasail_sg_qb_table_striped_avx512_512_32", "sg_qb", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_16, "parasail_sg_qb_table_striped_avx512_512_16", "sg_qb", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_striped_avx512_512_8, "parasail_sg_qb_table_striped_avx512_512_8", "sg_qb", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_64, "parasail_sg_qb_table_diag_avx512_512_64", "sg_qb",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_32, "parasail_sg_qb_table_diag_avx512_512_32", "sg_qb",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_16, "parasail_sg_qb_table_diag_avx512_512_16", "sg_qb",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_table_diag_avx512_512_8, "parasail_sg_qb_table_diag_avx512_512_8", "sg_qb",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_table_avx512 = {"parasail_sg_qb_table_avx512", parasail_sg_qb_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_table_altivec_functions[] = {
 {parasail_sg_qb_table,                "parasail_sg_qb_table",                "sg_qb",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -556,6 +632,25 @@ static parasail_function_info_t parasail_sg_qe_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_table_avx2 = {"parasail_sg_qe_table_avx2", parasail_sg_qe_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_table_avx512_functions[] = {
+{parasail_sg_qe_table,                "parasail_sg_qe_table",                "sg_qe",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_qe_table_scan_avx512_512_64, "parasail_sg_qe_table_scan_avx512_512_64", "sg_qe",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_avx512_512_32, "parasail_sg_qe_table_scan_avx512_512_32", "sg_qe",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_avx512_512_16, "parasail_sg_qe_table_scan_avx512_512_16", "sg_qe",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_scan_avx512_512_8, "parasail_sg_qe_table_scan_avx512_512_8", "sg_qe",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_64, "parasail_sg_qe_table_striped_avx512_512_64", "sg_qe", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_32, "parasail_sg_qe_table_striped_avx512_512_32", "sg_qe", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_16, "parasail_sg_qe_table_striped_avx512_512_16", "sg_qe", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_striped_avx512_512_8, "parasail_sg_qe_table_striped_avx512_512_8", "sg_qe", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_64, "parasail_sg_qe_table_diag_avx512_512_64", "sg_qe",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_32, "parasail_sg_qe_table_diag_avx512_512_32", "sg_qe",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_16, "parasail_sg_qe_table_diag_avx512_512_16", "sg_qe",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_table_diag_avx512_512_8, "parasail_sg_qe_table_diag_avx512_512_8", "sg_qe",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_table_avx512 = {"parasail_sg_qe_table_avx512", parasail_sg_qe_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_table_altivec_functions[] = {
 {parasail_sg_qe_table,                "parasail_sg_qe_table",                "sg_qe",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -677,6 +772,25 @@ static parasail_function_info_t parasail_sg_qx_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qx_table_avx2 = {"parasail_sg_qx_table_avx2", parasail_sg_qx_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qx_table_avx512_functions[] = {
+{parasail_sg_qx_table,                "parasail_sg_qx_table",                "sg_qx",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_qx_table_scan_avx512_512_64, "parasail_sg_qx_table_scan_avx512_512_64", "sg_qx",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_avx512_512_32, "parasail_sg_qx_table_scan_avx512_512_32", "sg_qx",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_avx512_512_16, "parasail_sg_qx_table_scan_avx512_512_16", "sg_qx",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_scan_avx512_512_8, "parasail_sg_qx_table_scan_avx512_512_8", "sg_qx",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_64, "parasail_sg_qx_table_striped_avx512_512_64", "sg_qx", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_32, "parasail_sg_qx_table_striped_avx512_512_32", "sg_qx", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_16, "parasail_sg_qx_table_striped_avx512_512_16", "sg_qx", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_striped_avx512_512_8, "parasail_sg_qx_table_striped_avx512_512_8", "sg_qx", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_64, "parasail_sg_qx_table_diag_avx512_512_64", "sg_qx",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_32, "parasail_sg_qx_table_diag_avx512_512_32", "sg_qx",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_16, "parasail_sg_qx_table_diag_avx512_512_16", "sg_qx",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qx_table_diag_avx512_512_8, "parasail_sg_qx_table_diag_avx512_512_8", "sg_qx",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qx_table_avx512 = {"parasail_sg_qx_table_avx512", parasail_sg_qx_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qx_table_altivec_functions[] = {
 {parasail_sg_qx_table,                "parasail_sg_qx_table",                "sg_qx",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -798,6 +912,25 @@ static parasail_function_info_t parasail_sg_db_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_db_table_avx2 = {"parasail_sg_db_table_avx2", parasail_sg_db_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_db_table_avx512_functions[] = {
+{parasail_sg_db_table,                "parasail_sg_db_table",                "sg_db",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_db_table_scan_avx512_512_64, "parasail_sg_db_table_scan_avx512_512_64", "sg_db",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_avx512_512_32, "parasail_sg_db_table_scan_avx512_512_32", "sg_db",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_avx512_512_16, "parasail_sg_db_table_scan_avx512_512_16", "sg_db",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_scan_avx512_512_8, "parasail_sg_db_table_scan_avx512_512_8", "sg_db",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_64, "parasail_sg_db_table_striped_avx512_512_64", "sg_db", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_32, "parasail_sg_db_table_striped_avx512_512_32", "sg_db", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_16, "parasail_sg_db_table_striped_avx512_512_16", "sg_db", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_striped_avx512_512_8, "parasail_sg_db_table_striped_avx512_512_8", "sg_db", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_64, "parasail_sg_db_table_diag_avx512_512_64", "sg_db",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_32, "parasail_sg_db_table_diag_avx512_512_32", "sg_db",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_16, "parasail_sg_db_table_diag_avx512_512_16", "sg_db",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_db_table_diag_avx512_512_8, "parasail_sg_db_table_diag_avx512_512_8", "sg_db",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_db_table_avx512 = {"parasail_sg_db_table_avx512", parasail_sg_db_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_db_table_altivec_functions[] = {
 {parasail_sg_db_table,                "parasail_sg_db_table",                "sg_db",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -919,6 +1052,25 @@ static parasail_function_info_t parasail_sg_de_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_de_table_avx2 = {"parasail_sg_de_table_avx2", parasail_sg_de_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_de_table_avx512_functions[] = {
+{parasail_sg_de_table,                "parasail_sg_de_table",                "sg_de",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_de_table_scan_avx512_512_64, "parasail_sg_de_table_scan_avx512_512_64", "sg_de",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_avx512_512_32, "parasail_sg_de_table_scan_avx512_512_32", "sg_de",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_avx512_512_16, "parasail_sg_de_table_scan_avx512_512_16", "sg_de",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_scan_avx512_512_8, "parasail_sg_de_table_scan_avx512_512_8", "sg_de",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_64, "parasail_sg_de_table_striped_avx512_512_64", "sg_de", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_32, "parasail_sg_de_table_striped_avx512_512_32", "sg_de", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_16, "parasail_sg_de_table_striped_avx512_512_16", "sg_de", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_striped_avx512_512_8, "parasail_sg_de_table_striped_avx512_512_8", "sg_de", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_64, "parasail_sg_de_table_diag_avx512_512_64", "sg_de",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_32, "parasail_sg_de_table_diag_avx512_512_32", "sg_de",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_16, "parasail_sg_de_table_diag_avx512_512_16", "sg_de",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_de_table_diag_avx512_512_8, "parasail_sg_de_table_diag_avx512_512_8", "sg_de",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_de_table_avx512 = {"parasail_sg_de_table_avx512", parasail_sg_de_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_de_table_altivec_functions[] = {
 {parasail_sg_de_table,                "parasail_sg_de_table",                "sg_de",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -1040,6 +1192,25 @@ static parasail_function_info_t parasail_sg_dx_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_dx_table_avx2 = {"parasail_sg_dx_table_avx2", parasail_sg_dx_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_dx_table_avx512_functions[] = {
+{parasail_sg_dx_table,                "parasail_sg_dx_table",                "sg_dx",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_dx_table_scan_avx512_512_64, "parasail_sg_dx_table_scan_avx512_512_64", "sg_dx",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_avx512_512_32, "parasail_sg_dx_table_scan_avx512_512_32", "sg_dx",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_avx512_512_16, "parasail_sg_dx_table_scan_avx512_512_16", "sg_dx",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_scan_avx512_512_8, "parasail_sg_dx_table_scan_avx512_512_8", "sg_dx",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_64, "parasail_sg_dx_table_striped_avx512_512_64", "sg_dx", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_32, "parasail_sg_dx_table_striped_avx512_512_32", "sg_dx", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_16, "parasail_sg_dx_table_striped_avx512_512_16", "sg_dx", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_striped_avx512_512_8, "parasail_sg_dx_table_striped_avx512_512_8", "sg_dx", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_64, "parasail_sg_dx_table_diag_avx512_512_64", "sg_dx",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_32, "parasail_sg_dx_table_diag_avx512_512_32", "sg_dx",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_16, "parasail_sg_dx_table_diag_avx512_512_16", "sg_dx",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_dx_table_diag_avx512_512_8, "parasail_sg_dx_table_diag_avx512_512_8", "sg_dx",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_dx_table_avx512 = {"parasail_sg_dx_table_avx512", parasail_sg_dx_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_dx_table_altivec_functions[] = {
 {parasail_sg_dx_table,                "parasail_sg_dx_table",                "sg_dx",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -1161,6 +1332,25 @@ static parasail_function_info_t parasail_sg_qb_de_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_de_table_avx2 = {"parasail_sg_qb_de_table_avx2", parasail_sg_qb_de_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_de_table_avx512_functions[] = {
+{parasail_sg_qb_de_table,             "parasail_sg_qb_de_table",             "sg_qb_de",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_qb_de_table_scan_avx512_512_64, "parasail_sg_qb_de_table_scan_avx512_512_64", "sg_qb_de",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_avx512_512_32, "parasail_sg_qb_de_table_scan_avx512_512_32", "sg_qb_de",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_avx512_512_16, "parasail_sg_qb_de_table_scan_avx512_512_16", "sg_qb_de",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_scan_avx512_512_8, "parasail_sg_qb_de_table_scan_avx512_512_8", "sg_qb_de",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_64, "parasail_sg_qb_de_table_striped_avx512_512_64", "sg_qb_de", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_32, "parasail_sg_qb_de_table_striped_avx512_512_32", "sg_qb_de", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_16, "parasail_sg_qb_de_table_striped_avx512_512_16", "sg_qb_de", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_striped_avx512_512_8, "parasail_sg_qb_de_table_striped_avx512_512_8", "sg_qb_de", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_64, "parasail_sg_qb_de_table_diag_avx512_512_64", "sg_qb_de",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_32, "parasail_sg_qb_de_table_diag_avx512_512_32", "sg_qb_de",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_16, "parasail_sg_qb_de_table_diag_avx512_512_16", "sg_qb_de",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qb_de_table_diag_avx512_512_8, "parasail_sg_qb_de_table_diag_avx512_512_8", "sg_qb_de",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_de_table_avx512 = {"parasail_sg_qb_de_table_avx512", parasail_sg_qb_de_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_de_table_altivec_functions[] = {
 {parasail_sg_qb_de_table,             "parasail_sg_qb_de_table",             "sg_qb_de",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -1282,6 +1472,25 @@ static parasail_function_info_t parasail_sg_qe_db_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_db_table_avx2 = {"parasail_sg_qe_db_table_avx2", parasail_sg_qe_db_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_db_table_avx512_functions[] = {
+{parasail_sg_qe_db_table,             "parasail_sg_qe_db_table",             "sg_qe_db",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_qe_db_table_scan_avx512_512_64, "parasail_sg_qe_db_table_scan_avx512_512_64", "sg_qe_db",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_avx512_512_32, "parasail_sg_qe_db_table_scan_avx512_512_32", "sg_qe_db",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_avx512_512_16, "parasail_sg_qe_db_table_scan_avx512_512_16", "sg_qe_db",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_scan_avx512_512_8, "parasail_sg_qe_db_table_scan_avx512_512_8", "sg_qe_db",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_64, "parasail_sg_qe_db_table_striped_avx512_512_64", "sg_qe_db", "striped", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_32, "parasail_sg_qe_db_table_striped_avx512_512_32", "sg_qe_db", "striped", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_16, "parasail_sg_qe_db_table_striped_avx512_512_16", "sg_qe_db", "striped", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_striped_avx512_512_8, "parasail_sg_qe_db_table_striped_avx512_512_8", "sg_qe_db", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_64, "parasail_sg_qe_db_table_diag_avx512_512_64", "sg_qe_db",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_32, "parasail_sg_qe_db_table_diag_avx512_512_32", "sg_qe_db",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_16, "parasail_sg_qe_db_table_diag_avx512_512_16", "sg_qe_db",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_qe_db_table_diag_avx512_512_8, "parasail_sg_qe_db_table_diag_avx512_512_8", "sg_qe_db",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_db_table_avx512 = {"parasail_sg_qe_db_table_avx512", parasail_sg_qe_db_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_db_table_altivec_functions[] = {
 {parasail_sg_qe_db_table,             "parasail_sg_qe_db_table",             "sg_qe_db",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -1403,6 +1612,25 @@ static parasail_function_info_t parasail_nw_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_stats_table_avx2 = {"parasail_nw_stats_table_avx2", parasail_nw_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_stats_table_avx512_functions[] = {
+{parasail_nw_stats_table,             "parasail_nw_stats_table",             "nw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_nw_stats_table_scan_avx512_512_64, "parasail_nw_stats_table_scan_avx512_512_64", "nw_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512_512_32, "parasail_nw_stats_table_scan_avx512_512_32", "nw_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512_512_16, "parasail_nw_stats_table_scan_avx512_512_16", "nw_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512_512_8, "parasail_nw_stats_table_scan_avx512_512_8", "nw_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_64, "parasail_nw_stats_table_striped_avx512_512_64", "nw_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_32, "parasail_nw_stats_table_striped_avx512_512_32", "nw_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_16, "parasail_nw_stats_table_striped_avx512_512_16", "nw_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512_512_8, "parasail_nw_stats_table_striped_avx512_512_8", "nw_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_64, "parasail_nw_stats_table_diag_avx512_512_64", "nw_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_32, "parasail_nw_stats_table_diag_avx512_512_32", "nw_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_16, "parasail_nw_stats_table_diag_avx512_512_16", "nw_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512_512_8, "parasail_nw_stats_table_diag_avx512_512_8", "nw_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_stats_table_avx512 = {"parasail_nw_stats_table_avx512", parasail_nw_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_stats_table_altivec_functions[] = {
 {parasail_nw_stats_table,             "parasail_nw_stats_table",             "nw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -1524,6 +1752,25 @@ static parasail_function_info_t parasail_sg_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_stats_table_avx2 = {"parasail_sg_stats_table_avx2", parasail_sg_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_stats_table_avx512_functions[] = {
+{parasail_sg_stats_table,             "parasail_sg_stats_table",             "sg_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_stats_table_scan_avx512_512_64, "parasail_sg_stats_table_scan_avx512_512_64", "sg_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512_512_32, "parasail_sg_stats_table_scan_avx512_512_32", "sg_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512_512_16, "parasail_sg_stats_table_scan_avx512_512_16", "sg_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512_512_8, "parasail_sg_stats_table_scan_avx512_512_8", "sg_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_64, "parasail_sg_stats_table_striped_avx512_512_64", "sg_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_32, "parasail_sg_stats_table_striped_avx512_512_32", "sg_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_16, "parasail_sg_stats_table_striped_avx512_512_16", "sg_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512_512_8, "parasail_sg_stats_table_striped_avx512_512_8", "sg_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_64, "parasail_sg_stats_table_diag_avx512_512_64", "sg_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_32, "parasail_sg_stats_table_diag_avx512_512_32", "sg_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_16, "parasail_sg_stats_table_diag_avx512_512_16", "sg_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512_512_8, "parasail_sg_stats_table_diag_avx512_512_8", "sg_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_stats_table_avx512 = {"parasail_sg_stats_table_avx512", parasail_sg_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_stats_table_altivec_functions[] = {
 {parasail_sg_stats_table,             "parasail_sg_stats_table",             "sg_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -1645,6 +1892,25 @@ static parasail_function_info_t parasail_sw_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_stats_table_avx2 = {"parasail_sw_stats_table_avx2", parasail_sw_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_stats_table_avx512_functions[] = {
+{parasail_sw_stats_table,             "parasail_sw_stats_table",             "sw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sw_stats_table_scan_avx512_512_64, "parasail_sw_stats_table_scan_avx512_512_64", "sw_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512_512_32, "parasail_sw_stats_table_scan_avx512_512_32", "sw_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512_512_16, "parasail_sw_stats_table_scan_avx512_512_16", "sw_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512_512_8, "parasail_sw_stats_table_scan_avx512_512_8", "sw_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_64, "parasail_sw_stats_table_striped_avx512_512_64", "sw_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_32, "parasail_sw_stats_table_striped_avx512_512_32", "sw_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_16, "parasail_sw_stats_table_striped_avx512_512_16", "sw_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512_512_8, "parasail_sw_stats_table_striped_avx512_512_8", "sw_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_64, "parasail_sw_stats_table_diag_avx512_512_64", "sw_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_32, "parasail_sw_stats_table_diag_avx512_512_32", "sw_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_16, "parasail_sw_stats_table_diag_avx512_512_16", "sw_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512_512_8, "parasail_sw_stats_table_diag_avx512_512_8", "sw_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_stats_table_avx512 = {"parasail_sw_stats_table_avx512", parasail_sw_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_stats_table_altivec_functions[] = {
 {parasail_sw_stats_table,             "parasail_sw_stats_table",             "sw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -1766,6 +2032,25 @@ static parasail_function_info_t parasail_sg_qb_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_stats_table_avx2 = {"parasail_sg_qb_stats_table_avx2", parasail_sg_qb_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_stats_table_avx512_functions[] = {
+{parasail_sg_qb_stats_table,          "parasail_sg_qb_stats_table",          "sg_qb_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_qb_stats_table_scan_avx512_512_64, "parasail_sg_qb_stats_table_scan_avx512_512_64", "sg_qb_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_avx512_512_32, "parasail_sg_qb_stats_table_scan_avx512_512_32", "sg_qb_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_avx512_512_16, "parasail_sg_qb_stats_table_scan_avx512_512_16", "sg_qb_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_scan_avx512_512_8, "parasail_sg_qb_stats_table_scan_avx512_512_8", "sg_qb_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_64, "parasail_sg_qb_stats_table_striped_avx512_512_64", "sg_qb_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_32, "parasail_sg_qb_stats_table_striped_avx512_512_32", "sg_qb_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_16, "parasail_sg_qb_stats_table_striped_avx512_512_16", "sg_qb_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_striped_avx512_512_8, "parasail_sg_qb_stats_table_striped_avx512_512_8", "sg_qb_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_64, "parasail_sg_qb_stats_table_diag_avx512_512_64", "sg_qb_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_32, "parasail_sg_qb_stats_table_diag_avx512_512_32", "sg_qb_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_16, "parasail_sg_qb_stats_table_diag_avx512_512_16", "sg_qb_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_stats_table_diag_avx512_512_8, "parasail_sg_qb_stats_table_diag_avx512_512_8", "sg_qb_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_stats_table_avx512 = {"parasail_sg_qb_stats_table_avx512", parasail_sg_qb_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_stats_table_altivec_functions[] = {
 {parasail_sg_qb_stats_table,          "parasail_sg_qb_stats_table",          "sg_qb_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -1887,6 +2172,25 @@ static parasail_function_info_t parasail_sg_qe_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_stats_table_avx2 = {"parasail_sg_qe_stats_table_avx2", parasail_sg_qe_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_stats_table_avx512_functions[] = {
+{parasail_sg_qe_stats_table,          "parasail_sg_qe_stats_table",          "sg_qe_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_qe_stats_table_scan_avx512_512_64, "parasail_sg_qe_stats_table_scan_avx512_512_64", "sg_qe_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_avx512_512_32, "parasail_sg_qe_stats_table_scan_avx512_512_32", "sg_qe_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_avx512_512_16, "parasail_sg_qe_stats_table_scan_avx512_512_16", "sg_qe_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_scan_avx512_512_8, "parasail_sg_qe_stats_table_scan_avx512_512_8", "sg_qe_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_64, "parasail_sg_qe_stats_table_striped_avx512_512_64", "sg_qe_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_32, "parasail_sg_qe_stats_table_striped_avx512_512_32", "sg_qe_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_16, "parasail_sg_qe_stats_table_striped_avx512_512_16", "sg_qe_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_striped_avx512_512_8, "parasail_sg_qe_stats_table_striped_avx512_512_8", "sg_qe_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_64, "parasail_sg_qe_stats_table_diag_avx512_512_64", "sg_qe_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_32, "parasail_sg_qe_stats_table_diag_avx512_512_32", "sg_qe_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_16, "parasail_sg_qe_stats_table_diag_avx512_512_16", "sg_qe_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_stats_table_diag_avx512_512_8, "parasail_sg_qe_stats_table_diag_avx512_512_8", "sg_qe_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_stats_table_avx512 = {"parasail_sg_qe_stats_table_avx512", parasail_sg_qe_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_stats_table_altivec_functions[] = {
 {parasail_sg_qe_stats_table,          "parasail_sg_qe_stats_table",          "sg_qe_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -2008,6 +2312,25 @@ static parasail_function_info_t parasail_sg_qx_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qx_stats_table_avx2 = {"parasail_sg_qx_stats_table_avx2", parasail_sg_qx_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qx_stats_table_avx512_functions[] = {
+{parasail_sg_qx_stats_table,          "parasail_sg_qx_stats_table",          "sg_qx_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_qx_stats_table_scan_avx512_512_64, "parasail_sg_qx_stats_table_scan_avx512_512_64", "sg_qx_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_avx512_512_32, "parasail_sg_qx_stats_table_scan_avx512_512_32", "sg_qx_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_avx512_512_16, "parasail_sg_qx_stats_table_scan_avx512_512_16", "sg_qx_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_scan_avx512_512_8, "parasail_sg_qx_stats_table_scan_avx512_512_8", "sg_qx_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_64, "parasail_sg_qx_stats_table_striped_avx512_512_64", "sg_qx_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_32, "parasail_sg_qx_stats_table_striped_avx512_512_32", "sg_qx_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_16, "parasail_sg_qx_stats_table_striped_avx512_512_16", "sg_qx_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_striped_avx512_512_8, "parasail_sg_qx_stats_table_striped_avx512_512_8", "sg_qx_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_64, "parasail_sg_qx_stats_table_diag_avx512_512_64", "sg_qx_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_32, "parasail_sg_qx_stats_table_diag_avx512_512_32", "sg_qx_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_16, "parasail_sg_qx_stats_table_diag_avx512_512_16", "sg_qx_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qx_stats_table_diag_avx512_512_8, "parasail_sg_qx_stats_table_diag_avx512_512_8", "sg_qx_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qx_stats_table_avx512 = {"parasail_sg_qx_stats_table_avx512", parasail_sg_qx_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qx_stats_table_altivec_functions[] = {
 {parasail_sg_qx_stats_table,          "parasail_sg_qx_stats_table",          "sg_qx_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -2129,6 +2452,25 @@ static parasail_function_info_t parasail_sg_db_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_db_stats_table_avx2 = {"parasail_sg_db_stats_table_avx2", parasail_sg_db_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_db_stats_table_avx512_functions[] = {
+{parasail_sg_db_stats_table,          "parasail_sg_db_stats_table",          "sg_db_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_db_stats_table_scan_avx512_512_64, "parasail_sg_db_stats_table_scan_avx512_512_64", "sg_db_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_avx512_512_32, "parasail_sg_db_stats_table_scan_avx512_512_32", "sg_db_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_avx512_512_16, "parasail_sg_db_stats_table_scan_avx512_512_16", "sg_db_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_scan_avx512_512_8, "parasail_sg_db_stats_table_scan_avx512_512_8", "sg_db_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_64, "parasail_sg_db_stats_table_striped_avx512_512_64", "sg_db_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_32, "parasail_sg_db_stats_table_striped_avx512_512_32", "sg_db_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_16, "parasail_sg_db_stats_table_striped_avx512_512_16", "sg_db_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_striped_avx512_512_8, "parasail_sg_db_stats_table_striped_avx512_512_8", "sg_db_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_64, "parasail_sg_db_stats_table_diag_avx512_512_64", "sg_db_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_32, "parasail_sg_db_stats_table_diag_avx512_512_32", "sg_db_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_16, "parasail_sg_db_stats_table_diag_avx512_512_16", "sg_db_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_db_stats_table_diag_avx512_512_8, "parasail_sg_db_stats_table_diag_avx512_512_8", "sg_db_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_db_stats_table_avx512 = {"parasail_sg_db_stats_table_avx512", parasail_sg_db_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_db_stats_table_altivec_functions[] = {
 {parasail_sg_db_stats_table,          "parasail_sg_db_stats_table",          "sg_db_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -2250,6 +2592,25 @@ static parasail_function_info_t parasail_sg_de_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_de_stats_table_avx2 = {"parasail_sg_de_stats_table_avx2", parasail_sg_de_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_de_stats_table_avx512_functions[] = {
+{parasail_sg_de_stats_table,          "parasail_sg_de_stats_table",          "sg_de_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_de_stats_table_scan_avx512_512_64, "parasail_sg_de_stats_table_scan_avx512_512_64", "sg_de_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_avx512_512_32, "parasail_sg_de_stats_table_scan_avx512_512_32", "sg_de_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_avx512_512_16, "parasail_sg_de_stats_table_scan_avx512_512_16", "sg_de_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_scan_avx512_512_8, "parasail_sg_de_stats_table_scan_avx512_512_8", "sg_de_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_64, "parasail_sg_de_stats_table_striped_avx512_512_64", "sg_de_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_32, "parasail_sg_de_stats_table_striped_avx512_512_32", "sg_de_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_16, "parasail_sg_de_stats_table_striped_avx512_512_16", "sg_de_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_striped_avx512_512_8, "parasail_sg_de_stats_table_striped_avx512_512_8", "sg_de_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_64, "parasail_sg_de_stats_table_diag_avx512_512_64", "sg_de_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_32, "parasail_sg_de_stats_table_diag_avx512_512_32", "sg_de_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_16, "parasail_sg_de_stats_table_diag_avx512_512_16", "sg_de_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_de_stats_table_diag_avx512_512_8, "parasail_sg_de_stats_table_diag_avx512_512_8", "sg_de_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_de_stats_table_avx512 = {"parasail_sg_de_stats_table_avx512", parasail_sg_de_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_de_stats_table_altivec_functions[] = {
 {parasail_sg_de_stats_table,          "parasail_sg_de_stats_table",          "sg_de_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -2371,6 +2732,25 @@ static parasail_function_info_t parasail_sg_dx_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_dx_stats_table_avx2 = {"parasail_sg_dx_stats_table_avx2", parasail_sg_dx_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_dx_stats_table_avx512_functions[] = {
+{parasail_sg_dx_stats_table,          "parasail_sg_dx_stats_table",          "sg_dx_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_dx_stats_table_scan_avx512_512_64, "parasail_sg_dx_stats_table_scan_avx512_512_64", "sg_dx_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_avx512_512_32, "parasail_sg_dx_stats_table_scan_avx512_512_32", "sg_dx_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_avx512_512_16, "parasail_sg_dx_stats_table_scan_avx512_512_16", "sg_dx_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_scan_avx512_512_8, "parasail_sg_dx_stats_table_scan_avx512_512_8", "sg_dx_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_64, "parasail_sg_dx_stats_table_striped_avx512_512_64", "sg_dx_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_32, "parasail_sg_dx_stats_table_striped_avx512_512_32", "sg_dx_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_16, "parasail_sg_dx_stats_table_striped_avx512_512_16", "sg_dx_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_striped_avx512_512_8, "parasail_sg_dx_stats_table_striped_avx512_512_8", "sg_dx_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_64, "parasail_sg_dx_stats_table_diag_avx512_512_64", "sg_dx_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_32, "parasail_sg_dx_stats_table_diag_avx512_512_32", "sg_dx_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_16, "parasail_sg_dx_stats_table_diag_avx512_512_16", "sg_dx_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_dx_stats_table_diag_avx512_512_8, "parasail_sg_dx_stats_table_diag_avx512_512_8", "sg_dx_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_dx_stats_table_avx512 = {"parasail_sg_dx_stats_table_avx512", parasail_sg_dx_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_dx_stats_table_altivec_functions[] = {
 {parasail_sg_dx_stats_table,          "parasail_sg_dx_stats_table",          "sg_dx_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -2492,6 +2872,25 @@ static parasail_function_info_t parasail_sg_qb_de_stats_table_avx2_functions[] =
 };
 static parasail_function_group_t parasail_sg_qb_de_stats_table_avx2 = {"parasail_sg_qb_de_stats_table_avx2", parasail_sg_qb_de_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_de_stats_table_avx512_functions[] = {
+{parasail_sg_qb_de_stats_table,       "parasail_sg_qb_de_stats_table",       "sg_qb_de_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_qb_de_stats_table_scan_avx512_512_64, "parasail_sg_qb_de_stats_table_scan_avx512_512_64", "sg_qb_de_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_avx512_512_32, "parasail_sg_qb_de_stats_table_scan_avx512_512_32", "sg_qb_de_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_avx512_512_16, "parasail_sg_qb_de_stats_table_scan_avx512_512_16", "sg_qb_de_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_scan_avx512_512_8, "parasail_sg_qb_de_stats_table_scan_avx512_512_8", "sg_qb_de_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_64, "parasail_sg_qb_de_stats_table_striped_avx512_512_64", "sg_qb_de_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_32, "parasail_sg_qb_de_stats_table_striped_avx512_512_32", "sg_qb_de_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_16, "parasail_sg_qb_de_stats_table_striped_avx512_512_16", "sg_qb_de_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_striped_avx512_512_8, "parasail_sg_qb_de_stats_table_striped_avx512_512_8", "sg_qb_de_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_64, "parasail_sg_qb_de_stats_table_diag_avx512_512_64", "sg_qb_de_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_32, "parasail_sg_qb_de_stats_table_diag_avx512_512_32", "sg_qb_de_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_16, "parasail_sg_qb_de_stats_table_diag_avx512_512_16", "sg_qb_de_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qb_de_stats_table_diag_avx512_512_8, "parasail_sg_qb_de_stats_table_diag_avx512_512_8", "sg_qb_de_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_de_stats_table_avx512 = {"parasail_sg_qb_de_stats_table_avx512", parasail_sg_qb_de_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_de_stats_table_altivec_functions[] = {
 {parasail_sg_qb_de_stats_table,       "parasail_sg_qb_de_stats_table",       "sg_qb_de_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -2613,6 +3012,25 @@ static parasail_function_info_t parasail_sg_qe_db_stats_table_avx2_functions[] =
 };
 static parasail_function_group_t parasail_sg_qe_db_stats_table_avx2 = {"parasail_sg_qe_db_stats_table_avx2", parasail_sg_qe_db_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_db_stats_table_avx512_functions[] = {
+{parasail_sg_qe_db_stats_table,       "parasail_sg_qe_db_stats_table",       "sg_qe_db_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_qe_db_stats_table_scan_avx512_512_64, "parasail_sg_qe_db_stats_table_scan_avx512_512_64", "sg_qe_db_stats",    "scan", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_avx512_512_32, "parasail_sg_qe_db_stats_table_scan_avx512_512_32", "sg_qe_db_stats",    "scan", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_avx512_512_16, "parasail_sg_qe_db_stats_table_scan_avx512_512_16", "sg_qe_db_stats",    "scan", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_scan_avx512_512_8, "parasail_sg_qe_db_stats_table_scan_avx512_512_8", "sg_qe_db_stats",    "scan", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_64, "parasail_sg_qe_db_stats_table_striped_avx512_512_64", "sg_qe_db_stats", "striped", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_32, "parasail_sg_qe_db_stats_table_striped_avx512_512_32", "sg_qe_db_stats", "striped", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_16, "parasail_sg_qe_db_stats_table_striped_avx512_512_16", "sg_qe_db_stats", "striped", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_striped_avx512_512_8, "parasail_sg_qe_db_stats_table_striped_avx512_512_8", "sg_qe_db_stats", "striped", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_64, "parasail_sg_qe_db_stats_table_diag_avx512_512_64", "sg_qe_db_stats",    "diag", "avx512", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_32, "parasail_sg_qe_db_stats_table_diag_avx512_512_32", "sg_qe_db_stats",    "diag", "avx512", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_16, "parasail_sg_qe_db_stats_table_diag_avx512_512_16", "sg_qe_db_stats",    "diag", "avx512", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_qe_db_stats_table_diag_avx512_512_8, "parasail_sg_qe_db_stats_table_diag_avx512_512_8", "sg_qe_db_stats",    "diag", "avx512", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_db_stats_table_avx512 = {"parasail_sg_qe_db_stats_table_avx512", parasail_sg_qe_db_stats_table_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_db_stats_table_altivec_functions[] = {
 {parasail_sg_qe_db_stats_table,       "parasail_sg_qe_db_stats_table",       "sg_qe_db_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -75,6 +75,26 @@ static parasail_function_info_t parasail_nw_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_trace_avx2 = {"parasail_nw_trace_avx2", parasail_nw_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_trace_avx512_functions[] = {
+{parasail_nw_trace,                   "parasail_nw_trace",                   "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_nw_trace_scan,              "parasail_nw_trace_scan",              "nw",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512_512_64, "parasail_nw_trace_scan_avx512_512_64", "nw",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512_512_32, "parasail_nw_trace_scan_avx512_512_32", "nw",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512_512_16, "parasail_nw_trace_scan_avx512_512_16", "nw",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512_512_8, "parasail_nw_trace_scan_avx512_512_8", "nw",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_64, "parasail_nw_trace_striped_avx512_512_64", "nw", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_32, "parasail_nw_trace_striped_avx512_512_32", "nw", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_16, "parasail_nw_trace_striped_avx512_512_16", "nw", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512_512_8, "parasail_nw_trace_striped_avx512_512_8", "nw", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_64, "parasail_nw_trace_diag_avx512_512_64", "nw",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_32, "parasail_nw_trace_diag_avx512_512_32", "nw",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_16, "parasail_nw_trace_diag_avx512_512_16", "nw",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512_512_8, "parasail_nw_trace_diag_avx512_512_8", "nw",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_nw_trace_avx512 = {"parasail_nw_trace_avx512", parasail_nw_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_trace_altivec_functions[] = {
 {parasail_nw_trace,                   "parasail_nw_trace",                   "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -196,6 +216,26 @@ static parasail_function_info_t parasail_sg_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_trace_avx2 = {"parasail_sg_trace_avx2", parasail_sg_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_trace_avx512_functions[] = {
+{parasail_sg_trace,                   "parasail_sg_trace",                   "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_trace_scan,              "parasail_sg_trace_scan",              "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512_512_64, "parasail_sg_trace_scan_avx512_512_64", "sg",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512_512_32, "parasail_sg_trace_scan_avx512_512_32", "sg",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512_512_16, "parasail_sg_trace_scan_avx512_512_16", "sg",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512_512_8, "parasail_sg_trace_scan_avx512_512_8", "sg",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_64, "parasail_sg_trace_striped_avx512_512_64", "sg", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_32, "parasail_sg_trace_striped_avx512_512_32", "sg", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_16, "parasail_sg_trace_striped_avx512_512_16", "sg", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512_512_8, "parasail_sg_trace_striped_avx512_512_8", "sg", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_64, "parasail_sg_trace_diag_avx512_512_64", "sg",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_32, "parasail_sg_trace_diag_avx512_512_32", "sg",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_16, "parasail_sg_trace_diag_avx512_512_16", "sg",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512_512_8, "parasail_sg_trace_diag_avx512_512_8", "sg",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_trace_avx512 = {"parasail_sg_trace_avx512", parasail_sg_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_trace_altivec_functions[] = {
 {parasail_sg_trace,                   "parasail_sg_trace",                   "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -317,6 +357,26 @@ static parasail_function_info_t parasail_sw_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_trace_avx2 = {"parasail_sw_trace_avx2", parasail_sw_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_trace_avx512_functions[] = {
+{parasail_sw_trace,                   "parasail_sw_trace",                   "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sw_trace_scan,              "parasail_sw_trace_scan",              "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512_512_64, "parasail_sw_trace_scan_avx512_512_64", "sw",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512_512_32, "parasail_sw_trace_scan_avx512_512_32", "sw",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512_512_16, "parasail_sw_trace_scan_avx512_512_16", "sw",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512_512_8, "parasail_sw_trace_scan_avx512_512_8", "sw",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_64, "parasail_sw_trace_striped_avx512_512_64", "sw", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_32, "parasail_sw_trace_striped_avx512_512_32", "sw", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_16, "parasail_sw_trace_striped_avx512_512_16", "sw", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512_512_8, "parasail_sw_trace_striped_avx512_512_8", "sw", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_64, "parasail_sw_trace_diag_avx512_512_64", "sw",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_32, "parasail_sw_trace_diag_avx512_512_32", "sw",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_16, "parasail_sw_trace_diag_avx512_512_16", "sw",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512_512_8, "parasail_sw_trace_diag_avx512_512_8", "sw",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sw_trace_avx512 = {"parasail_sw_trace_avx512", parasail_sw_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_trace_altivec_functions[] = {
 {parasail_sw_trace,                   "parasail_sw_trace",                   "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -438,6 +498,26 @@ static parasail_function_info_t parasail_sg_qb_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_trace_avx2 = {"parasail_sg_qb_trace_avx2", parasail_sg_qb_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_trace_avx512_functions[] = {
+{parasail_sg_qb_trace,                "parasail_sg_qb_trace",                "sg_qb",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_qb_trace_scan,           "parasail_sg_qb_trace_scan",           "sg_qb",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_avx512_512_64, "parasail_sg_qb_trace_scan_avx512_512_64", "sg_qb",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_avx512_512_32, "parasail_sg_qb_trace_scan_avx512_512_32", "sg_qb",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_avx512_512_16, "parasail_sg_qb_trace_scan_avx512_512_16", "sg_qb",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_scan_avx512_512_8, "parasail_sg_qb_trace_scan_avx512_512_8", "sg_qb",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_64, "parasail_sg_qb_trace_striped_avx512_512_64", "sg_qb", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_32, "parasail_sg_qb_trace_striped_avx512_512_32", "sg_qb", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_16, "parasail_sg_qb_trace_striped_avx512_512_16", "sg_qb", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_striped_avx512_512_8, "parasail_sg_qb_trace_striped_avx512_512_8", "sg_qb", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_64, "parasail_sg_qb_trace_diag_avx512_512_64", "sg_qb",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_32, "parasail_sg_qb_trace_diag_avx512_512_32", "sg_qb",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_16, "parasail_sg_qb_trace_diag_avx512_512_16", "sg_qb",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_trace_diag_avx512_512_8, "parasail_sg_qb_trace_diag_avx512_512_8", "sg_qb",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_trace_avx512 = {"parasail_sg_qb_trace_avx512", parasail_sg_qb_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_trace_altivec_functions[] = {
 {parasail_sg_qb_trace,                "parasail_sg_qb_trace",                "sg_qb",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -559,6 +639,26 @@ static parasail_function_info_t parasail_sg_qe_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_trace_avx2 = {"parasail_sg_qe_trace_avx2", parasail_sg_qe_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_trace_avx512_functions[] = {
+{parasail_sg_qe_trace,                "parasail_sg_qe_trace",                "sg_qe",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_qe_trace_scan,           "parasail_sg_qe_trace_scan",           "sg_qe",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_avx512_512_64, "parasail_sg_qe_trace_scan_avx512_512_64", "sg_qe",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_avx512_512_32, "parasail_sg_qe_trace_scan_avx512_512_32", "sg_qe",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_avx512_512_16, "parasail_sg_qe_trace_scan_avx512_512_16", "sg_qe",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_scan_avx512_512_8, "parasail_sg_qe_trace_scan_avx512_512_8", "sg_qe",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_64, "parasail_sg_qe_trace_striped_avx512_512_64", "sg_qe", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_32, "parasail_sg_qe_trace_striped_avx512_512_32", "sg_qe", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_16, "parasail_sg_qe_trace_striped_avx512_512_16", "sg_qe", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_striped_avx512_512_8, "parasail_sg_qe_trace_striped_avx512_512_8", "sg_qe", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_64, "parasail_sg_qe_trace_diag_avx512_512_64", "sg_qe",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_32, "parasail_sg_qe_trace_diag_avx512_512_32", "sg_qe",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_16, "parasail_sg_qe_trace_diag_avx512_512_16", "sg_qe",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_trace_diag_avx512_512_8, "parasail_sg_qe_trace_diag_avx512_512_8", "sg_qe",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_trace_avx512 = {"parasail_sg_qe_trace_avx512", parasail_sg_qe_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_trace_altivec_functions[] = {
 {parasail_sg_qe_trace,                "parasail_sg_qe_trace",                "sg_qe",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -680,6 +780,26 @@ static parasail_function_info_t parasail_sg_qx_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qx_trace_avx2 = {"parasail_sg_qx_trace_avx2", parasail_sg_qx_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qx_trace_avx512_functions[] = {
+{parasail_sg_qx_trace,                "parasail_sg_qx_trace",                "sg_qx",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_qx_trace_scan,           "parasail_sg_qx_trace_scan",           "sg_qx",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_avx512_512_64, "parasail_sg_qx_trace_scan_avx512_512_64", "sg_qx",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_avx512_512_32, "parasail_sg_qx_trace_scan_avx512_512_32", "sg_qx",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_avx512_512_16, "parasail_sg_qx_trace_scan_avx512_512_16", "sg_qx",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_scan_avx512_512_8, "parasail_sg_qx_trace_scan_avx512_512_8", "sg_qx",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_64, "parasail_sg_qx_trace_striped_avx512_512_64", "sg_qx", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_32, "parasail_sg_qx_trace_striped_avx512_512_32", "sg_qx", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_16, "parasail_sg_qx_trace_striped_avx512_512_16", "sg_qx", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_striped_avx512_512_8, "parasail_sg_qx_trace_striped_avx512_512_8", "sg_qx", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_64, "parasail_sg_qx_trace_diag_avx512_512_64", "sg_qx",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_32, "parasail_sg_qx_trace_diag_avx512_512_32", "sg_qx",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_16, "parasail_sg_qx_trace_diag_avx512_512_16", "sg_qx",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qx_trace_diag_avx512_512_8, "parasail_sg_qx_trace_diag_avx512_512_8", "sg_qx",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qx_trace_avx512 = {"parasail_sg_qx_trace_avx512", parasail_sg_qx_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qx_trace_altivec_functions[] = {
 {parasail_sg_qx_trace,                "parasail_sg_qx_trace",                "sg_qx",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -801,6 +921,26 @@ static parasail_function_info_t parasail_sg_db_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_db_trace_avx2 = {"parasail_sg_db_trace_avx2", parasail_sg_db_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_db_trace_avx512_functions[] = {
+{parasail_sg_db_trace,                "parasail_sg_db_trace",                "sg_db",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_db_trace_scan,           "parasail_sg_db_trace_scan",           "sg_db",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_avx512_512_64, "parasail_sg_db_trace_scan_avx512_512_64", "sg_db",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_avx512_512_32, "parasail_sg_db_trace_scan_avx512_512_32", "sg_db",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_avx512_512_16, "parasail_sg_db_trace_scan_avx512_512_16", "sg_db",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_scan_avx512_512_8, "parasail_sg_db_trace_scan_avx512_512_8", "sg_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_64, "parasail_sg_db_trace_striped_avx512_512_64", "sg_db", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_32, "parasail_sg_db_trace_striped_avx512_512_32", "sg_db", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_16, "parasail_sg_db_trace_striped_avx512_512_16", "sg_db", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_striped_avx512_512_8, "parasail_sg_db_trace_striped_avx512_512_8", "sg_db", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_64, "parasail_sg_db_trace_diag_avx512_512_64", "sg_db",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_32, "parasail_sg_db_trace_diag_avx512_512_32", "sg_db",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_16, "parasail_sg_db_trace_diag_avx512_512_16", "sg_db",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_db_trace_diag_avx512_512_8, "parasail_sg_db_trace_diag_avx512_512_8", "sg_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_db_trace_avx512 = {"parasail_sg_db_trace_avx512", parasail_sg_db_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_db_trace_altivec_functions[] = {
 {parasail_sg_db_trace,                "parasail_sg_db_trace",                "sg_db",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -922,6 +1062,26 @@ static parasail_function_info_t parasail_sg_de_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_de_trace_avx2 = {"parasail_sg_de_trace_avx2", parasail_sg_de_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_de_trace_avx512_functions[] = {
+{parasail_sg_de_trace,                "parasail_sg_de_trace",                "sg_de",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_de_trace_scan,           "parasail_sg_de_trace_scan",           "sg_de",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_avx512_512_64, "parasail_sg_de_trace_scan_avx512_512_64", "sg_de",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_avx512_512_32, "parasail_sg_de_trace_scan_avx512_512_32", "sg_de",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_avx512_512_16, "parasail_sg_de_trace_scan_avx512_512_16", "sg_de",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_scan_avx512_512_8, "parasail_sg_de_trace_scan_avx512_512_8", "sg_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_64, "parasail_sg_de_trace_striped_avx512_512_64", "sg_de", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_32, "parasail_sg_de_trace_striped_avx512_512_32", "sg_de", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_16, "parasail_sg_de_trace_striped_avx512_512_16", "sg_de", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_striped_avx512_512_8, "parasail_sg_de_trace_striped_avx512_512_8", "sg_de", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_64, "parasail_sg_de_trace_diag_avx512_512_64", "sg_de",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_32, "parasail_sg_de_trace_diag_avx512_512_32", "sg_de",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_16, "parasail_sg_de_trace_diag_avx512_512_16", "sg_de",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_de_trace_diag_avx512_512_8, "parasail_sg_de_trace_diag_avx512_512_8", "sg_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_de_trace_avx512 = {"parasail_sg_de_trace_avx512", parasail_sg_de_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_de_trace_altivec_functions[] = {
 {parasail_sg_de_trace,                "parasail_sg_de_trace",                "sg_de",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -1043,6 +1203,26 @@ static parasail_function_info_t parasail_sg_dx_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_dx_trace_avx2 = {"parasail_sg_dx_trace_avx2", parasail_sg_dx_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_dx_trace_avx512_functions[] = {
+{parasail_sg_dx_trace,                "parasail_sg_dx_trace",                "sg_dx",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_dx_trace_scan,           "parasail_sg_dx_trace_scan",           "sg_dx",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_avx512_512_64, "parasail_sg_dx_trace_scan_avx512_512_64", "sg_dx",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_avx512_512_32, "parasail_sg_dx_trace_scan_avx512_512_32", "sg_dx",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_avx512_512_16, "parasail_sg_dx_trace_scan_avx512_512_16", "sg_dx",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_scan_avx512_512_8, "parasail_sg_dx_trace_scan_avx512_512_8", "sg_dx",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_64, "parasail_sg_dx_trace_striped_avx512_512_64", "sg_dx", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_32, "parasail_sg_dx_trace_striped_avx512_512_32", "sg_dx", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_16, "parasail_sg_dx_trace_striped_avx512_512_16", "sg_dx", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_striped_avx512_512_8, "parasail_sg_dx_trace_striped_avx512_512_8", "sg_dx", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_64, "parasail_sg_dx_trace_diag_avx512_512_64", "sg_dx",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_32, "parasail_sg_dx_trace_diag_avx512_512_32", "sg_dx",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_16, "parasail_sg_dx_trace_diag_avx512_512_16", "sg_dx",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_dx_trace_diag_avx512_512_8, "parasail_sg_dx_trace_diag_avx512_512_8", "sg_dx",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_dx_trace_avx512 = {"parasail_sg_dx_trace_avx512", parasail_sg_dx_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_dx_trace_altivec_functions[] = {
 {parasail_sg_dx_trace,                "parasail_sg_dx_trace",                "sg_dx",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -1164,6 +1344,26 @@ static parasail_function_info_t parasail_sg_qb_de_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qb_de_trace_avx2 = {"parasail_sg_qb_de_trace_avx2", parasail_sg_qb_de_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qb_de_trace_avx512_functions[] = {
+{parasail_sg_qb_de_trace,             "parasail_sg_qb_de_trace",             "sg_qb_de",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_qb_de_trace_scan,        "parasail_sg_qb_de_trace_scan",        "sg_qb_de",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_avx512_512_64, "parasail_sg_qb_de_trace_scan_avx512_512_64", "sg_qb_de",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_avx512_512_32, "parasail_sg_qb_de_trace_scan_avx512_512_32", "sg_qb_de",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_avx512_512_16, "parasail_sg_qb_de_trace_scan_avx512_512_16", "sg_qb_de",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_scan_avx512_512_8, "parasail_sg_qb_de_trace_scan_avx512_512_8", "sg_qb_de",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_64, "parasail_sg_qb_de_trace_striped_avx512_512_64", "sg_qb_de", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_32, "parasail_sg_qb_de_trace_striped_avx512_512_32", "sg_qb_de", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_16, "parasail_sg_qb_de_trace_striped_avx512_512_16", "sg_qb_de", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_striped_avx512_512_8, "parasail_sg_qb_de_trace_striped_avx512_512_8", "sg_qb_de", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_64, "parasail_sg_qb_de_trace_diag_avx512_512_64", "sg_qb_de",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_32, "parasail_sg_qb_de_trace_diag_avx512_512_32", "sg_qb_de",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_16, "parasail_sg_qb_de_trace_diag_avx512_512_16", "sg_qb_de",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qb_de_trace_diag_avx512_512_8, "parasail_sg_qb_de_trace_diag_avx512_512_8", "sg_qb_de",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qb_de_trace_avx512 = {"parasail_sg_qb_de_trace_avx512", parasail_sg_qb_de_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qb_de_trace_altivec_functions[] = {
 {parasail_sg_qb_de_trace,             "parasail_sg_qb_de_trace",             "sg_qb_de",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -1285,6 +1485,26 @@ static parasail_function_info_t parasail_sg_qe_db_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_qe_db_trace_avx2 = {"parasail_sg_qe_db_trace_avx2", parasail_sg_qe_db_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_qe_db_trace_avx512_functions[] = {
+{parasail_sg_qe_db_trace,             "parasail_sg_qe_db_trace",             "sg_qe_db",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_qe_db_trace_scan,        "parasail_sg_qe_db_trace_scan",        "sg_qe_db",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_avx512_512_64, "parasail_sg_qe_db_trace_scan_avx512_512_64", "sg_qe_db",    "scan", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_avx512_512_32, "parasail_sg_qe_db_trace_scan_avx512_512_32", "sg_qe_db",    "scan", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_avx512_512_16, "parasail_sg_qe_db_trace_scan_avx512_512_16", "sg_qe_db",    "scan", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_scan_avx512_512_8, "parasail_sg_qe_db_trace_scan_avx512_512_8", "sg_qe_db",    "scan", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_64, "parasail_sg_qe_db_trace_striped_avx512_512_64", "sg_qe_db", "striped", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_32, "parasail_sg_qe_db_trace_striped_avx512_512_32", "sg_qe_db", "striped", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_16, "parasail_sg_qe_db_trace_striped_avx512_512_16", "sg_qe_db", "striped", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_striped_avx512_512_8, "parasail_sg_qe_db_trace_striped_avx512_512_8", "sg_qe_db", "striped", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_64, "parasail_sg_qe_db_trace_diag_avx512_512_64", "sg_qe_db",    "diag", "avx512", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_32, "parasail_sg_qe_db_trace_diag_avx512_512_32", "sg_qe_db",    "diag", "avx512", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_16, "parasail_sg_qe_db_trace_diag_avx512_512_16", "sg_qe_db",    "diag", "avx512", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_qe_db_trace_diag_avx512_512_8, "parasail_sg_qe_db_trace_diag_avx512_512_8", "sg_qe_db",    "diag", "avx512", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_qe_db_trace_avx512 = {"parasail_sg_qe_db_trace_avx512", parasail_sg_qe_db_trace_avx512_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_qe_db_trace_altivec_functions[] = {
 {parasail_sg_qe_db_trace,             "parasail_sg_qe_db_trace",             "sg_qe_db",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
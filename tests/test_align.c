@@ -410,7 +410,8 @@ int main(int argc, char **argv)
         int saturated = 0;
         if ((0 == strncmp(f.isa, "sse2",  4) && 0 == parasail_can_use_sse2()) 
                 || (0 == strncmp(f.isa, "sse41", 5) && 0 == parasail_can_use_sse41())
-                || (0 == strncmp(f.isa, "avx2",  4) && 0 == parasail_can_use_avx2())) {
+                || (0 == strncmp(f.isa, "avx2",  4) && 0 == parasail_can_use_avx2())
+                || (0 == strncmp(f.isa, "avx512", 6) && 0 == parasail_can_use_avx512bw())) {
             f = functions[index++];
             continue;
         }
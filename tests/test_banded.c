@@ -0,0 +1,369 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+static const char alphabet[] = "ARNDCQEGHILKMFPSTWYV";
+
+/* score a CIGAR, leaving end gaps free for semi-global alignments */
+static int rescore(
+        const parasail_cigar_t *cigar,
+        const char *s1, const char *s2,
+        int open, int gap, const parasail_matrix_t *matrix,
+        int free_ends, int *s1_used, int *s2_used)
+{
+    int score = 0;
+    int i = cigar->beg_query;
+    int j = cigar->beg_ref;
+    int k = 0;
+    for (k=0; k<cigar->len; ++k) {
+        char op = parasail_cigar_decode_op(cigar->seq[k]);
+        int len = (int)parasail_cigar_decode_len(cigar->seq[k]);
+        int end = (0 == k || cigar->len-1 == k);
+        if ('I' == op || 'D' == op) {
+            if (!(free_ends && end)) {
+                score -= open + (len-1)*gap;
+            }
+            if ('I' == op) {
+                i += len;
+            }
+            else {
+                j += len;
+            }
+        }
+        else {
+            int l = 0;
+            for (l=0; l<len; ++l) {
+                if (('=' == op) != (s1[i] == s2[j])) {
+                    return -1;
+                }
+                score += matrix->matrix[
+                    matrix->mapper[(unsigned char)s1[i]]*matrix->size
+                    + matrix->mapper[(unsigned char)s2[j]]];
+                ++i;
+                ++j;
+            }
+        }
+    }
+    *s1_used = i;
+    *s2_used = j;
+    return score;
+}
+
+/* a band wide enough for the whole table must match the full method */
+static int check_exact(
+        const char *name,
+        parasail_result_t *result,
+        parasail_result_t *expected)
+{
+    if (NULL == result) {
+        printf("%s: no result\n", name);
+        return 1;
+    }
+    if (result->score != expected->score
+            || result->end_query != expected->end_query
+            || result->end_ref != expected->end_ref) {
+        printf("%s: (%d,%d,%d) != (%d,%d,%d)\n", name,
+                result->score, result->end_query, result->end_ref,
+                expected->score, expected->end_query, expected->end_ref);
+        return 1;
+    }
+    if (parasail_result_is_stats(expected)
+            && (parasail_result_get_matches(result) != parasail_result_get_matches(expected)
+                || parasail_result_get_similar(result) != parasail_result_get_similar(expected)
+                || parasail_result_get_length(result) != parasail_result_get_length(expected))) {
+        printf("%s: stats (%d,%d,%d) != (%d,%d,%d)\n", name,
+                parasail_result_get_matches(result),
+                parasail_result_get_similar(result),
+                parasail_result_get_length(result),
+                parasail_result_get_matches(expected),
+                parasail_result_get_similar(expected),
+                parasail_result_get_length(expected));
+        return 1;
+    }
+    return 0;
+}
+
+/* the path of a trace result must score what the result reports */
+static int check_trace(
+        const char *name,
+        parasail_result_t *result,
+        const char *s1, int s1Len, const char *s2, int s2Len,
+        int open, int gap, int free_ends, int local)
+{
+    parasail_cigar_t *cigar = NULL;
+    int s1_used = 0;
+    int s2_used = 0;
+    int score = 0;
+    int errors = 0;
+
+    if (NULL == result || !parasail_result_is_trace(result)) {
+        printf("%s: no trace\n", name);
+        return 1;
+    }
+    cigar = parasail_result_get_cigar(result, s1, s1Len, s2, s2Len,
+            &parasail_blosum62);
+    score = rescore(cigar, s1, s2, open, gap, &parasail_blosum62,
+            free_ends, &s1_used, &s2_used);
+    if (score != result->score) {
+        printf("%s: path scores %d, expected %d\n", name, score, result->score);
+        ++errors;
+    }
+    if (local) {
+        if (result->score > 0
+                && (s1_used != result->end_query+1
+                    || s2_used != result->end_ref+1)) {
+            printf("%s: path ends at (%d,%d)\n", name, s1_used-1, s2_used-1);
+            ++errors;
+        }
+    }
+    else if (cigar->beg_query != 0 || cigar->beg_ref != 0
+            || s1_used != s1Len || s2_used != s2Len) {
+        printf("%s: path covers [%d,%d) x [%d,%d)\n", name,
+                cigar->beg_query, s1_used, cigar->beg_ref, s2_used);
+        ++errors;
+    }
+    parasail_cigar_free(cigar);
+    return errors;
+}
+
+/* encoded sequences must decode to their mapped residues and align
+ * exactly like the residues themselves */
+static int check_encoded(
+        const char *s1, int s1Len, const char *s2, int s2Len,
+        int open, int gap, int k, const parasail_matrix_t *matrix, int bits)
+{
+    parasail_encoded_t *e1 = parasail_encode(s1, s1Len, matrix);
+    parasail_encoded_t *e2 = parasail_encode(s2, s2Len, matrix);
+    parasail_result_t *expected = NULL;
+    parasail_result_t *result = NULL;
+    int *index = (int*)malloc(sizeof(int)*(s1Len+1));
+    int errors = 0;
+    int i = 0;
+
+    if (e1->bits != bits) {
+        printf("parasail_encode: %d bits, expected %d\n", e1->bits, bits);
+        ++errors;
+    }
+    parasail_encoded_decode(e1, index);
+    for (i=0; i<s1Len; ++i) {
+        if (index[i] != matrix->mapper[(unsigned char)s1[i]]) {
+            printf("parasail_encoded_decode: %d bits, residue %d\n", bits, i);
+            ++errors;
+            break;
+        }
+    }
+
+    expected = parasail_nw_stats_banded_sat(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    result = parasail_nw_stats_banded_encoded_sat(e1, e2, open, gap, k);
+    errors += check_exact("parasail_nw_stats_banded_encoded_sat", result, expected);
+    parasail_result_free(result);
+    parasail_result_free(expected);
+
+    expected = parasail_sw_banded_adaptive_sat(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    result = parasail_sw_banded_adaptive_encoded_sat(e1, e2, open, gap, k);
+    errors += check_exact("parasail_sw_banded_adaptive_encoded_sat", result, expected);
+    parasail_result_free(result);
+    parasail_result_free(expected);
+
+    free(index);
+    parasail_encoded_free(e2);
+    parasail_encoded_free(e1);
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int a = 0;
+    int w = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 40;
+    const int gaps[][2] = {{10,1}, {3,1}, {11,2}};
+    const char *alg_names[3] = {"nw", "sg", "sw"};
+    parasail_function_t *full[3] = {parasail_nw, parasail_sg, parasail_sw};
+    parasail_function_t *full_stats[3] = {
+        parasail_nw_stats, parasail_sg_stats, parasail_sw_stats};
+    /* [alg][variant][width], widths 8, 16, 32, sat */
+    parasail_banded_function_t *banded[3][3][4] = {
+        {{parasail_nw_banded_8, parasail_nw_banded_16, parasail_nw_banded_32, parasail_nw_banded_sat},
+         {parasail_nw_stats_banded_8, parasail_nw_stats_banded_16, parasail_nw_stats_banded_32, parasail_nw_stats_banded_sat},
+         {parasail_nw_trace_banded_8, parasail_nw_trace_banded_16, parasail_nw_trace_banded_32, parasail_nw_trace_banded_sat}},
+        {{parasail_sg_banded_8, parasail_sg_banded_16, parasail_sg_banded_32, parasail_sg_banded_sat},
+         {parasail_sg_stats_banded_8, parasail_sg_stats_banded_16, parasail_sg_stats_banded_32, parasail_sg_stats_banded_sat},
+         {parasail_sg_trace_banded_8, parasail_sg_trace_banded_16, parasail_sg_trace_banded_32, parasail_sg_trace_banded_sat}},
+        {{parasail_sw_banded_8, parasail_sw_banded_16, parasail_sw_banded_32, parasail_sw_banded_sat},
+         {parasail_sw_stats_banded_8, parasail_sw_stats_banded_16, parasail_sw_stats_banded_32, parasail_sw_stats_banded_sat},
+         {parasail_sw_trace_banded_8, parasail_sw_trace_banded_16, parasail_sw_trace_banded_32, parasail_sw_trace_banded_sat}}};
+    parasail_banded_function_t *adaptive[3][2] = {
+        {parasail_nw_banded_adaptive_sat, parasail_nw_trace_banded_adaptive_sat},
+        {parasail_sg_banded_adaptive_sat, parasail_sg_trace_banded_adaptive_sat},
+        {parasail_sw_banded_adaptive_sat, parasail_sw_trace_banded_adaptive_sat}};
+    parasail_banded_encoded_function_t *encoded[3][4] = {
+        {parasail_nw_trace_banded_encoded_8, parasail_nw_trace_banded_encoded_16, parasail_nw_trace_banded_encoded_32, parasail_nw_trace_banded_encoded_sat},
+        {parasail_sg_trace_banded_encoded_8, parasail_sg_trace_banded_encoded_16, parasail_sg_trace_banded_encoded_32, parasail_sg_trace_banded_encoded_sat},
+        {parasail_sw_trace_banded_encoded_8, parasail_sw_trace_banded_encoded_16, parasail_sw_trace_banded_encoded_32, parasail_sw_trace_banded_encoded_sat}};
+    const char *widths[4] = {"8", "16", "32", "sat"};
+    parasail_matrix_t *dna4 = parasail_matrix_create("ACGT", 2, -3);
+    parasail_matrix_t *dna2 = parasail_matrix_create("ACG", 2, -3);
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (i=0; i<count; ++i) {
+        int length = i < count-2
+                ? 1 + (int)(next_random(&state) % 300)
+                : 2000 + (int)(next_random(&state) % 1000);
+        int s2Len = 0;
+        char *s1 = random_sequence(&state, alphabet, length);
+        char *s2 = mutate(&state, alphabet, s1, length, 2, 10, 0, &s2Len);
+        int open = gaps[i%3][0];
+        int gap = gaps[i%3][1];
+        int wide = length > s2Len ? length : s2Len;
+        int narrow = 1 + (int)(next_random(&state) % 20);
+        parasail_encoded_t *e1 = NULL;
+        parasail_encoded_t *e2 = NULL;
+
+        if (0 == s2Len) {
+            free(s2);
+            s2 = random_sequence(&state, alphabet, 1);
+            s2Len = 1;
+        }
+        e1 = parasail_encode(s1, length, &parasail_blosum62);
+        e2 = parasail_encode(s2, s2Len, &parasail_blosum62);
+
+        for (a=0; a<3; ++a) {
+            parasail_result_t *expected = NULL;
+            parasail_result_t *expected_stats = NULL;
+            parasail_result_t *result = NULL;
+            char name[64];
+            int free_ends = (1 == a);
+            int local = (2 == a);
+
+            expected = full[a](s1, length, s2, s2Len, open, gap, &parasail_blosum62);
+            expected_stats = full_stats[a](s1, length, s2, s2Len, open, gap, &parasail_blosum62);
+
+            for (w=0; w<4; ++w) {
+                /* narrow widths may saturate, otherwise they are exact */
+                sprintf(name, "parasail_%s_banded_%s", alg_names[a], widths[w]);
+                result = banded[a][0][w](s1, length, s2, s2Len, open, gap, wide, &parasail_blosum62);
+                if (!parasail_result_is_saturated(result)) {
+                    errors += check_exact(name, result, expected);
+                }
+                else if (w >= 2) {
+                    printf("%s: saturated\n", name);
+                    ++errors;
+                }
+                parasail_result_free(result);
+
+                sprintf(name, "parasail_%s_stats_banded_%s", alg_names[a], widths[w]);
+                result = banded[a][1][w](s1, length, s2, s2Len, open, gap, wide, &parasail_blosum62);
+                if (!parasail_result_is_saturated(result)) {
+                    errors += check_exact(name, result, expected_stats);
+                }
+                else if (w >= 2) {
+                    printf("%s: saturated\n", name);
+                    ++errors;
+                }
+                parasail_result_free(result);
+
+                sprintf(name, "parasail_%s_trace_banded_%s", alg_names[a], widths[w]);
+                result = banded[a][2][w](s1, length, s2, s2Len, open, gap, wide, &parasail_blosum62);
+                if (!parasail_result_is_saturated(result)) {
+                    errors += check_exact(name, result, expected);
+                    errors += check_trace(name, result, s1, length, s2, s2Len,
+                            open, gap, free_ends, local);
+                }
+                else if (w >= 2) {
+                    printf("%s: saturated\n", name);
+                    ++errors;
+                }
+                parasail_result_free(result);
+
+                sprintf(name, "parasail_%s_trace_banded_encoded_%s", alg_names[a], widths[w]);
+                result = encoded[a][w](e1, e2, open, gap, wide);
+                if (!parasail_result_is_saturated(result)) {
+                    errors += check_exact(name, result, expected);
+                    errors += check_trace(name, result, s1, length, s2, s2Len,
+                            open, gap, free_ends, local);
+                }
+                else if (w >= 2) {
+                    printf("%s: saturated\n", name);
+                    ++errors;
+                }
+                parasail_result_free(result);
+            }
+
+            /* a narrow band scores no better than the full table, and
+             * its path still scores what the result reports */
+            sprintf(name, "parasail_%s_trace_banded_sat", alg_names[a]);
+            result = banded[a][2][3](s1, length, s2, s2Len, open, gap, narrow, &parasail_blosum62);
+            if (result->score > expected->score) {
+                printf("%s: k=%d scores %d > %d\n", name, narrow,
+                        result->score, expected->score);
+                ++errors;
+            }
+            errors += check_trace(name, result, s1, length, s2, s2Len,
+                    open, gap, free_ends, local);
+            parasail_result_free(result);
+
+            sprintf(name, "parasail_%s_banded_adaptive_sat", alg_names[a]);
+            result = adaptive[a][0](s1, length, s2, s2Len, open, gap, narrow, &parasail_blosum62);
+            if (result->score > expected->score) {
+                printf("%s: k=%d scores %d > %d\n", name, narrow,
+                        result->score, expected->score);
+                ++errors;
+            }
+            parasail_result_free(result);
+
+            sprintf(name, "parasail_%s_trace_banded_adaptive_sat", alg_names[a]);
+            result = adaptive[a][1](s1, length, s2, s2Len, open, gap, narrow, &parasail_blosum62);
+            errors += check_trace(name, result, s1, length, s2, s2Len,
+                    open, gap, free_ends, local);
+            parasail_result_free(result);
+
+            parasail_result_free(expected_stats);
+            parasail_result_free(expected);
+        }
+
+        /* the same residues read as DNA, packed 4 and 2 bits each */
+        errors += check_encoded(s1, length, s2, s2Len, open, gap, narrow, dna4, 4);
+        errors += check_encoded(s1, length, s2, s2Len, open, gap, narrow, dna2, 2);
+
+        parasail_encoded_free(e2);
+        parasail_encoded_free(e1);
+        free(s2);
+        free(s1);
+    }
+
+    /* the _sat functions count their passes like the others */
+    {
+        parasail_sat_stats_t stats;
+        parasail_result_t *result = NULL;
+        parasail_sat_stats_reset();
+        result = parasail_nw_banded_sat(
+                "HEAGAWGHEE", 10, "PAWHEAE", 7, 10, 1, 3, &parasail_blosum62);
+        parasail_sat_stats_get(&stats);
+        if (1 != stats.bits8) {
+            printf("parasail_nw_banded_sat: parasail_sat_stats %llu %llu %llu\n",
+                    stats.bits8, stats.bits16, stats.bits32);
+            ++errors;
+        }
+        parasail_result_free(result);
+    }
+
+    parasail_matrix_free(dna2);
+    parasail_matrix_free(dna4);
+
+    printf("%-40s %s\n", "parasail_*_banded_*", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,211 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+static const char alphabet[] = "ARNDCQEGHILKMFPSTWYV";
+
+static int check(
+        const char *name,
+        parasail_batch_function_t *function,
+        int exact,
+        const char *query, int queryLen,
+        const char **db, const int *dbLens, int count,
+        const int *expected, const int *end_query, const int *end_ref)
+{
+    int i = 0;
+    int errors = 0;
+    parasail_result_t **results = NULL;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*count);
+    function(query, queryLen, db, dbLens, count, 10, 1, &parasail_blosum62, results);
+    for (i=0; i<count; ++i) {
+        if (NULL == results[i]) {
+            printf("%s: no result for %d\n", name, i);
+            ++errors;
+            continue;
+        }
+        if (!exact && parasail_result_is_saturated(results[i])) {
+            parasail_result_free(results[i]);
+            continue;
+        }
+        if (results[i]->score != expected[i]) {
+            printf("%s: db %d length %d score %d != %d\n",
+                    name, i, dbLens[i], results[i]->score, expected[i]);
+            ++errors;
+        }
+        else if (results[i]->end_query != end_query[i]
+                || results[i]->end_ref != end_ref[i]) {
+            printf("%s: db %d length %d end (%d,%d) != (%d,%d)\n",
+                    name, i, dbLens[i],
+                    results[i]->end_query, results[i]->end_ref,
+                    end_query[i], end_ref[i]);
+            ++errors;
+        }
+        parasail_result_free(results[i]);
+    }
+    free(results);
+    printf("%-32s %s\n", name, errors ? "FAIL" : "PASS");
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 100;
+    const int queryLen = 250;
+    char *query = NULL;
+    const char **db = NULL;
+    int *dbLens = NULL;
+    int *expected = NULL;
+    int *end_query = NULL;
+    int *end_ref = NULL;
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    query = random_sequence(&state, alphabet, queryLen);
+    db = (const char**)malloc(sizeof(const char*)*count);
+    dbLens = (int*)malloc(sizeof(int)*count);
+    expected = (int*)malloc(sizeof(int)*count);
+    end_query = (int*)malloc(sizeof(int)*count);
+    end_ref = (int*)malloc(sizeof(int)*count);
+    for (i=0; i<count; ++i) {
+        /* include empty sequences and a few that saturate 8 bits */
+        if (i % 17 == 3) {
+            dbLens[i] = 0;
+            db[i] = random_sequence(&state, alphabet, 0);
+        }
+        else if (i % 23 == 5) {
+            char *copy = (char*)malloc(queryLen+1);
+            memcpy(copy, query, queryLen+1);
+            dbLens[i] = queryLen;
+            db[i] = copy;
+        }
+        else {
+            dbLens[i] = 1 + (int)(next_random(&state) % 400);
+            db[i] = random_sequence(&state, alphabet, dbLens[i]);
+        }
+    }
+    for (i=0; i<count; ++i) {
+        parasail_result_t *result = NULL;
+        if (0 == dbLens[i]) {
+            /* an empty database sequence has an empty local alignment,
+             * reported where parasail_sw leaves its end positions */
+            expected[i] = 0;
+            end_query[i] = queryLen;
+            end_ref[i] = 0;
+            continue;
+        }
+        result = parasail_sw(
+                query, queryLen, db[i], dbLens[i], 10, 1, &parasail_blosum62);
+        expected[i] = result->score;
+        end_query[i] = result->end_query;
+        end_ref[i] = result->end_ref;
+        parasail_result_free(result);
+    }
+
+#define CHECK(name, exact) \
+    errors += check(#name, name, exact, query, queryLen, \
+            db, dbLens, count, expected, end_query, end_ref)
+    CHECK(parasail_sw_batch_8, 0);
+    CHECK(parasail_sw_batch_16, 1);
+    CHECK(parasail_sw_batch_32, 1);
+    CHECK(parasail_sw_batch_sat, 1);
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        CHECK(parasail_sw_batch_sse2_128_8, 0);
+        CHECK(parasail_sw_batch_sse2_128_16, 1);
+        CHECK(parasail_sw_batch_sse2_128_32, 1);
+    }
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        CHECK(parasail_sw_batch_sse41_128_8, 0);
+        CHECK(parasail_sw_batch_sse41_128_16, 1);
+        CHECK(parasail_sw_batch_sse41_128_32, 1);
+    }
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        CHECK(parasail_sw_batch_avx2_256_8, 0);
+        CHECK(parasail_sw_batch_avx2_256_16, 1);
+        CHECK(parasail_sw_batch_avx2_256_32, 1);
+    }
+#endif
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        CHECK(parasail_sw_batch_avx512_512_8, 0);
+        CHECK(parasail_sw_batch_avx512_512_16, 1);
+        CHECK(parasail_sw_batch_avx512_512_32, 1);
+    }
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        CHECK(parasail_sw_batch_altivec_128_8, 0);
+        CHECK(parasail_sw_batch_altivec_128_16, 1);
+        CHECK(parasail_sw_batch_altivec_128_32, 1);
+    }
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        CHECK(parasail_sw_batch_neon_128_8, 0);
+        CHECK(parasail_sw_batch_neon_128_16, 1);
+        CHECK(parasail_sw_batch_neon_128_32, 1);
+    }
+#endif
+#undef CHECK
+
+    /* a self match long enough to saturate 16 bits takes
+     * parasail_sw_batch_sat through its 32-bit retry */
+    {
+        const int longLen = 12500;
+        char *longQuery = random_sequence(&state, alphabet, longLen);
+        const char *longDb[3];
+        int longLens[3];
+        int longExpected[3];
+        int longEndQuery[3];
+        int longEndRef[3];
+
+        longDb[0] = longQuery;
+        longLens[0] = longLen;
+        longDb[1] = query;
+        longLens[1] = queryLen;
+        longDb[2] = db[1];
+        longLens[2] = dbLens[1];
+        for (i=0; i<3; ++i) {
+            parasail_result_t *result = parasail_sw(longQuery, longLen,
+                    longDb[i], longLens[i], 10, 1, &parasail_blosum62);
+            longExpected[i] = result->score;
+            longEndQuery[i] = result->end_query;
+            longEndRef[i] = result->end_ref;
+            parasail_result_free(result);
+        }
+        errors += check("parasail_sw_batch_sat long", parasail_sw_batch_sat, 1,
+                longQuery, longLen, longDb, longLens, 3,
+                longExpected, longEndQuery, longEndRef);
+        free(longQuery);
+    }
+
+    for (i=0; i<count; ++i) {
+        free((char*)db[i]);
+    }
+    free(end_ref);
+    free(end_query);
+    free(expected);
+    free(dbLens);
+    free(db);
+    free(query);
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+/* random flanks around a mutated copy of part of seq */
+static char* embed(unsigned long *state, const char *alphabet, const char *seq, int length, int *out)
+{
+    int i = 0;
+    int k = 0;
+    int size = (int)strlen(alphabet);
+    int from = (int)(next_random(state) % length);
+    int to = from + (int)(next_random(state) % (length - from)) + 1;
+    int left = (int)(next_random(state) % 200);
+    int right = (int)(next_random(state) % 200);
+    char *copy = (char*)malloc(left + 2*(to-from) + right + 1);
+    for (i=0; i<left; ++i) {
+        copy[k++] = alphabet[next_random(state) % size];
+    }
+    for (i=from; i<to; ++i) {
+        unsigned long r = next_random(state) % 100;
+        if (r < 3) {
+            continue;
+        }
+        if (r < 6) {
+            copy[k++] = alphabet[next_random(state) % size];
+        }
+        copy[k++] = r < 16 ? alphabet[next_random(state) % size] : seq[i];
+    }
+    for (i=0; i<right; ++i) {
+        copy[k++] = alphabet[next_random(state) % size];
+    }
+    if (0 == k) {
+        copy[k++] = alphabet[0];
+    }
+    copy[k] = '\0';
+    *out = k;
+    return copy;
+}
+
+/* the begin must start an alignment that reaches the end cell with the
+ * reported score, at a place the algorithm allows */
+static int check(
+        const char *name,
+        parasail_result_t *result,
+        int found,
+        const char *s1, const char *s2,
+        int open, int gap,
+        const parasail_matrix_t *matrix)
+{
+    int bq = parasail_result_get_begin_query(result);
+    int br = parasail_result_get_begin_ref(result);
+    int eq = parasail_result_get_end_query(result);
+    int er = parasail_result_get_end_ref(result);
+    parasail_result_t *global = NULL;
+    int errors = 0;
+
+    if (parasail_result_is_sw(result) && result->score <= 0) {
+        if (found || bq != -1 || br != -1) {
+            printf("%s: begin (%d,%d) of an empty alignment\n", name, bq, br);
+            return 1;
+        }
+        return 0;
+    }
+    if (!found || bq < 0 || br < 0 || bq > eq || br > er) {
+        printf("%s: begin (%d,%d) end (%d,%d)\n", name, bq, br, eq, er);
+        return 1;
+    }
+    if (parasail_result_is_nw(result) && (bq != 0 || br != 0)) {
+        printf("%s: nw begin (%d,%d)\n", name, bq, br);
+        ++errors;
+    }
+    if (parasail_result_is_sg(result)) {
+        int s1_beg = result->flag & PARASAIL_FLAG_SG_S1_BEG;
+        int s2_beg = result->flag & PARASAIL_FLAG_SG_S2_BEG;
+        if (!((0 == bq && 0 == br)
+                    || (s1_beg && 0 == br)
+                    || (s2_beg && 0 == bq))) {
+            printf("%s: sg begin (%d,%d)\n", name, bq, br);
+            ++errors;
+        }
+    }
+    global = parasail_nw(s1+bq, eq-bq+1, s2+br, er-br+1, open, gap, matrix);
+    if (global->score != result->score) {
+        printf("%s: begin (%d,%d) end (%d,%d) scores %d, not %d\n", name,
+                bq, br, eq, er, global->score, result->score);
+        ++errors;
+    }
+    parasail_result_free(global);
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int m = 0;
+    int f = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 60;
+    const int gaps[][2] = {{10,1}, {3,1}, {11,2}};
+    parasail_matrix_t *acgt = parasail_matrix_create("ACGT", 2, -3);
+    const parasail_matrix_t *matrices[] = {&parasail_blosum62, acgt};
+    const char *alphabets[] = {"ARNDCQEGHILKMFPSTWYV", "ACGT"};
+    parasail_function_t *functions[] = {
+        parasail_sw,
+        parasail_sw_striped_sat,
+        parasail_sw_scan_16,
+        parasail_sw_diag_32,
+        parasail_sw_stats_striped_sat,
+        parasail_sg,
+        parasail_sg_qb,
+        parasail_sg_qe,
+        parasail_sg_db,
+        parasail_sg_qx,
+        parasail_sg_dx,
+        parasail_sg_qb_de,
+        parasail_sg_qe_db,
+        parasail_sg_striped_sat,
+        parasail_sg_stats_scan_sat,
+        parasail_nw_striped_sat};
+    const char *names[] = {
+        "parasail_sw",
+        "parasail_sw_striped_sat",
+        "parasail_sw_scan_16",
+        "parasail_sw_diag_32",
+        "parasail_sw_stats_striped_sat",
+        "parasail_sg",
+        "parasail_sg_qb",
+        "parasail_sg_qe",
+        "parasail_sg_db",
+        "parasail_sg_qx",
+        "parasail_sg_dx",
+        "parasail_sg_qb_de",
+        "parasail_sg_qe_db",
+        "parasail_sg_striped_sat",
+        "parasail_sg_stats_scan_sat",
+        "parasail_nw_striped_sat"};
+    const int nfunctions = (int)(sizeof(functions)/sizeof(functions[0]));
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (m=0; m<(int)(sizeof(matrices)/sizeof(matrices[0])); ++m) {
+        const parasail_matrix_t *matrix = matrices[m];
+        const char *alphabet = alphabets[m];
+        for (i=0; i<count; ++i) {
+            int s1Len = 1 + (int)(next_random(&state) % 300);
+            int s2Len = 0;
+            int open = gaps[i%3][0];
+            int gap = gaps[i%3][1];
+            char *s1 = random_sequence(&state, alphabet, s1Len);
+            char *s2 = NULL;
+
+            /* mostly local hits inside unrelated flanks */
+            if (i % 4) {
+                s2 = embed(&state, alphabet, s1, s1Len, &s2Len);
+            }
+            else {
+                s2Len = 1 + (int)(next_random(&state) % 300);
+                s2 = random_sequence(&state, alphabet, s2Len);
+            }
+
+            for (f=0; f<nfunctions; ++f) {
+                char name[64];
+                parasail_result_t *result = functions[f](s1, s1Len, s2, s2Len,
+                        open, gap, matrix);
+                int found = parasail_result_find_begin(result,
+                        s1, s1Len, s2, s2Len, open, gap, matrix);
+                sprintf(name, "%s (%s %d)", names[f], matrix->name, i);
+                errors += check(name, result, found, s1, s2, open, gap, matrix);
+                parasail_result_free(result);
+            }
+
+            free(s2);
+            free(s1);
+        }
+    }
+
+    parasail_matrix_free(acgt);
+
+    printf("%-40s %s\n", "parasail_result_find_begin", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
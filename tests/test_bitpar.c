@@ -0,0 +1,124 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+typedef struct config {
+    const char *alphabet;
+    int match;
+    int mismatch;
+    int open;
+    int gap;
+    int bitpar[2];  /* nw, sg expected to skip the scan fallback */
+} config_t;
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int c = 0;
+    int a = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 40;
+    const config_t configs[] = {
+        /* unit cost edit distance */
+        {"ACGT", 0, -1, 1, 1, {1,1}},
+        {"ACGT", 0, -2, 2, 2, {1,1}},
+        /* scaled edit distance, match == 2*mismatch + 2*gap */
+        {"ACGT", 2, -1, 2, 2, {1,0}},
+        {"ACGTN", 4, -2, 4, 4, {1,0}},
+        /* longest common subsequence, mismatch <= -2*gap */
+        {"ACGT", 1, -3, 1, 1, {1,0}},
+        {"ACGT", 3, -4, 2, 2, {1,0}},
+        /* not unit cost */
+        {"ACGT", 1, -1, 1, 1, {0,0}},
+        {"ACGT", 0, -1, 5, 2, {0,0}},
+        {NULL, 0, 0, 1, 1, {0,0}},
+    };
+    const char *alg_names[2] = {"nw", "sg"};
+    parasail_function_t *references[2] = {parasail_nw, parasail_sg};
+    parasail_function_t *functions[2] = {parasail_nw_bitpar, parasail_sg_bitpar};
+    /* the vector functions must keep running their own kernels */
+    parasail_function_t *vectors[2] = {
+        parasail_nw_striped_16, parasail_sg_scan_16};
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (c=0; c<(int)(sizeof(configs)/sizeof(configs[0])); ++c) {
+        const config_t *config = &configs[c];
+        parasail_matrix_t *created = NULL;
+        const parasail_matrix_t *matrix = &parasail_blosum62;
+        const char *alphabet = "ARNDCQEGHILKMFPSTWYV";
+        if (NULL != config->alphabet) {
+            created = parasail_matrix_create(config->alphabet,
+                    config->match, config->mismatch);
+            matrix = created;
+            alphabet = config->alphabet;
+        }
+        for (i=0; i<count; ++i) {
+            /* cover exact and partial 64-bit words as well as long queries */
+            int length = i < 4 ? 63 + i
+                    : i < count-3 ? 1 + (int)(next_random(&state) % 300)
+                    : 1000 + (int)(next_random(&state) % 1000);
+            int s2Len = 0;
+            char *s1 = random_sequence(&state, alphabet, length);
+            char *s2 = NULL;
+
+            /* mostly related pairs, some unrelated */
+            if (i % 4 == 3) {
+                s2Len = 1 + (int)(next_random(&state) % 300);
+                s2 = random_sequence(&state, alphabet, s2Len);
+            }
+            else {
+                s2 = mutate(&state, alphabet, s1, length, 3, 4, 0, &s2Len);
+            }
+
+            for (a=0; a<2; ++a) {
+                char name[64];
+                parasail_result_t *expected = references[a](s1, length, s2, s2Len,
+                        config->open, config->gap, matrix);
+                parasail_result_t *result = functions[a](s1, length, s2, s2Len,
+                        config->open, config->gap, matrix);
+                sprintf(name, "parasail_%s_bitpar (%s %d,%d)",
+                        alg_names[a], matrix->name, config->open, config->gap);
+                errors += check_result(name, result, expected);
+                if (NULL != result && config->bitpar[a]
+                        && !(result->flag & PARASAIL_FLAG_NOVEC)) {
+                    printf("%s: used the striped fallback\n", name);
+                    ++errors;
+                }
+                parasail_result_free(result);
+                if (config->bitpar[a]) {
+                    result = vectors[a](s1, length, s2, s2Len,
+                            config->open, config->gap, matrix);
+                    sprintf(name, "parasail_%s vector (%s %d,%d)", alg_names[a],
+                            matrix->name, config->open, config->gap);
+                    if (NULL != result && (result->flag & PARASAIL_FLAG_NOVEC)) {
+                        printf("%s: bit-parallel kernel used\n", name);
+                        ++errors;
+                    }
+                    parasail_result_free(result);
+                }
+                parasail_result_free(expected);
+            }
+
+            free(s2);
+            free(s1);
+        }
+        if (NULL != created) {
+            parasail_matrix_free(created);
+        }
+    }
+
+    printf("%-40s %s\n", "parasail_*_bitpar", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
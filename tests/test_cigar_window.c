@@ -0,0 +1,230 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+/* long random flanks around a mutated copy of part of seq */
+static char* embed(unsigned long *state, const char *alphabet, const char *seq, int length, int *out)
+{
+    int i = 0;
+    int k = 0;
+    int size = (int)strlen(alphabet);
+    int from = (int)(next_random(state) % length);
+    int to = from + (int)(next_random(state) % (length - from)) + 1;
+    int left = (int)(next_random(state) % 1000);
+    int right = (int)(next_random(state) % 1000);
+    char *copy = (char*)malloc(left + 2*(to-from) + right + 1);
+    for (i=0; i<left; ++i) {
+        copy[k++] = alphabet[next_random(state) % size];
+    }
+    for (i=from; i<to; ++i) {
+        unsigned long r = next_random(state) % 100;
+        if (r < 3) {
+            continue;
+        }
+        if (r < 6) {
+            copy[k++] = alphabet[next_random(state) % size];
+        }
+        copy[k++] = r < 16 ? alphabet[next_random(state) % size] : seq[i];
+    }
+    for (i=0; i<right; ++i) {
+        copy[k++] = alphabet[next_random(state) % size];
+    }
+    if (0 == k) {
+        copy[k++] = alphabet[0];
+    }
+    copy[k] = '\0';
+    *out = k;
+    return copy;
+}
+
+/* the cigar must run from its begin to the end location of the result
+ * and score what the result reports; semi-global end gaps are free
+ * where the result allows them */
+static int check(
+        const char *name,
+        parasail_result_t *result,
+        parasail_cigar_t *cigar,
+        const char *s1, int s1Len,
+        const char *s2, int s2Len,
+        int open, int gap,
+        const parasail_matrix_t *matrix)
+{
+    int flag = result->flag;
+    int i = 0;
+    int j = 0;
+    int k = 0;
+    int score = 0;
+
+    if (parasail_result_is_sw(result) && result->score <= 0) {
+        if (NULL != cigar) {
+            printf("%s: cigar of an empty alignment\n", name);
+            return 1;
+        }
+        return 0;
+    }
+    if (NULL == cigar) {
+        printf("%s: no cigar\n", name);
+        return 1;
+    }
+    i = cigar->beg_query;
+    j = cigar->beg_ref;
+    for (k=0; k<cigar->len; ++k) {
+        char op = parasail_cigar_decode_op(cigar->seq[k]);
+        int len = (int)parasail_cigar_decode_len(cigar->seq[k]);
+        int l = 0;
+        if ('=' == op || 'X' == op) {
+            for (l=0; l<len; ++l) {
+                if ((s1[i+l] == s2[j+l]) != ('=' == op)) {
+                    printf("%s: %c at (%d,%d)\n", name, op, i+l, j+l);
+                    return 1;
+                }
+                score += matrix->matrix[
+                    matrix->mapper[(unsigned char)s1[i+l]]*matrix->size
+                    + matrix->mapper[(unsigned char)s2[j+l]]];
+            }
+            i += len;
+            j += len;
+        }
+        else if ('I' == op) {
+            int free_gap = parasail_result_is_sg(result)
+                && ((0 == k && (flag & PARASAIL_FLAG_SG_S1_BEG))
+                        || (cigar->len-1 == k && (flag & PARASAIL_FLAG_SG_S1_END)));
+            if (!free_gap) {
+                score -= open + (len-1)*gap;
+            }
+            i += len;
+        }
+        else if ('D' == op) {
+            int free_gap = parasail_result_is_sg(result)
+                && ((0 == k && (flag & PARASAIL_FLAG_SG_S2_BEG))
+                        || (cigar->len-1 == k && (flag & PARASAIL_FLAG_SG_S2_END)));
+            if (!free_gap) {
+                score -= open + (len-1)*gap;
+            }
+            j += len;
+        }
+        else {
+            printf("%s: op %c\n", name, op);
+            return 1;
+        }
+    }
+    if (parasail_result_is_sg(result)) {
+        if (i != s1Len || j != s2Len) {
+            printf("%s: sg cigar covers (%d,%d) of (%d,%d)\n", name,
+                    i, j, s1Len, s2Len);
+            return 1;
+        }
+    }
+    else if (i-1 != result->end_query || j-1 != result->end_ref) {
+        printf("%s: cigar ends at (%d,%d), not (%d,%d)\n", name,
+                i-1, j-1, result->end_query, result->end_ref);
+        return 1;
+    }
+    if (score != result->score) {
+        printf("%s: cigar scores %d, not %d\n", name, score, result->score);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int m = 0;
+    int f = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 40;
+    const int gaps[][2] = {{10,1}, {3,1}, {11,2}};
+    parasail_matrix_t *acgt = parasail_matrix_create("ACGT", 2, -3);
+    const parasail_matrix_t *matrices[] = {&parasail_blosum62, acgt};
+    const char *alphabets[] = {"ARNDCQEGHILKMFPSTWYV", "ACGT"};
+    parasail_function_t *functions[] = {
+        parasail_sw,
+        parasail_sw_striped_sat,
+        parasail_sw_stats_striped_sat,
+        parasail_sg,
+        parasail_sg_qb,
+        parasail_sg_qe,
+        parasail_sg_db,
+        parasail_sg_de,
+        parasail_sg_qx,
+        parasail_sg_dx,
+        parasail_sg_qb_de,
+        parasail_sg_striped_sat,
+        parasail_nw,
+        parasail_nw_scan_sat};
+    const char *names[] = {
+        "parasail_sw",
+        "parasail_sw_striped_sat",
+        "parasail_sw_stats_striped_sat",
+        "parasail_sg",
+        "parasail_sg_qb",
+        "parasail_sg_qe",
+        "parasail_sg_db",
+        "parasail_sg_de",
+        "parasail_sg_qx",
+        "parasail_sg_dx",
+        "parasail_sg_qb_de",
+        "parasail_sg_striped_sat",
+        "parasail_nw",
+        "parasail_nw_scan_sat"};
+    const int nfunctions = (int)(sizeof(functions)/sizeof(functions[0]));
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (m=0; m<(int)(sizeof(matrices)/sizeof(matrices[0])); ++m) {
+        const parasail_matrix_t *matrix = matrices[m];
+        const char *alphabet = alphabets[m];
+        for (i=0; i<count; ++i) {
+            int s1Len = 1 + (int)(next_random(&state) % 300);
+            int s2Len = 0;
+            int open = gaps[i%3][0];
+            int gap = gaps[i%3][1];
+            char *s1 = random_sequence(&state, alphabet, s1Len);
+            char *s2 = NULL;
+
+            /* mostly local hits inside long unrelated flanks */
+            if (i % 4) {
+                s2 = embed(&state, alphabet, s1, s1Len, &s2Len);
+            }
+            else {
+                s2Len = 1 + (int)(next_random(&state) % 300);
+                s2 = random_sequence(&state, alphabet, s2Len);
+            }
+
+            for (f=0; f<nfunctions; ++f) {
+                char name[64];
+                parasail_result_t *result = functions[f](s1, s1Len, s2, s2Len,
+                        open, gap, matrix);
+                parasail_cigar_t *cigar = parasail_result_get_cigar_window(
+                        result, s1, s1Len, s2, s2Len, open, gap, matrix);
+                sprintf(name, "%s (%s %d)", names[f], matrix->name, i);
+                errors += check(name, result, cigar, s1, s1Len, s2, s2Len,
+                        open, gap, matrix);
+                if (NULL != cigar) {
+                    parasail_cigar_free(cigar);
+                }
+                parasail_result_free(result);
+            }
+
+            free(s2);
+            free(s1);
+        }
+    }
+
+    parasail_matrix_free(acgt);
+
+    printf("%-40s %s\n", "parasail_result_get_cigar_window", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
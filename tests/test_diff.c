@@ -0,0 +1,109 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+#include "parasail/matrices/dnafull.h"
+#include "parasail/matrices/nuc44.h"
+#include "parasail/matrices/pam250.h"
+
+#include "test_util.h"
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int m = 0;
+    int a = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 30;
+    /* the last penalties do not fit in bytes, so the 8-bit functions
+     * saturate and the _sat functions use the scan functions */
+    const int gaps[][2] = {{10,1}, {5,2}, {3,3}, {1,1}, {70,2}};
+    parasail_matrix_t *acgt_small = parasail_matrix_create("ACGT", 1, -1);
+    parasail_matrix_t *acgt_large = parasail_matrix_create("ACGT", 5, -4);
+    parasail_matrix_t *acgt_wide = parasail_matrix_create("ACGT", 100, -100);
+    const parasail_matrix_t *matrices[] = {
+        acgt_small, acgt_large, &parasail_dnafull, &parasail_nuc44,
+        &parasail_blosum62, &parasail_pam250, acgt_wide};
+    const char *alphabets[] = {
+        "ACGT", "ACGT", "ACGTRYKMN", "ACGTN", "ARNDCQEGHILKMFPSTWYV",
+        "ARNDCQEGHILKMFPSTWYV", "ACGT"};
+    const char *alg_names[2] = {"nw", "sg"};
+    parasail_function_t *references[2] = {parasail_nw, parasail_sg};
+    parasail_function_t *functions[2] = {
+        parasail_nw_diag_diff_8, parasail_sg_diag_diff_8};
+    parasail_function_t *sat_functions[2] = {
+        parasail_nw_diag_diff_sat, parasail_sg_diag_diff_sat};
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (m=0; m<(int)(sizeof(matrices)/sizeof(matrices[0])); ++m) {
+        const parasail_matrix_t *matrix = matrices[m];
+        const char *alphabet = alphabets[m];
+        for (i=0; i<count; ++i) {
+            /* long pairs score far beyond the range of 8 bits */
+            int length = i < count-3
+                    ? 1 + (int)(next_random(&state) % 300)
+                    : 3000 + (int)(next_random(&state) % 2000);
+            int s2Len = 0;
+            char *s1 = random_sequence(&state, alphabet, length);
+            char *s2 = NULL;
+            int open = gaps[i%5][0];
+            int gap = gaps[i%5][1];
+            int fits = open <= 63 && matrix->max + 4*open <= UINT8_MAX;
+
+            /* mostly related pairs, some unrelated */
+            if (i % 4 == 3) {
+                s2Len = 1 + (int)(next_random(&state) % 300);
+                s2 = random_sequence(&state, alphabet, s2Len);
+            }
+            else {
+                s2 = mutate(&state, alphabet, s1, length, 3, 4, 0, &s2Len);
+            }
+
+            for (a=0; a<2; ++a) {
+                char name[64];
+                parasail_result_t *expected = references[a](s1, length, s2, s2Len,
+                        open, gap, matrix);
+                parasail_result_t *result = functions[a](s1, length, s2, s2Len,
+                        open, gap, matrix);
+                sprintf(name, "parasail_%s_diag_diff_8 (%s %d,%d)",
+                        alg_names[a], matrix->name, open, gap);
+                if (parasail_result_is_saturated(result) == fits) {
+                    printf("%s: %s\n", name,
+                            fits ? "saturated" : "not saturated");
+                    ++errors;
+                }
+                else if (fits) {
+                    errors += check_result(name, result, expected);
+                }
+                parasail_result_free(result);
+
+                result = sat_functions[a](s1, length, s2, s2Len,
+                        open, gap, matrix);
+                sprintf(name, "parasail_%s_diag_diff_sat (%s %d,%d)",
+                        alg_names[a], matrix->name, open, gap);
+                errors += check_result(name, result, expected);
+                parasail_result_free(result);
+                parasail_result_free(expected);
+            }
+
+            free(s2);
+            free(s1);
+        }
+    }
+
+    parasail_matrix_free(acgt_wide);
+    parasail_matrix_free(acgt_large);
+    parasail_matrix_free(acgt_small);
+
+    printf("%-40s %s\n", "parasail_*_diag_diff_{8,sat}", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+#include "parasail/matrices/dnafull.h"
+#include "parasail/matrices/nuc44.h"
+
+#include "test_util.h"
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int m = 0;
+    int a = 0;
+    int w = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 30;
+    const int gaps[][2] = {{5,2}, {3,1}, {10,1}};
+    parasail_matrix_t *acgt_small = parasail_matrix_create("ACGT", 1, -1);
+    parasail_matrix_t *acgt_large = parasail_matrix_create("ACGT", 5, -4);
+    parasail_matrix_t *acgt_wide = parasail_matrix_create("ACGT", 100, -100);
+    /* the last two do not fit the lookup and use the striped functions */
+    const parasail_matrix_t *matrices[] = {
+        acgt_small, acgt_large, &parasail_dnafull, &parasail_nuc44,
+        acgt_wide, &parasail_blosum62};
+    const char *alphabets[] = {
+        "ACGT", "ACGT", "ACGTRYKMN", "ACGTN", "ACGT", "ARNDCQEGHILKMFPSTWYV"};
+    const char *alg_names[3] = {"nw", "sg", "sw"};
+    parasail_function_t *references[3] = {parasail_nw, parasail_sg, parasail_sw};
+    /* [alg][width], widths 8, 16, 32, sat */
+    parasail_function_t *functions[3][4] = {
+        {parasail_nw_striped_dna_8, parasail_nw_striped_dna_16, parasail_nw_striped_dna_32, parasail_nw_striped_dna_sat},
+        {parasail_sg_striped_dna_8, parasail_sg_striped_dna_16, parasail_sg_striped_dna_32, parasail_sg_striped_dna_sat},
+        {parasail_sw_striped_dna_8, parasail_sw_striped_dna_16, parasail_sw_striped_dna_32, parasail_sw_striped_dna_sat}};
+    const char *widths[4] = {"8", "16", "32", "sat"};
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (m=0; m<(int)(sizeof(matrices)/sizeof(matrices[0])); ++m) {
+        const parasail_matrix_t *matrix = matrices[m];
+        const char *alphabet = alphabets[m];
+        for (i=0; i<count; ++i) {
+            int length = i < count-2
+                    ? 1 + (int)(next_random(&state) % 300)
+                    : 2000 + (int)(next_random(&state) % 1000);
+            int s2Len = 0;
+            char *s1 = random_sequence(&state, alphabet, length);
+            char *s2 = NULL;
+            int open = gaps[i%3][0];
+            int gap = gaps[i%3][1];
+
+            /* mostly related pairs, some unrelated */
+            if (i % 4 == 3) {
+                s2Len = 1 + (int)(next_random(&state) % 300);
+                s2 = random_sequence(&state, alphabet, s2Len);
+            }
+            else {
+                s2 = mutate(&state, alphabet, s1, length, 3, 4, 0, &s2Len);
+            }
+
+            for (a=0; a<3; ++a) {
+                parasail_result_t *expected = references[a](s1, length, s2, s2Len,
+                        open, gap, matrix);
+                for (w=0; w<4; ++w) {
+                    char name[64];
+                    parasail_result_t *result = functions[a][w](s1, length, s2, s2Len,
+                            open, gap, matrix);
+                    /* narrow widths may saturate, otherwise they are exact */
+                    sprintf(name, "parasail_%s_striped_dna_%s (%s)",
+                            alg_names[a], widths[w], matrix->name);
+                    if (!parasail_result_is_saturated(result)) {
+                        errors += check_result(name, result, expected);
+                    }
+                    else if (w >= 2) {
+                        printf("%s: saturated\n", name);
+                        ++errors;
+                    }
+                    parasail_result_free(result);
+                }
+                parasail_result_free(expected);
+            }
+
+            free(s2);
+            free(s1);
+        }
+    }
+
+    /* the _sat functions count their passes like the others */
+    {
+        parasail_sat_stats_t stats;
+        parasail_result_t *result = NULL;
+        parasail_sat_stats_reset();
+        result = parasail_nw_striped_dna_sat(
+                "GATTACA", 7, "GCATGCT", 7, 10, 1, acgt_small);
+        parasail_sat_stats_get(&stats);
+        if (1 != stats.bits8) {
+            printf("parasail_nw_striped_dna_sat: parasail_sat_stats %llu %llu %llu\n",
+                    stats.bits8, stats.bits16, stats.bits32);
+            ++errors;
+        }
+        parasail_result_free(result);
+    }
+
+    parasail_matrix_free(acgt_wide);
+    parasail_matrix_free(acgt_large);
+    parasail_matrix_free(acgt_small);
+
+    printf("%-40s %s\n", "parasail_*_striped_dna_*", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+static const char alphabet[] = "ARNDCQEGHILKMFPSTWYV";
+
+/* copy of the first length residues of seq with substitutions and indels,
+ * followed by unrelated residues so that the extension has to drop off */
+/* every vector extension must stop where the serial one stops */
+static int check_extend(
+        const char *name,
+        parasail_result_t *result,
+        const parasail_extension_t *extension,
+        parasail_result_t *expected,
+        const parasail_extension_t *expected_extension)
+{
+    if (NULL == result) {
+        printf("%s: no result\n", name);
+        return 1;
+    }
+    if (result->score != expected->score
+            || result->end_query != expected->end_query
+            || result->end_ref != expected->end_ref) {
+        printf("%s: (%d,%d,%d) != (%d,%d,%d)\n", name,
+                result->score, result->end_query, result->end_ref,
+                expected->score, expected->end_query, expected->end_ref);
+        return 1;
+    }
+    if (extension->query_end_score != expected_extension->query_end_score
+            || extension->query_end_ref != expected_extension->query_end_ref
+            || extension->ref_end_score != expected_extension->ref_end_score
+            || extension->ref_end_query != expected_extension->ref_end_query
+            || extension->ref_scanned != expected_extension->ref_scanned
+            || extension->stop != expected_extension->stop) {
+        printf("%s: extension (%d,%d,%d,%d,%d,%d) != (%d,%d,%d,%d,%d,%d)\n", name,
+                extension->query_end_score, extension->query_end_ref,
+                extension->ref_end_score, extension->ref_end_query,
+                extension->ref_scanned, extension->stop,
+                expected_extension->query_end_score, expected_extension->query_end_ref,
+                expected_extension->ref_end_score, expected_extension->ref_end_query,
+                expected_extension->ref_scanned, expected_extension->stop);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int d = 0;
+    int p = 0;
+    int w = 0;
+    int errors = 0;
+    int stopped = 0;
+    unsigned long state = 1;
+    const int count = 40;
+    const int gaps[][2] = {{10,1}, {3,1}, {11,2}};
+    const int drops[][2] = {{-1,-1}, {10,-1}, {40,-1}, {100,-1}, {-1,20}, {-1,100}, {40,60}};
+    const char *par_names[2] = {"scan", "striped"};
+    /* [par][width], widths 8, 16, 32, sat */
+    parasail_extend_function_t *functions[2][4] = {
+        {parasail_extend_scan_8, parasail_extend_scan_16, parasail_extend_scan_32, parasail_extend_scan_sat},
+        {parasail_extend_striped_8, parasail_extend_striped_16, parasail_extend_striped_32, parasail_extend_striped_sat}};
+    parasail_extend_pfunction_t *pfunctions[2][4] = {
+        {parasail_extend_scan_profile_8, parasail_extend_scan_profile_16, parasail_extend_scan_profile_32, parasail_extend_scan_profile_sat},
+        {parasail_extend_striped_profile_8, parasail_extend_striped_profile_16, parasail_extend_striped_profile_32, parasail_extend_striped_profile_sat}};
+    const char *widths[4] = {"8", "16", "32", "sat"};
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (i=0; i<count; ++i) {
+        int length = i < count-2
+                ? 1 + (int)(next_random(&state) % 300)
+                : 2000 + (int)(next_random(&state) % 1000);
+        int tail = (int)(next_random(&state) % 200);
+        int s2Len = 0;
+        char *s1 = random_sequence(&state, alphabet, length);
+        char *s2 = mutate(&state, alphabet, s1, length, 2, 5, tail, &s2Len);
+        int open = gaps[i%3][0];
+        int gap = gaps[i%3][1];
+        parasail_profile_t *profile = NULL;
+
+        if (0 == s2Len) {
+            free(s2);
+            s2 = random_sequence(&state, alphabet, 1);
+            s2Len = 1;
+        }
+
+        profile = parasail_profile_create_sat(s1, length, &parasail_blosum62);
+
+        for (d=0; d<(int)(sizeof(drops)/sizeof(drops[0])); ++d) {
+            int xdrop = drops[d][0];
+            int zdrop = drops[d][1];
+            parasail_extension_t expected_extension;
+            parasail_result_t *expected = parasail_extend(s1, length, s2, s2Len,
+                    open, gap, &parasail_blosum62, xdrop, zdrop, &expected_extension);
+
+            if (PARASAIL_EXTEND_END != expected_extension.stop) {
+                ++stopped;
+            }
+
+            for (p=0; p<2; ++p) {
+                for (w=0; w<4; ++w) {
+                    parasail_extension_t extension;
+                    parasail_result_t *result = NULL;
+                    char name[64];
+
+                    /* narrow widths may saturate, otherwise they are exact */
+                    sprintf(name, "parasail_extend_%s_%s", par_names[p], widths[w]);
+                    result = functions[p][w](s1, length, s2, s2Len, open, gap,
+                            &parasail_blosum62, xdrop, zdrop, &extension);
+                    if (!parasail_result_is_saturated(result)) {
+                        errors += check_extend(name, result, &extension,
+                                expected, &expected_extension);
+                    }
+                    else if (w >= 2) {
+                        printf("%s: saturated\n", name);
+                        ++errors;
+                    }
+                    parasail_result_free(result);
+
+                    sprintf(name, "parasail_extend_%s_profile_%s", par_names[p], widths[w]);
+                    result = pfunctions[p][w](profile, s2, s2Len, open, gap,
+                            xdrop, zdrop, &extension);
+                    if (!parasail_result_is_saturated(result)) {
+                        errors += check_extend(name, result, &extension,
+                                expected, &expected_extension);
+                    }
+                    else if (w >= 2) {
+                        printf("%s: saturated\n", name);
+                        ++errors;
+                    }
+                    parasail_result_free(result);
+                }
+            }
+
+            parasail_result_free(expected);
+        }
+
+        parasail_profile_free(profile);
+        free(s2);
+        free(s1);
+    }
+
+    /* the drops must actually end some of the extensions early */
+    if (0 == stopped) {
+        printf("parasail_extend: no extension dropped off\n");
+        ++errors;
+    }
+
+    printf("%-40s %s\n", "parasail_extend_*", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
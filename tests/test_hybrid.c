@@ -0,0 +1,130 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+/* a short random unit repeated to the given length */
+static char* repeat_sequence(unsigned long *state, const char *alphabet, int length)
+{
+    int i = 0;
+    int size = (int)strlen(alphabet);
+    int unit = 2 + (int)(next_random(state) % 6);
+    char *seq = (char*)malloc(length+1);
+    for (i=0; i<length; ++i) {
+        seq[i] = i < unit ? alphabet[next_random(state) % size] : seq[i-unit];
+    }
+    seq[length] = '\0';
+    return seq;
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int m = 0;
+    int a = 0;
+    int w = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 40;
+    /* a high open to extend ratio keeps the Lazy_F loop busy */
+    const int gaps[][2] = {{10,1}, {3,1}, {24,1}, {2,2}};
+    parasail_matrix_t *acgt = parasail_matrix_create("ACGT", 2, -3);
+    const parasail_matrix_t *matrices[] = {&parasail_blosum62, acgt};
+    const char *alphabets[] = {"ARNDCQEGHILKMFPSTWYV", "ACGT"};
+    const char *alg_names[3] = {"nw", "sg", "sw"};
+    parasail_function_t *references[3] = {parasail_nw, parasail_sg, parasail_sw};
+    /* [alg][width], widths 8, 16, 32, sat */
+    parasail_function_t *functions[3][4] = {
+        {parasail_nw_hybrid_8, parasail_nw_hybrid_16, parasail_nw_hybrid_32, parasail_nw_hybrid_sat},
+        {parasail_sg_hybrid_8, parasail_sg_hybrid_16, parasail_sg_hybrid_32, parasail_sg_hybrid_sat},
+        {parasail_sw_hybrid_8, parasail_sw_hybrid_16, parasail_sw_hybrid_32, parasail_sw_hybrid_sat}};
+    const char *widths[4] = {"8", "16", "32", "sat"};
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (m=0; m<(int)(sizeof(matrices)/sizeof(matrices[0])); ++m) {
+        const parasail_matrix_t *matrix = matrices[m];
+        const char *alphabet = alphabets[m];
+        for (i=0; i<count; ++i) {
+            int length = i < count-4
+                    ? 1 + (int)(next_random(&state) % 400)
+                    : 2000 + (int)(next_random(&state) % 1000);
+            int s2Len = 0;
+            char *s1 = NULL;
+            char *s2 = NULL;
+            int open = gaps[i%4][0];
+            int gap = gaps[i%4][1];
+
+            /* repeats switch to scan columns and back, unrelated pairs
+             * mostly stay striped */
+            if (i % 3 == 0) {
+                s1 = random_sequence(&state, alphabet, length);
+                s2Len = 1 + (int)(next_random(&state) % 400);
+                s2 = random_sequence(&state, alphabet, s2Len);
+            }
+            else if (i % 3 == 1) {
+                s1 = repeat_sequence(&state, alphabet, length);
+                s2 = mutate(&state, alphabet, s1, length, 3, 4, 0, &s2Len);
+            }
+            else {
+                s1 = random_sequence(&state, alphabet, length);
+                s2 = mutate(&state, alphabet, s1, length, 3, 4, 0, &s2Len);
+            }
+
+            for (a=0; a<3; ++a) {
+                parasail_result_t *expected = references[a](s1, length, s2, s2Len,
+                        open, gap, matrix);
+                for (w=0; w<4; ++w) {
+                    char name[64];
+                    parasail_result_t *result = functions[a][w](s1, length, s2, s2Len,
+                            open, gap, matrix);
+                    /* narrow widths may saturate, otherwise they are exact */
+                    sprintf(name, "parasail_%s_hybrid_%s (%s %d,%d)",
+                            alg_names[a], widths[w], matrix->name, open, gap);
+                    if (!parasail_result_is_saturated(result)) {
+                        errors += check_result(name, result, expected);
+                    }
+                    else if (w >= 2) {
+                        printf("%s: saturated\n", name);
+                        ++errors;
+                    }
+                    parasail_result_free(result);
+                }
+                parasail_result_free(expected);
+            }
+
+            free(s2);
+            free(s1);
+        }
+    }
+
+    /* the _sat functions count their passes like the others */
+    {
+        parasail_sat_stats_t stats;
+        parasail_result_t *result = NULL;
+        parasail_sat_stats_reset();
+        result = parasail_sw_hybrid_sat(
+                "HEAGAWGHEE", 10, "PAWHEAE", 7, 10, 1, &parasail_blosum62);
+        parasail_sat_stats_get(&stats);
+        if (1 != stats.bits8) {
+            printf("parasail_sw_hybrid_sat: parasail_sat_stats %llu %llu %llu\n",
+                    stats.bits8, stats.bits16, stats.bits32);
+            ++errors;
+        }
+        parasail_result_free(result);
+    }
+
+    parasail_matrix_free(acgt);
+
+    printf("%-40s %s\n", "parasail_*_hybrid_*", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,257 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+static const char alphabet[] = "ARNDCQEGHILKMFPSTWYV";
+
+/* compare a _sat function against the 32-bit striped kernel */
+static int check(
+        const char *name,
+        parasail_function_t *function,
+        const char **s1s, const int *s1Lens,
+        const char **s2s, const int *s2Lens, int count)
+{
+    int i = 0;
+    int errors = 0;
+
+    for (i=0; i<count; ++i) {
+        parasail_result_t *expected = parasail_sw_striped_32(
+                s1s[i], s1Lens[i], s2s[i], s2Lens[i], 10, 1, &parasail_blosum62);
+        parasail_result_t *result = function(
+                s1s[i], s1Lens[i], s2s[i], s2Lens[i], 10, 1, &parasail_blosum62);
+        if (result->score != expected->score
+                || result->end_query != expected->end_query
+                || result->end_ref != expected->end_ref) {
+            printf("%s: pair %d (%d,%d,%d) != (%d,%d,%d)\n", name, i,
+                    result->score, result->end_query, result->end_ref,
+                    expected->score, expected->end_query, expected->end_ref);
+            ++errors;
+        }
+        parasail_result_free(result);
+        parasail_result_free(expected);
+    }
+    printf("%-40s %s\n", name, errors ? "FAIL" : "PASS");
+    return errors;
+}
+
+/* compare a profile _sat or _auto function against the 32-bit striped
+ * kernel; the wider profile widths must not exist until a pair needs
+ * them */
+static int check_profile(
+        const char *name,
+        parasail_pfunction_t *function,
+        parasail_pcreator_t *creator,
+        const char **s1s, const int *s1Lens,
+        const char **s2s, const int *s2Lens, int count)
+{
+    int i = 0;
+    int errors = 0;
+
+    for (i=0; i<count; ++i) {
+        parasail_profile_t *profile = creator(s1s[i], s1Lens[i], &parasail_blosum62);
+        parasail_result_t *expected = parasail_sw_striped_32(
+                s1s[i], s1Lens[i], s2s[i], s2Lens[i], 10, 1, &parasail_blosum62);
+        parasail_result_t *result = NULL;
+        if (NULL != profile->profile16.score || NULL != profile->profile32.score) {
+            printf("%s: pair %d wider profiles built up front\n", name, i);
+            ++errors;
+        }
+        result = function(profile, s2s[i], s2Lens[i], 10, 1);
+        if (result->score != expected->score
+                || result->end_query != expected->end_query
+                || result->end_ref != expected->end_ref) {
+            printf("%s: pair %d (%d,%d,%d) != (%d,%d,%d)\n", name, i,
+                    result->score, result->end_query, result->end_ref,
+                    expected->score, expected->end_query, expected->end_ref);
+            ++errors;
+        }
+        if (expected->score >= INT8_MAX && NULL == profile->profile16.score
+                && NULL == profile->profile32.score) {
+            printf("%s: pair %d wider profile not built\n", name, i);
+            ++errors;
+        }
+        parasail_result_free(result);
+        parasail_result_free(expected);
+        parasail_profile_free(profile);
+    }
+    printf("%-40s %s\n", name, errors ? "FAIL" : "PASS");
+    return errors;
+}
+
+/* run an _auto function on a short pair and compare the kernel widths
+ * it ran with the expected number of passes at each width */
+static int check_passes(
+        const char *name,
+        parasail_function_t *function,
+        unsigned long long bits8,
+        unsigned long long bits16,
+        unsigned long long bits32)
+{
+    parasail_sat_stats_t stats;
+    parasail_result_t *result = NULL;
+    int errors = 0;
+
+    parasail_sat_stats_reset();
+    result = function("HEAGAWGHEE", 10, "PAWHEAE", 7, 10, 1, &parasail_blosum62);
+    parasail_sat_stats_get(&stats);
+    if (stats.bits8 != bits8 || stats.bits16 != bits16 || stats.bits32 != bits32) {
+        printf("%s: passes %llu %llu %llu, expected %llu %llu %llu\n", name,
+                stats.bits8, stats.bits16, stats.bits32, bits8, bits16, bits32);
+        ++errors;
+    }
+    if (parasail_result_is_saturated(result)) {
+        printf("%s: short pair saturated\n", name);
+        ++errors;
+    }
+    parasail_result_free(result);
+
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 12;
+    const char **s1s = NULL;
+    const char **s2s = NULL;
+    int *s1Lens = NULL;
+    int *s2Lens = NULL;
+    parasail_sat_stats_t stats;
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    /* similar pairs long enough to saturate 8 bits and, for the longer
+     * ones, 16 bits; the random prefixes move the saturated column */
+    s1s = (const char**)malloc(sizeof(const char*)*count);
+    s2s = (const char**)malloc(sizeof(const char*)*count);
+    s1Lens = (int*)malloc(sizeof(int)*count);
+    s2Lens = (int*)malloc(sizeof(int)*count);
+    for (i=0; i<count; ++i) {
+        int length = i < count/2
+                ? 20 + (int)(next_random(&state) % 400)
+                : 12000 + (int)(next_random(&state) % 4000);
+        int prefix = (int)(next_random(&state) % 50);
+        char *core = random_sequence(&state, alphabet, length);
+        char *head = random_sequence(&state, alphabet, prefix);
+        char *s2 = substitute(&state, alphabet, core, length, 64);
+        char *s1 = (char*)malloc(prefix+length+1);
+        memcpy(s1, head, prefix);
+        memcpy(s1+prefix, core, length+1);
+        s1s[i] = s1;
+        s1Lens[i] = prefix+length;
+        s2s[i] = s2;
+        s2Lens[i] = length;
+        free(head);
+        free(core);
+    }
+
+    parasail_sat_stats_reset();
+    errors += check("parasail_sw_striped_sat", parasail_sw_striped_sat,
+            s1s, s1Lens, s2s, s2Lens, count);
+    parasail_sat_stats_get(&stats);
+    if (stats.bits8 != (unsigned long long)count
+            || 0 == stats.bits16 || 0 == stats.bits32
+            || stats.bits16 < stats.bits32) {
+        printf("parasail_sat_stats: %llu %llu %llu\n",
+                stats.bits8, stats.bits16, stats.bits32);
+        ++errors;
+    }
+    /* the short pairs can be bounded in 16 bits, the long ones only
+     * in 32, so no 8-bit pass should run */
+    parasail_sat_stats_reset();
+    errors += check("parasail_sw_striped_auto", parasail_sw_striped_auto,
+            s1s, s1Lens, s2s, s2Lens, count);
+    parasail_sat_stats_get(&stats);
+    if (stats.bits8 != 0
+            || stats.bits16 != (unsigned long long)count/2
+            || stats.bits32 != (unsigned long long)count/2) {
+        printf("parasail_sat_stats: %llu %llu %llu\n",
+                stats.bits8, stats.bits16, stats.bits32);
+        ++errors;
+    }
+    errors += check("parasail_sw_scan_auto", parasail_sw_scan_auto,
+            s1s, s1Lens, s2s, s2Lens, count);
+    errors += check("parasail_sw_diag_auto", parasail_sw_diag_auto,
+            s1s, s1Lens, s2s, s2Lens, count);
+    {
+        parasail_result_t *result = parasail_sw_striped_auto(
+                "HEAGAWGHEE", 10, "PAWHEAE", 7, 10, 1, &parasail_blosum62);
+        if (!(result->flag & PARASAIL_FLAG_BITS_8)) {
+            printf("parasail_sw_striped_auto: short pair not run in 8 bits\n");
+            ++errors;
+        }
+        parasail_result_free(result);
+    }
+    /* one pass each; the 8-bit nw striped and nw and sg diag kernels
+     * always saturate, so those start at 16 bits */
+    errors += check_passes("parasail_nw_scan_auto", parasail_nw_scan_auto, 1, 0, 0);
+    errors += check_passes("parasail_nw_striped_auto", parasail_nw_striped_auto, 0, 1, 0);
+    errors += check_passes("parasail_nw_diag_auto", parasail_nw_diag_auto, 0, 1, 0);
+    errors += check_passes("parasail_sg_striped_auto", parasail_sg_striped_auto, 1, 0, 0);
+    errors += check_passes("parasail_sg_diag_auto", parasail_sg_diag_auto, 0, 1, 0);
+    errors += check_passes("parasail_sg_qb_de_diag_auto", parasail_sg_qb_de_diag_auto, 0, 1, 0);
+    errors += check_passes("parasail_sw_diag_auto", parasail_sw_diag_auto, 1, 0, 0);
+    errors += check_profile("parasail_sw_striped_profile_auto",
+            parasail_sw_striped_profile_auto, parasail_profile_create_sat,
+            s1s, s1Lens, s2s, s2Lens, count);
+    errors += check_profile("parasail_sw_striped_profile_sat",
+            parasail_sw_striped_profile_sat, parasail_profile_create_sat,
+            s1s, s1Lens, s2s, s2Lens, count);
+    errors += check_profile("parasail_sw_scan_profile_sat",
+            parasail_sw_scan_profile_sat, parasail_profile_create_sat,
+            s1s, s1Lens, s2s, s2Lens, count);
+    errors += check_profile("parasail_sw_stats_striped_profile_sat",
+            parasail_sw_stats_striped_profile_sat, parasail_profile_create_stats_sat,
+            s1s, s1Lens, s2s, s2Lens, count);
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        errors += check("parasail_sw_striped_sse2_128_sat",
+                parasail_sw_striped_sse2_128_sat,
+                s1s, s1Lens, s2s, s2Lens, count);
+    }
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        errors += check("parasail_sw_striped_sse41_128_sat",
+                parasail_sw_striped_sse41_128_sat,
+                s1s, s1Lens, s2s, s2Lens, count);
+    }
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        errors += check("parasail_sw_striped_avx2_256_sat",
+                parasail_sw_striped_avx2_256_sat,
+                s1s, s1Lens, s2s, s2Lens, count);
+    }
+#endif
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        errors += check("parasail_sw_striped_avx512_512_sat",
+                parasail_sw_striped_avx512_512_sat,
+                s1s, s1Lens, s2s, s2Lens, count);
+    }
+#endif
+
+    for (i=0; i<count; ++i) {
+        free((char*)s1s[i]);
+        free((char*)s2s[i]);
+    }
+    free(s2Lens);
+    free(s1Lens);
+    free(s2s);
+    free(s1s);
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+/* the profile functions keep running the striped kernels */
+static int same(
+        const char *name,
+        parasail_result_t *result,
+        parasail_result_t *expected)
+{
+    if (result->score != expected->score
+            || result->end_query != expected->end_query
+            || result->end_ref != expected->end_ref
+            || result->flag != expected->flag) {
+        printf("%s: (%d,%d,%d,%x) != profile (%d,%d,%d,%x)\n", name,
+                result->score, result->end_query, result->end_ref,
+                result->flag, expected->score, expected->end_query,
+                expected->end_ref, expected->flag);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int m = 0;
+    int a = 0;
+    int w = 0;
+    int length = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    /* every query length up to four segments of the widest vectors,
+     * and a few beyond that take the striped functions */
+    const int max_length = 4*64 + 16;
+    const int gaps[][2] = {{10,1}, {3,1}, {11,2}, {5,2}};
+    parasail_matrix_t *acgt = parasail_matrix_create("ACGT", 2, -3);
+    const parasail_matrix_t *matrices[] = {&parasail_blosum62, acgt};
+    const char *alphabets[] = {"ARNDCQEGHILKMFPSTWYV", "ACGT"};
+    const char *alg_names[3] = {"nw", "sg", "sw"};
+    parasail_function_t *references[3] = {parasail_nw, parasail_sg, parasail_sw};
+    /* [alg][width], widths 8, 16, 32, sat */
+    parasail_function_t *functions[3][4] = {
+        {parasail_nw_striped_8, parasail_nw_striped_16, parasail_nw_striped_32, parasail_nw_striped_sat},
+        {parasail_sg_striped_8, parasail_sg_striped_16, parasail_sg_striped_32, parasail_sg_striped_sat},
+        {parasail_sw_striped_8, parasail_sw_striped_16, parasail_sw_striped_32, parasail_sw_striped_sat}};
+    parasail_pfunction_t *pfunctions[3][4] = {
+        {parasail_nw_striped_profile_8, parasail_nw_striped_profile_16, parasail_nw_striped_profile_32, parasail_nw_striped_profile_sat},
+        {parasail_sg_striped_profile_8, parasail_sg_striped_profile_16, parasail_sg_striped_profile_32, parasail_sg_striped_profile_sat},
+        {parasail_sw_striped_profile_8, parasail_sw_striped_profile_16, parasail_sw_striped_profile_32, parasail_sw_striped_profile_sat}};
+    parasail_pcreator_t *pcreators[4] = {
+        parasail_profile_create_8, parasail_profile_create_16,
+        parasail_profile_create_32, parasail_profile_create_sat};
+    const char *widths[4] = {"8", "16", "32", "sat"};
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (m=0; m<(int)(sizeof(matrices)/sizeof(matrices[0])); ++m) {
+        const parasail_matrix_t *matrix = matrices[m];
+        const char *alphabet = alphabets[m];
+        for (length=1; length<=max_length; ++length) {
+            int s2Len = 1 + (int)(next_random(&state) % 300);
+            int open = gaps[length%4][0];
+            int gap = gaps[length%4][1];
+            char *s1 = random_sequence(&state, alphabet, length);
+            char *s2 = NULL;
+            parasail_profile_t *profiles[4];
+
+            /* half the pairs are related so that scores grow */
+            if (length % 2 && s2Len >= length) {
+                char *t = random_sequence(&state, alphabet, s2Len);
+                char *u = substitute(&state, alphabet, s1, length, 10);
+                memcpy(t + (s2Len-length)/2, u, length);
+                free(u);
+                s2 = t;
+            }
+            else {
+                s2 = random_sequence(&state, alphabet, s2Len);
+            }
+
+            for (w=0; w<4; ++w) {
+                profiles[w] = pcreators[w](s1, length, matrix);
+            }
+            for (a=0; a<3; ++a) {
+                parasail_result_t *expected = references[a](s1, length, s2, s2Len,
+                        open, gap, matrix);
+                for (w=0; w<4; ++w) {
+                    char name[64];
+                    parasail_result_t *result = functions[a][w](s1, length, s2, s2Len,
+                            open, gap, matrix);
+                    parasail_result_t *striped = pfunctions[a][w](profiles[w], s2, s2Len,
+                            open, gap);
+                    sprintf(name, "parasail_%s_striped_%s (%s %d)",
+                            alg_names[a], widths[w], matrix->name, length);
+                    errors += same(name, result, striped);
+                    parasail_result_free(striped);
+                    /* narrow widths may saturate, otherwise they are exact */
+                    if (!parasail_result_is_saturated(result)) {
+                        errors += check_result(name, result, expected);
+                    }
+                    else if (w >= 2) {
+                        printf("%s: saturated\n", name);
+                        ++errors;
+                    }
+                    parasail_result_free(result);
+                }
+                parasail_result_free(expected);
+            }
+
+            for (w=0; w<4; ++w) {
+                parasail_profile_free(profiles[w]);
+            }
+            free(s2);
+            free(s1);
+        }
+    }
+
+    parasail_matrix_free(acgt);
+
+    printf("%-40s %s\n", "parasail_*_striped_short_*", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
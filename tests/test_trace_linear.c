@@ -0,0 +1,242 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+static const char alphabet[] = "ARNDCQEGHILKMFPSTWYV";
+
+/* score a CIGAR, leaving end gaps free where the flags allow */
+static int rescore(
+        const parasail_cigar_t *cigar,
+        const char *s1, const char *s2,
+        int open, int gap, const parasail_matrix_t *matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end,
+        int *s1_used, int *s2_used)
+{
+    int score = 0;
+    int i = cigar->beg_query;
+    int j = cigar->beg_ref;
+    int k = 0;
+    for (k=0; k<cigar->len; ++k) {
+        char op = parasail_cigar_decode_op(cigar->seq[k]);
+        int len = (int)parasail_cigar_decode_len(cigar->seq[k]);
+        int first = (0 == k);
+        int last = (cigar->len-1 == k);
+        if ('I' == op) {
+            if (!((first && s1_beg) || (last && s1_end))) {
+                score -= open + (len-1)*gap;
+            }
+            i += len;
+        }
+        else if ('D' == op) {
+            if (!((first && s2_beg) || (last && s2_end))) {
+                score -= open + (len-1)*gap;
+            }
+            j += len;
+        }
+        else {
+            int l = 0;
+            for (l=0; l<len; ++l) {
+                if (('=' == op) != (s1[i] == s2[j])) {
+                    return -1;
+                }
+                score += matrix->matrix[
+                    matrix->mapper[(unsigned char)s1[i]]*matrix->size
+                    + matrix->mapper[(unsigned char)s2[j]]];
+                ++i;
+                ++j;
+            }
+        }
+    }
+    *s1_used = i;
+    *s2_used = j;
+    return score;
+}
+
+/* the traceback strings must spell out the same path as the CIGAR */
+static int check_traceback(
+        parasail_result_t *result, const parasail_cigar_t *cigar,
+        const char *s1, int s1Len, const char *s2, int s2Len,
+        const parasail_matrix_t *matrix)
+{
+    parasail_traceback_t *traceback = parasail_result_get_traceback(
+            result, s1, s1Len, s2, s2Len, matrix, '|', ':', '.');
+    int errors = 0;
+    int i = cigar->beg_query;
+    int j = cigar->beg_ref;
+    size_t k = 0;
+    size_t len = strlen(traceback->comp);
+    if (strlen(traceback->query) != len || strlen(traceback->ref) != len) {
+        ++errors;
+    }
+    for (k=0; k<len && !errors; ++k) {
+        if ('-' != traceback->query[k] && traceback->query[k] != s1[i++]) {
+            ++errors;
+        }
+        if ('-' != traceback->ref[k] && traceback->ref[k] != s2[j++]) {
+            ++errors;
+        }
+        if (('|' == traceback->comp[k]) != (traceback->query[k] == traceback->ref[k])) {
+            ++errors;
+        }
+    }
+    parasail_traceback_free(traceback);
+    return errors;
+}
+
+static int check(
+        const char *name,
+        parasail_result_t *result,
+        parasail_result_t *expected,
+        const char *s1, int s1Len, const char *s2, int s2Len,
+        int open, int gap, const parasail_matrix_t *matrix,
+        int s1_beg, int s1_end, int s2_beg, int s2_end, int local)
+{
+    parasail_cigar_t *cigar = NULL;
+    int s1_used = 0;
+    int s2_used = 0;
+    int score = 0;
+    int errors = 0;
+
+    if (result->score != expected->score
+            || result->end_query != expected->end_query
+            || result->end_ref != expected->end_ref
+            || !parasail_result_is_trace(result)) {
+        printf("%s: (%d,%d,%d) != (%d,%d,%d)\n", name,
+                result->score, result->end_query, result->end_ref,
+                expected->score, expected->end_query, expected->end_ref);
+        return 1;
+    }
+
+    cigar = parasail_result_get_cigar(result, s1, s1Len, s2, s2Len, matrix);
+    score = rescore(cigar, s1, s2, open, gap, matrix,
+            s1_beg, s1_end, s2_beg, s2_end, &s1_used, &s2_used);
+    if (score != result->score) {
+        printf("%s: path scores %d, expected %d\n", name, score, result->score);
+        ++errors;
+    }
+    if (local) {
+        if (result->score > 0
+                && (s1_used != result->end_query+1
+                    || s2_used != result->end_ref+1)) {
+            printf("%s: path ends at (%d,%d)\n", name, s1_used-1, s2_used-1);
+            ++errors;
+        }
+    }
+    else if (cigar->beg_query != 0 || cigar->beg_ref != 0
+            || s1_used != s1Len || s2_used != s2Len) {
+        printf("%s: path covers [%d,%d) x [%d,%d)\n", name,
+                cigar->beg_query, s1_used, cigar->beg_ref, s2_used);
+        ++errors;
+    }
+    if (check_traceback(result, cigar, s1, s1Len, s2, s2Len, matrix)) {
+        printf("%s: traceback disagrees with cigar\n", name);
+        ++errors;
+    }
+    parasail_cigar_free(cigar);
+
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int f = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 24;
+    const int gaps[][2] = {{10,1}, {3,1}, {11,2}};
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (i=0; i<count; ++i) {
+        int length = i < count-2
+                ? 1 + (int)(next_random(&state) % 300)
+                : 4000 + (int)(next_random(&state) % 2000);
+        int s2Len = 0;
+        char *s1 = random_sequence(&state, alphabet, length);
+        char *s2 = mutate(&state, alphabet, s1, length, 2, 30, 0, &s2Len);
+        int open = gaps[i%3][0];
+        int gap = gaps[i%3][1];
+        parasail_result_t *result = NULL;
+        parasail_result_t *expected = NULL;
+
+        if (0 == s2Len) {
+            free(s2);
+            s2 = random_sequence(&state, alphabet, 1);
+            s2Len = 1;
+        }
+
+        result = parasail_nw_trace_linear(s1, length, s2, s2Len, open, gap, &parasail_blosum62);
+        expected = parasail_nw(s1, length, s2, s2Len, open, gap, &parasail_blosum62);
+        errors += check("parasail_nw_trace_linear", result, expected,
+                s1, length, s2, s2Len, open, gap, &parasail_blosum62,
+                0, 0, 0, 0, 0);
+        parasail_result_free(expected);
+        parasail_result_free(result);
+
+        result = parasail_sw_trace_linear(s1, length, s2, s2Len, open, gap, &parasail_blosum62);
+        expected = parasail_sw(s1, length, s2, s2Len, open, gap, &parasail_blosum62);
+        errors += check("parasail_sw_trace_linear", result, expected,
+                s1, length, s2, s2Len, open, gap, &parasail_blosum62,
+                0, 0, 0, 0, 1);
+        parasail_result_free(expected);
+        parasail_result_free(result);
+
+        /* every combination of free end gaps, both orders of the pair */
+        for (f=0; f<16 && length<1000; ++f) {
+            int s1_beg = (f>>0) & 1;
+            int s1_end = (f>>1) & 1;
+            int s2_beg = (f>>2) & 1;
+            int s2_end = (f>>3) & 1;
+            result = parasail_sg_flags_trace_linear(s1, length, s2, s2Len,
+                    open, gap, &parasail_blosum62,
+                    s1_beg, s1_end, s2_beg, s2_end);
+            expected = parasail_sg_flags(s1, length, s2, s2Len,
+                    open, gap, &parasail_blosum62,
+                    s1_beg, s1_end, s2_beg, s2_end);
+            errors += check("parasail_sg_flags_trace_linear", result, expected,
+                    s1, length, s2, s2Len, open, gap, &parasail_blosum62,
+                    s1_beg, s1_end, s2_beg, s2_end, 0);
+            parasail_result_free(expected);
+            parasail_result_free(result);
+            result = parasail_sg_flags_trace_linear(s2, s2Len, s1, length,
+                    open, gap, &parasail_blosum62,
+                    s1_beg, s1_end, s2_beg, s2_end);
+            expected = parasail_sg_flags(s2, s2Len, s1, length,
+                    open, gap, &parasail_blosum62,
+                    s1_beg, s1_end, s2_beg, s2_end);
+            errors += check("parasail_sg_flags_trace_linear", result, expected,
+                    s2, s2Len, s1, length, open, gap, &parasail_blosum62,
+                    s1_beg, s1_end, s2_beg, s2_end, 0);
+            parasail_result_free(expected);
+            parasail_result_free(result);
+        }
+
+        /* the table traceback of the same pair scores the same */
+        result = parasail_sg_trace_linear(s1, length, s2, s2Len, open, gap, &parasail_blosum62);
+        expected = length < 1000
+                ? parasail_sg_trace(s1, length, s2, s2Len, open, gap, &parasail_blosum62)
+                : parasail_sg(s1, length, s2, s2Len, open, gap, &parasail_blosum62);
+        errors += check("parasail_sg_trace_linear", result, expected,
+                s1, length, s2, s2Len, open, gap, &parasail_blosum62,
+                1, 1, 1, 1, 0);
+        parasail_result_free(expected);
+        parasail_result_free(result);
+
+        free(s2);
+        free(s1);
+    }
+
+    printf("%-40s %s\n", "parasail_*_trace_linear", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
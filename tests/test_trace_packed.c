@@ -0,0 +1,165 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+static const char alphabet[] = "ARNDCQEGHILKMFPSTWYV";
+
+/* a packed result must unwind to the same table and give the same
+ * CIGAR as the default layout */
+static int check(
+        const char *name,
+        parasail_pfunction_t *pfunction,
+        parasail_pcreator_t *pcreator,
+        const char *s1, int s1Len,
+        const char *s2, int s2Len,
+        int open, int gap)
+{
+    parasail_profile_t *profile = pcreator(s1, s1Len, &parasail_blosum62);
+    parasail_result_t *expected = NULL;
+    parasail_result_t *result = NULL;
+    parasail_cigar_t *expected_cigar = NULL;
+    parasail_cigar_t *cigar = NULL;
+    char *expected_string = NULL;
+    char *string = NULL;
+    int *expected_table = NULL;
+    int *table = NULL;
+    int errors = 0;
+    int i = 0;
+
+    expected = pfunction(profile, s2, s2Len, open, gap);
+    profile->trace_format = PARASAIL_TRACE_FORMAT_PACKED;
+    result = pfunction(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+
+    if (parasail_result_is_saturated(expected)) {
+        parasail_result_free(expected);
+        parasail_result_free(result);
+        return 0;
+    }
+    if (PARASAIL_TRACE_FORMAT_TABLE != expected->trace->format
+            || PARASAIL_TRACE_FORMAT_PACKED != result->trace->format) {
+        printf("%s: trace formats %d and %d\n", name,
+                expected->trace->format, result->trace->format);
+        parasail_result_free(expected);
+        parasail_result_free(result);
+        return 1;
+    }
+    if (result->score != expected->score
+            || result->end_query != expected->end_query
+            || result->end_ref != expected->end_ref) {
+        printf("%s: (%d,%d,%d) != (%d,%d,%d)\n", name,
+                result->score, result->end_query, result->end_ref,
+                expected->score, expected->end_query, expected->end_ref);
+        ++errors;
+    }
+
+    expected_table = parasail_striped_unwind(s1Len, s2Len, expected,
+            parasail_result_get_trace_table(expected));
+    table = parasail_striped_unwind(s1Len, s2Len, result,
+            parasail_result_get_trace_table(result));
+    for (i=0; i<s1Len*s2Len; ++i) {
+        if (expected_table[i] != table[i]) {
+            printf("%s: cell (%d,%d) %d != %d\n", name,
+                    i/s2Len, i%s2Len, table[i], expected_table[i]);
+            ++errors;
+            break;
+        }
+    }
+    free(table);
+    free(expected_table);
+
+    expected_cigar = parasail_result_get_cigar(expected,
+            s1, s1Len, s2, s2Len, &parasail_blosum62);
+    cigar = parasail_result_get_cigar(result,
+            s1, s1Len, s2, s2Len, &parasail_blosum62);
+    expected_string = parasail_cigar_decode(expected_cigar);
+    string = parasail_cigar_decode(cigar);
+    if (0 != strcmp(expected_string, string)
+            || expected_cigar->beg_query != cigar->beg_query
+            || expected_cigar->beg_ref != cigar->beg_ref) {
+        printf("%s: cigar %s != %s\n", name, string, expected_string);
+        ++errors;
+    }
+    free(string);
+    free(expected_string);
+    parasail_cigar_free(cigar);
+    parasail_cigar_free(expected_cigar);
+
+    parasail_result_free(expected);
+    parasail_result_free(result);
+
+    return errors;
+}
+
+typedef struct {
+    const char *name;
+    parasail_pfunction_t *pfunction;
+    parasail_pcreator_t *pcreator;
+} packed_t;
+
+#define PACKED(ALG, W) \
+    {"parasail_" #ALG "_profile_" #W, \
+        parasail_ ## ALG ## _profile_ ## W, parasail_profile_create_ ## W}
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int f = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 24;
+    const int gaps[][2] = {{10,1}, {3,1}, {11,2}};
+    const packed_t functions[] = {
+        PACKED(nw_trace_striped, 8),
+        PACKED(nw_trace_striped, 16),
+        PACKED(nw_trace_striped, 32),
+        PACKED(nw_trace_striped, 64),
+        PACKED(nw_trace_scan, 16),
+        PACKED(nw_trace_scan, 64),
+        PACKED(sg_trace_striped, 8),
+        PACKED(sg_trace_striped, 16),
+        PACKED(sg_trace_striped, 64),
+        PACKED(sg_trace_scan, 32),
+        PACKED(sw_trace_striped, 8),
+        PACKED(sw_trace_striped, 16),
+        PACKED(sw_trace_striped, 32),
+        PACKED(sw_trace_striped, 64),
+        PACKED(sw_trace_scan, 8),
+        PACKED(sw_trace_scan, 32),
+        {NULL, NULL, NULL}
+    };
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    for (i=0; i<count; ++i) {
+        int length = 1 + (int)(next_random(&state) % 300);
+        int s2Len = 0;
+        char *s1 = random_sequence(&state, alphabet, length);
+        char *s2 = mutate(&state, alphabet, s1, length, 2, 10, 0, &s2Len);
+        int open = gaps[i%3][0];
+        int gap = gaps[i%3][1];
+
+        for (f=0; NULL!=functions[f].name; ++f) {
+            errors += check(functions[f].name,
+                    functions[f].pfunction, functions[f].pcreator,
+                    s1, length, s2, s2Len, open, gap);
+        }
+
+        free(s2);
+        free(s1);
+    }
+
+    printf("%-40s %s\n", "PARASAIL_TRACE_FORMAT_PACKED", errors ? "FAIL" : "PASS");
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
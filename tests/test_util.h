@@ -0,0 +1,125 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Random sequences and result checks shared by the unit tests.  The
+ * generator is a plain LCG so that every platform sees the same
+ * sequences for the same seed.
+ */
+#ifndef _PARASAIL_TEST_UTIL_H_
+#define _PARASAIL_TEST_UTIL_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+
+#define UNUSED(expr) do { (void)(expr); } while (0)
+
+static inline unsigned long next_random(unsigned long *state)
+{
+    *state = *state * 1103515245UL + 12345UL;
+    return (*state / 65536UL) % 32768UL;
+}
+
+static inline char* random_sequence(
+        unsigned long *state, const char *alphabet, int length)
+{
+    int i = 0;
+    int size = (int)strlen(alphabet);
+    char *seq = (char*)malloc(length+1);
+    for (i=0; i<length; ++i) {
+        seq[i] = alphabet[next_random(state) % size];
+    }
+    seq[length] = '\0';
+    return seq;
+}
+
+/* copy of seq where one in rate residues is replaced */
+static inline char* substitute(
+        unsigned long *state, const char *alphabet,
+        const char *seq, int length, int rate)
+{
+    int i = 0;
+    int size = (int)strlen(alphabet);
+    char *copy = (char*)malloc(length+1);
+    for (i=0; i<length; ++i) {
+        if (0 == next_random(state) % rate) {
+            copy[i] = alphabet[next_random(state) % size];
+        }
+        else {
+            copy[i] = seq[i];
+        }
+    }
+    copy[length] = '\0';
+    return copy;
+}
+
+/* copy of seq with 10% substitutions, indel percent deletions and as
+ * many insertions of up to max_indel residues, and tail random residues
+ * appended; never empty */
+static inline char* mutate(
+        unsigned long *state, const char *alphabet,
+        const char *seq, int length,
+        int indel, int max_indel, int tail, int *out)
+{
+    int i = 0;
+    int k = 0;
+    int size = (int)strlen(alphabet);
+    char *copy = (char*)malloc(2*length+tail+64);
+    while (i < length) {
+        unsigned long r = next_random(state) % 100;
+        if (r < (unsigned long)indel) {
+            i += 1 + (int)(next_random(state) % max_indel);
+        }
+        else if (r < (unsigned long)(2*indel)) {
+            int n = 1 + (int)(next_random(state) % max_indel);
+            while (n-- > 0 && k < 2*length+32) {
+                copy[k++] = alphabet[next_random(state) % size];
+            }
+        }
+        else if (r < (unsigned long)(2*indel+10)) {
+            copy[k++] = alphabet[next_random(state) % size];
+            ++i;
+        }
+        else {
+            copy[k++] = seq[i++];
+        }
+    }
+    while (tail-- > 0) {
+        copy[k++] = alphabet[next_random(state) % size];
+    }
+    if (0 == k) {
+        copy[k++] = alphabet[0];
+    }
+    copy[k] = '\0';
+    *out = k;
+    return copy;
+}
+
+/* compares score and end locations, returns 1 and reports a mismatch */
+static inline int check_result(
+        const char *name,
+        parasail_result_t *result,
+        parasail_result_t *expected)
+{
+    if (NULL == result) {
+        printf("%s: no result\n", name);
+        return 1;
+    }
+    if (result->score != expected->score
+            || result->end_query != expected->end_query
+            || result->end_ref != expected->end_ref) {
+        printf("%s: (%d,%d,%d) != (%d,%d,%d)\n", name,
+                result->score, result->end_query, result->end_ref,
+                expected->score, expected->end_query, expected->end_ref);
+        return 1;
+    }
+    return 0;
+}
+
+#endif /* _PARASAIL_TEST_UTIL_H_ */
@@ -478,6 +478,36 @@ int main(int argc, char **argv)
         }
     }
 #endif
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        if (test_scores) {
+            check_functions(parasail_nw_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qb_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qe_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qx_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_db_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_de_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_dx_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qb_de_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qe_db_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sw_rowcol_avx512, sequences, limit, matrix, gap);
+        }
+        if (test_stats) {
+            check_functions(parasail_nw_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qb_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qe_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qx_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_db_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_de_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_dx_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qb_de_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_qe_db_stats_rowcol_avx512, sequences, limit, matrix, gap);
+            check_functions(parasail_sw_stats_rowcol_avx512, sequences, limit, matrix, gap);
+        }
+    }
+#endif
 
 #if HAVE_ALTIVEC
     if (parasail_can_use_altivec()) {
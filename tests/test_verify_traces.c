@@ -235,6 +235,7 @@ int main(int argc, char **argv)
     int do_sse2 = 1;
     int do_sse41 = 1;
     int do_avx2 = 1;
+    int do_avx512 = 1;
     int do_altivec = 1;
     int do_neon = 1;
     int do_disp = 1;
@@ -287,6 +288,7 @@ int main(int argc, char **argv)
                 do_sse2 = (NULL == strstr(optarg, "sse2"));
                 do_sse41 = (NULL == strstr(optarg, "sse41"));
                 do_avx2 = (NULL == strstr(optarg, "avx2"));
+                do_avx512 = (NULL == strstr(optarg, "avx512"));
                 do_altivec = (NULL == strstr(optarg, "altivec"));
                 do_neon = (NULL == strstr(optarg, "neon"));
                 do_disp = (NULL == strstr(optarg, "disp"));
@@ -392,6 +394,23 @@ int main(int argc, char **argv)
         }
     }
 #endif
+#if HAVE_AVX512BW
+    if (do_avx512 && parasail_can_use_avx512bw()) {
+        if (test_scores) {
+            if (do_nw) check_functions(parasail_nw_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_qb_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_qe_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_qx_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_db_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_de_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_dx_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_qb_de_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_qe_db_trace_avx512, sequences, limit, matrix, gap);
+            if (do_sw) check_functions(parasail_sw_trace_avx512, sequences, limit, matrix, gap);
+        }
+    }
+#endif
 
 #if HAVE_ALTIVEC
     if (do_altivec && parasail_can_use_altivec()) {
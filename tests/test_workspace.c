@@ -0,0 +1,112 @@
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+#include "test_util.h"
+
+static const char alphabet[] = "ARNDCQEGHILKMFPSTWYV";
+
+static int same(const parasail_result_t *a, const parasail_result_t *b)
+{
+    return a->score == b->score
+        && a->end_query == b->end_query
+        && a->end_ref == b->end_ref
+        && a->flag == b->flag;
+}
+
+/* compare a workspace function against its allocating counterpart */
+static int check(
+        const char *name,
+        parasail_function_t *function,
+        parasail_ws_function_t *ws_function,
+        parasail_pfunction_t *pfunction,
+        parasail_ws_pfunction_t *ws_pfunction,
+        parasail_pcreator_t *pcreator,
+        const char **seqs, const int *lens, int count)
+{
+    int i = 0;
+    int errors = 0;
+    parasail_workspace_t *workspace = parasail_workspace_create(0);
+    parasail_result_t result;
+
+    /* one workspace is reused for every pair, so it grows and shrinks
+     * through the sequence lengths */
+    for (i=0; i+1<count; ++i) {
+        parasail_result_t *expected = function(
+                seqs[i], lens[i], seqs[i+1], lens[i+1], 10, 1, &parasail_blosum62);
+        parasail_profile_t *profile = pcreator(seqs[i], lens[i], &parasail_blosum62);
+        parasail_result_t *returned = ws_function(
+                seqs[i], lens[i], seqs[i+1], lens[i+1], 10, 1, &parasail_blosum62,
+                workspace, &result);
+        if (returned != &result || !same(expected, &result)) {
+            printf("%s: pair %d score %d != %d\n",
+                    name, i, result.score, expected->score);
+            ++errors;
+        }
+        parasail_result_free(expected);
+        expected = pfunction(profile, seqs[i+1], lens[i+1], 10, 1);
+        ws_pfunction(profile, seqs[i+1], lens[i+1], 10, 1, workspace, &result);
+        if (!same(expected, &result)) {
+            printf("%s: profile pair %d score %d != %d\n",
+                    name, i, result.score, expected->score);
+            ++errors;
+        }
+        parasail_result_free(expected);
+        parasail_profile_free(profile);
+    }
+    parasail_workspace_free(workspace);
+    printf("%-40s %s\n", name, errors ? "FAIL" : "PASS");
+    return errors;
+}
+
+#define CHECK(ALG, W) \
+    errors += check("parasail_" #ALG "_striped_ws_" #W, \
+            parasail_##ALG##_striped_##W, parasail_##ALG##_striped_ws_##W, \
+            parasail_##ALG##_striped_profile_##W, \
+            parasail_##ALG##_striped_profile_ws_##W, \
+            parasail_profile_create_##W, seqs, lens, count)
+
+int main(int argc, char **argv)
+{
+    int i = 0;
+    int errors = 0;
+    unsigned long state = 1;
+    const int count = 40;
+    const char **seqs = NULL;
+    int *lens = NULL;
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    seqs = (const char**)malloc(sizeof(const char*)*count);
+    lens = (int*)malloc(sizeof(int)*count);
+    for (i=0; i<count; ++i) {
+        lens[i] = 1 + (int)(next_random(&state) % 300);
+        seqs[i] = random_sequence(&state, alphabet, lens[i]);
+    }
+
+    CHECK(nw, 64);
+    CHECK(nw, 32);
+    CHECK(nw, 16);
+    CHECK(nw, 8);
+    CHECK(nw, sat);
+    CHECK(sw, 64);
+    CHECK(sw, 32);
+    CHECK(sw, 16);
+    CHECK(sw, 8);
+    CHECK(sw, sat);
+
+    for (i=0; i<count; ++i) {
+        free((char*)seqs[i]);
+    }
+    free(lens);
+    free(seqs);
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -18,6 +18,7 @@ import sys
 from isa import sse2
 from isa import sse41
 from isa import avx2
+from isa import avx512
 from isa import altivec
 from isa import neon
 
@@ -56,6 +57,9 @@ template_filenames = [
 "sw_trace_diag.c",
 "sw_trace_scan.c",
 "sw_trace_striped.c",
+
+"extend_scan.c",
+"extend_striped.c",
 ]
 
 special_templates = [
@@ -71,6 +75,16 @@ bias_templates = [
 "sw_stats_striped_bias.c",
 ]
 
+# score difference templates only exist for 8 bits
+diff_templates = [
+"nw_diag_diff_8.c",
+"sg_diag_diff_8.c",
+]
+
+batch_templates = [
+"sw_batch.c",
+]
+
 
 output_dir = "generated/"
 if not os.path.exists(output_dir):
@@ -130,6 +144,10 @@ def generate_H_and_E(params):
     params["SG_TMP"] = "-open-gap*(segNum*segLen+i)"
     if "sg" in params["NAME"]:
         params["SG_TMP"] = "s1_beg ? 0 : (-open-gap*(segNum*segLen+i))"
+    # extension kernels keep every cell at or above their cut-cell marker
+    params["H_AND_E_MIN"] = "INT%(WIDTH)s_MIN" % params
+    if "extend" in params["NAME"]:
+        params["H_AND_E_MIN"] = "NEG_LIMIT"
     if "striped" in params["NAME"] and "trace" in params["NAME"]:
         if "neon" in params["ISA"]:
             params["E_M_VAR"] = "e"
@@ -147,9 +165,9 @@ def generate_H_and_E(params):
             %(VTYPE)s e;
             for (segNum=0; segNum<segWidth; ++segNum) {
                 int64_t tmp = %(SG_TMP)s;
-                h.i%(WIDTH)s[segNum] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+                h.i%(WIDTH)s[segNum] = tmp < %(H_AND_E_MIN)s ? %(H_AND_E_MIN)s : tmp;
                 tmp = tmp - open;
-                e.i%(WIDTH)s[segNum] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+                e.i%(WIDTH)s[segNum] = tmp < %(H_AND_E_MIN)s ? %(H_AND_E_MIN)s : tmp;
             }
             %(VSTORE)s(&%(PVH_VAR)s[index], h);
             %(VSTORE)s(&pvE[index], e);%(PVEA_STORE)s
@@ -166,9 +184,9 @@ def generate_H_and_E(params):
             %(VTYPE)s_%(WIDTH)s_t e;
             for (segNum=0; segNum<segWidth; ++segNum) {
                 int64_t tmp = %(SG_TMP)s;
-                h.v[segNum] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+                h.v[segNum] = tmp < %(H_AND_E_MIN)s ? %(H_AND_E_MIN)s : tmp;
                 tmp = tmp - open;
-                e.v[segNum] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+                e.v[segNum] = tmp < %(H_AND_E_MIN)s ? %(H_AND_E_MIN)s : tmp;
             }
             %(VSTORE)s(&%(PVH_VAR)s[index], h.m);
             %(VSTORE)s(&pvE[index], e.m);%(PVEA_STORE)s
@@ -411,7 +429,7 @@ def generate_saturation_check(params):
         if "sw" in params["NAME"] and "striped" in params["NAME"]:
             pass
         else:
-            for p in ["VMAX", "VMIN"]:
+            for p in ["VMAX", "VMIN", "VCMPEQ"]:
                 if (params[p].endswith("_rpl")
                         and params[p] not in params["FIXES"]):
                     params["FIXES"] += params[params[p]]
@@ -490,7 +508,7 @@ def generated_params_scan(params):
     params["SCAN_INSERT_MASK"] = "1"+",0"*(params["LANES"]-1)
     params["SCAN_NEG_INF_FRONT"] = "0,"*(params["LANES"]-1)+"NEG_LIMIT"
     params["POSITION_MASK"] = ",".join([str(i) for i in range(params["LANES"])])
-    if "avx" in params["ISA"]:
+    if "avx" == params["ISA"]:
         params["SCAN_AVX2_BLENDV_FIX"] = """
 
 /* clang optimization broke blendv in this code */
@@ -532,8 +550,17 @@ def generated_params(template, params):
         if key.endswith(suffix):
             new_key = key.split('x')[0]
             params[new_key] = params[key]
-    fixes = ""
+    # lazy-F loop exit; ISAs with mask registers compare directly into
+    # a mask rather than building a vector for movemask
     template_params = re.findall(r'%\([A-Za-z0-9]+\)s', template)
+    if "VCMPGTMASK"+suffix in params:
+        params["LAZY_F_TEST"] = "%s(vF, vH)" % params["VCMPGTMASK"+suffix]
+    else:
+        params["LAZY_F_TEST"] = "%s(%s(vF, vH))" % (
+                params["VMOVEMASK"], params["VCMPGT"])
+        if r'%(LAZY_F_TEST)s' in template:
+            template_params.append(r'%(VCMPGT)s')
+    fixes = ""
     for param in params:
         wrapped_param = r'%%(%s)s'%param
         if (wrapped_param in template_params
@@ -545,7 +572,16 @@ def generated_params(template, params):
             and "sg" not in params["NAME"]):
         if params["VEXTRACT"].endswith("_rpl"):
             fixes = params[params["VEXTRACT"]] + fixes
+    # the horizontal max replacements are built on the extract ones
+    if (r'%(VHMAX)s' in template_params
+            and params["VHMAX"].endswith("_rpl")
+            and params["VEXTRACT"].endswith("_rpl")
+            and params[params["VEXTRACT"]] not in fixes):
+        fixes = params[params["VEXTRACT"]] + fixes
     params["FIXES"] = fixes
+    if "batch" in params["NAME"]:
+        # the inter-sequence kernels keep no tables and no striped state
+        return params
     params = generate_printer(params)
     params = generate_saturation_check(params)
     params = generate_H(params)
@@ -556,7 +592,7 @@ def generated_params(template, params):
 for template_filename in template_filenames:
     template = open(template_dir+template_filename).read()
     for width in [64,32,16,8]:
-        for isa in [sse2,sse41,avx2,altivec,neon]:
+        for isa in [sse2,sse41,avx2,avx512,altivec,neon]:
             params = copy.deepcopy(isa)
             params["WIDTH"] = width
             prefix = template_filename[:-2]
@@ -605,6 +641,12 @@ for template_filename in template_filenames:
                     isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
             function_trace_pname = "%s_%s%s_%s_%s" % (trace_prefix_prof,
                     isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_ws_name = "%s_ws_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_ws_pname = "%s_ws_%s%s_%s_%s" % (prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_resume_pname = "%s_resume_%s%s_%s_%s" % (prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
             params["SUFFIX"] = suffix
             params["SUFFIX_PROF"] = suffix_prof
             params["NAME"] = "parasail_"+function_name
@@ -617,7 +659,16 @@ for template_filename in template_filenames:
             params["PNAME_TABLE"] = "parasail_"+function_table_pname
             params["PNAME_ROWCOL"] = "parasail_"+function_rowcol_pname
             params["PNAME_TRACE"] = "parasail_"+function_trace_pname
+            params["NAME_WS"] = "parasail_"+function_ws_name
+            params["PNAME_WS"] = "parasail_"+function_ws_pname
+            params["PNAME_RESUME"] = "parasail_"+function_resume_pname
             params = generated_params(template, params)
+            if "extend" in params["NAME"] and width == 16:
+                # like the 8-bit kernels, saturate instead of wrapping so
+                # that cut cells stay at the bottom of the range
+                params["NEG_INF"] = "INT16_MIN"
+                params["VADD"] = params["VADDSx16"]
+                params["VSUB"] = params["VSUBSx16"]
             if 'flags' in function_name:
                 function_name = string.replace(function_name, '_flags', '')
             output_filename = "%s%s.c" % (output_dir, function_name)
@@ -652,7 +703,7 @@ for template_filename in special_templates:
         rowcol_prefix = "%s_%s_rowcol_%s" % (parts[0], parts[1], parts[2])
         trace_prefix = "%s_%s_%s" % (parts[0], parts[1], parts[2])
         suffix_prefix = parts[2]
-    for isa in [sse2,sse41,avx2,altivec,neon]:
+    for isa in [sse2,sse41,avx2,avx512,altivec,neon]:
         params = copy.deepcopy(isa)
         params["WIDTH"] = width
         suffix = "_%s_%s%s_%s_%s" % (suffix_prefix,
@@ -709,7 +760,7 @@ for template_filename in bias_templates:
     trace_prefix_prof = trace_prefix + "_profile"
     suffix_prefix_prof = suffix_prefix + "_profile"
     for width in [16,8]:
-        for isa in [sse2,sse41,avx2,altivec,neon]:
+        for isa in [sse2,sse41,avx2,avx512,altivec,neon]:
             params = copy.deepcopy(isa)
             params["WIDTH"] = width
             suffix = "_%s_%s%s_%s_%s" % (suffix_prefix,
@@ -732,6 +783,12 @@ for template_filename in bias_templates:
                     isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
             function_trace_pname = "%s_%s%s_%s_%s" % (trace_prefix_prof,
                     isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_ws_name = "%s_ws_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_ws_pname = "%s_ws_%s%s_%s_%s" % (prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_resume_pname = "%s_resume_%s%s_%s_%s" % (prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
             params["SUFFIX"] = suffix
             params["SUFFIX_PROF"] = suffix_prof
             params["NAME"] = "parasail_"+function_name
@@ -744,6 +801,9 @@ for template_filename in bias_templates:
             params["PNAME_TABLE"] = "parasail_"+function_table_pname
             params["PNAME_ROWCOL"] = "parasail_"+function_rowcol_pname
             params["PNAME_TRACE"] = "parasail_"+function_trace_pname
+            params["NAME_WS"] = "parasail_"+function_ws_name
+            params["PNAME_WS"] = "parasail_"+function_ws_pname
+            params["PNAME_RESUME"] = "parasail_"+function_resume_pname
             params = generated_params(template, params)
             params["VADD"] = params["VADDSx%d"%width]
             params["VSUB"] = params["VSUBSx%d"%width]
@@ -754,3 +814,57 @@ for template_filename in bias_templates:
             writer.write("\n")
             writer.close()
 
+# score difference kernels, one per instruction set
+for template_filename in diff_templates:
+    template = open(template_dir+template_filename).read()
+    parts = template_filename[:-2].split('_')
+    width = int(parts[-1])
+    prefix = "_".join(parts[:-1])
+    for isa in [sse2,sse41,avx2,avx512,altivec,neon]:
+        params = copy.deepcopy(isa)
+        params["WIDTH"] = width
+        function_name = "%s_%s%s_%s_%s" % (prefix,
+                isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+        params["NAME"] = "parasail_"+function_name
+        params = generated_params(template, params)
+        output_filename = "%s%s.c" % (output_dir, function_name)
+        writer = open(output_filename, "w")
+        writer.write(template % params)
+        writer.write("\n")
+        writer.close()
+
+# inter-sequence kernels, one database sequence per lane; the 8- and
+# 16-bit kernels saturate at the top of the range and clamp local scores
+# at a bias at the bottom, the 32-bit kernels clamp at zero
+for template_filename in batch_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    for width in [32,16,8]:
+        for isa in [sse2,sse41,avx2,avx512,altivec,neon]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params = generated_params(template, params)
+            if width == 32:
+                params["BATCH_BIAS"] = "0"
+                params["BATCH_DIAG"] = "%s(%s(vHDiag, %s(vProfile + s1Map[i])), vBias)" % (
+                        params["VMAX"], params["VADD"], params["VLOAD"])
+            else:
+                params["BATCH_BIAS"] = "INT%d_MIN" % width
+                params["VADD"] = params["VADDSx%d"%width]
+                params["VSUB"] = params["VSUBSx%d"%width]
+                params["BATCH_DIAG"] = "%s(vHDiag, %s(vProfile + s1Map[i]))" % (
+                        params["VADD"], params["VLOAD"])
+            if "VCMPGTMASKx%d"%width in params:
+                params["BATCH_ROSE"] = "%s(vMaxH, vPrev)" % (
+                        params["VCMPGTMASKx%d"%width])
+            else:
+                params["BATCH_ROSE"] = "%s(%s(vMaxH, vPrev))" % (
+                        params["VMOVEMASK"], params["VCMPGT"])
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            writer = open(output_filename, "w")
+            writer.write(template % params)
+            writer.write("\n")
+            writer.close()
@@ -4,6 +4,9 @@
 
 import os
 
+# algorithms with register-resident striped kernels for short queries
+SHORT_ALGS = ["nw", "sg", "sw"]
+
 def codegen(alg):
     txt = """/**
  * @file
@@ -19,7 +22,11 @@ def codegen(alg):
 
 #include "parasail.h"
 #include "parasail/cpuid.h"
-
+"""
+    if alg in SHORT_ALGS:
+        txt += """#include "parasail/memory.h"
+"""
+    txt += """
 /* forward declare the dispatcher functions */
 """
     for table in ["", "_table", "_rowcol", "_trace"]:
@@ -78,11 +85,20 @@ def codegen(alg):
                     base = alg
                     if par == "scan":
                         base += "_scan"
+                    # plain striped calls pick the register-resident
+                    # kernels for short queries, except 8-bit nw whose
+                    # striped functions always report saturation
+                    short = ""
+                    if (alg in SHORT_ALGS and par == "striped"
+                            and not table and not stats and width != 64
+                            and not (alg == "nw" and width == 8)):
+                        short = "_short"
                     params = {
                             "ALG": alg,
                             "BASE": base,
                             "PREFIX": prefix,
                             "PREFIX2": prefix2,
+                            "SHORT": short,
                             "TABLE": table,
                             "STATS": stats,
                             "PAR": par,
@@ -95,15 +111,21 @@ parasail_result_t* %(PREFIX)s_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s%(SHORT)s_avx512_512_%(WIDTH)s;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+        %(PREFIX)s_pointer = %(PREFIX2)s%(SHORT)s_avx2_256_%(WIDTH)s;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+        %(PREFIX)s_pointer = %(PREFIX2)s%(SHORT)s_sse41_128_%(WIDTH)s;
     }
     else
 #endif
@@ -156,6 +178,12 @@ parasail_result_t* %(PREFIX)s_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512_512_%(WIDTH)s;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
@@ -244,12 +272,735 @@ parasail_result_t* %(PREFIX)s(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+    parasail_profile_materialize(profile, %(WIDTH)s);
     return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap);
 }
 """ % params
 
     return txt
 
+def codegen_ws(alg):
+    txt = """
+/* workspace variants of the striped functions */
+
+/* serial fallback for the workspace functions */
+static parasail_result_t* parasail_%(ALG)s_ws_serial(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_result_t *serial = parasail_%(ALG)s(s1, s1Len, s2, s2Len, open, gap, matrix);
+    (void)workspace;
+    *result = *serial;
+    parasail_result_free(serial);
+    return result;
+}
+
+/* forward declare the dispatcher functions */
+""" % {"ALG": alg}
+    for par in ["striped_ws", "striped_profile_ws"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_%s_%s_%d"%(alg, par, width)
+            if 'profile' in par:
+                txt += "parasail_ws_pfunction_t %s_dispatcher;\n" % prefix
+            else:
+                txt += "parasail_ws_function_t %s_dispatcher;\n" % prefix
+
+    txt += """
+/* declare and initialize the pointer to the dispatcher function */
+"""
+    for par in ["striped_ws", "striped_profile_ws"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_%s_%s_%d"%(alg, par, width)
+            if 'profile' in par:
+                txt += "parasail_ws_pfunction_t * %s_pointer = %s_dispatcher;\n"%(
+                        prefix, prefix)
+            else:
+                txt += "parasail_ws_function_t * %s_pointer = %s_dispatcher;\n"%(
+                        prefix, prefix)
+
+    txt += """
+/* dispatcher function implementations */
+"""
+    for par in ["striped_ws", "striped_profile_ws"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_%s_%s_%d"%(alg, par, width)
+            prefix2 = "parasail_%s_%s"%(alg, par)
+            params = {
+                    "ALG": alg,
+                    "PREFIX": prefix,
+                    "PREFIX2": prefix2,
+                    "WIDTH": width
+            }
+            if 'profile' in par:
+                params["SIGNATURE"] = """
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,"""
+                params["ARGS"] = "profile, s2, s2Len, open, gap"
+                params["FALLBACK"] = "NULL"
+            else:
+                params["SIGNATURE"] = """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,"""
+                params["ARGS"] = "s1, s1Len, s2, s2Len, open, gap, matrix"
+                params["FALLBACK"] = "parasail_%s_ws_serial" % alg
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(%(SIGNATURE)s
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512_512_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse2_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_altivec_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_neon_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(FALLBACK)s;
+    }
+    return %(PREFIX)s_pointer(%(ARGS)s, workspace, result);
+}
+""" % params
+
+    txt += """
+/* implementation which simply calls the pointer,
+ * first time it's the dispatcher, otherwise it's correct impl */
+"""
+    for par in ["striped_ws", "striped_profile_ws"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_%s_%s_%d"%(alg, par, width)
+            params = {"PREFIX": prefix, "MATERIALIZE": ""}
+            if 'profile' in par:
+                params["SIGNATURE"] = """
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,"""
+                params["ARGS"] = "profile, s2, s2Len, open, gap"
+                params["MATERIALIZE"] = """
+    parasail_profile_materialize(profile, %d);""" % width
+            else:
+                params["SIGNATURE"] = """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,"""
+                params["ARGS"] = "s1, s1Len, s2, s2Len, open, gap, matrix"
+            txt += """
+parasail_result_t* %(PREFIX)s(%(SIGNATURE)s
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{%(MATERIALIZE)s
+    return %(PREFIX)s_pointer(%(ARGS)s, workspace, result);
+}
+""" % params
+
+    return txt
+
+def codegen_extend():
+    txt = """/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+
+/* forward declare the dispatcher functions */
+"""
+    for par in ["scan", "striped", "scan_profile", "striped_profile"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_extend_%s_%d"%(par, width)
+            if 'profile' in par:
+                txt += "parasail_extend_pfunction_t %s_dispatcher;\n" % prefix
+            else:
+                txt += "parasail_extend_function_t %s_dispatcher;\n" % prefix
+
+    txt += """
+/* declare and initialize the pointer to the dispatcher function */
+"""
+    for par in ["scan", "striped", "scan_profile", "striped_profile"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_extend_%s_%d"%(par, width)
+            if 'profile' in par:
+                txt += "parasail_extend_pfunction_t * %s_pointer = %s_dispatcher;\n"%(
+                        prefix, prefix)
+            else:
+                txt += "parasail_extend_function_t * %s_pointer = %s_dispatcher;\n"%(
+                        prefix, prefix)
+
+    txt += """
+/* dispatcher function implementations */
+"""
+    for par in ["scan", "striped", "scan_profile", "striped_profile"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_extend_%s_%d"%(par, width)
+            prefix2 = "parasail_extend_%s"%(par)
+            params = {
+                    "PREFIX": prefix,
+                    "PREFIX2": prefix2,
+                    "WIDTH": width
+            }
+            if 'profile' in par:
+                params["SIGNATURE"] = """
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,"""
+                params["ARGS"] = "profile, s2, s2Len, open, gap"
+                params["FALLBACK"] = "NULL"
+            else:
+                params["SIGNATURE"] = """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,"""
+                params["ARGS"] = "s1, s1Len, s2, s2Len, open, gap, matrix"
+                params["FALLBACK"] = "parasail_extend"
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(%(SIGNATURE)s
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512_512_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse2_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_altivec_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_neon_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(FALLBACK)s;
+    }
+    return %(PREFIX)s_pointer(%(ARGS)s, xdrop, zdrop, extension);
+}
+""" % params
+
+    txt += """
+/* implementation which simply calls the pointer,
+ * first time it's the dispatcher, otherwise it's correct impl */
+"""
+    for par in ["scan", "striped", "scan_profile", "striped_profile"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_extend_%s_%d"%(par, width)
+            params = {"PREFIX": prefix, "MATERIALIZE": ""}
+            if 'profile' in par:
+                params["SIGNATURE"] = """
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,"""
+                params["ARGS"] = "profile, s2, s2Len, open, gap"
+                params["MATERIALIZE"] = """
+    parasail_profile_materialize(profile, %d);""" % width
+            else:
+                params["SIGNATURE"] = """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,"""
+                params["ARGS"] = "s1, s1Len, s2, s2Len, open, gap, matrix"
+            txt += """
+parasail_result_t* %(PREFIX)s(%(SIGNATURE)s
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{%(MATERIALIZE)s
+    return %(PREFIX)s_pointer(%(ARGS)s, xdrop, zdrop, extension);
+}
+""" % params
+
+    return txt
+
+def codegen_diff(alg):
+    params = {"PREFIX": "parasail_%s_diag_diff_8" % alg,
+            "PREFIX2": "parasail_%s_diag_diff" % alg,
+            "ALG": alg}
+    txt = """
+/* 8-bit score difference variant of the diag functions */
+
+/* forward declare the dispatcher function */
+parasail_function_t %(PREFIX)s_dispatcher;
+
+/* declare and initialize the pointer to the dispatcher function */
+parasail_function_t * %(PREFIX)s_pointer = %(PREFIX)s_dispatcher;
+
+/* dispatcher function implementation */
+
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_neon_128_8;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = parasail_%(ALG)s;
+    }
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+/* implementation which simply calls the pointer,
+ * first time it's the dispatcher, otherwise it's correct impl */
+
+parasail_result_t* %(PREFIX)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+""" % params
+
+    return txt
+
+def codegen_batch():
+    txt = """/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+
+/* forward declare the dispatcher functions */
+"""
+    for width in [32, 16, 8]:
+        txt += "parasail_batch_function_t parasail_sw_batch_%d_dispatcher;\n" % width
+
+    txt += """
+/* declare and initialize the pointer to the dispatcher function */
+"""
+    for width in [32, 16, 8]:
+        prefix = "parasail_sw_batch_%d" % width
+        txt += "parasail_batch_function_t * %s_pointer = %s_dispatcher;\n" % (
+                prefix, prefix)
+
+    txt += """
+/* serial fallback when no inter-sequence kernel is available */
+static void parasail_sw_batch_serial(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    int i = 0;
+    for (i=0; i<count; ++i) {
+        results[i] = parasail_sw(s1, s1Len, s2s[i], s2Lens[i], open, gap, matrix);
+    }
+}
+
+/* dispatcher function implementations */
+"""
+    for width in [32, 16, 8]:
+        params = {"PREFIX": "parasail_sw_batch_%d" % width,
+                "PREFIX2": "parasail_sw_batch",
+                "WIDTH": width}
+        txt += """
+void %(PREFIX)s_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512_512_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse2_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_altivec_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_neon_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = parasail_sw_batch_serial;
+    }
+    %(PREFIX)s_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+}
+""" % params
+
+    txt += """
+/* implement the wrapper functions */
+"""
+    for width in [32, 16, 8]:
+        params = {"PREFIX": "parasail_sw_batch_%d" % width}
+        txt += """
+void %(PREFIX)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    %(PREFIX)s_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+}
+""" % params
+
+    txt += """
+/* Run the whole batch at 8 bits, then only the saturated database
+ * sequences again at 16 bits, and any still saturated at 32 bits.  A
+ * result is only replaced once its retry produced one.  Without memory
+ * to gather the saturated sequences, each is retried on its own. */
+void parasail_sw_batch_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    parasail_batch_function_t * const retry[2] = {
+        parasail_sw_batch_16, parasail_sw_batch_32};
+    int i = 0;
+    int j = 0;
+    int k = 0;
+    int w = 0;
+    int sat_count = 0;
+    int *sat_index = NULL;
+    const char **sat_s2s = NULL;
+    int *sat_s2Lens = NULL;
+    parasail_result_t **sat_results = NULL;
+
+    parasail_sw_batch_8(s1, s1Len, s2s, s2Lens, count, open, gap, matrix, results);
+
+    for (i=0; i<count; ++i) {
+        if (NULL != results[i] && parasail_result_is_saturated(results[i])) {
+            ++sat_count;
+        }
+    }
+    if (0 == sat_count) {
+        return;
+    }
+
+    sat_index = (int*)malloc(sizeof(int)*sat_count);
+    sat_s2s = (const char**)malloc(sizeof(const char*)*sat_count);
+    sat_s2Lens = (int*)malloc(sizeof(int)*sat_count);
+    sat_results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*sat_count);
+    if (NULL == sat_index || NULL == sat_s2s
+            || NULL == sat_s2Lens || NULL == sat_results) {
+        free(sat_results);
+        free(sat_s2Lens);
+        free(sat_s2s);
+        free(sat_index);
+        for (i=0; i<count; ++i) {
+            for (w=0; w<2; ++w) {
+                parasail_result_t *result = NULL;
+                if (NULL == results[i]
+                        || !parasail_result_is_saturated(results[i])) {
+                    break;
+                }
+                retry[w](s1, s1Len, s2s+i, s2Lens+i, 1,
+                        open, gap, matrix, &result);
+                if (NULL != result) {
+                    parasail_result_free(results[i]);
+                    results[i] = result;
+                }
+            }
+        }
+        return;
+    }
+
+    for (i=0,k=0; i<count; ++i) {
+        if (NULL != results[i] && parasail_result_is_saturated(results[i])) {
+            sat_index[k] = i;
+            sat_s2s[k] = s2s[i];
+            sat_s2Lens[k] = s2Lens[i];
+            ++k;
+        }
+    }
+
+    for (w=0; w<2 && sat_count>0; ++w) {
+        retry[w](s1, s1Len, sat_s2s, sat_s2Lens, sat_count,
+                open, gap, matrix, sat_results);
+        /* keep only the sequences that are still saturated */
+        for (k=0,j=0; k<sat_count; ++k) {
+            i = sat_index[k];
+            if (NULL != sat_results[k]) {
+                parasail_result_free(results[i]);
+                results[i] = sat_results[k];
+            }
+            if (parasail_result_is_saturated(results[i])) {
+                sat_index[j] = i;
+                sat_s2s[j] = s2s[i];
+                sat_s2Lens[j] = s2Lens[i];
+                ++j;
+            }
+        }
+        sat_count = j;
+    }
+
+    free(sat_results);
+    free(sat_s2Lens);
+    free(sat_s2s);
+    free(sat_index);
+}"""
+
+    return txt
+
+# kernel families that take their algorithm as flags: the name, the
+# kernel typedef arguments, and the kernel used without a vector ISA
+KERNELS = [
+    ("banded", """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive""",
+        "s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, flags, adaptive",
+        "parasail_banded_novec_32"),
+    ("dna", """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags""",
+        "s1, s1Len, s2, s2Len, open, gap, matrix, flags",
+        "parasail_dna_striped_%(WIDTH)s"),
+    ("hybrid", """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags""",
+        "s1, s1Len, s2, s2Len, open, gap, matrix, flags",
+        "parasail_hybrid_scan_%(WIDTH)s"),
+]
+
+def codegen_kernels():
+    txt = """/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/memory.h"
+
+/* forward declare the dispatcher functions */
+"""
+    for family, signature, args, fallback in KERNELS:
+        for width in [8, 16, 32]:
+            txt += "parasail_%s_kernel_t parasail_%s_%d_dispatcher;\n" % (
+                    family, family, width)
+
+    txt += """
+/* declare and initialize the pointer to the dispatcher function */
+"""
+    for family, signature, args, fallback in KERNELS:
+        for width in [8, 16, 32]:
+            prefix = "parasail_%s_%d" % (family, width)
+            txt += "parasail_%s_kernel_t * %s_pointer = %s_dispatcher;\n" % (
+                    family, prefix, prefix)
+
+    txt += """
+/* dispatcher function implementations */
+"""
+    for family, signature, args, fallback in KERNELS:
+        for width in [8, 16, 32]:
+            params = {
+                    "PREFIX": "parasail_%s_%d" % (family, width),
+                    "PREFIX2": "parasail_%s" % family,
+                    "WIDTH": width,
+                    "SIGNATURE": signature,
+                    "ARGS": args,
+                    "FALLBACK": fallback % {"WIDTH": width}
+            }
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(%(SIGNATURE)s)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512_512_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(FALLBACK)s;
+    }
+    return %(PREFIX)s_pointer(%(ARGS)s);
+}
+""" % params
+
+    txt += """
+/* implementation which simply calls the pointer,
+ * first time it's the dispatcher, otherwise it's correct impl */
+"""
+    for family, signature, args, fallback in KERNELS:
+        for width in [8, 16, 32]:
+            params = {
+                    "PREFIX": "parasail_%s_%d" % (family, width),
+                    "SIGNATURE": signature,
+                    "ARGS": args
+            }
+            txt += """
+parasail_result_t* %(PREFIX)s(%(SIGNATURE)s)
+{
+    return %(PREFIX)s_pointer(%(ARGS)s);
+}
+""" % params
+
+    return txt
+
 output_dir = "generated/"
 if not os.path.exists(output_dir):
     os.makedirs(output_dir)
@@ -258,5 +1009,26 @@ for alg in ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_d
     output_filename = "%s%s_dispatch.c" % (output_dir, alg)
     writer = open(output_filename, "w")
     writer.write(codegen(alg))
+    if alg in ["nw", "sw"]:
+        writer.write(codegen_ws(alg))
+    if alg in ["nw", "sg"]:
+        writer.write(codegen_diff(alg))
     writer.write("\n")
     writer.close()
+
+output_filename = "%sextend_dispatch.c" % output_dir
+writer = open(output_filename, "w")
+writer.write(codegen_extend())
+writer.write("\n")
+writer.close()
+
+output_filename = "%skernel_dispatch.c" % output_dir
+writer = open(output_filename, "w")
+writer.write(codegen_kernels())
+writer.write("\n")
+writer.close()
+
+output_filename = "%ssw_batch_dispatch.c" % output_dir
+writer = open(output_filename, "w")
+writer.write(codegen_batch())
+writer.close()
@@ -45,10 +45,20 @@ isa_to_bits = {
     "sse2"    : 128,
     "sse41"   : 128,
     "avx2"    : 256,
+    "avx512"  : 512,
     "altivec" : 128,
     "neon"    : 128,
 }
 
+isa_to_guard = {
+    "sse2"    : "HAVE_SSE2",
+    "sse41"   : "HAVE_SSE41",
+    "avx2"    : "HAVE_AVX2",
+    "avx512"  : "HAVE_AVX512BW",
+    "altivec" : "HAVE_ALTIVEC",
+    "neon"    : "HAVE_NEON",
+}
+
 for table in [""]:
     for stats in ["", "_stats"]:
         for alg in ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]:
@@ -59,8 +69,8 @@ for table in [""]:
             if stats:
                 is_stats = 1
             pre = "parasail_"+alg+stats+table
-            for isa in ["sse2", "sse41", "avx2", "altivec", "neon"]:
-                print "#if HAVE_%s" % isa.upper()
+            for isa in ["sse2", "sse41", "avx2", "avx512", "altivec", "neon"]:
+                print "#if %s" % isa_to_guard[isa]
                 print "static parasail_function_info_t %s_%s_functions[] = {" % (pre, isa)
                 print_fmt(pre,         pre,         alg+stats, "orig", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 1)
                 print_fmt(pre+"_scan", pre+"_scan", alg+stats, "scan", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 0)
@@ -67,10 +67,20 @@ isa_to_bits = {
     "sse2"    : 128,
     "sse41"   : 128,
     "avx2"    : 256,
+    "avx512"  : 512,
     "altivec" : 128,
     "neon"    : 128,
 }
 
+isa_to_guard = {
+    "sse2"    : "HAVE_SSE2",
+    "sse41"   : "HAVE_SSE41",
+    "avx2"    : "HAVE_AVX2",
+    "avx512"  : "HAVE_AVX512BW",
+    "altivec" : "HAVE_ALTIVEC",
+    "neon"    : "HAVE_NEON",
+}
+
 print "static const parasail_function_info_t functions[] = {"
 
 for table in ["", "_table", "_rowcol", "_trace"]:
@@ -92,8 +102,13 @@ for table in ["", "_table", "_rowcol", "_trace"]:
             pre = "parasail_"+alg+stats+table
             print_fmt(pre,         pre,         alg+stats, "orig", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 1)
             print_fmt(pre+"_scan", pre+"_scan", alg+stats, "scan", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 0)
-            for isa in ["sse2", "sse41", "avx2", "altivec", "neon"]:
-                print "#if HAVE_%s" % isa.upper()
+            if is_trace:
+                print_fmt(pre+"_linear", pre+"_linear", alg+stats, "linear", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 0)
+            # bit-parallel unit-cost functions only exist for nw and sg
+            if alg in ["nw", "sg"] and not stats and not table:
+                print_fmt(pre+"_bitpar", pre+"_bitpar", alg+stats, "bitpar", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 0)
+            for isa in ["sse2", "sse41", "avx2", "avx512", "altivec", "neon"]:
+                print "#if %s" % isa_to_guard[isa]
                 bits = isa_to_bits[isa]
                 for par in ["scan", "striped", "diag"]:
                     for width in [64, 32, 16, 8, "sat"]:
@@ -112,12 +127,39 @@ for table in ["", "_table", "_rowcol", "_trace"]:
                     for width in [32, 16]:
                         name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
                         print_fmt(name, name, alg+stats, par, isa, bits, width, bits/width, is_table, is_rowcol, is_trace, is_stats, 0)
+                # 8-bit score difference functions only exist for nw and sg
+                if alg in ["nw", "sg"] and not stats and not table:
+                    for width in [8, "sat"]:
+                        name = "%s_diag_diff_%s_%s_%s" % (pre, isa, bits, width)
+                        print_fmt(name, name, alg+stats, "diag", isa, bits, width, bits/8, is_table, is_rowcol, is_trace, is_stats, 0)
                 print "#endif"
             # also print the dispatcher function
             for par in ["scan", "striped", "diag"]:
                 for width in [64, 32, 16, 8, "sat"]:
                     name = "%s_%s_%s" % (pre, par, width)
                     print_fmt(name, name, alg+stats, par, "disp", "NA", width, -1, is_table, is_rowcol, is_trace, is_stats, 0)
+                # width chosen from a score bound, plain classes only
+                if not stats and not table:
+                    name = "%s_%s_auto" % (pre, par)
+                    print_fmt(name, name, alg+stats, par, "disp", "NA", "auto", -1, is_table, is_rowcol, is_trace, is_stats, 0)
+                # profile-free striped functions only exist for nw, sg and sw
+                if (par == "striped" and alg in ["nw", "sg", "sw"]
+                        and not stats and not table):
+                    for width in [32, 16, 8, "sat"]:
+                        name = "%s_%s_dna_%s" % (pre, par, width)
+                        print_fmt(name, name, alg+stats, par, "disp", "NA", width, -1, is_table, is_rowcol, is_trace, is_stats, 0)
+                # hybrid striped and scan functions only exist for nw, sg and sw
+                if (par == "striped" and alg in ["nw", "sg", "sw"]
+                        and not stats and not table):
+                    for width in [32, 16, 8, "sat"]:
+                        name = "%s_hybrid_%s" % (pre, width)
+                        print_fmt(name, name, alg+stats, "hybrid", "disp", "NA", width, -1, is_table, is_rowcol, is_trace, is_stats, 0)
+                # 8-bit score difference functions only exist for nw and sg
+                if (par == "diag" and alg in ["nw", "sg"]
+                        and not stats and not table):
+                    for width in [8, "sat"]:
+                        name = "%s_%s_diff_%s" % (pre, par, width)
+                        print_fmt(name, name, alg+stats, par, "disp", "NA", width, -1, is_table, is_rowcol, is_trace, is_stats, 0)
 
 print_null()
 print "};"
@@ -142,8 +184,8 @@ for table in ["", "_table", "_rowcol", "_trace"]:
             if stats:
                 is_stats = 1
             pre = "parasail_"+alg+stats+table
-            for isa in ["sse2", "sse41", "avx2", "altivec", "neon"]:
-                print "#if HAVE_%s" % isa.upper()
+            for isa in ["sse2", "sse41", "avx2", "avx512", "altivec", "neon"]:
+                print "#if %s" % isa_to_guard[isa]
                 bits = isa_to_bits[isa]
                 for par in ["scan_profile", "striped_profile"]:
                     for width in [64, 32, 16, 8, "sat"]:
@@ -157,6 +199,8 @@ for table in ["", "_table", "_rowcol", "_trace"]:
                             creator = "parasail_profile_create%s_%s_%s_%s" % (stats, isa, bits, width)
                         elif 'neon' in isa:
                             creator = "parasail_profile_create%s_%s_%s_%s" % (stats, isa, bits, width)
+                        elif 'avx512' in isa:
+                            creator = "parasail_profile_create%s_%s_%s_%s" % (stats, isa, bits, width)
                         else:
                             creator = "parasail_profile_create%s_%s_%s_%s" % (stats, isa[:3], bits, width)
                         print_pfmt(name, creator, name, alg+stats, par, isa, bits, width, elem, is_table, is_rowcol, is_trace, is_stats, 0)
@@ -167,6 +211,10 @@ for table in ["", "_table", "_rowcol", "_trace"]:
                     name = "%s_%s_%s" % (pre, par, width)
                     creator = "parasail_profile_create%s_%s" % (stats, width)
                     print_pfmt(name, creator, name, alg+stats, par, "disp", "NA", width, -1, is_table, is_rowcol, is_trace, is_stats, 0)
+                if not stats and not table:
+                    name = "%s_%s_auto" % (pre, par)
+                    creator = "parasail_profile_create_sat"
+                    print_pfmt(name, creator, name, alg+stats, par, "disp", "NA", "auto", -1, is_table, is_rowcol, is_trace, is_stats, 0)
 
 print_pnull()
 print "};"
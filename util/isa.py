@@ -25,6 +25,7 @@ sse2 = {
     "VADDx64"     : "_mm_add_epi64",
     "VADDSx8"     : "_mm_adds_epi8",
     "VADDSx16"    : "_mm_adds_epi16",
+    "VADDUSx8"    : "_mm_adds_epu8",
     "VBLEND"      : "_mm_blendv_epi8_rpl",
     "VCMPEQx8"    : "_mm_cmpeq_epi8",
     "VCMPEQx16"   : "_mm_cmpeq_epi16",
@@ -47,6 +48,7 @@ sse2 = {
     "VINSERTx32"  : "_mm_insert_epi32_rpl",
     "VINSERTx64"  : "_mm_insert_epi64_rpl",
     "VLOAD"       : "_mm_load_si128",
+    "VLOADU"      : "_mm_loadu_si128",
     "VHMAXx8"     : "_mm_hmax_epi8_rpl",
     "VHMAXx16"    : "_mm_hmax_epi16_rpl",
     "VHMAXx32"    : "_mm_hmax_epi32_rpl",
@@ -55,6 +57,7 @@ sse2 = {
     "VMAXx16"     : "_mm_max_epi16",
     "VMAXx32"     : "_mm_max_epi32_rpl",
     "VMAXx64"     : "_mm_max_epi64_rpl",
+    "VMAXUx8"     : "_mm_max_epu8",
     "VMINx8"      : "_mm_min_epi8_rpl",
     "VMINx16"     : "_mm_min_epi16",
     "VMINx32"     : "_mm_min_epi32_rpl",
@@ -79,19 +82,36 @@ sse2 = {
     "VSETx64"     : "_mm_set_epi64x_rpl",
     "VRSHIFT"     : "_mm_srli_si128",
     "VSHIFT"      : "_mm_slli_si128",
+    "VSHUFFLEx8"  : "_mm_shuffle_epi8_rpl",
     "VSTORE"      : "_mm_store_si128",
+    "VSTOREU"     : "_mm_storeu_si128",
     "VSUBx8"      : "_mm_sub_epi8",
     "VSUBx16"     : "_mm_sub_epi16",
     "VSUBx32"     : "_mm_sub_epi32",
     "VSUBx64"     : "_mm_sub_epi64",
     "VSUBSx8"     : "_mm_subs_epi8",
     "VSUBSx16"    : "_mm_subs_epi16",
+    "VSUBUSx8"    : "_mm_subs_epu8",
     "_mm_blendv_epi8_rpl" : """
 static inline __m128i _mm_blendv_epi8_rpl(__m128i a, __m128i b, __m128i mask) {
     a = _mm_andnot_si128(mask, a);
     a = _mm_or_si128(a, _mm_and_si128(mask, b));
     return a;
 }
+""",
+    "_mm_shuffle_epi8_rpl" : """
+static inline __m128i _mm_shuffle_epi8_rpl(__m128i a, __m128i b) {
+    __m128i_8_t A;
+    __m128i_8_t B;
+    __m128i_8_t R;
+    int i;
+    A.m = a;
+    B.m = b;
+    for (i=0; i<16; ++i) {
+        R.v[i] = (B.v[i] & 0x80) ? 0 : A.v[B.v[i] & 0x0F];
+    }
+    return R.m;
+}
 """,
     "_mm_cmpeq_epi64_rpl" : """
 static inline __m128i _mm_cmpeq_epi64_rpl(__m128i a, __m128i b) {
@@ -297,6 +317,7 @@ sse41 = {
     "VADDx64"     : "_mm_add_epi64",
     "VADDSx8"     : "_mm_adds_epi8",
     "VADDSx16"    : "_mm_adds_epi16",
+    "VADDUSx8"    : "_mm_adds_epu8",
     "VBLEND"      : "_mm_blendv_epi8",
     "VCMPEQx8"    : "_mm_cmpeq_epi8",
     "VCMPEQx16"   : "_mm_cmpeq_epi16",
@@ -319,6 +340,7 @@ sse41 = {
     "VINSERTx32"  : "_mm_insert_epi32",
     "VINSERTx64"  : "_mm_insert_epi64_rpl",
     "VLOAD"       : "_mm_load_si128",
+    "VLOADU"      : "_mm_loadu_si128",
     "VHMAXx8"     : "_mm_hmax_epi8_rpl",
     "VHMAXx16"    : "_mm_hmax_epi16_rpl",
     "VHMAXx32"    : "_mm_hmax_epi32_rpl",
@@ -327,6 +349,7 @@ sse41 = {
     "VMAXx16"     : "_mm_max_epi16",
     "VMAXx32"     : "_mm_max_epi32",
     "VMAXx64"     : "_mm_max_epi64_rpl",
+    "VMAXUx8"     : "_mm_max_epu8",
     "VMINx8"      : "_mm_min_epi8",
     "VMINx16"     : "_mm_min_epi16",
     "VMINx32"     : "_mm_min_epi32",
@@ -351,13 +374,16 @@ sse41 = {
     "VSETx64"     : "_mm_set_epi64x_rpl",
     "VRSHIFT"     : "_mm_srli_si128",
     "VSHIFT"      : "_mm_slli_si128",
+    "VSHUFFLEx8"  : "_mm_shuffle_epi8",
     "VSTORE"      : "_mm_store_si128",
+    "VSTOREU"     : "_mm_storeu_si128",
     "VSUBx8"      : "_mm_sub_epi8",
     "VSUBx16"     : "_mm_sub_epi16",
     "VSUBx32"     : "_mm_sub_epi32",
     "VSUBx64"     : "_mm_sub_epi64",
     "VSUBSx8"     : "_mm_subs_epi8",
     "VSUBSx16"    : "_mm_subs_epi16",
+    "VSUBUSx8"    : "_mm_subs_epu8",
     "_mm_cmpgt_epi64_rpl" : """
 static inline __m128i _mm_cmpgt_epi64_rpl(__m128i a, __m128i b) {
     __m128i_64_t A;
@@ -497,6 +523,7 @@ avx2 = {
     "VADDx64"     : "_mm256_add_epi64",
     "VADDSx8"     : "_mm256_adds_epi8",
     "VADDSx16"    : "_mm256_adds_epi16",
+    "VADDUSx8"    : "_mm256_adds_epu8",
     "VBLEND"      : "_mm256_blendv_epi8",
     "VCMPEQx8"    : "_mm256_cmpeq_epi8",
     "VCMPEQx16"   : "_mm256_cmpeq_epi16",
@@ -519,6 +546,7 @@ avx2 = {
     "VINSERTx32"  : "_mm256_insert_epi32_rpl",
     "VINSERTx64"  : "_mm256_insert_epi64_rpl",
     "VLOAD"       : "_mm256_load_si256",
+    "VLOADU"      : "_mm256_loadu_si256",
     "VHMAXx8"     : "_mm256_hmax_epi8_rpl",
     "VHMAXx16"    : "_mm256_hmax_epi16_rpl",
     "VHMAXx32"    : "_mm256_hmax_epi32_rpl",
@@ -527,6 +555,7 @@ avx2 = {
     "VMAXx16"     : "_mm256_max_epi16",
     "VMAXx32"     : "_mm256_max_epi32",
     "VMAXx64"     : "_mm256_max_epi64_rpl",
+    "VMAXUx8"     : "_mm256_max_epu8",
     "VMINx8"      : "_mm256_min_epi8",
     "VMINx16"     : "_mm256_min_epi16",
     "VMINx32"     : "_mm256_min_epi32",
@@ -551,13 +580,16 @@ avx2 = {
     "VSETx64"     : "_mm256_set_epi64x_rpl",
     "VRSHIFT"     : "_mm256_srli_si256_rpl",
     "VSHIFT"      : "_mm256_slli_si256_rpl",
+    "VSHUFFLEx8"  : "_mm256_shuffle_epi8",
     "VSTORE"      : "_mm256_store_si256",
+    "VSTOREU"     : "_mm256_storeu_si256",
     "VSUBx8"      : "_mm256_sub_epi8",
     "VSUBx16"     : "_mm256_sub_epi16",
     "VSUBx32"     : "_mm256_sub_epi32",
     "VSUBx64"     : "_mm256_sub_epi64",
     "VSUBSx8"     : "_mm256_subs_epi8",
     "VSUBSx16"    : "_mm256_subs_epi16",
+    "VSUBUSx8"    : "_mm256_subs_epu8",
     "_mm256_cmplt_epi8_rpl" : """
 #define _mm256_cmplt_epi8_rpl(a,b) _mm256_cmpgt_epi8(b,a)
 """,
@@ -783,6 +815,208 @@ static inline __m256i _mm256_set_epi64x_rpl(int64_t e3, int64_t e2, int64_t e1,
 }
 
 
+avx512 = {
+    "ISA"         : "avx512",
+    "ISA_VERSION" : "",
+    "HEADER"      : "#include <immintrin.h>",
+    "BITS"        : 512,
+    "VTYPE"       : "__m512i",
+    "VADDx8"      : "_mm512_add_epi8",
+    "VADDx16"     : "_mm512_add_epi16",
+    "VADDx32"     : "_mm512_add_epi32",
+    "VADDx64"     : "_mm512_add_epi64",
+    "VADDSx8"     : "_mm512_adds_epi8",
+    "VADDSx16"    : "_mm512_adds_epi16",
+    "VADDUSx8"    : "_mm512_adds_epu8",
+    "VBLEND"      : "_mm512_blendv_epi8_rpl",
+    "VCMPEQx8"    : "_mm512_cmpeq_epi8_rpl",
+    "VCMPEQx16"   : "_mm512_cmpeq_epi16_rpl",
+    "VCMPEQx32"   : "_mm512_cmpeq_epi32_rpl",
+    "VCMPEQx64"   : "_mm512_cmpeq_epi64_rpl",
+    "VCMPGTx8"    : "_mm512_cmpgt_epi8_rpl",
+    "VCMPGTx16"   : "_mm512_cmpgt_epi16_rpl",
+    "VCMPGTx32"   : "_mm512_cmpgt_epi32_rpl",
+    "VCMPGTx64"   : "_mm512_cmpgt_epi64_rpl",
+    "VCMPGTMASKx8"  : "_mm512_cmpgt_epi8_mask",
+    "VCMPGTMASKx16" : "_mm512_cmpgt_epi16_mask",
+    "VCMPGTMASKx32" : "_mm512_cmpgt_epi32_mask",
+    "VCMPGTMASKx64" : "_mm512_cmpgt_epi64_mask",
+    "VCMPLTx8"    : "_mm512_cmplt_epi8_rpl",
+    "VCMPLTx16"   : "_mm512_cmplt_epi16_rpl",
+    "VCMPLTx32"   : "_mm512_cmplt_epi32_rpl",
+    "VCMPLTx64"   : "_mm512_cmplt_epi64_rpl",
+    "VEXTRACTx8"  : "_mm512_extract_epi8_rpl",
+    "VEXTRACTx16" : "_mm512_extract_epi16_rpl",
+    "VEXTRACTx32" : "_mm512_extract_epi32_rpl",
+    "VEXTRACTx64" : "_mm512_extract_epi64_rpl",
+    "VINSERTx8"   : "_mm512_insert_epi8_rpl",
+    "VINSERTx16"  : "_mm512_insert_epi16_rpl",
+    "VINSERTx32"  : "_mm512_insert_epi32_rpl",
+    "VINSERTx64"  : "_mm512_insert_epi64_rpl",
+    "VLOAD"       : "_mm512_load_si512",
+    "VLOADU"      : "_mm512_loadu_si512",
+    "VHMAXx8"     : "_mm512_hmax_epi8_rpl",
+    "VHMAXx16"    : "_mm512_hmax_epi16_rpl",
+    "VHMAXx32"    : "_mm512_reduce_max_epi32",
+    "VHMAXx64"    : "_mm512_reduce_max_epi64",
+    "VMAXx8"      : "_mm512_max_epi8",
+    "VMAXx16"     : "_mm512_max_epi16",
+    "VMAXx32"     : "_mm512_max_epi32",
+    "VMAXx64"     : "_mm512_max_epi64",
+    "VMAXUx8"     : "_mm512_max_epu8",
+    "VMINx8"      : "_mm512_min_epi8",
+    "VMINx16"     : "_mm512_min_epi16",
+    "VMINx32"     : "_mm512_min_epi32",
+    "VMINx64"     : "_mm512_min_epi64",
+    "VMOVEMASK"   : "_mm512_movepi8_mask",
+    "VPACKS"      : "_mm512_packs_epi16_rpl",
+    "VUNPACKLO"   : "_mm512_unpacklo_epi8_rpl",
+    "VUNPACKHI"   : "_mm512_unpackhi_epi8_rpl",
+    "VAND"        : "_mm512_and_si512",
+    "VANDNOT"     : "_mm512_andnot_si512",
+    "VOR"         : "_mm512_or_si512",
+    "VXOR"        : "_mm512_xor_si512",
+    "VROTATE"     : "_mm512_rlli_si512_rpl",
+    "VSET0"       : "_mm512_setzero_si512",
+    "VSET1x8"     : "_mm512_set1_epi8",
+    "VSET1x16"    : "_mm512_set1_epi16",
+    "VSET1x32"    : "_mm512_set1_epi32",
+    "VSET1x64"    : "_mm512_set1_epi64",
+    "VSETx8"      : "_mm512_set_epi8",
+    "VSETx16"     : "_mm512_set_epi16",
+    "VSETx32"     : "_mm512_set_epi32",
+    "VSETx64"     : "_mm512_set_epi64",
+    "VRSHIFT"     : "_mm512_srli_si512_rpl",
+    "VSHIFT"      : "_mm512_slli_si512_rpl",
+    "VSHUFFLEx8"  : "_mm512_shuffle_epi8",
+    "VSTORE"      : "_mm512_store_si512",
+    "VSTOREU"     : "_mm512_storeu_si512",
+    "VSUBx8"      : "_mm512_sub_epi8",
+    "VSUBx16"     : "_mm512_sub_epi16",
+    "VSUBx32"     : "_mm512_sub_epi32",
+    "VSUBx64"     : "_mm512_sub_epi64",
+    "VSUBSx8"     : "_mm512_subs_epi8",
+    "VSUBSx16"    : "_mm512_subs_epi16",
+    "VSUBUSx8"    : "_mm512_subs_epu8",
+    "_mm512_blendv_epi8_rpl" : """
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+""",
+    "_mm512_cmpeq_epi8_rpl" : """
+#define _mm512_cmpeq_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a,b))
+""",
+    "_mm512_cmpeq_epi16_rpl" : """
+#define _mm512_cmpeq_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(a,b))
+""",
+    "_mm512_cmpeq_epi32_rpl" : """
+#define _mm512_cmpeq_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmpeq_epi32_mask(a,b), _mm512_set1_epi32(-1))
+""",
+    "_mm512_cmpeq_epi64_rpl" : """
+#define _mm512_cmpeq_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmpeq_epi64_mask(a,b), _mm512_set1_epi64(-1))
+""",
+    "_mm512_cmpgt_epi8_rpl" : """
+#define _mm512_cmpgt_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(a,b))
+""",
+    "_mm512_cmpgt_epi16_rpl" : """
+#define _mm512_cmpgt_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(a,b))
+""",
+    "_mm512_cmpgt_epi32_rpl" : """
+#define _mm512_cmpgt_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmpgt_epi32_mask(a,b), _mm512_set1_epi32(-1))
+""",
+    "_mm512_cmpgt_epi64_rpl" : """
+#define _mm512_cmpgt_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmpgt_epi64_mask(a,b), _mm512_set1_epi64(-1))
+""",
+    "_mm512_cmplt_epi8_rpl" : """
+#define _mm512_cmplt_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmplt_epi8_mask(a,b))
+""",
+    "_mm512_cmplt_epi16_rpl" : """
+#define _mm512_cmplt_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmplt_epi16_mask(a,b))
+""",
+    "_mm512_cmplt_epi32_rpl" : """
+#define _mm512_cmplt_epi32_rpl(a,b) _mm512_maskz_mov_epi32(_mm512_cmplt_epi32_mask(a,b), _mm512_set1_epi32(-1))
+""",
+    "_mm512_cmplt_epi64_rpl" : """
+#define _mm512_cmplt_epi64_rpl(a,b) _mm512_maskz_mov_epi64(_mm512_cmplt_epi64_mask(a,b), _mm512_set1_epi64(-1))
+""",
+    "_mm512_hmax_epi8_rpl" : """
+static inline int8_t _mm512_hmax_epi8_rpl(__m512i a) {
+    __m256i b = _mm256_max_epi8(_mm512_castsi512_si256(a), _mm512_extracti64x4_epi64(a, 1));
+    __m128i c = _mm_max_epi8(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 8));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 4));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 2));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 1));
+    return (int8_t)_mm_extract_epi8(c, 0);
+}
+""",
+    "_mm512_hmax_epi16_rpl" : """
+static inline int16_t _mm512_hmax_epi16_rpl(__m512i a) {
+    __m256i b = _mm256_max_epi16(_mm512_castsi512_si256(a), _mm512_extracti64x4_epi64(a, 1));
+    __m128i c = _mm_max_epi16(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1));
+    c = _mm_max_epi16(c, _mm_srli_si128(c, 8));
+    c = _mm_max_epi16(c, _mm_srli_si128(c, 4));
+    c = _mm_max_epi16(c, _mm_srli_si128(c, 2));
+    return (int16_t)_mm_extract_epi16(c, 0);
+}
+""",
+    "_mm512_packs_epi16_rpl" : """
+static inline __m512i _mm512_packs_epi16_rpl(__m512i a, __m512i b) {
+    return _mm512_permutexvar_epi64(
+            _mm512_set_epi64(7,5,3,1,6,4,2,0),
+            _mm512_packs_epi16(a, b));
+}
+""",
+    "_mm512_unpacklo_epi8_rpl" : """
+static inline __m512i _mm512_unpacklo_epi8_rpl(__m512i a, __m512i b) {
+    __m512i idx = _mm512_set_epi64(3,3,2,2,1,1,0,0);
+    __m512i an = _mm512_permutexvar_epi64(idx, a);
+    __m512i bn = _mm512_permutexvar_epi64(idx, b);
+    return _mm512_unpacklo_epi8(an, bn);
+}
+""",
+    "_mm512_unpackhi_epi8_rpl" : """
+static inline __m512i _mm512_unpackhi_epi8_rpl(__m512i a, __m512i b) {
+    __m512i idx = _mm512_set_epi64(7,7,6,6,5,5,4,4);
+    __m512i an = _mm512_permutexvar_epi64(idx, a);
+    __m512i bn = _mm512_permutexvar_epi64(idx, b);
+    return _mm512_unpackhi_epi8(an, bn);
+}
+""",
+    "_mm512_srli_si512_rpl" : """
+#define _mm512_srli_si512_rpl(a,imm) _mm512_alignr_epi8(_mm512_maskz_shuffle_i32x4(0x0FFF, a, a, _MM_SHUFFLE(3,3,2,1)), a, imm)
+""",
+    "_mm512_slli_si512_rpl" : """
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i32x4(0xFFF0, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+""",
+    "_mm512_rlli_si512_rpl" : """
+#define _mm512_rlli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_shuffle_i32x4(a, a, _MM_SHUFFLE(2,1,0,3)), 16-imm)
+""",
+    "_mm512_insert_epi64_rpl" : """
+#define _mm512_insert_epi64_rpl(a,i,imm) _mm512_mask_set1_epi64(a, (__mmask8)1<<(imm), i)
+""",
+    "_mm512_insert_epi32_rpl" : """
+#define _mm512_insert_epi32_rpl(a,i,imm) _mm512_mask_set1_epi32(a, (__mmask16)1<<(imm), i)
+""",
+    "_mm512_insert_epi16_rpl" : """
+#define _mm512_insert_epi16_rpl(a,i,imm) _mm512_mask_set1_epi16(a, (__mmask32)1<<(imm), i)
+""",
+    "_mm512_insert_epi8_rpl" : """
+#define _mm512_insert_epi8_rpl(a,i,imm) _mm512_mask_set1_epi8(a, (__mmask64)1<<(imm), i)
+""",
+    "_mm512_extract_epi64_rpl" : """
+#define _mm512_extract_epi64_rpl(a,imm) _mm_extract_epi64(_mm512_extracti32x4_epi32(a, (imm)>>1), (imm)&1)
+""",
+    "_mm512_extract_epi32_rpl" : """
+#define _mm512_extract_epi32_rpl(a,imm) _mm_extract_epi32(_mm512_extracti32x4_epi32(a, (imm)>>2), (imm)&3)
+""",
+    "_mm512_extract_epi16_rpl" : """
+#define _mm512_extract_epi16_rpl(a,imm) (int16_t)_mm_extract_epi16(_mm512_extracti32x4_epi32(a, (imm)>>3), (imm)&7)
+""",
+    "_mm512_extract_epi8_rpl" : """
+#define _mm512_extract_epi8_rpl(a,imm) (int8_t)_mm_extract_epi8(_mm512_extracti32x4_epi32(a, (imm)>>4), (imm)&15)
+""",
+}
+
+
 altivec = {
     "ISA"         : "altivec",
     "ISA_VERSION" : "",
@@ -795,6 +1029,7 @@ altivec = {
     "VADDx64"     : "_mm_add_epi64",
     "VADDSx8"     : "_mm_adds_epi8",
     "VADDSx16"    : "_mm_adds_epi16",
+    "VADDUSx8"    : "_mm_adds_epu8",
     "VBLEND"      : "_mm_blendv_epi8",
     "VCMPEQx8"    : "_mm_cmpeq_epi8",
     "VCMPEQx16"   : "_mm_cmpeq_epi16",
@@ -817,6 +1052,7 @@ altivec = {
     "VINSERTx32"  : "_mm_insert_epi32",
     "VINSERTx64"  : "_mm_insert_epi64",
     "VLOAD"       : "_mm_load_si128",
+    "VLOADU"      : "_mm_loadu_si128",
     "VHMAXx8"     : "_mm_hmax_epi8",
     "VHMAXx16"    : "_mm_hmax_epi16",
     "VHMAXx32"    : "_mm_hmax_epi32",
@@ -825,6 +1061,7 @@ altivec = {
     "VMAXx16"     : "_mm_max_epi16",
     "VMAXx32"     : "_mm_max_epi32",
     "VMAXx64"     : "_mm_max_epi64",
+    "VMAXUx8"     : "_mm_max_epu8",
     "VMINx8"      : "_mm_min_epi8",
     "VMINx16"     : "_mm_min_epi16",
     "VMINx32"     : "_mm_min_epi32",
@@ -849,13 +1086,16 @@ altivec = {
     "VSETx64"     : "_mm_set_epi64",
     "VRSHIFT"     : "_mm_srli_si128",
     "VSHIFT"      : "_mm_slli_si128",
+    "VSHUFFLEx8"  : "_mm_shuffle_epi8",
     "VSTORE"      : "_mm_store_si128",
+    "VSTOREU"     : "_mm_storeu_si128",
     "VSUBx8"      : "_mm_sub_epi8",
     "VSUBx16"     : "_mm_sub_epi16",
     "VSUBx32"     : "_mm_sub_epi32",
     "VSUBx64"     : "_mm_sub_epi64",
     "VSUBSx8"     : "_mm_subs_epi8",
     "VSUBSx16"    : "_mm_subs_epi16",
+    "VSUBUSx8"    : "_mm_subs_epu8",
 }
 
 
@@ -871,6 +1111,7 @@ neon = {
     "VADDx64"     : "simde_mm_add_epi64",
     "VADDSx8"     : "simde_mm_adds_epi8",
     "VADDSx16"    : "simde_mm_adds_epi16",
+    "VADDUSx8"    : "simde_mm_adds_epu8",
     "VBLEND"      : "simde_mm_blendv_epi8",
     "VCMPEQx8"    : "simde_mm_cmpeq_epi8",
     "VCMPEQx16"   : "simde_mm_cmpeq_epi16",
@@ -893,6 +1134,7 @@ neon = {
     "VINSERTx32"  : "simde_mm_insert_epi32",
     "VINSERTx64"  : "simde_mm_insert_epi64",
     "VLOAD"       : "simde_mm_load_si128",
+    "VLOADU"      : "simde_mm_loadu_si128",
     "VHMAXx8"     : "simde_mm_hmax_epi8",
     "VHMAXx16"    : "simde_mm_hmax_epi16",
     "VHMAXx32"    : "simde_mm_hmax_epi32",
@@ -901,6 +1143,7 @@ neon = {
     "VMAXx16"     : "simde_mm_max_epi16",
     "VMAXx32"     : "simde_mm_max_epi32",
     "VMAXx64"     : "simde_mm_max_epi64",
+    "VMAXUx8"     : "simde_mm_max_epu8",
     "VMINx8"      : "simde_mm_min_epi8",
     "VMINx16"     : "simde_mm_min_epi16",
     "VMINx32"     : "simde_mm_min_epi32",
@@ -925,13 +1168,16 @@ neon = {
     "VSETx64"     : "simde_mm_set_epi64x",
     "VRSHIFT"     : "simde_mm_srli_si128",
     "VSHIFT"      : "simde_mm_slli_si128",
+    "VSHUFFLEx8"  : "simde_mm_shuffle_epi8",
     "VSTORE"      : "simde_mm_store_si128",
+    "VSTOREU"     : "simde_mm_storeu_si128",
     "VSUBx8"      : "simde_mm_sub_epi8",
     "VSUBx16"     : "simde_mm_sub_epi16",
     "VSUBx32"     : "simde_mm_sub_epi32",
     "VSUBx64"     : "simde_mm_sub_epi64",
     "VSUBSx8"     : "simde_mm_subs_epi8",
     "VSUBSx16"    : "simde_mm_subs_epi16",
+    "VSUBUSx8"    : "simde_mm_subs_epu8",
 }
 
 
@@ -939,6 +1185,7 @@ isa = {
         "sse2"     : sse2,
         "sse41"    : sse41,
         "avx2"     : avx2,
+        "avx512"   : avx512,
         "altivec"  : altivec,
         "neon"     : neon,
 }
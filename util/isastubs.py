@@ -46,6 +46,9 @@ def isa_to_guard(isa):
     elif 'avx2' in isa:
         print "#if HAVE_AVX2"
         print '#else'
+    elif 'avx512' in isa:
+        print "#if HAVE_AVX512BW"
+        print '#else'
     elif 'altivec' in isa:
         print "#if HAVE_ALTIVEC"
         print '#else'
@@ -92,6 +95,23 @@ def body3():
 }
 #endif"""
 
+def body4():
+    print """{
+    int i = 0;
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    for (i=0; i<count; ++i) {
+        results[i] = NULL;
+    }
+    errno = ENOSYS;
+}
+#endif"""
+
 # vectorized implementations
 alg = ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]
 stats = ["", "_stats"]
@@ -101,6 +121,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -129,6 +150,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -174,6 +196,7 @@ stats = ["", "_stats"]
 isa = [
     "_sse_128_64", "_sse_128_32", "_sse_128_16", "_sse_128_8", "_sse_128_sat",
     "_avx_256_64", "_avx_256_32", "_avx_256_16", "_avx_256_8", "_avx_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
     ]
@@ -187,4 +210,173 @@ for s in stats:
         print " "*8+"const parasail_matrix_t* matrix)"
         body3()
 
+# inter-sequence batch implementations (1x18 = 18 impl)
+isa = [
+    "_sse2_128_32", "_sse2_128_16", "_sse2_128_8",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8",
+    "_avx512_512_32", "_avx512_512_16", "_avx512_512_8",
+    "_altivec_128_32", "_altivec_128_16", "_altivec_128_8",
+    "_neon_128_32", "_neon_128_16", "_neon_128_8",
+    ]
+for i in isa:
+    print ""
+    isa_to_guard(i)
+    print "extern"
+    print "void parasail_sw_batch"+i+'('
+    print " "*8+"const char * const restrict s1, const int s1Len,"
+    print " "*8+"const char * const * const restrict s2s,"
+    print " "*8+"const int * const restrict s2Lens, const int count,"
+    print " "*8+"const int open, const int gap,"
+    print " "*8+"const parasail_matrix_t* matrix,"
+    print " "*8+"parasail_result_t ** const restrict results)"
+    body4()
+
+def body5():
+    print """{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body6():
+    print """{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+# vectorized workspace implementations (2x30 = 60 impl)
+alg = ["nw", "sw"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
+    "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for a in alg:
+    for i in isa:
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t* parasail_"+a+"_striped_ws"+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix,"
+        print " "*8+"parasail_workspace_t * const restrict workspace,"
+        print " "*8+"parasail_result_t * const restrict result)"
+        body5()
+
+# vectorized workspace profile implementations (2x30 = 60 impl)
+for a in alg:
+    for i in isa:
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t* parasail_"+a+"_striped_profile_ws"+i+'('
+        print " "*8+"const parasail_profile_t * const restrict profile,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"parasail_workspace_t * const restrict workspace,"
+        print " "*8+"parasail_result_t * const restrict result)"
+        body6()
+
+def body7():
+    print """{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    UNUSED(xdrop);
+    UNUSED(zdrop);
+    UNUSED(extension);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body8():
+    print """{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(xdrop);
+    UNUSED(zdrop);
+    UNUSED(extension);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+# vectorized seed extension implementations (2x30 = 60 impl)
+for p in ["_scan", "_striped"]:
+    for i in isa:
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t* parasail_extend"+p+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix,"
+        print " "*8+"const int xdrop, const int zdrop,"
+        print " "*8+"parasail_extension_t * const restrict extension)"
+        body7()
+
+# vectorized seed extension profile implementations (2x30 = 60 impl)
+for p in ["_scan_profile", "_striped_profile"]:
+    for i in isa:
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t* parasail_extend"+p+i+'('
+        print " "*8+"const parasail_profile_t * const restrict profile,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const int xdrop, const int zdrop,"
+        print " "*8+"parasail_extension_t * const restrict extension)"
+        body8()
+
+# vectorized 8-bit score difference implementations (2x12 = 24 impl)
+for a in ["nw", "sg"]:
+    for i in ["_sse2_128_8", "_sse2_128_sat",
+            "_sse41_128_8", "_sse41_128_sat",
+            "_avx2_256_8", "_avx2_256_sat",
+            "_avx512_512_8", "_avx512_512_sat",
+            "_altivec_128_8", "_altivec_128_sat",
+            "_neon_128_8", "_neon_128_sat"]:
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t* parasail_"+a+"_diag_diff"+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix)"
+        body1()
+
 print # for newline at end of file
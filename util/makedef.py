@@ -4,6 +4,7 @@ print """LIBRARY parasail
 EXPORTS
 ; from parasail.h
     parasail_profile_free
+    parasail_profile_materialize
     parasail_version
     parasail_result_free
     parasail_lookup_function
@@ -21,6 +22,184 @@ EXPORTS
     parasail_matrix_copy
     parasail_matrix_set_value
     parasail_nw_banded
+    parasail_nw_banded_8
+    parasail_nw_banded_16
+    parasail_nw_banded_32
+    parasail_nw_banded_sat
+    parasail_sg_banded_8
+    parasail_sg_banded_16
+    parasail_sg_banded_32
+    parasail_sg_banded_sat
+    parasail_sw_banded_8
+    parasail_sw_banded_16
+    parasail_sw_banded_32
+    parasail_sw_banded_sat
+    parasail_nw_stats_banded_8
+    parasail_nw_stats_banded_16
+    parasail_nw_stats_banded_32
+    parasail_nw_stats_banded_sat
+    parasail_sg_stats_banded_8
+    parasail_sg_stats_banded_16
+    parasail_sg_stats_banded_32
+    parasail_sg_stats_banded_sat
+    parasail_sw_stats_banded_8
+    parasail_sw_stats_banded_16
+    parasail_sw_stats_banded_32
+    parasail_sw_stats_banded_sat
+    parasail_nw_trace_banded_8
+    parasail_nw_trace_banded_16
+    parasail_nw_trace_banded_32
+    parasail_nw_trace_banded_sat
+    parasail_sg_trace_banded_8
+    parasail_sg_trace_banded_16
+    parasail_sg_trace_banded_32
+    parasail_sg_trace_banded_sat
+    parasail_sw_trace_banded_8
+    parasail_sw_trace_banded_16
+    parasail_sw_trace_banded_32
+    parasail_sw_trace_banded_sat
+    parasail_nw_banded_adaptive_8
+    parasail_nw_banded_adaptive_16
+    parasail_nw_banded_adaptive_32
+    parasail_nw_banded_adaptive_sat
+    parasail_sg_banded_adaptive_8
+    parasail_sg_banded_adaptive_16
+    parasail_sg_banded_adaptive_32
+    parasail_sg_banded_adaptive_sat
+    parasail_sw_banded_adaptive_8
+    parasail_sw_banded_adaptive_16
+    parasail_sw_banded_adaptive_32
+    parasail_sw_banded_adaptive_sat
+    parasail_nw_stats_banded_adaptive_8
+    parasail_nw_stats_banded_adaptive_16
+    parasail_nw_stats_banded_adaptive_32
+    parasail_nw_stats_banded_adaptive_sat
+    parasail_sg_stats_banded_adaptive_8
+    parasail_sg_stats_banded_adaptive_16
+    parasail_sg_stats_banded_adaptive_32
+    parasail_sg_stats_banded_adaptive_sat
+    parasail_sw_stats_banded_adaptive_8
+    parasail_sw_stats_banded_adaptive_16
+    parasail_sw_stats_banded_adaptive_32
+    parasail_sw_stats_banded_adaptive_sat
+    parasail_nw_trace_banded_adaptive_8
+    parasail_nw_trace_banded_adaptive_16
+    parasail_nw_trace_banded_adaptive_32
+    parasail_nw_trace_banded_adaptive_sat
+    parasail_sg_trace_banded_adaptive_8
+    parasail_sg_trace_banded_adaptive_16
+    parasail_sg_trace_banded_adaptive_32
+    parasail_sg_trace_banded_adaptive_sat
+    parasail_sw_trace_banded_adaptive_8
+    parasail_sw_trace_banded_adaptive_16
+    parasail_sw_trace_banded_adaptive_32
+    parasail_sw_trace_banded_adaptive_sat
+    parasail_encode
+    parasail_encoded_free
+    parasail_encoded_decode
+    parasail_nw_banded_encoded_8
+    parasail_nw_banded_encoded_16
+    parasail_nw_banded_encoded_32
+    parasail_nw_banded_encoded_sat
+    parasail_sg_banded_encoded_8
+    parasail_sg_banded_encoded_16
+    parasail_sg_banded_encoded_32
+    parasail_sg_banded_encoded_sat
+    parasail_sw_banded_encoded_8
+    parasail_sw_banded_encoded_16
+    parasail_sw_banded_encoded_32
+    parasail_sw_banded_encoded_sat
+    parasail_nw_stats_banded_encoded_8
+    parasail_nw_stats_banded_encoded_16
+    parasail_nw_stats_banded_encoded_32
+    parasail_nw_stats_banded_encoded_sat
+    parasail_sg_stats_banded_encoded_8
+    parasail_sg_stats_banded_encoded_16
+    parasail_sg_stats_banded_encoded_32
+    parasail_sg_stats_banded_encoded_sat
+    parasail_sw_stats_banded_encoded_8
+    parasail_sw_stats_banded_encoded_16
+    parasail_sw_stats_banded_encoded_32
+    parasail_sw_stats_banded_encoded_sat
+    parasail_nw_trace_banded_encoded_8
+    parasail_nw_trace_banded_encoded_16
+    parasail_nw_trace_banded_encoded_32
+    parasail_nw_trace_banded_encoded_sat
+    parasail_sg_trace_banded_encoded_8
+    parasail_sg_trace_banded_encoded_16
+    parasail_sg_trace_banded_encoded_32
+    parasail_sg_trace_banded_encoded_sat
+    parasail_sw_trace_banded_encoded_8
+    parasail_sw_trace_banded_encoded_16
+    parasail_sw_trace_banded_encoded_32
+    parasail_sw_trace_banded_encoded_sat
+    parasail_nw_banded_adaptive_encoded_8
+    parasail_nw_banded_adaptive_encoded_16
+    parasail_nw_banded_adaptive_encoded_32
+    parasail_nw_banded_adaptive_encoded_sat
+    parasail_sg_banded_adaptive_encoded_8
+    parasail_sg_banded_adaptive_encoded_16
+    parasail_sg_banded_adaptive_encoded_32
+    parasail_sg_banded_adaptive_encoded_sat
+    parasail_sw_banded_adaptive_encoded_8
+    parasail_sw_banded_adaptive_encoded_16
+    parasail_sw_banded_adaptive_encoded_32
+    parasail_sw_banded_adaptive_encoded_sat
+    parasail_nw_stats_banded_adaptive_encoded_8
+    parasail_nw_stats_banded_adaptive_encoded_16
+    parasail_nw_stats_banded_adaptive_encoded_32
+    parasail_nw_stats_banded_adaptive_encoded_sat
+    parasail_sg_stats_banded_adaptive_encoded_8
+    parasail_sg_stats_banded_adaptive_encoded_16
+    parasail_sg_stats_banded_adaptive_encoded_32
+    parasail_sg_stats_banded_adaptive_encoded_sat
+    parasail_sw_stats_banded_adaptive_encoded_8
+    parasail_sw_stats_banded_adaptive_encoded_16
+    parasail_sw_stats_banded_adaptive_encoded_32
+    parasail_sw_stats_banded_adaptive_encoded_sat
+    parasail_nw_trace_banded_adaptive_encoded_8
+    parasail_nw_trace_banded_adaptive_encoded_16
+    parasail_nw_trace_banded_adaptive_encoded_32
+    parasail_nw_trace_banded_adaptive_encoded_sat
+    parasail_sg_trace_banded_adaptive_encoded_8
+    parasail_sg_trace_banded_adaptive_encoded_16
+    parasail_sg_trace_banded_adaptive_encoded_32
+    parasail_sg_trace_banded_adaptive_encoded_sat
+    parasail_sw_trace_banded_adaptive_encoded_8
+    parasail_sw_trace_banded_adaptive_encoded_16
+    parasail_sw_trace_banded_adaptive_encoded_32
+    parasail_sw_trace_banded_adaptive_encoded_sat
+    parasail_nw_striped_dna_8
+    parasail_nw_striped_dna_16
+    parasail_nw_striped_dna_32
+    parasail_nw_striped_dna_sat
+    parasail_sg_striped_dna_8
+    parasail_sg_striped_dna_16
+    parasail_sg_striped_dna_32
+    parasail_sg_striped_dna_sat
+    parasail_sw_striped_dna_8
+    parasail_sw_striped_dna_16
+    parasail_sw_striped_dna_32
+    parasail_sw_striped_dna_sat
+    parasail_nw_hybrid_8
+    parasail_nw_hybrid_16
+    parasail_nw_hybrid_32
+    parasail_nw_hybrid_sat
+    parasail_sg_hybrid_8
+    parasail_sg_hybrid_16
+    parasail_sg_hybrid_32
+    parasail_sg_hybrid_sat
+    parasail_sw_hybrid_8
+    parasail_sw_hybrid_16
+    parasail_sw_hybrid_32
+    parasail_sw_hybrid_sat
+    parasail_nw_bitpar
+    parasail_sg_bitpar
+    parasail_workspace_create
+    parasail_workspace_grow
+    parasail_workspace_free
+    parasail_sat_stats_get
+    parasail_sat_stats_reset
     parasail_traceback_generic
     parasail_traceback_generic_extra
     parasail_traceback_generic_extra2
@@ -31,6 +210,8 @@ EXPORTS
     parasail_cigar_decode
     parasail_result_get_cigar
     parasail_result_get_cigar_extra
+    parasail_result_get_cigar_window
+    parasail_result_get_cigar_window_extra
     parasail_cigar_free
     parasail_result_get_traceback
     parasail_result_get_traceback_extra
@@ -57,6 +238,9 @@ EXPORTS
     parasail_result_get_score
     parasail_result_get_end_query
     parasail_result_get_end_ref
+    parasail_result_get_begin_query
+    parasail_result_get_begin_ref
+    parasail_result_find_begin
     parasail_result_get_matches
     parasail_result_get_similar
     parasail_result_get_length
@@ -122,6 +306,14 @@ EXPORTS
     parasail_memset_int16_t
     parasail_memset_int32_t
     parasail_memset_int64_t
+    parasail_sat_state_save_int8_t
+    parasail_sat_state_load_int8_t
+    parasail_sat_state_save_int16_t
+    parasail_sat_state_load_int16_t
+    parasail_sat_state_save_int32_t
+    parasail_sat_state_load_int32_t
+    parasail_sat_state_save_int64_t
+    parasail_sat_state_load_int64_t
     parasail_result_new
     parasail_result_new_stats
     parasail_result_new_table1
@@ -129,6 +321,7 @@ EXPORTS
     parasail_result_new_rowcol1
     parasail_result_new_rowcol3
     parasail_result_new_trace
+    parasail_result_new_trace_path
     parasail_profile_new
     parasail_reverse
     parasail_reverse_uint32_t
@@ -155,6 +348,11 @@ for a in alg:
             if 'stats' in s and 'trace' in t: continue
             print "    parasail_"+a+s+t+"_scan"
 
+# linear-memory traceback implementations
+alg = ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]
+for a in alg:
+    print "    parasail_"+a+"_trace_linear"
+
 # vectorized implementations
 alg = ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]
 stats = ["", "_stats"]
@@ -164,6 +362,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -184,6 +383,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -241,6 +441,7 @@ stats = ["", "_stats"]
 isa = [
     "_sse_128_64", "_sse_128_32", "_sse_128_16", "_sse_128_8", "_sse_128_sat",
     "_avx_256_64", "_avx_256_32", "_avx_256_16", "_avx_256_8", "_avx_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
     "_64", "_32", "_16", "_8", "_sat"
@@ -261,3 +462,60 @@ for a in alg:
             for p in par:
                 print "    parasail_"+a+s+t+p+"_sat"
 
+# dispatching width selection implementations
+alg = ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]
+par = ["_scan", "_striped", "_diag", "_scan_profile", "_striped_profile"]
+for a in alg:
+    for p in par:
+        print "    parasail_"+a+p+"_auto"
+
+# vectorized and dispatching workspace implementations
+alg = ["nw", "sw"]
+par = ["_striped_ws", "_striped_profile_ws"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
+    "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
+    "_64", "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print "    parasail_"+a+p+i
+
+# seed extension implementations
+print "    parasail_extend"
+par = ["_scan", "_striped", "_scan_profile", "_striped_profile"]
+for p in par:
+    for i in isa:
+        print "    parasail_extend"+p+i
+
+# vectorized and dispatching 8-bit score difference implementations
+isa = [
+    "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_8", "_avx512_512_sat",
+    "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_8", "_neon_128_sat",
+    "_8", "_sat"
+    ]
+for a in ["nw", "sg"]:
+    for i in isa:
+        print "    parasail_"+a+"_diag_diff"+i
+
+# vectorized and dispatching inter-sequence batch implementations
+isa = [
+    "_sse2_128_32", "_sse2_128_16", "_sse2_128_8",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8",
+    "_avx512_512_32", "_avx512_512_16", "_avx512_512_8",
+    "_altivec_128_32", "_altivec_128_16", "_altivec_128_8",
+    "_neon_128_32", "_neon_128_16", "_neon_128_8",
+    "_32", "_16", "_8", "_sat"
+    ]
+for i in isa:
+    print "    parasail_sw_batch"+i
@@ -58,6 +58,25 @@ for s in stats:
         print " "*8+"const parasail_matrix_t* matrix,"
         print " "*8+"int s1_beg, int s1_end, int s2_beg, int s2_end);"
 
+# linear-memory traceback implementations
+alg = ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]
+for a in alg:
+    print ""
+    print "extern parasail_result_t* parasail_"+a+'_trace_linear('
+    print " "*8+"const char * const restrict s1, const int s1Len,"
+    print " "*8+"const char * const restrict s2, const int s2Len,"
+    print " "*8+"const int open, const int gap,"
+    print " "*8+"const parasail_matrix_t* matrix);"
+
+# linear-memory traceback implementation of internal sg function
+print ""
+print "extern parasail_result_t* parasail_sg_flags_trace_linear("
+print " "*8+"const char * const restrict s1, const int s1Len,"
+print " "*8+"const char * const restrict s2, const int s2Len,"
+print " "*8+"const int open, const int gap,"
+print " "*8+"const parasail_matrix_t* matrix,"
+print " "*8+"int s1_beg, int s1_end, int s2_beg, int s2_end);"
+
 # vectorized implementations
 alg = ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]
 stats = ["", "_stats"]
@@ -67,6 +86,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -91,6 +111,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -116,6 +137,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -139,6 +161,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -249,6 +272,7 @@ stats = ["", "_stats"]
 isa = [
     "_sse_128_64", "_sse_128_32", "_sse_128_16", "_sse_128_8", "_sse_128_sat",
     "_avx_256_64", "_avx_256_32", "_avx_256_16", "_avx_256_8", "_avx_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
     "_64", "_32", "_16", "_8", "_sat"
@@ -293,3 +317,85 @@ for s in stats:
             print " "*8+"const parasail_matrix_t* matrix,"
             print " "*8+"int s1_beg, int s1_end, int s2_beg, int s2_end);"
 
+
+# vectorized and dispatching workspace implementations
+alg = ["nw", "sw"]
+par = ["_striped_ws"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_64", "_avx512_512_32", "_avx512_512_16", "_avx512_512_8", "_avx512_512_sat",
+    "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
+    "_64", "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print ""
+            print "extern parasail_result_t* parasail_"+a+p+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"const parasail_matrix_t* matrix,"
+            print " "*8+"parasail_workspace_t * const restrict workspace,"
+            print " "*8+"parasail_result_t * const restrict result);"
+
+# vectorized and dispatching workspace profile implementations
+alg = ["nw", "sw"]
+par = ["_striped_profile_ws"]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print ""
+            print "extern parasail_result_t* parasail_"+a+p+i+'('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace,"
+            print " "*8+"parasail_result_t * const restrict result);"
+
+# vectorized and dispatching seed extension implementations
+par = ["_scan", "_striped"]
+for p in par:
+    for i in isa:
+        print ""
+        print "extern parasail_result_t* parasail_extend"+p+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix,"
+        print " "*8+"const int xdrop, const int zdrop,"
+        print " "*8+"parasail_extension_t * const restrict extension);"
+
+# vectorized and dispatching seed extension profile implementations
+par = ["_scan_profile", "_striped_profile"]
+for p in par:
+    for i in isa:
+        print ""
+        print "extern parasail_result_t* parasail_extend"+p+i+'('
+        print " "*8+"const parasail_profile_t * const restrict profile,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const int xdrop, const int zdrop,"
+        print " "*8+"parasail_extension_t * const restrict extension);"
+
+# vectorized 8-bit score difference implementations
+alg = ["nw", "sg"]
+isa = [
+    "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_8", "_avx2_256_sat",
+    "_avx512_512_8", "_avx512_512_sat",
+    "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_8", "_neon_128_sat",
+    ]
+for a in alg:
+    for i in isa:
+        print ""
+        print "extern parasail_result_t* parasail_"+a+"_diag_diff"+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix);"
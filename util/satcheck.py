@@ -19,17 +19,78 @@ txt = """/**
 #include <string.h>
 
 #include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/memory.h"
+
+/* kernel widths run by the _sat and _auto functions since the last reset */
+static parasail_sat_stats_t parasail_sat_stats = {0, 0, 0};
+
+#if defined(__GNUC__)
+#define SAT_COUNT(field) __sync_fetch_and_add(&parasail_sat_stats.field, 1)
+#else
+/* without atomics the counts are approximate when used from threads */
+#define SAT_COUNT(field) (++parasail_sat_stats.field)
+#endif
+
+void parasail_sat_stats_get(parasail_sat_stats_t *stats)
+{
+    *stats = parasail_sat_stats;
+}
+
+void parasail_sat_stats_reset(void)
+{
+    parasail_sat_stats.bits8 = 0;
+    parasail_sat_stats.bits16 = 0;
+    parasail_sat_stats.bits32 = 0;
+}
 
 """
+
+isas = ["_sse2_128", "_sse41_128", "_avx2_256", "_avx512_512", "_altivec_128", "_neon_128"]
+
+def isa_guard(isa):
+    if isa:
+        isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+        if 'avx512' in isa:
+            isa_pre += "BW"
+        return isa_pre, "#endif"
+    return "", ""
+
+# name of the profile creator for the ISA, e.g., _sse41_128 -> sse_128
+def profile_isa(isa):
+    name = isa.split('_')[1]
+    if name.startswith('sse'):
+        name = 'sse'
+    elif name == 'avx2':
+        name = 'avx'
+    return "%s_%s" % (name, isa.split('_')[2])
+
+# forward declare the resumable sw striped kernels
+txt += "/* forward declare the resumable sw striped kernels */\n"
+for isa in isas:
+    isa_pre, isa_post = isa_guard(isa)
+    txt += "%s\n" % isa_pre
+    for width in [8, 16, 32]:
+        txt += """extern parasail_result_t* parasail_sw_striped_profile_resume%s_%d(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_sat_state_t * const restrict state);
+""" % (isa, width)
+    txt += "%s\n" % isa_post
 for alg in ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]:
     for table in ["", "_table", "_rowcol", "_trace"]:
         for stats in ["", "_stats"]:
             if 'stats' in stats and 'trace' in table: continue
             for par in ["_scan", "_striped", "_diag"]:
-                for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_altivec_128", "_neon_128"]:
+                # sw striped resumes instead, see below
+                if alg == "sw" and par == "_striped" and not table and not stats: continue
+                for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512_512", "_altivec_128", "_neon_128"]:
                     prefix = "parasail_%s%s%s%s%s"%(alg, stats, table, par, isa)
                     if isa:
                         isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+                        if 'avx512' in isa:
+                            isa_pre += "BW"
                         isa_post = "#endif"
                     else:
                         isa_pre = ""
@@ -47,12 +108,15 @@ parasail_result_t* %(PREFIX)s_sat(
 {
     parasail_result_t * result = NULL;
 
+    SAT_COUNT(bits8);
     result = %(PREFIX)s_8(s1, s1Len, s2, s2Len, open, gap, matrix);
     if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
         parasail_result_free(result);
         result = %(PREFIX)s_16(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
     if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
         parasail_result_free(result);
         result = %(PREFIX)s_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
@@ -67,10 +131,14 @@ for alg in ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_d
         for stats in ["", "_stats"]:
             if 'stats' in stats and 'trace' in table: continue
             for par in ["_scan_profile", "_striped_profile"]:
-                for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_altivec_128", "_neon_128"]:
+                # sw striped resumes instead, see below
+                if alg == "sw" and par == "_striped_profile" and not table and not stats: continue
+                for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512_512", "_altivec_128", "_neon_128"]:
                     prefix = "parasail_%s%s%s%s%s"%(alg, stats, table, par, isa)
                     if isa:
                         isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+                        if 'avx512' in isa:
+                            isa_pre += "BW"
                         isa_post = "#endif"
                     else:
                         isa_pre = ""
@@ -87,13 +155,18 @@ parasail_result_t* %(PREFIX)s_sat(
 {
     parasail_result_t * result = NULL;
 
+    SAT_COUNT(bits8);
     result = %(PREFIX)s_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
         parasail_result_free(result);
+        parasail_profile_materialize(profile, 16);
         result = %(PREFIX)s_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
         parasail_result_free(result);
+        parasail_profile_materialize(profile, 32);
         result = %(PREFIX)s_32(profile, s2, s2Len, open, gap);
     }
 
@@ -102,6 +175,498 @@ parasail_result_t* %(PREFIX)s_sat(
 %(ISA_POST)s
 """ % params
 
+for alg in ["nw", "sw"]:
+    for par in ["_striped_ws", "_striped_profile_ws"]:
+        for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512_512", "_altivec_128", "_neon_128"]:
+            prefix = "parasail_%s%s%s"%(alg, par, isa)
+            if isa:
+                isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+                if 'avx512' in isa:
+                    isa_pre += "BW"
+                isa_post = "#endif"
+            else:
+                isa_pre = ""
+                isa_post = ""
+            params = {"PREFIX":prefix,
+                    "ISA_PRE":isa_pre,
+                    "ISA_POST":isa_post}
+            if 'profile' in par:
+                params["SIGNATURE"] = """
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,"""
+                params["ARGS"] = "profile, s2, s2Len, open, gap"
+                params["MATERIALIZE16"] = """
+        parasail_profile_materialize(profile, 16);"""
+                params["MATERIALIZE32"] = """
+        parasail_profile_materialize(profile, 32);"""
+            else:
+                params["SIGNATURE"] = """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,"""
+                params["ARGS"] = "s1, s1Len, s2, s2Len, open, gap, matrix"
+                params["MATERIALIZE16"] = ""
+                params["MATERIALIZE32"] = ""
+            txt += """
+%(ISA_PRE)s
+parasail_result_t* %(PREFIX)s_sat(%(SIGNATURE)s
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    SAT_COUNT(bits8);
+    %(PREFIX)s_8(%(ARGS)s, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);%(MATERIALIZE16)s
+        %(PREFIX)s_16(%(ARGS)s, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);%(MATERIALIZE32)s
+        %(PREFIX)s_32(%(ARGS)s, workspace, result);
+    }
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+for par in ["_scan", "_striped", "_scan_profile", "_striped_profile"]:
+    for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512_512", "_altivec_128", "_neon_128"]:
+        prefix = "parasail_extend%s%s"%(par, isa)
+        isa_pre, isa_post = isa_guard(isa)
+        params = {"PREFIX":prefix,
+                "ISA_PRE":isa_pre,
+                "ISA_POST":isa_post}
+        if 'profile' in par:
+            params["SIGNATURE"] = """
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,"""
+            params["ARGS"] = "profile, s2, s2Len, open, gap"
+            params["MATERIALIZE16"] = """
+        parasail_profile_materialize(profile, 16);"""
+            params["MATERIALIZE32"] = """
+        parasail_profile_materialize(profile, 32);"""
+        else:
+            params["SIGNATURE"] = """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,"""
+            params["ARGS"] = "s1, s1Len, s2, s2Len, open, gap, matrix"
+            params["MATERIALIZE16"] = ""
+            params["MATERIALIZE32"] = ""
+        txt += """
+%(ISA_PRE)s
+parasail_result_t* %(PREFIX)s_sat(%(SIGNATURE)s
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_result_t * result = NULL;
+
+    SAT_COUNT(bits8);
+    result = %(PREFIX)s_8(%(ARGS)s, xdrop, zdrop, extension);
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
+        parasail_result_free(result);%(MATERIALIZE16)s
+        result = %(PREFIX)s_16(%(ARGS)s, xdrop, zdrop, extension);
+    }
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
+        parasail_result_free(result);%(MATERIALIZE32)s
+        result = %(PREFIX)s_32(%(ARGS)s, xdrop, zdrop, extension);
+    }
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+# The 8-bit score difference kernels only report saturation for
+# penalties too large for bytes, which the scan kernels then handle.
+for alg in ["nw", "sg"]:
+    for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512_512", "_altivec_128", "_neon_128"]:
+        isa_pre, isa_post = isa_guard(isa)
+        params = {"PREFIX":"parasail_%s_diag_diff%s" % (alg, isa),
+                "SCAN":"parasail_%s_scan%s" % (alg, isa),
+                "ISA_PRE":isa_pre,
+                "ISA_POST":isa_post}
+        txt += """
+%(ISA_PRE)s
+parasail_result_t* %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    SAT_COUNT(bits8);
+    result = %(PREFIX)s_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
+        parasail_result_free(result);
+        result = %(SCAN)s_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
+        parasail_result_free(result);
+        result = %(SCAN)s_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+# The kernel families that take their algorithm as flags try 8 bits,
+# then 16 bits, then 32 bits of their dispatched kernels.
+KERNELS = [
+    ("banded", """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix,
+        const parasail_encoded_t * const restrict e1,
+        const parasail_encoded_t * const restrict e2,
+        const int flags, const int adaptive""",
+        "s1, s1Len, s2, s2Len, open, gap, k, matrix, e1, e2, flags, adaptive"),
+    ("dna", """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags""",
+        "s1, s1Len, s2, s2Len, open, gap, matrix, flags"),
+    ("hybrid", """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int flags""",
+        "s1, s1Len, s2, s2Len, open, gap, matrix, flags"),
+]
+for family, signature, args in KERNELS:
+    params = {"PREFIX":"parasail_%s" % family,
+            "SIGNATURE":signature,
+            "ARGS":args}
+    txt += """
+parasail_result_t* %(PREFIX)s_sat(%(SIGNATURE)s)
+{
+    parasail_result_t * result = NULL;
+
+    SAT_COUNT(bits8);
+    result = %(PREFIX)s_8(%(ARGS)s);
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
+        parasail_result_free(result);
+        result = %(PREFIX)s_16(%(ARGS)s);
+    }
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
+        parasail_result_free(result);
+        result = %(PREFIX)s_32(%(ARGS)s);
+    }
+
+    return result;
+}
+""" % params
+
+# The sw striped kernels stop at the first column whose maximum could
+# overflow, before any cell has actually overflowed, and hand that column
+# to the next wider kernel of the same ISA which resumes from it.
+for isa in isas:
+    isa_pre, isa_post = isa_guard(isa)
+    params = {"ISA":isa,
+            "PISA":profile_isa(isa),
+            "ISA_PRE":isa_pre,
+            "ISA_POST":isa_post}
+    txt += """
+%(ISA_PRE)s
+parasail_result_t* parasail_sw_striped%(ISA)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t * profile = NULL;
+    parasail_sat_state_t state = {NULL, NULL, -1, 0};
+
+    SAT_COUNT(bits8);
+    profile = parasail_profile_create_%(PISA)s_8(s1, s1Len, matrix);
+    result = parasail_sw_striped_profile_resume%(ISA)s_8(profile, s2, s2Len, open, gap, &state);
+    parasail_profile_free(profile);
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
+        parasail_result_free(result);
+        profile = parasail_profile_create_%(PISA)s_16(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_resume%(ISA)s_16(profile, s2, s2Len, open, gap, &state);
+        parasail_profile_free(profile);
+    }
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
+        parasail_result_free(result);
+        profile = parasail_profile_create_%(PISA)s_32(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_resume%(ISA)s_32(profile, s2, s2Len, open, gap, &state);
+        parasail_profile_free(profile);
+    }
+    parasail_free(state.E);
+    parasail_free(state.H);
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile%(ISA)s_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_sat_state_t state = {NULL, NULL, -1, 0};
+
+    SAT_COUNT(bits8);
+    result = parasail_sw_striped_profile_resume%(ISA)s_8(profile, s2, s2Len, open, gap, &state);
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
+        parasail_result_free(result);
+        parasail_profile_materialize(profile, 16);
+        result = parasail_sw_striped_profile_resume%(ISA)s_16(profile, s2, s2Len, open, gap, &state);
+    }
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
+        parasail_result_free(result);
+        parasail_profile_materialize(profile, 32);
+        result = parasail_sw_striped_profile_resume%(ISA)s_32(profile, s2, s2Len, open, gap, &state);
+    }
+    parasail_free(state.E);
+    parasail_free(state.H);
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+# The dispatching sw striped _sat functions pick one ISA for all widths
+# so that the saturated column can be handed between them.
+txt += """
+/* forward declare the dispatcher functions */
+parasail_function_t parasail_sw_striped_sat_dispatcher;
+parasail_pfunction_t parasail_sw_striped_profile_sat_dispatcher;
+
+/* declare and initialize the pointer to the dispatcher function */
+parasail_function_t * parasail_sw_striped_sat_pointer = parasail_sw_striped_sat_dispatcher;
+parasail_pfunction_t * parasail_sw_striped_profile_sat_pointer = parasail_sw_striped_profile_sat_dispatcher;
+
+/* without a vector ISA, rerun each width from the start */
+static parasail_result_t* parasail_sw_striped_sat_rerun(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    SAT_COUNT(bits8);
+    result = parasail_sw_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
+        parasail_result_free(result);
+        result = parasail_sw_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
+        parasail_result_free(result);
+        result = parasail_sw_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+
+static parasail_result_t* parasail_sw_striped_profile_sat_rerun(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    SAT_COUNT(bits8);
+    result = parasail_sw_striped_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits16);
+        parasail_result_free(result);
+        result = parasail_sw_striped_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        SAT_COUNT(bits32);
+        parasail_result_free(result);
+        result = parasail_sw_striped_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+"""
+for par in ["_striped", "_striped_profile"]:
+    prefix = "parasail_sw%s" % par
+    params = {"PREFIX":prefix}
+    if 'profile' in par:
+        params["SIGNATURE"] = """
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)"""
+        params["ARGS"] = "profile, s2, s2Len, open, gap"
+    else:
+        params["SIGNATURE"] = """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)"""
+        params["ARGS"] = "s1, s1Len, s2, s2Len, open, gap, matrix"
+    txt += """
+parasail_result_t* %(PREFIX)s_sat_dispatcher(%(SIGNATURE)s
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_sat_pointer = %(PREFIX)s_avx512_512_sat;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_sat_pointer = %(PREFIX)s_avx2_256_sat;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_sat_pointer = %(PREFIX)s_sse41_128_sat;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        %(PREFIX)s_sat_pointer = %(PREFIX)s_sse2_128_sat;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        %(PREFIX)s_sat_pointer = %(PREFIX)s_altivec_128_sat;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        %(PREFIX)s_sat_pointer = %(PREFIX)s_neon_128_sat;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_sat_pointer = %(PREFIX)s_sat_rerun;
+    }
+    return %(PREFIX)s_sat_pointer(%(ARGS)s);
+}
+
+parasail_result_t* %(PREFIX)s_sat(%(SIGNATURE)s
+{
+    return %(PREFIX)s_sat_pointer(%(ARGS)s);
+}
+""" % params
+
+# The _auto functions choose the width from a bound on the scores
+# instead of trying 8 bits first.
+txt += """
+/* Narrowest kernel width, at least min_bits, whose limits no score of
+ * this pair can reach, or 32 if none is certain.  Every aligned column
+ * scores at most matrix->max and gaps only lower a score, so no H
+ * exceeds min(s1Len,s2Len)*max; the all-gap path keeps every nw and
+ * sg cell above -2*open-(s1Len+s2Len)*gap, and E and F lie at most one
+ * more open below.  The kernels stop short of their limits by about one
+ * substitution or gap open, which is added as a margin. */
+static int parasail_auto_bits(
+        const int local, const int min_bits,
+        const int s1Len, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    const long long max = matrix->max > 0 ? matrix->max : 0;
+    const long long margin = (open > -matrix->min ? open : -matrix->min) + 1;
+    const long long hi = (long long)(s1Len < s2Len ? s1Len : s2Len)*max + max + 1;
+    const long long lo = local ? (long long)open + gap + margin
+        : 3LL*open + (long long)(s1Len+s2Len)*gap + margin;
+    const long long need = hi > lo ? hi : lo;
+
+    if (min_bits <= 8 && need < INT8_MAX) {
+        return 8;
+    }
+    if (min_bits <= 16 && need < INT16_MAX) {
+        return 16;
+    }
+    return 32;
+}
+"""
+
+# The 8-bit nw striped kernels start from NEG_INF == INT8_MIN and the
+# 8-bit nw and sg diag kernels check their boundary cells against it, so
+# they report saturation on every pair; _auto starts those at 16 bits.
+def auto_min_bits(alg, par):
+    if alg == "nw" and par.startswith("_striped"):
+        return 16
+    if alg.startswith("nw") or alg.startswith("sg"):
+        if par == "_diag":
+            return 16
+    return 8
+
+for alg in ["nw", "sg", "sw", "sg_qb", "sg_qe", "sg_qx", "sg_db", "sg_de", "sg_dx", "sg_qb_de", "sg_qe_db"]:
+    for par in ["_scan", "_striped", "_diag", "_scan_profile", "_striped_profile"]:
+        prefix = "parasail_%s%s" % (alg, par)
+        params = {"PREFIX":prefix, "LOCAL":int(alg == "sw"),
+                "MIN_BITS":auto_min_bits(alg, par)}
+        if 'profile' in par:
+            params["SIGNATURE"] = """
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)"""
+            params["ARGS"] = "profile, s2, s2Len, open, gap"
+            params["BOUND"] = "profile->s1Len, s2Len, open, gap, profile->matrix"
+        else:
+            params["SIGNATURE"] = """
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)"""
+            params["ARGS"] = "s1, s1Len, s2, s2Len, open, gap, matrix"
+            params["BOUND"] = "s1Len, s2Len, open, gap, matrix"
+        txt += """
+parasail_result_t* %(PREFIX)s_auto(%(SIGNATURE)s
+{
+    parasail_result_t * result = NULL;
+    const int bits = parasail_auto_bits(%(LOCAL)d, %(MIN_BITS)d, %(BOUND)s);
+
+    /* start at the width of the bound and only move up from there if
+     * the kernel still saw its limit */
+    if (8 == bits) {
+        SAT_COUNT(bits8);
+        result = %(PREFIX)s_8(%(ARGS)s);
+        if (!parasail_result_is_saturated(result)) {
+            return result;
+        }
+        parasail_result_free(result);
+    }
+    if (bits <= 16) {
+        SAT_COUNT(bits16);
+        result = %(PREFIX)s_16(%(ARGS)s);
+        if (!parasail_result_is_saturated(result)) {
+            return result;
+        }
+        parasail_result_free(result);
+    }
+    SAT_COUNT(bits32);
+    return %(PREFIX)s_32(%(ARGS)s);
+}
+""" % params
+
 
 output_dir = "generated/"
 if not os.path.exists(output_dir):
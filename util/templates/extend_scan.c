@@ -0,0 +1,327 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+#define MAX(a,b) ((a)>(b)?(a):(b))
+%(FIXES)s
+
+#define FNAME %(NAME)s
+#define PNAME %(PNAME)s
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_t *profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+    parasail_profile_free(profile);
+    return result;
+}
+
+/* first query row of a striped column holding value */
+static inline %(INDEX)s first_row(
+        const %(VTYPE)s * const restrict pv,
+        const %(INDEX)s segLen,
+        const %(INDEX)s s1Len,
+        const %(INT)s value)
+{
+    const %(INT)s *t = (const %(INT)s*)pv;
+    const %(INDEX)s column_len = segLen * %(LANES)s;
+    %(INDEX)s row = s1Len;
+    %(INDEX)s i = 0;
+    for (i=0; i<column_len; ++i, ++t) {
+        if (*t == value) {
+            %(INDEX)s temp = i / %(LANES)s + i %% %(LANES)s * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    const int s1Len = profile->s1Len;
+    %(INDEX)s end_query = -1;
+    %(INDEX)s end_ref = -1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    /* position of the last query row within a column */
+    const %(INDEX)s last = (s1Len - 1) %% segLen * segWidth + (s1Len - 1) / segLen;
+    %(VTYPE)s* const restrict pvP = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+    %(VTYPE)s* const restrict pvHt= parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvH = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvHMax = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvGapper = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    /* cut cells are set to NEG_LIMIT; anything derived from one stays
+     * below NEG_LIMIT + matrix->max without wrapping */
+    const %(INT)s NEG_LIMIT = NEG_INF + MAX(open + gap, -matrix->min) + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vNegInfFront = vZero;
+    %(VTYPE)s vSegLenXgap;
+    int score = 0;
+    int query_end_score = 0;
+    int query_end_ref = -1;
+    int stop = PARASAIL_EXTEND_END;
+    int saturated = 0;
+    parasail_result_t *result = parasail_result_new();
+
+    /* the cut must stay above every value derived from a cut cell, and
+     * without a cut the boundary has to be exact */
+    if (xdrop >= 0) {
+        saturated = -(int64_t)xdrop <= (int64_t)NEG_LIMIT + matrix->max;
+    }
+    else {
+        saturated = -2*(int64_t)open
+            - (int64_t)gap*MAX(s1Len, s2Len) < (int64_t)NEG_LIMIT;
+    }
+
+    vNegInfFront = %(VINSERT)s(vNegInfFront, NEG_LIMIT, 0);
+    {
+        int64_t tmp = -(int64_t)segLen*gap;
+        vSegLenXgap = %(VADD)s(vNegInfFront,
+                %(VSHIFT)s(%(VSET1)s(tmp < NEG_INF ? NEG_INF : tmp), %(BYTES)s));
+    }
+
+%(INIT_H_AND_E)s
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+        }
+    }
+
+    {
+        %(VTYPE)s vGapper = %(VSUB)s(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            %(VSTORE)s(pvGapper+i, vGapper);
+            vGapper = %(VSUB)s(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len && !saturated; ++j) {
+        %(VTYPE)s vE;
+        %(VTYPE)s vHt;
+        %(VTYPE)s vF;
+        %(VTYPE)s vH;
+        %(VTYPE)s vHp;
+        %(VTYPE)s *pvW;
+        %(VTYPE)s vW;
+        %(VTYPE)s vMax = vNegLimit;
+        %(VTYPE)s vMin = vNegLimit;
+        %(INT)s max = 0;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = %(VLOAD)s(pvH+(segLen-1));
+        vHp = %(VSHIFT)s(vHp, %(BYTES)s);
+        vHp = %(VINSERT)s(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = %(VSUB)s(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = %(VLOAD)s(pvH+i);
+            vE = %(VLOAD)s(pvE+i);
+            vW = %(VLOAD)s(pvW+i);
+            vE = %(VMAX)s(
+                    %(VSUB)s(vE, vGapE),
+                    %(VSUB)s(vH, vGapO));
+            vHp = %(VADD)s(vHp, vW);
+            vF = %(VMAX)s(vF, %(VADD)s(vHt, pvGapper[i]));
+            vHt = %(VMAX)s(vE, vHp);
+            %(VSTORE)s(pvE+i, vE);
+            %(VSTORE)s(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = %(VSHIFT)s(vHt, %(BYTES)s);
+        vHt = %(VINSERT)s(vHt, boundary[j+1], 0);
+        vF = %(VMAX)s(vF, %(VADD)s(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            %(VTYPE)s vFt = %(VSHIFT)s(vF, %(BYTES)s);
+            vFt = %(VADD)s(vFt, vSegLenXgap);
+            vF = %(VMAX)s(vF, vFt);
+        }
+
+        /* calculate final H */
+        vF = %(VSHIFT)s(vF, %(BYTES)s);
+        vF = %(VADD)s(vF, vNegInfFront);
+        vH = %(VMAX)s(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            vHt = %(VLOAD)s(pvHt+i);
+            vF = %(VMAX)s(
+                    %(VSUB)s(vF, vGapE),
+                    %(VSUB)s(vH, vGapO));
+            vH = %(VMAX)s(vHt, vF);
+            %(VSTORE)s(pvH+i, vH);
+        }
+
+        /* the padding rows past the end of s1 never reach a real row,
+         * keep them out of the column maximum */
+        {
+            %(INT)s *t = (%(INT)s*)pvH;
+            for (k=s1Len; k<segLen*segWidth; ++k) {
+                t[k %% segLen * segWidth + k / segLen] = NEG_LIMIT;
+            }
+        }
+
+        /* column maximum */
+        for (i=0; i<segLen; ++i) {
+            vH = %(VLOAD)s(pvH + i);
+            vMax = %(VMAX)s(vMax, vH);
+            vMin = %(VMIN)s(vMin, vH);
+        }
+        max = %(VHMAX)s(vMax);
+        if (max > POS_LIMIT || (xdrop < 0
+                    && %(VMOVEMASK)s(%(VCMPLT)s(vMin, vNegLimit)))) {
+            saturated = 1;
+            break;
+        }
+
+        if (max > score) {
+            score = max;
+            end_query = -1;
+            end_ref = j;
+            memcpy(pvHMax, pvH, sizeof(%(VTYPE)s)*segLen);
+        }
+        if (xdrop >= 0 && max < score - xdrop) {
+            stop = PARASAIL_EXTEND_XDROP;
+            ++j;
+            break;
+        }
+        if (zdrop >= 0 && score - max > zdrop) {
+            %(INDEX)s diagonal = 0;
+            if (end_query < 0) {
+                end_query = first_row(pvHMax, segLen, s1Len, score);
+            }
+            diagonal = (j - end_ref)
+                - (first_row(pvH, segLen, s1Len, max) - end_query);
+            if (diagonal < 0) {
+                diagonal = -diagonal;
+            }
+            if (score - max > zdrop + gap*diagonal) {
+                stop = PARASAIL_EXTEND_ZDROP;
+                ++j;
+                break;
+            }
+        }
+
+        /* cut the cells that can no longer come within xdrop */
+        if (xdrop >= 0) {
+            %(VTYPE)s vCut = %(VSET1)s(score - xdrop);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvH + i);
+                vH = %(VBLEND)s(vH, vNegLimit, %(VCMPLT)s(vH, vCut));
+                %(VSTORE)s(pvH + i, vH);
+            }
+        }
+
+        {
+            %(INT)s h = ((%(INT)s*)pvH)[last];
+            if ((xdrop < 0 || h >= score - xdrop)
+                    && (query_end_ref < 0 || h > query_end_score)) {
+                query_end_score = h;
+                query_end_ref = j;
+            }
+        }
+    }
+
+    if (end_ref >= 0 && end_query < 0) {
+        end_query = first_row(pvHMax, segLen, s1Len, score);
+    }
+
+    if (NULL != extension) {
+        extension->query_end_score = query_end_score;
+        extension->query_end_ref = query_end_ref;
+        extension->ref_end_score = 0;
+        extension->ref_end_query = -1;
+        extension->ref_scanned = j;
+        extension->stop = stop;
+        if (PARASAIL_EXTEND_END == stop && !saturated) {
+            /* the last column is cut, so any cell left in it is alive */
+            %(VTYPE)s vMax = vNegLimit;
+            %(INT)s max = 0;
+            for (i=0; i<segLen; ++i) {
+                vMax = %(VMAX)s(vMax, %(VLOAD)s(pvH + i));
+            }
+            max = %(VHMAX)s(vMax);
+            if (xdrop < 0 || max > NEG_LIMIT) {
+                extension->ref_end_score = max;
+                extension->ref_end_query = first_row(pvH, segLen, s1Len, max);
+            }
+        }
+    }
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+        if (NULL != extension) {
+            extension->query_end_score = 0;
+            extension->query_end_ref = -1;
+            extension->ref_end_score = 0;
+            extension->ref_end_query = -1;
+            extension->ref_scanned = 0;
+            extension->stop = PARASAIL_EXTEND_END;
+        }
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_END | PARASAIL_FLAG_SG_S2_END
+        | PARASAIL_FLAG_SCAN
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+
+    parasail_free(pvGapper);
+    parasail_free(pvHMax);
+    parasail_free(pvH);
+    parasail_free(pvHt);
+    parasail_free(boundary);
+    parasail_free(pvE);
+
+    return result;
+}
@@ -0,0 +1,317 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+#define MAX(a,b) ((a)>(b)?(a):(b))
+%(FIXES)s
+
+#define FNAME %(NAME)s
+#define PNAME %(PNAME)s
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    parasail_profile_t *profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap, xdrop, zdrop, extension);
+    parasail_profile_free(profile);
+    return result;
+}
+
+/* first query row of a striped column holding value */
+static inline %(INDEX)s first_row(
+        const %(VTYPE)s * const restrict pv,
+        const %(INDEX)s segLen,
+        const %(INDEX)s s1Len,
+        const %(INT)s value)
+{
+    const %(INT)s *t = (const %(INT)s*)pv;
+    const %(INDEX)s column_len = segLen * %(LANES)s;
+    %(INDEX)s row = s1Len;
+    %(INDEX)s i = 0;
+    for (i=0; i<column_len; ++i, ++t) {
+        if (*t == value) {
+            %(INDEX)s temp = i / %(LANES)s + i %% %(LANES)s * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int xdrop, const int zdrop,
+        parasail_extension_t * const restrict extension)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    const int s1Len = profile->s1Len;
+    %(INDEX)s end_query = -1;
+    %(INDEX)s end_ref = -1;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    /* position of the last query row within a column */
+    const %(INDEX)s last = (s1Len - 1) %% segLen * segWidth + (s1Len - 1) / segLen;
+    %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHLoad = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvHMax = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    /* cut cells are set to NEG_LIMIT; anything derived from one stays
+     * below NEG_LIMIT + matrix->max without wrapping */
+    const %(INT)s NEG_LIMIT = NEG_INF + MAX(open + gap, -matrix->min) + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    int score = 0;
+    int query_end_score = 0;
+    int query_end_ref = -1;
+    int stop = PARASAIL_EXTEND_END;
+    int saturated = 0;
+    parasail_result_t *result = parasail_result_new();
+
+    /* the cut must stay above every value derived from a cut cell, and
+     * without a cut the boundary has to be exact */
+    if (xdrop >= 0) {
+        saturated = -(int64_t)xdrop <= (int64_t)NEG_LIMIT + matrix->max;
+    }
+    else {
+        saturated = -2*(int64_t)open
+            - (int64_t)gap*MAX(s1Len, s2Len) < (int64_t)NEG_LIMIT;
+    }
+
+%(INIT_H_AND_E)s
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < NEG_LIMIT ? NEG_LIMIT : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len && !saturated; ++j) {
+        %(VTYPE)s vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        %(VTYPE)s vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        %(VTYPE)s vH = %(VSHIFT)s(pvHStore[segLen - 1], %(BYTES)s);
+
+        /* Correct part of the vProfile */
+        const %(VTYPE)s* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+
+        %(VTYPE)s vMax = vNegLimit;
+        %(VTYPE)s vMin = vNegLimit;
+        %(INT)s max = 0;
+
+        /* Swap the 2 H buffers. */
+        %(VTYPE)s* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = %(VINSERT)s(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = %(VADD)s(vH, %(VLOAD)s(vP + i));
+            vE = %(VLOAD)s(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = %(VMAX)s(vH, vE);
+            vH = %(VMAX)s(vH, vF);
+            /* Save vH values. */
+            %(VSTORE)s(pvHStore + i, vH);
+
+            /* Update vE value. */
+            vH = %(VSUB)s(vH, vGapO);
+            vE = %(VSUB)s(vE, vGapE);
+            vE = %(VMAX)s(vE, vH);
+            %(VSTORE)s(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = %(VSUB)s(vF, vGapE);
+            vF = %(VMAX)s(vF, vH);
+
+            /* Load the next vH. */
+            vH = %(VLOAD)s(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = %(VSHIFT)s(vF, %(BYTES)s);
+            vF = %(VINSERT)s(vF, boundary[j+1]-open, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvHStore + i);
+                vH = %(VMAX)s(vH,vF);
+                %(VSTORE)s(pvHStore + i, vH);
+                vH = %(VSUB)s(vH, vGapO);
+                vF = %(VSUB)s(vF, vGapE);
+                if (! %(LAZY_F_TEST)s) goto end;
+                /*vF = %(VMAX)s(vF, vH);*/
+            }
+        }
+end:
+        {
+        }
+
+        /* the padding rows past the end of s1 never reach a real row,
+         * keep them out of the column maximum */
+        {
+            %(INT)s *t = (%(INT)s*)pvHStore;
+            for (k=s1Len; k<segLen*segWidth; ++k) {
+                t[k %% segLen * segWidth + k / segLen] = NEG_LIMIT;
+            }
+        }
+
+        /* column maximum */
+        for (i=0; i<segLen; ++i) {
+            vH = %(VLOAD)s(pvHStore + i);
+            vMax = %(VMAX)s(vMax, vH);
+            vMin = %(VMIN)s(vMin, vH);
+        }
+        max = %(VHMAX)s(vMax);
+        if (max > POS_LIMIT || (xdrop < 0
+                    && %(VMOVEMASK)s(%(VCMPLT)s(vMin, vNegLimit)))) {
+            saturated = 1;
+            break;
+        }
+
+        if (max > score) {
+            score = max;
+            end_query = -1;
+            end_ref = j;
+            memcpy(pvHMax, pvHStore, sizeof(%(VTYPE)s)*segLen);
+        }
+        if (xdrop >= 0 && max < score - xdrop) {
+            stop = PARASAIL_EXTEND_XDROP;
+            ++j;
+            break;
+        }
+        if (zdrop >= 0 && score - max > zdrop) {
+            %(INDEX)s diagonal = 0;
+            if (end_query < 0) {
+                end_query = first_row(pvHMax, segLen, s1Len, score);
+            }
+            diagonal = (j - end_ref)
+                - (first_row(pvHStore, segLen, s1Len, max) - end_query);
+            if (diagonal < 0) {
+                diagonal = -diagonal;
+            }
+            if (score - max > zdrop + gap*diagonal) {
+                stop = PARASAIL_EXTEND_ZDROP;
+                ++j;
+                break;
+            }
+        }
+
+        /* cut the cells that can no longer come within xdrop */
+        if (xdrop >= 0) {
+            %(VTYPE)s vCut = %(VSET1)s(score - xdrop);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvHStore + i);
+                vH = %(VBLEND)s(vH, vNegLimit, %(VCMPLT)s(vH, vCut));
+                %(VSTORE)s(pvHStore + i, vH);
+            }
+        }
+
+        {
+            %(INT)s h = ((%(INT)s*)pvHStore)[last];
+            if ((xdrop < 0 || h >= score - xdrop)
+                    && (query_end_ref < 0 || h > query_end_score)) {
+                query_end_score = h;
+                query_end_ref = j;
+            }
+        }
+    }
+
+    if (end_ref >= 0 && end_query < 0) {
+        end_query = first_row(pvHMax, segLen, s1Len, score);
+    }
+
+    if (NULL != extension) {
+        extension->query_end_score = query_end_score;
+        extension->query_end_ref = query_end_ref;
+        extension->ref_end_score = 0;
+        extension->ref_end_query = -1;
+        extension->ref_scanned = j;
+        extension->stop = stop;
+        if (PARASAIL_EXTEND_END == stop && !saturated) {
+            /* the last column is cut, so any cell left in it is alive */
+            %(VTYPE)s vMax = vNegLimit;
+            %(INT)s max = 0;
+            for (i=0; i<segLen; ++i) {
+                vMax = %(VMAX)s(vMax, %(VLOAD)s(pvHStore + i));
+            }
+            max = %(VHMAX)s(vMax);
+            if (xdrop < 0 || max > NEG_LIMIT) {
+                extension->ref_end_score = max;
+                extension->ref_end_query = first_row(pvHStore, segLen, s1Len, max);
+            }
+        }
+    }
+
+    if (saturated) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+        if (NULL != extension) {
+            extension->query_end_score = 0;
+            extension->query_end_ref = -1;
+            extension->ref_end_score = 0;
+            extension->ref_end_query = -1;
+            extension->ref_scanned = 0;
+            extension->stop = PARASAIL_EXTEND_END;
+        }
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG
+        | PARASAIL_FLAG_SG_S1_END | PARASAIL_FLAG_SG_S2_END
+        | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHMax);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+
+    return result;
+}
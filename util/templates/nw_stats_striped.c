@@ -112,6 +112,7 @@ parasail_result_t* PNAME(
     %(INT)s similar = 0;
     %(INT)s length = 0;
     %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_LIMIT-1);
     %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
     %(VTYPE)s vSaturationCheckMin = vPosLimit;
     %(VTYPE)s vSaturationCheckMax = vNegLimit;
@@ -166,8 +167,9 @@ parasail_result_t* PNAME(
         const %(VTYPE)s* vPS = NULL;
 
         /* Initialize F value to neg inf.  Any errors to vH values will
-         * be corrected in the Lazy_F loop.  */
-        vF = vNegLimit;
+         * be corrected in the Lazy_F loop.  Neg inf is below NEG_LIMIT
+         * so that an H value floored by it is still seen as saturated. */
+        vF = vNegInf;
         vFM = vZero;
         vFS = vZero;
         vFL = vOne;
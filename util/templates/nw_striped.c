@@ -53,6 +53,8 @@ static inline void arr_store_col(
 #else
 #define FNAME %(NAME)s
 #define PNAME %(PNAME)s
+#define FNAME_WS %(NAME_WS)s
+#define PNAME_WS %(PNAME_WS)s
 #endif
 #endif
 
@@ -67,10 +69,15 @@ parasail_result_t* FNAME(
     return result;
 }
 
-parasail_result_t* PNAME(
+static inline void striped_kernel(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        %(VTYPE)s* restrict pvHStore,
+        %(VTYPE)s* restrict pvHLoad,
+        %(VTYPE)s* const restrict pvE,
+        %(INT)s* const restrict boundary,
+        parasail_result_t * const restrict result)
 {
     %(INDEX)s i = 0;
     %(INDEX)s j = 0;
@@ -84,24 +91,11 @@ parasail_result_t* PNAME(
     const %(INDEX)s offset = (s1Len - 1) %% segLen;
     const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
     %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
-    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
     %(INT)s score = NEG_INF;
     %(SATURATION_CHECK_INIT)s
-#ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
-#else
-#ifdef PARASAIL_ROWCOL
-    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
-#endif
-#endif
 
 %(INIT_H_AND_E)s
 
@@ -181,7 +175,7 @@ parasail_result_t* PNAME(
 #endif
                 vH = %(VSUB)s(vH, vGapO);
                 vF = %(VSUB)s(vF, vGapE);
-                if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
+                if (! %(LAZY_F_TEST)s) goto end;
                 /*vF = %(VMAX)s(vF, vH);*/
             }
         }
@@ -230,6 +224,31 @@ end:
 #ifdef PARASAIL_ROWCOL
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (profile->s1Len + segWidth - 1) / segWidth;
+    %(VTYPE)s* const restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvHLoad = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    striped_kernel(profile, s2, s2Len, open, gap,
+            pvHStore, pvHLoad, pvE, boundary, result);
 
     parasail_free(boundary);
     parasail_free(pvE);
@@ -238,3 +257,77 @@ end:
 
     return result;
 }
+
+#ifdef PNAME_WS
+parasail_result_t* FNAME_WS(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s segNum = 0;
+    const %(INDEX)s n = matrix->size; /* number of amino acids in table */
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    parasail_profile_t profile;
+    %(INT)s *t = NULL;
+
+    /* the profile is built in the workspace ahead of the DP columns */
+    parasail_workspace_grow(workspace, sizeof(%(VTYPE)s)*segLen*(n+3) + sizeof(%(INT)s)*(s2Len+1));
+    {
+        %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)workspace->memory;
+        %(VTYPE)s* const restrict pvHStore = vProfile + n*segLen;
+        %(VTYPE)s* const restrict pvHLoad = pvHStore + segLen;
+        %(VTYPE)s* const restrict pvE = pvHLoad + segLen;
+        %(INT)s* const restrict boundary = (%(INT)s*)(pvE + segLen);
+
+        t = (%(INT)s*)vProfile;
+        for (k=0; k<n; ++k) {
+            for (i=0; i<segLen; ++i) {
+                j = i;
+                for (segNum=0; segNum<segWidth; ++segNum) {
+                    *t++ = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
+                    j += segLen;
+                }
+            }
+        }
+
+        parasail_profile_init(&profile, s1, s1Len, matrix);
+        profile.profile%(WIDTH)s.score = vProfile;
+        parasail_result_init(result);
+        striped_kernel(&profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* PNAME_WS(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (profile->s1Len + segWidth - 1) / segWidth;
+
+    parasail_workspace_grow(workspace, sizeof(%(VTYPE)s)*segLen*3 + sizeof(%(INT)s)*(s2Len+1));
+    {
+        %(VTYPE)s* const restrict pvHStore = (%(VTYPE)s*)workspace->memory;
+        %(VTYPE)s* const restrict pvHLoad = pvHStore + segLen;
+        %(VTYPE)s* const restrict pvE = pvHLoad + segLen;
+        %(INT)s* const restrict boundary = (%(INT)s*)(pvE + segLen);
+
+        parasail_result_init(result);
+        striped_kernel(profile, s2, s2Len, open, gap,
+                pvHStore, pvHLoad, pvE, boundary, result);
+    }
+
+    return result;
+}
+#endif
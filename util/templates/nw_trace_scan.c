@@ -18,23 +18,59 @@
 
 %(FIXES)s
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and %(WIDTH)s/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         %(VTYPE)s *array,
-        %(VTYPE)s vH,
-        %(INDEX)s t,
+        const %(VTYPE)s *pvT,
         %(INDEX)s seglen,
         %(INDEX)s d)
 {
-    %(VSTORE)s(array + (1LL*d*seglen+t), vH);
+    const %(INDEX)s cells = %(WIDTH)s / 4;
+    const %(INDEX)s seglenp = (seglen + cells - 1) / cells;
+    const %(VTYPE)s vZero = %(VSET0)s();
+    const %(VTYPE)s vInsDiag = %(VSET1)s(PARASAIL_INS | PARASAIL_DIAG);
+    const %(VTYPE)s vDelDiag = %(VSET1)s(PARASAIL_DEL | PARASAIL_DIAG);
+    const %(VTYPE)s vInsE = %(VSET1)s(PARASAIL_INS_E);
+    const %(VTYPE)s vDelF = %(VSET1)s(PARASAIL_DEL_F);
+    %(INDEX)s q = 0;
+    %(INDEX)s p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        %(VTYPE)s vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            %(VTYPE)s vT = %(VLOAD)s(pvT + q*cells + p);
+            %(VTYPE)s vBit0 = %(VSET1)s((%(INT)s)(1ULL << (4*p)));
+            %(VTYPE)s vBit1 = %(VSET1)s((%(INT)s)(1ULL << (4*p+1)));
+            %(VTYPE)s vBit2 = %(VSET1)s((%(INT)s)(1ULL << (4*p+2)));
+            %(VTYPE)s vBit3 = %(VSET1)s((%(INT)s)(1ULL << (4*p+3)));
+            vP = %(VOR)s(vP, %(VANDNOT)s(
+                        %(VCMPEQ)s(%(VAND)s(vT, vInsDiag), vZero), vBit0));
+            vP = %(VOR)s(vP, %(VANDNOT)s(
+                        %(VCMPEQ)s(%(VAND)s(vT, vDelDiag), vZero), vBit1));
+            vP = %(VOR)s(vP, %(VANDNOT)s(
+                        %(VCMPEQ)s(%(VAND)s(vT, vInsE), vZero), vBit2));
+            vP = %(VOR)s(vP, %(VANDNOT)s(
+                        %(VCMPEQ)s(%(VAND)s(vT, vDelF), vZero), vBit3));
+        }
+        %(VSTORE)s(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline %(VTYPE)s arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         %(VTYPE)s *array,
-        %(INDEX)s t,
+        const %(VTYPE)s *pvT,
         %(INDEX)s seglen,
         %(INDEX)s d)
 {
-    return %(VLOAD)s(array + (1LL*d*seglen+t));
+    %(INDEX)s t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        %(VSTORE)s(array + (1LL*d*seglen+t), %(VLOAD)s(pvT + t));
+    }
 }
 
 #define FNAME %(NAME_TRACE)s
@@ -73,6 +109,7 @@ parasail_result_t* PNAME(
     %(VTYPE)s* const restrict pvHt = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* const restrict pvH  = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* const restrict pvGapper = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvT = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     const %(INT)s NEG_LIMIT = (-open < matrix->min ?
@@ -86,7 +123,10 @@ parasail_result_t* PNAME(
     %(VTYPE)s vSaturationCheckMax = vNegLimit;
     %(VTYPE)s vNegInfFront = vZero;
     %(VTYPE)s vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, %(ALIGNMENT)s, sizeof(%(VTYPE)s));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const %(INDEX)s segLenP = packed
+        ? (segLen + %(WIDTH)s/4 - 1) / (%(WIDTH)s/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, %(ALIGNMENT)s, sizeof(%(VTYPE)s));
     %(VTYPE)s vTIns  = %(VSET1)s(PARASAIL_INS);
     %(VTYPE)s vTDel  = %(VSET1)s(PARASAIL_DEL);
     %(VTYPE)s vTDiag = %(VSET1)s(PARASAIL_DIAG);
@@ -156,7 +196,7 @@ parasail_result_t* PNAME(
             vE_ext = %(VSUB)s(vE, vGapE);
             case1 = %(VCMPGT)s(vE_opn, vE_ext);
             vET = %(VBLEND)s(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            %(VSTORE)s(pvT + i, vET);
             vE = %(VMAX)s(vE_opn, vE_ext);
             vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vE);
             vGapper = %(VADD)s(vHt, vGapper);
@@ -186,7 +226,7 @@ parasail_result_t* PNAME(
         vF = %(VADD)s(vF, vNegInfFront);
         vH = %(VMAX)s(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = %(VLOAD)s(pvT + i);
             vHp = %(VLOAD)s(pvH+i);
             vHt = %(VLOAD)s(pvHt+i);
             vF_opn = %(VSUB)s(vH, vGapO);
@@ -202,12 +242,19 @@ parasail_result_t* PNAME(
                     vTDiag, case1);
             vT = %(VOR)s(vT, vET);
             vT = %(VOR)s(vT, vFT);
-            arr_store(result->trace->trace_table, vT, i, segLen, j);
+            %(VSTORE)s(pvT + i, vT);
             %(VSTORE)s(pvH+i, vH);
             vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
             vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vF);
             vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
         }
+
+        if (packed) {
+            arr_pack(result->trace->trace_table, pvT, segLen, j);
+        }
+        else {
+            arr_copy(result->trace->trace_table, pvT, segLen, j);
+        }
     }
 
     /* extract last value from the last column */
@@ -234,7 +281,10 @@ parasail_result_t* PNAME(
     result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_SCAN
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
 
+    parasail_free(pvT);
     parasail_free(pvGapper);
     parasail_free(pvH);
     parasail_free(pvHt);
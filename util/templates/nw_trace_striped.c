@@ -21,23 +21,59 @@
 #define NEG_INF %(NEG_INF)s
 %(FIXES)s
 
-static inline void arr_store(
+/* Pack one column of trace vectors into a PARASAIL_TRACE_FORMAT_PACKED
+ * table.  Each cell is cut down to 4 bits and %(WIDTH)s/4 consecutive
+ * vectors share one, the first vector in the low bits of each lane. */
+static inline void arr_pack(
         %(VTYPE)s *array,
-        %(VTYPE)s vH,
-        %(INDEX)s t,
+        const %(VTYPE)s *pvT,
         %(INDEX)s seglen,
         %(INDEX)s d)
 {
-    %(VSTORE)s(array + (1LL*d*seglen+t), vH);
+    const %(INDEX)s cells = %(WIDTH)s / 4;
+    const %(INDEX)s seglenp = (seglen + cells - 1) / cells;
+    const %(VTYPE)s vZero = %(VSET0)s();
+    const %(VTYPE)s vInsDiag = %(VSET1)s(PARASAIL_INS | PARASAIL_DIAG);
+    const %(VTYPE)s vDelDiag = %(VSET1)s(PARASAIL_DEL | PARASAIL_DIAG);
+    const %(VTYPE)s vInsE = %(VSET1)s(PARASAIL_INS_E);
+    const %(VTYPE)s vDelF = %(VSET1)s(PARASAIL_DEL_F);
+    %(INDEX)s q = 0;
+    %(INDEX)s p = 0;
+
+    for (q=0; q<seglenp; ++q) {
+        %(VTYPE)s vP = vZero;
+        for (p=0; p<cells && q*cells+p<seglen; ++p) {
+            %(VTYPE)s vT = %(VLOAD)s(pvT + q*cells + p);
+            %(VTYPE)s vBit0 = %(VSET1)s((%(INT)s)(1ULL << (4*p)));
+            %(VTYPE)s vBit1 = %(VSET1)s((%(INT)s)(1ULL << (4*p+1)));
+            %(VTYPE)s vBit2 = %(VSET1)s((%(INT)s)(1ULL << (4*p+2)));
+            %(VTYPE)s vBit3 = %(VSET1)s((%(INT)s)(1ULL << (4*p+3)));
+            vP = %(VOR)s(vP, %(VANDNOT)s(
+                        %(VCMPEQ)s(%(VAND)s(vT, vInsDiag), vZero), vBit0));
+            vP = %(VOR)s(vP, %(VANDNOT)s(
+                        %(VCMPEQ)s(%(VAND)s(vT, vDelDiag), vZero), vBit1));
+            vP = %(VOR)s(vP, %(VANDNOT)s(
+                        %(VCMPEQ)s(%(VAND)s(vT, vInsE), vZero), vBit2));
+            vP = %(VOR)s(vP, %(VANDNOT)s(
+                        %(VCMPEQ)s(%(VAND)s(vT, vDelF), vZero), vBit3));
+        }
+        %(VSTORE)s(array + (1LL*d*seglenp+q), vP);
+    }
 }
 
-static inline %(VTYPE)s arr_load(
+/* Copy one column of trace vectors into a PARASAIL_TRACE_FORMAT_TABLE
+ * table, one vector per segment. */
+static inline void arr_copy(
         %(VTYPE)s *array,
-        %(INDEX)s t,
+        const %(VTYPE)s *pvT,
         %(INDEX)s seglen,
         %(INDEX)s d)
 {
-    return %(VLOAD)s(array + (1LL*d*seglen+t));
+    %(INDEX)s t = 0;
+
+    for (t=0; t<seglen; ++t) {
+        %(VSTORE)s(array + (1LL*d*seglen+t), %(VLOAD)s(pvT + t));
+    }
 }
 
 #define FNAME %(NAME_TRACE)s
@@ -78,12 +114,17 @@ parasail_result_t* PNAME(
     %(VTYPE)s* restrict pvEaLoad = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* const restrict pvHT = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+    %(VTYPE)s* restrict pvT = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvTNext = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
     %(INT)s score = NEG_INF;
     %(SATURATION_CHECK_INIT)s
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, %(ALIGNMENT)s, sizeof(%(VTYPE)s));
+    const int packed = PARASAIL_TRACE_FORMAT_PACKED == profile->trace_format;
+    const %(INDEX)s segLenP = packed
+        ? (segLen + %(WIDTH)s/4 - 1) / (%(WIDTH)s/4) : segLen;
+    parasail_result_t *result = parasail_result_new_trace(segLenP, s2Len, %(ALIGNMENT)s, sizeof(%(VTYPE)s));
     %(VTYPE)s vTIns  = %(VSET1)s(PARASAIL_INS);
     %(VTYPE)s vTDel  = %(VSET1)s(PARASAIL_DEL);
     %(VTYPE)s vTDiag = %(VSET1)s(PARASAIL_DIAG);
@@ -106,7 +147,7 @@ parasail_result_t* PNAME(
     }
 
     for (i=0; i<segLen; ++i) {
-        arr_store(result->trace->trace_table, vTDiagE, i, segLen, 0);
+        %(VSTORE)s(pvT + i, vTDiagE);
     }
 
     /* outer loop over database sequence */
@@ -153,7 +194,7 @@ parasail_result_t* PNAME(
             %(SATURATION_CHECK_MID)s
 
             {
-                %(VTYPE)s vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                %(VTYPE)s vTAll = %(VLOAD)s(pvT + i);
                 %(VTYPE)s case1 = %(VCMPEQ)s(vH, vH_dag);
                 %(VTYPE)s case2 = %(VCMPEQ)s(vH, vF);
                 %(VTYPE)s vT = %(VBLEND)s(
@@ -161,7 +202,7 @@ parasail_result_t* PNAME(
                         vTDiag, case1);
                 %(VSTORE)s(pvHT + i, vT);
                 vT = %(VOR)s(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i, segLen, j);
+                %(VSTORE)s(pvT + i, vT);
             }
 
             vEF_opn = %(VSUB)s(vH, vGapO);
@@ -178,7 +219,7 @@ parasail_result_t* PNAME(
                 if (j+1<s2Len) {
                     %(VTYPE)s cond = %(VCMPGT)s(vEF_opn, vEa_ext);
                     %(VTYPE)s vT = %(VBLEND)s(vTInsE, vTDiagE, cond);
-                    arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                    %(VSTORE)s(pvTNext + i, vT);
                 }
             }
 
@@ -186,11 +227,11 @@ parasail_result_t* PNAME(
             vF_ext = %(VSUB)s(vF, vGapE);
             vF = %(VMAX)s(vEF_opn, vF_ext);
             if (i+1<segLen) {
-                %(VTYPE)s vTAll = arr_load(result->trace->trace_table, i+1, segLen, j);
+                %(VTYPE)s vTAll = %(VLOAD)s(pvT + i+1);
                 %(VTYPE)s cond = %(VCMPGT)s(vEF_opn, vF_ext);
                 %(VTYPE)s vT = %(VBLEND)s(vTDelF, vTDiagF, cond);
                 vT = %(VOR)s(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i+1, segLen, j);
+                %(VSTORE)s(pvT + i+1, vT);
             }
 
             /* Load the next vH. */
@@ -233,22 +274,22 @@ parasail_result_t* PNAME(
                     case1 = %(VCMPEQ)s(vH, vHp);
                     case2 = %(VCMPEQ)s(vH, vF);
                     cond = %(VANDNOT)s(case1,case2);
-                    vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    vTAll = %(VLOAD)s(pvT + i);
                     vT = %(VLOAD)s(pvHT + i);
                     vT = %(VBLEND)s(vT, vTDel, cond);
                     %(VSTORE)s(pvHT + i, vT);
                     vTAll = %(VAND)s(vTAll, vTMask);
                     vTAll = %(VOR)s(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    %(VSTORE)s(pvT + i, vTAll);
                 }
                 /* Update vF value. */
                 {
-                    %(VTYPE)s vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    %(VTYPE)s vTAll = %(VLOAD)s(pvT + i);
                     %(VTYPE)s cond = %(VCMPGT)s(vEF_opn, vFa_ext);
                     %(VTYPE)s vT = %(VBLEND)s(vTDelF, vTDiagF, cond);
                     vTAll = %(VAND)s(vTAll, vFTMask);
                     vTAll = %(VOR)s(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    %(VSTORE)s(pvT + i, vTAll);
                 }
                 vEF_opn = %(VSUB)s(vH, vGapO);
                 vF_ext = %(VSUB)s(vF, vGapE);
@@ -260,7 +301,7 @@ parasail_result_t* PNAME(
                     if (j+1<s2Len) {
                         %(VTYPE)s cond = %(VCMPGT)s(vEF_opn, vEa_ext);
                         %(VTYPE)s vT = %(VBLEND)s(vTInsE, vTDiagE, cond);
-                        arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                        %(VSTORE)s(pvTNext + i, vT);
                     }
                 }
                 if (! %(VMOVEMASK)s(
@@ -277,6 +318,13 @@ parasail_result_t* PNAME(
         }
 end:
         {
+            if (packed) {
+                arr_pack(result->trace->trace_table, pvT, segLen, j);
+            }
+            else {
+                arr_copy(result->trace->trace_table, pvT, segLen, j);
+            }
+            SWAP(pvT, pvTNext)
         }
     }
 
@@ -297,7 +345,11 @@ end:
     result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+    result->trace->format = packed
+        ? PARASAIL_TRACE_FORMAT_PACKED : PARASAIL_TRACE_FORMAT_TABLE;
 
+    parasail_free(pvTNext);
+    parasail_free(pvT);
     parasail_free(boundary);
     parasail_free(pvHT);
     parasail_free(pvEaLoad);
@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -251,12 +252,22 @@ parasail_result_t* FNAME(
 
     /* alignment ending position */
     {
-        %(INT)s *t = (%(INT)s*)&vMaxH;
-        int16_t *ilo = (int16_t*)&vEndILo;
-        int16_t *jlo = (int16_t*)&vEndJLo;
-        int16_t *ihi = (int16_t*)&vEndIHi;
-        int16_t *jhi = (int16_t*)&vEndJHi;
+        %(INT)s aMaxH[%(LANES)s];
+        int16_t aEndILo[%(LANES)s/2];
+        int16_t aEndJLo[%(LANES)s/2];
+        int16_t aEndIHi[%(LANES)s/2];
+        int16_t aEndJHi[%(LANES)s/2];
+        %(INT)s *t = aMaxH;
+        int16_t *ilo = aEndILo;
+        int16_t *jlo = aEndJLo;
+        int16_t *ihi = aEndIHi;
+        int16_t *jhi = aEndJHi;
         %(INDEX)s k;
+        memcpy(aMaxH, &vMaxH, sizeof(aMaxH));
+        memcpy(aEndILo, &vEndILo, sizeof(aEndILo));
+        memcpy(aEndJLo, &vEndJLo, sizeof(aEndJLo));
+        memcpy(aEndIHi, &vEndIHi, sizeof(aEndIHi));
+        memcpy(aEndJHi, &vEndJHi, sizeof(aEndJHi));
         for (k=0; k<N/2; ++k, ++t, ++ilo, ++jlo) {
             if (*t > score) {
                 score = *t;
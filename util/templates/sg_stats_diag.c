@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -407,21 +408,49 @@ parasail_result_t* FNAME(
         %(INT)s last_valm = NEG_INF;
         %(INT)s last_vals = NEG_INF;
         %(INT)s last_vall = NEG_INF;
-        %(INT)s *rh = (%(INT)s*)&vMaxHRow;
-        %(INT)s *rm = (%(INT)s*)&vMaxMRow;
-        %(INT)s *rs = (%(INT)s*)&vMaxSRow;
-        %(INT)s *rl = (%(INT)s*)&vMaxLRow;
-        %(INT)s *ch = (%(INT)s*)&vMaxHCol;
-        %(INT)s *cm = (%(INT)s*)&vMaxMCol;
-        %(INT)s *cs = (%(INT)s*)&vMaxSCol;
-        %(INT)s *cl = (%(INT)s*)&vMaxLCol;
-        %(INT)s *lh = (%(INT)s*)&vLastValH;
-        %(INT)s *lm = (%(INT)s*)&vLastValM;
-        %(INT)s *ls = (%(INT)s*)&vLastValS;
-        %(INT)s *ll = (%(INT)s*)&vLastValL;
-        %(INT)s *i = (%(INT)s*)&vEndI;
-        %(INT)s *j = (%(INT)s*)&vEndJ;
+        %(INT)s aMaxHRow[%(LANES)s];
+        %(INT)s aMaxMRow[%(LANES)s];
+        %(INT)s aMaxSRow[%(LANES)s];
+        %(INT)s aMaxLRow[%(LANES)s];
+        %(INT)s aMaxHCol[%(LANES)s];
+        %(INT)s aMaxMCol[%(LANES)s];
+        %(INT)s aMaxSCol[%(LANES)s];
+        %(INT)s aMaxLCol[%(LANES)s];
+        %(INT)s aLastValH[%(LANES)s];
+        %(INT)s aLastValM[%(LANES)s];
+        %(INT)s aLastValS[%(LANES)s];
+        %(INT)s aLastValL[%(LANES)s];
+        %(INT)s aEndI[%(LANES)s];
+        %(INT)s aEndJ[%(LANES)s];
+        %(INT)s *rh = aMaxHRow;
+        %(INT)s *rm = aMaxMRow;
+        %(INT)s *rs = aMaxSRow;
+        %(INT)s *rl = aMaxLRow;
+        %(INT)s *ch = aMaxHCol;
+        %(INT)s *cm = aMaxMCol;
+        %(INT)s *cs = aMaxSCol;
+        %(INT)s *cl = aMaxLCol;
+        %(INT)s *lh = aLastValH;
+        %(INT)s *lm = aLastValM;
+        %(INT)s *ls = aLastValS;
+        %(INT)s *ll = aLastValL;
+        %(INT)s *i = aEndI;
+        %(INT)s *j = aEndJ;
         %(INDEX)s k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxMRow, &vMaxMRow, sizeof(aMaxMRow));
+        memcpy(aMaxSRow, &vMaxSRow, sizeof(aMaxSRow));
+        memcpy(aMaxLRow, &vMaxLRow, sizeof(aMaxLRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aMaxMCol, &vMaxMCol, sizeof(aMaxMCol));
+        memcpy(aMaxSCol, &vMaxSCol, sizeof(aMaxSCol));
+        memcpy(aMaxLCol, &vMaxLCol, sizeof(aMaxLCol));
+        memcpy(aLastValH, &vLastValH, sizeof(aLastValH));
+        memcpy(aLastValM, &vLastValM, sizeof(aLastValM));
+        memcpy(aLastValS, &vLastValS, sizeof(aLastValS));
+        memcpy(aLastValL, &vLastValL, sizeof(aLastValL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++rh, ++rm, ++rs, ++rl, ++ch, ++cm, ++cs, ++cl, ++lh, ++lm, ++ls, ++ll, ++i, ++j) {
             if (*ch > max_colh || (*ch == max_colh && *i < end_query)) {
                 max_colh = *ch;
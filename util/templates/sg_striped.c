@@ -100,6 +100,7 @@ parasail_result_t* PNAME(
     const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
     %(INT)s score = NEG_LIMIT;
     %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_LIMIT-1);
     %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
     %(VTYPE)s vSaturationCheckMin = vPosLimit;
     %(VTYPE)s vSaturationCheckMax = vNegLimit;
@@ -131,8 +132,10 @@ parasail_result_t* PNAME(
     for (j=0; j<s2Len; ++j) {
         %(VTYPE)s vE;
         /* Initialize F value to -inf.  Any errors to vH values will be
-         * corrected in the Lazy_F loop.  */
-        %(VTYPE)s vF = vNegLimit;
+         * corrected in the Lazy_F loop.  -inf is below NEG_LIMIT so that
+         * an H value floored by it is still seen as saturated, which
+         * matters when the whole query fits in one segment. */
+        %(VTYPE)s vF = vNegInf;
 
         /* load final segment of pvHStore and shift left by 2 bytes */
         %(VTYPE)s vH = %(VSHIFT)s(pvHStore[segLen - 1], %(BYTES)s);
@@ -196,7 +199,7 @@ parasail_result_t* PNAME(
 #endif
                 vH = %(VSUB)s(vH, vGapO);
                 vF = %(VSUB)s(vF, vGapE);
-                if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
+                if (! %(LAZY_F_TEST)s) goto end;
                 /*vF = %(VMAX)s(vF, vH);*/
             }
         }
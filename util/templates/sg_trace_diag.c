@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -233,12 +234,22 @@ parasail_result_t* FNAME(
         %(INT)s max_row = NEG_INF;
         %(INT)s max_col = NEG_INF;
         %(INT)s last_val = NEG_INF;
-        %(INT)s *s = (%(INT)s*)&vMaxHRow;
-        %(INT)s *t = (%(INT)s*)&vMaxHCol;
-        %(INT)s *u = (%(INT)s*)&vLastVal;
-        %(INT)s *i = (%(INT)s*)&vEndI;
-        %(INT)s *j = (%(INT)s*)&vEndJ;
+        %(INT)s aMaxHRow[%(LANES)s];
+        %(INT)s aMaxHCol[%(LANES)s];
+        %(INT)s aLastVal[%(LANES)s];
+        %(INT)s aEndI[%(LANES)s];
+        %(INT)s aEndJ[%(LANES)s];
+        %(INT)s *s = aMaxHRow;
+        %(INT)s *t = aMaxHCol;
+        %(INT)s *u = aLastVal;
+        %(INT)s *i = aEndI;
+        %(INT)s *j = aEndJ;
         %(INDEX)s k;
+        memcpy(aMaxHRow, &vMaxHRow, sizeof(aMaxHRow));
+        memcpy(aMaxHCol, &vMaxHCol, sizeof(aMaxHCol));
+        memcpy(aLastVal, &vLastVal, sizeof(aLastVal));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++s, ++t, ++u, ++i, ++j) {
             if (*t > max_col || (*t == max_col && *i < end_query)) {
                 max_col = *t;
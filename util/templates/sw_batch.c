@@ -0,0 +1,239 @@
+/**
+ * @file
+ *
+ * @author jeffrey.daily@gmail.com
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Inter-sequence local alignment, one database sequence per vector
+ * lane, after the approach used by SWIPE (Rognes, 2011).  The query is
+ * walked row by row while each lane walks its own database sequence.
+ * When a lane reaches the end of its database sequence, its score is
+ * retired and the lane is refilled with the next database sequence.
+ *
+ * The 8- and 16-bit kernels keep scores relative to a bias at the
+ * bottom of the range so that the saturating add also clamps local
+ * scores at zero; the 32-bit kernels clamp at zero with a max().  The
+ * end positions are those of parasail_sw: the first column, and within
+ * it the first row, holding the maximum.  A column is only searched for
+ * its row when it raised its lane's maximum.  Saturated results report
+ * end positions of 0.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+%(FIXES)s
+
+static inline parasail_result_t* batch_result(
+        %(INT)s score, %(INT)s maxp, %(INT)s bias,
+        int end_query, int end_ref)
+{
+    parasail_result_t *result = parasail_result_new();
+    if (score > maxp) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT%(WIDTH)s_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+    result->score = score - bias;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SW
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+    return result;
+}
+
+void %(NAME)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        parasail_result_t ** const restrict results)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s a = 0;
+    %(INDEX)s lane = 0;
+    %(INDEX)s next = 0;
+    const %(INDEX)s n = matrix->size;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s rows = s1Len > 0 ? s1Len : 1;
+    %(INDEX)s * const restrict s1Map = parasail_memalign_int32_t(%(ALIGNMENT)s, rows);
+    %(INT)s * const restrict matrixT = parasail_memalign_%(INT)s(%(ALIGNMENT)s, n*n);
+    %(VTYPE)s* const restrict vProfile = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, n);
+    %(INT)s * const restrict profile = (%(INT)s*)vProfile;
+    %(VTYPE)s* const restrict pvH = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, rows);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, rows);
+    const %(INT)s * const H = (const %(INT)s*)pvH;
+    /* lane views of the running maximum, the refill limit and the
+     * maximum before the current column */
+    %(VTYPE)s* const pvLanes = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 3);
+    %(INT)s * const maxLanes = (%(INT)s*)(pvLanes + 0);
+    %(INT)s * const limitLanes = (%(INT)s*)(pvLanes + 1);
+    %(INT)s * const prevLanes = (%(INT)s*)(pvLanes + 2);
+    %(INDEX)s seq[%(LANES)s];
+    %(INDEX)s pos[%(LANES)s];
+    %(INDEX)s fresh[%(LANES)s];
+    %(INDEX)s endQuery[%(LANES)s];
+    %(INDEX)s endRef[%(LANES)s];
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(INT)s bias = %(BATCH_BIAS)s;
+    %(VTYPE)s vBias = %(VSET1)s(bias);
+    %(VTYPE)s vMaxH = vBias;
+    %(INT)s maxp = INT%(WIDTH)s_MAX - (%(INT)s)(matrix->max+1);
+
+    /* map the query once; transpose the matrix so that a database
+     * residue's column of scores is contiguous */
+    for (i=0; i<s1Len; ++i) {
+        s1Map[i] = matrix->mapper[(unsigned char)s1[i]];
+    }
+    for (a=0; a<n; ++a) {
+        for (i=0; i<n; ++i) {
+            matrixT[a*n + i] = (%(INT)s)matrix->matrix[i*n + a];
+        }
+    }
+
+    /* initialize H and E; lanes start out idle */
+    parasail_memset_%(VTYPE)s(pvH, vBias, rows);
+    parasail_memset_%(VTYPE)s(pvE, vBias, rows);
+    for (lane=0; lane<segWidth; ++lane) {
+        seq[lane] = -1;
+        pos[lane] = 0;
+        fresh[lane] = 0;
+        endQuery[lane] = 0;
+        endRef[lane] = 0;
+    }
+
+    /* outer loop over database columns, one per lane */
+    for (;;) {
+        int active = 0;
+        int refill = 0;
+
+        /* retire lanes whose database sequence is finished and
+         * refill them with the next database sequence */
+        %(VSTORE)s(pvLanes + 0, vMaxH);
+        for (lane=0; lane<segWidth; ++lane) {
+            limitLanes[lane] = INT%(WIDTH)s_MAX;
+            if (seq[lane] >= 0 && pos[lane] == s2Lens[seq[lane]]) {
+                results[seq[lane]] = batch_result(maxLanes[lane], maxp,
+                        bias, endQuery[lane], endRef[lane]);
+                seq[lane] = -1;
+            }
+            if (seq[lane] < 0) {
+                while (next < count && s2Lens[next] <= 0) {
+                    results[next] = batch_result(bias, maxp, bias, s1Len, 0);
+                    ++next;
+                }
+                if (next < count) {
+                    seq[lane] = next++;
+                    pos[lane] = 0;
+                    fresh[lane] = 1;
+                    endQuery[lane] = s1Len;
+                    endRef[lane] = s2Lens[seq[lane]];
+                    maxLanes[lane] = bias;
+                    limitLanes[lane] = bias;
+                    refill = 1;
+                }
+            }
+            if (seq[lane] >= 0) {
+                active = 1;
+            }
+        }
+        if (!active) {
+            break;
+        }
+
+        /* zero the columns of refilled lanes; all values are bounded
+         * below by the bias so a min() against it is a masked reset */
+        if (refill) {
+            %(VTYPE)s vLimit = %(VLOAD)s(pvLanes + 1);
+            vMaxH = %(VLOAD)s(pvLanes + 0);
+            for (i=0; i<s1Len; ++i) {
+                %(VSTORE)s(pvH + i,
+                        %(VMIN)s(%(VLOAD)s(pvH + i), vLimit));
+                %(VSTORE)s(pvE + i,
+                        %(VMIN)s(%(VLOAD)s(pvE + i), vLimit));
+            }
+        }
+
+        /* gather the scores of each lane's current database residue */
+        for (lane=0; lane<segWidth; ++lane) {
+            if (seq[lane] >= 0) {
+                const %(INT)s *column = matrixT + n*matrix->mapper[
+                    (unsigned char)s2s[seq[lane]][pos[lane]]];
+                for (a=0; a<n; ++a) {
+                    profile[a*segWidth + lane] = column[a];
+                }
+                ++pos[lane];
+            }
+            else {
+                for (a=0; a<n; ++a) {
+                    profile[a*segWidth + lane] = 0;
+                }
+            }
+        }
+
+        /* inner loop to process the query sequence */
+        {
+            %(VTYPE)s vPrev = vMaxH;
+            %(VTYPE)s vHDiag = vBias;
+            %(VTYPE)s vF = vBias;
+            for (i=0; i<s1Len; ++i) {
+                %(VTYPE)s vH;
+                %(VTYPE)s vHLeft = %(VLOAD)s(pvH + i);
+                %(VTYPE)s vE = %(VLOAD)s(pvE + i);
+
+                vH = %(BATCH_DIAG)s;
+                vH = %(VMAX)s(vH, vE);
+                vH = %(VMAX)s(vH, vF);
+                %(VSTORE)s(pvH + i, vH);
+                vMaxH = %(VMAX)s(vMaxH, vH);
+                vHDiag = vHLeft;
+
+                /* Update vE and vF values. */
+                vH = %(VSUB)s(vH, vGapO);
+                vE = %(VSUB)s(vE, vGapE);
+                vE = %(VMAX)s(vE, vH);
+                %(VSTORE)s(pvE + i, vE);
+                vF = %(VSUB)s(vF, vGapE);
+                vF = %(VMAX)s(vF, vH);
+            }
+
+            /* a lane whose maximum rose in this column ends there, at
+             * the first row holding the new maximum */
+            if (refill || %(BATCH_ROSE)s) {
+                %(VSTORE)s(pvLanes + 0, vMaxH);
+                %(VSTORE)s(pvLanes + 2, vPrev);
+                for (lane=0; lane<segWidth; ++lane) {
+                    if (seq[lane] < 0
+                            || !(fresh[lane] || maxLanes[lane] > prevLanes[lane])) {
+                        continue;
+                    }
+                    fresh[lane] = 0;
+                    for (i=0; i<s1Len; ++i) {
+                        if (H[i*segWidth + lane] == maxLanes[lane]) {
+                            endQuery[lane] = i;
+                            endRef[lane] = pos[lane] - 1;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    parasail_free(pvLanes);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(vProfile);
+    parasail_free(matrixT);
+    parasail_free(s1Map);
+}
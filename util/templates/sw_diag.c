@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -214,10 +215,16 @@ parasail_result_t* FNAME(
 
     /* alignment ending position */
     {
-        %(INT)s *t = (%(INT)s*)&vMaxH;
-        %(INT)s *i = (%(INT)s*)&vEndI;
-        %(INT)s *j = (%(INT)s*)&vEndJ;
+        %(INT)s aMaxH[%(LANES)s];
+        %(INT)s aEndI[%(LANES)s];
+        %(INT)s aEndJ[%(LANES)s];
+        %(INT)s *t = aMaxH;
+        %(INT)s *i = aEndI;
+        %(INT)s *j = aEndJ;
         %(INDEX)s k;
+        memcpy(aMaxH, &vMaxH, sizeof(aMaxH));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++t, ++i, ++j) {
             if (*t > score) {
                 score = *t;
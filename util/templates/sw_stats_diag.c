@@ -8,6 +8,7 @@
 #include "config.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -355,13 +356,25 @@ parasail_result_t* FNAME(
 
     /* alignment ending position */
     {
-        %(INT)s *t = (%(INT)s*)&vMaxH;
-        %(INT)s *m = (%(INT)s*)&vMaxM;
-        %(INT)s *s = (%(INT)s*)&vMaxS;
-        %(INT)s *l = (%(INT)s*)&vMaxL;
-        %(INT)s *i = (%(INT)s*)&vEndI;
-        %(INT)s *j = (%(INT)s*)&vEndJ;
+        %(INT)s aMaxH[%(LANES)s];
+        %(INT)s aMaxM[%(LANES)s];
+        %(INT)s aMaxS[%(LANES)s];
+        %(INT)s aMaxL[%(LANES)s];
+        %(INT)s aEndI[%(LANES)s];
+        %(INT)s aEndJ[%(LANES)s];
+        %(INT)s *t = aMaxH;
+        %(INT)s *m = aMaxM;
+        %(INT)s *s = aMaxS;
+        %(INT)s *l = aMaxL;
+        %(INT)s *i = aEndI;
+        %(INT)s *j = aEndJ;
         %(INDEX)s k;
+        memcpy(aMaxH, &vMaxH, sizeof(aMaxH));
+        memcpy(aMaxM, &vMaxM, sizeof(aMaxM));
+        memcpy(aMaxS, &vMaxS, sizeof(aMaxS));
+        memcpy(aMaxL, &vMaxL, sizeof(aMaxL));
+        memcpy(aEndI, &vEndI, sizeof(aEndI));
+        memcpy(aEndJ, &vEndJ, sizeof(aEndJ));
         for (k=0; k<N; ++k, ++t, ++m, ++s, ++l, ++i, ++j) {
             if (*t > score) {
                 score = *t;